@@ -0,0 +1,587 @@
+/**
+ * @file capture_store.c
+ * @date 2026-10-19
+ *
+ * @brief Implements persistent, log-structured capture storage
+ *
+ * Layout on storage partition:
+ * @code{.unparsed}
+ * <base>/index.bin   - index header followed by append-only session records
+ * <base>/XXXX.cap    - PCAP stream of session with id 0xXXXX
+ * <base>/XXXX.hcx    - optional HCCAPX artifact of the session
+ * <base>/XXXX.idx    - sorted frame index of the session, see capture_store_index.c
+ * @endcode
+ * File names are kept in 8.3 format, because FATFS long file names are disabled.
+ */
+#include "capture_store.h"
+#include "capture_store_index.h"
+#include "mem_alloc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "esp_timer.h"
+#include "esp_vfs_fat.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+static const char *TAG = "capture_store";
+
+#define INDEX_MAGIC 0x49545343  // "CSTI"
+#define INDEX_VERSION 1
+#define PATH_MAX_LEN 32
+
+/**
+ * @brief Internal flag of index record that marks removed session.
+ */
+#define SESSION_DELETED 0x80
+
+/**
+ * @brief Index file header
+ */
+typedef struct __attribute__((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t boot;
+    uint16_t next_id;
+    uint16_t reserved;
+} index_header_t;
+
+static SemaphoreHandle_t store_mutex = NULL;
+static bool mounted = false;
+static wl_handle_t wl_handle = WL_INVALID_HANDLE;
+static index_header_t index_header;
+
+/**
+ * @brief In-memory copy of the session index, oldest session first.
+ */
+//@{
+static capture_store_session_t sessions[CONFIG_CAPTURE_STORE_MAX_SESSIONS];
+static unsigned session_count = 0;
+static unsigned index_record_count = 0;
+//@}
+
+/**
+ * @brief State of currently open session
+ */
+//@{
+static bool active = false;
+static capture_store_session_t active_session;
+static int active_fd = -1;
+static uint8_t *segment = NULL;
+static size_t segment_used = 0;
+static unsigned segments_since_sync = 0;
+//@}
+
+static uint32_t uptime_ms(){
+    return (uint32_t) (esp_timer_get_time() / 1000);
+}
+
+static void artifact_path(char *path, uint16_t id, capture_store_artifact_t artifact){
+    snprintf(path, PATH_MAX_LEN, "%s/%04x.%s", CONFIG_CAPTURE_STORE_BASE_PATH, id,
+        (artifact == CAPTURE_STORE_ARTIFACT_HCCAPX) ? "hcx" : "cap");
+}
+
+static void index_path(char *path, const char *name){
+    snprintf(path, PATH_MAX_LEN, "%s/%s", CONFIG_CAPTURE_STORE_BASE_PATH, name);
+}
+
+static int find_session(uint16_t id){
+    for(unsigned i = 0; i < session_count; i++){
+        if(sessions[i].id == id){
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void remove_session_at(unsigned position){
+    memmove(&sessions[position], &sessions[position + 1], (session_count - position - 1) * sizeof(capture_store_session_t));
+    session_count--;
+}
+
+/**
+ * @brief Applies index record to in-memory index. Newer record with the same id replaces older one.
+ */
+static void apply_record(const capture_store_session_t *record){
+    int position = find_session(record->id);
+    if(record->flags & SESSION_DELETED){
+        if(position >= 0){
+            remove_session_at(position);
+        }
+        return;
+    }
+    if(position >= 0){
+        sessions[position] = *record;
+        return;
+    }
+    if(session_count == CONFIG_CAPTURE_STORE_MAX_SESSIONS){
+        // index on flash may be longer than configured maximum, keep the newest sessions
+        remove_session_at(0);
+    }
+    sessions[session_count++] = *record;
+}
+
+static esp_err_t write_index_header(int fd){
+    if(lseek(fd, 0, SEEK_SET) != 0 || write(fd, &index_header, sizeof(index_header)) != sizeof(index_header)){
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Rewrites index file so it contains only one record per existing session.
+ */
+static esp_err_t compact_index(){
+    char path[PATH_MAX_LEN];
+    char tmp_path[PATH_MAX_LEN];
+    index_path(path, "index.bin");
+    index_path(tmp_path, "index.tmp");
+
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if(fd < 0){
+        ESP_LOGE(TAG, "Cannot create %s", tmp_path);
+        return ESP_FAIL;
+    }
+    size_t records_size = session_count * sizeof(capture_store_session_t);
+    esp_err_t err = write_index_header(fd);
+    if((err == ESP_OK) && (write(fd, sessions, records_size) != (ssize_t) records_size)){
+        err = ESP_FAIL;
+    }
+    fsync(fd);
+    close(fd);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to write compacted index");
+        unlink(tmp_path);
+        return err;
+    }
+    // FAT cannot rename over existing file
+    unlink(path);
+    if(rename(tmp_path, path) != 0){
+        ESP_LOGE(TAG, "Failed to replace index");
+        return ESP_FAIL;
+    }
+    index_record_count = session_count;
+    return ESP_OK;
+}
+
+/**
+ * @brief Appends record to index file and applies it to in-memory index.
+ */
+static esp_err_t append_record(const capture_store_session_t *record){
+    apply_record(record);
+
+    if(index_record_count >= 2 * CONFIG_CAPTURE_STORE_MAX_SESSIONS){
+        return compact_index();
+    }
+
+    char path[PATH_MAX_LEN];
+    index_path(path, "index.bin");
+    int fd = open(path, O_WRONLY | O_APPEND);
+    if(fd < 0){
+        ESP_LOGE(TAG, "Cannot open index for append");
+        return ESP_FAIL;
+    }
+    ssize_t written = write(fd, record, sizeof(capture_store_session_t));
+    close(fd);
+    if(written != sizeof(capture_store_session_t)){
+        ESP_LOGE(TAG, "Failed to append index record");
+        return ESP_FAIL;
+    }
+    index_record_count++;
+    return ESP_OK;
+}
+
+/**
+ * @brief Loads index from flash, bumps boot counter and repairs sessions interrupted by reset.
+ */
+static esp_err_t load_index(){
+    char path[PATH_MAX_LEN];
+    char tmp_path[PATH_MAX_LEN];
+    index_path(path, "index.bin");
+    index_path(tmp_path, "index.tmp");
+
+    struct stat st;
+    if((stat(path, &st) != 0) && (stat(tmp_path, &st) == 0)){
+        // reset happened during compaction, after old index was removed
+        rename(tmp_path, path);
+    }
+
+    session_count = 0;
+    index_record_count = 0;
+    index_header = (index_header_t) { .magic = INDEX_MAGIC, .version = INDEX_VERSION, .boot = 0, .next_id = 0 };
+
+    int fd = open(path, O_RDONLY);
+    if(fd >= 0){
+        index_header_t header;
+        if((read(fd, &header, sizeof(header)) == sizeof(header)) && (header.magic == INDEX_MAGIC) && (header.version == INDEX_VERSION)){
+            index_header = header;
+            capture_store_session_t record;
+            while(read(fd, &record, sizeof(record)) == sizeof(record)){
+                apply_record(&record);
+                index_record_count++;
+            }
+        } else {
+            ESP_LOGW(TAG, "Invalid index found, starting with empty one");
+        }
+        close(fd);
+    }
+
+    // sessions without CLOSED flag were interrupted, take their size from file system
+    for(unsigned i = 0; i < session_count; i++){
+        if(sessions[i].flags & CAPTURE_STORE_SESSION_CLOSED){
+            continue;
+        }
+        char session_path[PATH_MAX_LEN];
+        artifact_path(session_path, sessions[i].id, CAPTURE_STORE_ARTIFACT_PCAP);
+        sessions[i].size = (stat(session_path, &st) == 0) ? st.st_size : 0;
+        sessions[i].flags |= CAPTURE_STORE_SESSION_TRUNCATED;
+        // index runs of interrupted session are never merged
+        capture_store_index_remove(sessions[i].id);
+    }
+
+    index_header.boot++;
+    return compact_index();
+}
+
+esp_err_t capture_store_init(){
+#if CONFIG_CAPTURE_STORE_ENABLED
+    if(store_mutex == NULL){
+        store_mutex = xSemaphoreCreateMutex();
+    }
+
+    const esp_vfs_fat_mount_config_t mount_config = {
+        .max_files = 6,
+        .format_if_mount_failed = true,
+        .allocation_unit_size = CONFIG_WL_SECTOR_SIZE
+    };
+    esp_err_t err = esp_vfs_fat_spiflash_mount_rw_wl(CONFIG_CAPTURE_STORE_BASE_PATH, CONFIG_CAPTURE_STORE_PARTITION_LABEL, &mount_config, &wl_handle);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to mount partition '%s': %s", CONFIG_CAPTURE_STORE_PARTITION_LABEL, esp_err_to_name(err));
+        return err;
+    }
+
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    err = load_index();
+    mounted = (err == ESP_OK);
+    xSemaphoreGive(store_mutex);
+    ESP_LOGI(TAG, "Capture store mounted at %s, %u sessions stored, boot #%u", CONFIG_CAPTURE_STORE_BASE_PATH, session_count, index_header.boot);
+    return err;
+#else
+    ESP_LOGI(TAG, "Capture store disabled");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+bool capture_store_is_available(){
+    return mounted;
+}
+
+bool capture_store_session_active(){
+    return active;
+}
+
+int capture_store_session_id(){
+    return active ? active_session.id : -1;
+}
+
+/**
+ * @brief Writes buffered segment to flash. Must be called with mutex taken.
+ */
+static void flush_segment(){
+    if(segment_used == 0){
+        return;
+    }
+    if(!(active_session.flags & CAPTURE_STORE_SESSION_TRUNCATED)){
+        ssize_t written = write(active_fd, segment, segment_used);
+        if(written != (ssize_t) segment_used){
+            ESP_LOGE(TAG, "Segment write failed, session %04x will be truncated", active_session.id);
+            active_session.flags |= CAPTURE_STORE_SESSION_TRUNCATED;
+        } else {
+            active_session.size += segment_used;
+        }
+        if(++segments_since_sync >= CONFIG_CAPTURE_STORE_SYNC_INTERVAL){
+            fsync(active_fd);
+            segments_since_sync = 0;
+        }
+    }
+    segment_used = 0;
+}
+
+/**
+ * @brief Closes open session. Must be called with mutex taken.
+ */
+static esp_err_t session_end(){
+    flush_segment();
+    fsync(active_fd);
+    close(active_fd);
+    active_fd = -1;
+    mem_free(MEM_CATEGORY_CAPTURE, segment);
+    segment = NULL;
+
+    bool handshake;
+    if(capture_store_index_finish(active_session.size, &handshake) == ESP_OK){
+        active_session.flags |= CAPTURE_STORE_SESSION_INDEXED;
+    }
+    if(handshake){
+        active_session.flags |= CAPTURE_STORE_SESSION_HANDSHAKE;
+    }
+    active_session.duration_ms = uptime_ms() - active_session.start_ms;
+    active_session.flags |= CAPTURE_STORE_SESSION_CLOSED;
+    active = false;
+    ESP_LOGI(TAG, "Session %04x closed, %u frames, %u bytes", active_session.id, active_session.frames, active_session.size);
+    return append_record(&active_session);
+}
+
+/**
+ * @brief Removes session files and appends deletion record. Must be called with mutex taken.
+ */
+static esp_err_t session_delete(uint16_t id){
+    char path[PATH_MAX_LEN];
+    artifact_path(path, id, CAPTURE_STORE_ARTIFACT_PCAP);
+    unlink(path);
+    artifact_path(path, id, CAPTURE_STORE_ARTIFACT_HCCAPX);
+    unlink(path);
+    capture_store_index_remove(id);
+    capture_store_session_t record = { .id = id, .flags = SESSION_DELETED };
+    return append_record(&record);
+}
+
+esp_err_t capture_store_session_begin(uint8_t type, const uint8_t *bssid){
+    if(!mounted){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    if(active){
+        ESP_LOGW(TAG, "Session %04x was not closed, closing it now", active_session.id);
+        session_end();
+    }
+    while(session_count >= CONFIG_CAPTURE_STORE_MAX_SESSIONS){
+        ESP_LOGI(TAG, "Maximum sessions stored, removing oldest session %04x", sessions[0].id);
+        session_delete(sessions[0].id);
+    }
+
+    segment = (uint8_t *) mem_alloc(MEM_CATEGORY_CAPTURE, CONFIG_CAPTURE_STORE_SEGMENT_SIZE);
+    if(segment == NULL){
+        ESP_LOGE(TAG, "Cannot allocate segment buffer");
+        xSemaphoreGive(store_mutex);
+        return ESP_ERR_NO_MEM;
+    }
+
+    active_session = (capture_store_session_t) {
+        .id = index_header.next_id++,
+        .type = type,
+        .boot = index_header.boot,
+        .start_ms = uptime_ms()
+    };
+    if(bssid != NULL){
+        memcpy(active_session.bssid, bssid, 6);
+    }
+
+    char path[PATH_MAX_LEN];
+    artifact_path(path, active_session.id, CAPTURE_STORE_ARTIFACT_PCAP);
+    active_fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if(active_fd < 0){
+        ESP_LOGE(TAG, "Cannot create %s", path);
+        mem_free(MEM_CATEGORY_CAPTURE, segment);
+        segment = NULL;
+        xSemaphoreGive(store_mutex);
+        return ESP_FAIL;
+    }
+    segment_used = 0;
+    segments_since_sync = 0;
+    active = true;
+    if(capture_store_index_begin(active_session.id) != ESP_OK){
+        ESP_LOGW(TAG, "Session %04x will not be indexed", active_session.id);
+    }
+
+    // persist next_id and record of open session, so it can be recovered after reset
+    index_path(path, "index.bin");
+    int fd = open(path, O_WRONLY);
+    if(fd >= 0){
+        write_index_header(fd);
+        close(fd);
+    }
+    esp_err_t err = append_record(&active_session);
+    xSemaphoreGive(store_mutex);
+    ESP_LOGI(TAG, "Session %04x started", active_session.id);
+    return err;
+}
+
+/**
+ * @brief Copies data into segment buffer and flushes full segments. Must be called with mutex taken.
+ */
+static void buffer_data(const void *data, size_t size){
+    const uint8_t *bytes = (const uint8_t *) data;
+    while(size > 0){
+        size_t chunk = CONFIG_CAPTURE_STORE_SEGMENT_SIZE - segment_used;
+        if(chunk > size){
+            chunk = size;
+        }
+        memcpy(&segment[segment_used], bytes, chunk);
+        segment_used += chunk;
+        bytes += chunk;
+        size -= chunk;
+        if(segment_used == CONFIG_CAPTURE_STORE_SEGMENT_SIZE){
+            flush_segment();
+        }
+    }
+}
+
+esp_err_t capture_store_session_write(const void *data, size_t size, bool record){
+    if(!active){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    // session may have ended meanwhile, segment is freed then
+    if(!active){
+        xSemaphoreGive(store_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    buffer_data(data, size);
+    if(record){
+        active_session.frames++;
+    }
+    esp_err_t err = (active_session.flags & CAPTURE_STORE_SESSION_TRUNCATED) ? ESP_FAIL : ESP_OK;
+    xSemaphoreGive(store_mutex);
+    return err;
+}
+
+esp_err_t capture_store_session_write_record(const void *header, size_t header_size, const void *data, size_t size, capture_store_entry_t *entry){
+    if(!active){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    if(!active){
+        xSemaphoreGive(store_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    entry->flags = 0;
+    entry->ts_ms = uptime_ms() - active_session.start_ms;
+    entry->offset = active_session.size + segment_used;
+    entry->length = header_size + size;
+    buffer_data(header, header_size);
+    buffer_data(data, size);
+    active_session.frames++;
+    esp_err_t err = ESP_FAIL;
+    // offsets are valid only while every segment was written
+    if(!(active_session.flags & CAPTURE_STORE_SESSION_TRUNCATED)){
+        capture_store_index_add(entry);
+        err = ESP_OK;
+    }
+    xSemaphoreGive(store_mutex);
+    return err;
+}
+
+esp_err_t capture_store_session_attach(capture_store_artifact_t artifact, const void *data, size_t size){
+    if(!active || (artifact == CAPTURE_STORE_ARTIFACT_PCAP)){
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    if(!active){
+        xSemaphoreGive(store_mutex);
+        return ESP_ERR_INVALID_STATE;
+    }
+    char path[PATH_MAX_LEN];
+    artifact_path(path, active_session.id, artifact);
+    esp_err_t err = ESP_FAIL;
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if(fd >= 0){
+        if(write(fd, data, size) == (ssize_t) size){
+            active_session.flags |= CAPTURE_STORE_SESSION_HAS_HCCAPX;
+            err = ESP_OK;
+        }
+        close(fd);
+    }
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to store artifact %s", path);
+    }
+    xSemaphoreGive(store_mutex);
+    return err;
+}
+
+esp_err_t capture_store_session_end(){
+    if(!active){
+        return ESP_OK;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    esp_err_t err = active ? session_end() : ESP_OK;
+    xSemaphoreGive(store_mutex);
+    return err;
+}
+
+unsigned capture_store_list(capture_store_session_t *out, unsigned max){
+    if(!mounted){
+        return 0;
+    }
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    unsigned count = (session_count < max) ? session_count : max;
+    memcpy(out, sessions, count * sizeof(capture_store_session_t));
+    xSemaphoreGive(store_mutex);
+    return count;
+}
+
+int capture_store_open(uint16_t id, capture_store_artifact_t artifact, size_t *size){
+    if(!mounted){
+        return -1;
+    }
+    int fd = -1;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    if((find_session(id) >= 0) && !(active && (active_session.id == id))){
+        char path[PATH_MAX_LEN];
+        artifact_path(path, id, artifact);
+        fd = open(path, O_RDONLY);
+        struct stat st;
+        if((fd >= 0) && (size != NULL)){
+            *size = (fstat(fd, &st) == 0) ? st.st_size : 0;
+        }
+    }
+    xSemaphoreGive(store_mutex);
+    return fd;
+}
+
+esp_err_t capture_store_query(const capture_store_query_t *query, capture_store_query_cb_t callback, void *ctx){
+    if(!mounted){
+        return ESP_ERR_INVALID_STATE;
+    }
+    int fd = -1;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    int position = find_session(query->id);
+    if((position >= 0) && (sessions[position].flags & CAPTURE_STORE_SESSION_INDEXED) && !(active && (active_session.id == query->id))){
+        char path[PATH_MAX_LEN];
+        artifact_path(path, query->id, CAPTURE_STORE_ARTIFACT_PCAP);
+        fd = open(path, O_RDONLY);
+    }
+    xSemaphoreGive(store_mutex);
+    if(fd < 0){
+        return ESP_ERR_NOT_FOUND;
+    }
+    // session files are read without holding the mutex, so capture can continue meanwhile
+    esp_err_t err = capture_store_index_query(fd, query, callback, ctx);
+    close(fd);
+    return err;
+}
+
+esp_err_t capture_store_delete(uint16_t id){
+    if(!mounted){
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t err;
+    xSemaphoreTake(store_mutex, portMAX_DELAY);
+    if(active && (active_session.id == id)){
+        err = ESP_ERR_INVALID_STATE;
+    } else if(find_session(id) < 0){
+        err = ESP_ERR_NOT_FOUND;
+    } else {
+        err = session_delete(id);
+    }
+    xSemaphoreGive(store_mutex);
+    return err;
+}
@@ -0,0 +1,637 @@
+/**
+ * @file capture_store_index.c
+ * @date 2026-10-19
+ *
+ * @brief Implements per-session sorted frame index
+ *
+ * While session is open, index entries are collected in RAM. Every time the buffer fills up,
+ * it is sorted and appended to XXXX.irn as one sorted run. When session is closed, runs are merged
+ * into the final index file:
+ * @code{.unparsed}
+ * <base>/XXXX.idx - index_file_header_t followed by capture_store_entry_t[count],
+ *                   sorted by BSSID, STA, kind and timestamp
+ * @endcode
+ * Queries with BSSID use binary search over the index file, so only the matching range of entries
+ * and records is read from flash. Matches are sorted back by offset before records are read.
+ */
+#include "capture_store_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "mem_alloc.h"
+
+static const char *TAG = "capture_store_index";
+
+#define INDEX_FILE_MAGIC 0x58495343  // "CSIX"
+#define INDEX_FILE_VERSION 1
+#define PATH_MAX_LEN 32
+
+/**
+ * @brief Number of index entries read at once while scanning index file
+ */
+#define SCAN_ENTRIES 32
+
+/**
+ * @brief Bits of EAPOL-Key message numbers in eapol_pair_t.messages
+ * @{
+ */
+#define EAPOL_M1 (1 << 1)
+#define EAPOL_M2 (1 << 2)
+#define EAPOL_M3 (1 << 3)
+//@}
+
+/**
+ * @brief Header of final index file
+ */
+typedef struct __attribute__((__packed__)) {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t reserved;
+    uint32_t count;         ///< number of entries, written last
+    uint32_t prefix_size;   ///< size of session data preceding the first record (e.g. PCAP global header)
+} index_file_header_t;
+
+/**
+ * @brief EAPOL-Key messages seen between one AP and one STA
+ */
+typedef struct {
+    uint8_t bssid[6];
+    uint8_t sta[6];
+    uint8_t messages;       ///< bit mask of seen message numbers
+} eapol_pair_t;
+
+/**
+ * @brief Read position in one sorted run while runs are merged
+ */
+typedef struct {
+    uint32_t next;                      ///< index of the first entry not yet loaded into buffer
+    uint32_t end;                       ///< index one past the last entry of the run
+    capture_store_entry_t *buffer;
+    unsigned position;
+    unsigned used;
+} run_cursor_t;
+
+/**
+ * @brief Record matched by query
+ */
+typedef struct {
+    uint32_t offset;
+    uint32_t length;
+} query_match_t;
+
+/**
+ * @brief Number of matched records sorted into capture order at once. Query with more matches makes more passes over the index.
+ */
+#define QUERY_MATCHES (CONFIG_CAPTURE_STORE_INDEX_MERGE_BUFFER / sizeof(query_match_t))
+
+/**
+ * @brief Query output buffer, passed to callback when full
+ */
+typedef struct {
+    int data_fd;
+    uint8_t *buffer;
+    size_t used;
+    capture_store_query_cb_t callback;
+    void *ctx;
+} query_output_t;
+
+/**
+ * @brief State of index of currently open session
+ */
+//@{
+static uint16_t index_id;
+static capture_store_entry_t *run = NULL;
+static unsigned run_used = 0;
+static unsigned run_count = 0;
+static uint32_t entry_count = 0;
+static uint32_t prefix_size = 0;
+static int runs_fd = -1;
+static bool index_failed = false;
+static eapol_pair_t eapol_pairs[CONFIG_CAPTURE_STORE_INDEX_EAPOL_PAIRS];
+static unsigned eapol_pair_count = 0;
+//@}
+
+static void index_file_path(char *path, uint16_t id, const char *extension){
+    snprintf(path, PATH_MAX_LEN, "%s/%04x.%s", CONFIG_CAPTURE_STORE_BASE_PATH, id, extension);
+}
+
+static int entry_compare(const void *a, const void *b){
+    const capture_store_entry_t *x = (const capture_store_entry_t *) a;
+    const capture_store_entry_t *y = (const capture_store_entry_t *) b;
+    // BSSID and STA are adjacent in packed entry, so both are compared at once
+    int result = memcmp(x->bssid, y->bssid, 12);
+    if(result != 0){
+        return result;
+    }
+    if(x->kind != y->kind){
+        return (int) x->kind - (int) y->kind;
+    }
+    if(x->ts_ms != y->ts_ms){
+        return (x->ts_ms < y->ts_ms) ? -1 : 1;
+    }
+    return (x->offset < y->offset) ? -1 : (x->offset > y->offset);
+}
+
+static eapol_pair_t *find_eapol_pair(const uint8_t *bssid, const uint8_t *sta){
+    for(unsigned i = 0; i < eapol_pair_count; i++){
+        if((memcmp(eapol_pairs[i].bssid, bssid, 6) == 0) && (memcmp(eapol_pairs[i].sta, sta, 6) == 0)){
+            return &eapol_pairs[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Handshake is complete if it contains message pair usable for cracking (M1+M2 or M2+M3).
+ */
+static bool is_handshake_complete(uint8_t messages){
+    return ((messages & (EAPOL_M1 | EAPOL_M2)) == (EAPOL_M1 | EAPOL_M2))
+        || ((messages & (EAPOL_M2 | EAPOL_M3)) == (EAPOL_M2 | EAPOL_M3));
+}
+
+static void mark_entry(capture_store_entry_t *entry){
+    if(entry->kind != CAPTURE_STORE_FRAME_EAPOL){
+        return;
+    }
+    const eapol_pair_t *pair = find_eapol_pair(entry->bssid, entry->sta);
+    if((pair != NULL) && is_handshake_complete(pair->messages)){
+        entry->flags |= CAPTURE_STORE_ENTRY_COMPLETE;
+    }
+}
+
+static void write_entries(int fd, capture_store_entry_t *entries, unsigned count){
+    for(unsigned i = 0; i < count; i++){
+        mark_entry(&entries[i]);
+    }
+    size_t size = count * sizeof(capture_store_entry_t);
+    if(write(fd, entries, size) != (ssize_t) size){
+        index_failed = true;
+    }
+}
+
+/**
+ * @brief Sorts entries buffered in RAM and appends them to runs file.
+ */
+static void spill_run(){
+    qsort(run, run_used, sizeof(capture_store_entry_t), entry_compare);
+    if(runs_fd < 0){
+        char path[PATH_MAX_LEN];
+        index_file_path(path, index_id, "irn");
+        runs_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666);
+    }
+    size_t size = run_used * sizeof(capture_store_entry_t);
+    if((runs_fd < 0) || (write(runs_fd, run, size) != (ssize_t) size)){
+        ESP_LOGE(TAG, "Failed to write index run, session %04x will not be indexed", index_id);
+        index_failed = true;
+    }
+    run_count++;
+    run_used = 0;
+}
+
+static bool cursor_fill(run_cursor_t *cursor, unsigned capacity){
+    if(cursor->position < cursor->used){
+        return true;
+    }
+    if(cursor->next >= cursor->end){
+        return false;
+    }
+    unsigned count = cursor->end - cursor->next;
+    if(count > capacity){
+        count = capacity;
+    }
+    size_t size = count * sizeof(capture_store_entry_t);
+    if((lseek(runs_fd, cursor->next * sizeof(capture_store_entry_t), SEEK_SET) < 0)
+        || (read(runs_fd, cursor->buffer, size) != (ssize_t) size)){
+        index_failed = true;
+        return false;
+    }
+    cursor->next += count;
+    cursor->position = 0;
+    cursor->used = count;
+    return true;
+}
+
+static const capture_store_entry_t *cursor_entry(const run_cursor_t *cursor){
+    return &cursor->buffer[cursor->position];
+}
+
+static void heap_sift_down(run_cursor_t **heap, unsigned size, unsigned i){
+    while(true){
+        unsigned smallest = i;
+        unsigned left = 2 * i + 1;
+        unsigned right = left + 1;
+        if((left < size) && (entry_compare(cursor_entry(heap[left]), cursor_entry(heap[smallest])) < 0)){
+            smallest = left;
+        }
+        if((right < size) && (entry_compare(cursor_entry(heap[right]), cursor_entry(heap[smallest])) < 0)){
+            smallest = right;
+        }
+        if(smallest == i){
+            return;
+        }
+        run_cursor_t *tmp = heap[i];
+        heap[i] = heap[smallest];
+        heap[smallest] = tmp;
+        i = smallest;
+    }
+}
+
+/**
+ * @brief Merges sorted runs into index file. RAM run buffer is reused as output buffer.
+ */
+static void merge_runs(int fd){
+    unsigned per_run = CONFIG_CAPTURE_STORE_INDEX_MERGE_BUFFER / (run_count * sizeof(capture_store_entry_t));
+    if(per_run == 0){
+        per_run = 1;
+    }
+    run_cursor_t *cursors = mem_calloc(MEM_CATEGORY_CAPTURE, run_count, sizeof(run_cursor_t));
+    run_cursor_t **heap = mem_alloc(MEM_CATEGORY_CAPTURE, run_count * sizeof(run_cursor_t *));
+    capture_store_entry_t *buffers = mem_alloc(MEM_CATEGORY_CAPTURE, run_count * per_run * sizeof(capture_store_entry_t));
+    if((cursors == NULL) || (heap == NULL) || (buffers == NULL)){
+        ESP_LOGE(TAG, "Cannot allocate memory for merging %u runs", run_count);
+        index_failed = true;
+        goto cleanup;
+    }
+
+    unsigned heap_size = 0;
+    for(unsigned i = 0; i < run_count; i++){
+        // all runs except the last one are full
+        cursors[i].next = i * CONFIG_CAPTURE_STORE_INDEX_RUN_ENTRIES;
+        cursors[i].end = (i == run_count - 1) ? entry_count : (i + 1) * CONFIG_CAPTURE_STORE_INDEX_RUN_ENTRIES;
+        cursors[i].buffer = &buffers[i * per_run];
+        if(cursor_fill(&cursors[i], per_run)){
+            heap[heap_size++] = &cursors[i];
+        }
+    }
+    for(int i = heap_size / 2 - 1; i >= 0; i--){
+        heap_sift_down(heap, heap_size, i);
+    }
+
+    unsigned output_used = 0;
+    while((heap_size > 0) && !index_failed){
+        run_cursor_t *cursor = heap[0];
+        run[output_used++] = *cursor_entry(cursor);
+        if(output_used == CONFIG_CAPTURE_STORE_INDEX_RUN_ENTRIES){
+            write_entries(fd, run, output_used);
+            output_used = 0;
+        }
+        cursor->position++;
+        if(!cursor_fill(cursor, per_run)){
+            heap[0] = heap[--heap_size];
+        }
+        heap_sift_down(heap, heap_size, 0);
+    }
+    write_entries(fd, run, output_used);
+
+cleanup:
+    mem_free(MEM_CATEGORY_CAPTURE, buffers);
+    mem_free(MEM_CATEGORY_CAPTURE, heap);
+    mem_free(MEM_CATEGORY_CAPTURE, cursors);
+}
+
+esp_err_t capture_store_index_begin(uint16_t id){
+    mem_free(MEM_CATEGORY_CAPTURE, run);
+    if(runs_fd >= 0){
+        close(runs_fd);
+        runs_fd = -1;
+    }
+    index_id = id;
+    run_used = 0;
+    run_count = 0;
+    entry_count = 0;
+    prefix_size = 0;
+    eapol_pair_count = 0;
+    run = (capture_store_entry_t *) mem_alloc(MEM_CATEGORY_CAPTURE, CONFIG_CAPTURE_STORE_INDEX_RUN_ENTRIES * sizeof(capture_store_entry_t));
+    index_failed = (run == NULL);
+    if(index_failed){
+        ESP_LOGE(TAG, "Cannot allocate index run buffer");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void capture_store_index_add(const capture_store_entry_t *entry){
+    if(index_failed){
+        return;
+    }
+    if(entry_count == 0){
+        prefix_size = entry->offset;
+    }
+    if((entry->kind == CAPTURE_STORE_FRAME_EAPOL) && (entry->info >= 1) && (entry->info <= 4)){
+        eapol_pair_t *pair = find_eapol_pair(entry->bssid, entry->sta);
+        if((pair == NULL) && (eapol_pair_count < CONFIG_CAPTURE_STORE_INDEX_EAPOL_PAIRS)){
+            pair = &eapol_pairs[eapol_pair_count++];
+            memcpy(pair->bssid, entry->bssid, 6);
+            memcpy(pair->sta, entry->sta, 6);
+            pair->messages = 0;
+        }
+        if(pair != NULL){
+            pair->messages |= 1 << entry->info;
+        }
+    }
+    run[run_used++] = *entry;
+    entry_count++;
+    if(run_used == CONFIG_CAPTURE_STORE_INDEX_RUN_ENTRIES){
+        spill_run();
+    }
+}
+
+esp_err_t capture_store_index_finish(uint32_t session_size, bool *handshake){
+    char path[PATH_MAX_LEN];
+    esp_err_t err = ESP_FAIL;
+
+    *handshake = false;
+    for(unsigned i = 0; i < eapol_pair_count; i++){
+        if(is_handshake_complete(eapol_pairs[i].messages)){
+            *handshake = true;
+        }
+    }
+
+    if(!index_failed){
+        if(entry_count == 0){
+            prefix_size = session_size;
+        }
+        if((run_count > 0) && (run_used > 0)){
+            spill_run();
+        }
+        index_file_path(path, index_id, "idx");
+        int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+        index_file_header_t header = {
+            .magic = INDEX_FILE_MAGIC,
+            .version = INDEX_FILE_VERSION,
+            .count = 0,
+            .prefix_size = prefix_size
+        };
+        if((fd >= 0) && !index_failed && (write(fd, &header, sizeof(header)) == sizeof(header))){
+            if(run_count == 0){
+                qsort(run, run_used, sizeof(capture_store_entry_t), entry_compare);
+                write_entries(fd, run, run_used);
+            } else {
+                merge_runs(fd);
+            }
+            // entry count is written last, so index interrupted by reset is empty instead of inconsistent
+            header.count = entry_count;
+            if(!index_failed && (lseek(fd, 0, SEEK_SET) == 0) && (write(fd, &header, sizeof(header)) == sizeof(header))){
+                err = ESP_OK;
+            }
+        }
+        if(fd >= 0){
+            close(fd);
+        }
+    }
+
+    if(runs_fd >= 0){
+        close(runs_fd);
+        runs_fd = -1;
+    }
+    index_file_path(path, index_id, "irn");
+    unlink(path);
+    if(err == ESP_OK){
+        ESP_LOGI(TAG, "Session %04x indexed, %u entries merged from %u runs", index_id, (unsigned) entry_count, run_count);
+    } else {
+        ESP_LOGW(TAG, "Session %04x could not be indexed", index_id);
+        index_file_path(path, index_id, "idx");
+        unlink(path);
+    }
+    mem_free(MEM_CATEGORY_CAPTURE, run);
+    run = NULL;
+    return err;
+}
+
+void capture_store_index_remove(uint16_t id){
+    char path[PATH_MAX_LEN];
+    index_file_path(path, id, "idx");
+    unlink(path);
+    index_file_path(path, id, "irn");
+    unlink(path);
+}
+
+static bool read_entry(int fd, uint32_t position, capture_store_entry_t *entry){
+    return (lseek(fd, sizeof(index_file_header_t) + position * sizeof(capture_store_entry_t), SEEK_SET) >= 0)
+        && (read(fd, entry, sizeof(capture_store_entry_t)) == sizeof(capture_store_entry_t));
+}
+
+/**
+ * @brief Compares entry with query key. Only BSSID and, if given, STA are compared.
+ */
+static int key_compare(const capture_store_entry_t *entry, const capture_store_query_t *query){
+    int result = memcmp(entry->bssid, query->bssid, 6);
+    if((result == 0) && (query->sta != NULL)){
+        result = memcmp(entry->sta, query->sta, 6);
+    }
+    return result;
+}
+
+static bool entry_matches(const capture_store_entry_t *entry, const capture_store_query_t *query){
+    if((query->sta != NULL) && (memcmp(entry->sta, query->sta, 6) != 0)){
+        return false;
+    }
+    if((query->kinds != 0) && !(query->kinds & (1 << entry->kind))){
+        return false;
+    }
+    if(query->complete_only && !(entry->flags & CAPTURE_STORE_ENTRY_COMPLETE)){
+        return false;
+    }
+    return (entry->ts_ms >= query->from_ms) && (entry->ts_ms <= query->to_ms);
+}
+
+static esp_err_t output_flush(query_output_t *output){
+    esp_err_t err = output->callback(output->buffer, output->used, output->ctx);
+    output->used = 0;
+    return err;
+}
+
+/**
+ * @brief Copies range of session data into query output.
+ */
+static esp_err_t output_copy(query_output_t *output, uint32_t offset, uint32_t length){
+    if(lseek(output->data_fd, offset, SEEK_SET) < 0){
+        return ESP_FAIL;
+    }
+    while(length > 0){
+        if(output->used == CONFIG_CAPTURE_STORE_SEGMENT_SIZE){
+            esp_err_t err = output_flush(output);
+            if(err != ESP_OK){
+                return err;
+            }
+        }
+        size_t chunk = CONFIG_CAPTURE_STORE_SEGMENT_SIZE - output->used;
+        if(chunk > length){
+            chunk = length;
+        }
+        if(read(output->data_fd, &output->buffer[output->used], chunk) != (ssize_t) chunk){
+            return ESP_FAIL;
+        }
+        output->used += chunk;
+        length -= chunk;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Restores max-heap of matches ordered by offset, starting from given node going down.
+ */
+static void match_heap_sift_down(query_match_t *heap, unsigned count, unsigned node){
+    while(true){
+        unsigned largest = node;
+        unsigned left = 2 * node + 1;
+        unsigned right = left + 1;
+        if((left < count) && (heap[left].offset > heap[largest].offset)){
+            largest = left;
+        }
+        if((right < count) && (heap[right].offset > heap[largest].offset)){
+            largest = right;
+        }
+        if(largest == node){
+            return;
+        }
+        query_match_t swap = heap[node];
+        heap[node] = heap[largest];
+        heap[largest] = swap;
+        node = largest;
+    }
+}
+
+/**
+ * @brief Keeps QUERY_MATCHES matches with the lowest offsets in max-heap.
+ */
+static void match_heap_add(query_match_t *heap, unsigned *count, const capture_store_entry_t *entry){
+    if(*count < QUERY_MATCHES){
+        // sift up
+        unsigned node = (*count)++;
+        while((node > 0) && (heap[(node - 1) / 2].offset < entry->offset)){
+            heap[node] = heap[(node - 1) / 2];
+            node = (node - 1) / 2;
+        }
+        heap[node] = (query_match_t) { .offset = entry->offset, .length = entry->length };
+        return;
+    }
+    if(entry->offset < heap[0].offset){
+        heap[0] = (query_match_t) { .offset = entry->offset, .length = entry->length };
+        match_heap_sift_down(heap, *count, 0);
+    }
+}
+
+/**
+ * @brief Sorts max-heap in place by ascending offset (heapsort).
+ */
+static void match_heap_sort(query_match_t *heap, unsigned count){
+    for(unsigned end = count; end > 1; end--){
+        query_match_t swap = heap[0];
+        heap[0] = heap[end - 1];
+        heap[end - 1] = swap;
+        match_heap_sift_down(heap, end - 1, 0);
+    }
+}
+
+esp_err_t capture_store_index_query(int data_fd, const capture_store_query_t *query, capture_store_query_cb_t callback, void *ctx){
+    char path[PATH_MAX_LEN];
+    index_file_path(path, query->id, "idx");
+    int fd = open(path, O_RDONLY);
+    if(fd < 0){
+        return ESP_ERR_NOT_FOUND;
+    }
+    index_file_header_t header;
+    if((read(fd, &header, sizeof(header)) != sizeof(header)) || (header.magic != INDEX_FILE_MAGIC) || (header.version != INDEX_FILE_VERSION)){
+        close(fd);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    query_output_t output = {
+        .data_fd = data_fd,
+        .buffer = (uint8_t *) mem_alloc(MEM_CATEGORY_CAPTURE, CONFIG_CAPTURE_STORE_SEGMENT_SIZE),
+        .used = 0,
+        .callback = callback,
+        .ctx = ctx
+    };
+    capture_store_entry_t *entries = (capture_store_entry_t *) mem_alloc(MEM_CATEGORY_CAPTURE, SCAN_ENTRIES * sizeof(capture_store_entry_t));
+    query_match_t *matches = (query_match_t *) mem_alloc(MEM_CATEGORY_CAPTURE, QUERY_MATCHES * sizeof(query_match_t));
+    if((output.buffer == NULL) || (entries == NULL) || (matches == NULL)){
+        mem_free(MEM_CATEGORY_CAPTURE, output.buffer);
+        mem_free(MEM_CATEGORY_CAPTURE, entries);
+        mem_free(MEM_CATEGORY_CAPTURE, matches);
+        close(fd);
+        return ESP_ERR_NO_MEM;
+    }
+
+    esp_err_t err = ESP_OK;
+    uint32_t start = 0;
+    if(query->bssid != NULL){
+        // lower bound of the key
+        uint32_t high = header.count;
+        while((start < high) && (err == ESP_OK)){
+            uint32_t middle = start + (high - start) / 2;
+            if(!read_entry(fd, middle, &entries[0])){
+                err = ESP_FAIL;
+            } else if(key_compare(&entries[0], query) < 0){
+                start = middle + 1;
+            } else {
+                high = middle;
+            }
+        }
+    }
+    if(err == ESP_OK){
+        err = output_copy(&output, 0, header.prefix_size);
+    }
+
+    // Index is sorted by key, not by time. Matches are collected by passes over the key range, each pass
+    // takes QUERY_MATCHES matches with the lowest offsets after the previous pass, so records are output in capture order.
+    uint32_t end = header.count;
+    uint32_t after = 0;
+    bool first_pass = true;
+    unsigned matched = 0;
+    bool more = true;
+    while((err == ESP_OK) && more){
+        unsigned match_count = 0;
+        for(uint32_t position = start; (err == ESP_OK) && (position < end); ){
+            unsigned count = end - position;
+            if(count > SCAN_ENTRIES){
+                count = SCAN_ENTRIES;
+            }
+            if(!read_entry(fd, position, &entries[0])
+                || (read(fd, &entries[1], (count - 1) * sizeof(capture_store_entry_t)) != (ssize_t) ((count - 1) * sizeof(capture_store_entry_t)))){
+                err = ESP_FAIL;
+                break;
+            }
+            for(unsigned i = 0; i < count; i++){
+                if((query->bssid != NULL) && (key_compare(&entries[i], query) != 0)){
+                    // index is sorted, there are no more matching entries, next passes stop here
+                    end = position + i;
+                    break;
+                }
+                if(entry_matches(&entries[i], query) && (first_pass || (entries[i].offset > after))){
+                    match_heap_add(matches, &match_count, &entries[i]);
+                }
+            }
+            position += count;
+        }
+        // full heap may have left out matches with higher offsets
+        more = (match_count == QUERY_MATCHES);
+        match_heap_sort(matches, match_count);
+        for(unsigned i = 0; (i < match_count) && (err == ESP_OK); i++){
+            err = output_copy(&output, matches[i].offset, matches[i].length);
+        }
+        matched += match_count;
+        if(match_count > 0){
+            after = matches[match_count - 1].offset;
+        }
+        first_pass = false;
+    }
+    if((err == ESP_OK) && (output.used > 0)){
+        err = output_flush(&output);
+    }
+    ESP_LOGD(TAG, "Query over session %04x matched %u of %u entries", query->id, matched, (unsigned) header.count);
+
+    mem_free(MEM_CATEGORY_CAPTURE, matches);
+    mem_free(MEM_CATEGORY_CAPTURE, entries);
+    mem_free(MEM_CATEGORY_CAPTURE, output.buffer);
+    close(fd);
+    return err;
+}
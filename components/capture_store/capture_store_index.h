@@ -0,0 +1,58 @@
+/**
+ * @file capture_store_index.h
+ * @date 2026-10-19
+ *
+ * @brief Internal interface of per-session sorted frame index
+ */
+#ifndef CAPTURE_STORE_INDEX_H
+#define CAPTURE_STORE_INDEX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "capture_store.h"
+
+/**
+ * @brief Prepares empty index for new session.
+ *
+ * @param id session id
+ * @return esp_err_t
+ */
+esp_err_t capture_store_index_begin(uint16_t id);
+
+/**
+ * @brief Adds entry to index of open session. Entries must be added in order of their offsets.
+ *
+ * @param entry
+ */
+void capture_store_index_add(const capture_store_entry_t *entry);
+
+/**
+ * @brief Sorts and writes final index of open session and releases all resources.
+ *
+ * @param session_size size of session data, used as prefix size when no entry was added
+ * @param handshake output, set to true if some AP/STA pair has complete handshake
+ * @return esp_err_t
+ */
+esp_err_t capture_store_index_finish(uint32_t session_size, bool *handshake);
+
+/**
+ * @brief Removes index files of given session.
+ *
+ * @param id session id
+ */
+void capture_store_index_remove(uint16_t id);
+
+/**
+ * @brief Runs query over finished session index.
+ *
+ * @param data_fd descriptor of session data file
+ * @param query
+ * @param callback
+ * @param ctx
+ * @return esp_err_t
+ */
+esp_err_t capture_store_index_query(int data_fd, const capture_store_query_t *query, capture_store_query_cb_t callback, void *ctx);
+
+#endif
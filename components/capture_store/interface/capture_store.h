@@ -0,0 +1,236 @@
+/**
+ * @file capture_store.h
+ * @date 2026-10-19
+ *
+ * @brief Provides interface to persistent, log-structured capture storage
+ *
+ * Captures are stored on FAT partition in flash. Every capture session is one append-only file
+ * written in flash sector aligned segments. Sessions are tracked in append-only session index,
+ * so they survive reset and can be listed and downloaded later.
+ */
+#ifndef CAPTURE_STORE_H
+#define CAPTURE_STORE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "esp_err.h"
+
+/**
+ * @brief Session flags stored in session index
+ * @{
+ */
+#define CAPTURE_STORE_SESSION_CLOSED     0x01   ///< session was properly finished, size and frame count are final
+#define CAPTURE_STORE_SESSION_TRUNCATED  0x02   ///< some data could not be written (storage full or write error)
+#define CAPTURE_STORE_SESSION_HAS_HCCAPX 0x04   ///< HCCAPX artifact is stored next to capture
+#define CAPTURE_STORE_SESSION_INDEXED    0x08   ///< sorted frame index is available, session can be queried
+#define CAPTURE_STORE_SESSION_HANDSHAKE  0x10   ///< at least one complete handshake was captured
+//@}
+
+/**
+ * @brief Frame index entry flags
+ * @{
+ */
+#define CAPTURE_STORE_ENTRY_COMPLETE 0x01   ///< EAPOL-Key frame belongs to AP/STA pair with complete handshake
+//@}
+
+/**
+ * @brief Kinds of files stored for one session
+ */
+typedef enum {
+    CAPTURE_STORE_ARTIFACT_PCAP,    ///< main capture stream, PCAP formatted
+    CAPTURE_STORE_ARTIFACT_HCCAPX   ///< HCCAPX binary saved at the end of session
+} capture_store_artifact_t;
+
+/**
+ * @brief Kinds of indexed frames
+ */
+typedef enum {
+    CAPTURE_STORE_FRAME_MGMT,   ///< management frame
+    CAPTURE_STORE_FRAME_CTRL,   ///< control frame
+    CAPTURE_STORE_FRAME_DATA,   ///< data frame other than EAPOL
+    CAPTURE_STORE_FRAME_EAPOL   ///< data frame carrying EAPOL packet
+} capture_store_frame_kind_t;
+
+/**
+ * @brief Frame index entry
+ *
+ * Session index is sorted by BSSID, STA, kind and timestamp, in this order.
+ */
+typedef struct __attribute__((__packed__)) {
+    uint8_t bssid[6];       ///< BSSID, zeroes if unknown (e.g. control frames)
+    uint8_t sta[6];         ///< station address, zeroes if unknown
+    uint8_t kind;           ///< capture_store_frame_kind_t
+    uint8_t info;           ///< number of 4-way handshake message (1-4) from parse_handshake_message(), 0 for other frames
+    uint8_t flags;          ///< CAPTURE_STORE_ENTRY_* flags
+    uint8_t reserved;
+    uint32_t ts_ms;         ///< milliseconds since session start, filled by capture store
+    uint32_t offset;        ///< offset of the record in PCAP artifact, filled by capture store
+    uint32_t length;        ///< length of the record including its header, filled by capture store
+} capture_store_entry_t;
+
+/**
+ * @brief Query over indexed session. Unset filters match everything.
+ */
+typedef struct {
+    uint16_t id;            ///< session id
+    const uint8_t *bssid;   ///< BSSID to match or NULL
+    const uint8_t *sta;     ///< station address to match or NULL
+    uint8_t kinds;          ///< bit mask of (1 << capture_store_frame_kind_t), 0 matches all kinds
+    bool complete_only;     ///< match only frames with CAPTURE_STORE_ENTRY_COMPLETE flag
+    uint32_t from_ms;       ///< lower bound of entry timestamp, inclusive
+    uint32_t to_ms;         ///< upper bound of entry timestamp, inclusive
+} capture_store_query_t;
+
+/**
+ * @brief Receives query output. Returning anything else than ESP_OK aborts the query.
+ */
+typedef esp_err_t (*capture_store_query_cb_t)(const void *data, size_t size, void *ctx);
+
+/**
+ * @brief Session record as stored in session index
+ *
+ * Index is append-only. Later record with the same id supersedes previous one.
+ */
+typedef struct __attribute__((__packed__)) {
+    uint16_t id;            ///< session id, used in file names
+    uint8_t type;           ///< attack_type_t that produced the capture
+    uint8_t flags;          ///< CAPTURE_STORE_SESSION_* flags
+    uint8_t bssid[6];       ///< target BSSID
+    uint16_t boot;          ///< boot counter at session start
+    uint32_t start_ms;      ///< uptime at session start in milliseconds
+    uint32_t duration_ms;   ///< session duration in milliseconds
+    uint32_t size;          ///< size of PCAP artifact in bytes
+    uint32_t frames;        ///< number of records written
+} capture_store_session_t;
+
+/**
+ * @brief Mounts storage partition and loads session index.
+ *
+ * Has to be called once before any other function. If it fails, all other functions return
+ * ESP_ERR_INVALID_STATE and application keeps working without persistent storage.
+ * @return esp_err_t
+ */
+esp_err_t capture_store_init();
+
+/**
+ * @brief Returns whether storage was successfully mounted.
+ *
+ * @return true storage is available
+ */
+bool capture_store_is_available();
+
+/**
+ * @brief Starts new capture session.
+ *
+ * Only one session can be open at the time. If maximum number of sessions is reached, the oldest session is removed.
+ * @param type attack type that produces the capture
+ * @param bssid target BSSID (6 bytes) or NULL
+ * @return esp_err_t
+ */
+esp_err_t capture_store_session_begin(uint8_t type, const uint8_t *bssid);
+
+/**
+ * @brief Returns whether there is an open session.
+ *
+ * @return true session is open and capture_store_session_write() can be called
+ */
+bool capture_store_session_active();
+
+/**
+ * @brief Returns id of currently open session.
+ *
+ * @return int session id
+ * @return -1 no session is open
+ */
+int capture_store_session_id();
+
+/**
+ * @brief Appends data to currently open session.
+ *
+ * Data are buffered and written to flash in sector sized segments.
+ * Safe to call while another task ends the session.
+ * @param data
+ * @param size
+ * @param record true if data finish a complete record (counted into frames)
+ * @return esp_err_t
+ * @return ESP_ERR_INVALID_STATE no session is open
+ */
+esp_err_t capture_store_session_write(const void *data, size_t size, bool record);
+
+/**
+ * @brief Appends one complete record to currently open session and adds it to session index.
+ *
+ * @param header record header (e.g. PCAP record header)
+ * @param header_size
+ * @param data record data
+ * @param size
+ * @param entry index entry with addresses and kind filled by caller. Remaining fields are filled by this function.
+ * @return esp_err_t
+ */
+esp_err_t capture_store_session_write_record(const void *header, size_t header_size, const void *data, size_t size, capture_store_entry_t *entry);
+
+/**
+ * @brief Stores additional artifact (e.g. HCCAPX) for currently open session.
+ *
+ * @param artifact kind of artifact, must not be CAPTURE_STORE_ARTIFACT_PCAP
+ * @param data
+ * @param size
+ * @return esp_err_t
+ */
+esp_err_t capture_store_session_attach(capture_store_artifact_t artifact, const void *data, size_t size);
+
+/**
+ * @brief Flushes remaining data and closes current session.
+ *
+ * Does nothing if there is no open session.
+ * @return esp_err_t
+ */
+esp_err_t capture_store_session_end();
+
+/**
+ * @brief Copies records of stored sessions, oldest first.
+ *
+ * @param sessions output array
+ * @param max capacity of output array
+ * @return unsigned number of copied records
+ */
+unsigned capture_store_list(capture_store_session_t *sessions, unsigned max);
+
+/**
+ * @brief Opens artifact of finished session for reading.
+ *
+ * Returned descriptor is read by read() and has to be closed by close().
+ * @param id session id
+ * @param artifact
+ * @param size output size of the artifact in bytes, can be NULL
+ * @return int file descriptor
+ * @return -1 session or artifact not found, or session is still open
+ */
+int capture_store_open(uint16_t id, capture_store_artifact_t artifact, size_t *size);
+
+/**
+ * @brief Streams records of finished session that match the query.
+ *
+ * Index is searched by binary search when BSSID is given, so only matching part of the capture is read.
+ * Output starts with data preceding the first record (PCAP global header), followed by matching records
+ * in the order they were captured. Output is passed to callback in chunks of at most CONFIG_CAPTURE_STORE_SEGMENT_SIZE bytes.
+ * @param query
+ * @param callback
+ * @param ctx passed to callback
+ * @return ESP_OK query finished
+ * @return ESP_ERR_NOT_FOUND session doesn't exist, is still open or has no index
+ * @return error returned by callback
+ */
+esp_err_t capture_store_query(const capture_store_query_t *query, capture_store_query_cb_t callback, void *ctx);
+
+/**
+ * @brief Removes session and all its artifacts.
+ *
+ * @param id session id
+ * @return esp_err_t
+ */
+esp_err_t capture_store_delete(uint16_t id);
+
+#endif
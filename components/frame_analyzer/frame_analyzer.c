@@ -8,21 +8,85 @@
  */
 #include "frame_analyzer.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
+#include <arpa/inet.h>
 
 #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "hotpath_log.h"
 
 #include "wifi_controller.h"
+#include "mem_alloc.h"
 #include "frame_analyzer_parser.h"
 
 static const char *TAG = "frame_analyzer";
 static uint8_t target_bssid[6];
 static search_type_t search_type = -1;
 
+/**
+ * @brief Recently seen EAPOL frame, identifies its retransmissions
+ */
+typedef struct {
+    uint8_t addr2[6];
+    uint16_t sequence_control;
+    uint32_t hash;              ///< FNV-1a of EAPOL packet, 0 marks unused entry
+} dedup_entry_t;
+
+#if CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES > 0
+static dedup_entry_t dedup_cache[CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES];
+static unsigned dedup_next = 0;
+#endif
+static unsigned dedup_dropped = 0;
+
+/**
+ * @brief Checks whether the same EAPOL frame was already seen and remembers it otherwise.
+ * 
+ * Retransmission has the same transmitter, sequence control and EAPOL packet. Retry bit is not required,
+ * because the original frame may be the one with retry bit set if first transmission was missed.
+ * Oldest entry is replaced when cache is full.
+ * 
+ * @param buffer
+ * @param view
+ * @param eapol_packet EAPOL packet inside the buffer
+ * @return true frame is a duplicate and should be dropped
+ */
+static bool is_eapol_duplicate(const uint8_t *buffer, const frame_view_t *view, const eapol_packet_t *eapol_packet){
+#if CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES > 0
+    const data_frame_mac_header_t *mac_header = (const data_frame_mac_header_t *) &buffer[view->frame_offset];
+    unsigned length = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
+    unsigned available = view->body + view->body_length - ((const uint8_t *) eapol_packet - buffer);
+    if(length > available){
+        length = available;
+    }
+    // FNV-1a, Ref: http://www.isthe.com/chongo/tech/comp/fnv/
+    uint32_t hash = 2166136261u;
+    for(unsigned i = 0; i < length; i++){
+        hash = (hash ^ ((const uint8_t *) eapol_packet)[i]) * 16777619u;
+    }
+    if(hash == 0){
+        hash = 1;
+    }
+
+    for(unsigned i = 0; i < CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES; i++){
+        const dedup_entry_t *entry = &dedup_cache[i];
+        if((entry->hash == hash) && (entry->sequence_control == mac_header->sequence_control)
+            && (memcmp(entry->addr2, &buffer[view->addr2], 6) == 0)){
+            return true;
+        }
+    }
+    dedup_entry_t *entry = &dedup_cache[dedup_next];
+    memcpy(entry->addr2, &buffer[view->addr2], 6);
+    entry->sequence_control = mac_header->sequence_control;
+    entry->hash = hash;
+    dedup_next = (dedup_next + 1) % CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES;
+#endif
+    return false;
+}
+
 
 /**
  * @brief Analyzes data frames from sniffer.
@@ -33,35 +97,57 @@ static search_type_t search_type = -1;
  * @param event_data 
  */
 static void data_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGV(TAG, "Handling DATA frame");
+    HOTPATH_LOGV(TAG, "Handling DATA frame");
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
 
-    if(!is_frame_bssid_matching(frame, target_bssid)){
-        ESP_LOGV(TAG, "Not matching BSSIDs.");
+    frame_view_t view;
+    if(!parse_frame_view(frame->payload, frame->rx_ctrl.sig_len, false, &view)){
+        HOTPATH_LOGV(TAG, "Malformed frame.");
+        return;
+    }
+
+    if(!is_frame_bssid_matching(frame->payload, &view, target_bssid)){
+        HOTPATH_LOGV(TAG, "Not matching BSSIDs.");
         return;
     }
 
-    eapol_packet_t *eapol_packet = parse_eapol_packet((data_frame_t *) frame->payload);
+    eapol_packet_t *eapol_packet = parse_eapol_packet(frame->payload, &view);
     if(eapol_packet == NULL){
-        ESP_LOGV(TAG, "Not an EAPOL packet.");
+        HOTPATH_LOGV(TAG, "Not an EAPOL packet.");
         return;
     }
 
     eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
     if(eapol_key_packet == NULL){
-        ESP_LOGV(TAG, "Not an EAPOL-Key packet");
+        HOTPATH_LOGV(TAG, "Not an EAPOL-Key packet");
+        return;
+    }
+
+    if(is_eapol_duplicate(frame->payload, &view, eapol_packet)){
+        dedup_dropped++;
+        HOTPATH_LOGD(TAG, "Retransmitted EAPOL-Key frame, dropped");
         return;
     }
 
     if(search_type == SEARCH_HANDSHAKE){
+        // EAPOL-Key frames are rare, so copying the frame next to its view is cheaper than parsing it again in every handler
+        unsigned event_size = sizeof(frame_analyzer_frame_t) + frame->rx_ctrl.sig_len;
+        frame_analyzer_frame_t *analyzed_frame = (frame_analyzer_frame_t *) mem_alloc(MEM_CATEGORY_INTERNAL, event_size);
+        if(analyzed_frame == NULL){
+            ESP_LOGW(TAG, "No memory for EAPOL-Key frame, dropped");
+            return;
+        }
+        analyzed_frame->view = view;
+        memcpy(&analyzed_frame->frame, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len);
         // TODO handle timeouts properly by e.g. for cycle
-        ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, frame, sizeof(wifi_promiscuous_pkt_t) + frame->rx_ctrl.sig_len, portMAX_DELAY));
+        ESP_ERROR_CHECK_WITHOUT_ABORT(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, analyzed_frame, event_size, portMAX_DELAY));
+        mem_free(MEM_CATEGORY_INTERNAL, analyzed_frame);
         return;
     }
 
     if(search_type == SEARCH_PMKID){
         pmkid_item_t *pmkid_items;
-        if((pmkid_items = parse_pmkid(eapol_key_packet)) == NULL){
+        if((pmkid_items = parse_pmkid(eapol_key_packet, ntohs(eapol_packet->header.packet_body_length))) == NULL){
             return;
         }
         ESP_ERROR_CHECK(esp_event_post(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_items, sizeof(pmkid_item_t *), portMAX_DELAY));
@@ -73,9 +159,17 @@ void frame_analyzer_capture_start(search_type_t search_type_arg, const uint8_t *
     ESP_LOGI(TAG, "Frame analysis started...");
     search_type = search_type_arg;
     memcpy(&target_bssid, bssid, 6);
+#if CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES > 0
+    memset(dedup_cache, 0, sizeof(dedup_cache));
+    dedup_next = 0;
+#endif
+    dedup_dropped = 0;
     ESP_ERROR_CHECK(esp_event_handler_register(SNIFFER_EVENTS, SNIFFER_EVENT_CAPTURED_DATA, &data_frame_handler, NULL));
 }
 
 void frame_analyzer_capture_stop(){
-    ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &data_frame_handler));
+    ESP_ERROR_CHECK(esp_event_handler_unregister(SNIFFER_EVENTS, SNIFFER_EVENT_CAPTURED_DATA, &data_frame_handler));
+    if(dedup_dropped > 0){
+        ESP_LOGI(TAG, "Dropped %u retransmitted EAPOL-Key frames", dedup_dropped);
+    }
 }
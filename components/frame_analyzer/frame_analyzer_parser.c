@@ -8,6 +8,7 @@
  */
 #include "frame_analyzer_parser.h"
 
+#include <stddef.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
@@ -16,6 +17,7 @@
 #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
 #include "esp_wifi_types.h"
+#include "hotpath_log.h"
 
 #include "frame_analyzer_types.h"
 
@@ -46,109 +48,358 @@ void print_mac_address(const uint8_t *a){
     printf("\n");
 }
 
-bool is_frame_bssid_matching(wifi_promiscuous_pkt_t *frame, uint8_t *bssid) {
-    data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) frame->payload;
-    return memcmp(mac_header->addr3, bssid, 6) == 0;
+bool parse_frame_view(const uint8_t *buffer, unsigned size, bool radiotap, frame_view_t *view){
+    memset(view, 0, sizeof(frame_view_t));
+    unsigned offset = 0;
+    if(radiotap){
+        // Ref: https://www.radiotap.org/ - version, pad and little endian length of whole radiotap header
+        if(size < 4){
+            return false;
+        }
+        offset = buffer[2] | (buffer[3] << 8);
+        if((offset < 4) || (offset > size)){
+            HOTPATH_LOGV(TAG, "Malformed radiotap header");
+            return false;
+        }
+    }
+    // Frame Control, Duration and Address 1 are present in every frame
+    if((size - offset < 10) || (size - offset > UINT16_MAX)){
+        HOTPATH_LOGV(TAG, "Frame too short");
+        return false;
+    }
+    const frame_control_t *frame_control = (const frame_control_t *) &buffer[offset];
+    view->frame_offset = offset;
+    view->frame_length = size - offset;
+    view->type = frame_control->type;
+    view->subtype = frame_control->subtype;
+    view->to_ds = frame_control->to_ds;
+    view->from_ds = frame_control->from_ds;
+    view->retry = frame_control->retry;
+    view->protected_frame = frame_control->protected_frame;
+    view->addr1 = offset + 4;
+
+    // Ref: 802.11-2016 [9.3]
+    unsigned header_length = 24;
+    switch(frame_control->type){
+        case FRAME_TYPE_MANAGEMENT:
+            // Order bit of management frames announces HT Control field
+            view->htc = frame_control->htc_order;
+            break;
+        case FRAME_TYPE_CONTROL:
+            header_length = ((frame_control->subtype == FRAME_SUBTYPE_CTRL_CTS) || (frame_control->subtype == FRAME_SUBTYPE_CTRL_ACK)) ? 10 : 16;
+            break;
+        case FRAME_TYPE_DATA:
+            if(frame_control->to_ds && frame_control->from_ds){
+                view->addr4 = offset + 24;
+                header_length += 6;
+            }
+            if(frame_control->subtype & FRAME_SUBTYPE_DATA_QOS){
+                view->qos = 1;
+                header_length += 2;
+                // Order bit of non-QoS data frames means strictly ordered service, not HT Control
+                view->htc = frame_control->htc_order;
+            }
+            break;
+        default:
+            HOTPATH_LOGV(TAG, "Extension frame");
+            return false;
+    }
+    if(view->htc){
+        header_length += 4;
+    }
+    if(view->frame_length < header_length){
+        HOTPATH_LOGV(TAG, "MAC header truncated (%u/%u)", view->frame_length, header_length);
+        return false;
+    }
+    view->header_length = header_length;
+    view->body = offset + header_length;
+    view->body_length = view->frame_length - header_length;
+    if(header_length >= 16){
+        view->addr2 = offset + 10;
+    }
+    if(frame_control->type == FRAME_TYPE_CONTROL){
+        view->sta = view->addr1;
+        return true;
+    }
+    view->addr3 = offset + 16;
+
+    // Ref: 802.11-2016 [9.3.2.1, Table 9-26]
+    if(view->to_ds && !view->from_ds){
+        view->bssid = view->addr1;
+        view->sta = view->addr2;
+    } else if(!view->to_ds && view->from_ds){
+        view->bssid = view->addr2;
+        view->sta = view->addr1;
+        view->from_ap = 1;
+    } else if(!view->to_ds && !view->from_ds){
+        view->bssid = view->addr3;
+        // frames sent by AP have BSSID as transmitter address
+        view->from_ap = (memcmp(&buffer[view->addr2], &buffer[view->addr3], 6) == 0);
+        view->sta = view->from_ap ? view->addr1 : view->addr2;
+    } else {
+        // WDS frame, there is no single BSSID
+        view->bssid = view->addr1;
+        view->sta = view->addr2;
+    }
+    return true;
 }
 
-eapol_packet_t *parse_eapol_packet(data_frame_t *frame) {
-    uint8_t *frame_buffer = frame->body;
+bool is_frame_bssid_matching(const uint8_t *buffer, const frame_view_t *view, const uint8_t *bssid) {
+    return (view->bssid != 0) && (memcmp(&buffer[view->bssid], bssid, 6) == 0);
+}
 
-    if(frame->mac_header.frame_control.protected_frame == 1) {
-        ESP_LOGV(TAG, "Protected frame, skipping...");
+eapol_packet_t *parse_eapol_packet(uint8_t *buffer, const frame_view_t *view) {
+    if(view->type != FRAME_TYPE_DATA){
+        HOTPATH_LOGV(TAG, "Not a data frame");
         return NULL;
     }
 
-    if(frame->mac_header.frame_control.subtype > 7) {
-        ESP_LOGV(TAG, "QoS data frame");
-        // Skipping QoS field (2 bytes)
-        frame_buffer += 2;
+    if(view->protected_frame == 1) {
+        HOTPATH_LOGV(TAG, "Protected frame, skipping...");
+        return NULL;
     }
 
+    // LLC SNAP header (6 bytes), EtherType (2 bytes) and EAPoL header have to fit into the body
+    const unsigned eapol_offset = sizeof(llc_snap_header_t) + 2;
+    if(view->body_length < eapol_offset + sizeof(eapol_packet_header_t)){
+        HOTPATH_LOGV(TAG, "Frame too short for EAPoL");
+        return NULL;
+    }
     // Skipping LLC SNAP header (6 bytes)
-    frame_buffer += sizeof(llc_snap_header_t);
+    uint8_t *frame_buffer = &buffer[view->body + sizeof(llc_snap_header_t)];
 
     // Check if frame is type of EAPoL
-    if(ntohs(*(uint16_t *) frame_buffer) == ETHER_TYPE_EAPOL) {
-        ESP_LOGD(TAG, "EAPOL packet");
-        frame_buffer += 2;
-        return (eapol_packet_t *) frame_buffer; 
+    if(((frame_buffer[0] << 8) | frame_buffer[1]) != ETHER_TYPE_EAPOL) {
+        return NULL;
     }
-    return NULL;
+    HOTPATH_LOGD(TAG, "EAPOL packet");
+    eapol_packet_t *eapol_packet = (eapol_packet_t *) &frame_buffer[2];
+    // every later parser relies on packet body length, so it must not point behind the frame
+    if(ntohs(eapol_packet->header.packet_body_length) > view->body_length - eapol_offset - sizeof(eapol_packet_header_t)){
+        HOTPATH_LOGD(TAG, "EAPoL packet truncated");
+        return NULL;
+    }
+    return eapol_packet;
 }
 
 eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet){
     if(eapol_packet->header.packet_type != EAPOL_KEY){
-        ESP_LOGD(TAG, "Not an EAPoL-Key packet.");
+        HOTPATH_LOGD(TAG, "Not an EAPoL-Key packet.");
+        return NULL;
+    }
+    if(ntohs(eapol_packet->header.packet_body_length) < sizeof(eapol_key_packet_t)){
+        HOTPATH_LOGD(TAG, "EAPoL-Key packet too short");
         return NULL;
     }
     return (eapol_key_packet_t *) eapol_packet->packet_body;
 }
 
+unsigned parse_handshake_message(const eapol_key_packet_t *eapol_key_packet){
+    const key_information_t *key_information = &eapol_key_packet->key_information;
+    if(!key_information->key_type || key_information->request || key_information->error){
+        return 0;
+    }
+    if(key_information->key_ack){
+        return key_information->key_mic ? 3 : 1;
+    }
+    if(!key_information->key_mic){
+        return 0;
+    }
+    // Secure bit is set in M4 since WPA2, WPA M4 is recognised by missing SNonce
+    if(key_information->secure){
+        return 4;
+    }
+    for(unsigned i = 0; i < sizeof(eapol_key_packet->key_nonce); i++){
+        if(eapol_key_packet->key_nonce[i] != 0){
+            return 2;
+        }
+    }
+    return 4;
+}
+
+/**
+ * @brief Returns Key MIC length required by AKM suite
+ * 
+ * @see Ref: 802.11-2020 [12.7.3, Table 12-11]
+ * @param akm akm_suite_t
+ * @return int -1 if AKM is unknown or its MIC length depends on negotiated group (SAE-EXT-KEY),
+ *  0 for FILS AKMs that protect EAPoL-Key by AEAD instead of Key MIC
+ */
+static int akm_mic_length(uint8_t akm){
+    switch(akm){
+        case AKM_UNKNOWN:
+        case AKM_SAE_EXT_KEY:
+        case AKM_FT_SAE_EXT_KEY:
+            return -1;
+        case AKM_FILS_SHA256:
+        case AKM_FILS_SHA384:
+        case AKM_FT_FILS_SHA256:
+        case AKM_FT_FILS_SHA384:
+            return 0;
+        case AKM_8021X_SUITE_B_192:
+        case AKM_FT_8021X_SHA384:
+        case AKM_FT_PSK_SHA384:
+        case AKM_PSK_SHA384:
+            return 24;
+        default:
+            return 16;
+    }
+}
+
+/**
+ * @brief Finds AKM suite in RSN element inside Key Data
+ * 
+ * STA sends its RSN element in M2, so AKM of the handshake is known once M2 is captured.
+ * @see Ref: 802.11-2016 [9.4.2.25]
+ * @param key_data 
+ * @param length of key data
+ * @return uint8_t first AKM suite of OUI 00-0F-AC, AKM_UNKNOWN if there is no RSN element or AKM is vendor specific
+ */
+static uint8_t parse_akm_from_key_data(const uint8_t *key_data, unsigned length){
+    unsigned offset = 0;
+    while(offset + 2 <= length){
+        unsigned element_length = key_data[offset + 1];
+        if(offset + 2 + element_length > length){
+            break;
+        }
+        if(key_data[offset] != ELEMENT_ID_RSN){
+            offset += 2 + element_length;
+            continue;
+        }
+        // Version (2), Group Data Cipher Suite (4), Pairwise Cipher Suite Count (2) and suites (4 each)
+        const uint8_t *rsn = &key_data[offset + 2];
+        if(element_length < 8){
+            return AKM_UNKNOWN;
+        }
+        unsigned akm_offset = 8 + 4 * (rsn[6] | (rsn[7] << 8));
+        // AKM Suite Count (2) and the first suite
+        if(element_length < akm_offset + 2 + 4){
+            return AKM_UNKNOWN;
+        }
+        const uint8_t *akm = &rsn[akm_offset + 2];
+        if((akm[0] != 0x00) || (akm[1] != 0x0f) || (akm[2] != 0xac)){
+            return AKM_UNKNOWN;
+        }
+        return akm[3];
+    }
+    return AKM_UNKNOWN;
+}
+
+bool parse_eapol_key_fields(eapol_key_packet_t *eapol_key, unsigned size, eapol_key_fields_t *fields){
+    // Ref: 802.11-2016 [12.7.2] - descriptor versions 1-3 always use 16 bytes Key MIC, FILS omits Key MIC field
+    static const uint8_t mic_lengths[] = { 16, 24, 32, 0 };
+    const unsigned mic_offset = offsetof(eapol_key_packet_t, key_mic);
+    uint8_t *packet = (uint8_t *) eapol_key;
+    bool akm_defined = (eapol_key->key_information.key_descriptor_version == KEY_DESCRIPTOR_VERSION_AKM_DEFINED);
+    for(unsigned i = 0; i < (akm_defined ? sizeof(mic_lengths) : 1); i++){
+        unsigned key_data_offset = mic_offset + mic_lengths[i] + 2;
+        if(size < key_data_offset){
+            continue;
+        }
+        unsigned key_data_length = (packet[key_data_offset - 2] << 8) | packet[key_data_offset - 1];
+        // MIC length isn't announced by the packet itself, only Key Data that exactly fill the packet tell it
+        if((key_data_length > size - key_data_offset) || (akm_defined && (key_data_length != size - key_data_offset))){
+            continue;
+        }
+        fields->key_mic = &packet[mic_offset];
+        fields->mic_length = mic_lengths[i];
+        fields->key_data_length = key_data_length;
+        fields->key_data = (key_data_length > 0) ? &packet[key_data_offset] : NULL;
+        fields->akm = AKM_UNKNOWN;
+        if((key_data_length > 0) && !eapol_key->key_information.encrypted_key_data){
+            fields->akm = parse_akm_from_key_data(fields->key_data, key_data_length);
+        }
+        int expected_mic_length = akm_mic_length(fields->akm);
+        if((expected_mic_length >= 0) && (expected_mic_length != fields->mic_length)){
+            HOTPATH_LOGD(TAG, "Key MIC length %u doesn't match AKM %u", fields->mic_length, fields->akm);
+            continue;
+        }
+        return true;
+    }
+    HOTPATH_LOGD(TAG, "Cannot locate Key MIC and Key Data");
+    return false;
+}
+
 /**
  * @brief Parses all PMKIDs to linked list structure 
  * 
  * It crawlers through key data buffer and looks for PMKIDs.
  * If PMKID element is found, its saved into the list of PMKIDs.
+ * Elements that don't fit into key data end the parsing.
  * @param key_data 
  * @param length of key data
  * @return pmkid_item_t* 
  */
 static pmkid_item_t *parse_pmkid_from_key_data(uint8_t *key_data, const uint16_t length){
-    uint8_t *key_data_index = key_data;
-    uint8_t *key_data_max_index = key_data + length;
-
     pmkid_item_t *pmkid_item_head = NULL;
-    key_data_field_t *key_data_field;
-    do{
-        key_data_field = (key_data_field_t *) key_data_index;
+    unsigned offset = 0;
+    // every element consists of type, length and length bytes of data
+    while(offset + 2 <= length){
+        key_data_field_t *key_data_field = (key_data_field_t *) &key_data[offset];
+        unsigned field_end = offset + 2 + key_data_field->length;
+        if(field_end > length){
+            HOTPATH_LOGD(TAG, "Key Data element exceeds Key Data");
+            break;
+        }
+        offset = field_end;
+
+        if(key_data_field->type != KEY_DATA_TYPE){
+            HOTPATH_LOGD(TAG, "Wrong type %x (expected %x)", key_data_field->type, KEY_DATA_TYPE);
+            continue;
+        }
 
-        ESP_LOGV(TAG, "EAPOL-Key -> Key-Data -> type=%x; length=%x; oui=%x; data_type=%x",
+        // OUI (3 bytes), data type (1 byte) and PMKID
+        if(key_data_field->length < 4 + sizeof(((pmkid_item_t *) 0)->pmkid)){
+            HOTPATH_LOGD(TAG, "Key Data element too short (%u)", key_data_field->length);
+            continue;
+        }
+
+        HOTPATH_LOGV(TAG, "EAPOL-Key -> Key-Data -> type=%x; length=%x; oui=%x; data_type=%x",
                     key_data_field->type, 
                     key_data_field->length, 
                     key_data_field->oui,
                     key_data_field->data_type);
-        
-        if(key_data_field->type != KEY_DATA_TYPE){
-            ESP_LOGD(TAG, "Wrong type %x (expected %x)", key_data_field->type, KEY_DATA_TYPE);
-            continue;
-        }
 
         if(ntohl(key_data_field->oui) != KEY_DATA_OUI_IEEE80211){
-            ESP_LOGD(TAG, "Wrong OUI %x (expected %x)", key_data_field->oui, KEY_DATA_OUI_IEEE80211);
+            HOTPATH_LOGD(TAG, "Wrong OUI %x (expected %x)", key_data_field->oui, KEY_DATA_OUI_IEEE80211);
             continue;
         }
 
         if(key_data_field->data_type != KEY_DATA_DATA_TYPE_PMKID_KDE){
-            ESP_LOGD(TAG, "Wrong data type %x (expected %x)", key_data_field->data_type, KEY_DATA_DATA_TYPE_PMKID_KDE);
+            HOTPATH_LOGD(TAG, "Wrong data type %x (expected %x)", key_data_field->data_type, KEY_DATA_DATA_TYPE_PMKID_KDE);
             continue;
         }
 
-        ESP_LOGI(TAG, "Found PMKID: ");
+        HOTPATH_LOGI(TAG, "Found PMKID");
         pmkid_item_t *pmkid_item = (pmkid_item_t *) malloc(sizeof(pmkid_item_t));
+        if(pmkid_item == NULL){
+            ESP_LOGE(TAG, "Cannot allocate PMKID");
+            break;
+        }
         pmkid_item->next = pmkid_item_head;
         pmkid_item_head = pmkid_item;
-        for(unsigned i = 0; i < 16; i++){
-            pmkid_item->pmkid[i] = key_data_field->data[i];
-            printf("%02x", pmkid_item->pmkid[i]);
-        }
-        printf("\n");
-
-    } while((key_data_index = key_data_field->data + key_data_field->length - 4 + 1) < key_data_max_index); 
+        memcpy(pmkid_item->pmkid, key_data_field->data, 16);
+        HOTPATH_LOG_BUFFER_HEXDUMP(TAG, pmkid_item->pmkid, 16, ESP_LOG_INFO);
+    }
 
     return pmkid_item_head;
 }
 
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key){
-    if(eapol_key->key_data_length == 0){
-        ESP_LOGD(TAG, "Empty Key Data");
+pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key, unsigned size){
+    eapol_key_fields_t fields;
+    if(!parse_eapol_key_fields(eapol_key, size, &fields)){
+        return NULL;
+    }
+
+    if(fields.key_data_length == 0){
+        HOTPATH_LOGD(TAG, "Empty Key Data");
         return NULL;
     }
 
     if(eapol_key->key_information.encrypted_key_data == 1){
-        ESP_LOGD(TAG, "Key Data encrypted");
+        HOTPATH_LOGD(TAG, "Key Data encrypted");
         return NULL;
     }
 
-    return parse_pmkid_from_key_data(eapol_key->key_data, ntohs(eapol_key->key_data_length));
-}
\ No newline at end of file
+    return parse_pmkid_from_key_data(fields.key_data, fields.key_data_length);
+}
@@ -10,8 +10,11 @@
 #define FRAME_ANALYZER_H
 
 #include "esp_event.h"
+#include "esp_wifi_types.h"
 #include <stdint.h>
 
+#include "frame_analyzer_types.h"
+
 ESP_EVENT_DECLARE_BASE(FRAME_ANALYZER_EVENTS);
 
 enum {
@@ -19,6 +22,16 @@ enum {
     DATA_FRAME_EVENT_PMKID
 };
 
+/**
+ * @brief Event data of DATA_FRAME_EVENT_EAPOLKEY_FRAME
+ * 
+ * Captured frame together with its view, so handlers don't parse MAC header again.
+ */
+typedef struct {
+    frame_view_t view;              ///< view of frame.payload
+    wifi_promiscuous_pkt_t frame;   ///< must be the last member, payload follows
+} frame_analyzer_frame_t;
+
 /**
  * @brief Search types for frame analyzer.
  * 
@@ -32,6 +45,7 @@ typedef enum {
 /**
  * @brief Starts frame analysis based on given search type and BSSID.
  * 
+ * Clears cache of seen EAPOL frames, retransmissions are forwarded only once during the analysis.
  * @param search_type type of information that are demanded
  * @param bssid target AP's BSSID
  */
@@ -19,43 +19,92 @@
 #include "frame_analyzer_types.h"
 
 /**
- * @brief Determines whether BSSID inside of the given frame matches given BSSID.
+ * @brief Parses MAC header of given frame into view consumed by all other parsers.
  * 
- * @param frame 
+ * It's the only parser that derives header layout from Frame Control, so it should be called once per frame.
+ * Handles 4-address (WDS) data frames, QoS Control and HT Control (+HTC) fields.
+ * @param buffer frame, optionally preceded by radiotap header
+ * @param size length of the buffer in bytes
+ * @param radiotap buffer starts with radiotap header (e.g. PCAP with LINKTYPE_IEEE802_11_RADIOTAP)
+ * @param view output, offsets are relative to the start of the buffer
+ * @return true if whole MAC header fits into the buffer
+ * @return false if frame is truncated, malformed or it's an extension frame
+ */
+bool parse_frame_view(const uint8_t *buffer, unsigned size, bool radiotap, frame_view_t *view);
+
+/**
+ * @brief Determines whether BSSID of the given frame matches given BSSID.
+ * 
+ * Control frames never match.
+ * @param buffer 
+ * @param view returned by parse_frame_view()
  * @param bssid 
  * @return bool 
  */
-bool is_frame_bssid_matching(wifi_promiscuous_pkt_t *frame, uint8_t *bssid);
+bool is_frame_bssid_matching(const uint8_t *buffer, const frame_view_t *view, const uint8_t *bssid);
 
 /**
  * @brief Parses EAPoL packet from given frame.
  * 
- * @param frame 
+ * Frame comes over the air, so nothing inside it is trusted. Returned packet is guaranteed to lie
+ * within the frame including whole packet body declared in its header.
+ * @param buffer 
+ * @param view returned by parse_frame_view()
  * @return eapol_packet_t* if parsing successful 
  * @return \c NULL if no EAPoL packet was found
  * @return \c NULL if frame is protected
+ * @return \c NULL if frame is too short or EAPoL packet body is truncated
  */
-eapol_packet_t *parse_eapol_packet(data_frame_t *frame);
+eapol_packet_t *parse_eapol_packet(uint8_t *buffer, const frame_view_t *view);
 
 /**
  * @brief Parses EAPoL-Key packet from EAPoL packet
  * 
+ * All fixed fields of returned packet are within the frame, Key Data are not checked.
  * @note result does not include EAPoL header
- * @param eapol_packet 
+ * @param eapol_packet returned by parse_eapol_packet()
  * @return eapol_key_packet_t* if parsing successful
  * @return \c NULL if no EAPoL-Key packet found
+ * @return \c NULL if packet body is shorter than eapol_key_packet_t
  */
 eapol_key_packet_t *parse_eapol_key_packet(eapol_packet_t *eapol_packet);
 
+/**
+ * @brief Determines number of 4-way handshake message from Key Information field.
+ * 
+ * Group key handshake, request and error frames are not part of 4-way handshake.
+ * WPA M4 has no Secure bit, it's recognised by missing SNonce.
+ * @see Ref: 802.11-2016 [12.7.6.2 - 12.7.6.5]
+ * @param eapol_key_packet returned by parse_eapol_key_packet()
+ * @return unsigned number of handshake message (1-4) or 0 if it's not a 4-way handshake message
+ */
+unsigned parse_handshake_message(const eapol_key_packet_t *eapol_key_packet);
+
+/**
+ * @brief Locates Key MIC and Key Data of EAPoL-Key packet and detects AKM of the handshake.
+ * 
+ * Key MIC is 16 bytes for key descriptor versions 1-3. Version 0 leaves MIC length to AKM (24 bytes for
+ * SHA384 suites, none for FILS suites that use AEAD), so it's derived from Key Data Length that has to end
+ * exactly at the end of the packet. AKM is read from RSN element in Key Data (M2) and has to agree with MIC length.
+ * @param eapol_key returned by parse_eapol_key_packet()
+ * @param size length of EAPoL-Key packet, i.e. packet body length from EAPoL header
+ * @param fields output
+ * @return true if fields were located
+ * @return false if Key Data exceed the packet or no MIC length fits the packet and its AKM
+ */
+bool parse_eapol_key_fields(eapol_key_packet_t *eapol_key, unsigned size, eapol_key_fields_t *fields);
+
 /**
  * @brief Parses PMKIDs from EAPoL-Key packet
  * 
- * @param eapol_key 
+ * @param eapol_key returned by parse_eapol_key_packet()
+ * @param size length of EAPoL-Key packet, i.e. packet body length from EAPoL header
  * @return pmkid_item_t* linked list of PMKIDs if parsing successful
  * @return \c NULL if no key data present
  * @return \c NULL if key data are encrypted
+ * @return \c NULL if Key MIC and Key Data cannot be located, see parse_eapol_key_fields()
  * @return \c NULL parsing fails
  */
-pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key);
+pmkid_item_t *parse_pmkid(eapol_key_packet_t *eapol_key, unsigned size);
 
 #endif
\ No newline at end of file
@@ -45,6 +45,55 @@ typedef struct {
     uint8_t htc_order:1;
 } frame_control_t;
 
+/**
+ * @see Ref: 802.11-2016 [9.2.4.1.3, Table 9-1]
+ */
+typedef enum {
+    FRAME_TYPE_MANAGEMENT = 0,
+    FRAME_TYPE_CONTROL,
+    FRAME_TYPE_DATA,
+    FRAME_TYPE_EXTENSION
+} frame_type_t;
+
+/**
+ * @see Ref: 802.11-2016 [9.2.4.1.3, Table 9-1]
+ */
+//@{
+#define FRAME_SUBTYPE_CTRL_CTS 12
+#define FRAME_SUBTYPE_CTRL_ACK 13
+#define FRAME_SUBTYPE_DATA_QOS 0x8
+//@}
+
+/**
+ * @brief Parsed view of single frame, filled once by parse_frame_view() and passed to all other parsers.
+ * 
+ * Fields are offsets from the start of parsed buffer instead of pointers, so the view stays valid
+ * when the buffer is copied together with it (e.g. into event data). Offset 0 means field is not present.
+ * @see Ref: 802.11-2016 [9.2.3, 9.3]
+ */
+typedef struct {
+    uint16_t frame_offset;      ///< length of radiotap header preceding the frame, 0 if there is none
+    uint16_t frame_length;      ///< length of the frame without radiotap header
+    uint16_t header_length;     ///< MAC header including Address 4, QoS Control and HT Control
+    uint16_t body;              ///< offset of frame body
+    uint16_t body_length;
+    uint16_t addr1;
+    uint16_t addr2;             ///< 0 for CTS and Ack
+    uint16_t addr3;             ///< 0 for control frames
+    uint16_t addr4;             ///< present only in data frames with both DS bits set
+    uint16_t bssid;             ///< 0 for control frames, receiver address of WDS frames
+    uint16_t sta;               ///< address of station talking to BSSID, receiver address of control frames
+    uint8_t type;               ///< frame_type_t
+    uint8_t subtype;
+    uint8_t to_ds:1;
+    uint8_t from_ds:1;
+    uint8_t retry:1;
+    uint8_t protected_frame:1;
+    uint8_t qos:1;              ///< QoS Control present
+    uint8_t htc:1;              ///< HT Control present
+    uint8_t from_ap:1;          ///< frame transmitted by BSSID
+} frame_view_t;
+
 typedef struct {
     frame_control_t frame_control;
     uint16_t duration;
@@ -87,14 +136,11 @@ typedef struct {
 /**
  * Size: 2 bytes
  * @note unnamed fields are "reserved"
+ * @note Field is big endian on the wire, so the octet with bits 8-15 comes first.
+ *  Bit fields are allocated from the least significant bit of each octet.
  * @see Ref: 802.11-2016 [12.7.2]
  */
 typedef struct {
-    uint8_t key_descriptor_version:3;
-    uint8_t key_type:1;
-    uint8_t :2;
-    uint8_t install:1;
-    uint8_t key_ack:1;
     uint8_t key_mic:1;
     uint8_t secure:1;
     uint8_t error:1;
@@ -102,10 +148,27 @@ typedef struct {
     uint8_t encrypted_key_data:1;
     uint8_t smk_message:1;
     uint8_t :2;
+    uint8_t key_descriptor_version:3;
+    uint8_t key_type:1;
+    uint8_t :2;
+    uint8_t install:1;
+    uint8_t key_ack:1;
 } key_information_t;
 
 /**
- * @todo MIC lenght is dependent on 802.11-2016 [12.7.3] - key_infromation_t.descrptor_version
+ * @see Ref: 802.11-2016 [12.7.2]
+ */
+//@{
+#define KEY_DESCRIPTOR_VERSION_AKM_DEFINED 0    ///< MIC and key wrap defined by AKM, e.g. SAE, OWE or SHA384 suites
+#define KEY_DESCRIPTOR_VERSION_HMAC_MD5 1       ///< WPA
+#define KEY_DESCRIPTOR_VERSION_HMAC_SHA1 2      ///< WPA2
+#define KEY_DESCRIPTOR_VERSION_AES_CMAC 3       ///< SHA256 and FT suites
+//@}
+
+/**
+ * @note Layout of EAPoL-Key packet with 16 bytes Key MIC. Length of Key MIC depends on AKM (24 bytes for
+ *  SHA384 suites), so \c key_mic, \c key_data_length and \c key_data are valid only if parse_eapol_key_fields()
+ *  reports 16 bytes MIC. Fields before Key MIC are always at these offsets.
  * @see Ref: 802.11-2016 [12.7.2]
  */
 typedef struct __attribute__((__packed__)) {
@@ -122,6 +185,51 @@ typedef struct __attribute__((__packed__)) {
     uint8_t key_data[];
 } eapol_key_packet_t;
 
+/**
+ * @brief AKM suite types of OUI 00-0F-AC
+ * 
+ * @see Ref: 802.11-2020 [9.4.2.24.3, Table 9-151]
+ */
+typedef enum {
+    AKM_UNKNOWN = 0,            ///< no RSN element seen or vendor specific AKM
+    AKM_8021X = 1,
+    AKM_PSK = 2,
+    AKM_FT_8021X = 3,
+    AKM_FT_PSK = 4,
+    AKM_8021X_SHA256 = 5,
+    AKM_PSK_SHA256 = 6,
+    AKM_SAE = 8,
+    AKM_FT_SAE = 9,
+    AKM_8021X_SUITE_B = 11,
+    AKM_8021X_SUITE_B_192 = 12,
+    AKM_FT_8021X_SHA384 = 13,
+    AKM_FILS_SHA256 = 14,       ///< FILS AKMs protect EAPoL-Key by AEAD and have no Key MIC
+    AKM_FILS_SHA384 = 15,
+    AKM_FT_FILS_SHA256 = 16,
+    AKM_FT_FILS_SHA384 = 17,
+    AKM_OWE = 18,
+    AKM_FT_PSK_SHA384 = 19,
+    AKM_PSK_SHA384 = 20,
+    AKM_SAE_EXT_KEY = 24,
+    AKM_FT_SAE_EXT_KEY = 25
+} akm_suite_t;
+
+/**
+ * @brief Variable length fields of EAPoL-Key packet located by parse_eapol_key_fields()
+ */
+typedef struct {
+    uint8_t *key_mic;
+    uint8_t mic_length;         ///< 16, 24 or 32 bytes, 0 for FILS AKMs which have no Key MIC
+    uint8_t akm;                ///< akm_suite_t from RSN element in Key Data, AKM_UNKNOWN if there is none
+    uint16_t key_data_length;
+    uint8_t *key_data;          ///< \c NULL if Key Data are empty
+} eapol_key_fields_t;
+
+/**
+ * @see Ref: 802.11-2016 [9.4.2.25]
+ */
+#define ELEMENT_ID_RSN 48
+
 /**
  * @see Ref: 802.11-2016 [12.7.2, Table 12-6]
  */
@@ -8,11 +8,13 @@
  */
 #include "hccapx_serializer.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
 #include "esp_err.h"
+#include "hotpath_log.h"
 #include "frame_analyzer.h"
 #include "frame_analyzer_types.h"
 #include "frame_analyzer_parser.h"
@@ -29,11 +31,64 @@
 #define HCCAPX_VERSION 4
 #define HCCAPX_KEYVER_WPA 1
 #define HCCAPX_KEYVER_WPA2 2
+#define HCCAPX_KEYVER_AES_CMAC 3
+#define HCCAPX_MIC_SIZE 16
 #define HCCAPX_MAX_EAPOL_SIZE 256
 //@}
 
+/**
+ * @brief Handshake quality score components
+ */
+//@{
+#define SCORE_ANONCE_CONFIRMED 20   ///< both M1 and M3 of the attempt were captured with the same ANonce
+#define SCORE_NO_RETRANSMISSIONS 10 ///< no handshake message of the attempt was captured more than once
+#define SCORE_INTERVAL_FAST 10      ///< messages of the pair were sent within SCORE_INTERVAL_FAST_MS
+#define SCORE_INTERVAL_SLOW 5       ///< messages of the pair were sent within SCORE_INTERVAL_SLOW_MS
+#define SCORE_INTERVAL_FAST_MS 100
+#define SCORE_INTERVAL_SLOW_MS 1000
+//@}
+
 static char *TAG = "hccapx_serializer";
 
+ESP_EVENT_DEFINE_BASE(HCCAPX_SERIALIZER_EVENTS);
+
+/**
+ * @brief Handshake messages that form each HCCAPX message pair and base score of the pair.
+ * 
+ * Pairs containing M3 prove the AP knew the PMK, so the password is most likely right.
+ * @see Ref: https://hashcat.net/wiki/doku.php?id=hccapx
+ */
+static const struct {
+    uint8_t first;
+    uint8_t second;
+    uint8_t score;
+} message_pairs[] = {
+    { 1, 2, 50 },   // M1+M2, EAPoL from M2
+    { 1, 4, 30 },   // M1+M4, EAPoL from M4
+    { 2, 3, 60 },   // M2+M3, EAPoL from M2
+    { 2, 3, 50 },   // M2+M3, EAPoL from M3
+    { 3, 4, 40 },   // M3+M4, EAPoL from M3
+    { 3, 4, 40 }    // M3+M4, EAPoL from M4
+};
+
+/**
+ * @brief Message pairs that are exported, in order of preference. All of them use EAPoL from STA message.
+ */
+static const uint8_t exported_pairs[] = { 2, 0, 5, 1 };
+
+/**
+ * @brief Last received handshake message of one kind
+ */
+typedef struct {
+    bool seen;
+    uint64_t replay_counter;
+    unsigned ts_usec;
+    uint8_t nonce[32];
+    uint8_t mic[16];
+    uint16_t eapol_len;
+    uint8_t eapol[HCCAPX_MAX_EAPOL_SIZE];   ///< EAPoL packet with cleared MIC, stored for STA messages only
+} handshake_message_t;
+
 /**
  * @brief Default values for hccapx buffer
  */
@@ -45,17 +100,40 @@ static hccapx_t hccapx = {
 };
 
 /**
- * @brief Stores last processed message
+ * @brief Messages of current handshake attempt, indexed by message number (1-4).
+ * 
+ * All stored messages belong to the same attempt, i.e. share replay counter of M1 they respond to.
+ */
+static handshake_message_t messages[5];
+
+/**
+ * @brief Number of handshake messages of current attempt that were captured again after they were already stored.
+ */
+static unsigned retransmissions = 0;
+
+/**
+ * @brief Properties of exported pair and its attempt, used for quality scoring.
  */
 //@{
-static unsigned message_ap = 0;
-static unsigned message_sta = 0;
+static unsigned exported_timestamps[2];
+static bool exported_anonce_confirmed;
+static unsigned exported_retransmissions;
 //@}
 
 /**
- * @brief Stores number of message from which was the EAPoL packet saved.  
+ * @brief AKM of the handshake from RSN element of M2, AKM_UNKNOWN until M2 is captured.
+ */
+static uint8_t handshake_akm = AKM_UNKNOWN;
+
+/**
+ * @brief AKM of last reported handshake that cannot be exported, so it's not logged for every frame. -1 if none was reported.
+ */
+static int unsupported_reported_akm = -1;
+
+/**
+ * @brief Score of last posted HCCAPX_SERIALIZER_EVENT_HANDSHAKE_COMPLETE event, -1 if none was posted.
  */
-static unsigned eapol_source = 0;
+static int reported_score = -1;
 
 /**
  * @brief Says whether array contains only zero values or not
@@ -65,7 +143,7 @@ static unsigned eapol_source = 0;
  * @return true all values are zero
  * @return false some value is different from zero
  */
-static bool is_array_zero(uint8_t *array, unsigned size){
+static bool is_array_zero(const uint8_t *array, unsigned size){
     for(unsigned i = 0; i < size; i++){
         if(array[i] != 0){
             return false;
@@ -78,6 +156,14 @@ void hccapx_serializer_init(const uint8_t *ssid, unsigned size){
     hccapx.essid_len = size;
     memcpy(hccapx.essid, ssid, size);
     hccapx.message_pair = 255;
+    memset(hccapx.mac_sta, 0, 6);
+    memset(hccapx.nonce_ap, 0, 32);
+    memset(hccapx.nonce_sta, 0, 32);
+    memset(messages, 0, sizeof(messages));
+    retransmissions = 0;
+    handshake_akm = AKM_UNKNOWN;
+    unsupported_reported_akm = -1;
+    reported_score = -1;
 }
 
 hccapx_t *hccapx_serializer_get(){
@@ -89,182 +175,190 @@ hccapx_t *hccapx_serializer_get(){
 }
 
 /**
- * @brief Saves EAPoL-Key frame into HCCAPX buffer
- * 
- * Also sets Key MIC value to the one present in the given EAPoL-Key packet
+ * @brief Reads big endian replay counter of EAPoL-Key packet
  * 
- * @param eapol_packet EAPoL packet to be saved that includes also EAPoL header
- * @param eapol_key_packet EAPoL-Key parsed to get key MIC from it
- * @return unsigned
- * @return 1 if error occured
- * @return 0 if successfully saved
+ * @param eapol_key_packet 
+ * @return uint64_t 
  */
-static unsigned save_eapol(eapol_packet_t *eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    unsigned eapol_len = 0;
-    eapol_len = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
-    if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
-        ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
-        return 1;
+static uint64_t get_replay_counter(const eapol_key_packet_t *eapol_key_packet){
+    uint64_t replay_counter = 0;
+    for(unsigned i = 0; i < 8; i++){
+        replay_counter = (replay_counter << 8) | eapol_key_packet->key_replay_counter[i];
     }
-    hccapx.eapol_len = eapol_len;
-    memcpy(hccapx.eapol, eapol_packet, hccapx.eapol_len);
-    memcpy(hccapx.keymic, eapol_key_packet->key_mic, 16);
-    // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
-    // This is not documented in HCCAPX reference.
-    // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
-    // MIC key on 77 bytes offset inside EAPoL-Key + 4 bytes EAPoL header.
-    memset(&hccapx.eapol[81], 0x0, 16);
-    return 0;
+    return replay_counter;
 }
 
 /**
- * @brief Handles first message of WPA handshake - from AP to STA
+ * @brief Returns replay counter of M1 that started handshake attempt the message belongs to.
  * 
- * This message is from AP. It always contains ANonce.
+ * Ref: 802.11-2016 [12.7.6.2 - 12.7.6.5]
+ * M2 and M4 reuse replay counter of M1 and M3 they respond to, M3 increments replay counter of M1.
  * 
- * @param eapol_key_packet parsed EAPoL-Key packet
+ * @param message number of handshake message (1-4)
+ * @param replay_counter replay counter of the message
+ * @return uint64_t 
  */
-static void ap_message_m1(eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From AP M1");
-    message_ap = 1;
-    memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
+static uint64_t attempt_of(unsigned message, uint64_t replay_counter){
+    return (message >= 3) ? replay_counter - 1 : replay_counter;
 }
 
 /**
- * @brief Handles third message of WPA handshake - from AP to STA
+ * @brief Says whether handshake can be cracked from HCCAPX.
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * HCCAPX carries 16 bytes MIC and PTK derived from PMK by PRF of key descriptor versions 1-3. FT derives PTK
+ * from PMK-R1, SAE and OWE PMK is not derived from passphrase and SHA384 suites use 24 bytes MIC,
+ * so hashes of such handshakes would be silently wrong.
+ * 
+ * @param key_descriptor_version 
+ * @param fields located fields of the message
+ * @return true handshake can be exported
  */
-static void ap_message_m3(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From AP M3");
-    message_ap = 3;
-    if(message_ap == 0){
-        // No AP message was processed yet. ANonce has to be copied into HCCAPX buffer.
-        memcpy(hccapx.nonce_ap, eapol_key_packet->key_nonce, 32);
-    }
-    if(eapol_source == 2){
-        // EAPoL packet was already saved from message #2. No need to resave it.
-        hccapx.message_pair = 2;
-        return;
-    }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
-    }
-    eapol_source = 3;
-    if(message_sta == 2){
-        hccapx.message_pair = 3;
+static bool is_exportable(unsigned key_descriptor_version, const eapol_key_fields_t *fields){
+    if((key_descriptor_version < HCCAPX_KEYVER_WPA) || (key_descriptor_version > HCCAPX_KEYVER_AES_CMAC) || (fields->mic_length != HCCAPX_MIC_SIZE)){
+        return false;
     }
+    return (handshake_akm == AKM_UNKNOWN) || (handshake_akm == AKM_PSK) || (handshake_akm == AKM_PSK_SHA256);
 }
 
 /**
- * @brief Handles messages from AP - handshake M1 and M3.
+ * @brief Stores handshake message and drops stored messages of other handshake attempts.
  * 
- * @param frame 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param message number of handshake message (1-4)
+ * @param eapol_packet EAPoL packet including EAPoL header
+ * @param eapol_key_packet parsed EAPoL-Key packet
+ * @param fields located Key MIC of the packet, its length is HCCAPX_MIC_SIZE
+ * @param ts_usec timestamp of the frame
  */
-static void ap_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if((!is_array_zero(hccapx.mac_sta, 6)) && (memcmp(frame->mac_header.addr1, hccapx.mac_sta, 6) != 0)){
-        ESP_LOGE(TAG, "Different STA");
-        return;
+static void store_message(unsigned message, eapol_packet_t *eapol_packet, eapol_key_packet_t *eapol_key_packet, const eapol_key_fields_t *fields, unsigned ts_usec){
+    handshake_message_t *stored = &messages[message];
+    uint64_t replay_counter = get_replay_counter(eapol_key_packet);
+    uint64_t attempt = attempt_of(message, replay_counter);
+    for(unsigned i = 1; i <= 4; i++){
+        if(messages[i].seen && (attempt_of(i, messages[i].replay_counter) != attempt)){
+            HOTPATH_LOGD(TAG, "Discarding stale M%u", i);
+            messages[i].seen = false;
+            retransmissions = 0;
+        }
     }
-    if(message_ap == 0){
-        memcpy(hccapx.mac_ap, frame->mac_header.addr2, 6);
+    if(stored->seen){
+        HOTPATH_LOGD(TAG, "Retransmitted M%u", message);
+        retransmissions++;
     }
-    // Determine which message this is by Key MIC
-    // Key MIC is always empty in M1 and always present in M3
-    // Ref: 802.11i-2004 [8.5.3]
-    if(is_array_zero(eapol_key_packet->key_mic, 16)){
-        ap_message_m1(eapol_key_packet);
-    } 
-    else {
-        ap_message_m3(eapol_packet, eapol_key_packet);
+
+    if((message == 2) || (message == 4)){
+        unsigned eapol_len = sizeof(eapol_packet_header_t) + ntohs(eapol_packet->header.packet_body_length);
+        if(eapol_len > HCCAPX_MAX_EAPOL_SIZE){
+            ESP_LOGW(TAG, "EAPoL is too long (%u/%u)", eapol_len, HCCAPX_MAX_EAPOL_SIZE);
+            stored->seen = false;
+            return;
+        }
+        stored->eapol_len = eapol_len;
+        memcpy(stored->eapol, eapol_packet, eapol_len);
+        // Clear key MIC from EAPoL packet so hashcat can calulate MIC without preprocessing.
+        // This is not documented in HCCAPX reference.
+        // But it's based on 802.11i-2004 [8.5.2/h] and by analysing behaviour of cap2hccapx tool
+        memset(&stored->eapol[sizeof(eapol_packet_header_t) + offsetof(eapol_key_packet_t, key_mic)], 0x0, fields->mic_length);
     }
+    stored->seen = true;
+    stored->replay_counter = replay_counter;
+    stored->ts_usec = ts_usec;
+    memcpy(stored->nonce, eapol_key_packet->key_nonce, 32);
+    memcpy(stored->mic, fields->key_mic, HCCAPX_MIC_SIZE);
+    hccapx.keyver = eapol_key_packet->key_information.key_descriptor_version;
 }
 
 /**
- * @brief Handles second message of handshake - from STA to AP.
+ * @brief Tries to export given message pair from stored messages into HCCAPX buffer.
  * 
- * Saves EAPoL packet as this is the first time key MIC is present.
- * Saves SNonce.
+ * Pair is exported only if both messages belong to the same attempt and both nonces are known.
+ * ANonce is taken from M3 if available, SNonce from M2 or from M4 that carries it.
  * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @param message_pair HCCAPX message pair
+ * @return true pair was exported
+ * @return false stored messages do not form coherent pair
  */
-static void sta_message_m2(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From STA M2");
-    message_sta = 2;
-    memcpy(hccapx.nonce_sta, eapol_key_packet->key_nonce, 32);
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+static bool export_pair(unsigned message_pair){
+    const handshake_message_t *first = &messages[message_pairs[message_pair].first];
+    const handshake_message_t *second = &messages[message_pairs[message_pair].second];
+    if(!first->seen || !second->seen){
+        return false;
     }
-    eapol_source = 2;
-    if(message_ap == 1){
-        hccapx.message_pair = 0;
-        return;
+    const handshake_message_t *anonce_source = messages[3].seen ? &messages[3] : &messages[1];
+    const handshake_message_t *snonce_source = messages[2].seen ? &messages[2] : &messages[4];
+    if(!anonce_source->seen || is_array_zero(snonce_source->nonce, 32)){
+        return false;
     }
+    if(messages[1].seen && messages[3].seen && (memcmp(messages[1].nonce, messages[3].nonce, 32) != 0)){
+        // M1 and M3 of one handshake attempt always carry the same ANonce
+        HOTPATH_LOGD(TAG, "ANonce of M1 and M3 differs");
+        return false;
+    }
+    const handshake_message_t *eapol_source = (first == &messages[2] || first == &messages[4]) ? first : second;
+
+    hccapx.message_pair = message_pair;
+    memcpy(hccapx.nonce_ap, anonce_source->nonce, 32);
+    memcpy(hccapx.nonce_sta, snonce_source->nonce, 32);
+    memcpy(hccapx.keymic, eapol_source->mic, 16);
+    hccapx.eapol_len = eapol_source->eapol_len;
+    memcpy(hccapx.eapol, eapol_source->eapol, eapol_source->eapol_len);
+    exported_timestamps[0] = first->ts_usec;
+    exported_timestamps[1] = second->ts_usec;
+    // mismatching ANonce was rejected above, so both messages being present means they agree
+    exported_anonce_confirmed = messages[1].seen && messages[3].seen;
+    exported_retransmissions = retransmissions;
+    return true;
 }
 
 /**
- * @brief Handles fourth message of the handshake. From STA to AP.
- * 
- * 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @brief Exports the best coherent pair of current attempt. Previously exported pair is kept if there is none.
  */
-static void sta_message_m4(eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    ESP_LOGD(TAG, "From STA M4");
-    if((message_sta == 2) && (eapol_source != 0)){
-        // If message 2 was already fully processed, there is no need to process M4 again 
-        ESP_LOGD(TAG, "Already have M2, not worth");
-        return;
-    }
-    if(message_ap == 0){
-        // If there was no AP message processed yet, ANonce will be always missing.
-        ESP_LOGE(TAG, "Not enought handshake messages received.");
-        return;
-    }
-    if(eapol_source == 3){
-        hccapx.message_pair = 4;
-        return;
-    }
-    if(save_eapol(eapol_packet, eapol_key_packet) != 0){
-        return;
+static void export_best_pair(){
+    for(unsigned i = 0; i < sizeof(exported_pairs); i++){
+        if(export_pair(exported_pairs[i])){
+            HOTPATH_LOGD(TAG, "Exported message pair %u", exported_pairs[i]);
+            return;
+        }
     }
-    eapol_source = 4;
-    if(message_ap == 1){
-        hccapx.message_pair = 1;
+}
+
+bool hccapx_serializer_get_quality(hccapx_quality_t *quality){
+    if(hccapx.message_pair >= sizeof(message_pairs) / sizeof(message_pairs[0])){
+        return false;
     }
-    if(message_ap == 3){
-        hccapx.message_pair = 5;
+    quality->message_pair = hccapx.message_pair;
+    quality->akm = handshake_akm;
+    quality->anonce_confirmed = exported_anonce_confirmed;
+    quality->retransmissions = (exported_retransmissions > UINT8_MAX) ? UINT8_MAX : exported_retransmissions;
+    unsigned interval = (exported_timestamps[1] > exported_timestamps[0]) ?
+        exported_timestamps[1] - exported_timestamps[0] : exported_timestamps[0] - exported_timestamps[1];
+    quality->interval_ms = interval / 1000;
+
+    unsigned score = message_pairs[hccapx.message_pair].score;
+    score += quality->anonce_confirmed ? SCORE_ANONCE_CONFIRMED : 0;
+    score += (quality->retransmissions == 0) ? SCORE_NO_RETRANSMISSIONS : 0;
+    if(quality->interval_ms <= SCORE_INTERVAL_FAST_MS){
+        score += SCORE_INTERVAL_FAST;
+    } else if(quality->interval_ms <= SCORE_INTERVAL_SLOW_MS){
+        score += SCORE_INTERVAL_SLOW;
     }
+    quality->score = score;
+    return true;
 }
 
 /**
- * @brief Handles messages from STA - M2 and M4
- * 
- * @param frame 
- * @param eapol_packet 
- * @param eapol_key_packet 
+ * @brief Posts HCCAPX_SERIALIZER_EVENT_HANDSHAKE_COMPLETE event if handshake quality improved.
  */
-static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol_key_packet_t *eapol_key_packet){
-    if(is_array_zero(hccapx.mac_sta, 6)){
-        memcpy(hccapx.mac_sta, frame->mac_header.addr2, 6);
-    }
-    else if(memcmp(frame->mac_header.addr2, hccapx.mac_sta, 6) != 0){
-        ESP_LOGE(TAG, "Different STA");
+static void report_quality(){
+    hccapx_quality_t quality;
+    if(!hccapx_serializer_get_quality(&quality) || ((int) quality.score <= reported_score)){
         return;
     }
-    // Determine which message this is by SNonce
-    // SNonce is present in M2, empty in M4
-    // Ref: 802.11i-2004 [8.5.3]
-    if(!is_array_zero(eapol_key_packet->key_nonce, 16)){
-        sta_message_m2(eapol_packet, eapol_key_packet);
-    } 
-    else {
-        sta_message_m4(eapol_packet, eapol_key_packet);
+    ESP_LOGI(TAG, "Handshake complete, message pair %u, score %u", quality.message_pair, quality.score);
+    // frames are processed in event loop task, so waiting for free space in its queue could block forever
+    if(esp_event_post(HCCAPX_SERIALIZER_EVENTS, HCCAPX_SERIALIZER_EVENT_HANDSHAKE_COMPLETE, &quality, sizeof(hccapx_quality_t), 0) != ESP_OK){
+        ESP_LOGW(TAG, "Event queue is full, handshake complete event dropped");
     }
+    reported_score = quality.score;
 }
 
 /**
@@ -277,20 +371,62 @@ static void sta_message(data_frame_t *frame, eapol_packet_t* eapol_packet, eapol
  * M3 ---------> |
  * | <--------- M4
  * @endcode
+ * Every message is classified by its Key Information and tied to handshake attempt by its replay counter.
+ * Messages of older attempts are discarded, so exported pair never mixes messages of different attempts.
  * 
- * @param frame 
+ * @param buffer 
+ * @param view
+ * @param ts_usec
  */
-void hccapx_serializer_add_frame(data_frame_t *frame){
-    eapol_packet_t *eapol_packet = parse_eapol_packet(frame);
-    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
-    // Determine direction of the frame by comparing BSSID (addr3) with source address (addr2)
-    if(memcmp(frame->mac_header.addr2, frame->mac_header.addr3, 6) == 0){
-        ap_message(frame, eapol_packet, eapol_key_packet);
-    } 
-    else if(memcmp(frame->mac_header.addr1, frame->mac_header.addr3, 6) == 0){
-        sta_message(frame, eapol_packet, eapol_key_packet);
-    } 
-    else {
+void hccapx_serializer_add_frame(uint8_t *buffer, const frame_view_t *view, unsigned ts_usec){
+    eapol_packet_t *eapol_packet = parse_eapol_packet(buffer, view);
+    eapol_key_packet_t *eapol_key_packet = (eapol_packet != NULL) ? parse_eapol_key_packet(eapol_packet) : NULL;
+    if(eapol_key_packet == NULL){
+        return;
+    }
+    unsigned message = parse_handshake_message(eapol_key_packet);
+    if(message == 0){
+        HOTPATH_LOGD(TAG, "Not a handshake message");
+        return;
+    }
+    HOTPATH_LOGD(TAG, "Handshake M%u", message);
+
+    eapol_key_fields_t fields;
+    if(!parse_eapol_key_fields(eapol_key_packet, ntohs(eapol_packet->header.packet_body_length), &fields)){
+        return;
+    }
+    if(fields.akm != AKM_UNKNOWN){
+        handshake_akm = fields.akm;
+    }
+    unsigned key_descriptor_version = eapol_key_packet->key_information.key_descriptor_version;
+    if(!is_exportable(key_descriptor_version, &fields)){
+        if(unsupported_reported_akm != handshake_akm){
+            ESP_LOGW(TAG, "Handshake cannot be exported to HCCAPX (AKM %u, key descriptor version %u, MIC %u B)",
+                handshake_akm, key_descriptor_version, fields.mic_length);
+            unsupported_reported_akm = handshake_akm;
+        }
+        return;
+    }
+
+    // BSSID has to be either transmitter or receiver of the frame
+    if((view->to_ds && view->from_ds) || (!view->from_ap && (memcmp(&buffer[view->addr1], &buffer[view->bssid], 6) != 0))){
         ESP_LOGE(TAG, "Unknown frame format. BSSID is not source nor destionation.");
+        return;
     }
-}
\ No newline at end of file
+    if(view->from_ap != ((message == 1) || (message == 3))){
+        ESP_LOGE(TAG, "M%u sent in wrong direction", message);
+        return;
+    }
+    const uint8_t *mac_sta = &buffer[view->sta];
+    if(is_array_zero(hccapx.mac_sta, 6)){
+        memcpy(hccapx.mac_sta, mac_sta, 6);
+        memcpy(hccapx.mac_ap, &buffer[view->bssid], 6);
+    } else if(memcmp(mac_sta, hccapx.mac_sta, 6) != 0){
+        ESP_LOGE(TAG, "Different STA");
+        return;
+    }
+
+    store_message(message, eapol_packet, eapol_key_packet, &fields, ts_usec);
+    export_best_pair();
+    report_quality();
+}
@@ -10,9 +10,29 @@
 #define HCCAPX_SERIALIZER_H
 
 #include <stdint.h>
+#include <stdbool.h>
 
+#include "esp_event.h"
 #include "frame_analyzer_types.h"
 
+ESP_EVENT_DECLARE_BASE(HCCAPX_SERIALIZER_EVENTS);
+
+enum {
+    HCCAPX_SERIALIZER_EVENT_HANDSHAKE_COMPLETE  ///< crackable message pair was captured or improved, event data is hccapx_quality_t
+};
+
+/**
+ * @brief Quality of captured handshake
+ */
+typedef struct {
+    uint8_t message_pair;           ///< HCCAPX message pair
+    uint8_t akm;                    ///< akm_suite_t from RSN element of M2, AKM_UNKNOWN if it wasn't captured
+    uint8_t score;                  ///< 0-100, higher score means higher chance that the handshake is crackable
+    bool anonce_confirmed;          ///< both M1 and M3 of the attempt were captured and carry the same ANonce
+    uint8_t retransmissions;        ///< handshake messages of the attempt captured more than once
+    uint32_t interval_ms;           ///< time between messages of the pair
+} hccapx_quality_t;
+
 /**
  * @brief HCCAPX structure according to reference
  * 
@@ -57,8 +77,24 @@ hccapx_t *hccapx_serializer_get();
  * If frame contains handshake from another STA than the one that was already added before,
  * frame will be skipped and error message will be printed.
  * 
- * @param frame data frame with EAPoL-Key packet
+ * Handshakes that HCCAPX cannot represent (AKM defined MIC, FT, SAE, OWE, 802.1X) are not exported.
+ * 
+ * Once messages form crackable pair, HCCAPX_SERIALIZER_EVENT_HANDSHAKE_COMPLETE is posted.
+ * It's posted again every time the quality score improves.
+ * 
+ * @param buffer data frame with EAPoL-Key packet
+ * @param view view of the buffer returned by parse_frame_view(), nothing behind the frame is read
+ * @param ts_usec timestamp of the frame in microseconds
+ */
+void hccapx_serializer_add_frame(uint8_t *buffer, const frame_view_t *view, unsigned ts_usec);
+
+/**
+ * @brief Returns quality of captured handshake.
+ * 
+ * @param quality output
+ * @return true handshake is complete and quality is filled
+ * @return false no crackable message pair was captured yet
  */
-void hccapx_serializer_add_frame(data_frame_t *frame);
+bool hccapx_serializer_get_quality(hccapx_quality_t *quality);
 
 #endif
\ No newline at end of file
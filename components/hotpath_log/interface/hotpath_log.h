@@ -0,0 +1,61 @@
+/**
+ * @file hotpath_log.h
+ * @date 2026-10-19
+ *
+ * @brief Provides logging macros for per-frame (hot) paths
+ *
+ * These macros wrap ESP-IDF logging with a separate compile time level (CONFIG_HOTPATH_LOG_LEVEL)
+ * and per call site sampling (CONFIG_HOTPATH_LOG_SAMPLE_RATE). Statements above the configured level
+ * are eliminated by the compiler, including formatting of their arguments.
+ */
+#ifndef HOTPATH_LOG_H
+#define HOTPATH_LOG_H
+
+#include <stdint.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+
+#ifndef CONFIG_HOTPATH_LOG_LEVEL
+#define CONFIG_HOTPATH_LOG_LEVEL 0
+#endif
+
+#ifndef CONFIG_HOTPATH_LOG_SAMPLE_RATE
+#define CONFIG_HOTPATH_LOG_SAMPLE_RATE 1
+#endif
+
+/**
+ * @brief Compile time check whether hot path messages of given level are built in.
+ */
+#define HOTPATH_LOG_ENABLED(level) ((level) <= CONFIG_HOTPATH_LOG_LEVEL)
+
+/**
+ * @brief Evaluates to true every CONFIG_HOTPATH_LOG_SAMPLE_RATE-th time the call site is reached.
+ *
+ * @note Counter is per call site and not synchronised. Lost increments only shift the sampling phase.
+ */
+#if CONFIG_HOTPATH_LOG_SAMPLE_RATE > 1
+#define HOTPATH_LOG_SAMPLE() ({ static uint32_t hotpath_log_counter_ = 0; (hotpath_log_counter_++ % CONFIG_HOTPATH_LOG_SAMPLE_RATE) == 0; })
+#else
+#define HOTPATH_LOG_SAMPLE() (1)
+#endif
+
+#define HOTPATH_LOG_LEVEL(level, tag, format, ...) do { \
+        if (HOTPATH_LOG_ENABLED(level) && HOTPATH_LOG_SAMPLE()) { \
+            ESP_LOG_LEVEL_LOCAL(level, tag, format, ##__VA_ARGS__); \
+        } \
+    } while(0)
+
+#define HOTPATH_LOGI(tag, format, ...) HOTPATH_LOG_LEVEL(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define HOTPATH_LOGD(tag, format, ...) HOTPATH_LOG_LEVEL(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define HOTPATH_LOGV(tag, format, ...) HOTPATH_LOG_LEVEL(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+/**
+ * @brief Hexdump of given buffer, built in only if level is enabled for hot path.
+ */
+#define HOTPATH_LOG_BUFFER_HEXDUMP(tag, buffer, buff_len, level) do { \
+        if (HOTPATH_LOG_ENABLED(level) && HOTPATH_LOG_SAMPLE()) { \
+            ESP_LOG_BUFFER_HEXDUMP(tag, buffer, buff_len, level); \
+        } \
+    } while(0)
+
+#endif
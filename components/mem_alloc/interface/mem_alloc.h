@@ -0,0 +1,103 @@
+/**
+ * @file mem_alloc.h
+ * @date 2026-10-19
+ *
+ * @brief Provides capability-aware allocator facade with per-category usage statistics
+ *
+ * Every allocation belongs to a category. Category decides heap capabilities of the memory,
+ * so bulk data end up in PSRAM and DMA or latency critical buffers stay in internal RAM.
+ */
+#ifndef MEM_ALLOC_H
+#define MEM_ALLOC_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * @brief Allocation categories
+ */
+typedef enum {
+    MEM_CATEGORY_CAPTURE,   ///< capture data (PCAP buffer, capture store segments and index), PSRAM
+    MEM_CATEGORY_AP_TABLE,  ///< scanned and selected AP records, PSRAM
+    MEM_CATEGORY_HISTORY,   ///< attack status content and other result history, PSRAM
+    MEM_CATEGORY_DISPLAY,   ///< LVGL draw buffers (copied before DMA transfer), PSRAM
+    MEM_CATEGORY_DMA,       ///< buffers accessed by DMA, internal RAM
+    MEM_CATEGORY_INTERNAL,  ///< latency critical data, internal RAM
+    MEM_CATEGORY_MAX
+} mem_category_t;
+
+/**
+ * @brief Usage statistics of one category
+ */
+typedef struct {
+    size_t in_use;          ///< bytes currently allocated
+    size_t peak;            ///< maximum of in_use since boot
+    uint32_t allocations;   ///< number of successful allocations
+    uint32_t failures;      ///< number of failed allocations
+    uint32_t fallbacks;     ///< allocations placed in internal RAM instead of PSRAM
+} mem_alloc_stats_t;
+
+/**
+ * @brief Detects available PSRAM heap and logs allocator configuration.
+ */
+void mem_alloc_init();
+
+/**
+ * @brief Allocates memory for given category.
+ *
+ * @param category
+ * @param size
+ * @return void* NULL on failure
+ */
+void *mem_alloc(mem_category_t category, size_t size);
+
+/**
+ * @brief Allocates zeroed memory for given category.
+ *
+ * @param category
+ * @param count number of elements
+ * @param size size of one element
+ * @return void* NULL on failure
+ */
+void *mem_calloc(mem_category_t category, size_t count, size_t size);
+
+/**
+ * @brief Resizes memory block allocated by mem_alloc() with the same category.
+ *
+ * @param category
+ * @param ptr previous block or NULL
+ * @param size new size
+ * @return void* NULL on failure, original block stays valid
+ */
+void *mem_realloc(mem_category_t category, void *ptr, size_t size);
+
+/**
+ * @brief Frees memory block allocated with given category.
+ *
+ * @param category
+ * @param ptr can be NULL
+ */
+void mem_free(mem_category_t category, void *ptr);
+
+/**
+ * @brief Copies usage statistics of given category.
+ *
+ * @param category
+ * @param stats output
+ */
+void mem_alloc_get_stats(mem_category_t category, mem_alloc_stats_t *stats);
+
+/**
+ * @brief Returns printable name of category.
+ *
+ * @param category
+ * @return const char*
+ */
+const char *mem_alloc_category_name(mem_category_t category);
+
+/**
+ * @brief Logs usage of all categories together with free internal and PSRAM heap.
+ */
+void mem_alloc_log_stats();
+
+#endif
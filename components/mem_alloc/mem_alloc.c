@@ -0,0 +1,166 @@
+/**
+ * @file mem_alloc.c
+ * @date 2026-10-19
+ *
+ * @brief Implements capability-aware allocator facade
+ */
+#include "mem_alloc.h"
+
+#include <stdbool.h>
+#include <assert.h>
+
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+
+static const char *TAG = "mem_alloc";
+
+/**
+ * @brief Heap capabilities used by categories
+ * @{
+ */
+#define CAPS_INTERNAL (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define CAPS_SPIRAM (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+#define CAPS_DMA (MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL)
+//@}
+
+typedef struct {
+    const char *name;
+    bool bulk;          ///< bulk data are placed in PSRAM if available
+    uint32_t caps;      ///< capabilities used when PSRAM is not used
+} category_t;
+
+static const category_t categories[MEM_CATEGORY_MAX] = {
+    [MEM_CATEGORY_CAPTURE]  = { .name = "capture",  .bulk = true,  .caps = CAPS_INTERNAL },
+    [MEM_CATEGORY_AP_TABLE] = { .name = "ap_table", .bulk = true,  .caps = CAPS_INTERNAL },
+    [MEM_CATEGORY_HISTORY]  = { .name = "history",  .bulk = true,  .caps = CAPS_INTERNAL },
+    [MEM_CATEGORY_DISPLAY]  = { .name = "display",  .bulk = true,  .caps = CAPS_INTERNAL },
+    [MEM_CATEGORY_DMA]      = { .name = "dma",      .bulk = false, .caps = CAPS_DMA },
+    [MEM_CATEGORY_INTERNAL] = { .name = "internal", .bulk = false, .caps = CAPS_INTERNAL },
+};
+
+static mem_alloc_stats_t stats[MEM_CATEGORY_MAX];
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static bool spiram_available = false;
+
+static uint32_t category_caps(mem_category_t category){
+    assert(category < MEM_CATEGORY_MAX);
+    if(categories[category].bulk && spiram_available){
+        return CAPS_SPIRAM;
+    }
+    return categories[category].caps;
+}
+
+static void account(mem_category_t category, size_t freed, void *allocated, bool failed, bool fallback){
+    size_t allocated_size = (allocated != NULL) ? heap_caps_get_allocated_size(allocated) : 0;
+    mem_alloc_stats_t *category_stats = &stats[category];
+    portENTER_CRITICAL(&stats_lock);
+    category_stats->in_use = category_stats->in_use - freed + allocated_size;
+    if(category_stats->in_use > category_stats->peak){
+        category_stats->peak = category_stats->in_use;
+    }
+    if(failed){
+        category_stats->failures++;
+    } else if(allocated != NULL){
+        category_stats->allocations++;
+    }
+    if(fallback){
+        category_stats->fallbacks++;
+    }
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+static void *allocate(mem_category_t category, size_t count, size_t size, bool zero){
+    uint32_t caps = category_caps(category);
+    void *ptr = zero ? heap_caps_calloc(count, size, caps) : heap_caps_malloc(count * size, caps);
+    bool fallback = false;
+#if CONFIG_MEM_ALLOC_INTERNAL_FALLBACK
+    if((ptr == NULL) && (caps == CAPS_SPIRAM)){
+        ptr = zero ? heap_caps_calloc(count, size, CAPS_INTERNAL) : heap_caps_malloc(count * size, CAPS_INTERNAL);
+        fallback = (ptr != NULL);
+    }
+#endif
+    if(ptr == NULL){
+        ESP_LOGW(TAG, "Failed to allocate %u bytes for %s", (unsigned) (count * size), categories[category].name);
+    }
+    account(category, 0, ptr, ptr == NULL, fallback);
+    return ptr;
+}
+
+void mem_alloc_init(){
+#if CONFIG_MEM_ALLOC_USE_SPIRAM
+    spiram_available = heap_caps_get_total_size(MALLOC_CAP_SPIRAM) > 0;
+#endif
+    ESP_LOGI(TAG, "Bulk buffers are placed in %s", spiram_available ? "PSRAM" : "internal RAM");
+}
+
+void *mem_alloc(mem_category_t category, size_t size){
+    return allocate(category, 1, size, false);
+}
+
+void *mem_calloc(mem_category_t category, size_t count, size_t size){
+    return allocate(category, count, size, true);
+}
+
+void *mem_realloc(mem_category_t category, void *ptr, size_t size){
+    if(ptr == NULL){
+        return mem_alloc(category, size);
+    }
+    if(size == 0){
+        mem_free(category, ptr);
+        return NULL;
+    }
+    size_t old_size = heap_caps_get_allocated_size(ptr);
+    uint32_t caps = category_caps(category);
+    void *new_ptr = heap_caps_realloc(ptr, size, caps);
+    bool fallback = false;
+#if CONFIG_MEM_ALLOC_INTERNAL_FALLBACK
+    if((new_ptr == NULL) && (caps == CAPS_SPIRAM)){
+        new_ptr = heap_caps_realloc(ptr, size, CAPS_INTERNAL);
+        fallback = (new_ptr != NULL);
+    }
+#endif
+    if(new_ptr == NULL){
+        ESP_LOGW(TAG, "Failed to reallocate %u bytes for %s", (unsigned) size, categories[category].name);
+        account(category, 0, NULL, true, false);
+        return NULL;
+    }
+    account(category, old_size, new_ptr, false, fallback);
+    return new_ptr;
+}
+
+void mem_free(mem_category_t category, void *ptr){
+    if(ptr == NULL){
+        return;
+    }
+    size_t size = heap_caps_get_allocated_size(ptr);
+    heap_caps_free(ptr);
+    portENTER_CRITICAL(&stats_lock);
+    stats[category].in_use -= size;
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+void mem_alloc_get_stats(mem_category_t category, mem_alloc_stats_t *out){
+    assert(category < MEM_CATEGORY_MAX);
+    portENTER_CRITICAL(&stats_lock);
+    *out = stats[category];
+    portEXIT_CRITICAL(&stats_lock);
+}
+
+const char *mem_alloc_category_name(mem_category_t category){
+    return (category < MEM_CATEGORY_MAX) ? categories[category].name : "unknown";
+}
+
+void mem_alloc_log_stats(){
+    for(mem_category_t category = 0; category < MEM_CATEGORY_MAX; category++){
+        mem_alloc_stats_t category_stats;
+        mem_alloc_get_stats(category, &category_stats);
+        ESP_LOGI(TAG, "%-8s in use %u B, peak %u B, %u allocations, %u failed, %u in internal RAM instead of PSRAM",
+            categories[category].name, (unsigned) category_stats.in_use, (unsigned) category_stats.peak,
+            (unsigned) category_stats.allocations, (unsigned) category_stats.failures, (unsigned) category_stats.fallbacks);
+    }
+    ESP_LOGI(TAG, "Free internal RAM %u B (largest block %u B), free PSRAM %u B",
+        (unsigned) heap_caps_get_free_size(MALLOC_CAP_INTERNAL), (unsigned) heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
+        (unsigned) heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+}
@@ -11,6 +11,8 @@
 
 #include <stdint.h>
 
+#include "frame_analyzer_types.h"
+
 /**
  * @brief PCAP global header
  * 
@@ -41,6 +43,8 @@ typedef struct {
 /**
  * @brief Prepares new empty buffer for PCAP formatted binary data. 
  * 
+ * If capture store session is open, frames are streamed into it instead of RAM buffer
+ * (unless CONFIG_PCAP_SERIALIZER_RAM_COPY is set). RAM buffer of CONFIG_PCAP_SERIALIZER_BUFFER_SIZE is allocated at once.
  * Has always to be called before pcap_serializer_append_frame()
  * @return uint8_t* pointer to newly allocated PCAP buffer.
  * @return \c NULL initialisation failed
@@ -53,9 +57,11 @@ uint8_t *pcap_serializer_init();
  * Expects pcap_serializer_append_frame() was already called.
  * @param buffer frame buffer that should be appended to PCAP
  * @param size size of frame buffer
+ * @param view view of the buffer returned by parse_frame_view(), used to index the frame in capture store.
+ *  \c NULL if the frame couldn't be parsed.
  * @param ts_usec timestamp of captured frame in microseconds
  */
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec);
+void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, const frame_view_t *view, unsigned ts_usec);
 
 /**
  * @brief Frees PCAP buffer and resets all values.
@@ -66,17 +72,57 @@ void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned
 void pcap_serializer_deinit();
 
 /**
- * @brief Returns size of PCAP buffer in bytes
+ * @brief Starts reading PCAP from RAM buffer.
+ * 
+ * Frames are still appended while PCAP is read, but records that are being read are not overwritten
+ * (see CONFIG_PCAP_SERIALIZER_RETENTION_RING), so first returned number of bytes stays valid PCAP
+ * until pcap_serializer_read_end(). Every call has to be paired with pcap_serializer_read_end().
+ * @return unsigned size of PCAP in bytes, 0 if there is no RAM buffer
+ */
+unsigned pcap_serializer_read_begin();
+
+/**
+ * @brief Copies part of PCAP from RAM buffer.
+ * 
+ * Can be called from any task. Records wrapped in ring are copied in order, from the oldest one.
+ * @param offset offset in PCAP, starting with global header
+ * @param data output
+ * @param size number of bytes to copy
+ * @return unsigned number of copied bytes, less than \c size if PCAP is shorter or buffer was freed meanwhile
+ */
+unsigned pcap_serializer_read(unsigned offset, uint8_t *data, unsigned size);
+
+/**
+ * @brief Ends reading started by pcap_serializer_read_begin(), records can be overwritten again.
+ */
+void pcap_serializer_read_end();
+
+/**
+ * @brief Returns capture store session that holds the PCAP stream
+ * 
+ * @return int capture store session id, PCAP has to be read from capture store
+ * @return -1 PCAP is available in RAM buffer
+ */
+int pcap_serializer_get_store_session();
+
+/**
+ * @brief Returns number of frames and frame bytes appended since last pcap_serializer_init()
  * 
- * @return unsigned
+ * Counts frames regardless of whether they are kept in RAM or streamed into capture store.
+ * @param frames output, may be NULL
+ * @param bytes output, may be NULL
  */
-unsigned pcap_serializer_get_size();
+void pcap_serializer_get_counters(unsigned *frames, unsigned *bytes);
 
 /**
- * @brief Return pointer to PCAP buffer
+ * @brief Returns number of frames and frame bytes that are not in RAM buffer since last pcap_serializer_init()
  * 
- * @return uint8_t* 
+ * Frames dropped when they didn't fit and frames overwritten or discarded later by retention policy
+ * (see CONFIG_PCAP_SERIALIZER_RETENTION) are both counted, as well as context frames still waiting for EAPOL frame.
+ * Frames streamed only into capture store are not.
+ * @param frames output, may be NULL
+ * @param bytes output, may be NULL
  */
-uint8_t *pcap_serializer_get_buffer();
+void pcap_serializer_get_dropped(unsigned *frames, unsigned *bytes);
 
 #endif
\ No newline at end of file
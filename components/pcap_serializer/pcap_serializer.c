@@ -8,11 +8,19 @@
  */
 #include "pcap_serializer.h"
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
 #include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "capture_store.h"
+#include "mem_alloc.h"
+#include "frame_analyzer_types.h"
+#include "frame_analyzer_parser.h"
 
 static const char *TAG = "pcap_serializer";
 
@@ -34,12 +42,304 @@ static const char *TAG = "pcap_serializer";
  */
 #define LINKTYPE_IEEE802_11 105
 
-static unsigned pcap_size = 0;
+/**
+ * @brief What is kept in RAM buffer once it's full, see Kconfig
+ */
+typedef enum {
+    RETENTION_STOP,
+    RETENTION_RING,
+    RETENTION_EAPOL
+} retention_t;
+
+#if defined(CONFIG_PCAP_SERIALIZER_RETENTION_RING)
+static const retention_t retention = RETENTION_RING;
+#elif defined(CONFIG_PCAP_SERIALIZER_RETENTION_EAPOL)
+static const retention_t retention = RETENTION_EAPOL;
+#else
+static const retention_t retention = RETENTION_STOP;
+#endif
+
+#ifdef CONFIG_PCAP_SERIALIZER_CONTEXT_FRAMES
+#define CONTEXT_FRAMES CONFIG_PCAP_SERIALIZER_CONTEXT_FRAMES
+#else
+#define CONTEXT_FRAMES 0
+#endif
+
+/**
+ * @brief Longest frame kept as context before EAPOL frame without evicting other context frames.
+ * Maximum MPDU length of non-HT frames, Ref: 802.11-2016 [9.2.4.7.1]
+ */
+#define CONTEXT_FRAME_SIZE 2346
+
+/**
+ * @brief Byte ring of PCAP records. Records may wrap around the end of ring, the oldest one starts at head.
+ */
+typedef struct {
+    uint8_t *data;
+    unsigned capacity;
+    unsigned head;
+    unsigned used;
+    unsigned records;
+} record_ring_t;
+
+/**
+ * @brief RAM buffer with PCAP global header followed by records ring and staging ring.
+ * 
+ * Records ring wraps only in RETENTION_RING, other modes only append to it. Readers get records rotated,
+ * so what they read is always valid PCAP. While there is any reader, records are not overwritten.
+ */
 static uint8_t *pcap_buffer = NULL;
+static record_ring_t records = { 0 };   ///< records of the PCAP
+static record_ring_t staging = { 0 };   ///< RETENTION_EAPOL: last frames kept only if EAPOL frame follows
+static bool stopped = false;            ///< RETENTION_STOP: buffer was full, no more frames are kept
+static unsigned context_after = 0;      ///< RETENTION_EAPOL: frames to keep after last EAPOL frame
+static unsigned readers = 0;            ///< readers between pcap_serializer_read_begin() and pcap_serializer_read_end()
+static SemaphoreHandle_t pcap_mutex = NULL; ///< guards RAM buffer, rings and readers
+
+static unsigned frame_count = 0;
+static unsigned frame_bytes = 0;
+static unsigned dropped_frames = 0;
+static unsigned dropped_bytes = 0;
+
+/**
+ * @brief Capture store session that receives PCAP stream instead of RAM buffer. -1 if frames are kept in RAM.
+ */
+static int store_session = -1;
+
+/**
+ * @brief Fills capture store index entry with addresses and kind of 802.11 frame
+ *
+ * @param buffer raw 802.11 frame
+ * @param view view of the buffer, \c NULL if it couldn't be parsed
+ * @param entry
+ */
+static void classify_frame(const uint8_t *buffer, const frame_view_t *view, capture_store_entry_t *entry){
+    memset(entry, 0, sizeof(capture_store_entry_t));
+    entry->kind = CAPTURE_STORE_FRAME_CTRL;
+    if(view == NULL){
+        return;
+    }
+    memcpy(entry->sta, &buffer[view->sta], 6);
+    if(view->type == FRAME_TYPE_CONTROL){
+        return;
+    }
+    memcpy(entry->bssid, &buffer[view->bssid], 6);
+    if(view->type == FRAME_TYPE_MANAGEMENT){
+        entry->kind = CAPTURE_STORE_FRAME_MGMT;
+        return;
+    }
+
+    entry->kind = CAPTURE_STORE_FRAME_DATA;
+    eapol_packet_t *eapol_packet = parse_eapol_packet((uint8_t *) buffer, view);
+    if(eapol_packet == NULL){
+        return;
+    }
+    entry->kind = CAPTURE_STORE_FRAME_EAPOL;
+    eapol_key_packet_t *eapol_key_packet = parse_eapol_key_packet(eapol_packet);
+    if(eapol_key_packet == NULL){
+        return;
+    }
+    entry->info = parse_handshake_message(eapol_key_packet);
+}
+
+/**
+ * @brief Copies data into ring at given offset from its head
+ * 
+ * @param ring
+ * @param offset
+ * @param data
+ * @param size
+ */
+static void ring_write(record_ring_t *ring, unsigned offset, const void *data, unsigned size){
+    unsigned position = (ring->head + offset) % ring->capacity;
+    unsigned first = (size < ring->capacity - position) ? size : ring->capacity - position;
+    memcpy(&ring->data[position], data, first);
+    memcpy(ring->data, (const uint8_t *) data + first, size - first);
+}
+
+/**
+ * @brief Copies data from ring at given offset from its head
+ * 
+ * @param ring
+ * @param offset
+ * @param data output
+ * @param size
+ */
+static void ring_read(const record_ring_t *ring, unsigned offset, void *data, unsigned size){
+    unsigned position = (ring->head + offset) % ring->capacity;
+    unsigned first = (size < ring->capacity - position) ? size : ring->capacity - position;
+    memcpy(data, &ring->data[position], first);
+    memcpy((uint8_t *) data + first, ring->data, size - first);
+}
+
+/**
+ * @brief Counts frame that is not kept in RAM buffer
+ * 
+ * @param size length of the frame
+ */
+static void drop_frame(unsigned size){
+    dropped_frames++;
+    dropped_bytes += size;
+}
+
+/**
+ * @brief Removes the oldest record of the ring and counts it as dropped
+ * 
+ * @param ring
+ */
+static void ring_drop_oldest(record_ring_t *ring){
+    pcap_record_header_t header;
+    ring_read(ring, 0, &header, sizeof(pcap_record_header_t));
+    unsigned record_size = sizeof(pcap_record_header_t) + header.incl_len;
+    drop_frame(header.incl_len);
+    ring->head = (ring->head + record_size) % ring->capacity;
+    ring->used -= record_size;
+    ring->records--;
+}
+
+/**
+ * @brief Appends record to the ring. Caller has to make room for it first.
+ * 
+ * @param ring
+ * @param header
+ * @param buffer frame
+ * @param size
+ */
+static void ring_push(record_ring_t *ring, const pcap_record_header_t *header, const uint8_t *buffer, unsigned size){
+    ring_write(ring, ring->used, header, sizeof(pcap_record_header_t));
+    ring_write(ring, ring->used + sizeof(pcap_record_header_t), buffer, size);
+    ring->used += sizeof(pcap_record_header_t) + size;
+    ring->records++;
+}
+
+/**
+ * @brief Moves all records from one ring to the end of another. Caller has to make room for them first.
+ * 
+ * @param destination
+ * @param source
+ */
+static void ring_move_records(record_ring_t *destination, record_ring_t *source){
+    while(source->records > 0){
+        pcap_record_header_t header;
+        ring_read(source, 0, &header, sizeof(pcap_record_header_t));
+        unsigned record_size = sizeof(pcap_record_header_t) + header.incl_len;
+        unsigned first = (record_size < source->capacity - source->head) ? record_size : source->capacity - source->head;
+        ring_write(destination, destination->used, &source->data[source->head], first);
+        ring_write(destination, destination->used + first, source->data, record_size - first);
+        destination->used += record_size;
+        destination->records++;
+        source->head = (source->head + record_size) % source->capacity;
+        source->used -= record_size;
+        source->records--;
+    }
+}
+
+/**
+ * @brief Keeps frame as context of possible following EAPOL frame, the oldest context frames are dropped to make room.
+ * 
+ * @param header
+ * @param buffer frame
+ * @param size
+ */
+static void stage_frame(const pcap_record_header_t *header, const uint8_t *buffer, unsigned size){
+    unsigned record_size = sizeof(pcap_record_header_t) + size;
+    if(record_size > staging.capacity){
+        drop_frame(size);
+        return;
+    }
+    if(staging.records == CONTEXT_FRAMES){
+        ring_drop_oldest(&staging);
+    }
+    while(staging.capacity - staging.used < record_size){
+        ring_drop_oldest(&staging);
+    }
+    ring_push(&staging, header, buffer, size);
+}
+
+/**
+ * @brief Makes room in records ring according to retention mode
+ * 
+ * @param record_size
+ * @param eapol record contains EAPOL frame, staged context frames have to fit together with it
+ * @return true record fits into the ring
+ */
+static bool ring_reserve(unsigned record_size, bool eapol){
+    if(record_size > records.capacity){
+        return false;
+    }
+    switch(retention){
+        case RETENTION_RING:
+            while(records.capacity - records.used < record_size){
+                if(readers > 0){
+                    // records being read cannot be overwritten
+                    return false;
+                }
+                ring_drop_oldest(&records);
+            }
+            return true;
+        case RETENTION_EAPOL:
+            if(!eapol){
+                return records.capacity - records.used >= record_size;
+            }
+            // context frames are less relevant than any EAPOL frame
+            while((staging.records > 0) && (records.capacity - records.used < staging.used + record_size)){
+                ring_drop_oldest(&staging);
+            }
+            return records.capacity - records.used >= staging.used + record_size;
+        default:
+            if(!stopped && (records.capacity - records.used < record_size)){
+                ESP_LOGW(TAG, "PCAP buffer is full, next frames are dropped");
+                stopped = true;
+            }
+            return !stopped;
+    }
+}
+
+/**
+ * @brief Appends record to RAM buffer according to retention mode. Must be called with mutex taken.
+ * 
+ * @param header
+ * @param buffer frame
+ * @param size
+ * @param view
+ */
+static void ring_append(const pcap_record_header_t *header, const uint8_t *buffer, unsigned size, const frame_view_t *view){
+    if(pcap_buffer == NULL){
+        drop_frame(size);
+        return;
+    }
+    bool eapol = false;
+    if(retention == RETENTION_EAPOL){
+        eapol = (view != NULL) && (parse_eapol_packet((uint8_t *) buffer, view) != NULL);
+        if(!eapol && (context_after == 0)){
+            stage_frame(header, buffer, size);
+            return;
+        }
+        if(!eapol){
+            context_after--;
+        }
+    }
+
+    if(!ring_reserve(sizeof(pcap_record_header_t) + size, eapol)){
+        drop_frame(size);
+        return;
+    }
+    if(eapol){
+        // context before EAPOL frame is kept
+        ring_move_records(&records, &staging);
+        context_after = CONTEXT_FRAMES;
+    }
+    ring_push(&records, header, buffer, size);
+}
 
 uint8_t *pcap_serializer_init(){
+    if(pcap_mutex == NULL){
+        pcap_mutex = xSemaphoreCreateMutex();
+    }
+    xSemaphoreTake(pcap_mutex, portMAX_DELAY);
     // Make sure memory from previous attack is freed
-    free(pcap_buffer);
+    mem_free(MEM_CATEGORY_CAPTURE, pcap_buffer);
+    pcap_buffer = NULL;
     // Ref: https://gitlab.com/wireshark/wireshark/-/wikis/Development/LibpcapFileFormat#global-header
     pcap_global_header_t pcap_global_header = {
         .magic_number = PCAP_MAGIC_NUMBER,
@@ -50,13 +350,55 @@ uint8_t *pcap_serializer_init(){
         .snaplen = SNAPLEN,
         .network = LINKTYPE_IEEE802_11
     };
-    pcap_buffer = (uint8_t *)malloc(sizeof(pcap_global_header_t));
-    pcap_size = sizeof(pcap_global_header_t);
+    frame_count = 0;
+    frame_bytes = 0;
+    dropped_frames = 0;
+    dropped_bytes = 0;
+    memset(&records, 0, sizeof(record_ring_t));
+    memset(&staging, 0, sizeof(record_ring_t));
+    stopped = false;
+    context_after = 0;
+
+    store_session = capture_store_session_id();
+    if(store_session >= 0){
+        ESP_LOGD(TAG, "Streaming PCAP into capture store session %04x", store_session);
+        if(capture_store_session_write(&pcap_global_header, sizeof(pcap_global_header_t), false) != ESP_OK){
+            store_session = -1;
+        }
+    }
+
+    // whole budget is allocated at once, so long capture doesn't fragment heap by reallocations
+    unsigned buffer_size = sizeof(pcap_global_header_t);
+#if !CONFIG_PCAP_SERIALIZER_RAM_COPY
+    if(store_session < 0)
+#endif
+    {
+        buffer_size = CONFIG_PCAP_SERIALIZER_BUFFER_SIZE;
+    }
+    pcap_buffer = (uint8_t *) mem_alloc(MEM_CATEGORY_CAPTURE, buffer_size);
+    if(pcap_buffer == NULL){
+        ESP_LOGE(TAG, "Cannot allocate PCAP buffer of %u B, frames will be dropped", buffer_size);
+        xSemaphoreGive(pcap_mutex);
+        return NULL;
+    }
     memcpy(pcap_buffer, &pcap_global_header, sizeof(pcap_global_header_t));
+    unsigned capacity = buffer_size - sizeof(pcap_global_header_t);
+    if((retention == RETENTION_EAPOL) && (capacity > 0)){
+        // context frames get at most half of the budget
+        staging.capacity = CONTEXT_FRAMES * (sizeof(pcap_record_header_t) + CONTEXT_FRAME_SIZE);
+        if(staging.capacity > capacity / 2){
+            staging.capacity = capacity / 2;
+        }
+        capacity -= staging.capacity;
+        staging.data = &pcap_buffer[sizeof(pcap_global_header_t) + capacity];
+    }
+    records.capacity = capacity;
+    records.data = &pcap_buffer[sizeof(pcap_global_header_t)];
+    xSemaphoreGive(pcap_mutex);
     return pcap_buffer;
 }
 
-void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned ts_usec){
+void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, const frame_view_t *view, unsigned ts_usec){
     if(size == 0){
         ESP_LOGD(TAG, "Frame size is 0. Not appending anything.");
         return;
@@ -74,28 +416,127 @@ void pcap_serializer_append_frame(const uint8_t *buffer, unsigned size, unsigned
         size = SNAPLEN;
         pcap_record_header.incl_len = SNAPLEN;
     }
+    frame_count++;
+    frame_bytes += size;
+
+    if(store_session >= 0){
+        if(capture_store_session_id() != store_session){
+            ESP_LOGD(TAG, "Capture store session closed. Not appending anything.");
+            return;
+        }
+        capture_store_entry_t entry;
+        classify_frame(buffer, view, &entry);
+        capture_store_session_write_record(&pcap_record_header, sizeof(pcap_record_header_t), buffer, size, &entry);
+#if !CONFIG_PCAP_SERIALIZER_RAM_COPY
+        return;
+#endif
+    }
 
-    uint8_t *reallocated_pcap_buffer = realloc(pcap_buffer, pcap_size + sizeof(pcap_record_header_t) + size);
-    if(reallocated_pcap_buffer == NULL){
-        ESP_LOGE(TAG, "Error reallocating PCAP buffer! PCAP buffer may not be complete.");
+    if(pcap_mutex == NULL){
         return;
     }
-    memcpy(&reallocated_pcap_buffer[pcap_size], &pcap_record_header, sizeof(pcap_record_header_t));
-    memcpy(&reallocated_pcap_buffer[pcap_size + sizeof(pcap_record_header_t)], buffer, size);
-    pcap_buffer = reallocated_pcap_buffer;
-    pcap_size += sizeof(pcap_record_header_t) + size;
+    xSemaphoreTake(pcap_mutex, portMAX_DELAY);
+    ring_append(&pcap_record_header, buffer, size, view);
+    xSemaphoreGive(pcap_mutex);
 }
 
 void pcap_serializer_deinit(){
-    free(pcap_buffer);
+    if(pcap_mutex != NULL){
+        xSemaphoreTake(pcap_mutex, portMAX_DELAY);
+    }
+    mem_free(MEM_CATEGORY_CAPTURE, pcap_buffer);
     pcap_buffer = NULL;
-    pcap_size = 0;
+    memset(&records, 0, sizeof(record_ring_t));
+    memset(&staging, 0, sizeof(record_ring_t));
+    frame_count = 0;
+    frame_bytes = 0;
+    dropped_frames = 0;
+    dropped_bytes = 0;
+    store_session = -1;
+    if(pcap_mutex != NULL){
+        xSemaphoreGive(pcap_mutex);
+    }
 }
 
-unsigned pcap_serializer_get_size(){
-    return pcap_size;
+unsigned pcap_serializer_read_begin(){
+    if(pcap_mutex == NULL){
+        return 0;
+    }
+    xSemaphoreTake(pcap_mutex, portMAX_DELAY);
+    readers++;
+    unsigned size = (pcap_buffer != NULL) ? sizeof(pcap_global_header_t) + records.used : 0;
+    xSemaphoreGive(pcap_mutex);
+    return size;
 }
 
-uint8_t *pcap_serializer_get_buffer(){
-    return pcap_buffer;
-}
\ No newline at end of file
+unsigned pcap_serializer_read(unsigned offset, uint8_t *data, unsigned size){
+    if(pcap_mutex == NULL){
+        return 0;
+    }
+    xSemaphoreTake(pcap_mutex, portMAX_DELAY);
+    unsigned total = (pcap_buffer != NULL) ? sizeof(pcap_global_header_t) + records.used : 0;
+    if(offset >= total){
+        size = 0;
+    } else if(size > total - offset){
+        size = total - offset;
+    }
+    unsigned copied = 0;
+    if((size > 0) && (offset < sizeof(pcap_global_header_t))){
+        copied = sizeof(pcap_global_header_t) - offset;
+        if(copied > size){
+            copied = size;
+        }
+        memcpy(data, &pcap_buffer[offset], copied);
+    }
+    if(copied < size){
+        // records are copied from the oldest one, so wrapped ring is read as contiguous PCAP
+        ring_read(&records, offset + copied - sizeof(pcap_global_header_t), &data[copied], size - copied);
+    }
+    xSemaphoreGive(pcap_mutex);
+    return size;
+}
+
+void pcap_serializer_read_end(){
+    if(pcap_mutex == NULL){
+        return;
+    }
+    xSemaphoreTake(pcap_mutex, portMAX_DELAY);
+    if(readers > 0){
+        readers--;
+    }
+    xSemaphoreGive(pcap_mutex);
+}
+
+int pcap_serializer_get_store_session(){
+#if CONFIG_PCAP_SERIALIZER_RAM_COPY
+    return -1;
+#else
+    return store_session;
+#endif
+}
+void pcap_serializer_get_counters(unsigned *frames, unsigned *bytes){
+    if(frames != NULL){
+        *frames = frame_count;
+    }
+    if(bytes != NULL){
+        *bytes = frame_bytes;
+    }
+}
+
+void pcap_serializer_get_dropped(unsigned *frames, unsigned *bytes){
+    unsigned staged_frames = 0;
+    unsigned staged_bytes = 0;
+    if(pcap_mutex != NULL){
+        // staged context frames are not in PCAP unless EAPOL frame follows
+        xSemaphoreTake(pcap_mutex, portMAX_DELAY);
+        staged_frames = staging.records;
+        staged_bytes = staging.used - staged_frames * sizeof(pcap_record_header_t);
+        xSemaphoreGive(pcap_mutex);
+    }
+    if(frames != NULL){
+        *frames = dropped_frames + staged_frames;
+    }
+    if(bytes != NULL){
+        *bytes = dropped_bytes + staged_bytes;
+    }
+}
@@ -0,0 +1,322 @@
+var AttackStateEnum = { READY: 0, RUNNING: 1, FINISHED: 2, TIMEOUT: 3};
+var AttackTypeEnum = { ATTACK_TYPE_PASSIVE: 0, ATTACK_TYPE_HANDSHAKE: 1, ATTACK_TYPE_PMKID: 2, ATTACK_TYPE_DOS: 3};
+var selectedApElements = [];
+var poll;
+var poll_interval = 1000;
+var running_poll;
+var running_poll_interval = 1000;
+var attack_timeout = 0;
+var time_elapsed = 0;
+var defaultResultContent = document.getElementById("result").innerHTML;
+var defaultAttackMethods = document.getElementById("attack_method").outerHTML;
+var loadedModules = {};
+function loadModule(src, callback) {
+    // modules are fetched only when first needed and reused afterwards
+    if(loadedModules[src] === true) {
+        callback();
+        return;
+    }
+    if(loadedModules[src]) {
+        loadedModules[src].push(callback);
+        return;
+    }
+    loadedModules[src] = [callback];
+    var script = document.createElement("script");
+    script.src = src;
+    script.onload = function() {
+        var callbacks = loadedModules[src];
+        loadedModules[src] = true;
+        callbacks.forEach(function(cb) { cb(); });
+    };
+    script.onerror = function() {
+        delete loadedModules[src];
+        document.getElementById("errors").innerHTML = "Cannot load " + src;
+    };
+    document.head.appendChild(script);
+}
+var ATTACK_REQUEST_VERSION = 1;
+var ATTACK_REQUEST_AP_MAX = 10;
+var PushTypeEnum = { STATUS: 1, COUNTERS: 2, HANDSHAKE: 3 };
+var status_socket = null;
+var status_socket_retry = 5000;
+function openStatusSocket() {
+    if(!("WebSocket" in window)) {
+        getStatus();
+        return;
+    }
+    status_socket = new WebSocket("ws://192.168.4.1/ws");
+    status_socket.binaryType = "arraybuffer";
+    status_socket.onmessage = function(event) {
+        var type = new Uint8Array(event.data, 0, 1)[0];
+        switch(type) {
+            case PushTypeEnum.STATUS:
+                handleStatus(event.data.slice(1));
+                break;
+            case PushTypeEnum.COUNTERS:
+                showCounters(new DataView(event.data, 1));
+                break;
+            case PushTypeEnum.HANDSHAKE:
+                showHandshakeMessage(new Uint8Array(event.data, 1));
+                break;
+            default:
+                console.log("Unknown push message type " + type);
+        }
+    };
+    status_socket.onclose = function() {
+        // fall back to polling until push channel is available again
+        console.log("Status socket closed");
+        status_socket = null;
+        getStatus();
+        setTimeout(openStatusSocket, status_socket_retry);
+    };
+}
+function showCounters(view) {
+    var counters = "Captured frames: " + view.getUint32(0, true) + " (" + view.getUint32(4, true) + " B)";
+    if(view.byteLength >= 16 && view.getUint32(8, true) > 0){
+        counters += ", dropped: " + view.getUint32(8, true) + " (" + view.getUint32(12, true) + " B)";
+    }
+    document.getElementById("running-counters").innerHTML = counters;
+}
+function showHandshakeMessage(summary) {
+    var bssid = "";
+    var sta = "";
+    for(let i = 0; i < 6; i = i + 1) {
+        bssid += uint8ToHex(summary[i]);
+        sta += uint8ToHex(summary[6 + i]);
+    }
+    var message = summary[12] ? "M" + summary[12] : "other EAPOL-Key";
+    var rssi = new Int8Array(summary.buffer, summary.byteOffset + 13, 1)[0];
+    document.getElementById("running-handshakes").innerHTML += "<code>" + bssid + " - " + sta + "</code> " + message + " (" + rssi + " dBm)<br>";
+}
+function handleStatus(arrayBuffer) {
+    var attack_state = parseInt(new Uint8Array(arrayBuffer, 0, 1));
+    var attack_type = parseInt(new Uint8Array(arrayBuffer, 1, 1));
+    var attack_content_size = parseInt(new Uint16Array(arrayBuffer, 2, 1));
+    var attack_content = new Uint8Array(arrayBuffer, 4);
+    console.log("attack_state=" + attack_state + "; attack_type=" + attack_type + "; attack_count_size=" + attack_content_size);
+    var status = "ERROR: Cannot parse attack state.";
+    hideAllSections();
+    switch(attack_state) {
+        case AttackStateEnum.READY:
+            showAttackConfig();
+            break;
+        case AttackStateEnum.RUNNING:
+            showRunning();
+            if(status_socket == null) {
+                console.log("Poll");
+                setTimeout(getStatus, poll_interval);
+            }
+            break;
+        case AttackStateEnum.FINISHED:
+            showResult("FINISHED", attack_type, attack_content_size, attack_content);
+            break;
+        case AttackStateEnum.TIMEOUT:
+            showResult("TIMEOUT", attack_type, attack_content_size, attack_content);
+            break;
+        default:
+            document.getElementById("errors").innerHTML = "Error loading attack status! Unknown state.";
+    }
+}
+function getStatus() {
+    var oReq = new XMLHttpRequest();
+    oReq.onload = function() {
+        var arrayBuffer = oReq.response;
+        if(arrayBuffer) {
+            handleStatus(arrayBuffer);
+        }
+    };
+    oReq.onerror = function() {
+        console.log("Request error");
+        document.getElementById("errors").innerHTML = "Cannot reach ESP32. Check that you are connected to management AP. You might get disconnected during attack.";
+        getStatus();
+    };
+    oReq.ontimeout = function() {
+        console.log("Request timeout");
+        getStatus();  
+    };
+    oReq.open("GET", "http://192.168.4.1/status", true);
+    oReq.responseType = "arraybuffer";
+    oReq.send();
+}
+function hideAllSections(){
+    for(let section of document.getElementsByTagName("section")){
+        section.style.display = "none";
+    };
+}
+function showRunning(){
+    hideAllSections();
+    document.getElementById("running").style.display = "block";
+}
+function countProgress(){
+    if(time_elapsed >= attack_timeout){
+        document.getElementById("errors").innerHTML = "Please reconnect to management AP";
+        document.getElementById("errors").style.display = "block";
+        clearInterval(running_poll);
+    }
+    document.getElementById("running-progress").innerHTML = "This attack is ongoing now. Please close this browser window and disconnect from the Management Access Point. To stop the attack, reset your board.";
+    time_elapsed++;
+}
+function showAttackConfig(){
+    document.getElementById("ready").style.display = "block";
+    refreshAps();
+    loadModule("sessions.js", function() { refreshSessions(); });
+}
+function showResult(status, attack_type, attack_content_size, attack_content){
+    hideAllSections();
+    clearInterval(poll);
+    document.getElementById("result").innerHTML = defaultResultContent;
+    document.getElementById("result").style.display = "block";
+    document.getElementById("result-meta").innerHTML = status + "<br>";
+    type = "ERROR: Cannot parse attack type.";
+    switch(attack_type) {
+        case AttackTypeEnum.ATTACK_TYPE_PASSIVE:
+            type = "ATTACK_TYPE_PASSIVE";
+            break;
+        case AttackTypeEnum.ATTACK_TYPE_HANDSHAKE:
+            type = "ATTACK_TYPE_HANDSHAKE";
+            loadModule("results.js", function() { resultHandshake(attack_content, attack_content_size); });
+            break;
+        case AttackTypeEnum.ATTACK_TYPE_PMKID:
+            type = "ATTACK_TYPE_PMKID";
+            loadModule("results.js", function() { resultPmkid(attack_content, attack_content_size); });
+            break;
+        case AttackTypeEnum.ATTACK_TYPE_DOS:
+            type = "ATTACK_TYPE_DOS";
+            break;
+        default:
+            type = "UNKNOWN";
+    }
+    document.getElementById("result-meta").innerHTML += type + "<br>";
+}
+function refreshAps() {
+    document.getElementById("ap-list").innerHTML = "Loading (this may take a while)...";
+    var oReq = new XMLHttpRequest();
+    oReq.onload = function() {
+        document.getElementById("ap-list").innerHTML = "<th>SSID</th><th>BSSID</th><th>RSSI</th>";
+        var arrayBuffer = oReq.response;
+        if(arrayBuffer) {
+            var byteArray = new Uint8Array(arrayBuffer);
+            for  (let i = 0; i < byteArray.byteLength; i = i + 40) {
+                var tr = document.createElement('tr');
+                tr.setAttribute("id", i / 40);
+                tr.setAttribute("onClick", "selectAp(this)");
+                var td_ssid = document.createElement('td');
+                var td_rssi = document.createElement('td');
+                var td_bssid = document.createElement('td');
+                td_ssid.innerHTML = new TextDecoder("utf-8").decode(byteArray.subarray(i + 0, i + 32));
+                tr.appendChild(td_ssid);
+                for(let j = 0; j < 6; j++){
+                    td_bssid.innerHTML += uint8ToHex(byteArray[i + 33 + j]) + ":";
+                }
+                tr.appendChild(td_bssid);
+                td_rssi.innerHTML = byteArray[i + 39] - 255;
+                tr.appendChild(td_rssi);
+                document.getElementById("ap-list").appendChild(tr);
+            }
+        }
+    };
+    oReq.onerror = function() {
+        document.getElementById("ap-list").innerHTML = "ERROR";
+    };
+    oReq.open("GET", "http://192.168.4.1/ap-list", true);
+    oReq.responseType = "arraybuffer";
+    oReq.send();
+}
+function selectAp(el) {
+        console.log(el.id);
+
+        if (selectedApElements.includes(el)) {
+            selectedApElements = selectedApElements.filter(item => item !== el);
+            el.classList.remove("selected");
+        } else {
+            selectedApElements.push(el);
+            el.classList.add("selected");
+        }
+}
+function runAttack() {
+    //if(selectedApElement == -1){
+    if (selectedApElements.length === 0) {
+        console.log("No AP selected. Attack not started.");
+        document.getElementById("errors").innerHTML = "No AP selected. Attack not started.";
+        return;
+    }
+    hideAllSections();
+    document.getElementById("running-counters").innerHTML = "";
+    document.getElementById("running-handshakes").innerHTML = "";
+    document.getElementById("running").style.display = "block";
+
+    // var arrayBuffer = new ArrayBuffer(4);
+    // var uint8Array = new Uint8Array(arrayBuffer);
+    // uint8Array[0] = parseInt(selectedApElement.id);
+    // uint8Array[1] = parseInt(document.getElementById("attack_type").value);
+    // uint8Array[2] = parseInt(document.getElementById("attack_method").value);
+    // uint8Array[3] = parseInt(document.getElementById("attack_timeout").value);
+    // var oReq = new XMLHttpRequest();
+    // oReq.open("POST", "http://192.168.4.1/run-attack", true);
+    // oReq.send(arrayBuffer);
+
+    // attack_request_header_t followed by AP IDs
+    var ids = Array.from(selectedApElements).map(el => parseInt(el.id)).slice(0, ATTACK_REQUEST_AP_MAX);
+    var arrayBuffer = new ArrayBuffer(5 + ids.length);
+    var uint8Array = new Uint8Array(arrayBuffer);
+    uint8Array[0] = ATTACK_REQUEST_VERSION;
+    uint8Array[1] = parseInt(document.getElementById("attack_type").value);
+    uint8Array[2] = parseInt(document.getElementById("attack_method").value);
+    uint8Array[3] = parseInt(document.getElementById("attack_timeout").value);
+    uint8Array[4] = ids.length;
+    uint8Array.set(ids, 5);
+    console.log("Attack request:", uint8Array);
+
+    var oReq = new XMLHttpRequest();
+    oReq.open("POST", "http://192.168.4.1/run-attack", true);
+    oReq.send(arrayBuffer);
+    //getStatus();
+    attack_timeout = parseInt(document.getElementById("attack_timeout").value);
+    time_elapsed = 0;
+    //running_poll = setInterval(countProgress, running_poll_interval);
+}
+function resetAttack(){
+    hideAllSections();
+    showAttackConfig();
+    var oReq = new XMLHttpRequest();
+    oReq.open("HEAD", "http://192.168.4.1/reset", true);
+    oReq.send();
+}
+function uint8ToHex(uint8){
+    return ("00" + uint8.toString(16)).slice(-2);
+}
+function updateConfigurableFields(el){
+    document.getElementById("attack_method").outerHTML = defaultAttackMethods;
+    switch(parseInt(el.value)){
+        case AttackTypeEnum.ATTACK_TYPE_PASSIVE:
+            console.log("PASSIVE configuration");
+            break;
+        case AttackTypeEnum.ATTACK_TYPE_HANDSHAKE:
+            console.log("HANDSHAKE configuration");
+            document.getElementById("attack_timeout").value = 60;
+            setAttackMethods(["DEAUTH_ROGUE_AP (PASSIVE)", "DEAUTH_BROADCAST (ACTIVE)", "CAPTURE_ONLY (PASSIVE)"]);
+            break;
+        case AttackTypeEnum.ATTACK_TYPE_PMKID:
+            console.log("PMKID configuration");
+            document.getElementById("attack_timeout").value = 5;
+            break;
+        case AttackTypeEnum.ATTACK_TYPE_DOS:
+            console.log("DOS configuration");
+            document.getElementById("attack_timeout").value = 120;
+            setAttackMethods(["DEAUTH_ROGUE_AP (PASSIVE)", "DEAUTH_BROADCAST (ACTIVE)", "DEAUTH_COMBINE_ALL"]);
+            break;
+        default:
+            console.log("Unknown attack type");
+            break;
+    }
+}
+function setAttackMethods(attackMethodsArray){
+    document.getElementById("attack_method").removeAttribute("disabled");
+    attackMethodsArray.forEach(function(method, index){
+        let option = document.createElement("option");
+        option.value = index;
+        option.text = method;
+        option.selected = true;
+        document.getElementById("attack_method").appendChild(option);
+    });
+}
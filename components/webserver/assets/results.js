@@ -0,0 +1,56 @@
+function resultPmkid(attack_content, attack_content_size){
+    var mac_ap = "";
+    var mac_sta = "";
+    var ssid = "";
+    var ssid_text = "";
+    var pmkid = "";
+    var index = 0;
+    for(let i = 0; i < 6; i = i + 1) {
+        mac_ap += uint8ToHex(attack_content[index + i]);
+    }
+    index = index + 6;
+    for(let i = 0; i < 6; i = i + 1) {
+        mac_sta += uint8ToHex(attack_content[index + i]);
+    }
+    index = index + 6;
+    for(let i = 0; i < attack_content[index]; i = i + 1) {
+        ssid += uint8ToHex(attack_content[index + 1 + i]);
+        ssid_text += String.fromCharCode(attack_content[index + 1 + i]);
+    }
+    index = index + attack_content[index] + 1;
+    var pmkid_cnt = 0;
+    for(let i = 0; i < attack_content_size - index; i = i + 1) {
+        if((i % 16) == 0){
+            pmkid += "<br>";
+            pmkid += "</code>PMKID #" + pmkid_cnt + ": <code>";
+            pmkid_cnt += 1;
+        }
+        pmkid += uint8ToHex(attack_content[index + i]);
+    }
+    document.getElementById("result-content").innerHTML = "";
+    document.getElementById("result-content").innerHTML += "MAC AP: <code>" + mac_ap + "</code><br>";
+    document.getElementById("result-content").innerHTML += "MAC STA: <code>" + mac_sta + "</code><br>";
+    document.getElementById("result-content").innerHTML += "(E)SSID: <code>" + ssid + "</code> (" + ssid_text + ")";
+    document.getElementById("result-content").innerHTML += "<code>" + pmkid + "</code><br>";
+    document.getElementById("result-content").innerHTML += "<br>Hashcat ready format:"
+    document.getElementById("result-content").innerHTML += "<code>" + pmkid + "*" + mac_ap + "*" + mac_sta  + "*" + ssid  + "</code><br>";
+}
+function resultHandshake(attack_content, attack_content_size){
+    document.getElementById("result-content").innerHTML = "";
+    var pcap_link = document.createElement("a");
+    pcap_link.setAttribute("href", "capture.pcap");
+    pcap_link.text = "Download PCAP file";
+    var hccapx_link = document.createElement("a");
+    hccapx_link.setAttribute("href", "capture.hccapx");
+    hccapx_link.text = "Download HCCAPX file";
+    document.getElementById("result-content").innerHTML += "<p>" + pcap_link.outerHTML + "</p>";
+    document.getElementById("result-content").innerHTML += "<p>" + hccapx_link.outerHTML + "</p>";
+    var handshakes = "";
+    for(let i = 0; i < attack_content_size; i = i + 1) {
+        handshakes += uint8ToHex(attack_content[i]);
+        if(i % 50 == 49) {
+            handshakes += "\n";
+        }
+    }
+    document.getElementById("result-content").innerHTML += "<pre><code>" + handshakes + "</code></pre>";
+}
@@ -0,0 +1,43 @@
+function refreshSessions() {
+    var oReq = new XMLHttpRequest();
+    oReq.onload = function() {
+        document.getElementById("session-list").innerHTML = "<th>ID</th><th>Type</th><th>BSSID</th><th>Size</th><th>Frames</th><th>Files</th>";
+        var arrayBuffer = oReq.response;
+        if(arrayBuffer) {
+            // capture_store_session_t, 28 bytes, little endian
+            var view = new DataView(arrayBuffer);
+            for(let i = 0; i + 28 <= arrayBuffer.byteLength; i = i + 28) {
+                var id = ("0000" + view.getUint16(i, true).toString(16)).slice(-4);
+                var flags = view.getUint8(i + 3);
+                var bssid = "";
+                for(let j = 0; j < 6; j++){
+                    bssid += uint8ToHex(view.getUint8(i + 4 + j)) + ":";
+                }
+                var files = "<a href=\"session?id=" + id + "\">PCAP</a>";
+                if(flags & 0x04){
+                    files += " <a href=\"session?id=" + id + "&artifact=hccapx\">HCCAPX</a>";
+                }
+                if(flags & 0x08){
+                    var query = "session-query?id=" + id + "&bssid=" + bssid.slice(0, -1);
+                    files += " <a href=\"" + query + "&kinds=8\">EAPOL</a>";
+                    if(flags & 0x10){
+                        files += " <a href=\"" + query + "&complete=1\">Handshakes</a>";
+                    }
+                }
+                if(flags & 0x02){
+                    files += " (truncated)";
+                }
+                var tr = document.createElement('tr');
+                tr.innerHTML = "<td>" + id + "</td><td>" + view.getUint8(i + 2) + "</td><td>" + bssid + "</td><td>"
+                    + view.getUint32(i + 20, true) + "</td><td>" + view.getUint32(i + 24, true) + "</td><td>" + files + "</td>";
+                document.getElementById("session-list").appendChild(tr);
+            }
+        }
+    };
+    oReq.onerror = function() {
+        document.getElementById("session-list").innerHTML = "ERROR";
+    };
+    oReq.open("GET", "http://192.168.4.1/sessions", true);
+    oReq.responseType = "arraybuffer";
+    oReq.send();
+}
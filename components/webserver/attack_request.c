@@ -0,0 +1,80 @@
+/**
+ * @file attack_request.c
+ * @date 2026-10-19
+ *
+ * @brief Implements incremental decoder of \c /run-attack request body
+ */
+#include "attack_request.h"
+
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+
+#include "attack.h"
+
+static const char *TAG = "webserver:attack_request";
+
+esp_err_t attack_request_check_length(size_t content_len){
+    if(content_len > sizeof(attack_request_header_t) + ATTACK_REQUEST_AP_MAX){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if(content_len < sizeof(attack_request_header_t) + 1){
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+void attack_request_decoder_init(attack_request_decoder_t *decoder){
+    memset(decoder, 0, sizeof(attack_request_decoder_t));
+}
+
+/**
+ * @brief Validates complete header and copies its fields into decoded request.
+ */
+static esp_err_t attack_request_decode_header(attack_request_decoder_t *decoder){
+    const attack_request_header_t *header = &decoder->header;
+    if(header->version != ATTACK_REQUEST_VERSION){
+        ESP_LOGW(TAG, "Unsupported request version %u", header->version);
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if(header->type > ATTACK_TYPE_DOS){
+        ESP_LOGW(TAG, "Unknown attack type %u", header->type);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if((header->num_aps == 0) || (header->num_aps > ATTACK_REQUEST_AP_MAX)){
+        ESP_LOGW(TAG, "Invalid number of APs %u", header->num_aps);
+        return ESP_ERR_INVALID_ARG;
+    }
+    decoder->request.type = header->type;
+    decoder->request.method = header->method;
+    decoder->request.timeout = header->timeout;
+    decoder->request.num_aps = header->num_aps;
+    return ESP_OK;
+}
+
+esp_err_t attack_request_decoder_feed(attack_request_decoder_t *decoder, const uint8_t *data, size_t size){
+    uint8_t *header = (uint8_t *) &decoder->header;
+    for(size_t i = 0; i < size; i++){
+        if(decoder->received < sizeof(attack_request_header_t)){
+            header[decoder->received++] = data[i];
+            if(decoder->received == sizeof(attack_request_header_t)){
+                esp_err_t err = attack_request_decode_header(decoder);
+                if(err != ESP_OK){
+                    return err;
+                }
+            }
+            continue;
+        }
+        if(attack_request_decoder_done(decoder)){
+            ESP_LOGW(TAG, "Unexpected data after last AP ID");
+            return ESP_ERR_INVALID_SIZE;
+        }
+        decoder->request.ap_ids[decoder->received++ - sizeof(attack_request_header_t)] = data[i];
+    }
+    return ESP_OK;
+}
+
+bool attack_request_decoder_done(const attack_request_decoder_t *decoder){
+    return (decoder->received >= sizeof(attack_request_header_t))
+        && (decoder->received == sizeof(attack_request_header_t) + decoder->header.num_aps);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file attack_request.h
+ * @date 2026-10-19
+ *
+ * @brief Internal interface of incremental \c /run-attack request decoder
+ */
+#ifndef ATTACK_REQUEST_H
+#define ATTACK_REQUEST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "webserver.h"
+
+/**
+ * @brief Decoder state. Body may be fed in arbitrary pieces, as they come from socket.
+ */
+typedef struct {
+    attack_request_header_t header;
+    size_t received;            ///< number of body bytes consumed so far
+    attack_request_t request;   ///< decoded request, valid once attack_request_decoder_done() returns true
+} attack_request_decoder_t;
+
+/**
+ * @brief Checks whether declared body length can be valid request before receiving anything.
+ *
+ * @param content_len value of Content-Length header
+ * @return esp_err_t ESP_OK, ESP_ERR_INVALID_SIZE if body is longer than largest valid request,
+ *  ESP_ERR_INVALID_ARG if body is shorter than smallest valid request
+ */
+esp_err_t attack_request_check_length(size_t content_len);
+
+/**
+ * @brief Resets decoder before new request.
+ *
+ * @param decoder
+ */
+void attack_request_decoder_init(attack_request_decoder_t *decoder);
+
+/**
+ * @brief Decodes next piece of request body.
+ *
+ * Header fields are validated as soon as header is complete.
+ * @param decoder
+ * @param data
+ * @param size
+ * @return esp_err_t ESP_OK, ESP_ERR_INVALID_VERSION for unknown schema version,
+ *  ESP_ERR_INVALID_ARG for invalid field value, ESP_ERR_INVALID_SIZE for data after the last AP ID
+ */
+esp_err_t attack_request_decoder_feed(attack_request_decoder_t *decoder, const uint8_t *data, size_t size);
+
+/**
+ * @brief Returns true when complete request was decoded.
+ *
+ * @param decoder
+ * @return true
+ * @return false
+ */
+bool attack_request_decoder_done(const attack_request_decoder_t *decoder);
+
+#endif
@@ -9,6 +9,8 @@
 #ifndef WEBSERVER_H
 #define WEBSERVER_H
 
+#include <stdint.h>
+
 #include "esp_event.h"
 
 ESP_EVENT_DECLARE_BASE(WEBSERVER_EVENTS);
@@ -18,7 +20,29 @@ enum {
 };
 
 /**
- * @brief Struct to deserialize attack request parameters 
+ * @brief Version of \c /run-attack wire schema
+ */
+#define ATTACK_REQUEST_VERSION 1
+/**
+ * @brief Maximum number of APs attacked by single request
+ */
+#define ATTACK_REQUEST_AP_MAX 10
+
+/**
+ * @brief Header of \c /run-attack request body
+ * 
+ * Body consists of this header immediately followed by \c num_aps one byte AP IDs, nothing else.
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t version;        //< ATTACK_REQUEST_VERSION
+    uint8_t type;           //< Chosen type of attack
+    uint8_t method;         //< Chosen method of attack
+    uint8_t timeout;        //< Attack timeout in seconds
+    uint8_t num_aps;        //< Number of AP IDs following the header, 1 - ATTACK_REQUEST_AP_MAX
+} attack_request_header_t;
+
+/**
+ * @brief Validated attack request passed with WEBSERVER_EVENT_ATTACK_REQUEST event
  * 
  */
 typedef struct {
@@ -26,13 +50,83 @@ typedef struct {
     uint8_t type;           //< Chosen type of attack
     uint8_t method;         //< Chosen method of attack
     uint8_t timeout;        //< Attack timeout in seconds
-    uint8_t num_aps;       //< Liczba wybranych AP
-    uint8_t ap_ids[10];  //< Statyczna tablica AP IDs (zawsze 10 elementów)  
+    uint8_t num_aps;        //< Number of valid items in ap_ids
+    uint8_t ap_ids[ATTACK_REQUEST_AP_MAX];  //< IDs of chosen APs from wifi_controller - ap_scanner
 } attack_request_t;
 
+/**
+ * @brief Types of messages pushed to WebSocket clients connected to \c /ws endpoint.
+ * 
+ * Every message is single binary frame starting with one byte of this type.
+ */
+typedef enum {
+    WEBSERVER_PUSH_STATUS = 1,      ///< followed by the same data as \c /status response
+    WEBSERVER_PUSH_COUNTERS = 2,    ///< followed by webserver_push_counters_t
+    WEBSERVER_PUSH_HANDSHAKE = 3    ///< followed by webserver_handshake_summary_t
+} webserver_push_type_t;
+
+/**
+ * @brief Capture counters of running attack
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t frames;        ///< frames captured since attack start
+    uint32_t bytes;         ///< bytes of captured frames
+    uint32_t dropped_frames;    ///< frames not kept in RAM buffer due to retention policy
+    uint32_t dropped_bytes;     ///< bytes of dropped frames
+} webserver_push_counters_t;
+
+/**
+ * @brief Summary of newly captured handshake message
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t bssid[6];
+    uint8_t sta[6];
+    uint8_t message;        ///< 4-way handshake message number 1-4, 0 for other EAPOL-Key frames (e.g. group key handshake)
+    int8_t rssi;
+} webserver_handshake_summary_t;
+
+/**
+ * @brief Header of \c /heap response
+ *
+ * Header is followed by \c category_count webserver_heap_category_t records, indexed by mem_category_t.
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t free_internal;         ///< free internal RAM
+    uint32_t minimum_free_internal; ///< lowest free internal RAM since boot
+    uint32_t largest_free_internal; ///< largest free block of internal RAM
+    uint32_t free_spiram;           ///< free PSRAM, 0 if there is none
+    uint8_t category_count;
+} webserver_heap_header_t;
+
+/**
+ * @brief Allocator statistics of one category, see mem_alloc_stats_t
+ */
+typedef struct __attribute__((packed)) {
+    uint32_t in_use;
+    uint32_t peak;
+    uint32_t allocations;
+    uint32_t failures;
+    uint32_t fallbacks;
+} webserver_heap_category_t;
+
 /**
  * @brief Initializes and starts webserver 
  */
 void webserver_run();
 
+/**
+ * @brief Pushes current attack status to all WebSocket clients.
+ * 
+ * Should be called on every attack state transition. Content is included only for finished attacks.
+ * Message is sent asynchronously from webserver task, so this function can be called from any task.
+ */
+void webserver_push_status();
+
+/**
+ * @brief Pushes summary of newly captured handshake message to all WebSocket clients.
+ * 
+ * @param summary
+ */
+void webserver_push_handshake(const webserver_handshake_summary_t *summary);
+
 #endif
\ No newline at end of file
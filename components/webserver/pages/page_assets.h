@@ -0,0 +1,1687 @@
+// This file was generated using utils/convert_assets_to_header_file.sh
+static const unsigned char asset_app_js[] = {
+  0X1F, 0X8B, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0XBD, 0X1A,
+  0X6B, 0X53, 0XDB, 0X48, 0XF2, 0X7B, 0X7E, 0XC5, 0XAC, 0X3E, 0X6C, 0XE4,
+  0XC2, 0X08, 0XDB, 0X04, 0X2A, 0X0B, 0X81, 0X2B, 0X03, 0XDE, 0XE0, 0X0A,
+  0XD8, 0X3E, 0XDB, 0X64, 0X37, 0X45, 0X51, 0X2E, 0X59, 0X1A, 0X63, 0X05,
+  0X59, 0XF2, 0X49, 0X23, 0X1C, 0X1F, 0XE5, 0XFF, 0X7E, 0X3D, 0X0F, 0X49,
+  0X33, 0X7A, 0XF8, 0X01, 0XEC, 0XE5, 0X43, 0X12, 0X6B, 0X7A, 0XBA, 0X7B,
+  0XFA, 0XDD, 0X3D, 0XF3, 0X6C, 0X06, 0XA8, 0X49, 0X88, 0X69, 0X3D, 0X0D,
+  0X88, 0X49, 0X70, 0XCB, 0X8B, 0X66, 0XE8, 0X0C, 0XBD, 0XA0, 0X7E, 0XAB,
+  0X79, 0XF5, 0XE3, 0X04, 0XD5, 0XAA, 0XA8, 0X7F, 0XD7, 0XE9, 0XB4, 0X3B,
+  0X5F, 0X4F, 0X50, 0XBD, 0X8A, 0XFE, 0X6C, 0X77, 0XDA, 0X83, 0XEB, 0XD6,
+  0XD5, 0X09, 0X6A, 0X54, 0XD1, 0XB0, 0X7D, 0XDB, 0XEA, 0XDE, 0X0D, 0X4F,
+  0XD0, 0XE1, 0XEA, 0XF4, 0XC3, 0X73, 0X82, 0X67, 0XB8, 0X9C, 0XA7, 0X68,
+  0X9A, 0XC3, 0X61, 0XF3, 0XF2, 0XDB, 0X68, 0XF8, 0XA3, 0XD7, 0X1A, 0XF5,
+  0X9A, 0X83, 0X41, 0XFB, 0X7B, 0X8B, 0X21, 0X95, 0XBF, 0X5F, 0X37, 0X3B,
+  0X57, 0X83, 0XEB, 0XE6, 0XB7, 0X16, 0X23, 0XA1, 0XEC, 0XB8, 0XFD, 0XD6,
+  0XE6, 0XB4, 0XE4, 0XAF, 0X57, 0XDD, 0X41, 0X4A, 0X33, 0XC4, 0X2E, 0XB6,
+  0X08, 0XB6, 0X9B, 0XF3, 0X96, 0X8B, 0X67, 0XD8, 0X23, 0X21, 0XD0, 0XBD,
+  0X7F, 0XE0, 0X8B, 0X73, 0XDF, 0X75, 0XD3, 0XFF, 0X8D, 0X1C, 0X8F, 0XE0,
+  0XE0, 0XD9, 0X74, 0X01, 0XA2, 0X5E, 0XAB, 0XD5, 0XF8, 0X4A, 0X10, 0X79,
+  0X9E, 0XE3, 0X3D, 0X8E, 0X52, 0X58, 0XF9, 0X4B, 0XF1, 0X1E, 0X93, 0X1D,
+  0X74, 0X44, 0X9C, 0X19, 0XF6, 0X23, 0X02, 0X4B, 0XE2, 0X3B, 0XFD, 0X30,
+  0XC2, 0XAE, 0X39, 0X0F, 0XB1, 0X9D, 0X7E, 0XB5, 0XF1, 0XC4, 0X8C, 0X5C,
+  0XD2, 0XC7, 0X21, 0XFC, 0X7D, 0XE9, 0X03, 0X42, 0X8F, 0XEE, 0XB1, 0X7D,
+  0X2B, 0XA2, 0X0C, 0X1B, 0X8F, 0X98, 0X08, 0XDE, 0X2F, 0X96, 0X6D, 0X5B,
+  0XD7, 0X02, 0X06, 0XA8, 0X55, 0X0C, 0XC7, 0XF3, 0X70, 0X70, 0X3D, 0XBC,
+  0XBD, 0X51, 0XF0, 0X70, 0X29, 0XDF, 0X62, 0X32, 0XF5, 0XED, 0X70, 0X1D,
+  0X1E, 0XC1, 0XE5, 0X8C, 0X41, 0X02, 0X3A, 0X60, 0X55, 0X46, 0XE7, 0XFA,
+  0XA6, 0X8D, 0XED, 0X5B, 0XDF, 0X8E, 0X5C, 0X4C, 0XF1, 0XBC, 0X80, 0X44,
+  0X27, 0X91, 0X67, 0X11, 0XC7, 0XF7, 0XD8, 0X22, 0X5F, 0XD2, 0XC3, 0XC0,
+  0XAA, 0X22, 0XCB, 0X74, 0XDD, 0X31, 0X60, 0XAB, 0XA0, 0X97, 0X0F, 0X08,
+  0XFE, 0X1C, 0X1C, 0XA0, 0X99, 0XD8, 0X69, 0X06, 0X18, 0X4D, 0X30, 0XB1,
+  0XA6, 0X70, 0X66, 0XDF, 0X73, 0X97, 0X68, 0X31, 0XC5, 0X1E, 0X9A, 0X38,
+  0X41, 0X48, 0X90, 0X87, 0X31, 0XD0, 0X40, 0XA6, 0X67, 0XA3, 0X00, 0X47,
+  0X54, 0X2A, 0XE6, 0X04, 0X98, 0X58, 0X98, 0X81, 0X1D, 0X32, 0X3C, 0XCE,
+  0X44, 0X57, 0XF8, 0XB8, 0X07, 0X6A, 0X0F, 0XE8, 0XEC, 0XEC, 0X0C, 0X91,
+  0X20, 0XC2, 0X31, 0X35, 0XFA, 0X27, 0XE6, 0X40, 0XAF, 0X9C, 0X26, 0XDF,
+  0X02, 0X4C, 0XA2, 0XC0, 0XE3, 0XBF, 0X57, 0XE5, 0XF8, 0X64, 0X34, 0XF9,
+  0X55, 0X63, 0X1E, 0X85, 0X53, 0X3D, 0X39, 0XE0, 0X3A, 0XEC, 0X45, 0XAC,
+  0XA2, 0XFB, 0X78, 0XEB, 0X03, 0X07, 0X65, 0X56, 0X69, 0X05, 0XCE, 0X5C,
+  0X51, 0XB2, 0X15, 0X60, 0XEA, 0X5E, 0X5C, 0X3F, 0XBA, 0XC6, 0X01, 0X34,
+  0X41, 0X8D, 0XFF, 0X32, 0X00, 0X21, 0X6C, 0X81, 0XBF, 0X95, 0XAF, 0X20,
+  0X53, 0X20, 0X0B, 0X0B, 0XB1, 0X72, 0X74, 0XF9, 0X3C, 0X94, 0X5A, 0XCC,
+  0X00, 0XD5, 0X62, 0X9E, 0XC5, 0XD3, 0X35, 0X67, 0X47, 0X5C, 0XCE, 0XA7,
+  0X39, 0X29, 0X87, 0XC6, 0XC4, 0X0F, 0X5A, 0XA6, 0X35, 0XD5, 0X13, 0XAA,
+  0XD6, 0X18, 0XE8, 0X22, 0X6B, 0X0C, 0X0A, 0X40, 0X2B, 0XC1, 0XF8, 0X2A,
+  0XC3, 0X29, 0X0E, 0X02, 0X3F, 0X28, 0X63, 0XD5, 0X06, 0X57, 0X25, 0X78,
+  0X2D, 0X87, 0XA5, 0XB6, 0XCC, 0X10, 0X87, 0XB2, 0X4F, 0X00, 0X15, 0XED,
+  0XD2, 0XF4, 0X3C, 0X9F, 0X30, 0X8C, 0X48, 0X43, 0X7B, 0XA9, 0XE8, 0X04,
+  0X5F, 0X09, 0XBA, 0X29, 0X36, 0X6D, 0XC3, 0X9C, 0XCF, 0XB1, 0X67, 0X5F,
+  0X4E, 0X1D, 0XD7, 0XD6, 0X39, 0XC7, 0X70, 0X8A, 0X15, 0X8F, 0X5C, 0X3C,
+  0XBC, 0XF4, 0X5B, 0XFF, 0XBE, 0X6B, 0X0D, 0X86, 0XA3, 0XEF, 0XAD, 0XFE,
+  0XA0, 0XDD, 0XED, 0X50, 0X9F, 0X3F, 0X2D, 0X5A, 0X6F, 0XF6, 0X46, 0XB7,
+  0XCD, 0XBF, 0X59, 0X48, 0XE0, 0XEB, 0X3D, 0X30, 0X21, 0X25, 0XEE, 0X0D,
+  0X86, 0XCD, 0XE1, 0XDD, 0X80, 0X05, 0XB4, 0XCB, 0XEE, 0X5D, 0X67, 0X08,
+  0X08, 0X59, 0X1C, 0X93, 0X62, 0XDD, 0X21, 0X8A, 0X43, 0X18, 0X04, 0XDE,
+  0X28, 0X1C, 0X85, 0XBE, 0XF5, 0X84, 0XA9, 0XCD, 0X78, 0X51, 0X1C, 0X89,
+  0X94, 0X95, 0X11, 0XD8, 0X63, 0XB0, 0X84, 0XF5, 0X23, 0X16, 0X87, 0X12,
+  0X57, 0XF5, 0XE1, 0X54, 0X03, 0X06, 0X38, 0X60, 0X70, 0X89, 0XCC, 0XC1,
+  0X17, 0X7E, 0XD3, 0XB5, 0XBF, 0XF0, 0X98, 0X7F, 0XD7, 0X90, 0XE3, 0XA1,
+  0X85, 0XE3, 0XD9, 0XFE, 0XA2, 0X22, 0XAB, 0X05, 0X44, 0XCD, 0XB7, 0XAF,
+  0XF7, 0XAC, 0X1C, 0X97, 0X78, 0X81, 0X12, 0XDC, 0XBA, 0XB6, 0X08, 0X4F,
+  0X0E, 0X0E, 0XEA, 0X7F, 0X34, 0X8C, 0XFA, 0XF1, 0X67, 0XE3, 0X93, 0X51,
+  0X3F, 0X58, 0X84, 0X89, 0X75, 0XCB, 0X3B, 0X8D, 0XB1, 0XE3, 0X99, 0XC1,
+  0X92, 0X0A, 0X8B, 0X6A, 0XD0, 0X0C, 0X02, 0X73, 0X39, 0X8E, 0X26, 0X13,
+  0X1C, 0X68, 0X45, 0XD0, 0XBE, 0X37, 0XC3, 0X61, 0X68, 0X3E, 0X62, 0XD9,
+  0XA8, 0XF0, 0X33, 0XE8, 0X34, 0XEB, 0X04, 0X84, 0X63, 0XA4, 0X6C, 0XDD,
+  0X41, 0XD0, 0XFE, 0XDC, 0XA4, 0X98, 0X39, 0XA8, 0X61, 0X9B, 0XC4, 0XAC,
+  0XD2, 0XB4, 0X53, 0XAF, 0XDC, 0XD7, 0X24, 0X73, 0X0B, 0X17, 0X0E, 0XC4,
+  0X2D, 0X9D, 0X6E, 0X95, 0XD1, 0X71, 0X47, 0X08, 0XB1, 0XA2, 0X56, 0X43,
+  0XA8, 0X54, 0X81, 0XA2, 0X7F, 0XA6, 0X10, 0XDD, 0X5C, 0X2C, 0X44, 0X98,
+  0XD2, 0X33, 0X42, 0XD7, 0XB1, 0XB0, 0X5E, 0XAF, 0X48, 0X52, 0X8D, 0XFF,
+  0X8C, 0X21, 0X18, 0X3C, 0X9D, 0X6E, 0XA0, 0X97, 0XD8, 0X4D, 0X6E, 0X7B,
+  0X38, 0XF5, 0X17, 0X97, 0X7E, 0X44, 0X33, 0X53, 0XA8, 0XD3, 0X03, 0X5F,
+  0X01, 0XBD, 0XEF, 0X0E, 0X5E, 0X28, 0XC7, 0X7D, 0X3D, 0XE5, 0XD4, 0X48,
+  0X0B, 0X49, 0X5F, 0XC3, 0X81, 0XC3, 0XA9, 0XF9, 0X84, 0X6F, 0XB9, 0X6A,
+  0XF4, 0X35, 0X32, 0XDF, 0X96, 0X09, 0X91, 0XDB, 0XF2, 0X04, 0X2D, 0XDF,
+  0X0B, 0X7D, 0X17, 0X1B, 0XAE, 0XFF, 0XA8, 0X6B, 0X77, 0XDE, 0X93, 0XE7,
+  0X2F, 0X3C, 0X44, 0X23, 0X36, 0X8A, 0X0D, 0X83, 0X29, 0X9E, 0X7A, 0X3F,
+  0X53, 0X63, 0X8A, 0X76, 0XA5, 0X44, 0XA8, 0X8C, 0X55, 0X59, 0XAE, 0X1F,
+  0XE2, 0XB2, 0X40, 0X05, 0XC9, 0X6D, 0X02, 0X71, 0X10, 0XD1, 0X40, 0X88,
+  0X88, 0XCF, 0X8A, 0X07, 0X28, 0X08, 0X10, 0X48, 0XDC, 0X71, 0X39, 0X71,
+  0X0B, 0XB4, 0XEE, 0X61, 0X17, 0X39, 0X90, 0XFF, 0X9E, 0X4D, 0XC7, 0X35,
+  0XC7, 0X2E, 0X46, 0XE6, 0XA3, 0XE9, 0X78, 0X1F, 0X0A, 0X39, 0XE7, 0XE6,
+  0X81, 0X84, 0XF7, 0X30, 0XEA, 0XB6, 0X26, 0X31, 0X5B, 0X1C, 0X03, 0XD6,
+  0XBA, 0X68, 0X88, 0XC9, 0X90, 0X17, 0X20, 0X7A, 0X36, 0X04, 0X54, 0X8B,
+  0X22, 0X47, 0X1A, 0XB2, 0X57, 0X69, 0XF0, 0X50, 0X4C, 0XE9, 0X19, 0X4C,
+  0X28, 0X96, 0X03, 0XCB, 0X2B, 0X62, 0X81, 0X87, 0XDA, 0X39, 0X44, 0X04,
+  0X48, 0XE0, 0X93, 0XC0, 0X04, 0XC9, 0X9F, 0X30, 0X89, 0XD3, 0X0D, 0X34,
+  0X54, 0X53, 0XE5, 0X1F, 0X36, 0X74, 0X70, 0X30, 0X9E, 0XB5, 0XF7, 0X60,
+  0X55, 0X2F, 0X00, 0XF8, 0X24, 0X03, 0X5C, 0X54, 0X84, 0XC7, 0X43, 0X9C,
+  0X62, 0X70, 0XE3, 0X25, 0XC1, 0X37, 0XD8, 0X7B, 0X24, 0X53, 0X74, 0X0E,
+  0XA1, 0XF5, 0X18, 0XFD, 0XFE, 0X7B, 0X16, 0XC1, 0XE7, 0X18, 0XC1, 0X39,
+  0XAA, 0X55, 0XA4, 0XDA, 0X20, 0X66, 0X74, 0X0F, 0X38, 0XAD, 0X22, 0X3B,
+  0XF0, 0X21, 0XD4, 0XDB, 0X85, 0X3C, 0X7E, 0XDE, 0XC4, 0X63, 0XBD, 0X51,
+  0XC8, 0XE4, 0XEA, 0XC3, 0XDA, 0XFC, 0X24, 0X6A, 0XC6, 0XFD, 0X98, 0X93,
+  0X4C, 0XA6, 0X8A, 0X3F, 0XE7, 0X64, 0X9F, 0XF3, 0XA5, 0X30, 0X9A, 0XCD,
+  0X20, 0X3E, 0XCA, 0X6A, 0X18, 0X87, 0XA1, 0X43, 0XF3, 0XBF, 0XA6, 0X49,
+  0X05, 0X06, 0X31, 0XA5, 0X2F, 0X90, 0XAB, 0X75, 0XC8, 0XAD, 0XC8, 0X61,
+  0X45, 0X27, 0XFC, 0XF3, 0X05, 0X1D, 0X9F, 0XB2, 0X5F, 0X0E, 0X9C, 0XA2,
+  0X2E, 0XDB, 0X36, 0X47, 0X06, 0X72, 0X8A, 0XA8, 0XC3, 0X0E, 0XFD, 0X6B,
+  0XFC, 0X2B, 0XA6, 0X79, 0XEF, 0X3C, 0XA8, 0X16, 0X59, 0X02, 0X76, 0X0C,
+  0X38, 0X13, 0XD0, 0X55, 0XC2, 0X52, 0X1A, 0XA8, 0X63, 0XC0, 0X7A, 0XE3,
+  0X01, 0XFD, 0X0B, 0X69, 0XB7, 0X2C, 0X35, 0X4B, 0XDF, 0X40, 0X31, 0X3E,
+  0X99, 0XE2, 0X00, 0XB5, 0X9A, 0XBD, 0XEE, 0XCD, 0XFE, 0X37, 0XBC, 0X94,
+  0X4E, 0X16, 0X00, 0X83, 0X22, 0X8E, 0XB7, 0X93, 0X90, 0X22, 0X76, 0X1B,
+  0X3C, 0X53, 0X54, 0X51, 0XF2, 0X1B, 0X4C, 0XA6, 0X3B, 0X99, 0X80, 0X2B,
+  0XD0, 0X73, 0X1E, 0X2A, 0X01, 0X7E, 0XA3, 0XAE, 0XA6, 0XB1, 0XEC, 0X55,
+  0X6D, 0X51, 0X1B, 0XFA, 0X62, 0XF9, 0X36, 0X3E, 0XA7, 0X7C, 0X0B, 0X79,
+  0X81, 0X29, 0XEC, 0XF3, 0X12, 0X83, 0X8A, 0X05, 0X00, 0X0E, 0X18, 0X04,
+  0XFB, 0X14, 0X1F, 0X3C, 0XB1, 0X28, 0X76, 0X04, 0XFA, 0XCB, 0XBE, 0X98,
+  0X55, 0XBE, 0X8C, 0X83, 0X73, 0X4D, 0XD1, 0XBB, 0X92, 0X30, 0X58, 0X02,
+  0XBC, 0X60, 0XC7, 0X92, 0X75, 0X2E, 0X6A, 0X77, 0XEA, 0XC6, 0X54, 0XA2,
+  0X73, 0X33, 0X08, 0X31, 0X88, 0X23, 0X1B, 0X6A, 0XA5, 0XDD, 0X22, 0XBF,
+  0X55, 0X4E, 0XB3, 0X38, 0X44, 0X62, 0XDC, 0X0A, 0X45, 0XBD, 0X18, 0X85,
+  0XC5, 0X9B, 0X96, 0X51, 0XE8, 0XFC, 0XB7, 0X10, 0X55, 0XFD, 0XB8, 0X00,
+  0X57, 0X63, 0X2D, 0XAE, 0X7C, 0XAA, 0X56, 0X36, 0X7F, 0X12, 0X1B, 0X95,
+  0X20, 0X2A, 0X0B, 0XE5, 0X8C, 0X0A, 0X5A, 0X91, 0X12, 0X08, 0XFC, 0X54,
+  0X3E, 0XB3, 0X0C, 0XC1, 0X64, 0X20, 0X03, 0X30, 0X87, 0X64, 0XE7, 0X91,
+  0XC1, 0XE4, 0X73, 0X56, 0X14, 0X67, 0XA3, 0XC1, 0X1B, 0XEC, 0XA2, 0XD5,
+  0XEF, 0X77, 0XFB, 0X27, 0X48, 0XD4, 0X9D, 0X4C, 0X0E, 0X62, 0X2F, 0X03,
+  0XC2, 0X86, 0X30, 0XE4, 0XA9, 0X63, 0XE3, 0XA6, 0XEB, 0X0E, 0X30, 0XD3,
+  0X78, 0X12, 0XB6, 0X45, 0XBD, 0X21, 0XB3, 0XAD, 0XB6, 0X38, 0X80, 0X2E,
+  0XD3, 0X8C, 0X1B, 0XBC, 0X11, 0XFF, 0X90, 0X4D, 0XC2, 0X1C, 0X0C, 0XBA,
+  0XC9, 0X89, 0XF3, 0XA8, 0X67, 0X72, 0X6C, 0X26, 0XBF, 0X16, 0XA3, 0X15,
+  0X5D, 0X7D, 0X0E, 0X71, 0X9F, 0X7B, 0X47, 0X16, 0X27, 0X04, 0XE9, 0X4C,
+  0X8E, 0XE2, 0X49, 0X2A, 0X5B, 0X37, 0XE5, 0X94, 0XD6, 0X83, 0XE4, 0XA9,
+  0X15, 0X14, 0X01, 0X52, 0XFA, 0X4A, 0XD2, 0X5B, 0X55, 0XED, 0XD3, 0X33,
+  0XBB, 0X56, 0X3B, 0X1F, 0X32, 0X19, 0X57, 0XE4, 0X4F, 0XC9, 0X7A, 0X6C,
+  0X5D, 0X8B, 0X21, 0X20, 0X6B, 0X48, 0XA6, 0X52, 0X2D, 0X32, 0X88, 0XEC,
+  0XC7, 0X57, 0X08, 0X3D, 0X9E, 0X98, 0X94, 0XB2, 0X23, 0X00, 0XDE, 0X9D,
+  0X9B, 0XC2, 0XF2, 0X6A, 0XC7, 0X66, 0XAB, 0XC5, 0X7A, 0X3B, 0XDA, 0X6B,
+  0XD1, 0X5A, 0X48, 0XB2, 0XFA, 0X28, 0XFC, 0X0D, 0XC5, 0X95, 0X99, 0XE2,
+  0X05, 0X2B, 0X39, 0XEA, 0X49, 0X35, 0X8C, 0X14, 0XE7, 0XFC, 0X3E, 0XFE,
+  0X8F, 0X08, 0X05, 0X7F, 0XDF, 0XDE, 0X5C, 0X13, 0X32, 0X87, 0X0F, 0X11,
+  0X0E, 0X49, 0X6C, 0X7F, 0X14, 0X60, 0X8B, 0X16, 0X58, 0X0A, 0X1E, 0X00,
+  0XC6, 0X36, 0X05, 0X38, 0X9C, 0X83, 0X21, 0X4A, 0XCD, 0X2D, 0XD8, 0X70,
+  0X41, 0XB8, 0X2D, 0XAC, 0XE3, 0X65, 0XB8, 0X92, 0X92, 0X52, 0X70, 0XB6,
+  0XB6, 0XE5, 0X55, 0X3C, 0X41, 0X9C, 0X0C, 0XB1, 0X1D, 0XB2, 0X4B, 0XBC,
+  0XAE, 0XEB, 0X05, 0X0D, 0X5B, 0X53, 0XD4, 0X1A, 0XF4, 0X0E, 0X1B, 0X06,
+  0XBA, 0X9C, 0X62, 0X5A, 0XAB, 0X4E, 0X4D, 0X82, 0X96, 0X7E, 0XC4, 0X66,
+  0X32, 0X40, 0XDB, 0X63, 0XA3, 0X31, 0X5A, 0XC2, 0XCE, 0X4C, 0X0F, 0X52,
+  0X14, 0XC5, 0X8C, 0X9A, 0X3D, 0X03, 0XFD, 0X00, 0X98, 0X99, 0XF3, 0X38,
+  0X25, 0X54, 0X2D, 0XC8, 0X76, 0XC2, 0X14, 0XD8, 0X8E, 0X82, 0X54, 0XBF,
+  0XB1, 0X26, 0X0B, 0X8B, 0X50, 0X55, 0X0E, 0XE9, 0X30, 0X6C, 0X7B, 0X49,
+  0X88, 0X3D, 0XB2, 0X2C, 0X64, 0X2A, 0X08, 0XE5, 0XE9, 0X40, 0XA5, 0XAB,
+  0X6B, 0X5F, 0X5B, 0XD4, 0X45, 0XB4, 0X29, 0X98, 0X4B, 0XA6, 0XEB, 0XE4,
+  0XF6, 0XA8, 0X89, 0X12, 0X4E, 0XDA, 0X18, 0X5B, 0X43, 0X79, 0XE3, 0XC9,
+  0XC0, 0X42, 0XEC, 0XD9, 0X7A, 0X45, 0X4D, 0XD7, 0XD9, 0X58, 0XFE, 0XA2,
+  0XD4, 0X5C, 0X21, 0X16, 0X6D, 0XF8, 0XA4, 0X48, 0X8F, 0XE1, 0XC5, 0X72,
+  0X68, 0X3E, 0X76, 0XA0, 0X64, 0XD6, 0X35, 0X01, 0XA9, 0X55, 0XA4, 0XCA,
+  0X55, 0X7C, 0X33, 0X42, 0XB2, 0X04, 0XE1, 0X80, 0X22, 0XE6, 0XAE, 0X49,
+  0X7B, 0X7C, 0XCD, 0X03, 0XCB, 0XD2, 0XCA, 0X2A, 0XF6, 0X24, 0X46, 0XBF,
+  0XAC, 0XCB, 0X36, 0X9B, 0X0A, 0X20, 0XB0, 0XAB, 0X1C, 0XD9, 0XB1, 0X0B,
+  0XD1, 0X5D, 0X2D, 0X57, 0X58, 0XAA, 0XEC, 0X05, 0XFE, 0X23, 0X88, 0X30,
+  0X39, 0X3D, 0XB8, 0X92, 0X32, 0XEC, 0X84, 0X82, 0X5D, 0X1D, 0X8A, 0X4A,
+  0X67, 0XDC, 0XD1, 0XBC, 0X7B, 0X2E, 0XA6, 0XB1, 0X33, 0XC0, 0XC2, 0X26,
+  0X73, 0XE6, 0XAB, 0XED, 0XE2, 0X39, 0XA5, 0X27, 0X4C, 0X0C, 0X13, 0XC8,
+  0X05, 0X6D, 0X91, 0X71, 0X74, 0X79, 0XF6, 0X5B, 0XD9, 0XA9, 0XF2, 0X9F,
+  0X0B, 0X09, 0X65, 0X8F, 0X33, 0X9C, 0XD2, 0X1E, 0X91, 0X47, 0X4B, 0XF8,
+  0X9F, 0XEF, 0X3D, 0XFA, 0XD4, 0XBF, 0X20, 0X5A, 0X1A, 0X48, 0X1C, 0X95,
+  0X37, 0XA3, 0X84, 0X02, 0X8E, 0X03, 0X7F, 0X11, 0X42, 0X0C, 0XE3, 0X73,
+  0X1A, 0X36, 0X38, 0X4D, 0XBD, 0X13, 0X7A, 0X2F, 0X7F, 0X06, 0X70, 0X18,
+  0XDD, 0X4A, 0XF2, 0XB0, 0X2C, 0XA0, 0X8A, 0X7A, 0X80, 0X95, 0X18, 0X68,
+  0XE8, 0X43, 0X08, 0XF6, 0XE7, 0X0C, 0X88, 0X13, 0XAD, 0X82, 0X24, 0X69,
+  0X7D, 0X0C, 0X61, 0X01, 0X5A, 0X09, 0XDF, 0X0C, 0XEC, 0XD8, 0XA9, 0X65,
+  0X05, 0XEE, 0XED, 0XE5, 0X8C, 0X4C, 0XAD, 0X30, 0X5E, 0X36, 0X48, 0X01,
+  0X9B, 0XF6, 0X72, 0X93, 0XB8, 0X03, 0X3C, 0X01, 0X5E, 0XA6, 0XCD, 0X79,
+  0X62, 0XA2, 0XD2, 0X98, 0X19, 0XDC, 0X03, 0XCA, 0X66, 0X30, 0X5F, 0XE3,
+  0X27, 0XF5, 0X5F, 0X39, 0X88, 0XC4, 0X1B, 0X07, 0X02, 0X22, 0X9E, 0X40,
+  0X66, 0XBD, 0X82, 0X27, 0XD1, 0X50, 0X94, 0X12, 0X3B, 0X67, 0XD0, 0XB5,
+  0XCE, 0XA4, 0X9A, 0X89, 0X64, 0X1E, 0X3B, 0X8C, 0XF1, 0XE9, 0X3C, 0XB8,
+  0XE0, 0X2E, 0X60, 0X5B, 0X3C, 0X6B, 0X65, 0XBB, 0X61, 0XFB, 0XFE, 0X0C,
+  0X13, 0X33, 0XC3, 0X8B, 0X28, 0X6B, 0X69, 0X37, 0XC3, 0X7B, 0X14, 0X66,
+  0X14, 0X22, 0X3E, 0XAE, 0XA9, 0X74, 0X29, 0X48, 0X6C, 0X43, 0X6A, 0X45,
+  0X9B, 0X1D, 0XA4, 0X49, 0X45, 0X50, 0X32, 0X5C, 0X2A, 0XBA, 0X11, 0X52,
+  0XF2, 0X70, 0XCC, 0X41, 0X01, 0XA0, 0XB6, 0X6D, 0XC9, 0X55, 0X48, 0XAD,
+  0X64, 0XAC, 0X55, 0X44, 0X2F, 0X01, 0XCD, 0X50, 0X94, 0XED, 0X95, 0X0B,
+  0XB6, 0XD8, 0X5C, 0XE9, 0X4A, 0XD2, 0XDA, 0XEB, 0XAA, 0X9D, 0X55, 0X8B,
+  0XBB, 0X8D, 0X64, 0XA6, 0XFE, 0XCA, 0XD3, 0XF1, 0XBB, 0XB2, 0XCD, 0X92,
+  0XA4, 0X60, 0X6F, 0X38, 0X55, 0X6F, 0XF6, 0XE4, 0XD8, 0XFF, 0X9F, 0X13,
+  0XD1, 0X7B, 0XBE, 0X8D, 0XE7, 0X01, 0X20, 0X6D, 0XF7, 0XD2, 0X37, 0XC6,
+  0X74, 0XD7, 0XF9, 0XD6, 0XE9, 0XFE, 0XD5, 0XD9, 0X72, 0XC6, 0X53, 0XE2,
+  0X49, 0X7B, 0X67, 0X28, 0XEE, 0X2F, 0XF3, 0XCD, 0XBE, 0X1C, 0XF3, 0XD0,
+  0X86, 0X20, 0X6A, 0XCE, 0XF7, 0X5D, 0X27, 0XCC, 0X86, 0X0C, 0XED, 0X46,
+  0X94, 0XDC, 0X3A, 0XCB, 0X10, 0X33, 0XF0, 0X7D, 0X02, 0X56, 0X85, 0X4C,
+  0XB4, 0X98, 0X3A, 0X2E, 0XAE, 0X18, 0X86, 0X21, 0X8D, 0X4F, 0XDE, 0XA3,
+  0XA0, 0XDE, 0X95, 0XC1, 0X2F, 0X64, 0X7A, 0X0E, 0XFE, 0X79, 0XF5, 0XE5,
+  0X00, 0XFE, 0X43, 0X7F, 0X5C, 0X28, 0XBF, 0XFA, 0XF0, 0X8B, 0XFD, 0X90,
+  0X14, 0XF5, 0X4E, 0X35, 0X3B, 0X1B, 0X8F, 0X2D, 0X09, 0X66, 0X13, 0X84,
+  0XB5, 0X23, 0X85, 0X8C, 0X29, 0X42, 0XF5, 0X86, 0X50, 0X76, 0X66, 0X96,
+  0X60, 0X92, 0X46, 0X91, 0XE9, 0X18, 0XED, 0X53, 0XAD, 0XA8, 0XD7, 0X65,
+  0X57, 0X0F, 0X41, 0XF9, 0X4D, 0XDF, 0X47, 0X12, 0X7C, 0X2C, 0XE8, 0X7E,
+  0X49, 0X00, 0XA5, 0X26, 0XBD, 0XCA, 0X0D, 0X9C, 0X71, 0X44, 0XC0, 0XEF,
+  0X1C, 0X1B, 0XFC, 0XCD, 0X41, 0X07, 0X94, 0XCC, 0X16, 0XE0, 0XBE, 0X77,
+  0XE9, 0X3A, 0X10, 0XFC, 0XA1, 0X0A, 0XE6, 0X37, 0XE0, 0XCD, 0X39, 0X33,
+  0X8F, 0X4A, 0X51, 0XAB, 0XCD, 0X78, 0XB4, 0X47, 0X62, 0X8C, 0X58, 0XCA,
+  0XA8, 0XFD, 0XB1, 0X7C, 0XAF, 0X98, 0XCA, 0XBD, 0X6A, 0XEF, 0XF8, 0X55,
+  0X84, 0X05, 0XC3, 0X8A, 0XA5, 0X51, 0XF5, 0X0E, 0XF1, 0X2F, 0X72, 0X85,
+  0XE9, 0XF4, 0X2D, 0XD0, 0XB5, 0X88, 0X4C, 0XF6, 0X3F, 0X83, 0X39, 0XDA,
+  0XEC, 0X83, 0X9E, 0X2A, 0X30, 0X8C, 0XC6, 0X4C, 0XF9, 0X3A, 0XD5, 0X5C,
+  0XAD, 0XCA, 0X14, 0X78, 0XD8, 0XA8, 0X14, 0X8B, 0X56, 0XBE, 0X18, 0X14,
+  0X64, 0X0B, 0X00, 0XE3, 0X82, 0XFF, 0X27, 0X37, 0X98, 0X9F, 0X7C, 0XC8,
+  0XFA, 0X73, 0X6F, 0XAF, 0X92, 0XB7, 0X0A, 0X71, 0X80, 0X71, 0XE6, 0X04,
+  0XEA, 0X3C, 0X35, 0XE1, 0XF6, 0X9E, 0X71, 0X77, 0X08, 0X7F, 0XFD, 0X7C,
+  0X60, 0X63, 0XE7, 0X13, 0X2D, 0X4F, 0X7E, 0XB5, 0X05, 0XE7, 0XE3, 0X12,
+  0XD6, 0X85, 0X02, 0X15, 0X59, 0X66, 0XA8, 0XFF, 0XF1, 0X80, 0XF6, 0X51,
+  0XE3, 0XE8, 0X68, 0X1B, 0X01, 0X51, 0X5C, 0X05, 0X54, 0XB6, 0X08, 0X1B,
+  0X0A, 0XA2, 0XA0, 0X74, 0XBE, 0XB3, 0X73, 0X9F, 0XBD, 0X6B, 0XC4, 0X62,
+  0XD5, 0X8D, 0X76, 0XBA, 0X73, 0X7B, 0X19, 0XA3, 0X7B, 0XCF, 0XFE, 0X32,
+  0XF1, 0X5F, 0XEC, 0X96, 0X35, 0XCC, 0XD8, 0X35, 0X98, 0X5E, 0XA5, 0XA8,
+  0X88, 0XF4, 0XFC, 0XCB, 0X17, 0X38, 0XA3, 0XE5, 0X46, 0X36, 0X0E, 0X29,
+  0XAA, 0X6C, 0XB0, 0X2A, 0X7C, 0X28, 0X53, 0X80, 0X63, 0XE2, 0XB8, 0X50,
+  0XE4, 0XEA, 0X0E, 0XC1, 0X33, 0X74, 0X76, 0X8E, 0XD8, 0XBF, 0XBF, 0X9D,
+  0X9D, 0X21, 0X9C, 0X1D, 0XC7, 0X01, 0X53, 0X96, 0X6B, 0X86, 0XE1, 0X0D,
+  0X08, 0X04, 0X8E, 0X3F, 0XF3, 0X9F, 0X59, 0X11, 0XCF, 0X11, 0XCA, 0X61,
+  0X68, 0X05, 0XA0, 0X90, 0XE9, 0X37, 0XB1, 0XC3, 0XDF, 0X61, 0XAC, 0X27,
+  0X63, 0XDA, 0X76, 0X09, 0X0D, 0X25, 0XE7, 0X46, 0X1E, 0X2F, 0X2B, 0XF4,
+  0XF4, 0XB9, 0X0A, 0X9D, 0X5F, 0X66, 0X49, 0XD2, 0X19, 0XE6, 0X7E, 0X3D,
+  0XE9, 0X68, 0X0B, 0X45, 0XEA, 0XF2, 0X0B, 0X29, 0XFA, 0X22, 0XA5, 0X56,
+  0X3A, 0XCF, 0XE8, 0XF8, 0XD0, 0X96, 0X26, 0X47, 0X32, 0X44, 0X51, 0X83,
+  0X68, 0XE5, 0X0C, 0X45, 0X76, 0X40, 0XBF, 0XBD, 0X61, 0XDE, 0XB3, 0X0D,
+  0XF6, 0X75, 0X37, 0XF7, 0XAF, 0X1C, 0X0F, 0X94, 0XDD, 0X65, 0X69, 0XDA,
+  0XDB, 0XEE, 0X57, 0XB6, 0XC7, 0XB0, 0XAE, 0XE7, 0X89, 0X5F, 0X21, 0XE5,
+  0X0B, 0X09, 0X9A, 0X24, 0X9A, 0XE9, 0X17, 0X3D, 0XBE, 0X4A, 0X10, 0XC0,
+  0X51, 0X52, 0X1E, 0X6C, 0X53, 0X2F, 0XC0, 0XA6, 0X74, 0XC3, 0X7D, 0XED,
+  0X41, 0XBE, 0XFD, 0XC8, 0X59, 0X8B, 0X91, 0X04, 0X5F, 0X75, 0X5B, 0X5D,
+  0XD9, 0XB6, 0XE9, 0XBD, 0X16, 0XAD, 0X25, 0XE1, 0XE4, 0XD0, 0X66, 0X26,
+  0X11, 0X46, 0X45, 0XD7, 0XD8, 0X09, 0X5D, 0XF2, 0XFC, 0XAB, 0X1C, 0XE1,
+  0XE1, 0X6E, 0XFC, 0XC5, 0X43, 0XBB, 0X2C, 0XC6, 0XAD, 0XCA, 0X4F, 0X80,
+  0X93, 0X22, 0X6D, 0XAF, 0X3B, 0X28, 0X0B, 0XB5, 0X60, 0X03, 0XFB, 0X9C,
+  0XA2, 0X1A, 0X6D, 0X63, 0X04, 0X2C, 0X92, 0XAA, 0X0A, 0X8B, 0XD7, 0X05,
+  0XA3, 0X01, 0XA7, 0X3C, 0XA2, 0X8F, 0X7F, 0X70, 0X30, 0X22, 0X90, 0XC1,
+  0X5D, 0XD7, 0X5F, 0X60, 0X1B, 0X72, 0X1F, 0XF5, 0XA8, 0XF6, 0X55, 0X98,
+  0X94, 0XCD, 0X0E, 0X7B, 0X4A, 0XC7, 0X6B, 0X07, 0X3A, 0X65, 0X29, 0X08,
+  0X05, 0X15, 0X63, 0X66, 0XD2, 0X20, 0X4D, 0XA3, 0X62, 0X22, 0X2C, 0X1E,
+  0X99, 0X2B, 0XE2, 0XB1, 0X47, 0XFA, 0XB0, 0X51, 0X7D, 0X29, 0X24, 0XDF,
+  0X82, 0XAD, 0XB5, 0XD5, 0X23, 0X7A, 0XB5, 0X6A, 0XC7, 0X51, 0X47, 0XDA,
+  0XB6, 0X9B, 0XD5, 0X66, 0X4D, 0XB6, 0XF8, 0X79, 0X53, 0X0E, 0XF6, 0XCD,
+  0X76, 0XFA, 0XBE, 0X46, 0XFA, 0XCE, 0X16, 0X2A, 0XA1, 0XFB, 0X44, 0XD1,
+  0XA5, 0X72, 0XCE, 0XAE, 0XD3, 0X5A, 0X5B, 0X87, 0XE5, 0X2A, 0X3A, 0X2A,
+  0XBA, 0X86, 0X14, 0XF1, 0X57, 0X98, 0XD7, 0X09, 0X98, 0X67, 0XBA, 0X35,
+  0XB6, 0XC2, 0X1D, 0X5A, 0XB1, 0XD7, 0X3A, 0X42, 0X99, 0X17, 0X70, 0X27,
+  0XC8, 0X4D, 0XEB, 0X73, 0X6F, 0X56, 0XDF, 0X28, 0XCE, 0XFC, 0X5B, 0X57,
+  0X4E, 0X58, 0X9E, 0XA0, 0XB2, 0X0A, 0X83, 0X24, 0X53, 0X33, 0X65, 0X92,
+  0X5C, 0X2D, 0X7E, 0X67, 0X5B, 0XC9, 0X74, 0XCF, 0XBC, 0XED, 0X61, 0XB9,
+  0X7C, 0XED, 0X7C, 0XAE, 0XEC, 0X4E, 0X74, 0X57, 0X45, 0X5C, 0XB7, 0X9A,
+  0X57, 0X65, 0X8A, 0XA0, 0XCC, 0X94, 0XE9, 0X40, 0XE5, 0X5B, 0XAA, 0XF2,
+  0XD9, 0X7F, 0X05, 0XEF, 0X3C, 0X37, 0X23, 0X5D, 0XAB, 0XD5, 0XE8, 0XAD,
+  0X33, 0X5B, 0X32, 0X88, 0X3F, 0X20, 0XF4, 0XCA, 0X45, 0XAF, 0X1F, 0X27,
+  0X81, 0X64, 0XBF, 0X91, 0XC1, 0X37, 0XB7, 0XA1, 0X63, 0XE2, 0X27, 0X8B,
+  0X02, 0XFA, 0XD8, 0XE8, 0X4F, 0X07, 0XBB, 0X36, 0X2B, 0XF4, 0X36, 0X0D,
+  0X15, 0XCA, 0X5E, 0X01, 0XA7, 0XD3, 0X48, 0XE5, 0X45, 0XB1, 0X32, 0XD7,
+  0X93, 0XE3, 0X1C, 0X57, 0X7E, 0XE5, 0X8D, 0XD3, 0X3D, 0XF5, 0X6E, 0X98,
+  0X43, 0XD0, 0X8F, 0XFC, 0X60, 0XFC, 0X7E, 0XE4, 0X9F, 0X98, 0XF2, 0X29,
+  0X74, 0X13, 0X98, 0XF5, 0X94, 0X77, 0X74, 0X0C, 0X10, 0XE8, 0X71, 0XED,
+  0X34, 0X53, 0XE5, 0XAA, 0XC2, 0XD5, 0XEF, 0XB5, 0XAB, 0X56, 0XF3, 0X6E,
+  0X78, 0X3D, 0XEA, 0X77, 0XBF, 0XDE, 0XB5, 0X20, 0X3D, 0X20, 0X5D, 0X08,
+  0XA1, 0X42, 0XAD, 0X4E, 0X2C, 0X5E, 0XF4, 0XBB, 0XCD, 0XAB, 0XCB, 0XE6,
+  0X60, 0X88, 0XF4, 0XE6, 0XE5, 0X30, 0X5E, 0XBC, 0X6C, 0XF6, 0X86, 0X77,
+  0XFD, 0XD6, 0XA8, 0XDB, 0XB9, 0XF9, 0X21, 0X6D, 0X7B, 0X78, 0XF7, 0XB9,
+  0XA1, 0XAA, 0X23, 0XBA, 0XFE, 0XDE, 0X72, 0X3A, 0X7A, 0XDF, 0XC1, 0XA0,
+  0XC2, 0X30, 0XAC, 0XBE, 0X37, 0XBB, 0XF5, 0XC6, 0X3F, 0XA9, 0X57, 0XB1,
+  0X78, 0XD9, 0XBD, 0XBD, 0X68, 0X77, 0X60, 0XEF, 0XCD, 0XCD, 0X26, 0X9D,
+  0X16, 0XCE, 0X34, 0X0B, 0X5F, 0X4A, 0X4A, 0X23, 0XFB, 0X35, 0X7E, 0XB5,
+  0X52, 0XFB, 0XD1, 0XCC, 0XD9, 0X4C, 0XF9, 0X17, 0XCF, 0X72, 0X3B, 0XC6,
+  0X1C, 0XDE, 0X1D, 0X4A, 0XE3, 0X2B, 0X28, 0XE8, 0X69, 0X10, 0X4B, 0X5A,
+  0XB8, 0X3C, 0X89, 0XFC, 0XFB, 0X73, 0X8E, 0XAD, 0X8A, 0X1C, 0XCF, 0XC6,
+  0XBF, 0XA4, 0X30, 0X44, 0X67, 0X32, 0XFE, 0X9C, 0XB1, 0X5E, 0XFE, 0XDE,
+  0X9E, 0X03, 0XC8, 0X22, 0XE0, 0X5F, 0X12, 0X15, 0X33, 0XAC, 0XB9, 0X55,
+  0X82, 0X7F, 0XD1, 0X54, 0XC9, 0X49, 0XE7, 0X56, 0XE3, 0X1A, 0X31, 0XF7,
+  0X8A, 0X7E, 0X6B, 0XC1, 0XC8, 0XF3, 0X10, 0X8E, 0X34, 0XBE, 0X74, 0X64,
+  0XF1, 0XFF, 0X7F, 0XB5, 0XB1, 0X69, 0XEE, 0X9D, 0X33, 0X00, 0X00
+};
+static const unsigned char asset_index_html[] = {
+  0X1F, 0X8B, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0XC5, 0X56,
+  0X51, 0X6F, 0X22, 0X37, 0X10, 0X7E, 0XCF, 0XAF, 0X98, 0XEE, 0XCB, 0X81,
+  0X14, 0X58, 0X20, 0X17, 0XA9, 0X4D, 0X76, 0X91, 0X28, 0X49, 0XD5, 0X53,
+  0X73, 0X4D, 0X14, 0X68, 0XAB, 0X7B, 0X8A, 0XCC, 0XEE, 0XB0, 0XEB, 0XC6,
+  0X6B, 0XBB, 0XB6, 0X37, 0X1C, 0XAD, 0XFA, 0XDF, 0X3B, 0X5E, 0X2F, 0X14,
+  0X2E, 0X84, 0X5C, 0XD4, 0X87, 0XF2, 0X00, 0X78, 0X3C, 0X1E, 0XFB, 0XFB,
+  0X3C, 0XFE, 0X66, 0X4E, 0X92, 0X6F, 0XAE, 0X6E, 0XA7, 0XF3, 0X4F, 0X77,
+  0XD7, 0X50, 0XBA, 0X4A, 0X8C, 0X4F, 0X92, 0XCD, 0X0F, 0XB2, 0X7C, 0X7C,
+  0X02, 0XF4, 0X49, 0X2A, 0X74, 0X0C, 0XB2, 0X92, 0X19, 0X8B, 0X2E, 0X8D,
+  0X6A, 0XB7, 0XEC, 0X7D, 0X1B, 0XB5, 0X53, 0X8E, 0X3B, 0X81, 0XE3, 0XEB,
+  0XD9, 0XDD, 0XD9, 0X68, 0X7A, 0X0E, 0XBF, 0XBD, 0XBF, 0XBF, 0X1F, 0X0E,
+  0XEE, 0XE1, 0X69, 0XD8, 0X1F, 0X98, 0X24, 0X0E, 0X93, 0X3B, 0X31, 0X24,
+  0XAB, 0X30, 0X8D, 0X9E, 0X38, 0XAE, 0XB4, 0X32, 0X2E, 0X82, 0X4C, 0X49,
+  0X87, 0X92, 0X62, 0XAE, 0X78, 0XEE, 0XCA, 0X34, 0XC7, 0X27, 0X9E, 0X61,
+  0XAF, 0X19, 0X9C, 0X02, 0X97, 0XDC, 0X71, 0X26, 0X7A, 0X36, 0X63, 0X02,
+  0XD3, 0XE1, 0X66, 0X47, 0XC1, 0XE5, 0X23, 0X18, 0X14, 0X69, 0X64, 0XDD,
+  0X5A, 0XA0, 0X2D, 0X11, 0X29, 0X52, 0X69, 0X70, 0XD9, 0X5A, 0XFA, 0X99,
+  0XB5, 0XE4, 0X9C, 0XC4, 0X01, 0X41, 0XB2, 0X50, 0XF9, 0X1A, 0X94, 0X14,
+  0X8A, 0XE5, 0X69, 0XA4, 0X34, 0XCA, 0X99, 0X63, 0XAE, 0XB6, 0X33, 0X95,
+  0X3D, 0XA2, 0XEB, 0X74, 0X37, 0X71, 0X79, 0X55, 0X80, 0X35, 0X59, 0X1A,
+  0X09, 0X55, 0XA8, 0XBE, 0X96, 0X45, 0X04, 0X4C, 0XD0, 0XD1, 0X1A, 0X6C,
+  0X70, 0X43, 0X46, 0X3A, 0XAF, 0X60, 0XD6, 0XA6, 0X91, 0X0F, 0X8C, 0XA6,
+  0XC7, 0X2B, 0X56, 0XE0, 0X66, 0X79, 0X39, 0XDC, 0XB0, 0XF0, 0XD0, 0XB2,
+  0X40, 0X07, 0X18, 0XB6, 0X93, 0X1A, 0X9A, 0X93, 0XA5, 0X51, 0XC5, 0X4C,
+  0XC1, 0X65, 0XCF, 0X29, 0X7D, 0X01, 0XBD, 0XE1, 0X40, 0X7F, 0XBE, 0X84,
+  0X25, 0X71, 0XD0, 0XB3, 0XFC, 0X4F, 0XBC, 0X80, 0X41, 0XFF, 0X3B, 0XAC,
+  0X2E, 0X89, 0X15, 0XA1, 0XCC, 0X05, 0X98, 0X62, 0XD1, 0X19, 0XBD, 0X3F,
+  0X3B, 0X85, 0XE1, 0X80, 0XBE, 0XCE, 0XBA, 0X97, 0XD1, 0XF8, 0X86, 0X2D,
+  0X94, 0X60, 0X4E, 0X19, 0X5E, 0X57, 0X70, 0X9D, 0X13, 0X3F, 0X4A, 0X36,
+  0X64, 0X27, 0XB1, 0X6E, 0XB7, 0XB2, 0X98, 0X35, 0X56, 0X4E, 0X60, 0XD1,
+  0X18, 0X65, 0X88, 0X8B, 0X24, 0X6E, 0XAD, 0X07, 0X7C, 0X3C, 0X2D, 0X9C,
+  0XC0, 0X8E, 0X6F, 0XC2, 0X9F, 0X7E, 0XBF, 0X0F, 0X77, 0X02, 0X99, 0X45,
+  0X58, 0X31, 0XEE, 0X8E, 0X2D, 0X35, 0X44, 0XC3, 0X3A, 0XDA, 0X40, 0XCB,
+  0XB9, 0XD5, 0X82, 0XAD, 0X2F, 0X40, 0X2A, 0X89, 0X97, 0X2D, 0X2D, 0X81,
+  0X9A, 0XD1, 0X38, 0X26, 0X4E, 0X28, 0X2C, 0X93, 0X31, 0XB1, 0X32, 0XDA,
+  0X99, 0X5B, 0X2A, 0X53, 0XD1, 0XE5, 0XD8, 0X7A, 0X51, 0X71, 0X22, 0XDB,
+  0XD4, 0X72, 0XE2, 0X1C, 0XCB, 0X1E, 0X3B, 0XDD, 0X4B, 0XBA, 0X64, 0X57,
+  0X1B, 0X09, 0X4B, 0X26, 0XEC, 0X5E, 0XC0, 0XB0, 0X90, 0XA3, 0XC8, 0X29,
+  0X1F, 0XF7, 0XCD, 0X21, 0X43, 0XB0, 0X40, 0X99, 0X8F, 0X67, 0X28, 0XE8,
+  0XB0, 0XE0, 0X88, 0X72, 0X24, 0X1C, 0XAD, 0XF5, 0XB9, 0XBB, 0X63, 0X0B,
+  0X81, 0X0D, 0X20, 0XA6, 0X7B, 0X82, 0X5B, 0XE7, 0X09, 0X6B, 0X8C, 0X07,
+  0X9C, 0XF5, 0X38, 0X59, 0XD4, 0XCE, 0X11, 0X03, 0X6E, 0XAD, 0X09, 0X75,
+  0X18, 0X44, 0X04, 0X21, 0X13, 0X3C, 0X7B, 0XF4, 0XA4, 0X2C, 0X0D, 0X25,
+  0XE5, 0X44, 0X5B, 0X9F, 0X5A, 0XF7, 0X61, 0X94, 0XC4, 0XC1, 0X6F, 0XBC,
+  0XBD, 0XA7, 0X6D, 0XC0, 0XF8, 0X30, 0X90, 0XAF, 0XC0, 0X17, 0X88, 0XF2,
+  0X6F, 0X68, 0XC9, 0X8B, 0XDA, 0X30, 0X7F, 0X2F, 0X47, 0X60, 0XEA, 0XE7,
+  0XB6, 0X10, 0X8D, 0X2D, 0X50, 0X50, 0X16, 0X1A, 0XC2, 0XDF, 0X44, 0X7C,
+  0XF0, 0XC8, 0XA2, 0X4D, 0X78, 0X3F, 0XB8, 0XA0, 0XB0, 0XDE, 0XEB, 0X85,
+  0X08, 0X36, 0X10, 0XDD, 0X30, 0XB8, 0X13, 0XC1, 0X73, 0X52, 0X32, 0X59,
+  0X10, 0X4B, 0XB5, 0XCE, 0X99, 0XC3, 0XE9, 0XE6, 0XA4, 0X44, 0XED, 0X0F,
+  0X0D, 0XBC, 0X8E, 0X2B, 0XB9, 0XED, 0X46, 0X74, 0XD3, 0X7F, 0XD4, 0XDC,
+  0X60, 0X7E, 0X78, 0X83, 0X66, 0X13, 0XA5, 0X43, 0XB2, 0X33, 0X51, 0X53,
+  0XC0, 0X33, 0X4A, 0XBB, 0X66, 0X57, 0X5A, 0X33, 0X99, 0XCF, 0X27, 0XD3,
+  0X9F, 0X1E, 0XBC, 0X84, 0X3D, 0X5C, 0XDD, 0XCE, 0X92, 0X38, 0XB8, 0XBE,
+  0X70, 0XD8, 0X38, 0XAC, 0X3B, 0X40, 0X50, 0XAC, 0XFF, 0X13, 0X6B, 0X24,
+  0X70, 0XA5, 0XCA, 0XB7, 0XBC, 0X85, 0XE1, 0X9B, 0X99, 0X6B, 0XA3, 0XBC,
+  0X9D, 0X91, 0XE1, 0X0E, 0X23, 0X57, 0XD7, 0X93, 0X5F, 0XE6, 0X3F, 0X3E,
+  0X7C, 0X7F, 0X7F, 0X3B, 0XB9, 0X9A, 0X4E, 0X66, 0X73, 0XE8, 0X4C, 0XA6,
+  0XF3, 0X0F, 0XBF, 0X5E, 0X77, 0XFF, 0X2F, 0X6E, 0X1C, 0XAF, 0X50, 0XD5,
+  0XF4, 0XB0, 0XE6, 0X74, 0XDF, 0X10, 0X8C, 0X50, 0X32, 0X4B, 0X5A, 0X01,
+  0XED, 0X5C, 0X1F, 0X3E, 0XA9, 0X1A, 0X32, 0X26, 0X49, 0X64, 0X15, 0X89,
+  0XCF, 0XC2, 0XA8, 0X95, 0X45, 0X03, 0X4C, 0XE6, 0X40, 0XD2, 0X42, 0X59,
+  0X2E, 0X3D, 0X55, 0X4B, 0XA3, 0X2A, 0X70, 0X25, 0XC2, 0X47, 0X26, 0X49,
+  0X7D, 0X2B, 0XAA, 0X1E, 0X30, 0XC9, 0X32, 0XB4, 0X16, 0XEE, 0X14, 0X97,
+  0X14, 0XE6, 0XC3, 0X12, 0XD6, 0X14, 0X69, 0XC5, 0X6D, 0X09, 0X4E, 0X91,
+  0X3A, 0X29, 0XDD, 0X2C, 0X08, 0XBB, 0X9E, 0X82, 0X0E, 0XE2, 0X46, 0XCF,
+  0X12, 0X9D, 0XF7, 0X34, 0XB0, 0X50, 0XCC, 0XE4, 0XFD, 0XE3, 0X37, 0XC5,
+  0XA5, 0XAE, 0X5D, 0XFB, 0XE6, 0X4B, 0X9E, 0XE7, 0X48, 0X6F, 0XBE, 0XE2,
+  0X32, 0X8D, 0X06, 0XF4, 0XCB, 0X3E, 0XA7, 0XD1, 0XE8, 0XFC, 0X3C, 0XDA,
+  0X7B, 0X02, 0X2D, 0XE4, 0XED, 0XFD, 0X8C, 0X06, 0XC7, 0X6E, 0XF5, 0X25,
+  0X86, 0X5B, 0XB5, 0X69, 0XB3, 0XEA, 0X6D, 0X3A, 0X42, 0X36, 0X52, 0XD7,
+  0X5D, 0XB1, 0X3D, 0X2C, 0X35, 0X1B, 0XBD, 0XA4, 0XBA, 0X82, 0X39, 0X5D,
+  0X81, 0X26, 0XD9, 0X45, 0X7B, 0X58, 0X4A, 0X76, 0XD4, 0XD2, 0X12, 0XE9,
+  0X94, 0X4B, 0XC7, 0X24, 0XF3, 0X75, 0XB9, 0XF4, 0XE5, 0XE7, 0XA3, 0XCA,
+  0X6B, 0X81, 0X9D, 0X77, 0X6D, 0X40, 0XDB, 0XFF, 0XDD, 0XBE, 0X3B, 0X85,
+  0X65, 0X2D, 0X9B, 0X52, 0XD3, 0XE9, 0XC2, 0X5F, 0XD0, 0XAA, 0XEA, 0XAC,
+  0XF5, 0XF0, 0XD5, 0XE1, 0XEF, 0XD7, 0XE4, 0XF5, 0X4B, 0X4A, 0X8E, 0X96,
+  0XB2, 0X5A, 0X4A, 0X5F, 0X05, 0X5F, 0X2D, 0X66, 0XBB, 0X09, 0X4C, 0XFF,
+  0X94, 0X2C, 0X28, 0XEB, 0X0A, 0X72, 0X5B, 0X6D, 0XCB, 0X66, 0XC8, 0X5F,
+  0XAF, 0X6C, 0XDB, 0X24, 0X5E, 0X71, 0X99, 0XAB, 0XD5, 0XDB, 0X73, 0X79,
+  0X7E, 0X20, 0X7F, 0X9F, 0X25, 0X2E, 0XFC, 0X8B, 0XD8, 0X6A, 0XB6, 0X87,
+  0XA7, 0XA7, 0X8D, 0X2A, 0X68, 0X41, 0XE8, 0X01, 0X68, 0X72, 0X87, 0X9D,
+  0X9C, 0X3F, 0XED, 0XB9, 0X66, 0XAA, 0XA6, 0X66, 0X2C, 0XB4, 0X0B, 0X34,
+  0X77, 0XC4, 0X93, 0X44, 0X3D, 0XB7, 0X25, 0X7B, 0XC4, 0X7D, 0XDF, 0XE3,
+  0XAD, 0X82, 0XAD, 0X85, 0XFB, 0X8A, 0X5E, 0X61, 0XBB, 0X57, 0XB3, 0XA0,
+  0XE7, 0XBB, 0XC6, 0X6D, 0X6B, 0X02, 0XC1, 0XF8, 0X65, 0X83, 0XF2, 0XC2,
+  0X61, 0X43, 0X80, 0XB6, 0XC3, 0X7C, 0X0E, 0XEA, 0XB5, 0X2A, 0X4E, 0X24,
+  0X6F, 0X3A, 0X91, 0X68, 0XFC, 0X33, 0XAE, 0X5A, 0XFE, 0XB7, 0XA9, 0X76,
+  0X18, 0X72, 0X66, 0XB8, 0X76, 0XA1, 0X8D, 0X64, 0X5A, 0X53, 0X22, 0X37,
+  0XC4, 0X37, 0X56, 0XDF, 0X91, 0XFA, 0X56, 0XB4, 0XE9, 0X4C, 0X7D, 0X8B,
+  0XFD, 0X0F, 0X2A, 0X65, 0XD7, 0X63, 0X7A, 0X0B, 0X00, 0X00
+};
+static const unsigned char asset_logo_png[] = {
+  0X1F, 0X8B, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0XC5, 0X7B,
+  0X53, 0X93, 0X28, 0X3C, 0XB0, 0XE0, 0XD8, 0XB6, 0X6D, 0XDB, 0XB6, 0X7D,
+  0XC6, 0XB6, 0X6D, 0XDB, 0XB6, 0X6D, 0XDB, 0XB6, 0X6D, 0XDB, 0XF6, 0X9C,
+  0XD1, 0X3D, 0XDF, 0XDE, 0XAA, 0XFD, 0X01, 0XFB, 0XB2, 0X5D, 0X9D, 0X4E,
+  0XA7, 0XD3, 0X4A, 0X25, 0X95, 0X4A, 0X3F, 0X24, 0X42, 0X41, 0X4E, 0X1C,
+  0X16, 0X0A, 0X0B, 0X0A, 0X00, 0X00, 0X00, 0X56, 0X52, 0X42, 0X44, 0XE9,
+  0X5F, 0X3F, 0XFE, 0X5F, 0X83, 0X00, 0XFE, 0X47, 0X33, 0X43, 0X75, 0XAB,
+  0X01, 0X00, 0X80, 0X0E, 0X15, 0X64, 0X54, 0X44, 0XC5, 0XED, 0X65, 0X00,
+  0XE0, 0XE0, 0XB0, 0X89, 0X85, 0X21, 0X73, 0X73, 0X45, 0X55, 0XA2, 0XE1,
+  0XDF, 0XDE, 0X10, 0XBE, 0XBF, 0X01, 0X00, 0X00, 0X61, 0X10, 0X08, 0XE0,
+  0X9F, 0X9F, 0X11, 0X7E, 0X7E, 0X10, 0X7E, 0X7F, 0XE1, 0X51, 0XA9, 0X80,
+  0X80, 0X41, 0X01, 0XC0, 0XC0, 0XE0, 0XFF, 0XFE, 0X15, 0X14, 0X11, 0XF9,
+  0X27, 0X01, 0X00, 0X04, 0XFC, 0X87, 0XF0, 0X1F, 0X1F, 0XBC, 0X52, 0XDE,
+  0XFF, 0X1C, 0X02, 0X00, 0X03, 0XFF, 0X13, 0XFE, 0XA7, 0XF9, 0XF0, 0XF0,
+  0XDF, 0X2C, 0X24, 0X24, 0X00, 0X34, 0XF4, 0X3F, 0X05, 0X24, 0X2C, 0XAE,
+  0X7F, 0X1E, 0X80, 0XC8, 0XC8, 0X20, 0XA0, 0XD0, 0XFE, 0X93, 0XFF, 0X13,
+  0X02, 0XFF, 0X97, 0X40, 0X45, 0X65, 0X65, 0X42, 0X52, 0XD2, 0XFF, 0X9A,
+  0XFC, 0X43, 0X72, 0X06, 0X45, 0X74, 0X5C, 0X46, 0X00, 0X18, 0X98, 0XFF,
+  0X86, 0X5F, 0X5F, 0XFF, 0X28, 0X20, 0X28, 0X28, 0X1D, 0XA7, 0XE1, 0X3F,
+  0X06, 0X88, 0X8A, 0X1A, 0X8F, 0X4A, 0X83, 0X45, 0XC0, 0XF6, 0XFF, 0X2A,
+  0XFF, 0X73, 0X08, 0XBB, 0XBA, 0X0A, 0X77, 0X70, 0X00, 0X22, 0X2C, 0X0C,
+  0X77, 0X76, 0X06, 0XFF, 0XF4, 0X04, 0X55, 0X5A, 0X0A, 0X7F, 0X7D, 0X0D,
+  0XC8, 0XCE, 0XFE, 0X6F, 0X09, 0XE0, 0XA6, 0XA6, 0X10, 0XA1, 0XA1, 0XE0,
+  0XF6, 0XF6, 0XC8, 0X39, 0X39, 0XC0, 0X34, 0X34, 0XB0, 0X1D, 0X1D, 0XD0,
+  0X45, 0X45, 0XBF, 0XBA, 0XBF, 0XFF, 0X82, 0XFE, 0XFE, 0XFE, 0X4A, 0XE8,
+  0XEA, 0XFE, 0XF3, 0X40, 0X40, 0X47, 0X87, 0XF4, 0XFB, 0X2B, 0XAE, 0XA7,
+  0XF7, 0X2F, 0X43, 0X71, 0X1D, 0X1D, 0X60, 0X50, 0X50, 0X0C, 0X12, 0X12,
+  0X32, 0X36, 0X36, 0X42, 0X06, 0X06, 0X45, 0X0B, 0X0B, 0X10, 0X08, 0X48,
+  0X12, 0X16, 0X16, 0X2C, 0X32, 0X32, 0X65, 0X41, 0X41, 0X7C, 0X5A, 0X5A,
+  0X6C, 0X0A, 0X0A, 0XD0, 0XDF, 0X5F, 0X5C, 0X2A, 0X2A, 0X0A, 0X0E, 0X0E,
+  0X48, 0X18, 0X18, 0X68, 0X04, 0X04, 0X62, 0X26, 0X26, 0X69, 0X43, 0X43,
+  0X29, 0X7D, 0X7D, 0X39, 0X53, 0X53, 0X6E, 0X39, 0X39, 0X51, 0X2D, 0X2D,
+  0XC0, 0XDF, 0X5F, 0X2A, 0X6E, 0X1E, 0X65, 0X6B, 0X6B, 0X58, 0X64, 0X64,
+  0X59, 0X63, 0X63, 0X3A, 0X7E, 0X7E, 0X34, 0X42, 0X42, 0XD4, 0XDF, 0X5F,
+  0X64, 0X1C, 0X1C, 0X49, 0X4D, 0X4D, 0X36, 0X49, 0X49, 0X3C, 0X6A, 0X6A,
+  0X26, 0X11, 0X11, 0X21, 0X35, 0X35, 0X54, 0X3C, 0X3C, 0X78, 0X74, 0XF4,
+  0X3F, 0XDC, 0XDC, 0XFC, 0XCA, 0XCA, 0XB2, 0X8A, 0X0A, 0X8A, 0XE2, 0XE2,
+  0X50, 0XBF, 0XBF, 0X6A, 0X0E, 0X0E, 0XB2, 0X32, 0X32, 0X62, 0X46, 0X46,
+  0XC8, 0X18, 0X18, 0XD2, 0X7F, 0XFE, 0X84, 0X44, 0X44, 0XAC, 0X6D, 0X6F,
+  0X31, 0XB1, 0XB0, 0X70, 0XF2, 0XF2, 0X2A, 0X9A, 0X9A, 0X7E, 0X7E, 0X7F,
+  0X9F, 0X5D, 0X5D, 0X8E, 0X8E, 0X8F, 0X0F, 0X6F, 0X6E, 0XBE, 0XBC, 0XBD,
+  0XDD, 0X3D, 0X3C, 0X68, 0XBA, 0XBA, 0X92, 0XB7, 0XB4, 0X40, 0XB7, 0XB4,
+  0X20, 0XDD, 0XDD, 0X01, 0X22, 0X21, 0X41, 0XB8, 0XBA, 0XA2, 0XEC, 0XEF,
+  0X53, 0X52, 0X51, 0X21, 0X9E, 0X9F, 0X43, 0X04, 0X04, 0XC0, 0X0C, 0X0E,
+  0X32, 0XA5, 0XA7, 0X93, 0XB3, 0X3B, 0XC2, 0X4E, 0X4D, 0X61, 0X6D, 0X6C,
+  0X40, 0XA6, 0XA6, 0XEA, 0X7A, 0X7B, 0X5B, 0XD9, 0XD8, 0XFC, 0X51, 0X51,
+  0X61, 0X12, 0X0A, 0XE4, 0XF5, 0XF0, 0X00, 0X66, 0X63, 0XE3, 0X0C, 0X0D,
+  0X85, 0X7B, 0X79, 0XA6, 0X2B, 0X2C, 0XD8, 0X3D, 0X3A, 0XE2, 0X91, 0X89,
+  0X02, 0X22, 0X21, 0X21, 0XE9, 0XEF, 0X67, 0X8D, 0X8D, 0X25, 0X98, 0X98,
+  0XE0, 0X77, 0X72, 0X82, 0X5D, 0X59, 0X51, 0XD7, 0XD4, 0X84, 0X2A, 0X28,
+  0XD0, 0X31, 0X32, 0XD2, 0X60, 0X60, 0XC8, 0X2B, 0X28, 0X98, 0X9D, 0X9F,
+  0X27, 0X26, 0X25, 0XC5, 0X59, 0X5C, 0XA8, 0X1B, 0X19, 0X96, 0XD4, 0X4C,
+  0X43, 0X79, 0X7F, 0X27, 0X66, 0X30, 0X05, 0XA2, 0XA5, 0X05, 0XD3, 0XD4,
+  0X84, 0XFE, 0XFC, 0XC4, 0XC6, 0XC6, 0X86, 0X8A, 0X8E, 0X9E, 0X3A, 0X39,
+  0X59, 0XB9, 0XBB, 0X83, 0XAA, 0XAC, 0X04, 0XB7, 0XB6, 0X16, 0XB6, 0XB0,
+  0X50, 0XD0, 0XD6, 0XA6, 0XA9, 0XAE, 0XDA, 0X79, 0X7B, 0X05, 0XE1, 0XE5,
+  0X95, 0XD7, 0XCF, 0X07, 0X97, 0X97, 0X6F, 0X5F, 0X98, 0X37, 0X36, 0X33,
+  0X85, 0XD9, 0XD9, 0X01, 0X33, 0X32, 0X52, 0X36, 0XAD, 0XA8, 0X69, 0X69,
+  0XE9, 0XE8, 0XEC, 0XE4, 0XB3, 0XB1, 0XF1, 0XF6, 0XF3, 0X75, 0X70, 0X71,
+  0XE1, 0XF6, 0XF7, 0X07, 0XC2, 0XC6, 0XD6, 0X91, 0X90, 0X48, 0XC9, 0XC8,
+  0X00, 0X11, 0X11, 0XB1, 0X08, 0X09, 0XB9, 0XFA, 0XF9, 0X49, 0XAF, 0X2C,
+  0X07, 0X91, 0X94, 0X94, 0X73, 0X72, 0X84, 0X07, 0X00, 0X90, 0XB6, 0XB0,
+  0XD0, 0XB0, 0X6E, 0X66, 0X9A, 0X9A, 0XC2, 0X87, 0X82, 0XD2, 0X23, 0X24,
+  0XE4, 0X2B, 0X2E, 0X96, 0X62, 0X62, 0XC2, 0X3F, 0X3C, 0X14, 0X64, 0X65,
+  0X95, 0X8C, 0X8B, 0X13, 0X49, 0X4F, 0X17, 0X27, 0X25, 0XE5, 0XE9, 0XE8,
+  0XA0, 0XDA, 0XDF, 0X47, 0X67, 0X63, 0X63, 0X3C, 0X38, 0XE0, 0X3C, 0X3A,
+  0X02, 0X00, 0X11, 0XFE, 0X77, 0XBC, 0X03, 0X0F, 0X4D, 0X3D, 0XFE, 0X6D,
+  0XFF, 0XAB, 0XB3, 0X92, 0X9C, 0X32, 0X80, 0XE0, 0X37, 0XC8, 0X0F, 0X16,
+  0XFB, 0XF7, 0X37, 0X24, 0XB9, 0XF0, 0XF7, 0XBB, 0XB1, 0XE2, 0XCF, 0XD3,
+  0XFA, 0XBD, 0XEE, 0X77, 0X6B, 0XC2, 0XC5, 0X12, 0X82, 0X9B, 0XA2, 0XEF,
+  0XCC, 0X4F, 0X17, 0XEA, 0X77, 0X0A, 0X43, 0XD9, 0XD0, 0XF7, 0XCF, 0XDF,
+  0XA6, 0XE1, 0XAF, 0X2F, 0XD2, 0X68, 0XEB, 0XE2, 0XD3, 0XAF, 0X00, 0XE8,
+  0X9F, 0XEF, 0XEA, 0XA9, 0XBD, 0X3C, 0X41, 0X0F, 0XBB, 0XD4, 0X99, 0X84,
+  0XFA, 0X1A, 0XC6, 0XC6, 0X94, 0XB8, 0XF1, 0XC1, 0X9C, 0XD6, 0XDF, 0XFF,
+  0X1F, 0XF0, 0XF3, 0XFF, 0X60, 0X03, 0X60, 0XB9, 0X8D, 0X2B, 0X0F, 0X00,
+  0XC0, 0X38, 0X22, 0X29, 0X22, 0XA8, 0XE2, 0XBE, 0X79, 0X9D, 0XB1, 0X25,
+  0X8F, 0X6D, 0X86, 0X35, 0X8A, 0X1C, 0X36, 0X2A, 0XB7, 0X56, 0XBC, 0X55,
+  0X1F, 0XBF, 0X43, 0XC7, 0X59, 0X00, 0X52, 0XA1, 0X99, 0X98, 0X12, 0X88,
+  0XB4, 0X79, 0X63, 0X6B, 0XFB, 0XFA, 0X77, 0X25, 0X7A, 0XC6, 0X7D, 0X94,
+  0XF9, 0X88, 0X98, 0X8D, 0X2F, 0X86, 0X97, 0X0F, 0XB0, 0X75, 0X00, 0X8E,
+  0X2D, 0X0C, 0X7B, 0X0F, 0XD3, 0XA8, 0X6C, 0X3F, 0X5D, 0XE1, 0X20, 0X51,
+  0X44, 0X40, 0X7A, 0XD2, 0X31, 0XC0, 0X5F, 0X41, 0X14, 0X8A, 0X10, 0X4A,
+  0XC2, 0X1F, 0XA5, 0X82, 0X80, 0X2E, 0X91, 0XCC, 0XA2, 0XC9, 0X66, 0XE9,
+  0X1B, 0XFD, 0X15, 0X3B, 0X56, 0XAE, 0X60, 0X8B, 0X9B, 0XA5, 0XFA, 0X4B,
+  0X37, 0X1D, 0X73, 0X60, 0XE4, 0XED, 0XE9, 0XA9, 0X3B, 0XEC, 0XEE, 0X64,
+  0XBE, 0X40, 0X08, 0XA5, 0X10, 0X21, 0X84, 0X42, 0X84, 0X10, 0X4A, 0X31,
+  0XFC, 0XFF, 0XB0, 0XEF, 0X7E, 0XD1, 0X4F, 0X65, 0X54, 0XD2, 0XFA, 0XBC,
+  0X52, 0X93, 0X72, 0X39, 0XFC, 0XF5, 0X18, 0X27, 0X26, 0X00, 0X43, 0X56,
+  0XCC, 0XCC, 0X73, 0X68, 0XA6, 0X4B, 0XD2, 0X56, 0X94, 0X14, 0XDC, 0XDE,
+  0X04, 0X8C, 0XB3, 0X29, 0X03, 0XDF, 0XE0, 0X6F, 0XC9, 0XEE, 0XCB, 0XE1,
+  0X6F, 0X5F, 0XF7, 0X96, 0XC7, 0XB7, 0X67, 0XBB, 0X9E, 0XED, 0XF6, 0X27,
+  0X00, 0X93, 0X0E, 0X9C, 0X2B, 0X75, 0XCF, 0XD4, 0X31, 0XA3, 0X11, 0X59,
+  0X71, 0X5C, 0X5A, 0X5A, 0X5A, 0X5B, 0X87, 0X8C, 0XA3, 0XD2, 0XB9, 0X1C,
+  0XF6, 0X85, 0XD9, 0XC1, 0X21, 0X78, 0X7D, 0X48, 0X6E, 0X72, 0X3C, 0X2B,
+  0X17, 0X60, 0XD6, 0XAA, 0X30, 0X55, 0X7F, 0X1C, 0X56, 0X83, 0X67, 0XC0,
+  0XCB, 0XE0, 0X90, 0X46, 0X12, 0XA4, 0XCB, 0XD4, 0XF0, 0XA8, 0X52, 0X26,
+  0XCB, 0X9F, 0X4C, 0XDD, 0XFD, 0XFD, 0X0C, 0X5A, 0X3C, 0X0D, 0X79, 0X46,
+  0X0D, 0X30, 0XC6, 0X86, 0X03, 0X8D, 0X4F, 0X4A, 0X82, 0X80, 0X1D, 0XBB,
+  0XDD, 0X6B, 0XC6, 0XE2, 0X88, 0X63, 0XB7, 0XAA, 0XA2, 0X87, 0XC6, 0X12,
+  0X49, 0XA4, 0X39, 0X0D, 0XA3, 0X05, 0X02, 0X49, 0XAD, 0X69, 0X49, 0X4F,
+  0XC0, 0XC7, 0X54, 0X9B, 0XA4, 0X48, 0X6B, 0X59, 0X7C, 0X79, 0X3B, 0X2B,
+  0X2D, 0X01, 0XF4, 0X67, 0X4C, 0X91, 0XFA, 0XCD, 0XA2, 0X2A, 0X54, 0X20,
+  0X42, 0XCE, 0X80, 0XC1, 0X87, 0X75, 0XC5, 0XA9, 0X0C, 0X64, 0X22, 0X8E,
+  0XDA, 0X9B, 0XC6, 0X7A, 0XB1, 0X00, 0X19, 0X1C, 0XF0, 0XBA, 0X76, 0X26,
+  0X2D, 0X00, 0X84, 0X20, 0XAB, 0X08, 0X22, 0XC9, 0X11, 0X83, 0XA1, 0XC1,
+  0X03, 0X8E, 0X9C, 0XA9, 0X9A, 0X6C, 0XAB, 0X22, 0XFC, 0X6A, 0X2C, 0XF3,
+  0X73, 0XA5, 0X19, 0X54, 0XB3, 0X66, 0X26, 0X49, 0X84, 0X4C, 0XE7, 0XEF,
+  0X03, 0X29, 0XA8, 0X68, 0X0E, 0X08, 0X26, 0X87, 0XE1, 0X95, 0X24, 0X69,
+  0X88, 0X78, 0XB3, 0X47, 0XC7, 0XF4, 0XBE, 0XC7, 0X03, 0X43, 0XE2, 0X1C,
+  0XC6, 0XE5, 0X31, 0X4A, 0X0F, 0X0D, 0X65, 0X00, 0XD6, 0X25, 0X02, 0X0F,
+  0X54, 0XA8, 0XFE, 0X10, 0X91, 0XF8, 0XCA, 0XCA, 0X09, 0X2D, 0XC6, 0X61,
+  0XE7, 0XE8, 0XF9, 0XBE, 0XDE, 0XC1, 0X99, 0X43, 0X8C, 0X80, 0X30, 0X1B,
+  0X5C, 0X51, 0X64, 0X93, 0XA3, 0X5D, 0X00, 0XE0, 0XA7, 0XD5, 0X3B, 0X61,
+  0X84, 0X6D, 0X93, 0X3E, 0XF2, 0X70, 0X82, 0X7E, 0XFB, 0X26, 0XE3, 0XF2,
+  0XC7, 0XF8, 0X81, 0XBF, 0XC4, 0X62, 0XCC, 0X41, 0XCA, 0X0D, 0XF2, 0X3C,
+  0XB8, 0X67, 0X1B, 0X58, 0XE3, 0XE0, 0X5B, 0X31, 0X01, 0XAF, 0X60, 0X66,
+  0X09, 0X8F, 0X4C, 0X81, 0X8C, 0X89, 0XEA, 0XB8, 0X19, 0XAC, 0XE2, 0XBB,
+  0XC4, 0XC2, 0X78, 0X8F, 0XFD, 0XC5, 0XF9, 0XF2, 0XBC, 0XAA, 0XDF, 0XC0,
+  0X94, 0X1F, 0X47, 0X7C, 0XF6, 0XC4, 0X65, 0X1B, 0XAD, 0X8C, 0X7C, 0X10,
+  0X1C, 0XBA, 0X2F, 0XF3, 0XCE, 0X6E, 0X22, 0XF5, 0X26, 0X38, 0XA4, 0XD2,
+  0X86, 0X0B, 0X0A, 0X3F, 0X7A, 0X79, 0X6F, 0X43, 0X21, 0X77, 0X16, 0X48,
+  0X61, 0X9D, 0X55, 0X17, 0X96, 0XA5, 0XE3, 0XCA, 0X5F, 0XC3, 0XA6, 0XF0,
+  0X41, 0X30, 0XAA, 0XD7, 0XCC, 0XED, 0XDB, 0XE1, 0X5E, 0X9F, 0X70, 0X7A,
+  0X38, 0XA3, 0X44, 0XB8, 0X6A, 0X77, 0X3C, 0XE6, 0X29, 0XEE, 0X74, 0X38,
+  0XCB, 0XCA, 0XDB, 0X81, 0X4B, 0X86, 0XC0, 0X31, 0X35, 0XAB, 0X97, 0X48,
+  0XCA, 0XB4, 0XAC, 0XA8, 0X73, 0X6B, 0X53, 0X80, 0X6A, 0X11, 0XB5, 0X82,
+  0XF0, 0X3C, 0XAC, 0X1C, 0X0D, 0X60, 0X9F, 0X30, 0XE3, 0XE2, 0X7B, 0X5E,
+  0X99, 0X39, 0X30, 0X4C, 0X80, 0X7B, 0X4D, 0X8B, 0X24, 0X2C, 0X72, 0XEE,
+  0XFD, 0XD9, 0XB0, 0X41, 0X96, 0X4A, 0XC9, 0X81, 0X04, 0XA5, 0XE5, 0X63,
+  0XEF, 0X72, 0XC0, 0X05, 0X2C, 0XEC, 0X15, 0XB4, 0X5B, 0X00, 0XE3, 0XD8,
+  0X55, 0XC5, 0XF6, 0XED, 0X6D, 0X47, 0X38, 0XDD, 0XF2, 0X95, 0X12, 0X9A,
+  0XE0, 0X64, 0X74, 0XD4, 0XEE, 0X80, 0XB1, 0XE8, 0X6B, 0XB2, 0XDA, 0X2E,
+  0X13, 0XE2, 0XB4, 0X3D, 0X11, 0XD6, 0XED, 0X1C, 0X90, 0X11, 0XF0, 0X6D,
+  0X07, 0X6E, 0X6E, 0X8D, 0X68, 0X68, 0XBB, 0X7A, 0X1F, 0X31, 0XEB, 0X44,
+  0XEF, 0XBC, 0XD5, 0XE5, 0X70, 0X10, 0X09, 0X26, 0X30, 0X61, 0XB8, 0X66,
+  0XDF, 0XD5, 0XFC, 0X5E, 0X0E, 0XE0, 0XC0, 0X90, 0X57, 0XC0, 0X3F, 0XF7,
+  0XD7, 0X39, 0X68, 0X32, 0X67, 0XA5, 0X2A, 0XD5, 0X79, 0XEB, 0X9E, 0XE3,
+  0XCE, 0XEF, 0XB2, 0XD0, 0X0E, 0XF0, 0X8B, 0X6C, 0X08, 0X10, 0XD0, 0X7B,
+  0XB6, 0XDA, 0X8A, 0X93, 0X2D, 0X3F, 0X61, 0XCC, 0XEE, 0X95, 0XB3, 0X02,
+  0X33, 0X64, 0X8F, 0XE0, 0XCC, 0X5F, 0XE3, 0X7A, 0X77, 0XDD, 0XB9, 0X99,
+  0XBE, 0X03, 0XAF, 0XFD, 0X64, 0X26, 0XE8, 0X75, 0X55, 0X82, 0X2B, 0X7F,
+  0XE4, 0XBA, 0X8B, 0X75, 0X3A, 0XBF, 0X1C, 0X10, 0X6F, 0X6E, 0X86, 0XCF,
+  0X17, 0XFA, 0X91, 0X46, 0XCA, 0XC0, 0XF4, 0X5F, 0X7C, 0X0F, 0XF4, 0XF6,
+  0X7A, 0X3F, 0X35, 0XD2, 0X69, 0X9F, 0XE2, 0X00, 0X36, 0XA4, 0XD6, 0X39,
+  0X93, 0X22, 0X60, 0X35, 0XE9, 0X2E, 0XB8, 0X6A, 0X26, 0X84, 0X0B, 0X0B,
+  0XB0, 0X15, 0XBC, 0XD0, 0X21, 0XFD, 0X2D, 0XC1, 0X43, 0XAF, 0X9A, 0X17,
+  0X0F, 0XCA, 0X7C, 0X64, 0X5A, 0XBD, 0X1F, 0XDF, 0X79, 0X78, 0X3D, 0XC7,
+  0X45, 0XA3, 0X8B, 0XA2, 0X96, 0X95, 0X03, 0X2C, 0X4E, 0X99, 0X2D, 0XEB,
+  0X74, 0X45, 0X1D, 0X65, 0XC7, 0X34, 0X57, 0X95, 0XF2, 0XAF, 0XB6, 0X6C,
+  0X6B, 0XAA, 0X34, 0X01, 0X50, 0X6A, 0X12, 0XBB, 0X3A, 0X3C, 0XAB, 0XDD,
+  0XC3, 0XF8, 0XF6, 0X1D, 0X6C, 0X07, 0X39, 0XBC, 0XBC, 0X57, 0X93, 0X02,
+  0XB0, 0XE5, 0XE8, 0X1A, 0X6C, 0X49, 0X87, 0XBA, 0X28, 0X20, 0XCF, 0X4F,
+  0X27, 0XB0, 0XA2, 0XBB, 0X3D, 0X8C, 0X97, 0X92, 0X2A, 0X11, 0X61, 0X44,
+  0XC0, 0XAA, 0X89, 0XB0, 0XFB, 0XFE, 0X1A, 0X7D, 0X2F, 0X3A, 0XE7, 0XF5,
+  0X47, 0X36, 0X04, 0XE2, 0X84, 0X61, 0XC0, 0XB8, 0X59, 0X70, 0X59, 0XAD,
+  0XC4, 0X08, 0X53, 0X05, 0X34, 0X85, 0X85, 0X4C, 0XCC, 0X76, 0X6E, 0X23,
+  0X5A, 0X3C, 0XA1, 0XD2, 0X67, 0X35, 0X15, 0X12, 0XAE, 0XF8, 0XB0, 0X57,
+  0X5B, 0X7B, 0X6B, 0X8B, 0X1E, 0X12, 0XD0, 0X46, 0X4A, 0X6B, 0XFA, 0X5B,
+  0X54, 0X34, 0XAE, 0XEE, 0X5A, 0X2D, 0X27, 0XDF, 0X19, 0X04, 0X18, 0X6F,
+  0X5A, 0XF5, 0X06, 0X44, 0X99, 0X43, 0X22, 0X70, 0XC0, 0X9A, 0X84, 0X35,
+  0X89, 0X6A, 0XF7, 0XD9, 0XF8, 0X60, 0XD1, 0X8C, 0XBE, 0X9F, 0X59, 0XEE,
+  0X09, 0XF1, 0X2C, 0X73, 0XA1, 0X42, 0X85, 0X5D, 0X04, 0XB9, 0XDC, 0XE6,
+  0XBE, 0X42, 0X43, 0X88, 0XBF, 0X79, 0X43, 0X83, 0XF2, 0X87, 0XFE, 0XA4,
+  0X3F, 0X53, 0XDB, 0XB6, 0XAD, 0X82, 0X93, 0X83, 0XC1, 0X53, 0XF9, 0XEC,
+  0X0E, 0X58, 0X51, 0X47, 0X56, 0X4E, 0X60, 0X92, 0X03, 0XA9, 0XF6, 0XCF,
+  0X83, 0XA0, 0X8D, 0X78, 0XD8, 0XC4, 0X32, 0XE0, 0XE2, 0X45, 0XB6, 0X37,
+  0X3D, 0XC2, 0X07, 0X13, 0X52, 0XE5, 0X40, 0X89, 0XAD, 0X45, 0XA9, 0X4F,
+  0X41, 0XC7, 0XC2, 0X2A, 0X7E, 0X74, 0X71, 0X79, 0X62, 0X31, 0X52, 0X2E,
+  0X46, 0XDF, 0X7C, 0X45, 0X3A, 0X02, 0XEA, 0XFC, 0XA2, 0X25, 0X2F, 0X82,
+  0X99, 0X23, 0XEB, 0X88, 0X57, 0X80, 0X44, 0X14, 0X99, 0X89, 0XC0, 0XBC,
+  0XA5, 0XA6, 0XB4, 0XB2, 0X60, 0XAF, 0XE2, 0XDA, 0X49, 0X37, 0XBC, 0X49,
+  0XE1, 0X64, 0X02, 0XB8, 0XBB, 0X57, 0XD6, 0X8E, 0XAA, 0X59, 0XBE, 0X45,
+  0X54, 0X26, 0XE8, 0XC5, 0X4A, 0X81, 0XA5, 0XA1, 0X7C, 0XFC, 0XE5, 0X49,
+  0X55, 0X79, 0X5F, 0X95, 0X45, 0X14, 0X91, 0X3E, 0X04, 0X63, 0X4D, 0XD1,
+  0X42, 0X73, 0X79, 0XE6, 0X27, 0XEB, 0XB8, 0X4C, 0X8B, 0XE7, 0XE1, 0X26,
+  0X5C, 0XE6, 0X2A, 0XB1, 0X51, 0X00, 0X0F, 0X77, 0X5F, 0X59, 0X13, 0X88,
+  0X1D, 0X6C, 0X81, 0XEE, 0XA2, 0XFE, 0X22, 0XB5, 0X79, 0XE4, 0XAB, 0X7E,
+  0X67, 0XC5, 0XBF, 0X98, 0XDF, 0X24, 0XCE, 0X7D, 0X8B, 0X1A, 0X57, 0XE5,
+  0XE1, 0X13, 0XF9, 0X8A, 0X00, 0XF5, 0X4B, 0X4F, 0X25, 0XC3, 0XBB, 0X04,
+  0X8B, 0X8B, 0X1F, 0X16, 0X68, 0X19, 0XD2, 0X45, 0X6A, 0X14, 0XE5, 0XE3,
+  0X51, 0XF7, 0X57, 0XA2, 0X8A, 0X94, 0X8E, 0X06, 0X23, 0XEE, 0X6A, 0X67,
+  0X4C, 0X23, 0XD6, 0X9B, 0XFE, 0X53, 0XB0, 0XC1, 0XC6, 0XE6, 0X1A, 0X60,
+  0XF7, 0X56, 0X89, 0XC7, 0X24, 0X20, 0XCD, 0XED, 0X20, 0X08, 0XF4, 0X4B,
+  0X1C, 0X6E, 0X56, 0X27, 0XC5, 0XE9, 0X93, 0X77, 0X42, 0XCF, 0XD8, 0XB8,
+  0X63, 0XCC, 0X50, 0X93, 0XC5, 0XA2, 0X4D, 0X06, 0XB7, 0X25, 0XC1, 0XEF,
+  0XAC, 0X08, 0X16, 0X2B, 0XDE, 0XAA, 0X62, 0X02, 0X39, 0X9A, 0X75, 0XF3,
+  0X96, 0XD5, 0X37, 0X9D, 0X63, 0XD2, 0X85, 0X54, 0X7D, 0X3D, 0X93, 0XAF,
+  0X57, 0X6C, 0XA3, 0X57, 0X4B, 0XF9, 0XB9, 0X72, 0XC6, 0X7A, 0XB7, 0X2B,
+  0X30, 0X6D, 0X81, 0XE5, 0X19, 0XD3, 0X52, 0X01, 0XCB, 0XEA, 0XCF, 0X01,
+  0X9D, 0XF1, 0X65, 0XCC, 0X0D, 0XF6, 0X9A, 0X22, 0X4D, 0X75, 0X2C, 0XCC,
+  0X2B, 0XAB, 0XE6, 0X67, 0X14, 0X3D, 0X13, 0XB0, 0X0A, 0XCC, 0X94, 0X1F,
+  0XF8, 0X38, 0X83, 0XC3, 0X29, 0X59, 0X64, 0XFD, 0X36, 0X42, 0XBB, 0X8E,
+  0XC3, 0X56, 0X1E, 0XCA, 0X11, 0XEE, 0X3F, 0X9F, 0X4E, 0XE9, 0X2C, 0X72,
+  0XC1, 0X8C, 0X24, 0XE1, 0X13, 0X61, 0XB1, 0X1A, 0XCA, 0XF0, 0X7D, 0X88,
+  0X8B, 0X55, 0XE8, 0X25, 0XF9, 0XAC, 0X17, 0X8A, 0X89, 0XE5, 0XE9, 0X10,
+  0XE1, 0X66, 0XE0, 0X0E, 0X5F, 0X7C, 0X93, 0X2E, 0X71, 0X95, 0XB1, 0XA5,
+  0X90, 0XF1, 0X9D, 0X07, 0XEC, 0X41, 0X04, 0X91, 0X09, 0X1D, 0X34, 0X58,
+  0X35, 0XA3, 0X46, 0X4D, 0X9A, 0X33, 0X87, 0X1A, 0XF6, 0X39, 0XD9, 0X11,
+  0XB1, 0XAD, 0X4C, 0X70, 0X93, 0X2D, 0XB5, 0X23, 0X23, 0X50, 0X2C, 0XD0,
+  0X6F, 0X70, 0XB6, 0XD9, 0X1E, 0X56, 0X51, 0X42, 0XB6, 0X7C, 0X3C, 0X17,
+  0X3D, 0X71, 0XB7, 0XB1, 0X57, 0X4E, 0XE9, 0X5B, 0X21, 0X9E, 0X85, 0XA8,
+  0X47, 0X59, 0X23, 0XCA, 0X7E, 0X53, 0X78, 0X7F, 0XB7, 0XB0, 0X30, 0XD3,
+  0X7A, 0X31, 0X3B, 0XC4, 0X54, 0X75, 0X22, 0X67, 0XB3, 0XA5, 0XDE, 0X48,
+  0X95, 0X07, 0XDD, 0XF2, 0XB0, 0XBA, 0XE8, 0X71, 0X3C, 0XED, 0X65, 0XDC,
+  0X83, 0X52, 0X8C, 0X4D, 0XD1, 0XBE, 0X53, 0X69, 0XA9, 0X44, 0X77, 0X81,
+  0XF2, 0X32, 0X23, 0XF5, 0XB5, 0XA7, 0X49, 0X72, 0X1B, 0X5D, 0X3E, 0X66,
+  0XAB, 0XEA, 0X67, 0X2C, 0X99, 0X20, 0X6E, 0XE7, 0XE8, 0XA4, 0XD9, 0X8A,
+  0XC7, 0X29, 0XD6, 0X82, 0XF3, 0XBE, 0X31, 0X03, 0XCE, 0X74, 0XEB, 0XEE,
+  0XBB, 0XF7, 0XE5, 0X13, 0XAF, 0X56, 0X13, 0XBB, 0XB5, 0X6B, 0X85, 0X48,
+  0X9A, 0XD9, 0XD4, 0XB1, 0X23, 0X38, 0X45, 0X94, 0X5B, 0XE9, 0X60, 0XC5,
+  0XEC, 0XAE, 0X78, 0XB2, 0XB1, 0X66, 0XC8, 0X1A, 0XAD, 0X5D, 0X1B, 0X0D,
+  0X97, 0X64, 0X8D, 0X7E, 0X48, 0X07, 0X94, 0X03, 0XC7, 0XC2, 0XC9, 0X07,
+  0XC7, 0XAA, 0X7F, 0X07, 0X4C, 0X63, 0XC7, 0X23, 0X23, 0X1D, 0XCF, 0XE7,
+  0X32, 0X69, 0XD1, 0XE8, 0X8C, 0XF3, 0XAC, 0X10, 0XA7, 0X72, 0X6F, 0XED,
+  0XE9, 0X1D, 0X53, 0X79, 0X8B, 0XC5, 0X4B, 0X13, 0XE4, 0XE1, 0X53, 0X6C,
+  0XD7, 0X76, 0X8B, 0XFD, 0XD8, 0XF8, 0X47, 0X96, 0X7E, 0X1A, 0XBA, 0XA1,
+  0X53, 0XE7, 0X51, 0X67, 0XB0, 0X26, 0X07, 0X0C, 0X18, 0XA5, 0X68, 0XB2,
+  0X92, 0XAD, 0XE0, 0XF5, 0X42, 0XB6, 0X8E, 0XE0, 0XF0, 0XEB, 0XAB, 0X69,
+  0XB8, 0X35, 0X9A, 0X60, 0X85, 0X64, 0X3E, 0XF2, 0XAE, 0XED, 0X69, 0XDE,
+  0XBB, 0XDA, 0XF2, 0X26, 0X32, 0X3F, 0XAC, 0X41, 0XA9, 0X43, 0X04, 0X72,
+  0XD8, 0X07, 0X47, 0XB4, 0X0D, 0X29, 0XB5, 0XD0, 0XD1, 0XF4, 0XB4, 0XEB,
+  0X4C, 0X02, 0X69, 0X09, 0X12, 0XD4, 0X8C, 0XC9, 0XAB, 0XC2, 0X79, 0X60,
+  0X3B, 0X27, 0X6A, 0XCE, 0X96, 0X97, 0X3B, 0X97, 0XD8, 0X10, 0X17, 0XB2,
+  0X07, 0XA5, 0X66, 0X01, 0X4C, 0X0A, 0XB2, 0X88, 0X1A, 0XC2, 0X25, 0X4A,
+  0X6B, 0XA8, 0XAD, 0X88, 0X6B, 0X5A, 0XF0, 0X52, 0X46, 0X65, 0X8D, 0X49,
+  0X51, 0X37, 0X0A, 0X73, 0X1C, 0X12, 0X24, 0X0E, 0X7E, 0X7C, 0XD7, 0X67,
+  0X31, 0XB2, 0X77, 0X2E, 0XC2, 0X99, 0X8A, 0X25, 0X66, 0X58, 0X16, 0X0A,
+  0X6A, 0X9D, 0X44, 0X31, 0XAA, 0X24, 0X5C, 0XB5, 0XD6, 0X52, 0X7F, 0X8A,
+  0XAA, 0X4C, 0X32, 0X2F, 0X2F, 0X37, 0XAE, 0X9D, 0X45, 0X6B, 0XA9, 0XFC,
+  0XB4, 0XA7, 0XAF, 0XFD, 0X79, 0X9E, 0XF9, 0XA7, 0XED, 0X22, 0X4A, 0X84,
+  0X17, 0X17, 0XB3, 0X9B, 0X75, 0X6D, 0XE6, 0X59, 0X34, 0X3E, 0X4E, 0XDB,
+  0X7A, 0X5E, 0X6E, 0XF7, 0XDE, 0X2E, 0X8E, 0XF1, 0XBB, 0XDF, 0X56, 0XAF,
+  0X2E, 0X1A, 0XD8, 0X6D, 0XD8, 0XBA, 0X34, 0X03, 0X90, 0X8A, 0X35, 0X5D,
+  0X5D, 0X96, 0XA4, 0X87, 0X82, 0X06, 0XDF, 0XFA, 0X98, 0X9A, 0X62, 0X46,
+  0X66, 0X21, 0X72, 0X48, 0X58, 0XDB, 0X1B, 0X1F, 0X34, 0X15, 0X69, 0XA9,
+  0X27, 0X1B, 0X4C, 0X5D, 0XFA, 0X0F, 0X0F, 0X91, 0X2E, 0XDB, 0X6C, 0XBB,
+  0XEE, 0X7A, 0XFA, 0XF4, 0X08, 0XC4, 0XF9, 0XFE, 0XEA, 0XF8, 0X3E, 0X90,
+  0X92, 0XE7, 0XBA, 0X79, 0X72, 0X04, 0X85, 0X26, 0X9B, 0X49, 0X9F, 0X68,
+  0XBD, 0X5E, 0XE4, 0XA4, 0X7B, 0XD6, 0X7B, 0XB1, 0X5C, 0XE4, 0X5D, 0X4A,
+  0XDB, 0XF1, 0XA1, 0X4D, 0X91, 0X87, 0X19, 0X17, 0X6B, 0X16, 0XC0, 0X8B,
+  0X20, 0XC1, 0X21, 0X40, 0XDD, 0X37, 0XC0, 0X06, 0XE1, 0X8E, 0XCC, 0XDD,
+  0X66, 0X65, 0XCC, 0XFA, 0X26, 0XFA, 0XE9, 0XE1, 0X77, 0X33, 0XAE, 0X8D,
+  0XB3, 0X28, 0XA2, 0X3D, 0XCA, 0XB8, 0X3A, 0X92, 0X0B, 0X7A, 0XA2, 0X7F,
+  0XBA, 0X05, 0XC4, 0X1B, 0XED, 0X5C, 0XE4, 0XC4, 0XBC, 0X1A, 0XCB, 0XC9,
+  0X59, 0X9A, 0X3B, 0XF7, 0X44, 0X1A, 0X5C, 0X3F, 0X08, 0X87, 0XED, 0X7E,
+  0X6C, 0X75, 0X5D, 0XF5, 0XFE, 0X45, 0XE0, 0XEF, 0XB4, 0X23, 0XF0, 0XFB,
+  0XE2, 0XF0, 0X0B, 0X6A, 0X64, 0X71, 0XE9, 0X59, 0XA8, 0X5D, 0X5D, 0X2C,
+  0X26, 0X69, 0X03, 0X16, 0XA2, 0X32, 0X7B, 0XC5, 0X42, 0X5F, 0X9A, 0XFC,
+  0X67, 0XE4, 0X7D, 0X0B, 0X23, 0XB9, 0X04, 0X15, 0X34, 0X88, 0XF6, 0X54,
+  0X40, 0X79, 0X82, 0XEC, 0XAD, 0X73, 0XC6, 0X7F, 0X70, 0X87, 0XBF, 0X45,
+  0X1F, 0XEB, 0XF6, 0X38, 0XC2, 0X4F, 0X8E, 0XFB, 0XD4, 0XB6, 0XD1, 0XCE,
+  0X25, 0XEA, 0X1F, 0X7F, 0X7C, 0XDA, 0XD6, 0XE6, 0X28, 0X1D, 0X75, 0XD1,
+  0X23, 0XE0, 0X89, 0XDE, 0XF6, 0X0E, 0X01, 0X42, 0X44, 0XF8, 0XD2, 0X6C,
+  0X4F, 0XFD, 0X31, 0XAD, 0XE4, 0X78, 0X8E, 0X11, 0XFB, 0XAB, 0X21, 0X81,
+  0X80, 0XF3, 0XEB, 0XBE, 0X07, 0XF2, 0X41, 0XFD, 0X13, 0X97, 0X93, 0XE6,
+  0X78, 0XFE, 0XC4, 0X3E, 0XCB, 0X49, 0X21, 0X0D, 0XA0, 0X93, 0X9E, 0XDA,
+  0X26, 0X10, 0X7E, 0XAC, 0X9F, 0XB8, 0X33, 0X93, 0X20, 0XC5, 0X27, 0X79,
+  0X4A, 0X49, 0X54, 0XA1, 0XB7, 0X27, 0XE8, 0X8E, 0X2C, 0XC8, 0XE1, 0X86,
+  0X32, 0X06, 0X3A, 0XF4, 0X03, 0X3A, 0XC6, 0XBF, 0X49, 0X1F, 0X0B, 0XCF,
+  0X37, 0XFC, 0X1B, 0XDF, 0X27, 0XA0, 0X11, 0XCD, 0X87, 0X65, 0X5E, 0X68,
+  0X0E, 0X68, 0XAC, 0X95, 0X60, 0XE6, 0X13, 0X2F, 0X97, 0XD8, 0XC5, 0XC1,
+  0XC4, 0X6C, 0X6F, 0XE7, 0XD4, 0X4B, 0X0E, 0X6A, 0XC5, 0XEA, 0XD5, 0X02,
+  0XE5, 0XEC, 0X12, 0X27, 0X9A, 0X8F, 0X23, 0XE9, 0XA0, 0X8A, 0XE0, 0X15,
+  0X64, 0X96, 0X97, 0X1D, 0X72, 0XF6, 0XA7, 0X66, 0XD2, 0X4E, 0X3C, 0X7B,
+  0XAF, 0XBA, 0X50, 0X1B, 0XDE, 0XDF, 0XD8, 0X9C, 0X5B, 0X1C, 0X2F, 0X9A,
+  0X77, 0X2A, 0X1F, 0XEA, 0X65, 0X15, 0X2A, 0XF0, 0XBA, 0XC7, 0X8D, 0XBC,
+  0X89, 0X2D, 0X75, 0X76, 0X2A, 0X01, 0X2E, 0X2C, 0X55, 0X15, 0X04, 0XE8,
+  0XF7, 0X64, 0X47, 0XD3, 0X6F, 0X73, 0XBC, 0XD6, 0XDD, 0XF2, 0X3A, 0X5A,
+  0X36, 0X1F, 0X85, 0X35, 0XD5, 0X9D, 0XE2, 0X8A, 0X66, 0X83, 0X1E, 0X92,
+  0X40, 0X3F, 0X82, 0X80, 0X50, 0XB1, 0X4D, 0XB3, 0X45, 0X09, 0XBF, 0XF3,
+  0XD1, 0X1D, 0XC3, 0XFA, 0XBA, 0XE1, 0X01, 0XF9, 0X89, 0X61, 0XB4, 0X0E,
+  0XE1, 0XE9, 0X31, 0X30, 0X82, 0X98, 0XF5, 0X43, 0X0C, 0XC6, 0X94, 0XB1,
+  0XC1, 0X08, 0X65, 0X90, 0XAC, 0X51, 0X3A, 0XB5, 0XD0, 0X5B, 0X1D, 0X93,
+  0XA1, 0XC5, 0X78, 0X1D, 0X22, 0X1E, 0XC0, 0XA2, 0XA4, 0X91, 0X48, 0XA9,
+  0X51, 0X76, 0XA9, 0X5A, 0X55, 0XCB, 0XA5, 0XED, 0X57, 0X60, 0X0E, 0X77,
+  0X4B, 0X3F, 0XB1, 0X15, 0X9B, 0XD5, 0XB4, 0XAE, 0X7E, 0X94, 0X59, 0XCC,
+  0XED, 0XD4, 0X6D, 0XEE, 0XCA, 0X6D, 0XB6, 0XC3, 0XC8, 0X46, 0XA8, 0XAC,
+  0X52, 0X23, 0X07, 0X88, 0XE3, 0XB8, 0X03, 0X1F, 0X70, 0X08, 0XF2, 0X9A,
+  0X10, 0X94, 0X1A, 0XD3, 0XF7, 0X64, 0XE7, 0X6B, 0XC3, 0XAE, 0XA5, 0XAD,
+  0X17, 0X64, 0X65, 0XD1, 0X04, 0XE8, 0X41, 0XFE, 0XAF, 0X5A, 0X8F, 0X57,
+  0X41, 0X4D, 0XC8, 0X0A, 0X44, 0X95, 0XC1, 0XD1, 0X54, 0X6F, 0X48, 0XC4,
+  0XFB, 0XEE, 0XB2, 0XAB, 0X37, 0X13, 0X2C, 0XC8, 0X76, 0X9D, 0X84, 0X25,
+  0X13, 0X17, 0XA9, 0X65, 0X8A, 0XE4, 0X40, 0XB7, 0X53, 0X07, 0X02, 0X31,
+  0X00, 0X07, 0X7F, 0X68, 0XCC, 0X72, 0X72, 0X63, 0X98, 0X63, 0XA2, 0X1B,
+  0X0D, 0XF9, 0X89, 0XE6, 0XAE, 0X70, 0XD6, 0X1C, 0X9E, 0X9C, 0XEF, 0X45,
+  0X22, 0X26, 0X6B, 0X33, 0XC5, 0XB4, 0X2C, 0XBA, 0X37, 0X21, 0X74, 0X84,
+  0X4C, 0X61, 0X59, 0X6C, 0XC5, 0XF0, 0XF0, 0X57, 0XF2, 0X1A, 0X37, 0X2B,
+  0X7F, 0X02, 0X04, 0X57, 0XEA, 0X02, 0X51, 0X50, 0XE0, 0XCF, 0X72, 0X5F,
+  0XB2, 0XC3, 0X90, 0X87, 0X73, 0X96, 0X6C, 0X68, 0XCD, 0XCE, 0X4D, 0XC1,
+  0X1E, 0X6F, 0X58, 0XCC, 0X37, 0X08, 0X00, 0XA7, 0X67, 0X9D, 0X4B, 0X29,
+  0X85, 0X47, 0X35, 0X19, 0XE8, 0X18, 0X08, 0XE9, 0XC4, 0XFA, 0X3B, 0X32,
+  0X40, 0X63, 0XE9, 0XF7, 0X55, 0XF8, 0X6C, 0XB9, 0XE0, 0X17, 0X03, 0XFB,
+  0X8C, 0X77, 0X1B, 0XF9, 0XC2, 0X5F, 0X95, 0X69, 0X68, 0X4F, 0X12, 0X59,
+  0X8E, 0X56, 0X42, 0X44, 0X83, 0X78, 0X7E, 0X96, 0X16, 0XCC, 0XE8, 0XFC,
+  0X86, 0X99, 0X20, 0X4F, 0X57, 0X4C, 0X4B, 0X37, 0X03, 0X02, 0XB6, 0X37,
+  0X80, 0XBF, 0X2B, 0X23, 0X4D, 0X0C, 0X26, 0X72, 0X88, 0X04, 0X15, 0X72,
+  0X3B, 0XF2, 0XF1, 0X5E, 0X2C, 0X1C, 0X95, 0X4B, 0XA5, 0X84, 0XE5, 0X07,
+  0X03, 0XB4, 0X49, 0X7B, 0X7E, 0X71, 0XAA, 0X7A, 0X3F, 0X3E, 0X87, 0X0F,
+  0XF9, 0X8A, 0XB6, 0XE0, 0X04, 0X42, 0X44, 0X26, 0XA8, 0X30, 0X2D, 0X63,
+  0XD6, 0XB4, 0X62, 0XAE, 0X67, 0X03, 0X8A, 0XB2, 0X37, 0X74, 0XE0, 0X03,
+  0XF7, 0XE4, 0XE9, 0X26, 0X96, 0X40, 0X23, 0X68, 0XCA, 0X74, 0XFE, 0X04,
+  0XC1, 0X07, 0X4C, 0XC7, 0X96, 0XE0, 0X04, 0X5C, 0X1D, 0X85, 0XF8, 0XDF,
+  0X85, 0X05, 0X04, 0X1E, 0XC8, 0X08, 0X90, 0XF4, 0X25, 0XE3, 0XE8, 0X71,
+  0X81, 0X32, 0XA7, 0XDA, 0X64, 0X51, 0X6F, 0XF2, 0X20, 0X16, 0X86, 0X69,
+  0X5D, 0X11, 0X5F, 0XF4, 0XF8, 0X3B, 0X9F, 0X47, 0X3B, 0XA6, 0X11, 0X21,
+  0XA7, 0X61, 0XD4, 0XE1, 0XCD, 0XB6, 0X35, 0X4A, 0X8C, 0X93, 0X71, 0XE9,
+  0X1E, 0XA6, 0X96, 0X4E, 0XBC, 0X28, 0X9A, 0XBA, 0XB2, 0XD1, 0X73, 0X4B,
+  0X14, 0X70, 0XE8, 0X46, 0X16, 0X91, 0X89, 0XF4, 0X99, 0X07, 0X45, 0XA6,
+  0X21, 0X60, 0XDC, 0XFB, 0X6C, 0X90, 0X7F, 0X6D, 0X2C, 0X3F, 0X1A, 0X24,
+  0X22, 0X9D, 0X94, 0X6C, 0X7F, 0X28, 0X8E, 0X13, 0XB4, 0X24, 0X52, 0X4D,
+  0X23, 0XCF, 0X64, 0X1E, 0XFB, 0XF3, 0XE7, 0XDB, 0XF0, 0X7D, 0X9A, 0X5F,
+  0XA7, 0X4F, 0X59, 0XF2, 0XBB, 0XED, 0X35, 0X48, 0XCF, 0XFC, 0X5B, 0XE5,
+  0X0D, 0X51, 0X9F, 0X80, 0X8E, 0X36, 0XA1, 0X0C, 0X8B, 0X00, 0X41, 0X9E,
+  0XBF, 0X81, 0XD9, 0XA6, 0X2B, 0X8C, 0X01, 0XC2, 0XA5, 0X0A, 0X5C, 0X81,
+  0XE2, 0XF9, 0X9E, 0X7C, 0XBB, 0XCE, 0X48, 0X00, 0X08, 0XAB, 0X12, 0XD3,
+  0X23, 0XE3, 0X06, 0XCF, 0XD0, 0X12, 0X8D, 0X4B, 0X27, 0XD1, 0XD6, 0XEA,
+  0XC3, 0XF6, 0X00, 0XFF, 0XF8, 0XB9, 0XF6, 0X3C, 0X78, 0X8A, 0X97, 0XC9,
+  0X40, 0X79, 0XD0, 0X29, 0XFA, 0XCD, 0X27, 0XBD, 0XC6, 0X28, 0X0E, 0XBC,
+  0X03, 0XB1, 0XA6, 0X48, 0X6C, 0XE3, 0X4B, 0XD3, 0X80, 0X54, 0X28, 0X78,
+  0XE7, 0X62, 0X69, 0XF1, 0X52, 0X00, 0XAE, 0X2D, 0X05, 0XF0, 0X1C, 0X5F,
+  0X30, 0X5C, 0X92, 0X20, 0XC5, 0XDC, 0X58, 0X3A, 0X9E, 0X09, 0X40, 0X86,
+  0X1F, 0XB2, 0X00, 0X0C, 0X9C, 0X02, 0X5D, 0X3F, 0X40, 0X48, 0XA8, 0XC9,
+  0X01, 0X4B, 0XB2, 0X19, 0X67, 0XE3, 0XCB, 0XD3, 0X6E, 0XD6, 0X29, 0X1E,
+  0XCB, 0X79, 0XC5, 0XA9, 0X6F, 0X2F, 0X90, 0X0B, 0X4B, 0X90, 0X10, 0X15,
+  0X62, 0X7E, 0XE7, 0X48, 0X98, 0X47, 0X3B, 0X2A, 0X24, 0X13, 0X7F, 0X17,
+  0X90, 0X1D, 0X75, 0X61, 0XA2, 0XEA, 0XD3, 0X01, 0X52, 0X16, 0X0A, 0X6E,
+  0X57, 0X27, 0X48, 0X2C, 0X3B, 0XA2, 0X07, 0XC9, 0XE1, 0X4E, 0XF5, 0X04,
+  0X8F, 0X4C, 0X73, 0X43, 0X4B, 0XD4, 0XA7, 0X68, 0XD3, 0X71, 0X01, 0X21,
+  0X73, 0X82, 0X27, 0XAD, 0X19, 0X43, 0X91, 0X60, 0XB6, 0X3A, 0XEE, 0X8A,
+  0X57, 0XB9, 0X85, 0X56, 0X1F, 0X92, 0X59, 0X25, 0X81, 0XBD, 0X57, 0X27,
+  0XF7, 0X29, 0XFB, 0X51, 0X80, 0X89, 0XAD, 0XBE, 0XAD, 0X9A, 0XBD, 0X79,
+  0XF7, 0XBE, 0X68, 0XBC, 0X23, 0X71, 0X6E, 0X93, 0X6F, 0X1C, 0X48, 0X4F,
+  0X29, 0X09, 0X90, 0X30, 0XA5, 0XC1, 0XF4, 0X28, 0XA7, 0X1C, 0XF6, 0XA4,
+  0XE9, 0XCF, 0X30, 0X04, 0X67, 0X5B, 0XEA, 0XBE, 0X02, 0X13, 0XAA, 0X6E,
+  0X2F, 0X0A, 0X9F, 0X99, 0X79, 0XD0, 0X2C, 0X08, 0XED, 0XDE, 0XF5, 0XDD,
+  0XAA, 0XB0, 0XB4, 0X68, 0X9D, 0XB4, 0X23, 0X69, 0X76, 0X11, 0X93, 0XCC,
+  0X63, 0XC3, 0X02, 0X04, 0X86, 0XB0, 0XCF, 0X83, 0X21, 0X22, 0XFA, 0X6B,
+  0XB7, 0X00, 0XF2, 0X16, 0X4D, 0X2E, 0X25, 0XA9, 0X95, 0X3C, 0X13, 0X5C,
+  0X09, 0X4C, 0X32, 0XC6, 0X47, 0X77, 0XDF, 0XC3, 0XB8, 0XD2, 0X92, 0XB6,
+  0X67, 0X4D, 0X55, 0XF3, 0XD8, 0X2A, 0XBA, 0XB8, 0XB2, 0X53, 0X7A, 0X1E,
+  0X34, 0X88, 0X30, 0X2B, 0X16, 0X3C, 0XC7, 0XD8, 0XCF, 0X83, 0X19, 0X38,
+  0X8B, 0X05, 0XC7, 0X4F, 0X46, 0X82, 0X12, 0X39, 0X50, 0X7D, 0X9A, 0X37,
+  0XCB, 0XE5, 0X48, 0X2A, 0X13, 0XEC, 0X22, 0X8A, 0X0A, 0XED, 0X42, 0X81,
+  0X39, 0X1E, 0XD6, 0X97, 0X26, 0X88, 0X92, 0XEF, 0X09, 0X53, 0XB0, 0X7D,
+  0X4D, 0XC4, 0X7F, 0X49, 0XE5, 0X15, 0X0E, 0X99, 0X00, 0XC8, 0XA3, 0XEC,
+  0X3B, 0X3E, 0XED, 0XC9, 0X10, 0XB5, 0X8B, 0X80, 0X0B, 0X78, 0XCA, 0XBA,
+  0XC2, 0X88, 0XD0, 0X31, 0X7F, 0X63, 0X76, 0X6B, 0X59, 0X40, 0X8D, 0X27,
+  0X34, 0XD0, 0XAA, 0X36, 0X31, 0X05, 0X68, 0XEB, 0XD3, 0X7F, 0X3D, 0X96,
+  0X41, 0X80, 0X4E, 0X58, 0XB9, 0XBD, 0X30, 0XC9, 0XE6, 0X75, 0X21, 0X56,
+  0XE7, 0X54, 0X40, 0X3B, 0XF9, 0XE5, 0XFE, 0X82, 0X4D, 0X8A, 0X22, 0X7F,
+  0X99, 0X3B, 0X47, 0X08, 0X88, 0X74, 0X69, 0X90, 0X26, 0X4C, 0XAD, 0X20,
+  0X79, 0X9D, 0XE1, 0XB4, 0X9F, 0X93, 0XC4, 0X03, 0X35, 0XEE, 0X97, 0XFB,
+  0XE3, 0X98, 0XE5, 0X7D, 0X1E, 0X1B, 0XAC, 0X04, 0X42, 0X97, 0XCD, 0XD7,
+  0XBE, 0XCA, 0X49, 0X67, 0X29, 0X9D, 0XAA, 0X74, 0X6D, 0XF7, 0X28, 0X89,
+  0X9C, 0XCD, 0X40, 0X3C, 0X71, 0X66, 0XE3, 0XB3, 0XC5, 0X47, 0X4A, 0X91,
+  0X61, 0XCD, 0X0A, 0X8F, 0X9B, 0XB7, 0X4C, 0X65, 0X91, 0XF6, 0XFB, 0X9B,
+  0XF8, 0XBD, 0XD3, 0X04, 0X1A, 0X9E, 0XBD, 0X55, 0X68, 0X57, 0XC2, 0X24,
+  0XD8, 0XFC, 0X4E, 0X31, 0XE5, 0XCB, 0X04, 0X34, 0X29, 0X5E, 0XB1, 0XDC,
+  0XF9, 0X1C, 0XAF, 0XCD, 0XB6, 0XA8, 0XCF, 0XA0, 0X8D, 0XD6, 0X3A, 0XBC,
+  0X54, 0XD8, 0X73, 0XBB, 0X45, 0X9C, 0XF2, 0XD4, 0X7D, 0X01, 0X66, 0X20,
+  0X64, 0X9F, 0XE1, 0X10, 0X01, 0X00, 0X25, 0XB8, 0XBE, 0X71, 0X65, 0XDD,
+  0X48, 0X94, 0X24, 0X8F, 0XFF, 0X3C, 0XF4, 0XE0, 0X8B, 0XAA, 0XEF, 0X66,
+  0X49, 0XA3, 0X95, 0XC6, 0X74, 0XBF, 0X1B, 0XB7, 0X8A, 0X3E, 0X0E, 0X50,
+  0X13, 0X19, 0X88, 0XAA, 0XF8, 0X3A, 0XA0, 0X8D, 0X84, 0XAD, 0X85, 0X72,
+  0X65, 0XAE, 0XA0, 0X19, 0XD7, 0X5F, 0XCD, 0XE0, 0X49, 0X30, 0XA5, 0X86,
+  0X47, 0XE6, 0XC4, 0X40, 0X05, 0XFE, 0XE4, 0X3D, 0XAE, 0XAF, 0X1F, 0XCC,
+  0X4B, 0X13, 0X20, 0X6C, 0X95, 0X2B, 0X8D, 0X10, 0X68, 0X95, 0X49, 0X15,
+  0XFE, 0XFD, 0XAB, 0X47, 0X58, 0XEF, 0X9A, 0X1F, 0XD5, 0X01, 0XFB, 0XF9,
+  0XDC, 0X16, 0XCC, 0X93, 0XE4, 0XE2, 0X3B, 0X08, 0X44, 0X18, 0X55, 0X25,
+  0XF7, 0XF8, 0X7A, 0X44, 0X2C, 0XA9, 0XC4, 0XD7, 0XDC, 0XF5, 0X98, 0X46,
+  0X28, 0X5A, 0XB7, 0X63, 0X2D, 0X3E, 0X6E, 0XB4, 0XCA, 0X1C, 0X4E, 0X57,
+  0X94, 0X56, 0XB8, 0X0D, 0X6B, 0X7B, 0XE2, 0X27, 0X2A, 0XA4, 0X36, 0X38,
+  0X87, 0XFD, 0X22, 0X82, 0XF9, 0XBE, 0X4B, 0X6E, 0X08, 0X5D, 0XC8, 0X2D,
+  0XBE, 0XC2, 0X95, 0XF3, 0X24, 0XDF, 0X46, 0X44, 0X71, 0X4B, 0X30, 0XB7,
+  0XB2, 0X6F, 0X9F, 0XBE, 0X58, 0X1E, 0X78, 0XCD, 0XE8, 0XB9, 0XFB, 0X20,
+  0XC3, 0X1E, 0X22, 0X6E, 0X90, 0X42, 0X30, 0X71, 0X76, 0X9F, 0X5E, 0X9C,
+  0XF0, 0X6B, 0X47, 0X6B, 0X63, 0X18, 0X03, 0X46, 0X8C, 0XC9, 0X90, 0X55,
+  0XA2, 0XDE, 0X35, 0XA8, 0X6D, 0XE0, 0X5C, 0X14, 0X28, 0XF6, 0X2B, 0X38,
+  0XB0, 0X6F, 0X38, 0X22, 0X97, 0X4C, 0X0D, 0X03, 0XBE, 0X3F, 0XB6, 0X7A,
+  0XA1, 0X18, 0X7F, 0XB0, 0X42, 0XCE, 0XD6, 0XA5, 0X4D, 0X9C, 0XF7, 0X03,
+  0X17, 0XB3, 0X27, 0XBF, 0X47, 0X82, 0XEA, 0X19, 0X50, 0X6D, 0X2C, 0X4D,
+  0X42, 0X5A, 0X06, 0X0D, 0XE7, 0X7C, 0XB1, 0X78, 0X01, 0X0C, 0X0A, 0XCC,
+  0X2F, 0X06, 0X78, 0X75, 0X4F, 0XB4, 0XC9, 0X6F, 0XF3, 0XE7, 0X79, 0X83,
+  0XD5, 0XF4, 0XEB, 0X32, 0X56, 0X1B, 0X9E, 0X3A, 0X3B, 0X2C, 0X21, 0XD8,
+  0XCD, 0X32, 0XE2, 0X6B, 0X52, 0X8D, 0X25, 0XBA, 0X76, 0XBA, 0XEC, 0XCA,
+  0XAD, 0X7D, 0X50, 0X40, 0X3F, 0X42, 0X7E, 0XBE, 0X53, 0X11, 0X99, 0X24,
+  0XAE, 0X95, 0X9C, 0X2E, 0X43, 0XD3, 0X96, 0XA5, 0X6A, 0X00, 0X10, 0X28,
+  0XAE, 0X20, 0X51, 0XA2, 0XD2, 0X51, 0X29, 0X9A, 0XCF, 0XCA, 0XB9, 0X8A,
+  0XC5, 0XC6, 0X7D, 0X24, 0X3E, 0X10, 0X8A, 0X01, 0X29, 0X32, 0XA7, 0X33,
+  0X59, 0X33, 0X3B, 0X6C, 0X18, 0X3E, 0X9D, 0X8B, 0X49, 0X0B, 0X75, 0X49,
+  0XB5, 0X05, 0XD9, 0X4E, 0X50, 0X10, 0X98, 0X09, 0X58, 0X36, 0X2D, 0X00,
+  0XF9, 0X34, 0XD4, 0X8D, 0X4A, 0X81, 0X36, 0XCD, 0XA9, 0X3E, 0X24, 0X83,
+  0XCD, 0XBE, 0XB0, 0X45, 0XE4, 0XC6, 0XC9, 0XF6, 0X5B, 0X29, 0XBF, 0X16,
+  0X66, 0X21, 0XB7, 0X8A, 0XAB, 0XDD, 0X12, 0X0C, 0XC7, 0XB1, 0X47, 0XE9,
+  0X56, 0X70, 0XF1, 0X9D, 0XA8, 0X38, 0X51, 0X8B, 0X5A, 0X92, 0X06, 0XF6,
+  0X4C, 0XDA, 0X4A, 0X5D, 0X42, 0X34, 0XD0, 0X1A, 0X53, 0X7C, 0X25, 0X60,
+  0XE8, 0X04, 0X72, 0X11, 0XD3, 0X65, 0XE0, 0X8B, 0X6A, 0X0B, 0X19, 0X67,
+  0X0C, 0X55, 0XB7, 0X42, 0X7C, 0XD7, 0X82, 0XF9, 0XD2, 0X86, 0X69, 0X35,
+  0XF1, 0X41, 0X1C, 0X05, 0XE0, 0X5F, 0X09, 0X4A, 0XF4, 0X37, 0X3B, 0X6B,
+  0X97, 0X2B, 0X5E, 0X6F, 0XCA, 0X67, 0X96, 0XF4, 0X1D, 0XDB, 0X00, 0X21,
+  0X2C, 0X7C, 0X34, 0X01, 0X24, 0X8D, 0X98, 0X2B, 0XEF, 0XD9, 0X22, 0XBA,
+  0X13, 0X10, 0XC6, 0XCD, 0X9B, 0X37, 0X63, 0XFB, 0XB3, 0X15, 0X07, 0X25,
+  0X83, 0X51, 0XAA, 0X09, 0X15, 0X6A, 0X8E, 0X2C, 0XAD, 0X38, 0X79, 0X98,
+  0X05, 0X0F, 0XC8, 0X40, 0X51, 0XD0, 0X76, 0X20, 0XAC, 0XAA, 0XCE, 0X46,
+  0XE6, 0XF5, 0XD9, 0X2A, 0X59, 0X4E, 0XDA, 0XF3, 0X3B, 0XA2, 0XBB, 0X24,
+  0X83, 0X22, 0X6D, 0X7C, 0X6B, 0XBF, 0X74, 0X1C, 0X9D, 0X18, 0X64, 0X49,
+  0XFF, 0XBC, 0X24, 0X43, 0X40, 0XA7, 0X93, 0X87, 0X26, 0X87, 0X55, 0X4B,
+  0XDC, 0XA6, 0X26, 0X75, 0XAD, 0XF3, 0XB1, 0XB7, 0X41, 0X86, 0X62, 0XA3,
+  0XC1, 0X0D, 0XD0, 0X5C, 0X45, 0X52, 0X93, 0X08, 0X5F, 0X5F, 0X3B, 0X7F,
+  0X74, 0XC0, 0X26, 0X38, 0XF5, 0X68, 0XF7, 0X43, 0X9F, 0XA8, 0XB7, 0X07,
+  0X7D, 0X60, 0X2E, 0XF7, 0XDA, 0X1E, 0XCB, 0XD9, 0X33, 0XA2, 0XD4, 0X8F,
+  0XA0, 0X42, 0X56, 0X04, 0X13, 0XFC, 0X71, 0XE4, 0X2F, 0XEC, 0X01, 0XDC,
+  0X2D, 0XB3, 0X7F, 0X84, 0X53, 0X07, 0X91, 0X0A, 0XFB, 0XD0, 0XC1, 0XD2,
+  0XFB, 0XD9, 0X43, 0X99, 0XEF, 0XDD, 0XEA, 0X94, 0X6D, 0X16, 0X60, 0X51,
+  0X34, 0X8D, 0X74, 0X89, 0X92, 0XA9, 0X9B, 0XEB, 0X56, 0X1E, 0XC4, 0XAC,
+  0XD7, 0XB7, 0X40, 0XA2, 0X5A, 0XD0, 0XE7, 0X6A, 0X22, 0X29, 0X75, 0X47,
+  0XBD, 0XDE, 0X1B, 0XB5, 0X99, 0X59, 0XB7, 0X80, 0XEC, 0X3E, 0XF6, 0XC8,
+  0X69, 0XCB, 0XE6, 0X81, 0XC1, 0X3B, 0X31, 0X39, 0XFE, 0XDB, 0XCE, 0XB9,
+  0X73, 0X86, 0X4C, 0X8F, 0XFE, 0X55, 0XAE, 0X69, 0X89, 0X76, 0X85, 0XF5,
+  0X2A, 0XB5, 0X0B, 0X5E, 0XA8, 0XCD, 0XE9, 0X32, 0XA2, 0X89, 0X36, 0X5D,
+  0XD7, 0X41, 0X04, 0X84, 0X5D, 0X70, 0X1A, 0X46, 0X29, 0X1D, 0X3C, 0XFF,
+  0XBB, 0XB5, 0XB9, 0X61, 0X3A, 0XD1, 0X2F, 0XE7, 0X77, 0X8C, 0XB2, 0X19,
+  0XA1, 0XF9, 0XCC, 0X4A, 0X47, 0X47, 0X0B, 0XFD, 0XE1, 0XC0, 0XE7, 0XA6,
+  0X01, 0X92, 0X16, 0XB7, 0XA8, 0X27, 0XFB, 0X83, 0X90, 0XAC, 0XD2, 0X06,
+  0X88, 0X23, 0X17, 0X2E, 0X88, 0X07, 0X83, 0X8D, 0X8B, 0X24, 0XA3, 0XF1,
+  0XF6, 0XB4, 0X6B, 0XFC, 0X72, 0XEC, 0X4E, 0XEF, 0XF7, 0XFE, 0XEB, 0XF6,
+  0X76, 0X4F, 0XCB, 0XDC, 0X1D, 0X55, 0X67, 0X17, 0X2A, 0X2E, 0XEE, 0XAD,
+  0X6B, 0X19, 0X38, 0XA3, 0X5C, 0X8F, 0XF6, 0XCE, 0X5D, 0X03, 0XB6, 0X8D,
+  0XA9, 0X2C, 0XB5, 0X96, 0X5E, 0X7F, 0X67, 0X33, 0X48, 0X39, 0X0C, 0XE0,
+  0X81, 0X0C, 0XAE, 0X2C, 0X82, 0XB5, 0XE2, 0XFA, 0X41, 0X3B, 0X72, 0XE4,
+  0X8E, 0XF9, 0X87, 0X7A, 0X61, 0X61, 0X42, 0XE3, 0XC2, 0XCE, 0XF7, 0XC7,
+  0X4E, 0X16, 0XBB, 0X9D, 0XEB, 0X9E, 0X97, 0XBD, 0XF8, 0X16, 0X6B, 0X74,
+  0XDE, 0XB6, 0X20, 0XAD, 0XDC, 0X88, 0XF9, 0X17, 0X1D, 0XF1, 0XA8, 0X92,
+  0X7A, 0X22, 0X2C, 0XC1, 0XD9, 0X14, 0XF3, 0XF8, 0X9F, 0X21, 0X3B, 0XC3,
+  0X84, 0X0D, 0XD0, 0X45, 0X41, 0X57, 0X5E, 0X3C, 0X1C, 0XEB, 0X01, 0X23,
+  0XF3, 0X62, 0XF1, 0XED, 0X61, 0XB8, 0X07, 0XD9, 0X26, 0X6D, 0X72, 0XD1,
+  0X6F, 0XA9, 0X1E, 0X6D, 0XB6, 0X79, 0XCB, 0X8E, 0XC2, 0X66, 0XC9, 0XFA,
+  0X81, 0XF9, 0XAF, 0X4E, 0X01, 0XFF, 0X38, 0XB7, 0X65, 0X03, 0X79, 0X50,
+  0X68, 0X5C, 0X28, 0XBA, 0XDD, 0XCD, 0X67, 0XEF, 0X97, 0XC3, 0X2C, 0XC4,
+  0XA6, 0X5B, 0X28, 0XAC, 0X73, 0XEC, 0X3F, 0XFB, 0X69, 0XF5, 0XFA, 0X81,
+  0X57, 0XC4, 0X41, 0XC2, 0X7A, 0XDB, 0X9A, 0X17, 0X44, 0X1A, 0X82, 0X0A,
+  0XCB, 0X86, 0XE6, 0X9C, 0X8D, 0X37, 0X21, 0X49, 0X8F, 0XD7, 0X1C, 0XB4,
+  0XBB, 0X80, 0XDF, 0X2E, 0XD6, 0X84, 0X5C, 0XA1, 0X33, 0X0A, 0X5E, 0X9F,
+  0X0B, 0X2F, 0X56, 0X31, 0X13, 0X84, 0X72, 0XB0, 0X49, 0X83, 0X27, 0X2C,
+  0XD4, 0X5A, 0X88, 0X46, 0X6A, 0X99, 0X2F, 0X8E, 0X5D, 0XA2, 0X96, 0XF6,
+  0X99, 0X2F, 0X72, 0XD5, 0X86, 0X44, 0XD3, 0XAB, 0X9C, 0XCC, 0X44, 0X40,
+  0X33, 0X7F, 0XF1, 0XF6, 0X3C, 0X01, 0X2C, 0X9F, 0X0E, 0X43, 0X5B, 0XB6,
+  0X4E, 0X70, 0XF4, 0X21, 0X74, 0XDE, 0X9C, 0XDB, 0X5A, 0X2A, 0X28, 0X39,
+  0X85, 0X8D, 0X8C, 0XE6, 0XE6, 0XF5, 0XE7, 0X68, 0X6B, 0XD8, 0X4A, 0X14,
+  0XE1, 0XC6, 0X94, 0X83, 0X47, 0XCB, 0X85, 0X3D, 0X2E, 0X7E, 0X8D, 0X4E,
+  0XEA, 0XFE, 0XE0, 0X49, 0X84, 0XC1, 0X4B, 0XA2, 0X53, 0X26, 0X5E, 0X7A,
+  0XBE, 0X97, 0X9B, 0XE1, 0XF7, 0XF3, 0XC1, 0XDD, 0XF3, 0X57, 0X44, 0XA6,
+  0XEE, 0X94, 0XB3, 0X67, 0XAD, 0XA0, 0X69, 0X5A, 0X36, 0X6C, 0X7D, 0XD2,
+  0XB2, 0XE4, 0X90, 0X0B, 0X35, 0X87, 0XCB, 0XC7, 0X7D, 0X7E, 0X55, 0XED,
+  0XF9, 0X84, 0XC4, 0XEB, 0XF0, 0XDC, 0XDC, 0X2E, 0XEF, 0XB3, 0XFB, 0X40,
+  0X88, 0X71, 0XE9, 0XDB, 0XBA, 0XB9, 0XA5, 0X2F, 0X36, 0XB1, 0XB0, 0XC5,
+  0XC2, 0XF8, 0XFE, 0XDD, 0X60, 0XC0, 0XDB, 0XA4, 0XA3, 0XBD, 0X35, 0X05,
+  0XB6, 0XF0, 0X98, 0X4A, 0X7C, 0X8D, 0X10, 0XDE, 0X61, 0X4D, 0XCD, 0XAF,
+  0X8E, 0X2E, 0X4A, 0X0F, 0X22, 0X09, 0XEB, 0X5A, 0XD5, 0XAC, 0XC5, 0X0D,
+  0X5D, 0X58, 0XBE, 0XB5, 0X0D, 0XEA, 0X96, 0XE8, 0XE4, 0X99, 0XFA, 0XCB,
+  0XC0, 0X92, 0XEF, 0X78, 0X69, 0XE3, 0XF9, 0X87, 0XBA, 0X0B, 0X1E, 0XE2,
+  0X09, 0XE9, 0X55, 0X16, 0XE9, 0X1A, 0XA0, 0X76, 0XBD, 0XBA, 0X88, 0XEC,
+  0X28, 0XC5, 0X78, 0X58, 0X7D, 0X2F, 0X44, 0X1B, 0X46, 0XB2, 0XDA, 0XD6,
+  0X61, 0X89, 0X2F, 0X71, 0X34, 0X35, 0XA1, 0X45, 0XDE, 0XC0, 0X1B, 0X08,
+  0XED, 0X68, 0X5D, 0X38, 0XA1, 0X8D, 0XCE, 0X02, 0XDA, 0X72, 0XFC, 0XF0,
+  0XA9, 0X23, 0X03, 0X92, 0XE8, 0X44, 0XD4, 0X3C, 0X12, 0X08, 0X07, 0X1E,
+  0X4C, 0X2F, 0X21, 0X6C, 0XE2, 0XB2, 0X37, 0X60, 0XFE, 0X74, 0XD0, 0XE7,
+  0X5E, 0X54, 0X0B, 0X12, 0XBF, 0XCB, 0X64, 0X48, 0XFF, 0X61, 0X9D, 0X95,
+  0XAB, 0X45, 0XDB, 0X54, 0X42, 0X3C, 0XEC, 0X27, 0XAF, 0X25, 0X43, 0X3B,
+  0XA7, 0XC7, 0X51, 0XD5, 0XFE, 0XB9, 0X93, 0XFE, 0XA1, 0XFF, 0XEF, 0XF4,
+  0XA6, 0XF1, 0X90, 0XF5, 0X94, 0XCD, 0X0E, 0X7A, 0X64, 0X7B, 0X83, 0X99,
+  0X31, 0X44, 0XDC, 0XC0, 0X40, 0XD8, 0X26, 0X48, 0XEF, 0X91, 0XD6, 0X58,
+  0X02, 0X3C, 0XE3, 0X96, 0XAC, 0XA1, 0X81, 0X24, 0X77, 0X4B, 0X84, 0XEB,
+  0X43, 0XD5, 0X70, 0X1B, 0XB8, 0X9E, 0X22, 0X8D, 0X72, 0XDB, 0X21, 0XE8,
+  0XA3, 0XC1, 0X1D, 0X67, 0X44, 0XCD, 0XF2, 0X83, 0X9D, 0X6A, 0X6D, 0X49,
+  0X9B, 0X0D, 0X35, 0X34, 0X38, 0X86, 0X31, 0XDA, 0X0D, 0X11, 0XC4, 0XBC,
+  0X28, 0X79, 0X13, 0X24, 0X43, 0X55, 0X73, 0X54, 0X86, 0XA8, 0XDB, 0XC0,
+  0X17, 0X48, 0X20, 0XD1, 0X85, 0X55, 0X64, 0XB2, 0X44, 0X44, 0XA2, 0X4D,
+  0X22, 0X12, 0XA9, 0X74, 0X73, 0X79, 0X98, 0X68, 0X42, 0X33, 0X06, 0X5D,
+  0XA1, 0X8E, 0X4A, 0X09, 0X96, 0X5B, 0X74, 0XBB, 0X40, 0XFE, 0X24, 0X98,
+  0XA5, 0XA4, 0X24, 0XB5, 0X3E, 0X08, 0X46, 0X85, 0XA2, 0XFE, 0X25, 0X86,
+  0X60, 0X80, 0XB1, 0X41, 0X3F, 0X63, 0XA3, 0X04, 0X36, 0X48, 0X0E, 0X24,
+  0XD4, 0XB4, 0X5E, 0XBA, 0X13, 0XFD, 0XC9, 0XB0, 0X9C, 0X6A, 0X8B, 0X61,
+  0X7F, 0X00, 0X22, 0X39, 0X49, 0X9F, 0X57, 0XEF, 0X18, 0XE7, 0XDB, 0X22,
+  0X58, 0X58, 0X2F, 0X6F, 0X4C, 0X77, 0X08, 0X76, 0X45, 0XB6, 0X88, 0X90,
+  0X69, 0X81, 0X43, 0X55, 0X43, 0X33, 0X57, 0XCC, 0X60, 0X19, 0XBF, 0XF3,
+  0X06, 0X6A, 0XDD, 0X51, 0X67, 0X6F, 0X6F, 0XAA, 0XB8, 0X0B, 0X95, 0XA4,
+  0XAF, 0XC8, 0X17, 0XEC, 0XC0, 0X7D, 0XD8, 0X1D, 0X98, 0XD7, 0XAE, 0XCD,
+  0X25, 0X24, 0XB7, 0XD7, 0X9E, 0X04, 0X1B, 0X0E, 0X51, 0X9E, 0X37, 0X06,
+  0X90, 0X01, 0XFE, 0X11, 0X3A, 0X66, 0X7F, 0XFD, 0X68, 0XB8, 0XB0, 0X99,
+  0X03, 0X8A, 0XEF, 0XC7, 0XDF, 0X87, 0XC9, 0XD3, 0X01, 0X45, 0XE4, 0X00,
+  0X2F, 0XA1, 0XCE, 0X7A, 0XEB, 0XB7, 0X89, 0XA0, 0XA4, 0XA3, 0X4A, 0XF5,
+  0XF7, 0X67, 0XF6, 0X4A, 0XF2, 0X92, 0X08, 0X5E, 0XF7, 0X40, 0XBF, 0X17,
+  0X7F, 0X24, 0XC6, 0X50, 0XB6, 0XD6, 0XAE, 0X96, 0X6E, 0XC9, 0X9D, 0XF1,
+  0XAB, 0X8D, 0X36, 0X15, 0X71, 0X27, 0X85, 0X44, 0XFC, 0X0A, 0XCE, 0XF0,
+  0X24, 0XE9, 0X3B, 0XC2, 0X95, 0X87, 0X31, 0XBD, 0X71, 0X96, 0XC0, 0XBD,
+  0XBE, 0XF3, 0X46, 0XA8, 0X9F, 0X05, 0XA8, 0X59, 0XC1, 0X6D, 0XCA, 0X8C,
+  0XB6, 0X53, 0X3F, 0XEF, 0X17, 0X7C, 0XE9, 0XD6, 0X1D, 0X3D, 0XF0, 0XD0,
+  0X42, 0XE7, 0XAD, 0XDC, 0X30, 0X60, 0XFD, 0XEF, 0XD9, 0XBE, 0X3D, 0X5E,
+  0X11, 0XEF, 0XE7, 0X93, 0X33, 0XB7, 0X55, 0X62, 0X0E, 0X3C, 0X57, 0X37,
+  0X94, 0XB9, 0XF3, 0X2D, 0XBE, 0X5E, 0X01, 0XD5, 0X42, 0XB4, 0X3D, 0XD1,
+  0XC1, 0X09, 0X71, 0XA9, 0X76, 0X77, 0X66, 0XE2, 0X0E, 0X26, 0XD1, 0XC7,
+  0X85, 0X90, 0X38, 0X62, 0X6B, 0X72, 0XB1, 0X6F, 0X10, 0XD0, 0X81, 0X37,
+  0XB8, 0XBF, 0X9F, 0XAB, 0X57, 0X9F, 0X16, 0X56, 0X51, 0XFC, 0XDF, 0X77,
+  0XB5, 0XB8, 0XF3, 0XBE, 0X4B, 0X1B, 0X4C, 0X6C, 0X9F, 0X33, 0X0F, 0X3F,
+  0X78, 0X11, 0XAC, 0XF7, 0X6D, 0X43, 0X7A, 0XB3, 0XDD, 0X68, 0X10, 0X0D,
+  0XF6, 0X8B, 0X1E, 0X14, 0X5B, 0X7D, 0X78, 0X36, 0X98, 0X57, 0X74, 0XA6,
+  0X94, 0X48, 0X55, 0X15, 0X9C, 0X17, 0XAB, 0XDC, 0XA8, 0X90, 0X99, 0XB8,
+  0X77, 0X88, 0X2E, 0X5E, 0X6F, 0XD7, 0XB6, 0X03, 0X34, 0XAC, 0X1D, 0XAE,
+  0X27, 0X96, 0XC1, 0X23, 0X83, 0X5A, 0X8A, 0XA1, 0X6C, 0XB2, 0X5A, 0X03,
+  0XA6, 0X73, 0X9C, 0X94, 0X92, 0XAF, 0XAB, 0X7D, 0X97, 0X6D, 0X99, 0XA9,
+  0X73, 0X0B, 0XE3, 0XB9, 0X18, 0XD8, 0X8D, 0XB8, 0XEF, 0X47, 0XB0, 0XC4,
+  0XDA, 0X00, 0X47, 0X27, 0X7E, 0XA0, 0X3F, 0X33, 0X0C, 0X8F, 0X73, 0XA8,
+  0X40, 0X0C, 0X5F, 0X43, 0X6E, 0X37, 0XFA, 0X3B, 0X1C, 0X89, 0X8C, 0X08,
+  0X7F, 0X50, 0X41, 0XA8, 0XDA, 0X5E, 0X5D, 0X25, 0XBD, 0XBD, 0X84, 0X01,
+  0X83, 0X06, 0X0A, 0XDC, 0X3D, 0X81, 0XCF, 0XBC, 0X59, 0X09, 0XB3, 0XE0,
+  0X12, 0XA4, 0XFD, 0X46, 0X95, 0X7E, 0XC1, 0XC2, 0X7D, 0X20, 0X66, 0XAF,
+  0XAE, 0XBD, 0X78, 0XDD, 0XA0, 0X40, 0X22, 0X62, 0X46, 0X54, 0X01, 0X43,
+  0XDA, 0X58, 0X63, 0X25, 0X14, 0XC0, 0X6C, 0XC5, 0X09, 0XAF, 0X6A, 0X9D,
+  0X7B, 0XA7, 0X20, 0X4B, 0XD6, 0XBA, 0X9E, 0X10, 0X8D, 0XA0, 0XB7, 0XED,
+  0XA0, 0X81, 0X15, 0XD9, 0X74, 0X8E, 0XB7, 0X56, 0X77, 0X83, 0X31, 0X08,
+  0X26, 0XD3, 0X4A, 0XA4, 0XA2, 0X57, 0X17, 0XB8, 0X49, 0X37, 0X5E, 0X72,
+  0X95, 0XF6, 0X8E, 0XAC, 0X66, 0XBA, 0XA1, 0XBD, 0X29, 0XB3, 0XD7, 0X7E,
+  0X46, 0X6B, 0X8D, 0X5A, 0X3D, 0X75, 0XC6, 0X0A, 0X39, 0XDB, 0XC0, 0XA9,
+  0XFD, 0X80, 0X48, 0XEC, 0X52, 0X27, 0X94, 0X1C, 0X05, 0XF7, 0X61, 0X47,
+  0X49, 0X2E, 0X7C, 0X3A, 0XCC, 0XE2, 0X33, 0XDD, 0X47, 0XCF, 0X6D, 0XB3,
+  0X33, 0X22, 0XBF, 0X32, 0X1A, 0XD9, 0XE3, 0XC3, 0X22, 0XDB, 0X3A, 0X6A,
+  0XF4, 0X4D, 0X01, 0X81, 0XF6, 0XF0, 0X28, 0X3F, 0X8B, 0X9B, 0X2D, 0X03,
+  0X10, 0XA5, 0X52, 0X58, 0X81, 0X82, 0XB9, 0X69, 0XDF, 0X6C, 0X68, 0XDE,
+  0XE0, 0X3E, 0XF1, 0XC6, 0X5D, 0X02, 0XE2, 0XAF, 0X36, 0XC7, 0XDE, 0X71,
+  0X7B, 0XBD, 0XAA, 0X99, 0X02, 0X76, 0X23, 0X93, 0XC0, 0XC5, 0X3E, 0X41,
+  0XC2, 0XD5, 0X75, 0XA0, 0X28, 0X07, 0X36, 0X6E, 0X0E, 0XDC, 0X37, 0X1B,
+  0XEC, 0X1F, 0X0F, 0X10, 0X56, 0X75, 0X2C, 0XEE, 0X9A, 0XE3, 0XB0, 0X53,
+  0X54, 0XDC, 0X19, 0X7A, 0XD8, 0X1F, 0X6E, 0X1E, 0X42, 0X0F, 0X5D, 0X6E,
+  0X64, 0X49, 0X0B, 0X71, 0X0E, 0X12, 0XFF, 0XBA, 0X7E, 0XFA, 0X6B, 0X43,
+  0X44, 0X98, 0X30, 0X67, 0X4E, 0X9F, 0XBF, 0X4B, 0XBF, 0XC8, 0X48, 0XAE,
+  0X7B, 0XA1, 0XBC, 0XA0, 0X82, 0X31, 0X3D, 0X49, 0X4E, 0X88, 0X13, 0XEE,
+  0X6C, 0X80, 0X2F, 0X13, 0X43, 0X0C, 0XC9, 0X92, 0X83, 0X30, 0X39, 0X34,
+  0X35, 0X87, 0XA2, 0X2B, 0XD0, 0X9A, 0X0D, 0X71, 0X17, 0XE9, 0X9F, 0XE7,
+  0X41, 0X88, 0X1F, 0X6D, 0X33, 0X56, 0X77, 0X39, 0X22, 0X58, 0X73, 0X85,
+  0XBC, 0X23, 0X49, 0XF6, 0XD3, 0XEB, 0X6D, 0XD6, 0XEE, 0X6D, 0XBF, 0X25,
+  0XDF, 0XB6, 0X9B, 0X89, 0X24, 0XF3, 0X01, 0XEA, 0X2F, 0XF4, 0XCC, 0XB3,
+  0XAA, 0XD0, 0X0E, 0XA0, 0X63, 0XDB, 0X93, 0X2E, 0X5B, 0X1A, 0X43, 0X9D,
+  0X37, 0X4B, 0X8D, 0XC7, 0X10, 0X9B, 0XCD, 0X99, 0XCE, 0X96, 0X24, 0X4E,
+  0X81, 0X8C, 0XF1, 0X7E, 0XF5, 0XA6, 0X94, 0X65, 0X03, 0X5C, 0XA8, 0X0B,
+  0X66, 0XAC, 0X8E, 0X03, 0X55, 0X12, 0X12, 0X66, 0X17, 0X05, 0X7C, 0X96,
+  0X3A, 0X00, 0XBA, 0X02, 0XC6, 0XDF, 0X3C, 0XD4, 0XBB, 0XF5, 0XA5, 0X13,
+  0X78, 0XF2, 0X77, 0XC3, 0X83, 0X99, 0X70, 0XEA, 0X18, 0X51, 0X04, 0X61,
+  0X52, 0X02, 0X03, 0X81, 0XBC, 0X73, 0X7C, 0XF3, 0X1B, 0XD6, 0XA2, 0X8C,
+  0X80, 0X2E, 0X40, 0X45, 0X4C, 0X53, 0XD6, 0XA8, 0XBF, 0XDE, 0X9E, 0XAD,
+  0XBF, 0XEC, 0X81, 0XB7, 0X49, 0XD0, 0XD4, 0X7A, 0X8B, 0XF2, 0X9A, 0XF4,
+  0XBC, 0XF4, 0XC8, 0XE6, 0XA7, 0X5E, 0XBE, 0XA2, 0XDC, 0XDD, 0XDB, 0XB6,
+  0X64, 0XFA, 0XD9, 0X30, 0X87, 0XAF, 0X06, 0XFA, 0XFC, 0XAA, 0XEC, 0X3B,
+  0X39, 0XEA, 0X45, 0XB8, 0X17, 0X39, 0XFC, 0X9E, 0XFB, 0X6A, 0X18, 0XE6,
+  0X2F, 0X64, 0XFA, 0X95, 0X3B, 0XBE, 0XD7, 0XB9, 0X45, 0XE3, 0X6E, 0XEC,
+  0XB2, 0X95, 0X0A, 0XEC, 0XB2, 0X58, 0X19, 0X8E, 0X26, 0X5B, 0X72, 0X49,
+  0XD4, 0X9A, 0X2F, 0X96, 0X8D, 0X9F, 0X0C, 0X15, 0XEE, 0XC0, 0XF9, 0X71,
+  0X4A, 0XBE, 0X2F, 0X8E, 0XE3, 0XCF, 0XD2, 0X7B, 0X36, 0XA6, 0X0D, 0XF0,
+  0X85, 0X31, 0X8E, 0X61, 0X3B, 0X93, 0X37, 0XAA, 0X56, 0X81, 0X6E, 0XE3,
+  0X01, 0X54, 0X3C, 0XB0, 0X76, 0X3B, 0X4B, 0X04, 0X25, 0X9A, 0XB7, 0X44,
+  0X47, 0XCA, 0XB1, 0XD3, 0X29, 0XB0, 0X8E, 0X6C, 0X9D, 0X00, 0X45, 0XAD,
+  0X32, 0X7B, 0XA3, 0XB4, 0XA7, 0X10, 0X49, 0X9D, 0X1E, 0XDB, 0XC4, 0XA3,
+  0X23, 0X4C, 0XBB, 0X43, 0X43, 0XD4, 0X14, 0X06, 0X6B, 0XA0, 0X5D, 0X00,
+  0XD9, 0X40, 0X55, 0XBA, 0X62, 0X15, 0XEC, 0X7C, 0X10, 0X3D, 0XD7, 0XD8,
+  0XC3, 0X1F, 0X2F, 0XA6, 0X64, 0XF8, 0XD7, 0XCF, 0X2B, 0XB8, 0X11, 0X23,
+  0XBA, 0X35, 0X52, 0X56, 0X65, 0X54, 0XD2, 0XC9, 0X47, 0X7F, 0X97, 0X8E,
+  0X93, 0X88, 0X76, 0XBB, 0X6E, 0X54, 0X47, 0X3E, 0XCB, 0X68, 0XEE, 0X95,
+  0X2D, 0X58, 0X10, 0X80, 0X47, 0X32, 0X39, 0X58, 0X4C, 0X2D, 0X5A, 0X4D,
+  0X94, 0X47, 0X7C, 0X0E, 0X22, 0X48, 0XEC, 0XAD, 0XA7, 0X72, 0X7A, 0X24,
+  0X01, 0X08, 0XB6, 0X0B, 0XC3, 0X94, 0XFA, 0X3F, 0X3B, 0X57, 0XAC, 0X0B,
+  0X19, 0X36, 0X24, 0X2F, 0XCD, 0X8D, 0X7E, 0XDA, 0XC5, 0X55, 0XAC, 0XDF,
+  0X4E, 0X98, 0X4E, 0X82, 0XFB, 0XF5, 0X31, 0X20, 0XC7, 0XA7, 0XD8, 0X55,
+  0X98, 0X51, 0XE7, 0X9E, 0XE1, 0X39, 0X9B, 0XB4, 0X24, 0XD0, 0X01, 0XB0,
+  0X8B, 0XD5, 0XAA, 0XEB, 0XD6, 0X46, 0X86, 0XD3, 0XB1, 0XA4, 0X42, 0X39,
+  0X57, 0X51, 0X9D, 0XF3, 0X71, 0X39, 0XF9, 0X61, 0XC4, 0X4B, 0XA4, 0X55,
+  0X5B, 0XC0, 0X28, 0X17, 0X9C, 0X36, 0X06, 0XBF, 0XAF, 0X77, 0X7C, 0X32,
+  0XC9, 0XE1, 0X00, 0X04, 0X0A, 0XD8, 0XAE, 0X86, 0X5B, 0XFD, 0X2D, 0XAE,
+  0X34, 0X74, 0X61, 0XAD, 0XBC, 0XDC, 0X48, 0XD6, 0X40, 0X2D, 0X4B, 0X12,
+  0X94, 0X26, 0X47, 0X75, 0X73, 0XCB, 0X4B, 0X92, 0X21, 0XB1, 0X99, 0X34,
+  0X63, 0XA6, 0X08, 0XB9, 0X9E, 0XF0, 0X91, 0XDD, 0X31, 0XE0, 0X9D, 0XBB,
+  0X90, 0X37, 0X66, 0XCD, 0XAA, 0XDE, 0XC1, 0XC5, 0XE4, 0X55, 0XAB, 0XA3,
+  0XAD, 0X2B, 0X04, 0X5A, 0XB4, 0X2A, 0X89, 0XA6, 0X28, 0XC5, 0XFC, 0X16,
+  0XA1, 0XCD, 0X57, 0X80, 0X73, 0X92, 0X50, 0X94, 0XB0, 0X1C, 0X24, 0X7A,
+  0X02, 0X6A, 0XC1, 0XE1, 0XC3, 0X3D, 0XC3, 0XB9, 0XC5, 0XE5, 0XD2, 0X7E,
+  0X9A, 0X3F, 0X1F, 0X7A, 0X13, 0XCB, 0XA7, 0XF1, 0X1B, 0X73, 0XF4, 0XA9,
+  0X09, 0X15, 0XE9, 0XD1, 0X8E, 0XB4, 0XFA, 0XB0, 0XEC, 0XC9, 0XB5, 0X48,
+  0XB8, 0X3A, 0XF7, 0XCC, 0X18, 0XD7, 0X6D, 0XD2, 0XDB, 0X2D, 0XF2, 0X35,
+  0X1C, 0XEA, 0XC9, 0X8E, 0XCA, 0X9B, 0X65, 0XE8, 0X13, 0X6E, 0X15, 0XC6,
+  0X12, 0XAA, 0XF4, 0XCA, 0X9D, 0X83, 0XC5, 0X8D, 0X39, 0X75, 0X2A, 0XEC,
+  0XEA, 0X25, 0XAC, 0XAA, 0XC4, 0XA4, 0X8E, 0X92, 0XB0, 0X4B, 0X5E, 0X34,
+  0X2C, 0X40, 0XB2, 0X0B, 0X81, 0X85, 0XF6, 0X0D, 0XF5, 0X81, 0X33, 0X30,
+  0XDB, 0X22, 0X75, 0X8D, 0X86, 0XDA, 0X50, 0XF1, 0X8E, 0XCD, 0X0B, 0XCD,
+  0X59, 0XCA, 0XE2, 0X80, 0X80, 0X58, 0XE3, 0X74, 0XA4, 0XED, 0XD3, 0X69,
+  0X52, 0XF1, 0XF2, 0X9A, 0X72, 0XD1, 0X5B, 0X56, 0XCA, 0X68, 0X01, 0X2B,
+  0X17, 0X8E, 0XA3, 0XDB, 0X25, 0XB0, 0X48, 0X5C, 0X69, 0X69, 0XB7, 0X20,
+  0XE3, 0X44, 0X8D, 0X5C, 0X57, 0XCB, 0X55, 0XD2, 0X3A, 0X28, 0XD8, 0XCE,
+  0XFB, 0XE1, 0XDA, 0X42, 0X84, 0X77, 0X47, 0X73, 0XAF, 0X3B, 0X8B, 0XB9,
+  0XCE, 0X51, 0XCC, 0X1F, 0XF5, 0X50, 0XE8, 0X8F, 0XAD, 0XB9, 0X58, 0XF0,
+  0X40, 0X30, 0XAD, 0XB2, 0X2E, 0X55, 0XD9, 0X1C, 0X9E, 0X16, 0XA3, 0X9A,
+  0X05, 0X18, 0X7E, 0XD9, 0X5F, 0XE2, 0X65, 0XAA, 0X1F, 0X32, 0X10, 0XFE,
+  0X73, 0X24, 0X64, 0X7D, 0X01, 0X22, 0XE1, 0X07, 0X9C, 0XF6, 0XEF, 0X86,
+  0XE9, 0X1A, 0X38, 0XA8, 0XDA, 0X94, 0XC5, 0XDD, 0XD0, 0XD2, 0XD9, 0XF0,
+  0X48, 0X28, 0X37, 0X7B, 0X96, 0X52, 0XAA, 0XCB, 0X98, 0X9A, 0X70, 0X84,
+  0X3E, 0XA2, 0X20, 0X71, 0X17, 0XDB, 0X07, 0X44, 0X21, 0XB7, 0X73, 0XB7,
+  0XF7, 0X42, 0XE3, 0X78, 0X19, 0X28, 0X4B, 0XA0, 0X6E, 0X92, 0X0C, 0XF6,
+  0X41, 0X08, 0XBA, 0X35, 0XDE, 0X3A, 0X0F, 0XCA, 0XE1, 0XC2, 0X52, 0XAE,
+  0XDC, 0XC5, 0X6F, 0XC1, 0XED, 0XFC, 0X13, 0XBB, 0XD2, 0XD4, 0XA9, 0X9B,
+  0X3C, 0X2D, 0XD6, 0XAA, 0X6B, 0X63, 0XC0, 0X95, 0XCC, 0X0C, 0XCA, 0X75,
+  0XFE, 0X02, 0X8C, 0XD5, 0X64, 0X46, 0X41, 0X8C, 0XC4, 0XB2, 0X31, 0XB9,
+  0X38, 0X88, 0X02, 0X11, 0XE3, 0X0D, 0X4D, 0X06, 0XB0, 0XBC, 0X7D, 0XC1,
+  0X9E, 0XB3, 0XB0, 0X3A, 0XF7, 0X4B, 0X71, 0X76, 0XD3, 0XBB, 0XE0, 0X82,
+  0X77, 0XEA, 0XCE, 0X47, 0XAE, 0XF2, 0XFC, 0X78, 0XE8, 0X08, 0XC4, 0X12,
+  0XA8, 0XC2, 0X48, 0X27, 0X89, 0X1A, 0X00, 0XAE, 0XA0, 0X6E, 0XD3, 0XB5,
+  0XCC, 0XFC, 0XFA, 0XB8, 0X52, 0XC5, 0X7C, 0X23, 0XBC, 0X2F, 0X19, 0X7C,
+  0XA3, 0XC4, 0X5F, 0X8D, 0X01, 0X8C, 0XCE, 0X45, 0X13, 0X25, 0XFC, 0XA1,
+  0XE2, 0X53, 0XE1, 0X8F, 0XED, 0XD1, 0XD3, 0X80, 0X61, 0X15, 0X1E, 0XD2,
+  0X9C, 0X4C, 0X83, 0X26, 0XED, 0X8E, 0X6B, 0XC1, 0XBA, 0XA6, 0XC0, 0XE9,
+  0X76, 0XD4, 0X1F, 0X12, 0X11, 0XA2, 0XEC, 0X7A, 0X1C, 0X7F, 0X0D, 0X4B,
+  0XD9, 0X3B, 0X7D, 0XFC, 0X90, 0XA6, 0XBE, 0X33, 0X5C, 0X9C, 0X05, 0X2E,
+  0X1E, 0XE0, 0X75, 0XFE, 0XED, 0XBD, 0XB4, 0X8C, 0X27, 0X74, 0XB7, 0XD7,
+  0XA5, 0X75, 0X8A, 0X49, 0X89, 0X59, 0XB6, 0X04, 0X5D, 0X85, 0X7A, 0X4F,
+  0XC7, 0X9A, 0X97, 0X5A, 0X8C, 0XED, 0X10, 0X5A, 0X27, 0X94, 0X73, 0X82,
+  0X6B, 0X72, 0X02, 0X5D, 0XF9, 0XF4, 0X4A, 0X78, 0XEA, 0XA1, 0X49, 0X8B,
+  0X51, 0XE1, 0X1A, 0X33, 0XF1, 0X8E, 0X40, 0X04, 0X90, 0X4B, 0XAA, 0XA7,
+  0X2D, 0X91, 0XA2, 0XA5, 0X01, 0X90, 0XC8, 0X7A, 0X16, 0X49, 0XD4, 0X93,
+  0X8C, 0X42, 0X25, 0X09, 0X29, 0XDD, 0XAC, 0X80, 0X1C, 0X0F, 0X45, 0XCD,
+  0X01, 0X62, 0XD5, 0X92, 0X99, 0X93, 0XC3, 0X40, 0X45, 0X20, 0X71, 0X58,
+  0X92, 0X1C, 0X5E, 0XF5, 0XC0, 0X65, 0X99, 0X7D, 0XA3, 0XCB, 0X60, 0X4B,
+  0X4D, 0X9F, 0X59, 0X52, 0X48, 0X01, 0X0F, 0X28, 0X21, 0X86, 0X84, 0X34,
+  0XE1, 0X4C, 0X86, 0X29, 0X4D, 0XEA, 0XD4, 0X49, 0X85, 0X36, 0X63, 0XAE,
+  0XA3, 0X69, 0XF8, 0XDE, 0X28, 0XA7, 0X65, 0XBB, 0X16, 0XE5, 0X6E, 0XDC,
+  0X9D, 0X79, 0X0B, 0XF4, 0XFB, 0X70, 0XC8, 0X49, 0X4B, 0X8D, 0X54, 0X90,
+  0X4B, 0X81, 0XBC, 0X85, 0X37, 0X60, 0X0E, 0XD5, 0X3C, 0XDF, 0X04, 0X4D,
+  0X20, 0X7D, 0X1E, 0X06, 0XB5, 0X31, 0X8C, 0X93, 0X34, 0X57, 0X8A, 0X94,
+  0X82, 0X12, 0XB4, 0X11, 0XAD, 0X79, 0X12, 0X5C, 0XE9, 0XF0, 0X08, 0X02,
+  0X5C, 0X70, 0X32, 0X63, 0X00, 0X21, 0X52, 0XFD, 0X28, 0XDD, 0X3D, 0X5C,
+  0X01, 0XA1, 0X11, 0X74, 0XC1, 0X11, 0X5A, 0XFD, 0XF3, 0XD3, 0X6E, 0X27,
+  0XA2, 0XCB, 0X82, 0X89, 0X87, 0X0B, 0X1F, 0X3D, 0XE0, 0X10, 0X23, 0X0F,
+  0X99, 0X62, 0XBE, 0XA2, 0XAD, 0X2E, 0X35, 0X0A, 0XFD, 0X71, 0X68, 0X99,
+  0XAD, 0X17, 0X4B, 0X76, 0XFF, 0X87, 0XD3, 0X03, 0X64, 0XA2, 0XF3, 0X91,
+  0X57, 0X74, 0X96, 0X66, 0X82, 0X59, 0X87, 0X7F, 0X0C, 0XED, 0XD2, 0X25,
+  0XF1, 0X72, 0X4F, 0X29, 0X27, 0X76, 0XAB, 0XB9, 0XBA, 0XC7, 0X85, 0X46,
+  0XAF, 0X45, 0X41, 0X53, 0XE6, 0XF8, 0X11, 0XAB, 0XB9, 0XE2, 0XE2, 0XC3,
+  0XB3, 0X77, 0X94, 0X5E, 0X32, 0X91, 0X80, 0XD5, 0X79, 0X9B, 0X5E, 0XB2,
+  0X32, 0X54, 0X5B, 0X09, 0XCA, 0X5C, 0XAC, 0X54, 0XE0, 0XB9, 0X79, 0X98,
+  0XE4, 0X3D, 0X1A, 0X42, 0X6E, 0X75, 0X97, 0X63, 0X43, 0XFC, 0XF1, 0X26,
+  0XB7, 0XC0, 0XBA, 0XC7, 0X3E, 0X7D, 0XE5, 0XD2, 0X47, 0X0E, 0X10, 0X58,
+  0X9D, 0XF5, 0X08, 0X92, 0X50, 0X47, 0X2F, 0XBA, 0X14, 0X69, 0XBE, 0X86,
+  0XC4, 0XDF, 0XE8, 0X41, 0X04, 0XA8, 0X36, 0XF2, 0X38, 0XC2, 0XB0, 0X39,
+  0XEE, 0X6E, 0XFA, 0X80, 0XA2, 0X03, 0XCF, 0XB6, 0XC1, 0XC7, 0X7D, 0XD6,
+  0XB3, 0X7E, 0X8F, 0X07, 0XB8, 0XEF, 0X31, 0X81, 0X9B, 0XF1, 0X8B, 0X8C,
+  0X47, 0X8B, 0X90, 0X9D, 0X5C, 0X72, 0XA4, 0X5B, 0XAA, 0X6A, 0X64, 0X9D,
+  0X87, 0X10, 0X8E, 0X9E, 0XA4, 0X40, 0X67, 0XE1, 0X59, 0X49, 0X67, 0X0D,
+  0X48, 0X73, 0X80, 0X97, 0X4F, 0X82, 0XB4, 0X38, 0X55, 0X8A, 0X99, 0XF2,
+  0X3E, 0X0F, 0X27, 0XF5, 0X46, 0X4C, 0X0D, 0X8E, 0X75, 0X8E, 0X95, 0X96,
+  0X61, 0XC0, 0X36, 0X3F, 0XE5, 0X12, 0XC6, 0X67, 0XDB, 0X66, 0X0A, 0XB4,
+  0X09, 0XCF, 0X0C, 0XE9, 0X21, 0XC4, 0X93, 0X85, 0X50, 0X25, 0XA9, 0XA2,
+  0X1C, 0X33, 0X8A, 0X49, 0X86, 0XE8, 0XCF, 0X92, 0XCE, 0X79, 0X5A, 0X5B,
+  0XE0, 0X83, 0X5D, 0X5C, 0X2E, 0X70, 0X1B, 0X1F, 0X74, 0XDB, 0XBA, 0XAF,
+  0X1D, 0X85, 0XEE, 0XC0, 0XCD, 0XA1, 0X09, 0XDB, 0X62, 0X09, 0X5E, 0XDF,
+  0X20, 0X26, 0X6D, 0XDB, 0X90, 0X47, 0XE5, 0X1F, 0X5D, 0X6D, 0X89, 0X2C,
+  0X51, 0X1D, 0X15, 0X27, 0X17, 0X2A, 0XAD, 0XD3, 0XA3, 0XA8, 0X44, 0X85,
+  0X0A, 0X41, 0X16, 0X47, 0X68, 0XD2, 0X3F, 0X2E, 0XAF, 0XB0, 0X3C, 0X46,
+  0X02, 0X86, 0X38, 0X1C, 0XEF, 0X15, 0X2F, 0X99, 0XC9, 0XFA, 0XE9, 0X24,
+  0XC2, 0X41, 0XB0, 0X02, 0XB1, 0XA1, 0X7F, 0X02, 0X0F, 0X46, 0XF4, 0X0B,
+  0X7C, 0X96, 0XD5, 0XD0, 0X95, 0X57, 0X8E, 0X5C, 0XB5, 0X54, 0X4B, 0X46,
+  0X38, 0X88, 0X21, 0X9E, 0X4C, 0X71, 0X7E, 0X6C, 0X44, 0X25, 0XC6, 0X54,
+  0X03, 0X34, 0X24, 0X05, 0X95, 0X1D, 0X82, 0X36, 0X9A, 0XBE, 0XEF, 0X6C,
+  0X47, 0X5B, 0XD5, 0X17, 0X4B, 0XB4, 0X61, 0XF6, 0X02, 0X3E, 0X7A, 0X9E,
+  0XFE, 0XB6, 0XC8, 0XAF, 0XA7, 0X90, 0XCB, 0XA7, 0X04, 0X7C, 0XFB, 0XC9,
+  0XD5, 0XDE, 0XB6, 0X45, 0X50, 0X47, 0X11, 0XD7, 0XA4, 0XA2, 0XDE, 0X00,
+  0X13, 0X3C, 0X28, 0XD0, 0XD2, 0X4B, 0XF0, 0X3C, 0X07, 0X85, 0XDD, 0X4A,
+  0XF1, 0X34, 0X4B, 0X57, 0X9D, 0XE0, 0XB7, 0X47, 0X8C, 0XE1, 0X79, 0XDD,
+  0XE2, 0XCE, 0XB9, 0X93, 0XE1, 0X79, 0XF1, 0X18, 0X79, 0XF1, 0XB4, 0X1E,
+  0XB9, 0X7F, 0X21, 0X72, 0X33, 0XBA, 0X12, 0X38, 0X08, 0X10, 0XB1, 0X40,
+  0X27, 0X8B, 0XD5, 0X13, 0X16, 0X06, 0XA3, 0X6A, 0XE4, 0XCF, 0X08, 0X3D,
+  0X0D, 0X0E, 0XF2, 0X25, 0XE7, 0XF3, 0X29, 0X44, 0X08, 0X11, 0XEE, 0X48,
+  0X69, 0XCD, 0XB7, 0X5E, 0XDE, 0X5A, 0XB6, 0XF8, 0X0D, 0XE6, 0X3A, 0X8D,
+  0X49, 0X26, 0XF9, 0X38, 0XBA, 0XE2, 0X11, 0X8D, 0XAD, 0X6E, 0X73, 0XF7,
+  0X79, 0XF1, 0XF9, 0X9D, 0XE5, 0X72, 0XDB, 0XC8, 0XE4, 0X35, 0X4A, 0X43,
+  0X48, 0XD0, 0X79, 0X25, 0X64, 0X2A, 0X1A, 0XC5, 0XA8, 0X96, 0X88, 0X50,
+  0X81, 0XCA, 0X4B, 0XBB, 0XE3, 0XA9, 0X73, 0XC6, 0XEF, 0X4A, 0XD4, 0X58,
+  0XB2, 0X6F, 0X69, 0X13, 0X05, 0X1D, 0XCC, 0X33, 0XEB, 0X2E, 0XA7, 0X0C,
+  0X10, 0X3E, 0X8C, 0XCC, 0XC0, 0XB3, 0X6D, 0X6D, 0X48, 0X17, 0XF5, 0X4A,
+  0XF8, 0X53, 0X11, 0X75, 0X34, 0XBE, 0X80, 0X2C, 0X8D, 0X9E, 0XD6, 0XC6,
+  0X84, 0X3C, 0X53, 0X20, 0XA3, 0XE4, 0X94, 0XAF, 0XCF, 0X55, 0X73, 0XE6,
+  0X94, 0X03, 0XB2, 0X57, 0XC8, 0XB1, 0XE3, 0X70, 0XA7, 0XF1, 0X02, 0X7B,
+  0XCF, 0X5C, 0XF6, 0XBE, 0X7F, 0X33, 0XA4, 0X8D, 0XF7, 0XDA, 0XA4, 0XA9,
+  0XB8, 0XA7, 0X3C, 0XF7, 0X7F, 0X06, 0XE4, 0XBB, 0X13, 0X72, 0X2C, 0X8A,
+  0XD4, 0XE4, 0X4D, 0XD1, 0XC9, 0X09, 0XC4, 0X9A, 0XB1, 0X07, 0X13, 0X19,
+  0XA8, 0X24, 0X42, 0X81, 0X46, 0X0C, 0X57, 0X28, 0X45, 0X37, 0X72, 0X00,
+  0XA3, 0X26, 0XE2, 0X36, 0XA8, 0XA6, 0X0A, 0X12, 0XE1, 0X48, 0XCC, 0X2D,
+  0XC0, 0X6D, 0XC2, 0X01, 0X21, 0XCE, 0X87, 0X67, 0XDE, 0X08, 0XA4, 0X32,
+  0X0B, 0XDF, 0X5B, 0X50, 0XE7, 0X6B, 0X18, 0X05, 0X55, 0XB8, 0X27, 0X4B,
+  0X2A, 0XEF, 0XF1, 0XAA, 0XD7, 0X5C, 0X22, 0XFE, 0X51, 0X8C, 0X24, 0X81,
+  0X43, 0X5A, 0X28, 0X17, 0X53, 0X89, 0XFC, 0X0E, 0X30, 0XC1, 0X94, 0XF1,
+  0X39, 0X07, 0XDC, 0X4E, 0XCC, 0XE8, 0XF0, 0XDB, 0XD9, 0X3B, 0XD8, 0XE9,
+  0X93, 0XAD, 0X7C, 0X67, 0XEE, 0XB3, 0X30, 0X3A, 0XEB, 0XDD, 0X07, 0X37,
+  0X3E, 0XC7, 0X6F, 0XC0, 0X1B, 0XC1, 0XE8, 0X84, 0X22, 0X6A, 0X78, 0X2C,
+  0XCD, 0X40, 0X80, 0X45, 0X36, 0XAC, 0X13, 0XD3, 0X1E, 0X91, 0X10, 0X41,
+  0X49, 0X96, 0X90, 0X40, 0X13, 0X99, 0X58, 0X8F, 0X87, 0X58, 0XE4, 0XE7,
+  0XAF, 0X7D, 0XBA, 0XC5, 0X77, 0XB6, 0X9A, 0X99, 0XA7, 0X19, 0X4F, 0XFE,
+  0X5D, 0XEE, 0X0E, 0XBE, 0X5B, 0X6E, 0XAE, 0X69, 0X3F, 0XB7, 0XD8, 0XBC,
+  0XAC, 0XCC, 0X31, 0X28, 0XB4, 0X52, 0X48, 0X83, 0X90, 0X99, 0X97, 0X91,
+  0X4A, 0X04, 0X83, 0X02, 0X83, 0X98, 0X3C, 0X8F, 0XB9, 0X96, 0X9A, 0XAE,
+  0X73, 0X10, 0X68, 0X0D, 0X7B, 0XB8, 0X5F, 0X19, 0XFA, 0X8D, 0X1B, 0XF2,
+  0X34, 0X1B, 0X4B, 0XD8, 0X47, 0X77, 0X0B, 0XBB, 0XEF, 0XA1, 0XCD, 0X36,
+  0X84, 0XD9, 0X09, 0X77, 0X08, 0XAC, 0XA1, 0X22, 0X31, 0X60, 0X18, 0X40,
+  0X91, 0X58, 0X34, 0X20, 0X91, 0XEC, 0X71, 0X27, 0XCB, 0X93, 0X92, 0X1C,
+  0X8E, 0X52, 0X53, 0X9E, 0X19, 0X29, 0X49, 0X6F, 0X89, 0X30, 0XAB, 0XE7,
+  0X00, 0X07, 0X2A, 0XF0, 0X33, 0X3C, 0XD4, 0X5E, 0X8D, 0X4B, 0X04, 0X00,
+  0X69, 0XDF, 0X48, 0XCF, 0X49, 0X10, 0XC8, 0X20, 0XD8, 0X6B, 0X01, 0X8B,
+  0X29, 0X37, 0XC7, 0X82, 0X5C, 0X30, 0XC6, 0X2A, 0X82, 0X54, 0X34, 0XA0,
+  0X10, 0X39, 0X39, 0X39, 0X4F, 0X29, 0XA8, 0X96, 0X8F, 0X14, 0XEE, 0X40,
+  0XCF, 0X83, 0XC7, 0XDF, 0XD4, 0X05, 0XBF, 0X39, 0X18, 0XBA, 0X4A, 0X40,
+  0XF8, 0X7A, 0X4D, 0XD0, 0X78, 0XBC, 0XE0, 0XC0, 0X87, 0X5E, 0X2C, 0X23,
+  0X1C, 0XC7, 0X1E, 0XB0, 0X2B, 0X51, 0XCA, 0XAC, 0X48, 0XEA, 0X24, 0X66,
+  0X60, 0X46, 0X02, 0X7D, 0X01, 0X1A, 0X02, 0X99, 0X69, 0X60, 0X26, 0X3D,
+  0XAC, 0X40, 0XD8, 0X9F, 0XA5, 0X1D, 0X61, 0XCA, 0XF2, 0X87, 0XC0, 0X81,
+  0XF8, 0XF2, 0X8F, 0XCB, 0X7B, 0X89, 0X82, 0X7D, 0XBF, 0X58, 0XC4, 0XB0,
+  0X4F, 0XC1, 0X02, 0X78, 0X28, 0X8E, 0XB6, 0X56, 0X4B, 0X14, 0X71, 0X21,
+  0X52, 0XAC, 0X77, 0X1F, 0X3B, 0X11, 0XDF, 0X01, 0X2D, 0X50, 0XFF, 0X21,
+  0X79, 0X35, 0X78, 0XD5, 0XB6, 0X26, 0X01, 0XE5, 0X74, 0X29, 0X75, 0XE1,
+  0X73, 0XB4, 0XCB, 0X3A, 0XB9, 0XDE, 0X09, 0X78, 0XFB, 0XCA, 0X61, 0XDB,
+  0X3E, 0XF0, 0XBD, 0X02, 0XD2, 0XC0, 0XF1, 0X0B, 0XD4, 0X45, 0X3F, 0XDF,
+  0X2D, 0X9C, 0X6B, 0X19, 0XEA, 0X70, 0X44, 0X2C, 0XA5, 0XC6, 0XCA, 0X44,
+  0X8A, 0XC1, 0X50, 0X54, 0XB1, 0X56, 0X30, 0XEB, 0X52, 0X24, 0X77, 0X18,
+  0X98, 0X1E, 0XB3, 0XDD, 0X0E, 0X67, 0XC5, 0XBA, 0X72, 0X5E, 0X69, 0X94,
+  0XD1, 0X6B, 0X21, 0XA8, 0X12, 0X19, 0X85, 0XAB, 0XF0, 0X59, 0X3F, 0X14,
+  0XA8, 0X8D, 0X6D, 0X3D, 0X71, 0X86, 0XF4, 0X67, 0X90, 0X4C, 0X70, 0XBA,
+  0XA7, 0XB4, 0X88, 0X07, 0X59, 0X89, 0X46, 0XAA, 0X28, 0X32, 0X84, 0X24,
+  0X30, 0X21, 0X18, 0XDD, 0XC8, 0X6A, 0X70, 0X25, 0X0B, 0XB2, 0X54, 0X00,
+  0X1D, 0XED, 0X9A, 0X81, 0X78, 0X3C, 0XCD, 0XEA, 0X72, 0X5F, 0X84, 0XDE,
+  0XBD, 0XD5, 0X67, 0XF0, 0XF4, 0XF1, 0X6E, 0XE5, 0X0C, 0XA4, 0XEF, 0X10,
+  0X55, 0X1B, 0X42, 0XA6, 0XA0, 0X4E, 0X41, 0X3F, 0X64, 0X09, 0X0C, 0XCD,
+  0X45, 0X91, 0X0E, 0XCE, 0X33, 0X51, 0XB4, 0XE6, 0XD4, 0X19, 0X6B, 0X6A,
+  0X5B, 0X69, 0XE9, 0X28, 0X69, 0X71, 0X2E, 0XE9, 0X92, 0X6B, 0X52, 0X8A,
+  0X8C, 0X14, 0X70, 0X5E, 0X6A, 0X24, 0X23, 0X43, 0XBB, 0X0B, 0X68, 0X83,
+  0X50, 0XAB, 0X49, 0X38, 0XBD, 0X36, 0XB4, 0X1E, 0X9E, 0X0C, 0XFA, 0X5D,
+  0X25, 0X44, 0X90, 0X12, 0XA3, 0X2E, 0X41, 0X52, 0X12, 0X8A, 0X52, 0X96,
+  0X0C, 0X66, 0XA2, 0X13, 0X36, 0XBA, 0XD1, 0X40, 0X6B, 0X63, 0X78, 0X84,
+  0XA3, 0X8B, 0X22, 0XED, 0X6B, 0XC7, 0XE6, 0XA9, 0XDF, 0XE1, 0X70, 0X4F,
+  0XB7, 0X6B, 0XE9, 0X69, 0X3C, 0X5A, 0X1B, 0X88, 0X3A, 0X9E, 0XDB, 0X16,
+  0XA1, 0XA1, 0X5E, 0XC6, 0XC9, 0X39, 0X12, 0X4B, 0XAC, 0X28, 0X3D, 0X16,
+  0X9B, 0XA1, 0X48, 0X0C, 0XBF, 0X68, 0X3F, 0XA4, 0X0F, 0X9F, 0XE2, 0X95,
+  0XF1, 0X2C, 0XD5, 0X26, 0XAF, 0X55, 0XA4, 0XA9, 0XE3, 0XE3, 0X6C, 0X8A,
+  0X2F, 0XFD, 0X70, 0XD9, 0X19, 0XEC, 0X8F, 0XCD, 0X31, 0XF1, 0X64, 0XDD,
+  0X6B, 0X0E, 0X6D, 0XFF, 0XAD, 0X0D, 0X06, 0X1C, 0X6F, 0X59, 0X70, 0X6D,
+  0X2B, 0X20, 0X45, 0X0C, 0XEF, 0X8F, 0X94, 0XAB, 0X0D, 0XCC, 0X82, 0X7F,
+  0X01, 0X42, 0XF6, 0X89, 0X0B, 0X51, 0X6D, 0X69, 0X05, 0XA9, 0X75, 0X03,
+  0X01, 0XF2, 0X01, 0X83, 0X16, 0XA9, 0XF9, 0X3C, 0X56, 0XB5, 0XF7, 0XDA,
+  0X98, 0XD8, 0X0A, 0XE8, 0XA1, 0X48, 0XE8, 0XC9, 0X37, 0X1E, 0X42, 0X1F,
+  0X0F, 0X79, 0XC8, 0X32, 0X2A, 0X50, 0X31, 0X9A, 0X5B, 0X09, 0XE3, 0X6F,
+  0X1E, 0X6B, 0X10, 0X4A, 0XA3, 0X02, 0X26, 0XA5, 0X91, 0XC8, 0X57, 0X5E,
+  0X00, 0X5A, 0X15, 0X26, 0XAD, 0XCC, 0XB0, 0XD4, 0X89, 0XAF, 0XA2, 0X13,
+  0X58, 0X92, 0XF5, 0X32, 0X86, 0X0B, 0X57, 0X72, 0XE9, 0XE1, 0X58, 0XA1,
+  0X95, 0XF0, 0XAD, 0XD2, 0XD3, 0XE4, 0X7B, 0X0D, 0X4E, 0X1A, 0X45, 0XB1,
+  0X51, 0X0F, 0XA2, 0XBE, 0X89, 0X40, 0X28, 0X66, 0X21, 0X0A, 0X40, 0X30,
+  0X77, 0X75, 0X8E, 0X38, 0X7C, 0X65, 0XA3, 0X44, 0X2B, 0XCC, 0XD7, 0X05,
+  0XEA, 0X5B, 0XAE, 0X58, 0X19, 0XF1, 0X32, 0X9A, 0X69, 0X95, 0X91, 0XDE,
+  0XEF, 0XAC, 0XB1, 0XA7, 0X96, 0XFB, 0X41, 0XDA, 0XD6, 0XE5, 0X1F, 0XFB,
+  0X24, 0X88, 0XCE, 0X59, 0X6F, 0XF0, 0X44, 0X59, 0X44, 0X7E, 0X1C, 0XA0,
+  0X01, 0X61, 0XEC, 0XD2, 0XD6, 0X6D, 0X77, 0X38, 0X0D, 0X43, 0XDD, 0X87,
+  0X23, 0XDE, 0X57, 0XA4, 0XA6, 0XC5, 0X06, 0XA2, 0XA7, 0X10, 0X4E, 0XC8,
+  0X37, 0XB5, 0X88, 0X57, 0X12, 0XB8, 0XDD, 0X24, 0XAC, 0XCF, 0X1C, 0X71,
+  0X7E, 0X3B, 0X05, 0X96, 0X16, 0XE7, 0XBA, 0X03, 0X0E, 0XF0, 0X37, 0X97,
+  0X4A, 0X24, 0XFA, 0X73, 0XDC, 0XC0, 0X6F, 0XD8, 0X68, 0XAA, 0XE1, 0XE9,
+  0XF9, 0X32, 0XB9, 0XDD, 0X10, 0XAF, 0X13, 0XE2, 0X2E, 0X42, 0X02, 0X80,
+  0X94, 0X52, 0X5E, 0X19, 0X40, 0X13, 0XAE, 0X42, 0XAE, 0XEF, 0X90, 0X09,
+  0X7F, 0X9C, 0XA7, 0X26, 0XD0, 0XB0, 0XE9, 0X28, 0X9C, 0XB8, 0XA8, 0XB3,
+  0X2D, 0XE6, 0X30, 0X3E, 0X36, 0XF0, 0X42, 0XBB, 0XFB, 0XE3, 0XBD, 0X66,
+  0X3B, 0X6E, 0XE9, 0X0A, 0X16, 0X28, 0XBE, 0X07, 0X0D, 0XC2, 0X4F, 0X74,
+  0XBC, 0XDA, 0XD7, 0XDF, 0X7B, 0X23, 0X64, 0X52, 0X90, 0XD1, 0XC3, 0X16,
+  0XD6, 0X4C, 0X9F, 0XD4, 0XD6, 0X32, 0X29, 0X53, 0X1A, 0X6E, 0XE7, 0X16,
+  0X8E, 0X54, 0XAB, 0XD1, 0X2C, 0X97, 0X1E, 0X46, 0X6F, 0XE5, 0X04, 0XCB,
+  0X6B, 0X5B, 0X13, 0X6A, 0X3D, 0XD2, 0XE4, 0X45, 0X87, 0X91, 0XC8, 0XF8,
+  0XDE, 0X21, 0X1C, 0X40, 0X30, 0X96, 0X2A, 0X20, 0X19, 0XF0, 0X17, 0X8D,
+  0X7A, 0X07, 0XBC, 0X00, 0X52, 0X5A, 0X55, 0XA0, 0XA9, 0X7F, 0X5D, 0X36,
+  0X2E, 0X59, 0X00, 0X4A, 0X9D, 0X25, 0XF0, 0XA0, 0X7F, 0X91, 0XD5, 0X94,
+  0XAA, 0X34, 0XFF, 0XE7, 0XDD, 0XDE, 0XBC, 0X30, 0X63, 0XD2, 0XAA, 0X53,
+  0X65, 0XB6, 0X64, 0XE9, 0X43, 0X1B, 0X33, 0XAA, 0XB5, 0X67, 0X36, 0X99,
+  0XB8, 0XEB, 0XD3, 0XB8, 0XCD, 0X2E, 0X20, 0X06, 0XE7, 0XDB, 0X86, 0XE0,
+  0X9D, 0XD3, 0XA3, 0XB7, 0X19, 0XC0, 0X6A, 0X8B, 0X35, 0X7B, 0X3B, 0XAF,
+  0XD6, 0XC4, 0X4C, 0XB1, 0XC5, 0X91, 0XB6, 0XE3, 0X10, 0X4D, 0X33, 0X84,
+  0XE3, 0X08, 0X3B, 0X8F, 0XD5, 0X1B, 0XE2, 0XDE, 0X40, 0X05, 0XD0, 0X0B,
+  0X35, 0X43, 0X03, 0X44, 0X9C, 0X5A, 0X4D, 0X6A, 0X25, 0XB7, 0XE3, 0X8C,
+  0X39, 0X57, 0X3C, 0X89, 0X2E, 0X64, 0XB8, 0XE2, 0XE3, 0XDE, 0X14, 0X79,
+  0XAF, 0XEF, 0X0F, 0X93, 0X35, 0XC4, 0X27, 0X42, 0X0C, 0X0B, 0X86, 0X80,
+  0X5A, 0X34, 0X16, 0X0D, 0X58, 0XB4, 0XE2, 0X20, 0XAD, 0X32, 0X86, 0XBF,
+  0X22, 0X73, 0XAD, 0X65, 0XE4, 0XFD, 0XD1, 0XE4, 0XA4, 0X39, 0X85, 0X1A,
+  0X25, 0X13, 0X24, 0X19, 0XF5, 0X16, 0X02, 0XD2, 0XC4, 0X46, 0XBE, 0X1E,
+  0XD7, 0XCE, 0X9E, 0X9E, 0X83, 0XEF, 0XDA, 0X6E, 0X7F, 0X81, 0X5E, 0X40,
+  0XCC, 0XBF, 0X52, 0XCB, 0X57, 0XF0, 0X96, 0X2F, 0X68, 0X02, 0XDC, 0X64,
+  0XF2, 0XF8, 0X74, 0XB8, 0XE7, 0XE1, 0X21, 0XC5, 0XB4, 0XB6, 0X40, 0X54,
+  0X5F, 0XAC, 0X65, 0X90, 0XC2, 0XCF, 0X87, 0XD0, 0X14, 0X55, 0X0A, 0X48,
+  0X05, 0X5B, 0X89, 0XD4, 0XDB, 0XCC, 0X9F, 0XFC, 0X8F, 0X0D, 0XF7, 0X8E,
+  0XC3, 0X71, 0X1E, 0X10, 0XA4, 0XAC, 0XBF, 0XDE, 0X4A, 0X15, 0X7D, 0X9D,
+  0X3E, 0X22, 0XB4, 0X7A, 0X52, 0X9A, 0X64, 0XC8, 0X13, 0XE5, 0X4E, 0X35,
+  0X22, 0X08, 0X10, 0X3B, 0X39, 0XE3, 0XCB, 0XC8, 0X96, 0XE4, 0X04, 0X43,
+  0X8A, 0X21, 0X10, 0X41, 0XC7, 0X43, 0X8B, 0XB4, 0X53, 0X43, 0X9A, 0XC1,
+  0X0A, 0XF0, 0X6F, 0X4A, 0XD1, 0X45, 0X77, 0X0E, 0XE2, 0XC4, 0X5E, 0X60,
+  0X77, 0X91, 0X31, 0XBA, 0XEB, 0XC8, 0XB3, 0X53, 0X0F, 0XB6, 0XFB, 0X8D,
+  0X4E, 0X9F, 0XAB, 0X4F, 0XCE, 0XB2, 0XDA, 0X8D, 0X36, 0X35, 0XBB, 0X72,
+  0XAA, 0X52, 0XCD, 0X42, 0XD8, 0XC6, 0X03, 0X7C, 0X1A, 0XF9, 0X5A, 0X1B,
+  0X50, 0X46, 0X90, 0X8B, 0XEB, 0X02, 0X33, 0X68, 0X12, 0X7D, 0X4D, 0X90,
+  0X7C, 0X62, 0XB1, 0X4C, 0XA1, 0X23, 0X5F, 0X91, 0X34, 0X6F, 0X82, 0X7A,
+  0X6A, 0X21, 0X35, 0XC2, 0X85, 0XBF, 0XFF, 0X14, 0XB1, 0XC1, 0XF3, 0X4E,
+  0X29, 0X1D, 0XE0, 0XDC, 0X38, 0X2A, 0X49, 0X24, 0X36, 0XDC, 0X17, 0X5B,
+  0X33, 0XF3, 0XC8, 0XD0, 0X02, 0X88, 0X99, 0X0F, 0X76, 0XE0, 0XFC, 0X2F,
+  0X4F, 0X7A, 0X7C, 0X45, 0XB1, 0XC2, 0XC0, 0X04, 0XE5, 0X6A, 0X34, 0X4E,
+  0X6C, 0X62, 0X1C, 0X70, 0X37, 0XA0, 0XB7, 0X9E, 0XFD, 0X1B, 0XDB, 0XA3,
+  0X68, 0XB7, 0X69, 0X51, 0X31, 0X8B, 0X5D, 0X59, 0X46, 0X71, 0X6A, 0X61,
+  0X65, 0X4B, 0X77, 0X27, 0X07, 0X1F, 0X4C, 0XA6, 0X14, 0X19, 0X3D, 0XBD,
+  0X3E, 0XA7, 0XDA, 0XD0, 0X28, 0X3F, 0X8B, 0X5C, 0X6F, 0X7A, 0X2D, 0X32,
+  0X7A, 0X87, 0X2D, 0X24, 0X12, 0XD3, 0X47, 0X62, 0XD2, 0X93, 0XCB, 0X54,
+  0X69, 0X27, 0XC1, 0X60, 0X52, 0X25, 0XD4, 0X1E, 0X6B, 0X7D, 0X55, 0X27,
+  0X98, 0XB6, 0XB6, 0X2D, 0X40, 0X12, 0X91, 0X37, 0X02, 0X5C, 0X19, 0XBB,
+  0XC4, 0XF2, 0X83, 0XBE, 0X8C, 0XC3, 0X01, 0X13, 0XDD, 0XDA, 0X06, 0X5D,
+  0XBB, 0XEE, 0XBF, 0XE7, 0X84, 0X2D, 0X2D, 0XA2, 0XDD, 0XFA, 0X13, 0XEE,
+  0XE3, 0X17, 0X5E, 0X9D, 0X29, 0XFE, 0X75, 0XDB, 0XDC, 0XA9, 0X3E, 0X3C,
+  0XF8, 0XEA, 0X7E, 0X54, 0X48, 0X4C, 0X8C, 0XA3, 0XD1, 0X8D, 0X81, 0XEB,
+  0X7B, 0X9D, 0XF1, 0XC7, 0X70, 0X7F, 0X7F, 0X7F, 0X04, 0X68, 0XBA, 0XBC,
+  0X53, 0X07, 0XD3, 0XC7, 0X1C, 0X01, 0X54, 0XB2, 0X1B, 0X08, 0X46, 0XA0,
+  0XE5, 0X66, 0X47, 0XE4, 0XB2, 0X85, 0XFD, 0X98, 0X49, 0X49, 0X39, 0X58,
+  0XE2, 0X13, 0XCA, 0X34, 0XE0, 0X90, 0X7A, 0X49, 0X2D, 0XF3, 0X4A, 0XC2,
+  0X13, 0X02, 0XA8, 0X22, 0X33, 0XB2, 0X76, 0X35, 0X04, 0X88, 0X4D, 0X70,
+  0X3B, 0XC5, 0X16, 0X68, 0XF6, 0XFE, 0X2C, 0XD3, 0X47, 0X6F, 0X0A, 0X7B,
+  0X70, 0X0C, 0X6C, 0X5D, 0XF0, 0X12, 0X21, 0XE2, 0X35, 0X06, 0X17, 0XC4,
+  0X43, 0X81, 0XBC, 0X54, 0XA3, 0X1F, 0XEE, 0XB8, 0X38, 0X36, 0XF8, 0XDD,
+  0XFB, 0XDE, 0X5D, 0X1F, 0X74, 0X6C, 0X1E, 0X29, 0X34, 0XF0, 0X97, 0XE7,
+  0XA4, 0X17, 0XE6, 0X7D, 0X08, 0X33, 0XEF, 0X8B, 0XDC, 0X23, 0X5E, 0X6C,
+  0XF8, 0X84, 0X3A, 0XE3, 0X8E, 0XA5, 0X39, 0XA4, 0X2E, 0X67, 0XC0, 0X73,
+  0XEE, 0X01, 0X5F, 0X61, 0X2D, 0XC4, 0X3E, 0XE8, 0XA0, 0X40, 0X72, 0X49,
+  0X6C, 0X21, 0X33, 0X27, 0X6D, 0XC6, 0XB6, 0X5A, 0XFB, 0X0F, 0X17, 0X21,
+  0X42, 0X37, 0X37, 0XD4, 0X1E, 0XEF, 0XCB, 0X98, 0X1E, 0XC1, 0XA8, 0X8C,
+  0XB0, 0XBC, 0X6D, 0X26, 0X5E, 0X6D, 0X54, 0XF7, 0XC4, 0XA9, 0X7D, 0XFE,
+  0X9C, 0X7D, 0XA3, 0X1D, 0X75, 0XFC, 0XEC, 0X92, 0X32, 0XF9, 0X9D, 0X37,
+  0X73, 0X88, 0X84, 0X6A, 0X28, 0X5D, 0X0F, 0X81, 0XDE, 0X27, 0X73, 0XCF,
+  0XC2, 0X90, 0X39, 0X13, 0X3E, 0XC4, 0X83, 0XE5, 0X76, 0X14, 0X66, 0X7C,
+  0XDC, 0X38, 0XE5, 0X65, 0XA7, 0X85, 0X02, 0X1D, 0X8D, 0X15, 0X25, 0XEE,
+  0XED, 0X96, 0X33, 0X58, 0XB4, 0XAE, 0X2D, 0XC9, 0X55, 0X3C, 0X8D, 0X16,
+  0XA8, 0X1E, 0X41, 0XF1, 0XF9, 0X5E, 0X25, 0X35, 0X1F, 0X5D, 0XFB, 0XEE,
+  0XBD, 0X78, 0X9F, 0X8C, 0XB6, 0X47, 0XA9, 0X3F, 0X44, 0X69, 0X6F, 0XC7,
+  0X53, 0X98, 0XB2, 0X3C, 0X37, 0XB6, 0X80, 0X2F, 0X30, 0XF4, 0XB7, 0X54,
+  0X9F, 0XC5, 0X11, 0X19, 0XC1, 0XE1, 0XB2, 0XA4, 0XDF, 0X79, 0X9D, 0XBE,
+  0X4B, 0XEE, 0X1E, 0X56, 0XAD, 0XED, 0XF4, 0X4B, 0XFB, 0X5A, 0XA6, 0XA0,
+  0X97, 0X40, 0X21, 0XE9, 0XAE, 0X4C, 0XD8, 0X59, 0XC1, 0X52, 0X8D, 0X14,
+  0X51, 0X05, 0XAB, 0X63, 0X77, 0X35, 0XE8, 0X6C, 0XC6, 0X32, 0X65, 0X2E,
+  0XE2, 0X45, 0XE8, 0X8D, 0X10, 0X8A, 0X7B, 0XC7, 0X1A, 0X40, 0X56, 0X7F,
+  0X18, 0X8A, 0X74, 0X02, 0X1E, 0XC2, 0XE6, 0X52, 0XC1, 0X18, 0X76, 0X15,
+  0XCA, 0XDF, 0X56, 0X28, 0XFE, 0X4E, 0XBD, 0X0F, 0XBD, 0XEC, 0XEC, 0XBF,
+  0X90, 0XE3, 0X5B, 0XDF, 0X8D, 0XC3, 0XB4, 0X02, 0XE3, 0X26, 0X7C, 0XF3,
+  0X11, 0XE2, 0XE4, 0XA5, 0X06, 0XD5, 0X7B, 0X3E, 0X1F, 0X6F, 0X7E, 0XC8,
+  0X8F, 0X9D, 0XFC, 0XEF, 0X15, 0X4F, 0X5F, 0X1F, 0X33, 0X78, 0X08, 0X87,
+  0XEC, 0X63, 0X52, 0XF5, 0XEF, 0X42, 0XB5, 0X07, 0X64, 0X0B, 0X8A, 0X1B,
+  0X02, 0X2E, 0X03, 0X7D, 0X89, 0XC1, 0X83, 0X7B, 0XA5, 0X26, 0X66, 0XCD,
+  0XC1, 0XC5, 0XE6, 0X99, 0X05, 0X82, 0XB5, 0XA7, 0X6F, 0X80, 0X4F, 0XD4,
+  0X72, 0X98, 0XE2, 0XCE, 0X3F, 0XC9, 0XFC, 0X8F, 0X57, 0XEB, 0X70, 0XDB,
+  0XFE, 0X75, 0XA5, 0XA5, 0X06, 0X87, 0XB9, 0XE1, 0X9E, 0X02, 0XBB, 0X1B,
+  0X0E, 0XE5, 0X7B, 0XA1, 0X33, 0X39, 0X5A, 0XFE, 0XE1, 0XDE, 0XB2, 0XA5,
+  0X76, 0XF2, 0X78, 0XF8, 0XEE, 0X20, 0X4C, 0X9C, 0X4F, 0X36, 0X01, 0XE1,
+  0X3F, 0XEB, 0XC0, 0XE4, 0XAF, 0XEF, 0XF2, 0X07, 0X36, 0XB6, 0X77, 0XB2,
+  0X18, 0XF1, 0XA0, 0XA5, 0X37, 0X99, 0XE3, 0XCD, 0X85, 0X88, 0XA9, 0X29,
+  0X1C, 0X7B, 0X0D, 0X40, 0XB7, 0X67, 0X17, 0X07, 0XAA, 0X25, 0X18, 0X0B,
+  0XB2, 0XE3, 0X0B, 0XA0, 0X99, 0XEB, 0XDE, 0XAF, 0X7F, 0X8A, 0XBC, 0X69,
+  0X5F, 0XAB, 0XE3, 0XA2, 0X6E, 0XFA, 0X31, 0XDF, 0X0F, 0X17, 0XFA, 0X1F,
+  0X26, 0XB6, 0X96, 0XB4, 0XF1, 0XD9, 0X54, 0XAC, 0XDE, 0XE8, 0X81, 0XBF,
+  0X73, 0XB7, 0XFD, 0X5E, 0XFC, 0XAC, 0X87, 0XF1, 0X7D, 0X3D, 0X3D, 0XE6,
+  0X2E, 0X8E, 0XEE, 0XB3, 0X3B, 0X3C, 0X02, 0XB6, 0XF9, 0X67, 0X46, 0XBE,
+  0X37, 0X1A, 0X24, 0XE9, 0X80, 0X5A, 0X4F, 0XB2, 0X59, 0X82, 0XC7, 0XDB,
+  0XCD, 0X94, 0X51, 0X62, 0X50, 0XD4, 0X0E, 0X79, 0X04, 0XFC, 0XB7, 0X84,
+  0XDC, 0X0D, 0XEA, 0X89, 0X61, 0XFD, 0X21, 0X54, 0X76, 0X16, 0X0B, 0X2B,
+  0XF7, 0X4D, 0X11, 0X32, 0X78, 0X5E, 0X31, 0XD5, 0X8E, 0X96, 0XDE, 0X22,
+  0X18, 0XE8, 0X87, 0XD2, 0XC7, 0XE4, 0X6F, 0X35, 0X72, 0X5F, 0X0B, 0X6C,
+  0XD6, 0XC7, 0X77, 0XF3, 0XF0, 0XCF, 0X73, 0X48, 0XB7, 0XC0, 0XE2, 0XA3,
+  0XE2, 0XA1, 0X03, 0X40, 0XDD, 0X6E, 0XDF, 0XA1, 0X5D, 0XBC, 0X1E, 0X97,
+  0XC9, 0XEF, 0XF7, 0XBE, 0XBC, 0X23, 0X64, 0X1C, 0XCC, 0XE3, 0XCA, 0X88,
+  0X0C, 0X03, 0X9D, 0X61, 0X4C, 0XA4, 0XC7, 0XA8, 0XDF, 0X19, 0XE7, 0X2B,
+  0X59, 0X16, 0X49, 0X4E, 0X2F, 0X80, 0X52, 0XBC, 0XA9, 0X01, 0X38, 0X19,
+  0X46, 0X7F, 0XA6, 0X36, 0X17, 0X5A, 0X5B, 0X13, 0XB2, 0XB1, 0X85, 0XAC,
+  0X62, 0X91, 0X8A, 0X9A, 0XA2, 0X72, 0X90, 0XF2, 0X06, 0XB4, 0XAD, 0X2F,
+  0X28, 0X8A, 0XD5, 0X96, 0XBC, 0X2F, 0XD2, 0X1C, 0X9F, 0X6F, 0X96, 0X68,
+  0X12, 0XBA, 0XAA, 0X8B, 0X93, 0XA2, 0X03, 0X5B, 0X16, 0X75, 0X70, 0XB7,
+  0X47, 0X62, 0XC3, 0X95, 0XB1, 0XA1, 0X2D, 0X53, 0X57, 0X22, 0X7D, 0X16,
+  0X42, 0XBB, 0XF3, 0X49, 0XEC, 0X87, 0XA1, 0X70, 0X04, 0XB7, 0XD3, 0X28,
+  0X0C, 0X5B, 0X68, 0X48, 0XC3, 0X88, 0X4E, 0X20, 0XA8, 0XC8, 0X41, 0X49,
+  0X48, 0X22, 0XC3, 0X51, 0XFE, 0X4A, 0X73, 0X31, 0X77, 0X51, 0XDF, 0X69,
+  0X52, 0X6B, 0X05, 0XC0, 0X61, 0X60, 0X7B, 0XBC, 0X79, 0X64, 0X98, 0XE5,
+  0XAA, 0XCD, 0XF0, 0X20, 0X97, 0X12, 0X95, 0X57, 0X22, 0X39, 0XF5, 0X22,
+  0X46, 0XDF, 0X00, 0X67, 0X16, 0X33, 0X85, 0X86, 0X1A, 0X23, 0XC0, 0X49,
+  0X78, 0X28, 0X1E, 0XFE, 0X01, 0X76, 0XC2, 0XDC, 0X88, 0XE2, 0X25, 0X5E,
+  0XFF, 0XFB, 0XF5, 0XEE, 0XBE, 0X47, 0XC2, 0XF5, 0XF8, 0X30, 0X46, 0X46,
+  0XFC, 0X1B, 0X8C, 0X48, 0X69, 0X42, 0X25, 0XCA, 0X19, 0XB7, 0X4C, 0XF4,
+  0XF7, 0XD6, 0X0E, 0XE5, 0X3C, 0X23, 0X8A, 0XB3, 0X88, 0X51, 0X85, 0X21,
+  0XD5, 0XD9, 0X1A, 0X07, 0X9E, 0XB4, 0XF0, 0X27, 0XA6, 0X86, 0X03, 0XE2,
+  0X00, 0X66, 0X22, 0XDC, 0X58, 0X41, 0X02, 0X6D, 0X33, 0X3C, 0X54, 0X5F,
+  0X05, 0XE2, 0X23, 0X5C, 0X04, 0XD7, 0X6B, 0XE6, 0XCD, 0X50, 0X30, 0X71,
+  0X81, 0X89, 0X2C, 0X15, 0X0F, 0XA0, 0X6D, 0XEF, 0X23, 0X61, 0XF0, 0X78,
+  0X06, 0XF3, 0X59, 0XC8, 0XA6, 0XA0, 0X0F, 0XC6, 0XFF, 0X7E, 0XA8, 0X25,
+  0X2A, 0XCF, 0XD7, 0XD5, 0XE6, 0X10, 0X37, 0X6B, 0XFC, 0X4B, 0X57, 0XC4,
+  0XCC, 0X15, 0X4F, 0XC9, 0XBF, 0XD7, 0X09, 0XB8, 0XE6, 0X14, 0X29, 0XB5,
+  0X63, 0X1D, 0X11, 0XB5, 0XF9, 0XEC, 0XC6, 0X1C, 0X5D, 0X21, 0X32, 0X80,
+  0X18, 0X3A, 0X87, 0XC1, 0XE9, 0XB3, 0XD3, 0X08, 0X1E, 0X61, 0XF2, 0X4F,
+  0X51, 0X04, 0X80, 0X54, 0XE8, 0X37, 0X47, 0X21, 0X48, 0XE8, 0XC6, 0X63,
+  0X91, 0X88, 0X2B, 0XAE, 0XE4, 0X30, 0X25, 0X82, 0XBD, 0X4F, 0X56, 0XC0,
+  0X81, 0XD0, 0XAA, 0X7F, 0XB9, 0X82, 0XFE, 0X19, 0X1A, 0X50, 0XB9, 0X80,
+  0X33, 0X86, 0X15, 0XE4, 0X18, 0X9F, 0X5F, 0X08, 0XE0, 0X4E, 0X8F, 0X15,
+  0XFA, 0XCC, 0XCA, 0XE3, 0X56, 0X04, 0XE9, 0X63, 0XD4, 0X5E, 0XCD, 0X4E,
+  0XB7, 0X07, 0XBE, 0X82, 0X1E, 0XEE, 0X75, 0XFE, 0X86, 0X51, 0X02, 0X04,
+  0X4A, 0XEC, 0X1B, 0X51, 0X11, 0X76, 0X8F, 0XA8, 0XD6, 0X6E, 0X30, 0X42,
+  0X3B, 0X8E, 0XF3, 0X6F, 0X2C, 0XB2, 0X21, 0X49, 0XB6, 0X83, 0X1F, 0X11,
+  0XC8, 0X20, 0X87, 0X38, 0X13, 0X86, 0X20, 0X60, 0X2D, 0X3F, 0X4A, 0X81,
+  0X04, 0X45, 0XA9, 0XB9, 0XFD, 0XD0, 0X80, 0XB8, 0XBB, 0X17, 0XF8, 0X31,
+  0XC7, 0X00, 0XC8, 0X3A, 0XE8, 0XC3, 0XD6, 0X79, 0X4A, 0X6A, 0XDA, 0XD9,
+  0XBC, 0XF5, 0X8B, 0X3A, 0XCD, 0X09, 0XC1, 0XF4, 0X71, 0XAF, 0XF0, 0X18,
+  0X16, 0XBF, 0XBE, 0X1F, 0XDB, 0X74, 0XF5, 0XAA, 0XED, 0XCF, 0XC3, 0X5C,
+  0X1D, 0X5E, 0XF7, 0X3B, 0X9C, 0X7F, 0X9D, 0X1D, 0XE3, 0X01, 0XEC, 0XF9,
+  0XE0, 0X04, 0X4A, 0X20, 0XD5, 0X07, 0X04, 0X1C, 0X36, 0X95, 0X00, 0X32,
+  0X1A, 0X79, 0X0D, 0X47, 0X38, 0X57, 0X57, 0X76, 0X81, 0X26, 0XA2, 0XE3,
+  0X0A, 0X85, 0X15, 0XAC, 0X68, 0XBD, 0X4F, 0X64, 0XD1, 0X22, 0X76, 0X73,
+  0X07, 0XCC, 0X25, 0X0B, 0XA6, 0X13, 0X9B, 0XE2, 0X7A, 0X5C, 0XA0, 0XFB,
+  0XD4, 0X61, 0X50, 0X3E, 0XE0, 0X61, 0XD2, 0X31, 0X04, 0X7E, 0XE3, 0X88,
+  0X14, 0X94, 0X83, 0X27, 0X6F, 0X77, 0X5B, 0X4B, 0X6C, 0XA6, 0X33, 0XAF,
+  0XFB, 0XF3, 0X7B, 0X66, 0XC3, 0X9E, 0X77, 0XA2, 0XD0, 0X70, 0X49, 0X4B,
+  0XCB, 0X59, 0X9C, 0XA9, 0X69, 0XCC, 0XFA, 0X3E, 0X7E, 0XD6, 0X41, 0X3D,
+  0XA2, 0XB8, 0X79, 0X69, 0X42, 0X18, 0X5B, 0X5A, 0XF0, 0XE5, 0X8C, 0X46,
+  0X7A, 0X04, 0X20, 0XC7, 0XC6, 0XA8, 0X17, 0X7C, 0X22, 0X74, 0X0A, 0X4E,
+  0X04, 0XC9, 0X31, 0X3C, 0XF6, 0X80, 0X23, 0X04, 0X24, 0XC8, 0X03, 0XDA,
+  0X8E, 0X54, 0XEC, 0XB5, 0X04, 0X36, 0X4C, 0X80, 0X43, 0XBC, 0X19, 0XC4,
+  0X8C, 0X51, 0X27, 0XD5, 0X4C, 0XB8, 0X2F, 0X45, 0XB7, 0X37, 0X63, 0X6A,
+  0X5A, 0X5C, 0X6E, 0X91, 0X8E, 0X5E, 0X52, 0X75, 0X0D, 0XBD, 0X6E, 0X37,
+  0XBF, 0X18, 0XE2, 0X1E, 0X04, 0X39, 0X72, 0X3F, 0X1E, 0X5F, 0XB8, 0XF9,
+  0XEC, 0X37, 0X49, 0X4D, 0XB8, 0X05, 0X47, 0X4C, 0X20, 0X11, 0XC6, 0XEC,
+  0X64, 0XC7, 0X65, 0X9B, 0X50, 0X39, 0XFE, 0X8E, 0X4B, 0XFA, 0XDC, 0X5D,
+  0XE6, 0X14, 0X2D, 0X4A, 0X0C, 0X28, 0X40, 0XC6, 0X7D, 0X58, 0X2B, 0X10,
+  0X71, 0XDC, 0X19, 0X23, 0X86, 0X90, 0X44, 0X14, 0X94, 0XEC, 0XA1, 0X80,
+  0X6E, 0X73, 0X98, 0X20, 0X41, 0X23, 0X7C, 0X88, 0XE3, 0XD7, 0XFB, 0X27,
+  0XB9, 0XDD, 0XDC, 0XB5, 0XBD, 0X83, 0X89, 0XA7, 0XEF, 0X28, 0X8F, 0XED,
+  0X2D, 0X65, 0X66, 0XCC, 0X5E, 0XD2, 0X10, 0XA6, 0X35, 0X54, 0XE9, 0X1E,
+  0X28, 0X8C, 0X0D, 0X28, 0X4A, 0X21, 0X8D, 0X71, 0X4B, 0X42, 0X12, 0X37,
+  0X77, 0XC2, 0X3E, 0X5A, 0X10, 0X15, 0X64, 0X02, 0XEC, 0X54, 0X57, 0XB0,
+  0XBE, 0XFB, 0XB4, 0X2D, 0X28, 0X31, 0X37, 0XB1, 0XB7, 0XB9, 0X86, 0X20,
+  0X5A, 0X4D, 0X7E, 0X98, 0XD8, 0X14, 0X0A, 0X36, 0X43, 0X01, 0X67, 0X72,
+  0XBD, 0X24, 0XA4, 0XD6, 0X63, 0X7A, 0X9E, 0XF7, 0XA7, 0XFE, 0XDF, 0XE6,
+  0XD1, 0X19, 0X35, 0X55, 0X00, 0X93, 0X6A, 0X24, 0XAC, 0X0C, 0X3E, 0X51,
+  0XD9, 0X8D, 0X55, 0X19, 0X9C, 0X9F, 0X19, 0XA3, 0XA5, 0XC2, 0XC3, 0X8D,
+  0X8A, 0X64, 0X15, 0XEB, 0XCE, 0X45, 0X60, 0X21, 0X47, 0X0B, 0X84, 0X3E,
+  0XE4, 0X20, 0X69, 0X12, 0X84, 0XA8, 0XF4, 0X27, 0X78, 0XA7, 0X4D, 0X5C,
+  0X81, 0X91, 0X40, 0X6E, 0X3A, 0X59, 0X31, 0X12, 0X43, 0XFF, 0X9C, 0XDA,
+  0XC2, 0X54, 0X2A, 0X77, 0X5C, 0XC3, 0XB7, 0X84, 0X93, 0X85, 0X56, 0XAD,
+  0XAD, 0XE3, 0X62, 0X84, 0X5E, 0X47, 0X3E, 0XDB, 0X69, 0X66, 0X80, 0X32,
+  0XED, 0XBE, 0X66, 0XF3, 0XDE, 0XA4, 0XA3, 0X69, 0X89, 0X04, 0X09, 0XA7,
+  0X2F, 0X05, 0X72, 0XE2, 0XF9, 0X92, 0X7B, 0X50, 0X21, 0X04, 0X52, 0X28,
+  0X05, 0X0F, 0X8B, 0XF6, 0XEA, 0X28, 0XCA, 0XC2, 0X63, 0X47, 0X2A, 0X1A,
+  0X18, 0XA7, 0X55, 0X7B, 0XFB, 0XA9, 0XEC, 0XE9, 0X1E, 0XDA, 0X72, 0XC2,
+  0XE7, 0XDC, 0X2D, 0XC0, 0X75, 0XA4, 0X04, 0X2A, 0XB8, 0X00, 0X49, 0X8F,
+  0X74, 0X49, 0XE9, 0X42, 0X01, 0X14, 0XF7, 0X60, 0X47, 0X73, 0X51, 0XF7,
+  0XD9, 0X68, 0X3D, 0X88, 0X84, 0XA9, 0X8C, 0XBC, 0X98, 0X1B, 0X9D, 0XB7,
+  0X05, 0X50, 0X23, 0XD9, 0X8A, 0X60, 0X1F, 0X09, 0XDC, 0XDD, 0X42, 0X52,
+  0X81, 0X80, 0XEC, 0XC9, 0X53, 0X4E, 0XFB, 0XF4, 0X56, 0X5E, 0X82, 0XC5,
+  0XEE, 0X5C, 0X27, 0XDE, 0XB2, 0X30, 0X4B, 0X5B, 0X32, 0XCA, 0X21, 0X7E,
+  0XB1, 0XBF, 0X90, 0X27, 0XCE, 0XB9, 0X68, 0X36, 0XFB, 0X8B, 0X61, 0XFE,
+  0X53, 0X4D, 0X95, 0X60, 0XE5, 0XFE, 0XAC, 0XD0, 0XDE, 0XE2, 0X8E, 0XF1,
+  0XC5, 0X9E, 0XF1, 0X22, 0XE3, 0XD0, 0X47, 0XD6, 0XF7, 0X1F, 0X98, 0X18,
+  0X2D, 0X4E, 0X26, 0X86, 0XC6, 0XCD, 0X51, 0XA3, 0X8A, 0XE8, 0X60, 0XDF,
+  0X85, 0XD0, 0X81, 0XC8, 0X34, 0X30, 0X9D, 0XFE, 0XA6, 0X51, 0X26, 0X39,
+  0XCE, 0X89, 0XB3, 0X7C, 0X31, 0XE4, 0X70, 0X03, 0X84, 0XB0, 0X80, 0X99,
+  0XE7, 0XC1, 0XE4, 0X90, 0XA0, 0XCE, 0X79, 0X80, 0XA8, 0X63, 0XBF, 0X65,
+  0X91, 0X37, 0X8A, 0X91, 0X93, 0XDA, 0XA1, 0X3C, 0X27, 0X91, 0X11, 0X26,
+  0X0C, 0X27, 0XBC, 0X1F, 0X91, 0XF9, 0X14, 0X0A, 0X8C, 0XC5, 0X07, 0X48,
+  0X45, 0XD0, 0X45, 0XFA, 0X90, 0XC2, 0XB4, 0X19, 0X00, 0X90, 0X7C, 0XFA,
+  0XF1, 0X80, 0XC2, 0X12, 0XB2, 0XE8, 0XFE, 0XA0, 0X9E, 0XED, 0XC5, 0XFB,
+  0XD5, 0X26, 0XA8, 0XA2, 0X1C, 0X1F, 0XC1, 0X6E, 0X97, 0XC9, 0XB5, 0XFB,
+  0X79, 0X00, 0XE7, 0X0D, 0X23, 0XA9, 0X75, 0X4B, 0X36, 0XA7, 0XDC, 0XBC,
+  0X90, 0X57, 0X8D, 0X04, 0X15, 0X3B, 0X4A, 0XCC, 0X73, 0XBC, 0XAC, 0XE4,
+  0XDA, 0X44, 0XDB, 0X62, 0XD2, 0X43, 0X1E, 0XDC, 0X9F, 0X84, 0XD1, 0XF5,
+  0X14, 0XFD, 0XE0, 0X9A, 0X53, 0XA8, 0XF9, 0XC6, 0X91, 0XD7, 0X94, 0X69,
+  0X76, 0XA9, 0X9D, 0X95, 0XC1, 0X98, 0X8A, 0XC5, 0XBA, 0XE4, 0X7B, 0XD7,
+  0XAE, 0XDE, 0X36, 0XA0, 0X1B, 0X5F, 0X0F, 0X6E, 0X00, 0XDA, 0XA1, 0XF3,
+  0XF0, 0X1B, 0X94, 0X30, 0X80, 0X44, 0X06, 0X4C, 0X33, 0XBA, 0X98, 0X1B,
+  0X15, 0XD6, 0X84, 0XB4, 0X25, 0X53, 0XF6, 0XC9, 0XD5, 0XC9, 0X3E, 0XC6,
+  0X14, 0XA2, 0XE2, 0XAE, 0XBC, 0X13, 0XFD, 0XF0, 0XE8, 0X29, 0X8C, 0X00,
+  0X79, 0X81, 0X48, 0X83, 0X10, 0X88, 0XE8, 0X0C, 0X90, 0X27, 0XBA, 0XCC,
+  0X43, 0XE9, 0X67, 0XF8, 0X04, 0X16, 0X94, 0X1C, 0X66, 0X65, 0X18, 0XFB,
+  0XA2, 0X0C, 0X8E, 0XB9, 0X49, 0X2F, 0XCE, 0X3D, 0XC2, 0X1D, 0X91, 0XD9,
+  0X12, 0XD1, 0XD8, 0X36, 0XF0, 0XEF, 0XFB, 0X07, 0X16, 0X71, 0XA0, 0X66,
+  0XC2, 0XA4, 0XEE, 0X5D, 0X78, 0XE8, 0X1A, 0X7D, 0X3C, 0X25, 0X54, 0XCE,
+  0X26, 0XA8, 0XFE, 0X1B, 0X2B, 0X09, 0XC4, 0X43, 0X0F, 0X85, 0X95, 0X08,
+  0X66, 0X71, 0XAE, 0XBA, 0X9F, 0X08, 0X74, 0XCD, 0XDE, 0X5E, 0X40, 0XF9,
+  0X91, 0X9A, 0X38, 0X36, 0X5D, 0X9F, 0X79, 0X9F, 0XF7, 0X67, 0X37, 0X16,
+  0X67, 0X18, 0XA9, 0XA5, 0XE8, 0XA9, 0XB3, 0X7A, 0X1A, 0XEE, 0X5F, 0X7F,
+  0X47, 0XAE, 0XD0, 0XE5, 0X75, 0X79, 0XB9, 0X6E, 0XD1, 0X27, 0X5E, 0X45,
+  0XF4, 0X5E, 0XAD, 0X9B, 0X0D, 0XB7, 0XAA, 0X06, 0XFF, 0XE8, 0X14, 0X8F,
+  0X2D, 0XC9, 0XA3, 0X17, 0X8C, 0X56, 0XEC, 0XB6, 0XBA, 0XB3, 0X35, 0X57,
+  0XCB, 0X5F, 0X37, 0XB4, 0X12, 0X03, 0XD5, 0XE5, 0X0A, 0X34, 0XEA, 0XEE,
+  0XF9, 0X7C, 0X7D, 0XE9, 0XBD, 0XE9, 0XF2, 0X7B, 0XB4, 0XB3, 0X09, 0XAA,
+  0X3E, 0X36, 0X45, 0XBD, 0X93, 0XEC, 0XCC, 0X78, 0XB1, 0X6D, 0XCC, 0X77,
+  0XDB, 0X93, 0X99, 0X4E, 0X30, 0X81, 0X5E, 0X34, 0X58, 0XCE, 0X95, 0XCA,
+  0XF3, 0X71, 0XFB, 0X42, 0X74, 0XDB, 0X08, 0X51, 0X1C, 0X39, 0XEF, 0X65,
+  0X3A, 0X28, 0X01, 0XFC, 0XCA, 0XD4, 0X8F, 0X3C, 0X14, 0XED, 0XE9, 0X05,
+  0XC7, 0XF1, 0X79, 0X59, 0XAF, 0XED, 0X0E, 0X6E, 0X28, 0X53, 0X38, 0X84,
+  0X89, 0X4E, 0X98, 0XBA, 0XF8, 0X6B, 0XF1, 0X04, 0XFE, 0XEA, 0XF0, 0X1C,
+  0XCF, 0X9A, 0X06, 0X53, 0XAC, 0X77, 0X45, 0XFB, 0X3C, 0X5D, 0X67, 0X7A,
+  0X6C, 0X1E, 0X28, 0X33, 0XF7, 0X65, 0X16, 0X43, 0X38, 0XFC, 0XD0, 0XD7,
+  0XF5, 0XFA, 0X79, 0XEC, 0XC9, 0X0D, 0X1C, 0XB4, 0X5B, 0X50, 0X2F, 0X7F,
+  0X7E, 0X17, 0XD4, 0X43, 0X7D, 0X64, 0X27, 0X78, 0XA2, 0XEF, 0X7C, 0XF4,
+  0X0F, 0X48, 0X50, 0X27, 0X4D, 0XC1, 0X97, 0X89, 0X9E, 0XBF, 0X5D, 0X85,
+  0X38, 0X0C, 0XF2, 0X39, 0XB3, 0XC8, 0X78, 0X7D, 0X7C, 0X17, 0XAD, 0XD9,
+  0XD5, 0XD5, 0X7C, 0X4F, 0XF2, 0X14, 0X1B, 0XE1, 0XF6, 0XE1, 0X56, 0X91,
+  0X9F, 0XF1, 0X69, 0XE8, 0X76, 0XEB, 0XBB, 0X2E, 0XAD, 0XBF, 0XB8, 0XBF,
+  0X17, 0XF7, 0X80, 0X71, 0X30, 0X59, 0XC4, 0X64, 0XEE, 0XEE, 0X4C, 0X5B,
+  0XA7, 0XD1, 0X78, 0XC5, 0XDF, 0XA8, 0X3A, 0X9E, 0X6B, 0XEC, 0XC6, 0XC0,
+  0XE3, 0X81, 0X9E, 0X75, 0X48, 0XAD, 0X4D, 0X5A, 0XAD, 0X2C, 0XBA, 0X9A,
+  0X36, 0X55, 0XAD, 0X61, 0X19, 0X0D, 0XDB, 0X80, 0X3C, 0X4A, 0XEE, 0X1E,
+  0X6D, 0XB4, 0X6C, 0X9F, 0X4F, 0XE1, 0XFF, 0X34, 0X3F, 0X87, 0X34, 0XF4,
+  0X8F, 0XDA, 0X06, 0XA9, 0X77, 0X76, 0X33, 0XF0, 0XF6, 0X31, 0X59, 0XA5,
+  0XEF, 0X57, 0X50, 0X6E, 0X0E, 0XA5, 0X80, 0X16, 0XEA, 0X25, 0XB9, 0XD4,
+  0XA2, 0X80, 0X5B, 0XA8, 0XC9, 0X58, 0X74, 0XAC, 0X32, 0XA2, 0X33, 0X59,
+  0X9D, 0X68, 0X4A, 0X89, 0X4F, 0X55, 0XD4, 0X66, 0X0B, 0XF0, 0X2D, 0X67,
+  0XAF, 0X36, 0XC8, 0X10, 0X8C, 0X65, 0X92, 0X0F, 0X73, 0XB3, 0X7A, 0XC0,
+  0XB8, 0X23, 0XD0, 0X3B, 0X74, 0X6A, 0X5F, 0X21, 0X0B, 0X65, 0X3C, 0X05,
+  0X2F, 0X18, 0X28, 0X7B, 0XEF, 0XDC, 0XF7, 0XF9, 0XB9, 0X3B, 0XBE, 0X65,
+  0X99, 0XD9, 0X72, 0X35, 0X32, 0XF4, 0X75, 0X33, 0X19, 0XBD, 0XB0, 0X64,
+  0X18, 0XF2, 0XE8, 0XCC, 0XAE, 0X35, 0X6E, 0XA5, 0X68, 0XF5, 0XEB, 0XE0,
+  0XFD, 0XE1, 0X74, 0X92, 0X31, 0X1B, 0X2D, 0X04, 0XEB, 0X44, 0XE1, 0X93,
+  0X65, 0X91, 0X7F, 0X5C, 0X20, 0X59, 0XFC, 0X62, 0XF8, 0X24, 0X5E, 0X7C,
+  0X65, 0X3F, 0XA9, 0XEC, 0X92, 0XE9, 0XA7, 0XED, 0X92, 0XB5, 0XFE, 0X68,
+  0XAF, 0X0D, 0X6B, 0XD0, 0XDE, 0XF9, 0X5E, 0XE9, 0X38, 0XF9, 0X40, 0XA6,
+  0X75, 0X55, 0X0B, 0X2D, 0XAD, 0X58, 0X7F, 0XF1, 0X28, 0X51, 0XAC, 0X5B,
+  0X98, 0X82, 0X2D, 0X40, 0X6D, 0X74, 0XE5, 0XA3, 0X8A, 0X85, 0X4A, 0X19,
+  0X90, 0X6C, 0XDD, 0X09, 0X01, 0X49, 0X83, 0XCC, 0X1B, 0X22, 0X4C, 0XE0,
+  0X2B, 0X84, 0XC1, 0XBC, 0X6E, 0X8D, 0X79, 0X5B, 0X8A, 0XB5, 0X6F, 0X37,
+  0X3C, 0X23, 0XD1, 0XC2, 0X98, 0X35, 0XA8, 0X65, 0XBF, 0XD4, 0X20, 0XA9,
+  0XAB, 0XFB, 0X04, 0XC3, 0X62, 0X09, 0X2A, 0X40, 0X15, 0XDF, 0X32, 0X22,
+  0X01, 0XAB, 0X09, 0XE2, 0XC0, 0X28, 0X73, 0X4D, 0XE5, 0X83, 0XF2, 0X94,
+  0XBE, 0X8D, 0X4A, 0X4F, 0XAD, 0XD6, 0XAE, 0XD9, 0XD4, 0XD1, 0X4F, 0X07,
+  0X72, 0XA0, 0X06, 0X35, 0X1F, 0X95, 0X1C, 0XF7, 0XDC, 0X28, 0XAD, 0X0E,
+  0X63, 0XA8, 0X9E, 0X4D, 0X70, 0XA0, 0X16, 0X51, 0X39, 0X9A, 0X0D, 0X57,
+  0XAF, 0X52, 0X35, 0X01, 0XAE, 0X5C, 0X4F, 0XD3, 0XEA, 0X0C, 0XB1, 0XE9,
+  0XAE, 0X50, 0X99, 0XDC, 0X8D, 0X0D, 0X55, 0XDD, 0X8C, 0X4E, 0X4A, 0X98,
+  0X2C, 0XCF, 0X42, 0X45, 0X59, 0X18, 0X01, 0X57, 0XC5, 0XDE, 0X71, 0X73,
+  0XEC, 0XD1, 0X95, 0X55, 0XAB, 0X72, 0XD1, 0X68, 0X02, 0XBF, 0X22, 0X4C,
+  0X5E, 0XCD, 0X8C, 0X54, 0XBA, 0X95, 0X48, 0X0F, 0X7D, 0X0D, 0X20, 0X4C,
+  0X01, 0X86, 0XE9, 0X25, 0X70, 0X99, 0X54, 0X4D, 0X00, 0X2C, 0XED, 0X23,
+  0XA4, 0XA1, 0X58, 0X1A, 0X3E, 0X3B, 0XF6, 0X44, 0X05, 0XAA, 0X59, 0X3B,
+  0X71, 0XDB, 0X09, 0X8D, 0X1A, 0X35, 0X6E, 0XA2, 0X1B, 0X6E, 0XA6, 0X26,
+  0XAF, 0X1D, 0XD5, 0XC0, 0X45, 0XBB, 0X47, 0XAC, 0XB2, 0X2C, 0XD3, 0X90,
+  0X31, 0X71, 0X8F, 0X31, 0X79, 0X65, 0XC1, 0XE0, 0X20, 0X22, 0XF7, 0X86,
+  0X21, 0XA5, 0X6E, 0XE3, 0XD9, 0XCC, 0X12, 0X14, 0XB6, 0X3D, 0XCF, 0XEE,
+  0XE0, 0X4A, 0X7C, 0X97, 0X0E, 0XB4, 0X07, 0XF2, 0XBB, 0X18, 0X80, 0X84,
+  0X0B, 0XFE, 0X23, 0X43, 0XFE, 0XC7, 0X65, 0X9E, 0X84, 0X80, 0X6F, 0X5D,
+  0X9D, 0X28, 0XBA, 0X2F, 0X9C, 0XC1, 0X0A, 0X08, 0XA6, 0X4C, 0X38, 0X3F,
+  0X88, 0X3D, 0XB3, 0X8C, 0X14, 0X7A, 0XEC, 0XB8, 0XC8, 0X1E, 0X10, 0X2C,
+  0X7A, 0X13, 0X2F, 0X6B, 0XF9, 0X5D, 0XA6, 0X72, 0XFD, 0XBA, 0XFC, 0X84,
+  0X30, 0X94, 0X0D, 0X58, 0X15, 0X17, 0X1D, 0X30, 0X3B, 0X48, 0X9A, 0XBA,
+  0X88, 0X4A, 0X68, 0X35, 0X6B, 0X0E, 0XA7, 0X6E, 0X87, 0X52, 0XB9, 0X66,
+  0X30, 0X2B, 0X48, 0XB3, 0X86, 0XB0, 0X2C, 0X66, 0X32, 0X4F, 0XB7, 0XE6,
+  0X05, 0X43, 0XE1, 0X80, 0X75, 0X71, 0X92, 0XDA, 0XB0, 0XDD, 0X1C, 0X2B,
+  0X6E, 0XD8, 0X7E, 0XA4, 0X52, 0X31, 0XC9, 0XE6, 0X2A, 0X89, 0X39, 0XF7,
+  0XC0, 0X3A, 0X30, 0XD5, 0X0A, 0X16, 0X84, 0XC5, 0X14, 0X25, 0X26, 0XA9,
+  0X21, 0X3D, 0X65, 0X2C, 0X9E, 0XB3, 0X17, 0X28, 0X5D, 0XB7, 0XA6, 0X12,
+  0X3B, 0X7D, 0XD1, 0XB1, 0X48, 0X15, 0XDB, 0X3A, 0XF6, 0XD4, 0XD8, 0X9A,
+  0XEC, 0X6E, 0X06, 0X2A, 0X32, 0X33, 0X03, 0XAB, 0XC3, 0XC8, 0X06, 0X4B,
+  0XB3, 0XBA, 0X22, 0X12, 0XBC, 0XE2, 0XF6, 0X7A, 0XFA, 0XF0, 0X70, 0XFA,
+  0X72, 0X7A, 0XFA, 0X70, 0X12, 0X07, 0XE7, 0X14, 0XF4, 0X0A, 0X73, 0X38,
+  0X72, 0X57, 0X02, 0XDD, 0XB8, 0X67, 0XE1, 0XFC, 0XCD, 0X06, 0X8C, 0XFC,
+  0X1A, 0X1E, 0X6B, 0X6F, 0X82, 0X69, 0X0B, 0XBB, 0X5D, 0X16, 0X48, 0X2F,
+  0XCD, 0X45, 0X5A, 0X23, 0XA5, 0XF3, 0XE3, 0XF8, 0XA6, 0XD3, 0X44, 0X40,
+  0X44, 0XA7, 0XF6, 0X49, 0XCC, 0X0A, 0X34, 0XFB, 0XE7, 0X56, 0XAC, 0X50,
+  0XB0, 0X2F, 0X66, 0X55, 0XA6, 0X6F, 0XCF, 0XFC, 0XDC, 0X91, 0X10, 0X76,
+  0X41, 0X90, 0X2D, 0XFA, 0XED, 0XCE, 0XEF, 0X93, 0X18, 0XE7, 0X4E, 0X0D,
+  0XD1, 0X20, 0X9E, 0X4B, 0X04, 0X99, 0X04, 0XAD, 0XD1, 0XC1, 0X80, 0X84,
+  0XB2, 0X83, 0XC9, 0XCC, 0XF4, 0X79, 0XE9, 0XFD, 0X31, 0XE2, 0X88, 0XE6,
+  0XF1, 0X12, 0X48, 0XC0, 0XEC, 0X9A, 0X72, 0X4E, 0XA0, 0X76, 0XAD, 0X72,
+  0X45, 0XB3, 0X47, 0XD7, 0X6A, 0X43, 0X66, 0XC5, 0X97, 0X01, 0X29, 0XA6,
+  0XB0, 0X95, 0X4C, 0X7F, 0X88, 0X0A, 0XD0, 0XEC, 0X92, 0X55, 0X47, 0XF5,
+  0X3E, 0X79, 0XD5, 0XC5, 0XAA, 0XF1, 0X85, 0X0B, 0XAD, 0X9C, 0XE8, 0X8A,
+  0X35, 0X8A, 0XD3, 0X1E, 0X97, 0X12, 0XD5, 0X9B, 0X13, 0X0B, 0XF2, 0X76,
+  0X6B, 0XD2, 0X8B, 0X36, 0X18, 0XD8, 0X20, 0X11, 0X9C, 0X82, 0X35, 0XFF,
+  0X07, 0XFA, 0X96, 0X6F, 0X08, 0XEF, 0X7E, 0X4D, 0X9A, 0XCC, 0X40, 0XAD,
+  0X0C, 0X3D, 0X86, 0XC7, 0X6E, 0X96, 0X96, 0X9C, 0XB3, 0X8D, 0X87, 0XBB,
+  0XEB, 0X7A, 0XF5, 0XC3, 0X3B, 0XB3, 0X27, 0XA0, 0X4A, 0X39, 0X45, 0X25,
+  0XE2, 0XA8, 0XB3, 0XA4, 0X70, 0X66, 0X29, 0X04, 0X98, 0XFB, 0X2A, 0X42,
+  0XDF, 0X18, 0XD8, 0X87, 0XDA, 0X05, 0X87, 0XFC, 0XF4, 0XB9, 0X77, 0X3B,
+  0X1E, 0X7A, 0X1C, 0X0B, 0XA6, 0X0A, 0X49, 0X3D, 0X0D, 0XFA, 0XFE, 0XA8,
+  0XB7, 0X46, 0X69, 0XA0, 0XF0, 0X8D, 0X8D, 0X68, 0X60, 0XF8, 0XAF, 0X5C,
+  0X3F, 0X19, 0X4A, 0XAF, 0XFA, 0XA5, 0XA3, 0X36, 0X65, 0XC8, 0X99, 0XD5,
+  0X11, 0XC0, 0XCD, 0XF4, 0XD7, 0X75, 0X5A, 0X5F, 0XC7, 0XF1, 0XFB, 0XA5,
+  0X3D, 0XA0, 0X22, 0X77, 0XED, 0XC1, 0XD7, 0X0A, 0X23, 0X7B, 0XC0, 0X74,
+  0X1D, 0XFE, 0X41, 0X88, 0XD4, 0XA0, 0XE0, 0X86, 0X0F, 0X70, 0XCB, 0XDC,
+  0X30, 0X72, 0X81, 0X4F, 0X66, 0XE1, 0X05, 0X49, 0XD4, 0X25, 0X56, 0XB1,
+  0X47, 0X96, 0XA8, 0X6E, 0X5A, 0X01, 0X23, 0X46, 0XB2, 0XB5, 0X20, 0XF9,
+  0X1F, 0X2C, 0X01, 0X93, 0XD4, 0X17, 0X03, 0X1D, 0X24, 0XD6, 0X43, 0XC3,
+  0X24, 0X16, 0X6F, 0X0F, 0XFE, 0XE4, 0X70, 0XE6, 0XCF, 0XE4, 0X1B, 0X36,
+  0X98, 0XC4, 0XC2, 0X68, 0X15, 0X86, 0X6E, 0X0F, 0X95, 0X8F, 0XA1, 0X92,
+  0X39, 0XBF, 0X9F, 0XA5, 0X89, 0X0A, 0X5E, 0X9B, 0XEA, 0XE1, 0XB8, 0X5B,
+  0XEB, 0XBB, 0X8E, 0X92, 0XAA, 0X09, 0X91, 0XC4, 0X07, 0XFC, 0X6D, 0X88,
+  0X82, 0X46, 0XD4, 0XF6, 0X6E, 0X67, 0X5B, 0X4F, 0XDF, 0XD9, 0X7A, 0X04,
+  0XAC, 0XBC, 0X22, 0XF1, 0XBF, 0X2D, 0X27, 0XEE, 0X43, 0XBA, 0XF2, 0X33,
+  0X33, 0XF2, 0X79, 0X5A, 0X81, 0X19, 0X2E, 0X1C, 0X8D, 0XA8, 0X9D, 0X0E,
+  0XFB, 0X66, 0X04, 0X18, 0X6D, 0X2C, 0X1E, 0X76, 0X9F, 0XB3, 0X8A, 0XDE,
+  0X27, 0XE4, 0XBF, 0X7D, 0X0D, 0XCE, 0X01, 0X3F, 0X8F, 0X3B, 0X7B, 0XEC,
+  0X6B, 0XE2, 0X89, 0XC5, 0X02, 0XCE, 0X6E, 0X57, 0X57, 0X45, 0X45, 0XB2,
+  0XFC, 0X7F, 0XD9, 0X96, 0XBA, 0X7D, 0X8F, 0X1E, 0XA3, 0X6F, 0X20, 0XA5,
+  0XC5, 0XF4, 0X57, 0X5F, 0X0F, 0XA6, 0X4F, 0X0C, 0X1A, 0X82, 0XA0, 0X3E,
+  0XD8, 0X7F, 0XD7, 0X76, 0X57, 0X6A, 0XD8, 0X20, 0X84, 0X0D, 0X84, 0XEA,
+  0XD2, 0XA0, 0X81, 0X6F, 0X62, 0X50, 0XA1, 0X36, 0XA7, 0X74, 0X21, 0XBC,
+  0XA2, 0X15, 0XC1, 0X4A, 0X94, 0XD7, 0X18, 0X25, 0XA3, 0X8A, 0X69, 0XA1,
+  0X41, 0XC4, 0XD0, 0X40, 0XE9, 0XA1, 0X7C, 0X00, 0XF1, 0X07, 0XC0, 0XB7,
+  0XBA, 0XAE, 0X8B, 0X47, 0X56, 0X5B, 0XE0, 0X5E, 0X8B, 0XEA, 0XA3, 0XBC,
+  0X21, 0X3C, 0X5F, 0X72, 0XB2, 0X93, 0X84, 0XA7, 0X21, 0X25, 0X7B, 0X1B,
+  0X8D, 0XE9, 0XED, 0XE6, 0XE0, 0XD5, 0X46, 0XD6, 0X97, 0X42, 0XFB, 0XC4,
+  0XAB, 0XB2, 0X54, 0X53, 0XD0, 0XE7, 0X77, 0XBC, 0X95, 0X93, 0X49, 0XE7,
+  0XE4, 0X8F, 0XA6, 0XAC, 0X5B, 0XE0, 0X93, 0X91, 0X2C, 0X35, 0XED, 0X51,
+  0XC9, 0X50, 0XBE, 0X38, 0XF6, 0XC6, 0XF8, 0XAB, 0X35, 0X6D, 0X0E, 0X12,
+  0XA2, 0X10, 0X78, 0XCC, 0X99, 0X06, 0X53, 0XFC, 0X8E, 0XAB, 0XD9, 0X99,
+  0X00, 0XE4, 0XCD, 0X91, 0XA8, 0X74, 0X65, 0X02, 0XA4, 0X40, 0X3F, 0X97,
+  0X74, 0X84, 0XE3, 0XDE, 0X38, 0XE9, 0XA7, 0X0C, 0X99, 0XED, 0XB4, 0X06,
+  0X91, 0X64, 0X26, 0X6B, 0X12, 0X2D, 0XA8, 0X82, 0X18, 0X34, 0X22, 0XB3,
+  0X45, 0XBD, 0XDB, 0X8E, 0XAE, 0X5E, 0X34, 0XED, 0XC6, 0XE6, 0XC5, 0XA3,
+  0XCC, 0X76, 0XCB, 0X22, 0X3D, 0XE6, 0XEF, 0XBC, 0X86, 0XA2, 0XD8, 0X04,
+  0X3C, 0XE6, 0XC3, 0XB2, 0X2B, 0XC5, 0XD7, 0X83, 0X42, 0XFB, 0X2C, 0X2D,
+  0X6A, 0X21, 0XCA, 0X59, 0X8C, 0X86, 0X1D, 0X1B, 0X64, 0X06, 0X05, 0XB4,
+  0X94, 0XB4, 0X34, 0XE0, 0XE5, 0XA5, 0XCB, 0X0F, 0X3B, 0X26, 0XCF, 0X81,
+  0X02, 0XCB, 0X8C, 0X67, 0X39, 0XD6, 0X63, 0X0A, 0XFD, 0X43, 0XB9, 0X28,
+  0XB1, 0X8C, 0X75, 0XE8, 0XE2, 0XF8, 0XD9, 0X70, 0XC3, 0X70, 0X2C, 0X27,
+  0XE3, 0XC1, 0X04, 0X40, 0X9C, 0X69, 0XD2, 0X04, 0X68, 0XD1, 0X58, 0XAA,
+  0X1E, 0XAB, 0X7D, 0X44, 0XB9, 0X9D, 0X7B, 0X94, 0XD2, 0X49, 0X99, 0X4C,
+  0X88, 0X62, 0X09, 0X6B, 0XB2, 0XF5, 0XC8, 0X01, 0X1C, 0X09, 0X7A, 0X0E,
+  0XD5, 0XEB, 0X55, 0XC8, 0X36, 0X5E, 0XA4, 0X4C, 0XC0, 0X23, 0XF1, 0XE4,
+  0X62, 0X76, 0XC3, 0XF2, 0X7A, 0X85, 0X63, 0X95, 0X7B, 0XE9, 0X3B, 0X8F,
+  0X3E, 0X39, 0X9C, 0X27, 0X1D, 0X54, 0XC8, 0XE1, 0X64, 0X48, 0XBF, 0X32,
+  0X0B, 0XE8, 0X86, 0X0D, 0X3D, 0X31, 0XB6, 0X6E, 0X87, 0X45, 0XD9, 0XBA,
+  0XE1, 0X88, 0XDF, 0X6B, 0XA0, 0X4F, 0X8A, 0X4F, 0X90, 0X99, 0X7E, 0X8C,
+  0XD6, 0XE7, 0XD3, 0X11, 0XF6, 0XB0, 0XE0, 0XED, 0X47, 0XA0, 0XC9, 0X10,
+  0XD2, 0X1B, 0X19, 0X6F, 0X15, 0XC0, 0X8A, 0XD6, 0XDE, 0X37, 0XB8, 0X3E,
+  0XFC, 0X96, 0X1D, 0XD9, 0X18, 0XFE, 0X17, 0XDE, 0X29, 0XF9, 0X00, 0XC0,
+  0X47, 0XC6, 0X91, 0X95, 0X8C, 0X09, 0X66, 0XFE, 0XFB, 0X76, 0X25, 0X29,
+  0X2A, 0X27, 0X52, 0X2B, 0XA4, 0X1F, 0XF8, 0X3F, 0X46, 0XDB, 0XCB, 0X36,
+  0XEE, 0X35, 0X00, 0X00
+};
+static const unsigned char asset_results_js[] = {
+  0X1F, 0X8B, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0XB5, 0X55,
+  0X6D, 0X6F, 0XDA, 0X30, 0X10, 0XFE, 0XDE, 0X5F, 0X71, 0XF2, 0X34, 0X29,
+  0X29, 0X2D, 0X2D, 0XD2, 0X86, 0XB6, 0XF2, 0X22, 0X31, 0XA8, 0X04, 0XDA,
+  0X90, 0X90, 0XE0, 0XC3, 0XA4, 0XAD, 0X8A, 0XDC, 0XC4, 0X29, 0X16, 0XC1,
+  0X41, 0X8E, 0XB3, 0XD2, 0X4D, 0XFC, 0XF7, 0XD9, 0X71, 0X5E, 0X4C, 0X08,
+  0X1D, 0X05, 0X96, 0X0F, 0X90, 0XDC, 0XDB, 0XF3, 0XDC, 0XF9, 0XCE, 0XE7,
+  0XC7, 0XCC, 0X15, 0X34, 0X64, 0XC0, 0X49, 0X14, 0X07, 0X62, 0XB2, 0X5C,
+  0X50, 0XCF, 0XC2, 0X42, 0X60, 0X77, 0XE1, 0XB8, 0X21, 0X13, 0X84, 0X89,
+  0X2B, 0XD8, 0XFE, 0X76, 0X22, 0XFA, 0X9B, 0XD8, 0X7F, 0X2E, 0X40, 0X3E,
+  0XBF, 0X30, 0X87, 0X25, 0X76, 0X1D, 0XBC, 0X82, 0X0E, 0X20, 0XD4, 0XDA,
+  0X12, 0X46, 0X02, 0X97, 0XA4, 0X51, 0X44, 0XBD, 0X0A, 0X91, 0X23, 0XC8,
+  0X5A, 0X94, 0XE4, 0X2B, 0XC5, 0XA4, 0X24, 0XA3, 0XCC, 0X23, 0X6B, 0X29,
+  0XBB, 0XD5, 0X22, 0X3F, 0XE4, 0X56, 0X40, 0X04, 0XD0, 0X44, 0X24, 0XFF,
+  0XDA, 0XD0, 0X6C, 0X25, 0X5F, 0X14, 0X6A, 0XD0, 0XB0, 0X41, 0X73, 0X54,
+  0X4F, 0XCA, 0XB1, 0XD6, 0X81, 0X98, 0X32, 0XF1, 0X69, 0X16, 0X0E, 0XC9,
+  0XBA, 0X94, 0XE6, 0X0F, 0X1D, 0XBD, 0X06, 0XF4, 0XC1, 0XD6, 0XF1, 0X37,
+  0XC9, 0X6F, 0X06, 0X9A, 0XA9, 0X9B, 0X47, 0X81, 0XAB, 0X5A, 0XFC, 0X5F,
+  0XF4, 0XAA, 0X78, 0X0F, 0X7B, 0X18, 0X25, 0XE7, 0X70, 0X10, 0X9D, 0X86,
+  0X49, 0X29, 0X73, 0XD5, 0XE7, 0X25, 0XFD, 0XA7, 0X82, 0X53, 0XF6, 0X54,
+  0XF7, 0X79, 0XB8, 0XEC, 0XCF, 0X31, 0XEF, 0X87, 0X1E, 0X39, 0X28, 0X50,
+  0X75, 0X6E, 0X95, 0X19, 0X28, 0XD7, 0X52, 0X57, 0X38, 0X2E, 0X13, 0XAF,
+  0X76, 0X41, 0X45, 0XBF, 0XC2, 0XB5, 0X86, 0XD9, 0X53, 0X10, 0XEA, 0X5B,
+  0X16, 0X85, 0XF7, 0XD0, 0X68, 0XDA, 0XD0, 0X91, 0X71, 0XEC, 0X42, 0XA5,
+  0X1E, 0XDD, 0X8C, 0X32, 0X61, 0XD4, 0X7E, 0XE4, 0X5D, 0XD4, 0XDA, 0XA7,
+  0XBC, 0X71, 0X65, 0X05, 0XBA, 0X93, 0XF1, 0XD7, 0XD1, 0X00, 0XDE, 0X21,
+  0X09, 0X52, 0XF0, 0XAD, 0X01, 0XBA, 0X83, 0X76, 0XA2, 0XAF, 0XF2, 0XD7,
+  0X36, 0X9D, 0X2C, 0XD7, 0XA2, 0X48, 0X5B, 0X08, 0X6F, 0X6E, 0X1F, 0X2F,
+  0X74, 0XE3, 0XA5, 0XD4, 0XD7, 0X9F, 0X88, 0XB8, 0X0F, 0X88, 0X7A, 0XFD,
+  0XF2, 0X32, 0XF2, 0X2C, 0XA4, 0XC7, 0XFD, 0X3A, 0X75, 0X47, 0X76, 0X9D,
+  0X32, 0X46, 0XF8, 0X70, 0X36, 0XFE, 0X66, 0XCC, 0XDC, 0X31, 0XDE, 0XAA,
+  0X0E, 0XE3, 0X5E, 0X1F, 0X7A, 0X93, 0X3C, 0X5D, 0X49, 0X2B, 0X9B, 0XBF,
+  0XBC, 0X46, 0X46, 0X1D, 0X4F, 0X41, 0X99, 0XCE, 0X7A, 0X65, 0X98, 0X64,
+  0XD2, 0XCE, 0X89, 0X63, 0XDD, 0XDB, 0XD3, 0XE9, 0X68, 0X60, 0XE2, 0XE8,
+  0XF9, 0XC9, 0X41, 0XC0, 0XCA, 0X84, 0XE9, 0X64, 0X00, 0XB2, 0X4F, 0X04,
+  0X2D, 0XB0, 0XD2, 0XC3, 0X3F, 0X67, 0X46, 0X2A, 0XC4, 0X10, 0X47, 0X73,
+  0X17, 0X0B, 0X79, 0XEF, 0X63, 0XEF, 0X45, 0X0D, 0XD1, 0X12, 0X8B, 0X3B,
+  0X74, 0X6E, 0XCE, 0X97, 0XDB, 0X87, 0X7F, 0X69, 0X1E, 0X52, 0X2E, 0X48,
+  0XAA, 0XB9, 0X9B, 0XE1, 0XE6, 0XC2, 0XDF, 0X5E, 0X4E, 0X43, 0XCC, 0XBC,
+  0X68, 0X8E, 0X17, 0XE4, 0X0D, 0X0B, 0XEA, 0XB4, 0X01, 0X48, 0XAE, 0X1C,
+  0X17, 0XAF, 0X9C, 0X80, 0XB2, 0X85, 0X94, 0XE7, 0XD1, 0X5C, 0X59, 0X36,
+  0X41, 0XD2, 0X80, 0X16, 0XC2, 0X28, 0X9D, 0XBA, 0XDC, 0XB8, 0X1E, 0X11,
+  0XD1, 0X13, 0XF2, 0X7A, 0X7C, 0X8C, 0X05, 0XB1, 0XD0, 0X9C, 0X13, 0X1F,
+  0X5D, 0X01, 0X92, 0X6A, 0X11, 0X73, 0X52, 0X57, 0X76, 0XBB, 0X3E, 0XD9,
+  0X1A, 0X1C, 0X84, 0XCF, 0X2C, 0X08, 0XB1, 0X07, 0X93, 0X7E, 0X6F, 0X02,
+  0X3E, 0X0D, 0X88, 0XC1, 0X67, 0XEE, 0X4A, 0XFB, 0XF5, 0XC1, 0X8C, 0X0C,
+  0XF3, 0X7F, 0X70, 0XD2, 0X96, 0X55, 0X7E, 0X3B, 0XBC, 0X86, 0X7D, 0X49,
+  0XEC, 0XBB, 0XC9, 0XEC, 0XE8, 0X9E, 0X59, 0XE9, 0X86, 0XC9, 0X6B, 0X10,
+  0X4A, 0X6E, 0XA9, 0X5A, 0X35, 0XC4, 0XAA, 0X7B, 0X1E, 0X00, 0X33, 0X9D,
+  0X7D, 0X10, 0X49, 0X75, 0XB3, 0X1E, 0X8B, 0X8C, 0X36, 0X38, 0X6C, 0XC5,
+  0XEC, 0X59, 0X2D, 0X46, 0XC4, 0XD7, 0X6F, 0X70, 0X73, 0XCB, 0XCA, 0X7D,
+  0XA4, 0XD6, 0XD1, 0XC7, 0X5B, 0XB5, 0X8D, 0X3E, 0X7C, 0X36, 0XE3, 0XED,
+  0XC6, 0X44, 0X3F, 0X19, 0X2A, 0XAF, 0X8D, 0XCD, 0X89, 0X45, 0XE3, 0X72,
+  0X0C, 0XF3, 0X71, 0X36, 0XE1, 0X8A, 0X29, 0XBD, 0X51, 0X46, 0XC9, 0X9C,
+  0XFE, 0X05, 0X00, 0X64, 0X08, 0X62, 0X45, 0X0A, 0X00, 0X00
+};
+static const unsigned char asset_sessions_js[] = {
+  0X1F, 0X8B, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0XAD, 0X55,
+  0X6D, 0X6F, 0XDA, 0X30, 0X10, 0XFE, 0XDE, 0X5F, 0X61, 0XF9, 0X43, 0X9B,
+  0X08, 0X1A, 0X08, 0X45, 0X88, 0X15, 0XC2, 0XD4, 0X17, 0X36, 0X2A, 0X51,
+  0XB5, 0X02, 0X36, 0XF5, 0X43, 0XA5, 0XCA, 0X4D, 0X1C, 0XE2, 0X36, 0X4D,
+  0X98, 0X6D, 0XBA, 0XB2, 0X89, 0XFF, 0XBE, 0XBB, 0XBC, 0X40, 0X78, 0XC9,
+  0XDA, 0X49, 0XB3, 0X94, 0XC4, 0X76, 0XCE, 0XF7, 0XDC, 0X73, 0X77, 0XBE,
+  0XF3, 0XE7, 0X91, 0XAB, 0X45, 0X1C, 0X11, 0XC9, 0X7D, 0XC9, 0X55, 0X30,
+  0XE6, 0X4A, 0XC1, 0X52, 0X19, 0X26, 0XF9, 0X7D, 0X40, 0X60, 0XBC, 0X32,
+  0X49, 0XE2, 0X11, 0XFF, 0X41, 0X1C, 0X12, 0XF1, 0X9F, 0XE4, 0XEE, 0X7A,
+  0X38, 0XD0, 0X7A, 0X06, 0X1B, 0X73, 0XAE, 0XB4, 0X61, 0X76, 0X12, 0X21,
+  0X14, 0XB0, 0XE2, 0X28, 0X8C, 0X99, 0X07, 0X72, 0X7E, 0XA6, 0X73, 0XA5,
+  0X03, 0X87, 0X17, 0XBB, 0XF3, 0X17, 0X1E, 0X69, 0X6B, 0XCA, 0X75, 0X3F,
+  0XE4, 0X38, 0X3D, 0X5F, 0X5C, 0X79, 0X06, 0X55, 0X29, 0XE2, 0X71, 0X28,
+  0X94, 0XA6, 0XA6, 0X25, 0XA2, 0X88, 0XCB, 0XC1, 0XE4, 0X7A, 0X08, 0X8A,
+  0X68, 0X57, 0X07, 0XBD, 0XAB, 0XCB, 0X6E, 0X0D, 0X3E, 0X38, 0X9D, 0X2C,
+  0X66, 0X7C, 0XB5, 0X38, 0X1F, 0X8F, 0X0B, 0XBF, 0XC6, 0XE2, 0XD7, 0XFA,
+  0XD7, 0X17, 0XC9, 0X5E, 0XB8, 0X5A, 0X2F, 0X45, 0X98, 0XAD, 0X68, 0X67,
+  0X65, 0X0F, 0XF2, 0X62, 0X52, 0XB2, 0XC5, 0XF9, 0XDC, 0XF7, 0XB9, 0X04,
+  0XB4, 0X84, 0X04, 0XF8, 0X60, 0X06, 0XF4, 0XF9, 0X5A, 0X50, 0XF8, 0X46,
+  0X41, 0XAE, 0X48, 0X09, 0X47, 0XAD, 0X46, 0X5C, 0X36, 0XD3, 0X73, 0XC9,
+  0X1F, 0X94, 0X8E, 0XF1, 0X9D, 0XD2, 0X79, 0XD0, 0X55, 0XD2, 0X68, 0X93,
+  0XC7, 0X85, 0XE6, 0XAA, 0X4A, 0X42, 0XA1, 0X75, 0XC8, 0X09, 0X8F, 0X3C,
+  0XC1, 0XA2, 0X8D, 0XF3, 0X68, 0XC6, 0XAB, 0X00, 0XC7, 0XA6, 0XEE, 0XBD,
+  0X64, 0X9A, 0X7D, 0X87, 0XE5, 0X06, 0X64, 0X67, 0XE3, 0X84, 0X1F, 0X4B,
+  0X23, 0XE4, 0X9A, 0X08, 0X38, 0X52, 0XEF, 0XC0, 0XA7, 0X82, 0X40, 0X5D,
+  0XA7, 0XC8, 0XC6, 0X42, 0XDC, 0X21, 0X8F, 0XA6, 0X3A, 0XE8, 0X24, 0X82,
+  0XA9, 0XD4, 0XB6, 0XF1, 0XB9, 0X01, 0X02, 0XA3, 0X66, 0XD0, 0X3A, 0X0C,
+  0X0A, 0X82, 0X68, 0X0F, 0X86, 0XE9, 0X9B, 0X88, 0XB4, 0XDD, 0X32, 0X44,
+  0X95, 0X68, 0X39, 0XE7, 0XA6, 0XA5, 0XE3, 0XB1, 0X96, 0X22, 0X9A, 0X1A,
+  0X76, 0XCB, 0X34, 0X2D, 0X15, 0X0A, 0X97, 0X1B, 0XC7, 0XCD, 0X2D, 0XF3,
+  0X72, 0X9D, 0X7E, 0XC8, 0XA6, 0X0A, 0XD4, 0X16, 0X95, 0XB5, 0X0D, 0XB4,
+  0XE3, 0XA4, 0XE4, 0XC4, 0X23, 0X38, 0X0E, 0X0D, 0XA1, 0X74, 0XF7, 0X7F,
+  0X4E, 0XFA, 0X29, 0X25, 0XFD, 0X44, 0XBA, 0XA4, 0X05, 0X9F, 0X4A, 0XC5,
+  0XDC, 0X65, 0X84, 0X23, 0XD5, 0X55, 0X71, 0XC8, 0X1C, 0X61, 0X27, 0XF1,
+  0X80, 0XBF, 0X19, 0XBB, 0X96, 0X34, 0XE1, 0X79, 0X32, 0X4D, 0X78, 0XD3,
+  0XD3, 0X3D, 0XA0, 0XCB, 0XFD, 0XC4, 0X30, 0X9B, 0X92, 0XE4, 0X64, 0X24,
+  0X80, 0X5B, 0XE3, 0XDC, 0XE7, 0X29, 0XFC, 0X59, 0X78, 0X0E, 0XFA, 0X0F,
+  0X91, 0X09, 0XBD, 0XA7, 0XBD, 0XDB, 0X8B, 0XB3, 0XDB, 0X6E, 0X8D, 0XF5,
+  0XF6, 0XE8, 0X86, 0XAC, 0X4A, 0X3D, 0X74, 0X48, 0XEA, 0X6F, 0XF5, 0X66,
+  0X09, 0X8D, 0X14, 0X0B, 0X68, 0X50, 0XF2, 0X0E, 0XDA, 0X21, 0X93, 0X5A,
+  0XF8, 0XCC, 0XD5, 0X4E, 0XE0, 0X42, 0X42, 0XBE, 0X01, 0XFA, 0XE0, 0X02,
+  0XE0, 0XEF, 0X4A, 0XF0, 0X97, 0XEF, 0X58, 0XD4, 0X2E, 0XB1, 0X08, 0X3D,
+  0X00, 0X57, 0X5F, 0X2E, 0XD0, 0X03, 0XF9, 0XD5, 0X4D, 0X36, 0XB6, 0XEC,
+  0X49, 0X22, 0X90, 0X6C, 0X24, 0XB3, 0X2C, 0X5D, 0XEA, 0X55, 0X72, 0X6C,
+  0XEF, 0X89, 0X7F, 0X29, 0X59, 0X54, 0X90, 0XE2, 0XA1, 0XD2, 0X67, 0X11,
+  0X79, 0XCA, 0X69, 0X03, 0XB9, 0XFE, 0XD9, 0XED, 0XCD, 0XB0, 0X84, 0XDB,
+  0X0E, 0X1B, 0XBB, 0X5E, 0XC2, 0XE6, 0X83, 0XB0, 0X6E, 0XFC, 0X32, 0X83,
+  0XEC, 0XE3, 0X8E, 0X8D, 0X6E, 0X65, 0X60, 0X43, 0XC0, 0X9E, 0XB1, 0XA4,
+  0X94, 0XC2, 0X2F, 0XFF, 0XD9, 0XE1, 0X8D, 0XF7, 0X53, 0XC0, 0X80, 0X6B,
+  0X18, 0XB9, 0X4C, 0X73, 0XCF, 0XFC, 0X70, 0XB6, 0X6A, 0XAC, 0X6C, 0XAB,
+  0XDA, 0XEB, 0X4A, 0X0E, 0XC7, 0XB3, 0XF2, 0X6B, 0X1C, 0X69, 0X79, 0XB4,
+  0X27, 0X16, 0X5A, 0X6E, 0X17, 0X61, 0XAF, 0XB7, 0X0E, 0X2C, 0XD4, 0X51,
+  0XAF, 0X97, 0X6F, 0XED, 0X5E, 0XA9, 0X86, 0XB9, 0X23, 0X94, 0XDD, 0XC5,
+  0XE2, 0XEE, 0X5E, 0XA6, 0X9B, 0XEA, 0X4E, 0X1A, 0XA9, 0XBE, 0X7A, 0X56,
+  0X7D, 0XFE, 0X8A, 0X9D, 0X0B, 0X37, 0XCB, 0X84, 0X33, 0X2F, 0X66, 0XBB,
+  0X7B, 0XBC, 0XF7, 0XD1, 0XF6, 0XC4, 0X66, 0X33, 0XA8, 0XE2, 0X17, 0X81,
+  0X08, 0X3D, 0X08, 0XC7, 0X96, 0XF7, 0XD6, 0X21, 0X48, 0X67, 0XCB, 0X8D,
+  0XEE, 0XC8, 0XA5, 0X8C, 0XE5, 0X7F, 0X6D, 0X8F, 0XFD, 0XD1, 0XE8, 0X66,
+  0X94, 0X91, 0XD9, 0XC0, 0X02, 0X1B, 0X0D, 0XFA, 0XB5, 0X3F, 0XA1, 0X55,
+  0X42, 0X03, 0X68, 0XD7, 0XA7, 0XB5, 0X9A, 0XFD, 0XA9, 0X61, 0XD9, 0XAD,
+  0XB6, 0XD5, 0XB4, 0XEC, 0X5A, 0XA6, 0X53, 0XD1, 0XCC, 0X5D, 0X85, 0XA3,
+  0X79, 0XFF, 0XC3, 0X56, 0X8B, 0X10, 0X49, 0X53, 0X79, 0X4C, 0X9A, 0X0A,
+  0X2D, 0X88, 0X29, 0X70, 0X02, 0X36, 0XFF, 0XE5, 0XC1, 0X1F, 0X8E, 0XC7,
+  0XD3, 0X20, 0X41, 0X08, 0X00, 0X00
+};
+static const unsigned char asset_style_css[] = {
+  0X1F, 0X8B, 0X08, 0X00, 0X00, 0X00, 0X00, 0X00, 0X02, 0X03, 0X95, 0X54,
+  0XCB, 0X6E, 0XDB, 0X30, 0X10, 0XBC, 0XFB, 0X2B, 0X08, 0X05, 0XBD, 0X49,
+  0X06, 0XAD, 0XDA, 0X40, 0XA0, 0XA0, 0XA7, 0X00, 0X3D, 0XF6, 0X07, 0X8A,
+  0X1E, 0X28, 0X71, 0X25, 0X2D, 0X42, 0X71, 0X09, 0X92, 0XAA, 0XED, 0X16,
+  0XFD, 0XF7, 0X92, 0X7A, 0XB8, 0XB2, 0X1D, 0X25, 0XA9, 0X78, 0X11, 0X97,
+  0XC3, 0XDD, 0X99, 0X7D, 0XB0, 0X24, 0X79, 0X66, 0XBF, 0X37, 0X2C, 0X7C,
+  0XA5, 0XA8, 0X5E, 0X1A, 0X4B, 0XBD, 0X96, 0X59, 0X45, 0X8A, 0X6C, 0XC1,
+  0X1E, 0X76, 0X79, 0X5C, 0X4F, 0XC3, 0XF1, 0X6C, 0XE3, 0XBC, 0XAE, 0X1F,
+  0X1F, 0X47, 0X5B, 0X4D, 0XDA, 0X67, 0XB5, 0XE8, 0X50, 0X9D, 0X0B, 0X96,
+  0X7C, 0X45, 0X2B, 0XD8, 0X33, 0X49, 0X48, 0X52, 0X96, 0X3C, 0X53, 0X6F,
+  0X11, 0X2C, 0XFB, 0X06, 0XC7, 0XB0, 0XED, 0X48, 0X93, 0X33, 0XA2, 0X82,
+  0XF1, 0X9E, 0X11, 0X52, 0XA2, 0X6E, 0X0A, 0X96, 0X73, 0X73, 0X1A, 0X4D,
+  0X9D, 0XB0, 0X0D, 0XEA, 0X82, 0XF1, 0XA7, 0XCD, 0X9F, 0XCD, 0XA6, 0XDD,
+  0XA5, 0XAC, 0XCD, 0X53, 0XA6, 0XA0, 0X01, 0X2D, 0X27, 0X82, 0XAF, 0X31,
+  0X28, 0XC9, 0X4A, 0XB0, 0X59, 0X49, 0XDE, 0X53, 0X57, 0XB0, 0X9D, 0X39,
+  0X31, 0X47, 0X0A, 0XE5, 0X35, 0X6A, 0X8A, 0X77, 0X81, 0X1D, 0X62, 0XD4,
+  0X10, 0XC6, 0X41, 0XE5, 0X91, 0XF4, 0XE4, 0X7F, 0XA4, 0X70, 0X01, 0X7D,
+  0XE6, 0X13, 0XCA, 0X8B, 0X52, 0XC1, 0X9C, 0XA4, 0X31, 0X5E, 0XA0, 0XA2,
+  0X84, 0X71, 0X50, 0XB0, 0XF9, 0X6F, 0X0C, 0X74, 0X44, 0XE9, 0XDB, 0X40,
+  0X83, 0XF3, 0X4F, 0X4B, 0X59, 0X99, 0X27, 0X13, 0XAD, 0XB3, 0XC3, 0X36,
+  0X65, 0X5E, 0X5E, 0X79, 0X7C, 0X8F, 0XFA, 0X7C, 0X3B, 0X9A, 0X3C, 0X9C,
+  0X7C, 0X26, 0X14, 0X36, 0X21, 0X5D, 0X15, 0X68, 0X0F, 0X76, 0XF4, 0X6A,
+  0X8B, 0X96, 0X7E, 0X86, 0X94, 0XAF, 0X97, 0X13, 0XE2, 0X9A, 0XC0, 0X5B,
+  0X07, 0X2A, 0XC8, 0X07, 0XB9, 0X8E, 0XE7, 0X7C, 0XBF, 0XCF, 0XF3, 0X01,
+  0X5F, 0X23, 0X28, 0XE9, 0XC0, 0XFF, 0X2F, 0XE9, 0XC3, 0X75, 0X7D, 0X97,
+  0X89, 0X58, 0X23, 0X29, 0XE2, 0X9A, 0XCA, 0X13, 0X19, 0XA6, 0X0C, 0XB5,
+  0XE9, 0XFD, 0X77, 0X7F, 0X36, 0XF0, 0X25, 0XD1, 0X7D, 0X57, 0X82, 0X4D,
+  0X7E, 0XA4, 0XAC, 0XEC, 0X43, 0X9D, 0XF4, 0X3A, 0XFB, 0X3C, 0X7F, 0XA3,
+  0X73, 0X3F, 0X2A, 0X20, 0XF0, 0X5F, 0XD0, 0XBD, 0XEA, 0X77, 0XD4, 0X2D,
+  0X58, 0XF4, 0X8B, 0X13, 0X87, 0XBF, 0X42, 0X47, 0XEC, 0XA0, 0XBB, 0X97,
+  0XFC, 0XAF, 0XE3, 0XA2, 0XA4, 0X42, 0XA2, 0X8B, 0X4D, 0X25, 0X27, 0X6D,
+  0X97, 0XFD, 0XA4, 0X86, 0XC2, 0XA8, 0XA0, 0X0F, 0X31, 0XF8, 0XF6, 0X30,
+  0X5C, 0X1B, 0XB5, 0XBE, 0X57, 0XDF, 0XA5, 0X82, 0X57, 0X47, 0XB8, 0XB7,
+  0X2E, 0X1A, 0X0D, 0XE1, 0XA5, 0X6B, 0X1E, 0XC0, 0X5A, 0XB2, 0XEE, 0X66,
+  0XC4, 0XEA, 0X7A, 0X1F, 0XD6, 0X1B, 0X35, 0XE2, 0XE1, 0X5B, 0X6D, 0XD0,
+  0X9B, 0X41, 0X5A, 0X94, 0XFB, 0X3E, 0XEB, 0X73, 0XA4, 0X48, 0X45, 0X91,
+  0X88, 0XAE, 0X26, 0X2E, 0X63, 0X4A, 0XFD, 0X59, 0X85, 0X9C, 0XA2, 0X0F,
+  0XFD, 0X5E, 0X8D, 0X28, 0XDB, 0X6B, 0X1D, 0X87, 0XD9, 0X58, 0X6A, 0X2C,
+  0X38, 0XB7, 0X84, 0X1F, 0X01, 0X9B, 0XD6, 0X17, 0X21, 0X90, 0X92, 0X03,
+  0X1A, 0XBB, 0X66, 0XDB, 0X82, 0X88, 0X33, 0X8B, 0X9D, 0X68, 0XE6, 0X31,
+  0X0E, 0XF9, 0X36, 0X4A, 0X84, 0X04, 0X97, 0X8A, 0XAA, 0X97, 0X99, 0XF5,
+  0X29, 0XBB, 0X9B, 0XDF, 0X76, 0X72, 0X28, 0X7A, 0X4F, 0X37, 0X0F, 0XD5,
+  0X60, 0X5B, 0XBC, 0X60, 0XB3, 0X38, 0X4D, 0X7A, 0X98, 0XB1, 0XBF, 0X73,
+  0X9E, 0X20, 0X03, 0X5B, 0X05, 0X00, 0X00
+};
+
+static const webserver_asset_t page_assets[] = {
+    { "/app.js", "application/javascript", "\"d681f7273190d7ee\"", asset_app_js, sizeof(asset_app_js) },
+    { "/", "text/html", "\"0802b18d8a122c96\"", asset_index_html, sizeof(asset_index_html) },
+    { "/logo.png", "image/png", "\"09a0b103678089e6\"", asset_logo_png, sizeof(asset_logo_png) },
+    { "/results.js", "application/javascript", "\"1c51269fe11e947e\"", asset_results_js, sizeof(asset_results_js) },
+    { "/sessions.js", "application/javascript", "\"7929b7210b616a4b\"", asset_sessions_js, sizeof(asset_sessions_js) },
+    { "/style.css", "text/css", "\"e60b3f9c8621c697\"", asset_style_css, sizeof(asset_style_css) },
+};
@@ -1,1537 +0,0 @@
-unsigned char page_index[] = {
-  0X1F, 0X8B, 0X08, 0X08, 0XF6, 0X79, 0X3B, 0X68, 0X02, 0X03, 0X69, 0X6E,
-  0X64, 0X65, 0X78, 0X2E, 0X68, 0X74, 0X6D, 0X6C, 0X00, 0XCC, 0XBB, 0X57,
-  0XCF, 0XEC, 0X4A, 0X96, 0X25, 0XF6, 0XDE, 0XBF, 0XE2, 0XA8, 0X06, 0X02,
-  0X24, 0XB0, 0XAA, 0XE9, 0X5D, 0X4D, 0X55, 0X03, 0X24, 0X93, 0XDE, 0X24,
-  0X3D, 0X99, 0X14, 0XF4, 0X40, 0XEF, 0XBD, 0X4F, 0X61, 0XFE, 0XFB, 0XF0,
-  0XDC, 0X32, 0XEA, 0X2A, 0XDD, 0X3B, 0XDD, 0X03, 0XE9, 0X41, 0X4C, 0XE4,
-  0X49, 0X92, 0X11, 0XDC, 0XDC, 0XB1, 0X62, 0X9B, 0XB5, 0XF0, 0XE1, 0XFC,
-  0XCB, 0X9F, 0XFE, 0X97, 0XD7, 0X9B, 0X73, 0X3F, 0X26, 0XFF, 0XA3, 0XDA,
-  0XFA, 0XEE, 0XDF, 0XFE, 0XE5, 0X4F, 0X7F, 0XFB, 0XC9, 0XE3, 0XEC, 0XDF,
-  0XFE, 0XE5, 0XC7, 0X73, 0XFC, 0XA9, 0XCF, 0XB7, 0XF8, 0X47, 0X5A, 0XC5,
-  0XCB, 0X9A, 0X6F, 0X7F, 0XFE, 0XDD, 0XBE, 0X15, 0X7F, 0XA0, 0X7E, 0XF7,
-  0XD7, 0XA1, 0XAD, 0XDE, 0XBA, 0XFC, 0XDF, 0X78, 0XC7, 0X44, 0X11, 0X0E,
-  0XFF, 0X11, 0X60, 0XB6, 0X0D, 0X43, 0XF6, 0X8F, 0X03, 0XFE, 0X57, 0X68,
-  0XF9, 0X13, 0XF8, 0X97, 0XC1, 0X7F, 0X67, 0X63, 0X88, 0XFB, 0XFC, 0XCF,
-  0XBF, 0X3B, 0XEA, 0XFC, 0X9C, 0XC6, 0X65, 0XFB, 0XDD, 0X8F, 0X74, 0X1C,
-  0XB6, 0X7C, 0X78, 0X6C, 0X9E, 0X75, 0XB6, 0X55, 0X7F, 0XCE, 0XF2, 0XA3,
-  0X4E, 0XF3, 0X3F, 0XFC, 0X72, 0XF1, 0XFB, 0X1F, 0XF5, 0X50, 0X6F, 0X75,
-  0XDC, 0XFD, 0X61, 0X4D, 0XE3, 0X2E, 0XFF, 0X33, 0XFC, 0XB7, 0X37, 0XAE,
-  0XDB, 0XFD, 0X37, 0XA3, 0X3F, 0X8F, 0X64, 0XCC, 0XEE, 0X1F, 0XFF, 0XD7,
-  0XDF, 0X2F, 0X7F, 0XB9, 0X15, 0XA7, 0X6D, 0XB9, 0X8C, 0XFB, 0X90, 0XFD,
-  0X21, 0X1D, 0XBB, 0X71, 0XF9, 0XE3, 0X8F, 0XFF, 0X02, 0X23, 0X3F, 0X3F,
-  0XFF, 0XF5, 0X1F, 0XA6, 0XFD, 0X6D, 0X0C, 0X82, 0X8A, 0X82, 0XA2, 0XFE,
-  0X71, 0XAC, 0X78, 0X1C, 0XFB, 0X43, 0X11, 0XF7, 0X75, 0X77, 0XFF, 0XF1,
-  0XC7, 0XEF, 0X84, 0X7A, 0X89, 0X7F, 0X70, 0X63, 0X96, 0XFF, 0XEE, 0XF7,
-  0X3F, 0X7E, 0XC7, 0X8D, 0XFB, 0X52, 0XE7, 0XCB, 0X0F, 0X23, 0X3F, 0X9F,
-  0XCB, 0X7E, 0X1C, 0XC6, 0X75, 0X8A, 0XD3, 0XFC, 0X1F, 0X9F, 0X9F, 0XE2,
-  0X2C, 0XAB, 0X87, 0XF2, 0X8F, 0X3F, 0X10, 0X68, 0XBA, 0XFE, 0X71, 0XA8,
-  0X8F, 0X97, 0XB2, 0X1E, 0XFE, 0XF8, 0X03, 0XFA, 0XBF, 0X6F, 0XFF, 0XB7,
-  0X7F, 0XF9, 0XFB, 0X69, 0X05, 0XFF, 0XFE, 0X47, 0X85, 0XFC, 0XFE, 0X47,
-  0X97, 0X97, 0XF9, 0X90, 0XFD, 0XD3, 0XC2, 0XFE, 0X47, 0X1E, 0X27, 0XE3,
-  0X92, 0XE5, 0XCB, 0X1F, 0X92, 0X71, 0XDB, 0XC6, 0XFE, 0X8F, 0X3F, 0XE0,
-  0XE9, 0XFA, 0XB1, 0X8E, 0X5D, 0X9D, 0XFD, 0XFA, 0XEC, 0XBF, 0XFA, 0XF7,
-  0XF7, 0XE9, 0XF8, 0XBF, 0XF7, 0XF2, 0XDF, 0XB9, 0XB3, 0XE6, 0XE9, 0X56,
-  0X8F, 0XC3, 0X3F, 0XF9, 0XF1, 0X97, 0X25, 0XFC, 0XFD, 0X61, 0X14, 0XFA,
-  0X8D, 0XA7, 0XB7, 0X38, 0XE9, 0XF2, 0X7F, 0XDE, 0X9C, 0XBF, 0XF8, 0XF9,
-  0X2C, 0XA5, 0X8B, 0XA7, 0X35, 0XFF, 0XE3, 0X8F, 0XBF, 0X9D, 0XFD, 0XA3,
-  0X83, 0XBF, 0XC4, 0XC0, 0XB3, 0X0C, 0X08, 0XFA, 0X5F, 0X7F, 0X0D, 0XBE,
-  0X3F, 0X6C, 0XE3, 0XF4, 0X73, 0XF4, 0XB7, 0X5E, 0XFC, 0X84, 0XCF, 0X96,
-  0XFD, 0XEA, 0X9B, 0XFF, 0XB3, 0XD0, 0XFC, 0XB3, 0XF5, 0X5F, 0XCC, 0XE6,
-  0XD7, 0XF6, 0X87, 0XB8, 0XAB, 0XCB, 0X67, 0XFB, 0XD2, 0X27, 0X6E, 0XF3,
-  0XE5, 0XD7, 0XDF, 0XBE, 0XFC, 0XB1, 0X1A, 0X8F, 0X27, 0X44, 0XFE, 0XE3,
-  0XB0, 0XCC, 0X7F, 0X7E, 0X7E, 0XC3, 0XC8, 0XBF, 0XAE, 0X79, 0XF7, 0XC0,
-  0X9F, 0X67, 0XFF, 0XB1, 0X1D, 0X08, 0XC2, 0X30, 0X04, 0XF9, 0X55, 0X3B,
-  0X45, 0X9D, 0X77, 0XD9, 0X93, 0XB7, 0XFF, 0X6F, 0XC1, 0XC0, 0X7F, 0X3D,
-  0X8E, 0X7F, 0X6D, 0X23, 0X7E, 0X6B, 0XB1, 0XF1, 0XCF, 0XCF, 0X6F, 0X84,
-  0XD9, 0XCF, 0X95, 0XFE, 0X4C, 0XF9, 0X69, 0XDF, 0XFE, 0X8F, 0XED, 0X9E,
-  0X9E, 0X2A, 0X31, 0XEC, 0X7D, 0X92, 0X2F, 0XBF, 0XFB, 0X3F, 0X7F, 0XFF,
-  0X23, 0XD9, 0X9F, 0X38, 0X1B, 0XFE, 0X63, 0X14, 0X10, 0XE4, 0X7F, 0X22,
-  0XC3, 0XFF, 0X67, 0X01, 0X78, 0XD6, 0XFF, 0X2B, 0XCB, 0XFC, 0X87, 0X3A,
-  0X51, 0X0F, 0X55, 0XBE, 0XD4, 0XDB, 0XAF, 0XCC, 0X58, 0XEB, 0XEF, 0X13,
-  0XE9, 0X70, 0XDE, 0XFF, 0X36, 0X84, 0XBF, 0X9D, 0X81, 0X3F, 0XA1, 0XF9,
-  0X63, 0X56, 0XAF, 0X3F, 0X93, 0X29, 0XFB, 0X2B, 0X46, 0X7F, 0XBF, 0XFE,
-  0X27, 0X54, 0XC6, 0XA7, 0X14, 0XD5, 0XDB, 0XE3, 0X0B, 0XF4, 0XAF, 0XF8,
-  0XAF, 0X9A, 0XFB, 0X0B, 0X96, 0XFF, 0XD9, 0XF8, 0XFC, 0X35, 0X44, 0XFE,
-  0X87, 0X25, 0X75, 0X5F, 0XD6, 0X9F, 0X83, 0XD3, 0X58, 0XFF, 0X66, 0X76,
-  0XFC, 0X97, 0X7C, 0X59, 0XC6, 0X65, 0XFD, 0X8D, 0XD2, 0X56, 0X14, 0XD8,
-  0XF3, 0XF9, 0X4F, 0XC4, 0X12, 0XF4, 0X1C, 0XFF, 0XE9, 0XC4, 0XFD, 0XA7,
-  0X82, 0XF5, 0X2B, 0XE1, 0XFA, 0XFF, 0X8C, 0X86, 0X7F, 0XF6, 0XE4, 0XDF,
-  0X2F, 0XA1, 0X1B, 0XE3, 0X9F, 0XAF, 0XFA, 0XA7, 0X35, 0XFC, 0X65, 0XAB,
-  0X7F, 0XB6, 0XA7, 0X27, 0X16, 0XB6, 0XA7, 0X4E, 0XA4, 0XBF, 0XFE, 0XF4,
-  0XB2, 0X0F, 0XC3, 0XCF, 0XE2, 0X3B, 0X2D, 0X63, 0XB9, 0XE4, 0XEB, 0XFA,
-  0X6B, 0X66, 0XCE, 0XBC, 0X2E, 0XAB, 0XED, 0X8F, 0X8F, 0X63, 0X5D, 0XF6,
-  0XAB, 0X56, 0XEA, 0XBE, 0XFC, 0XD7, 0X9F, 0X2D, 0XFA, 0XA9, 0XA5, 0X75,
-  0X1F, 0X97, 0XFF, 0X5C, 0X66, 0X9F, 0XF8, 0X98, 0XBA, 0XF8, 0X09, 0X84,
-  0XA4, 0X1B, 0XD3, 0XF6, 0X9F, 0XD1, 0XB8, 0XFE, 0XF0, 0X9B, 0XF5, 0XB5,
-  0XFA, 0XEB, 0X8B, 0XE3, 0X7D, 0X1B, 0X7F, 0XA3, 0X71, 0XFD, 0X32, 0XF6,
-  0X2B, 0X9D, 0XED, 0X6F, 0X20, 0X0E, 0XE3, 0XF0, 0X0F, 0X35, 0XED, 0X97,
-  0XB6, 0X0D, 0XFE, 0XB5, 0X6F, 0XFF, 0X09, 0XFC, 0X0B, 0XB1, 0XF8, 0XD3,
-  0X2F, 0X8D, 0X7B, 0X1C, 0X7E, 0X42, 0XF9, 0XE7, 0XDF, 0X95, 0XF9, 0XE6,
-  0X6C, 0XF1, 0XB6, 0XAF, 0XFF, 0XDB, 0XFF, 0XFE, 0XB7, 0X3E, 0XFF, 0X2C,
-  0XF0, 0XC7, 0XBA, 0XA4, 0X7F, 0XFE, 0X5D, 0X16, 0X6F, 0XF1, 0X1F, 0X7F,
-  0X59, 0X23, 0X38, 0X0D, 0XE5, 0X7F, 0X4D, 0XE2, 0X35, 0X27, 0XB0, 0XDF,
-  0XD7, 0X3E, 0XFB, 0XB6, 0X4F, 0X48, 0X15, 0XCB, 0X91, 0X79, 0X0E, 0XC3,
-  0XF1, 0X2A, 0XDE, 0X2B, 0X9F, 0X33, 0XFD, 0XE7, 0X3F, 0X2F, 0X99, 0X63,
-  0XF4, 0XE7, 0X97, 0X8B, 0XAB, 0X8E, 0X58, 0X7F, 0X9E, 0X60, 0X1D, 0XAB,
-  0XFB, 0XBC, 0X2F, 0XA5, 0XFC, 0XC9, 0XBC, 0X4A, 0X2C, 0X91, 0X21, 0X5D,
-  0X19, 0X26, 0X5C, 0XF0, 0XE5, 0XD3, 0XA4, 0XC1, 0XD4, 0X02, 0X0B, 0XE8,
-  0X99, 0XC6, 0XEB, 0X3C, 0XC7, 0X98, 0XB4, 0X69, 0X59, 0XE0, 0X81, 0X59,
-  0X20, 0X48, 0X99, 0X82, 0X33, 0X72, 0XCC, 0XE9, 0X31, 0X6C, 0XF9, 0X31,
-  0X81, 0X63, 0X62, 0X6D, 0XDE, 0XFA, 0X79, 0X9F, 0X61, 0X2C, 0XFE, 0XE7,
-  0XD7, 0X04, 0X8A, 0X96, 0X76, 0X86, 0X93, 0XF9, 0XE5, 0X38, 0XF5, 0X9F,
-  0X63, 0XBF, 0X3C, 0X47, 0X15, 0XFC, 0X2F, 0XF3, 0X38, 0XAB, 0X65, 0XB8,
-  0X73, 0XFD, 0X39, 0XD7, 0X11, 0X9B, 0XF1, 0XA7, 0X5D, 0X4E, 0XA9, 0X3F,
-  0X32, 0X57, 0X7D, 0XFE, 0X32, 0XFE, 0X73, 0XEC, 0XFC, 0XC5, 0XD7, 0X69,
-  0X9E, 0X67, 0XBB, 0XC5, 0XFF, 0X6E, 0XE3, 0XE7, 0X77, 0XD0, 0X05, 0X3E,
-  0X94, 0X5C, 0X9E, 0X79, 0X31, 0XE7, 0X5F, 0XEE, 0X99, 0XBF, 0XFC, 0XB2,
-  0XAC, 0XE5, 0XED, 0XEF, 0X40, 0XFE, 0X79, 0XCE, 0XA9, 0XF5, 0X9A, 0XAB,
-  0X5D, 0X0B, 0X59, 0X22, 0XF6, 0XEF, 0X9F, 0XFD, 0XF9, 0X2E, 0X03, 0XDE,
-  0X3E, 0X6F, 0X2C, 0XE7, 0X79, 0X0B, 0XD2, 0XDF, 0X38, 0X90, 0X9A, 0X14,
-  0XA8, 0XAB, 0XD3, 0XFC, 0X31, 0XC9, 0XF7, 0XC9, 0X1A, 0XDF, 0XF4, 0XC1,
-  0X00, 0X93, 0XA2, 0XFE, 0X23, 0X57, 0XE3, 0X47, 0X4A, 0X25, 0XC6, 0X1D,
-  0X22, 0XE8, 0XA5, 0X71, 0XA7, 0XB1, 0X27, 0XAD, 0X36, 0X12, 0X26, 0X18,
-  0X1E, 0XD4, 0X4F, 0X3C, 0X41, 0X10, 0XA4, 0XE5, 0XB0, 0XFB, 0XC5, 0X7E,
-  0XA9, 0XD5, 0X98, 0XF3, 0X5C, 0X4B, 0X21, 0XFC, 0X13, 0X07, 0X41, 0X0A,
-  0X7D, 0XE8, 0XF5, 0XF8, 0XF3, 0X51, 0X38, 0XAB, 0X37, 0X9A, 0X4F, 0XA5,
-  0XBF, 0X58, 0X3B, 0X0E, 0XDA, 0X07, 0XCA, 0XB6, 0X35, 0X5E, 0X56, 0XAC,
-  0XD4, 0X91, 0X6B, 0X79, 0X7C, 0XA1, 0X39, 0X50, 0XA2, 0X72, 0XA5, 0XF0,
-  0XD8, 0XC8, 0XD4, 0X7A, 0X1C, 0XDF, 0XAF, 0X52, 0X79, 0XD6, 0XA5, 0XF1,
-  0X2C, 0XD3, 0XE8, 0X8D, 0XA2, 0X7D, 0X7A, 0X45, 0XFD, 0X88, 0XEC, 0XFB,
-  0XF1, 0X87, 0X74, 0X5B, 0X5C, 0X08, 0XE0, 0X95, 0X7D, 0XE6, 0XCE, 0XEF,
-  0XEF, 0XE5, 0X26, 0XE2, 0X69, 0XF0, 0X97, 0X61, 0X44, 0XA2, 0XB5, 0X9B,
-  0X5F, 0X2A, 0X90, 0X1D, 0XDE, 0X7F, 0XC6, 0X5C, 0X89, 0XBD, 0X94, 0XA0,
-  0X1B, 0X11, 0XC7, 0X6B, 0X73, 0XF5, 0X5E, 0X6F, 0X9B, 0XB7, 0X39, 0X1F,
-  0X4E, 0X7D, 0XA9, 0XC2, 0X4C, 0XE1, 0XCA, 0XFC, 0XF7, 0X77, 0X05, 0X3D,
-  0XD8, 0X30, 0X3C, 0X9F, 0XB5, 0X6D, 0X28, 0X55, 0X1F, 0XBF, 0XC3, 0X34,
-  0X14, 0X0C, 0X97, 0XBF, 0XC4, 0X0F, 0XA2, 0XBB, 0X22, 0X5B, 0X69, 0XBE,
-  0X1F, 0X08, 0XF5, 0X67, 0X08, 0X51, 0X63, 0XBD, 0X1F, 0X7F, 0X71, 0XD3,
-  0X85, 0XED, 0XA8, 0X4F, 0X48, 0XB0, 0X40, 0X07, 0X02, 0X58, 0XC4, 0X5B,
-  0X6F, 0X78, 0X64, 0X5B, 0X60, 0X1A, 0X2C, 0X0E, 0XAA, 0X10, 0XE2, 0X6C,
-  0XF8, 0X0C, 0X5B, 0XE2, 0X69, 0XCF, 0XD7, 0X21, 0X01, 0X8A, 0XE5, 0X2B,
-  0X59, 0X7E, 0XEE, 0X79, 0XD8, 0X9B, 0X99, 0X9E, 0X75, 0XD9, 0XC4, 0XBB,
-  0X94, 0XCB, 0X0F, 0XAF, 0X9F, 0XAB, 0X7C, 0XF7, 0X4A, 0X39, 0X18, 0XA8,
-  0X6C, 0XDC, 0XD4, 0X1A, 0X23, 0X59, 0XAB, 0X74, 0X53, 0X94, 0X17, 0XD2,
-  0XB5, 0X24, 0X01, 0XEC, 0XFB, 0X82, 0X75, 0X5B, 0XA3, 0X4C, 0XE7, 0X61,
-  0XFB, 0X7A, 0X70, 0XC3, 0X9F, 0X3D, 0X78, 0XD3, 0X85, 0XB5, 0X8F, 0XB3,
-  0X94, 0X63, 0X80, 0X4E, 0XB9, 0XF2, 0XCA, 0X3D, 0X98, 0XB6, 0X4F, 0X78,
-  0XC0, 0XCD, 0X88, 0X95, 0X77, 0XDA, 0X82, 0X29, 0XAA, 0X1B, 0X70, 0XE6,
-  0X7F, 0X9E, 0X35, 0XAB, 0X63, 0X2C, 0X64, 0X1F, 0XC4, 0X88, 0XF4, 0X17,
-  0X57, 0X8C, 0XB1, 0XF4, 0X86, 0X0C, 0XA6, 0X51, 0X1C, 0X2F, 0X85, 0X36,
-  0XF1, 0XB8, 0X52, 0X5B, 0X09, 0XA6, 0XD4, 0X03, 0XCC, 0XB2, 0XD1, 0XC5,
-  0X0F, 0XF7, 0X60, 0X2F, 0X3E, 0XCF, 0X68, 0X00, 0XB8, 0X26, 0XE2, 0XB5,
-  0XAA, 0X8D, 0XFC, 0XD5, 0XF0, 0X3C, 0XF4, 0X1F, 0XFF, 0XD5, 0X79, 0X1E,
-  0XA5, 0XE7, 0XE6, 0X2B, 0X0E, 0X3A, 0X2B, 0X14, 0XCE, 0X75, 0X51, 0X8F,
-  0X8C, 0X06, 0X3F, 0XFC, 0X83, 0X83, 0XF9, 0X51, 0X19, 0XC9, 0X85, 0X00,
-  0X0C, 0XCA, 0XD8, 0X36, 0X42, 0X3E, 0X3A, 0X9A, 0X41, 0X0F, 0X6E, 0X86,
-  0X1B, 0XCD, 0XFD, 0XB6, 0X25, 0X01, 0XBE, 0X2F, 0X23, 0XF0, 0XAC, 0X85,
-  0X2A, 0X50, 0XFC, 0XCA, 0X42, 0X8F, 0X2C, 0X65, 0X86, 0X13, 0XAF, 0X2D,
-  0X73, 0XF8, 0XDA, 0XEF, 0XA3, 0X96, 0X7F, 0XF6, 0X63, 0XAA, 0X3E, 0XE1,
-  0X02, 0X1E, 0XC4, 0X67, 0X9E, 0X4B, 0XDE, 0XF1, 0XBA, 0X77, 0X8A, 0XCA,
-  0X26, 0XC3, 0XB0, 0XDA, 0XF3, 0XBE, 0X28, 0XD1, 0XAC, 0XFB, 0XC1, 0XA6,
-  0XE0, 0XCA, 0XA9, 0X78, 0XF6, 0X14, 0X98, 0X54, 0X5B, 0XD5, 0X1B, 0XB9,
-  0XC0, 0X76, 0X85, 0X35, 0X5C, 0X5F, 0X69, 0X30, 0X9A, 0XEF, 0X95, 0X4A,
-  0X7A, 0XD6, 0X45, 0X3D, 0X31, 0X39, 0X3F, 0X18, 0X87, 0X0F, 0X56, 0XD7,
-  0X13, 0XD3, 0XF8, 0X83, 0X11, 0XC3, 0XF2, 0XC6, 0X93, 0XD3, 0X37, 0X87,
-  0XF5, 0X11, 0XFE, 0X33, 0X05, 0XE9, 0XC1, 0X76, 0XDC, 0X4E, 0X67, 0XAC,
-  0X02, 0XE2, 0XC1, 0X6A, 0X44, 0X9F, 0XBC, 0X56, 0X14, 0XC8, 0XA4, 0X01,
-  0XD1, 0XB6, 0XC1, 0XC3, 0XFC, 0X50, 0X02, 0X49, 0X6F, 0X93, 0X34, 0X41,
-  0X17, 0X8B, 0X7A, 0X21, 0X69, 0X80, 0XCB, 0XEA, 0X83, 0X91, 0X77, 0X4E,
-  0XD4, 0X53, 0X06, 0X8E, 0XF9, 0X7B, 0X3D, 0XC1, 0XA5, 0X7C, 0XAE, 0X75,
-  0X7A, 0X27, 0X54, 0X69, 0X1D, 0X00, 0X18, 0X7F, 0X35, 0X14, 0XA7, 0XD9,
-  0X3C, 0X00, 0X82, 0X6F, 0X24, 0X9E, 0X8B, 0X2B, 0XDE, 0XDD, 0X07, 0X94,
-  0XCF, 0X09, 0X41, 0XC0, 0XFF, 0X3F, 0X1F, 0XC7, 0XFF, 0X07, 0X36, 0X4E,
-  0X76, 0X46, 0X59, 0XF8, 0XD9, 0X2B, 0XE6, 0XBA, 0XBC, 0X8E, 0XB7, 0X7C,
-  0X1B, 0X43, 0XF6, 0X3B, 0X42, 0X20, 0X2A, 0X89, 0XAE, 0X45, 0XE4, 0XB1,
-  0X42, 0X74, 0XB7, 0XBC, 0X45, 0X48, 0XCE, 0X42, 0X1D, 0X0C, 0X1F, 0X2D,
-  0X67, 0X0A, 0X26, 0XD5, 0X2F, 0X2B, 0X2D, 0X26, 0X9F, 0XD0, 0XA0, 0X8F,
-  0XC5, 0X6F, 0X74, 0X18, 0XBB, 0X1A, 0XF3, 0X09, 0XB7, 0X0F, 0XD0, 0X3C,
-  0X81, 0XC4, 0X24, 0X09, 0XFB, 0X6A, 0X62, 0X49, 0XA4, 0XA9, 0XE8, 0X43,
-  0X14, 0X65, 0X2F, 0XBC, 0XAA, 0XB6, 0XB5, 0X19, 0X87, 0X9A, 0XEE, 0XF2,
-  0XC3, 0X5A, 0XB6, 0X35, 0X56, 0X5C, 0X5B, 0X33, 0X82, 0XDA, 0X96, 0XDA,
-  0X24, 0XF7, 0X71, 0X62, 0X6C, 0X10, 0X08, 0X85, 0X74, 0XB5, 0XBF, 0XDD,
-  0X59, 0X4A, 0XDE, 0X5F, 0X67, 0X05, 0X05, 0XE2, 0X23, 0XA6, 0X92, 0X40,
-  0X83, 0XE6, 0XF7, 0X90, 0X8B, 0X03, 0XCF, 0XB8, 0XCA, 0XAA, 0X9C, 0X9A,
-  0X97, 0XBD, 0XD1, 0XE6, 0X78, 0XD5, 0XFB, 0X54, 0X9C, 0XA0, 0XCA, 0X56,
-  0X55, 0X54, 0X60, 0X63, 0XBE, 0X07, 0XB5, 0XDD, 0X4A, 0XD3, 0X5B, 0X54,
-  0X77, 0X82, 0XC0, 0X95, 0X6D, 0XBA, 0XC8, 0X7A, 0XBD, 0XE2, 0XAF, 0XFE,
-  0XFD, 0X5E, 0X51, 0X0F, 0X41, 0XDB, 0XA2, 0X3A, 0X25, 0X59, 0X70, 0XCC,
-  0XF5, 0X9D, 0X42, 0X16, 0XB4, 0X0A, 0XB4, 0X93, 0X1A, 0XAF, 0X36, 0X1F,
-  0XE6, 0X23, 0X2E, 0X2D, 0XB9, 0X17, 0X79, 0XBE, 0X54, 0X27, 0X6E, 0XBD,
-  0XD4, 0XD4, 0X1D, 0XFC, 0X05, 0XB4, 0X96, 0X26, 0X8D, 0X95, 0X1E, 0XA3,
-  0X88, 0X00, 0XDE, 0X12, 0X04, 0X90, 0XAF, 0XAB, 0XDD, 0XF3, 0XB7, 0XC4,
-  0XD5, 0X83, 0XEC, 0X08, 0XD2, 0X42, 0X39, 0X19, 0X84, 0X51, 0X70, 0XDE,
-  0X8A, 0X89, 0XF0, 0XD1, 0X67, 0XD8, 0XBF, 0XE0, 0XD1, 0X35, 0X58, 0X22,
-  0X7D, 0XF3, 0X6B, 0X60, 0X3B, 0X44, 0X16, 0X4A, 0XF5, 0XEC, 0XDF, 0X73,
-  0XF3, 0X8D, 0X86, 0X9A, 0X29, 0X10, 0XF1, 0XE1, 0X85, 0X32, 0X75, 0XF5,
-  0XFC, 0XE7, 0XA2, 0X1C, 0X2E, 0X7A, 0X07, 0X5D, 0X79, 0X1A, 0XF7, 0X21,
-  0XD5, 0XDB, 0X85, 0X51, 0X4D, 0XB3, 0XED, 0X4B, 0XA3, 0X9B, 0X52, 0X5B,
-  0XDB, 0XDA, 0X3B, 0X50, 0X75, 0X4B, 0X96, 0XBB, 0X84, 0X83, 0X3A, 0XDC,
-  0X2A, 0X24, 0X7F, 0X31, 0X54, 0X25, 0XC6, 0XA0, 0XA2, 0X41, 0X88, 0XB9,
-  0X1F, 0X99, 0X8F, 0X0E, 0XF7, 0XFC, 0XCA, 0X0E, 0X35, 0XD1, 0X79, 0X9C,
-  0X1C, 0X0E, 0XCC, 0X59, 0XF0, 0X61, 0X9B, 0XCE, 0X1F, 0XEF, 0X56, 0X30,
-  0XB2, 0XFE, 0X5E, 0X24, 0X16, 0X33, 0X2E, 0X7B, 0X49, 0XCB, 0X91, 0XDD,
-  0X7D, 0XCB, 0X58, 0X65, 0XBF, 0XC8, 0XF2, 0X38, 0XF0, 0X1F, 0X4B, 0X63,
-  0X31, 0XA9, 0XC9, 0XB8, 0XF9, 0X9B, 0XCC, 0XBB, 0X52, 0X10, 0XF0, 0X3C,
-  0X2A, 0XB8, 0XA6, 0X0B, 0X71, 0XF2, 0X4D, 0XC7, 0XD6, 0XEA, 0X13, 0X8B,
-  0X7A, 0X26, 0XAA, 0XF5, 0XB7, 0X92, 0XF5, 0X85, 0X7F, 0XC1, 0X8A, 0XA2,
-  0X71, 0X32, 0X3D, 0XE8, 0X89, 0X14, 0X82, 0XA8, 0X5C, 0X8E, 0X81, 0X99,
-  0XA6, 0X95, 0X29, 0XAA, 0X49, 0XFD, 0X69, 0X4F, 0X06, 0XE1, 0X6B, 0X0E,
-  0XF3, 0XAD, 0XD9, 0X77, 0XE4, 0XB6, 0X68, 0XE1, 0XB7, 0XB5, 0XA9, 0XA6,
-  0X88, 0XC3, 0X45, 0X71, 0X24, 0XC7, 0XAB, 0X2F, 0XE5, 0XCB, 0XB2, 0XBE,
-  0X9F, 0X7C, 0X1D, 0X07, 0X2E, 0X0D, 0X08, 0X8B, 0X29, 0X3A, 0X92, 0XFD,
-  0X8A, 0X72, 0X91, 0X2A, 0X85, 0X4C, 0XBD, 0XAD, 0X90, 0X2E, 0X26, 0X2B,
-  0X33, 0X31, 0X18, 0X64, 0XC1, 0XE0, 0X2D, 0XEA, 0X94, 0XE2, 0XAE, 0X32,
-  0X45, 0X85, 0X75, 0XFA, 0X09, 0XCE, 0X54, 0X42, 0XD6, 0X9B, 0XA1, 0XBD,
-  0X67, 0XE3, 0X4C, 0XE1, 0X3E, 0X5D, 0XC9, 0XF6, 0X61, 0XF4, 0X93, 0X7D,
-  0X8A, 0XEC, 0X83, 0XE9, 0X85, 0X5E, 0X10, 0X92, 0X79, 0X11, 0X04, 0XF9,
-  0X8A, 0X44, 0X0F, 0X94, 0XF9, 0XC2, 0X26, 0XA4, 0XA7, 0X73, 0XCC, 0XE3,
-  0X72, 0X59, 0XA9, 0X79, 0X4E, 0XE8, 0X9D, 0XAE, 0XB7, 0X4F, 0XC9, 0X6F,
-  0X79, 0X0E, 0X19, 0XE2, 0X55, 0XBF, 0X4D, 0X18, 0XD0, 0X52, 0X4F, 0X41,
-  0X6D, 0XA6, 0X73, 0XC3, 0X77, 0XC0, 0X1B, 0X86, 0XD6, 0XCC, 0X25, 0X7C,
-  0XAD, 0X63, 0X61, 0XB3, 0XCD, 0X2A, 0XCC, 0XF9, 0X41, 0X43, 0X24, 0XA2,
-  0X77, 0X5F, 0X2A, 0X4F, 0X27, 0XFE, 0XBD, 0X63, 0XE9, 0X6E, 0X51, 0X93,
-  0X36, 0X5D, 0X38, 0XBE, 0X17, 0XA8, 0X45, 0X78, 0X1C, 0X7B, 0XF5, 0X11,
-  0XC9, 0XCA, 0X2D, 0XFE, 0XB4, 0XEF, 0X98, 0X46, 0X37, 0X98, 0X51, 0X37,
-  0XCF, 0X5F, 0X38, 0X69, 0XA9, 0XE7, 0X35, 0X66, 0X0D, 0XAA, 0X1B, 0XDE,
-  0X0D, 0X09, 0XC1, 0X29, 0X5A, 0X7D, 0X1E, 0X0B, 0XF4, 0X94, 0XAB, 0X72,
-  0X6C, 0X40, 0XC7, 0X41, 0X46, 0X89, 0X6D, 0XA8, 0X5D, 0X04, 0X29, 0XAC,
-  0X03, 0X01, 0X06, 0XB9, 0X5D, 0X92, 0X25, 0XD6, 0X47, 0X2B, 0X1C, 0X90,
-  0XF5, 0XC1, 0XD0, 0XEE, 0X93, 0X14, 0X0B, 0X81, 0XF1, 0XEF, 0X24, 0X29,
-  0XDA, 0X89, 0XBB, 0XDD, 0XF6, 0X4A, 0XBB, 0X1B, 0X7F, 0X89, 0X3D, 0XB8,
-  0X22, 0X47, 0X3A, 0X41, 0X32, 0X9E, 0XEC, 0XFE, 0X2B, 0X5C, 0X16, 0XD6,
-  0XE5, 0X59, 0X60, 0X67, 0XDE, 0XD0, 0X43, 0X6E, 0XAF, 0X0D, 0X38, 0XB0,
-  0X2B, 0XC8, 0X09, 0X81, 0X5C, 0XF6, 0XB0, 0XA9, 0X2E, 0X5B, 0XB6, 0XCA,
-  0XC8, 0X7D, 0XAD, 0X06, 0X8D, 0XC7, 0X60, 0XE6, 0XB0, 0X6F, 0XB6, 0X32,
-  0X3D, 0X16, 0X1C, 0X4B, 0X01, 0XAD, 0X56, 0XA4, 0X84, 0XD5, 0X39, 0XCA,
-  0X68, 0XF2, 0X6B, 0XBE, 0X09, 0X8E, 0X8C, 0XFD, 0X9B, 0X2D, 0XB0, 0XF9,
-  0X2A, 0X3D, 0XB6, 0XA0, 0XC5, 0X23, 0X69, 0X20, 0X64, 0XC4, 0X5D, 0X31,
-  0X3D, 0X5A, 0X7C, 0X61, 0X7B, 0X19, 0XAD, 0XDD, 0XBE, 0X84, 0XBF, 0X0B,
-  0X96, 0X6D, 0XE8, 0XF6, 0X7D, 0X53, 0X4F, 0X18, 0XAD, 0X5F, 0X59, 0XC3,
-  0X11, 0XAF, 0X24, 0X46, 0XAA, 0X59, 0X8E, 0X66, 0X30, 0X47, 0X62, 0X15,
-  0XA4, 0X4D, 0XB3, 0XCC, 0X91, 0XD7, 0X00, 0XE7, 0X52, 0X23, 0XF1, 0XF3,
-  0X72, 0X00, 0X59, 0XA1, 0X72, 0XB0, 0XE9, 0X3F, 0X30, 0X82, 0XDD, 0XDF,
-  0XF2, 0XF5, 0XA9, 0XB7, 0X0C, 0X87, 0XC6, 0XD2, 0X08, 0X02, 0X6A, 0XCC,
-  0X77, 0X48, 0XB6, 0X08, 0XA9, 0X0C, 0X70, 0X96, 0XF0, 0XA1, 0X0E, 0X24,
-  0XBC, 0X5C, 0X20, 0X0E, 0XCB, 0XC6, 0XDE, 0X31, 0XD5, 0X68, 0X01, 0XA5,
-  0X37, 0X19, 0X55, 0X24, 0XA3, 0X64, 0X7F, 0XF6, 0XFA, 0XDE, 0X0C, 0XB7,
-  0X14, 0XDB, 0X2E, 0X25, 0X86, 0X7D, 0XF8, 0XF8, 0X57, 0X93, 0X46, 0XB1,
-  0X10, 0XA9, 0XA5, 0X7A, 0XCD, 0X1B, 0XF9, 0X9E, 0X23, 0X8B, 0X75, 0X56,
-  0X28, 0X59, 0XB0, 0X3D, 0XDF, 0XD1, 0XAB, 0XA1, 0X8B, 0X55, 0XC5, 0XD8,
-  0XB7, 0X36, 0X53, 0X42, 0XA6, 0X32, 0X22, 0X86, 0XED, 0X94, 0X0A, 0XF7,
-  0XCC, 0X32, 0X8D, 0X4E, 0X5E, 0XF6, 0X1C, 0XBB, 0X68, 0X3B, 0X59, 0XB7,
-  0XFC, 0XA4, 0X4E, 0X9E, 0X75, 0XF1, 0XEC, 0XBC, 0XD5, 0X01, 0X48, 0X83,
-  0X7A, 0X82, 0X8D, 0X40, 0X49, 0X97, 0XAC, 0X51, 0X33, 0X4D, 0XAB, 0XEB,
-  0X6C, 0XB3, 0X41, 0X61, 0X18, 0XCC, 0X55, 0X2D, 0XF9, 0XA5, 0XD0, 0XBF,
-  0XAC, 0XDE, 0X19, 0X24, 0X07, 0X95, 0X37, 0XAD, 0X53, 0X7B, 0X06, 0X8E,
-  0X5A, 0XE5, 0X35, 0X17, 0XDD, 0XE9, 0XD3, 0X05, 0XBA, 0X61, 0XDF, 0X97,
-  0X25, 0X9C, 0X4E, 0X47, 0X9A, 0XC4, 0XC3, 0X9D, 0XE4, 0X40, 0X8A, 0X57,
-  0XB7, 0X05, 0X88, 0XF2, 0X14, 0XAD, 0X68, 0X3E, 0X50, 0XA6, 0XEE, 0X33,
-  0X85, 0X7F, 0X55, 0X4F, 0XC7, 0X8E, 0XEF, 0XCA, 0X3F, 0X00, 0X52, 0XBB,
-  0XE2, 0XC4, 0X0A, 0X31, 0X65, 0X1E, 0XF3, 0XB2, 0X81, 0XDC, 0X77, 0XE7,
-  0XA9, 0XD5, 0XDE, 0X70, 0X99, 0X83, 0XE6, 0X86, 0XB7, 0XCA, 0X36, 0X18,
-  0X93, 0XCE, 0XE9, 0XF9, 0X0E, 0XD8, 0X9D, 0XCA, 0X94, 0X26, 0X4B, 0X3E,
-  0XBD, 0XDD, 0XF2, 0XCC, 0X3B, 0X73, 0X20, 0X4F, 0XC3, 0X0E, 0XBD, 0X27,
-  0XB7, 0XF4, 0X11, 0XE3, 0X67, 0XDC, 0XA7, 0X3C, 0X61, 0XB3, 0XB1, 0X42,
-  0X81, 0X19, 0XC9, 0X21, 0XA2, 0X8B, 0XD2, 0XAE, 0X17, 0XAE, 0X57, 0XEA,
-  0X7C, 0XC6, 0XFE, 0X1E, 0XC7, 0X11, 0X3D, 0X26, 0X83, 0X0D, 0X57, 0X80,
-  0XFE, 0X10, 0X14, 0X67, 0X62, 0XD5, 0X5C, 0XD4, 0X40, 0X6B, 0X8E, 0X4A,
-  0X4B, 0XC8, 0X5E, 0X4E, 0XDC, 0X40, 0X56, 0X84, 0XCA, 0XF0, 0X15, 0XEE,
-  0XAC, 0X23, 0XAF, 0X7D, 0XE4, 0X3D, 0XA4, 0XAD, 0X9B, 0X34, 0X0F, 0X12,
-  0X01, 0X2F, 0X2B, 0XBA, 0X83, 0XA1, 0XBB, 0X71, 0X9D, 0X6D, 0X16, 0XAD,
-  0XC8, 0X9E, 0X86, 0X83, 0X88, 0X60, 0XA7, 0X1A, 0X1F, 0X05, 0X22, 0X0B,
-  0XAA, 0XB8, 0X57, 0XCC, 0XF6, 0XBD, 0X74, 0X33, 0X51, 0X83, 0X33, 0XD2,
-  0X6B, 0X72, 0XCF, 0XC8, 0X7A, 0X8C, 0X34, 0X50, 0XE2, 0X8C, 0XFD, 0XB1,
-  0XC2, 0X37, 0X7F, 0XC3, 0XF9, 0XAE, 0XC5, 0XAF, 0X69, 0X09, 0X64, 0XE4,
-  0XCD, 0X9A, 0XAF, 0X1D, 0X9C, 0X48, 0X9D, 0X4F, 0X4E, 0XA4, 0X0A, 0X37,
-  0XA5, 0X84, 0XEA, 0X6D, 0XAC, 0X8F, 0XA8, 0XDC, 0XE7, 0XBE, 0X9D, 0X15,
-  0X8D, 0X56, 0X24, 0X07, 0X84, 0XBA, 0X61, 0X99, 0XE5, 0X46, 0X19, 0X05,
-  0X9E, 0X59, 0X0D, 0XF3, 0X3B, 0XA5, 0X6E, 0X2E, 0X1B, 0X9A, 0X03, 0X04,
-  0X6D, 0XD0, 0X7B, 0X7B, 0XE3, 0XDF, 0XF5, 0X78, 0XCB, 0XC7, 0X49, 0X40,
-  0XBE, 0XAD, 0X86, 0X4A, 0X75, 0X85, 0X55, 0X88, 0X7F, 0X35, 0X21, 0X31,
-  0X66, 0XE6, 0X3E, 0X11, 0X3E, 0X12, 0XAB, 0X88, 0X3D, 0XD8, 0XA5, 0XDD,
-  0XAD, 0X96, 0XD5, 0X1C, 0X8C, 0X65, 0X99, 0X03, 0XFA, 0X56, 0X68, 0XFC,
-  0X18, 0XE8, 0XF5, 0XE5, 0XB0, 0X0E, 0X2B, 0X91, 0XD2, 0XF4, 0XCB, 0XAD,
-  0X73, 0X6B, 0X27, 0X46, 0X45, 0XCE, 0X01, 0X0F, 0XBC, 0X3C, 0X2B, 0XCE,
-  0X7C, 0XCA, 0X6F, 0X23, 0X66, 0XF0, 0XE7, 0X03, 0X12, 0XE7, 0X95, 0X4C,
-  0X96, 0X07, 0X4C, 0X79, 0X3E, 0X48, 0X54, 0XA5, 0XF7, 0X15, 0XB9, 0XF6,
-  0XC3, 0X7D, 0XEA, 0XE2, 0X3B, 0X12, 0XC0, 0X1D, 0XB6, 0X6E, 0XB4, 0X9C,
-  0XEB, 0XE8, 0XCB, 0XCF, 0X2C, 0X2C, 0X34, 0X50, 0X99, 0XCC, 0XD6, 0XF4,
-  0X7D, 0X5F, 0XA9, 0X30, 0XF1, 0X2B, 0X41, 0X41, 0X3A, 0X1D, 0X06, 0XF1,
-  0X3B, 0X1D, 0X8F, 0XB4, 0X35, 0XBC, 0X97, 0X3E, 0X01, 0X36, 0X95, 0X9E,
-  0XAB, 0XE3, 0XF7, 0X77, 0XC2, 0X3C, 0XD4, 0X31, 0X4F, 0X57, 0X7B, 0XC9,
-  0XFD, 0XB7, 0X92, 0X9B, 0X24, 0X99, 0XE2, 0X25, 0XE4, 0X8E, 0XD6, 0XA5,
-  0X3C, 0X6B, 0XAE, 0X30, 0XFC, 0X61, 0X23, 0X00, 0XC8, 0X67, 0XEA, 0X22,
-  0X10, 0X41, 0X69, 0XE4, 0X9D, 0XDD, 0XCE, 0XF5, 0X87, 0X93, 0XAB, 0X81,
-  0X45, 0X25, 0XCA, 0X5C, 0X27, 0XB8, 0X21, 0XE6, 0XF7, 0X54, 0XF6, 0XD6,
-  0XBE, 0XF3, 0X68, 0X79, 0X73, 0X6A, 0X9B, 0XB4, 0XAB, 0X38, 0XA3, 0XE2,
-  0X87, 0X34, 0XE2, 0X6F, 0XAE, 0X44, 0XA9, 0X82, 0XA4, 0XF5, 0X87, 0X40,
-  0XF4, 0X92, 0X54, 0XB7, 0X98, 0X14, 0X2E, 0X6B, 0X84, 0X38, 0X30, 0X7D,
-  0X27, 0X4F, 0XD9, 0X8A, 0XB1, 0X8D, 0X4B, 0X9A, 0XA7, 0X79, 0X25, 0X88,
-  0X49, 0X8E, 0XE4, 0X92, 0XE2, 0X4D, 0X52, 0X85, 0X73, 0X2D, 0XE4, 0XEF,
-  0XE4, 0XF2, 0X0D, 0XF0, 0XBE, 0X48, 0X02, 0XB9, 0XC6, 0XA8, 0X23, 0XB1,
-  0X68, 0XF7, 0XA2, 0X20, 0XFC, 0X2C, 0XEF, 0X81, 0X5F, 0X50, 0XC5, 0X37,
-  0XB9, 0X0C, 0XA7, 0XE2, 0XFD, 0XA6, 0XD2, 0X7C, 0X60, 0XF5, 0X5C, 0X7E,
-  0XFB, 0X4F, 0X72, 0X07, 0X60, 0XF4, 0XD9, 0XD4, 0X36, 0XCC, 0X99, 0X09,
-  0X88, 0XEB, 0X9E, 0X7D, 0X40, 0X75, 0XF2, 0X75, 0X78, 0XB6, 0X63, 0XDE,
-  0XCF, 0X6F, 0X30, 0XDE, 0XDC, 0X9B, 0X34, 0XB5, 0X76, 0X45, 0X26, 0XBD,
-  0X1C, 0X61, 0XCC, 0X29, 0X40, 0XBB, 0X67, 0X71, 0X98, 0X38, 0X28, 0XED,
-  0X5B, 0XBA, 0XB8, 0XB6, 0XC0, 0X93, 0X4A, 0X85, 0X2A, 0XCE, 0X29, 0X9A,
-  0X85, 0X04, 0XEC, 0XAE, 0XBC, 0X3D, 0XDB, 0XDD, 0X6A, 0XCC, 0XB0, 0X7B,
-  0X70, 0X31, 0X95, 0X33, 0XFE, 0X3A, 0XF1, 0X9D, 0X48, 0XF1, 0XFD, 0XD9,
-  0X0C, 0XE3, 0X03, 0X62, 0X4F, 0XA2, 0XBD, 0XB9, 0X0B, 0X2B, 0X87, 0X73,
-  0XCD, 0X57, 0X90, 0X12, 0XFA, 0X66, 0XAD, 0XD5, 0X7A, 0XD0, 0XC6, 0X2F,
-  0X3E, 0X6E, 0X42, 0X8D, 0XB7, 0X03, 0XB2, 0XDA, 0X37, 0X4E, 0XEE, 0X29,
-  0X47, 0XDF, 0X5D, 0X83, 0XB4, 0X36, 0X11, 0XDB, 0XEE, 0X09, 0XF8, 0XC9,
-  0X56, 0XE4, 0X93, 0X44, 0X21, 0X26, 0X15, 0XBA, 0XE0, 0X22, 0X52, 0X1C,
-  0X9E, 0X58, 0X42, 0X0A, 0XC5, 0XF7, 0X2A, 0X54, 0XBA, 0X37, 0XAE, 0X3D,
-  0X6E, 0X2F, 0X2F, 0X18, 0X10, 0X10, 0X40, 0X7F, 0X4B, 0X24, 0XB7, 0X6A,
-  0XAF, 0X2D, 0X5A, 0X4F, 0X98, 0X73, 0XCD, 0XBE, 0X20, 0X25, 0X66, 0X05,
-  0XB4, 0X1D, 0X1D, 0XA8, 0XFE, 0X09, 0XA1, 0X53, 0X50, 0X31, 0X9F, 0X19,
-  0XDC, 0X82, 0XBB, 0XFC, 0XAB, 0X56, 0XFD, 0X35, 0X14, 0X3A, 0X3A, 0X5D,
-  0X90, 0XE0, 0XE1, 0XD8, 0X9C, 0XED, 0X23, 0XD6, 0X30, 0X63, 0X25, 0XF5,
-  0X4A, 0X16, 0X65, 0XC9, 0X0B, 0X0F, 0XD6, 0X16, 0XD7, 0XA8, 0X24, 0X7B,
-  0XD0, 0X15, 0XF5, 0X5B, 0XB2, 0XDD, 0X18, 0XAD, 0XF5, 0XFA, 0XA9, 0XE4,
-  0X69, 0X86, 0X96, 0XF8, 0X7E, 0X6F, 0X9B, 0X4D, 0XF8, 0X57, 0X0B, 0XB7,
-  0X8A, 0X1D, 0X46, 0XE3, 0X04, 0X5F, 0XAD, 0XD7, 0X54, 0XE0, 0X40, 0X7E,
-  0XBE, 0X55, 0X9D, 0XA2, 0X0F, 0X31, 0XD0, 0X67, 0X5B, 0XFE, 0XBA, 0XAE,
-  0X3D, 0XC6, 0XF8, 0XD7, 0XB6, 0XEB, 0XC5, 0X91, 0XA2, 0X04, 0XC6, 0X13,
-  0X60, 0X24, 0XB6, 0XAE, 0XDF, 0X97, 0X19, 0XC9, 0X2F, 0XC8, 0X8E, 0XB1,
-  0XB9, 0X80, 0XBF, 0X3A, 0X29, 0X33, 0X14, 0XFD, 0XFA, 0X59, 0XC1, 0XFA,
-  0XCE, 0XA2, 0X35, 0X67, 0XD0, 0XEC, 0X3C, 0XC9, 0X18, 0X28, 0X28, 0X86,
-  0X7E, 0X23, 0X51, 0X98, 0XDC, 0X40, 0X94, 0XC8, 0XAD, 0XE2, 0X30, 0X8B,
-  0X80, 0X00, 0XFA, 0XCB, 0X40, 0X20, 0X64, 0X87, 0X67, 0X96, 0X9F, 0XED,
-  0X47, 0XD3, 0X84, 0XAE, 0X43, 0XBD, 0X5F, 0XE7, 0X91, 0X83, 0XFA, 0XF2,
-  0X36, 0XAE, 0X14, 0X93, 0X07, 0XC7, 0X82, 0X77, 0X4D, 0XBB, 0X82, 0X8E,
-  0XDF, 0X54, 0X6A, 0XBE, 0XA2, 0X21, 0X64, 0XB0, 0X5D, 0X76, 0X88, 0X25,
-  0XDB, 0X77, 0X00, 0XA0, 0X0F, 0X98, 0X2A, 0XED, 0X2F, 0X49, 0X84, 0X21,
-  0X79, 0X29, 0X4E, 0X9E, 0X67, 0XE8, 0X23, 0X52, 0XB0, 0XD8, 0X8B, 0XA0,
-  0XA3, 0X0B, 0XC0, 0X64, 0X1A, 0XA2, 0X8A, 0X58, 0XA5, 0X15, 0X22, 0X22,
-  0X70, 0X76, 0X10, 0X0A, 0X10, 0XD6, 0X75, 0XA8, 0X10, 0XA7, 0X0D, 0X66,
-  0XDE, 0XB4, 0X59, 0XF9, 0XCD, 0X33, 0XCB, 0XB9, 0X5A, 0XC8, 0X4B, 0X4A,
-  0X43, 0X93, 0X9C, 0XF6, 0XE8, 0X3B, 0X10, 0X4E, 0XF1, 0X48, 0X89, 0XE3,
-  0X25, 0X85, 0XF7, 0XCB, 0XB6, 0X85, 0X43, 0XD1, 0XB3, 0X41, 0X1E, 0XAC,
-  0X70, 0X0C, 0X01, 0X34, 0X67, 0X5B, 0XD1, 0XCC, 0X88, 0X08, 0X31, 0XE8,
-  0XDE, 0X7E, 0XBB, 0XFD, 0X34, 0X66, 0X1A, 0XA2, 0X7E, 0XF2, 0XEF, 0X65,
-  0X61, 0X45, 0X0E, 0X64, 0X3B, 0X49, 0X90, 0X24, 0XC1, 0XBF, 0X00, 0X22,
-  0XB9, 0X1F, 0XD9, 0XF8, 0XAA, 0XC0, 0X92, 0X94, 0XA1, 0X2C, 0X41, 0XED,
-  0X65, 0X4B, 0X9C, 0X89, 0X73, 0X50, 0X06, 0X92, 0XE7, 0X08, 0XFC, 0XC4,
-  0X02, 0X6D, 0XAA, 0XC3, 0X07, 0X45, 0X8A, 0X37, 0XA6, 0X3B, 0X99, 0XAE,
-  0X96, 0X94, 0X1C, 0X50, 0X04, 0X3F, 0XE1, 0XB6, 0X41, 0X85, 0X79, 0X0A,
-  0X62, 0X39, 0X55, 0X20, 0X37, 0XF0, 0XCE, 0X40, 0X4D, 0X30, 0XEF, 0X34,
-  0XA3, 0XC8, 0X22, 0XDA, 0X5F, 0X93, 0XF0, 0XA8, 0XD5, 0XA7, 0X13, 0XE6,
-  0X68, 0XDA, 0XEE, 0X1A, 0X91, 0XC0, 0X4C, 0X5E, 0XE5, 0X28, 0XC0, 0X94,
-  0XBC, 0X5C, 0X4B, 0XF0, 0X26, 0X31, 0X0B, 0X90, 0X5E, 0X4E, 0XBA, 0X97,
-  0X9F, 0XE6, 0XA0, 0X23, 0X87, 0X65, 0X52, 0X10, 0X6D, 0X0A, 0XD6, 0X6C,
-  0X17, 0X70, 0X04, 0XB2, 0X0E, 0XD5, 0X46, 0XEA, 0X5B, 0XBC, 0XDF, 0X4E,
-  0XA5, 0X31, 0X02, 0XF2, 0XE9, 0X96, 0X8C, 0XA9, 0XDF, 0X76, 0XD9, 0X6E,
-  0XA8, 0XD1, 0X7A, 0X23, 0XE0, 0XE4, 0X9F, 0X49, 0X9E, 0XBB, 0X02, 0X85,
-  0X04, 0X8C, 0X87, 0X78, 0X2C, 0XBB, 0X1E, 0X69, 0X9B, 0X9A, 0X00, 0X9B,
-  0XA6, 0X20, 0X52, 0X03, 0XEF, 0XD7, 0X97, 0XE4, 0X41, 0X9C, 0X03, 0X2D,
-  0XA1, 0XD7, 0XCD, 0X6A, 0X1A, 0XC7, 0XBE, 0X64, 0X23, 0X61, 0XB7, 0X23,
-  0X14, 0XB1, 0XDC, 0X49, 0X25, 0XDF, 0X2F, 0XF9, 0X9B, 0X8A, 0XF4, 0XF7,
-  0XA8, 0X53, 0X21, 0XFE, 0XFA, 0XE4, 0X66, 0X4D, 0X50, 0XF6, 0XA1, 0X85,
-  0XF1, 0XD1, 0XC7, 0XA9, 0XFF, 0XB1, 0X72, 0XCC, 0X18, 0X06, 0XFC, 0X16,
-  0X70, 0X38, 0XD8, 0XEE, 0X9E, 0X96, 0X06, 0X03, 0X58, 0XC7, 0XEE, 0X34,
-  0X4B, 0XD1, 0X1E, 0XDF, 0X50, 0X9A, 0X37, 0XAF, 0XC7, 0X41, 0X66, 0X81,
-  0XE1, 0X72, 0XE6, 0X48, 0X0D, 0X46, 0X15, 0X52, 0X47, 0XBA, 0X95, 0XD4,
-  0XDA, 0XA7, 0X37, 0X77, 0XDD, 0X87, 0X67, 0X0E, 0XB0, 0X43, 0XFD, 0X09,
-  0X44, 0XD6, 0X7A, 0XCF, 0XC5, 0X65, 0X7D, 0X14, 0X71, 0X29, 0XBC, 0X82,
-  0X20, 0XE7, 0X9A, 0X45, 0X33, 0XDA, 0X83, 0X73, 0XD8, 0XB2, 0X76, 0X98,
-  0XCA, 0X4B, 0XB2, 0X78, 0XF3, 0XE5, 0X62, 0X3F, 0X14, 0X4C, 0X14, 0XBF,
-  0XEB, 0X5A, 0XF0, 0X2E, 0XF5, 0X7D, 0X89, 0XCB, 0XF5, 0XFA, 0X52, 0XA3,
-  0XAA, 0XC8, 0XDF, 0X10, 0XB7, 0XCB, 0XAB, 0XD7, 0X13, 0XA1, 0X11, 0X74,
-  0XB9, 0X5F, 0XDB, 0X3D, 0X18, 0X87, 0XEB, 0X23, 0XBA, 0X1C, 0X1C, 0X19,
-  0XA5, 0XDC, 0X32, 0XEC, 0X34, 0X25, 0X72, 0XED, 0X2D, 0X8A, 0X01, 0X11,
-  0X57, 0X10, 0XA0, 0X01, 0X0A, 0X42, 0X2F, 0X53, 0XCA, 0XB6, 0XB2, 0X5D,
-  0X3E, 0X89, 0X11, 0XC4, 0XC7, 0XAA, 0X7F, 0XBE, 0XF6, 0X50, 0XF4, 0X19,
-  0X05, 0X2E, 0X19, 0X45, 0XE0, 0X1F, 0X04, 0XE6, 0X26, 0X62, 0X8A, 0X06,
-  0X4B, 0XC6, 0X70, 0XAD, 0X2D, 0X98, 0X54, 0X57, 0X48, 0X8E, 0X17, 0XD4,
-  0XAB, 0X03, 0XF0, 0X0C, 0XA5, 0X90, 0X00, 0X80, 0X37, 0X12, 0XE3, 0XE1,
-  0X4C, 0XE9, 0X98, 0X43, 0X30, 0X81, 0X2E, 0XA7, 0X73, 0X42, 0XDC, 0XAA,
-  0XCC, 0X93, 0X67, 0X44, 0X6A, 0X6E, 0X92, 0X10, 0XEA, 0XA2, 0XC9, 0X61,
-  0X29, 0XA2, 0XF4, 0X12, 0XE2, 0X9F, 0X6A, 0X2F, 0XC7, 0X8D, 0X4C, 0X28,
-  0XC1, 0X43, 0X61, 0X53, 0X91, 0X4A, 0XC9, 0XD6, 0X92, 0X4F, 0X06, 0X33,
-  0XB1, 0XD8, 0X80, 0X15, 0XE7, 0XAE, 0X50, 0XD5, 0XC9, 0XEE, 0X73, 0XC0,
-  0XFD, 0X25, 0XB7, 0XF0, 0XE3, 0X21, 0XE7, 0X38, 0X40, 0X44, 0X72, 0X64,
-  0X24, 0XD6, 0XF8, 0XE5, 0XA1, 0XB0, 0XE0, 0X78, 0XAD, 0XF6, 0XEE, 0X7A,
-  0XC2, 0X88, 0XE9, 0XD2, 0X5D, 0XAA, 0X33, 0X52, 0XD2, 0X70, 0X01, 0X9B,
-  0X7B, 0XCD, 0X01, 0XE4, 0XA8, 0XAF, 0XF2, 0X20, 0XBD, 0X03, 0XB7, 0XAF,
-  0X13, 0XED, 0XA0, 0X1E, 0X42, 0XC4, 0X25, 0X43, 0XB7, 0X31, 0XA3, 0XE8,
-  0X0A, 0X43, 0X69, 0X96, 0X61, 0XF0, 0X7C, 0XA6, 0XE1, 0XA9, 0XAE, 0XF0,
-  0X85, 0XFB, 0X08, 0XD7, 0X69, 0X75, 0X77, 0XD6, 0X60, 0XFC, 0XC9, 0XDD,
-  0XD3, 0X81, 0X2E, 0XB5, 0X4E, 0X8C, 0X56, 0X71, 0X9E, 0X06, 0X05, 0X53,
-  0XDB, 0X5D, 0XD8, 0X40, 0XE7, 0XEA, 0X1C, 0X3A, 0XB6, 0XAE, 0X5B, 0X23,
-  0XB2, 0X2D, 0X54, 0XED, 0X8B, 0X82, 0X36, 0XBB, 0XD7, 0X47, 0X4D, 0X32,
-  0X4A, 0X74, 0X42, 0XC4, 0X60, 0X42, 0X3F, 0X0E, 0X83, 0XD0, 0XE7, 0X8B,
-  0X80, 0XD3, 0XE0, 0XAB, 0X8B, 0XFE, 0X9B, 0X77, 0XB8, 0XC9, 0XDD, 0X60,
-  0XB3, 0X7D, 0X72, 0XF3, 0XAD, 0X2E, 0XEE, 0X54, 0X8B, 0X23, 0X96, 0XF2,
-  0X5B, 0X4B, 0XD3, 0X60, 0X03, 0X47, 0X05, 0X38, 0XA0, 0X35, 0X15, 0XB3,
-  0X76, 0X52, 0XA6, 0XA5, 0X55, 0X2B, 0X9D, 0X60, 0XDD, 0XF0, 0X85, 0X9C,
-  0X9B, 0X3D, 0X24, 0XC3, 0XE9, 0X0B, 0X06, 0XE9, 0X60, 0XD2, 0X59, 0X30,
-  0X43, 0X2F, 0XFA, 0X33, 0XB3, 0X7A, 0X81, 0X77, 0X13, 0X8C, 0X2C, 0XBB,
-  0X95, 0XBE, 0XDB, 0X33, 0X7B, 0X33, 0XC4, 0X1E, 0XCB, 0X05, 0X18, 0XAB,
-  0X95, 0X2C, 0XB5, 0X2E, 0XCF, 0XB4, 0XC7, 0X94, 0X96, 0X61, 0X83, 0X29,
-  0X3A, 0XDE, 0X9D, 0X7D, 0X0D, 0X66, 0X26, 0X2B, 0X76, 0X75, 0X47, 0XEE,
-  0X0A, 0XC8, 0X51, 0X05, 0X5A, 0X1C, 0X0D, 0X1A, 0XC4, 0X4A, 0X95, 0XC7,
-  0X92, 0X8A, 0XD5, 0X50, 0X32, 0XC3, 0X8E, 0X9E, 0XCE, 0X66, 0X2F, 0X75,
-  0X7D, 0X3C, 0XE8, 0XB4, 0X20, 0X4C, 0XB9, 0XFB, 0XF9, 0X9A, 0XD0, 0X5D,
-  0XBE, 0X05, 0XC4, 0X98, 0XEA, 0X49, 0X3E, 0XFA, 0X5D, 0X6C, 0XA2, 0XD1,
-  0X13, 0XDF, 0X00, 0X83, 0X70, 0XC5, 0XB4, 0XC5, 0X47, 0X7F, 0X39, 0XF2,
-  0XF4, 0XF5, 0X7A, 0X12, 0X50, 0XDF, 0X8E, 0X1D, 0X40, 0X75, 0X10, 0X8D,
-  0XCB, 0XE0, 0X9A, 0X1A, 0X33, 0X1A, 0X1C, 0X2A, 0XA1, 0X08, 0X44, 0XAF,
-  0XDF, 0XDE, 0X50, 0X39, 0X2A, 0X15, 0XDA, 0X0E, 0XC7, 0X38, 0XC4, 0X45,
-  0X64, 0X9F, 0X3A, 0XB5, 0X06, 0X29, 0XA7, 0X7A, 0X3C, 0X79, 0X9E, 0X36,
-  0XA1, 0X97, 0XB1, 0XDE, 0X53, 0XC4, 0X70, 0XB2, 0X33, 0X0B, 0X08, 0X33,
-  0X31, 0X00, 0X85, 0X12, 0X24, 0X7E, 0X5B, 0X8C, 0X1C, 0XEF, 0X4E, 0X2F,
-  0XCF, 0XE6, 0XB9, 0XA7, 0X0F, 0X81, 0X70, 0XFA, 0XBB, 0X4A, 0XC2, 0X55,
-  0X2E, 0X0A, 0XC6, 0XF7, 0XC1, 0X6C, 0X41, 0XAF, 0XBC, 0XCD, 0X07, 0X97,
-  0X99, 0X70, 0XAD, 0X13, 0X40, 0X48, 0X31, 0X91, 0XC6, 0X97, 0X58, 0X80,
-  0X91, 0XE1, 0XCE, 0X6B, 0X52, 0X09, 0X5A, 0X57, 0X56, 0XED, 0XAC, 0X42,
-  0XC1, 0XE2, 0XE0, 0X0B, 0X8D, 0X4C, 0X56, 0XB8, 0XA5, 0XFB, 0X6D, 0X09,
-  0XF7, 0X35, 0X2B, 0XAC, 0X6A, 0X90, 0XC1, 0X74, 0XE3, 0X10, 0XA3, 0XD4,
-  0X6F, 0X19, 0X62, 0X74, 0XA9, 0X67, 0XF6, 0XEF, 0XC5, 0XF1, 0X55, 0XE8,
-  0X96, 0X86, 0X62, 0XF4, 0XCE, 0XF3, 0X3C, 0XB5, 0X21, 0X33, 0X6D, 0XE3,
-  0X3C, 0X4E, 0X36, 0X70, 0X93, 0X42, 0XCE, 0X43, 0XD8, 0X38, 0XAB, 0X1E,
-  0XAB, 0X81, 0X1E, 0XBC, 0X6A, 0X6C, 0X24, 0XC5, 0XEA, 0X38, 0X93, 0X1E,
-  0X9D, 0XA4, 0XD9, 0XAF, 0XD6, 0XFF, 0X70, 0X18, 0XAB, 0XC6, 0X0A, 0X8B,
-  0XAA, 0XB7, 0XED, 0X18, 0XF6, 0X2D, 0X60, 0XC6, 0X5B, 0X4A, 0X77, 0XBA,
-  0XD2, 0X43, 0XFD, 0X7D, 0X6E, 0XF2, 0XAA, 0XF8, 0XA9, 0XD6, 0X8C, 0X1C,
-  0XFF, 0X6D, 0XA5, 0X96, 0XCE, 0X5A, 0XAE, 0XB6, 0XA2, 0X6D, 0XD0, 0X72,
-  0X9B, 0XD8, 0XD0, 0X6A, 0XFE, 0XD6, 0X4A, 0XBF, 0XBB, 0XEC, 0X51, 0XAF,
-  0X9D, 0X46, 0XBB, 0XC5, 0XFD, 0X54, 0X87, 0X2D, 0X41, 0XE1, 0XFE, 0XD9,
-  0X26, 0X8D, 0X84, 0X83, 0XA2, 0X74, 0XDE, 0XD9, 0X39, 0X20, 0XB9, 0XA0,
-  0XDD, 0XB0, 0XC2, 0X28, 0X2F, 0X35, 0X7C, 0X69, 0XB0, 0XDB, 0XE5, 0X2A,
-  0XDD, 0X21, 0X2F, 0X43, 0X97, 0X9D, 0X34, 0XEE, 0X48, 0X84, 0XB9, 0X85,
-  0X00, 0X35, 0X94, 0X17, 0X8E, 0X64, 0XB8, 0X66, 0X08, 0X1C, 0XBA, 0X03,
-  0X20, 0XD9, 0X59, 0XD0, 0XE6, 0X1F, 0XDD, 0XCE, 0X2A, 0X0F, 0X87, 0XD0,
-  0X5B, 0X88, 0X5D, 0X0D, 0X46, 0X56, 0X05, 0X83, 0X66, 0X44, 0XDE, 0X16,
-  0X99, 0X50, 0XF3, 0X58, 0X33, 0X36, 0X55, 0X08, 0X37, 0XC2, 0XA9, 0XB0,
-  0X4A, 0X02, 0X7A, 0XA9, 0X7A, 0XC4, 0XE9, 0X87, 0XC9, 0XE8, 0X59, 0X0D,
-  0X75, 0XBB, 0X72, 0X68, 0XCB, 0XEB, 0XDA, 0XBD, 0XD0, 0X47, 0X8C, 0XBB,
-  0X23, 0XB0, 0X44, 0XE0, 0X75, 0X58, 0XAC, 0X68, 0X19, 0X3E, 0X21, 0X26,
-  0XAA, 0X32, 0X3E, 0XE6, 0X5B, 0X7D, 0X56, 0X59, 0X47, 0XB9, 0XD4, 0X63,
-  0X1B, 0X37, 0X9E, 0XC8, 0X1C, 0X5F, 0X2F, 0XD1, 0X4A, 0X10, 0XAC, 0X0D,
-  0X53, 0XD9, 0X41, 0XAB, 0X57, 0X35, 0XB6, 0X6D, 0XA7, 0X28, 0XAC, 0XBB,
-  0X44, 0X40, 0XBD, 0XB7, 0X40, 0X7E, 0X2E, 0XC6, 0XD5, 0XE8, 0X18, 0X9E,
-  0XF2, 0X30, 0X49, 0XFB, 0XA2, 0XD0, 0X59, 0XEF, 0XBC, 0X25, 0X59, 0XD2,
-  0X64, 0X64, 0XE5, 0XC5, 0X6B, 0X8D, 0X49, 0X8B, 0XC9, 0X95, 0XC4, 0XD6,
-  0X22, 0XB7, 0X09, 0XBF, 0XF9, 0X8B, 0X7E, 0X97, 0XFE, 0X55, 0X6A, 0XE0,
-  0XF7, 0X9E, 0XCE, 0X52, 0XB8, 0X83, 0X0D, 0XA5, 0X5D, 0XC5, 0X18, 0XC8,
-  0X87, 0XCC, 0X29, 0XC8, 0XC4, 0XA1, 0X06, 0X38, 0X1C, 0X94, 0X78, 0XB7,
-  0X9E, 0X0B, 0X8A, 0X15, 0X54, 0X7B, 0X2C, 0XBF, 0XC3, 0X6D, 0XD7, 0XA6,
-  0X87, 0XCF, 0X0F, 0XC7, 0X20, 0X3D, 0XC0, 0X2B, 0X0A, 0XC3, 0XAD, 0X3B,
-  0X37, 0X96, 0XEC, 0X35, 0X0C, 0XE0, 0XD1, 0X7E, 0XB2, 0X80, 0XE3, 0X88,
-  0XC2, 0X5A, 0X8E, 0XE8, 0XED, 0XE0, 0X9B, 0X83, 0X77, 0X0E, 0X89, 0X6A,
-  0XB0, 0X63, 0XBF, 0X0B, 0X83, 0X33, 0X75, 0X7C, 0X60, 0X29, 0XA4, 0X95,
-  0X27, 0X55, 0XA9, 0X96, 0XB7, 0X45, 0X55, 0XE3, 0X96, 0XEE, 0X89, 0X92,
-  0X72, 0X4C, 0X14, 0X82, 0X98, 0X26, 0X2B, 0X35, 0X0E, 0XE6, 0X53, 0XA8,
-  0X8E, 0X7A, 0XFB, 0X94, 0XC9, 0XFB, 0XAB, 0X96, 0XAE, 0X2C, 0X7E, 0XBD,
-  0X7C, 0X85, 0X48, 0X14, 0X6D, 0X61, 0X8A, 0X80, 0X03, 0X1D, 0X0A, 0XAE,
-  0X19, 0XBF, 0XE8, 0XB8, 0X3B, 0XDF, 0X68, 0XAE, 0XE0, 0XCD, 0X7D, 0X80,
-  0X8C, 0X18, 0XF1, 0XCA, 0X77, 0X90, 0X38, 0X99, 0X61, 0X26, 0X01, 0XA1,
-  0XBF, 0X73, 0X42, 0X7A, 0X75, 0XD7, 0XE9, 0X0D, 0X40, 0X25, 0X50, 0X61,
-  0XFB, 0X4D, 0XDE, 0X43, 0X6B, 0X30, 0X8D, 0X4F, 0XD3, 0X16, 0X1D, 0XC4,
-  0X2E, 0X34, 0X56, 0XBD, 0X95, 0XCA, 0XF6, 0X6D, 0X20, 0XB5, 0X13, 0XA1,
-  0XA2, 0X73, 0XF1, 0X3D, 0X2D, 0XBE, 0XD0, 0X3B, 0XE7, 0X43, 0X75, 0X73,
-  0XE7, 0XA5, 0X06, 0XB5, 0X3C, 0X67, 0X8D, 0X35, 0X73, 0XE0, 0X04, 0XDE,
-  0X88, 0XD1, 0X54, 0X10, 0XBF, 0X96, 0XBC, 0XB1, 0X8F, 0XDE, 0XEA, 0X95,
-  0X01, 0X91, 0XA9, 0XE3, 0XB1, 0X10, 0XE1, 0X2D, 0X9E, 0XD9, 0XCC, 0X69,
-  0XBB, 0X85, 0X92, 0XB4, 0X96, 0XF3, 0XA6, 0X62, 0XC0, 0XC5, 0X2A, 0X73,
-  0XF2, 0X67, 0X5F, 0XDC, 0X43, 0X7B, 0XC4, 0XA1, 0XA1, 0X78, 0X0D, 0X01,
-  0XED, 0XA0, 0X1A, 0XCA, 0X5E, 0X70, 0XA0, 0XC1, 0X25, 0XDD, 0XA2, 0X19,
-  0XE8, 0X58, 0XB9, 0X8F, 0X78, 0X5E, 0XA3, 0X0C, 0XBC, 0XE3, 0X21, 0X2D,
-  0X58, 0X5D, 0XC1, 0X7D, 0XAF, 0X03, 0XB6, 0XD9, 0X01, 0X43, 0XEB, 0XAC,
-  0XE6, 0X08, 0X99, 0XB4, 0X69, 0X8F, 0X18, 0X0A, 0XC3, 0XDC, 0X6E, 0X79,
-  0X24, 0XEB, 0X97, 0X09, 0XE7, 0XEC, 0XF9, 0X24, 0XFC, 0X58, 0XEE, 0XE7,
-  0X95, 0X6F, 0XE4, 0XE5, 0XBE, 0X72, 0XC1, 0X46, 0X44, 0X5F, 0XD6, 0X87,
-  0X81, 0X52, 0XEA, 0XB6, 0X2D, 0XE8, 0X43, 0X0B, 0XE0, 0XBA, 0XB1, 0X3E,
-  0XCD, 0XD3, 0X7B, 0X92, 0XC9, 0XAF, 0XC9, 0XB3, 0XBB, 0XAA, 0X4C, 0X7D,
-  0X73, 0XF6, 0X41, 0XB3, 0X67, 0XCE, 0XD6, 0X97, 0X47, 0X78, 0XEA, 0X79,
-  0X4A, 0X98, 0XFE, 0XF0, 0X25, 0X5F, 0XB4, 0XB0, 0XCC, 0X1B, 0X8C, 0X65,
-  0X4B, 0X65, 0X1C, 0X04, 0X5E, 0X23, 0X5A, 0XB8, 0X34, 0XD5, 0X0A, 0XE1,
-  0XCC, 0X2E, 0XA2, 0XAD, 0X29, 0X5C, 0X30, 0X70, 0X27, 0X0E, 0X11, 0X99,
-  0X36, 0X31, 0XA7, 0XF7, 0X32, 0XA1, 0X0F, 0X4B, 0X80, 0X4C, 0X8D, 0X34,
-  0XF4, 0XE6, 0X17, 0X6E, 0X64, 0X04, 0X09, 0X45, 0X8C, 0X78, 0XFA, 0XBA,
-  0XF7, 0XB4, 0XC2, 0X45, 0X3E, 0X43, 0X66, 0X05, 0XD4, 0XA7, 0XD0, 0X90,
-  0XEF, 0XFD, 0XAB, 0X16, 0X4B, 0X46, 0X36, 0X9C, 0X25, 0X72, 0X8A, 0X4B,
-  0X73, 0X84, 0X67, 0XEB, 0X6D, 0X43, 0X7E, 0X06, 0X6D, 0XEA, 0XE2, 0XA4,
-  0X71, 0X96, 0XD3, 0XE2, 0XB9, 0X86, 0X10, 0X1D, 0X47, 0X9D, 0X6E, 0X6F,
-  0X3C, 0X81, 0X18, 0X75, 0X16, 0X43, 0X84, 0XB1, 0X2B, 0XE2, 0X38, 0XAE,
-  0X61, 0X9C, 0X7A, 0X42, 0X88, 0X4E, 0X98, 0XD3, 0X8A, 0XB2, 0XCC, 0XFE,
-  0X35, 0XDE, 0XC1, 0X15, 0XBA, 0XFE, 0XE2, 0XB9, 0X09, 0X24, 0XB0, 0XCC,
-  0X57, 0X7E, 0XB9, 0X51, 0XCE, 0XF2, 0X40, 0X2C, 0X66, 0XF7, 0X64, 0X69,
-  0X51, 0XF6, 0X5D, 0XE5, 0X20, 0X32, 0X06, 0XAE, 0XDE, 0X3C, 0X77, 0X4B,
-  0X11, 0X92, 0XF6, 0X66, 0X6E, 0X7F, 0X19, 0X62, 0X3E, 0X7F, 0X67, 0X2C,
-  0X2E, 0X3F, 0X69, 0XBA, 0XC0, 0X0E, 0XD9, 0X4A, 0X0E, 0XF0, 0X48, 0X8B,
-  0XB6, 0X5B, 0X17, 0XC7, 0X39, 0X0D, 0X1C, 0XDA, 0X96, 0X80, 0XAF, 0X84,
-  0XB2, 0X3F, 0X23, 0X9B, 0X0E, 0XD8, 0X13, 0XF0, 0X14, 0XA8, 0XEA, 0XE0,
-  0XB3, 0X38, 0X67, 0XE4, 0XD2, 0XD3, 0XEB, 0XF2, 0XF3, 0XD9, 0X2B, 0XF2,
-  0XD8, 0X35, 0XE7, 0XC4, 0XD5, 0X82, 0XF6, 0X10, 0X24, 0X81, 0X61, 0XC6,
-  0X37, 0X7A, 0XD6, 0XC0, 0X74, 0X27, 0X68, 0X33, 0X5B, 0X21, 0XB5, 0XD1,
-  0XDF, 0X3A, 0XC4, 0X44, 0X84, 0XB7, 0X2A, 0XAC, 0X11, 0X5B, 0XCB, 0X09,
-  0XE5, 0XEF, 0X5C, 0XD0, 0X62, 0XAF, 0XEF, 0X25, 0XAF, 0X67, 0XE8, 0X49,
-  0XF7, 0XD9, 0X97, 0XDC, 0XAA, 0XD3, 0XEB, 0X5D, 0X41, 0X5D, 0X2F, 0X4F,
-  0XFD, 0XDE, 0X71, 0X38, 0X29, 0X2E, 0X6F, 0XB0, 0X18, 0XF7, 0XF1, 0X05,
-  0X36, 0X59, 0X45, 0X69, 0X26, 0XE8, 0XCD, 0X35, 0X13, 0X28, 0XC6, 0XED,
-  0XB7, 0X83, 0X2E, 0X74, 0X9D, 0XDC, 0X5D, 0XEF, 0XD4, 0XE1, 0X6D, 0X1C,
-  0XE5, 0XB4, 0X96, 0XA1, 0X7C, 0XBA, 0XEE, 0XE7, 0X5D, 0X77, 0XBD, 0XC7,
-  0X66, 0X7B, 0X73, 0XAE, 0X83, 0XEB, 0X27, 0X36, 0X82, 0X6C, 0XDD, 0X96,
-  0X13, 0XD4, 0X42, 0X5C, 0X2E, 0XD7, 0X44, 0X6B, 0X98, 0XB2, 0XB1, 0X60,
-  0X2B, 0X4F, 0XE0, 0X16, 0X1F, 0XE1, 0X2E, 0XAF, 0X55, 0XD8, 0X2A, 0X25,
-  0X69, 0XD0, 0XA3, 0X2B, 0XE5, 0X85, 0XA0, 0X05, 0X4A, 0X32, 0X87, 0XFD,
-  0X3A, 0XC5, 0XC1, 0X26, 0XEA, 0X38, 0X02, 0X65, 0XB5, 0X33, 0X6C, 0XB6,
-  0X95, 0XA8, 0X35, 0X24, 0X5E, 0X39, 0XFF, 0X26, 0X9B, 0X37, 0X53, 0X87,
-  0X6F, 0X5C, 0XEE, 0X2C, 0XF4, 0X04, 0X24, 0X17, 0X78, 0X17, 0XD7, 0X84,
-  0X92, 0X07, 0XBC, 0X6E, 0X7B, 0X7F, 0X8A, 0X4D, 0XC3, 0X5D, 0XDA, 0XE4,
-  0X2B, 0X7D, 0X86, 0X26, 0X4F, 0XD3, 0X6C, 0XDE, 0X39, 0X08, 0X33, 0X6D,
-  0X97, 0XBF, 0X00, 0X3A, 0X76, 0X14, 0X67, 0XC7, 0X57, 0X01, 0X44, 0X55,
-  0X24, 0X1B, 0X0E, 0X9E, 0X35, 0X30, 0XF6, 0X10, 0XF0, 0X25, 0X8C, 0XB1,
-  0X40, 0XC2, 0XE4, 0X3B, 0X2D, 0X68, 0X1A, 0X1D, 0X1F, 0XAA, 0XA2, 0X1F,
-  0XC1, 0X6B, 0X19, 0XFA, 0XB8, 0X0B, 0XD5, 0X6E, 0X85, 0XEB, 0X0D, 0X96,
-  0XC6, 0X68, 0XC3, 0X37, 0XCB, 0X8E, 0XFC, 0XF3, 0XE1, 0XDF, 0XA2, 0XC2,
-  0X89, 0X00, 0XDF, 0X5D, 0X75, 0XAF, 0X95, 0X14, 0X08, 0X88, 0XD7, 0XF8,
-  0X99, 0XCA, 0X1A, 0XFC, 0X0E, 0X74, 0XE3, 0X1B, 0X83, 0X1C, 0X34, 0X06,
-  0X9C, 0XF4, 0X4F, 0X45, 0X01, 0XEB, 0XB3, 0X38, 0XE2, 0X8F, 0XAD, 0X24,
-  0X6F, 0XC8, 0X27, 0X0C, 0X50, 0XE0, 0X5C, 0X5F, 0X8B, 0X58, 0X49, 0X26,
-  0X24, 0XCB, 0XC6, 0X75, 0X11, 0X86, 0X1D, 0X57, 0X68, 0X51, 0XFD, 0X42,
-  0X5A, 0XC3, 0X79, 0XA3, 0X09, 0X49, 0X63, 0X66, 0X92, 0XA2, 0X1A, 0X02,
-  0X7F, 0X01, 0X6A, 0XDE, 0X97, 0XD5, 0X97, 0X6C, 0X74, 0XCF, 0XE6, 0X54,
-  0XD2, 0X3D, 0X82, 0X0E, 0X0D, 0XF4, 0X58, 0XED, 0X6D, 0X8B, 0X5A, 0X68,
-  0X09, 0X60, 0X90, 0XD9, 0X17, 0X8B, 0X9F, 0X99, 0X93, 0XC5, 0XBC, 0X33,
-  0X73, 0X6D, 0X76, 0XF5, 0XB2, 0XA6, 0XDA, 0XD9, 0XB7, 0X8A, 0X06, 0X0D,
-  0X1E, 0XA8, 0X6A, 0XDD, 0X26, 0X9A, 0X8D, 0X16, 0X28, 0X8E, 0X46, 0X2B,
-  0X9A, 0XA0, 0X49, 0X91, 0XA3, 0XAC, 0X84, 0X7C, 0X03, 0X7D, 0XA0, 0X2F,
-  0X56, 0XF3, 0X48, 0X21, 0X7E, 0XBA, 0XAA, 0X4C, 0X45, 0X4E, 0XA0, 0XC8,
-  0X86, 0XFC, 0X2E, 0X34, 0X9D, 0XAA, 0XFC, 0X13, 0XA1, 0XEB, 0X36, 0X6B,
-  0X05, 0XA8, 0X15, 0X10, 0XD3, 0XC6, 0XD2, 0X44, 0X17, 0X9A, 0X58, 0XB5,
-  0X25, 0X54, 0XB7, 0XDE, 0X94, 0X87, 0X7C, 0X43, 0X2E, 0X13, 0X40, 0X6F,
-  0XA6, 0XC3, 0X57, 0X62, 0XC5, 0X4B, 0X5F, 0X6F, 0X7C, 0X7F, 0X9E, 0XD9,
-  0X8B, 0XDA, 0X5B, 0X8E, 0X69, 0XD0, 0XC2, 0XFB, 0X78, 0X94, 0XC0, 0X5D,
-  0X90, 0XAA, 0X6D, 0X64, 0X4C, 0X4B, 0X5F, 0X18, 0X9B, 0X56, 0X7B, 0X05,
-  0X30, 0X55, 0XDC, 0XCB, 0XC4, 0XCF, 0XB9, 0X70, 0X15, 0X9F, 0X92, 0X7B,
-  0XBF, 0X5F, 0X16, 0X0C, 0XA6, 0XC1, 0XDE, 0XD6, 0X81, 0X27, 0X58, 0XB0,
-  0XA8, 0X8C, 0XEF, 0X44, 0XDB, 0XAA, 0XC8, 0XBC, 0XC9, 0X57, 0XB9, 0XA1,
-  0XA5, 0X44, 0X67, 0XC1, 0X59, 0XBD, 0XC7, 0XC4, 0XF0, 0XA4, 0X83, 0X84,
-  0X0A, 0X7F, 0X69, 0XD2, 0XB6, 0X72, 0X4B, 0XC4, 0X3D, 0X77, 0X0F, 0X52,
-  0XE1, 0XD5, 0XFE, 0XC0, 0X79, 0X4C, 0X87, 0X2A, 0X69, 0X07, 0XD3, 0XD9,
-  0X1F, 0XFE, 0X7B, 0X11, 0XE5, 0XFA, 0X6B, 0X7C, 0X70, 0XFD, 0X96, 0XB9,
-  0X6F, 0X31, 0XE6, 0X28, 0X3A, 0X32, 0XF1, 0X61, 0XD6, 0XD5, 0X12, 0X26,
-  0X0F, 0XDD, 0X2B, 0X39, 0X01, 0X45, 0X33, 0X2D, 0X87, 0X67, 0XA7, 0XC5,
-  0XAD, 0XA7, 0X48, 0X7E, 0X69, 0XB6, 0XFC, 0XDE, 0XC8, 0X66, 0XCC, 0XBE,
-  0XFD, 0X5A, 0XB3, 0X87, 0X40, 0XC5, 0XA3, 0X85, 0X0E, 0X0F, 0XC9, 0X36,
-  0XBB, 0X05, 0XF6, 0X72, 0X47, 0X4E, 0X4D, 0XC7, 0X4E, 0XA7, 0X76, 0X9F,
-  0X08, 0X40, 0XAD, 0X06, 0X89, 0X62, 0X80, 0XD7, 0XC1, 0X80, 0XF3, 0X67,
-  0X0E, 0XD0, 0XB8, 0X44, 0X7B, 0XDA, 0X0B, 0X82, 0X7E, 0XBE, 0X10, 0X70,
-  0XDD, 0X0C, 0X05, 0X1A, 0XAC, 0XC5, 0X91, 0X5D, 0X0C, 0X24, 0X41, 0XF5,
-  0X28, 0X8A, 0X4F, 0X60, 0X85, 0XEE, 0X77, 0X23, 0XB7, 0X87, 0X49, 0XA0,
-  0X90, 0X6C, 0X37, 0X53, 0X99, 0X0C, 0X19, 0XFA, 0XD4, 0XC4, 0XAF, 0XF1,
-  0X8A, 0XDF, 0X2F, 0XE9, 0XD1, 0XF9, 0X2E, 0X93, 0X23, 0X35, 0XB6, 0X91,
-  0XFD, 0XE7, 0X15, 0X87, 0X83, 0XD6, 0X1E, 0XB1, 0X62, 0XD1, 0X10, 0XDC,
-  0XCD, 0XDC, 0XDA, 0XA8, 0XEF, 0X4F, 0X79, 0X3B, 0XD2, 0X4E, 0X47, 0XF1,
-  0X52, 0X21, 0X22, 0X94, 0XB9, 0X7B, 0X32, 0XBE, 0X29, 0XE7, 0X91, 0X31,
-  0X37, 0X38, 0X9E, 0X86, 0XCA, 0XDE, 0X44, 0X0F, 0X13, 0XBE, 0XB3, 0X93,
-  0XAF, 0XB3, 0XF9, 0XF2, 0X47, 0X64, 0XF0, 0XFB, 0XC9, 0X2C, 0X5B, 0XBD,
-  0X8E, 0X77, 0XD2, 0X74, 0X81, 0XCB, 0X07, 0X06, 0X20, 0X84, 0XCC, 0XA5,
-  0X2C, 0X22, 0X7E, 0X41, 0X5F, 0XC2, 0XB9, 0XA6, 0XD8, 0XDE, 0X3C, 0XBA,
-  0X2A, 0X18, 0X39, 0XC0, 0XE8, 0XEA, 0XD5, 0X26, 0XE9, 0X1E, 0X5B, 0XDB,
-  0X7C, 0XBF, 0XB5, 0XEF, 0X1E, 0XB5, 0X8A, 0XBC, 0XFB, 0X42, 0X2C, 0X8F,
-  0X9C, 0XC4, 0X50, 0X62, 0X88, 0X8B, 0XD2, 0X9D, 0XCF, 0X40, 0X99, 0XBD,
-  0XFA, 0X73, 0X40, 0X4F, 0XDB, 0X5F, 0X15, 0X89, 0XDC, 0XBA, 0X13, 0X79,
-  0X5D, 0XC8, 0XCB, 0X23, 0X36, 0XFF, 0XEA, 0X1D, 0X3E, 0X97, 0XC0, 0X09,
-  0X80, 0X7B, 0XFF, 0XCE, 0X8E, 0X50, 0X09, 0X1E, 0XB4, 0X08, 0X0D, 0X94,
-  0X18, 0X60, 0XFD, 0XC6, 0X91, 0XFE, 0XB0, 0X39, 0X04, 0XCD, 0X04, 0X6C,
-  0XC6, 0XD6, 0XE0, 0XE1, 0X39, 0X32, 0XC8, 0X9E, 0X9F, 0X22, 0X66, 0X35,
-  0XB2, 0X09, 0XA8, 0XDC, 0X7E, 0X7D, 0XA5, 0XC4, 0X0D, 0X94, 0XCA, 0X71,
-  0X77, 0XB8, 0X0E, 0X93, 0X6B, 0XA6, 0X1C, 0X94, 0X85, 0X69, 0X5B, 0X13,
-  0XDE, 0X28, 0X56, 0X86, 0XF7, 0X27, 0XA7, 0XF0, 0X3A, 0X46, 0X3D, 0X2A,
-  0XA0, 0X83, 0XE5, 0X81, 0X3B, 0X71, 0X56, 0X8D, 0XBD, 0XAA, 0X56, 0XD8,
-  0XA1, 0X9A, 0X33, 0X58, 0XE1, 0XD1, 0X47, 0X8A, 0XAE, 0X3E, 0X17, 0X78,
-  0X27, 0X64, 0X94, 0X44, 0XB1, 0XB2, 0X5C, 0X13, 0XC1, 0XAE, 0X76, 0X7C,
-  0XAD, 0XB4, 0X3D, 0XF2, 0XF3, 0XCF, 0X5F, 0XDA, 0XA6, 0XD6, 0X92, 0X1D,
-  0X89, 0X90, 0XC8, 0X11, 0X75, 0XE8, 0X3B, 0X9D, 0X38, 0XE4, 0XFA, 0XCE,
-  0X73, 0XE5, 0X5D, 0X46, 0XB3, 0XE3, 0X3D, 0X6A, 0X86, 0XB1, 0X3E, 0XB3,
-  0X2F, 0X94, 0X44, 0X55, 0XB1, 0X65, 0X60, 0X57, 0XE7, 0X4B, 0XBC, 0X1D,
-  0X76, 0XE5, 0X07, 0XAB, 0X55, 0XBF, 0X02, 0XF0, 0X49, 0X6F, 0XB0, 0XBB,
-  0X78, 0X3C, 0XD8, 0X02, 0X8D, 0X29, 0X6D, 0X7E, 0X50, 0X34, 0X9A, 0X3C,
-  0XD6, 0X14, 0XA7, 0X69, 0X59, 0XAC, 0X48, 0X8C, 0X6E, 0X92, 0X5B, 0X10,
-  0X89, 0X3E, 0XB5, 0X79, 0XA5, 0X1F, 0XC3, 0X47, 0X94, 0X25, 0X16, 0XD1,
-  0XA4, 0XEA, 0X60, 0XA2, 0X6E, 0X24, 0XC4, 0X60, 0XB3, 0X2F, 0X04, 0XD0,
-  0XB5, 0X19, 0XAC, 0XB6, 0X1D, 0X60, 0X9B, 0XA7, 0X71, 0X16, 0X9C, 0X44,
-  0X9E, 0X11, 0X89, 0XF6, 0XE8, 0XCC, 0XB9, 0X1B, 0X89, 0X42, 0X25, 0X22,
-  0X71, 0X6A, 0X51, 0XB0, 0X25, 0XF7, 0XB1, 0XC1, 0X46, 0XB8, 0X06, 0X66,
-  0XD5, 0X63, 0XD9, 0X42, 0XB2, 0X4B, 0X90, 0X48, 0X1C, 0X38, 0X24, 0XF5,
-  0X29, 0X54, 0X36, 0X8F, 0X09, 0XA4, 0XB5, 0XCC, 0X67, 0X62, 0X16, 0X4A,
-  0X89, 0X9B, 0XCD, 0XDC, 0X35, 0X18, 0XFD, 0XCA, 0X67, 0X85, 0X08, 0X14,
-  0X33, 0XAC, 0XB9, 0X02, 0X0C, 0X18, 0XBE, 0X11, 0X45, 0X63, 0X89, 0XC9,
-  0X2D, 0XB9, 0X14, 0X34, 0X6D, 0X16, 0X24, 0XC9, 0X3C, 0X1B, 0X35, 0XAC,
-  0XB6, 0X02, 0XA6, 0XF7, 0XA7, 0X76, 0X1D, 0X80, 0XAA, 0XE0, 0X42, 0X92,
-  0X42, 0XAA, 0X84, 0XCA, 0X0D, 0X00, 0X09, 0X4D, 0X56, 0XC1, 0X8D, 0X57,
-  0X1F, 0X1A, 0X9A, 0XAA, 0X51, 0X8F, 0XE2, 0X03, 0X4D, 0XD1, 0X36, 0XAD,
-  0X6D, 0X1B, 0X5C, 0XB0, 0X58, 0X5C, 0X67, 0XC6, 0X9E, 0X57, 0XA7, 0X51,
-  0X82, 0X29, 0X01, 0XA2, 0X5F, 0X98, 0X2F, 0X4C, 0XB7, 0XC3, 0XD1, 0X22,
-  0X90, 0XBF, 0X65, 0X9E, 0X0D, 0XA9, 0XF7, 0X05, 0X9A, 0XC4, 0X5C, 0X70,
-  0XC6, 0X9F, 0XE5, 0X00, 0X85, 0X42, 0XEE, 0XF6, 0X32, 0X75, 0X97, 0XCA,
-  0XAF, 0X4C, 0XB6, 0XF7, 0XC3, 0X57, 0XEC, 0XEA, 0X43, 0X35, 0X09, 0X97,
-  0X89, 0XA0, 0X65, 0X09, 0X67, 0X91, 0XBE, 0X81, 0XE3, 0X08, 0X08, 0X70,
-  0X9B, 0X62, 0X6C, 0X05, 0XC1, 0X1C, 0XD8, 0XA5, 0X8C, 0X05, 0X20, 0XBA,
-  0X7D, 0X5A, 0XC6, 0X61, 0X50, 0X05, 0X96, 0XD7, 0X6E, 0X78, 0X6E, 0X94,
-  0X51, 0X7C, 0X97, 0X33, 0XE0, 0X34, 0XE1, 0X84, 0X86, 0X76, 0X44, 0X48,
-  0X2A, 0X4F, 0XEC, 0X61, 0XD1, 0XFA, 0XCF, 0XC4, 0XCF, 0XFB, 0XF4, 0XCE,
-  0X87, 0XE0, 0X7D, 0X79, 0X4A, 0X5F, 0XA1, 0X07, 0X1F, 0XFA, 0X24, 0X0D,
-  0X5C, 0XFB, 0XE9, 0X9C, 0XF0, 0X1E, 0X26, 0X5D, 0X3C, 0XBA, 0XC2, 0XD9,
-  0X6D, 0X76, 0XD5, 0X3C, 0XAD, 0X9E, 0X12, 0XFA, 0XEF, 0XB7, 0X9D, 0X9C,
-  0X22, 0X09, 0X0E, 0X60, 0X46, 0XFB, 0X29, 0X31, 0XA1, 0XB4, 0XCE, 0X45,
-  0X76, 0XBF, 0XA5, 0XA2, 0X69, 0X5E, 0X8E, 0X91, 0X32, 0X6F, 0XB3, 0X2B,
-  0XCE, 0X10, 0XF8, 0XBA, 0XAF, 0XFB, 0X7B, 0X79, 0X9C, 0X6E, 0X7E, 0X5F,
-  0X19, 0X00, 0X97, 0XA8, 0X5B, 0X3B, 0XBA, 0XCD, 0XFA, 0X82, 0X65, 0XCD,
-  0X1B, 0X18, 0X21, 0X4E, 0X78, 0X91, 0XD6, 0X29, 0XBE, 0XCE, 0X58, 0XC0,
-  0XF2, 0XD2, 0X1C, 0X8A, 0X97, 0X57, 0XF5, 0X27, 0X61, 0X3B, 0X28, 0X28,
-  0X7A, 0X0F, 0XD7, 0XAC, 0X25, 0X48, 0XFE, 0XEE, 0XC7, 0X9A, 0X7F, 0X61,
-  0X94, 0X2B, 0X1D, 0XA5, 0X49, 0XFD, 0X80, 0XF9, 0X3C, 0XF4, 0XFB, 0X83,
-  0XCB, 0X1E, 0X13, 0XED, 0XF6, 0X2D, 0X2D, 0XCB, 0XE0, 0X00, 0XF7, 0XD9,
-  0X77, 0X30, 0X79, 0X7C, 0XF9, 0X40, 0XD7, 0X50, 0X91, 0XD2, 0X18, 0X98,
-  0X47, 0XC2, 0XDC, 0X4D, 0XE0, 0X8D, 0XE0, 0X45, 0XEE, 0XA5, 0X76, 0X84,
-  0XAF, 0X36, 0X46, 0X62, 0XBF, 0XEF, 0X30, 0XA2, 0X23, 0XDC, 0X41, 0X01,
-  0X63, 0XF9, 0X26, 0XA7, 0X56, 0X70, 0X7D, 0X0A, 0X83, 0XA4, 0XB8, 0XF4,
-  0X6F, 0X24, 0XEF, 0X50, 0X69, 0X6C, 0X7A, 0X94, 0XBD, 0XB7, 0X87, 0XD9,
-  0XD8, 0X47, 0XB7, 0X76, 0X4E, 0XDA, 0X4A, 0XE5, 0X2B, 0XFD, 0XB4, 0X44,
-  0X88, 0XE0, 0X11, 0XCE, 0XC5, 0XB9, 0X9E, 0X8C, 0XC9, 0X74, 0X47, 0XF5,
-  0X71, 0X47, 0X6B, 0X93, 0X3F, 0X7D, 0X7E, 0X46, 0XF7, 0X18, 0X2E, 0XA3,
-  0X92, 0XE7, 0XD0, 0X0B, 0X9B, 0X00, 0XC2, 0X81, 0XE2, 0X91, 0XB7, 0X9D,
-  0XC9, 0X83, 0X99, 0XD1, 0X22, 0XB5, 0X22, 0XDB, 0X34, 0XF3, 0XD9, 0X9F,
-  0X8B, 0X94, 0XB3, 0X8F, 0X68, 0X11, 0XF4, 0X22, 0X01, 0X2C, 0X02, 0XE4,
-  0XC4, 0X79, 0X97, 0X19, 0XA1, 0XB6, 0X67, 0X26, 0X02, 0XA7, 0X23, 0X07,
-  0X02, 0XA4, 0XAA, 0XA9, 0X14, 0X91, 0XB9, 0X80, 0X21, 0X8B, 0X70, 0X52,
-  0X0F, 0X51, 0X87, 0X3B, 0X78, 0X22, 0X49, 0XC7, 0X14, 0X71, 0XDF, 0XCB,
-  0X5F, 0X1C, 0X6D, 0X80, 0XD2, 0X46, 0X7D, 0X92, 0X3A, 0XCB, 0X61, 0X43,
-  0X89, 0XE5, 0X14, 0X8B, 0X34, 0X22, 0X3B, 0X76, 0X26, 0X64, 0X6A, 0X25,
-  0X72, 0XDF, 0XF1, 0XF7, 0XDD, 0X60, 0X0E, 0XE8, 0XEB, 0X4E, 0X56, 0X91,
-  0X82, 0XE9, 0XF9, 0X6C, 0XA3, 0X7D, 0X9D, 0XB4, 0X93, 0XE4, 0X0C, 0X8D,
-  0X58, 0XDA, 0X6A, 0X38, 0XDD, 0X30, 0X94, 0XD3, 0XBA, 0XD3, 0XA7, 0X53,
-  0X56, 0X55, 0X66, 0X69, 0X41, 0XF1, 0X7A, 0X13, 0X46, 0X49, 0X28, 0X94,
-  0X6C, 0X03, 0X66, 0XAA, 0XC7, 0X37, 0X99, 0X56, 0XEC, 0XFA, 0X1E, 0X43,
-  0X8C, 0X6F, 0X07, 0X46, 0X83, 0XC1, 0X78, 0XD9, 0XC0, 0X94, 0XC6, 0XDD,
-  0X7D, 0X17, 0X33, 0XBE, 0X7B, 0X61, 0XEC, 0XC7, 0X10, 0X69, 0XE8, 0XE5,
-  0X7B, 0X5A, 0XCA, 0X87, 0X22, 0XCA, 0X74, 0XB0, 0X38, 0XB5, 0XDC, 0X5E,
-  0X43, 0XCE, 0X5A, 0X1B, 0X32, 0X52, 0X98, 0XD1, 0X4A, 0X74, 0XED, 0XBA,
-  0XF2, 0XD7, 0X17, 0XA5, 0X8E, 0X29, 0X18, 0X06, 0XE6, 0X35, 0X05, 0XBC,
-  0X18, 0XC1, 0X6B, 0XC9, 0XCD, 0X35, 0X5F, 0X0D, 0XEA, 0X9B, 0X05, 0X88,
-  0XE8, 0X62, 0XC2, 0X0F, 0XDB, 0XBE, 0XD1, 0X6B, 0X95, 0X72, 0XB0, 0XE7,
-  0X58, 0XC2, 0X24, 0X4F, 0X93, 0XED, 0X3D, 0X3C, 0X0C, 0XF4, 0XB1, 0XBC,
-  0XDA, 0X87, 0X63, 0XCA, 0X3C, 0XF0, 0X6A, 0X68, 0X13, 0X51, 0X77, 0X41,
-  0XF7, 0X04, 0XC8, 0X9A, 0X95, 0X2F, 0XD7, 0X6F, 0X81, 0X99, 0XEC, 0X38,
-  0XDD, 0XC0, 0XE8, 0X99, 0XA3, 0X0E, 0X77, 0XEF, 0X05, 0XEF, 0XD1, 0XD1,
-  0X23, 0XE1, 0X0E, 0X0F, 0X29, 0XBB, 0X7D, 0X41, 0X84, 0X37, 0X78, 0X26,
-  0X4B, 0X10, 0X17, 0X08, 0XF4, 0XAD, 0X8D, 0X98, 0X2B, 0X0A, 0XFA, 0XD1,
-  0X3E, 0XC6, 0X1D, 0X62, 0X1D, 0X36, 0XA2, 0X12, 0X48, 0X48, 0X78, 0XF4,
-  0X99, 0X5F, 0X76, 0X3F, 0X00, 0X63, 0X7A, 0XD4, 0X47, 0X86, 0X9D, 0X19,
-  0X92, 0X61, 0XC8, 0XD4, 0XBE, 0X72, 0X43, 0XDC, 0XEA, 0X6B, 0XB2, 0XE7,
-  0X77, 0X5B, 0XEF, 0XB1, 0XA1, 0X0E, 0XF7, 0X3B, 0X7C, 0X8D, 0X1B, 0XF4,
-  0X2E, 0XBE, 0X9D, 0X02, 0X18, 0X9A, 0X2C, 0X51, 0XD8, 0X91, 0X2F, 0X6A,
-  0X78, 0XBA, 0X84, 0XA4, 0XA7, 0X69, 0X92, 0X71, 0XF9, 0XED, 0XCF, 0XAB,
-  0X80, 0XB2, 0X18, 0X33, 0X17, 0X3C, 0X7C, 0X48, 0XB6, 0X5C, 0XE2, 0XCA,
-  0XB8, 0X7D, 0X6E, 0XD5, 0X6D, 0XD2, 0XDD, 0X7B, 0X85, 0X02, 0X02, 0X78,
-  0X5C, 0X4D, 0X7F, 0XBE, 0X05, 0XEB, 0X60, 0X9D, 0XA3, 0XA8, 0XF8, 0X6E,
-  0X6F, 0X2D, 0X9B, 0X5A, 0X5F, 0XA9, 0XD4, 0X38, 0X15, 0XA9, 0X2B, 0XA1,
-  0X0D, 0X08, 0X4B, 0XD9, 0XB8, 0X79, 0X42, 0XC4, 0X59, 0XCA, 0X00, 0X47,
-  0X83, 0X96, 0X90, 0X31, 0X71, 0X43, 0XF5, 0XFB, 0X0F, 0X77, 0X3E, 0X14,
-  0X17, 0X95, 0X2F, 0X01, 0X5D, 0XEB, 0X7E, 0XE9, 0XE3, 0X71, 0X77, 0XB1,
-  0X2F, 0XFD, 0X70, 0XC0, 0XD6, 0X4E, 0X2E, 0X04, 0X89, 0X6F, 0X95, 0XE6,
-  0XAF, 0X18, 0X25, 0X0A, 0X3B, 0X76, 0X18, 0XA9, 0X6E, 0X94, 0X2B, 0X4E,
-  0X0F, 0X27, 0XA6, 0XFA, 0XB1, 0X2E, 0X0E, 0X8E, 0XE7, 0X9B, 0X02, 0X51,
-  0X3E, 0X78, 0X1E, 0XE9, 0X8C, 0X95, 0X54, 0XAF, 0X97, 0X1A, 0X33, 0XB4,
-  0XE4, 0X4C, 0X08, 0XAF, 0XD4, 0X6B, 0XE4, 0XBA, 0X5F, 0X2A, 0X21, 0X13,
-  0X0C, 0X98, 0X90, 0X37, 0XA9, 0X44, 0XEB, 0X28, 0X15, 0X24, 0X75, 0XF2,
-  0X38, 0XE7, 0X27, 0X44, 0X37, 0XA8, 0X38, 0X39, 0X48, 0X83, 0XDD, 0X6D,
-  0X11, 0XBF, 0X33, 0XAF, 0X4C, 0X5C, 0XBA, 0X2A, 0X5F, 0XC6, 0X59, 0XD6,
-  0X1A, 0X27, 0XE0, 0X06, 0X67, 0X51, 0XF7, 0X12, 0X78, 0X0F, 0X06, 0X28,
-  0X2A, 0XAC, 0XDC, 0X11, 0XD7, 0XF4, 0X12, 0XDE, 0X15, 0XBE, 0XA8, 0X3C,
-  0X60, 0XD4, 0X38, 0XF0, 0X55, 0XDE, 0X12, 0XC3, 0X3D, 0X7C, 0X9F, 0X0C,
-  0X6A, 0XF1, 0X20, 0X26, 0X75, 0XAA, 0X33, 0X37, 0X98, 0X89, 0XAD, 0XF7,
-  0X02, 0X3B, 0X18, 0X5A, 0X48, 0XD0, 0X94, 0XCB, 0X47, 0X33, 0X1C, 0X70,
-  0X5D, 0XCE, 0XDE, 0XEE, 0X3E, 0XFD, 0XAA, 0X72, 0XB8, 0XDE, 0X21, 0X6C,
-  0XA0, 0X01, 0X4F, 0X7F, 0X81, 0XCE, 0X8C, 0X5E, 0X41, 0XB2, 0X18, 0X50,
-  0X26, 0XBA, 0X70, 0XB8, 0XDC, 0XC8, 0X31, 0X96, 0X9A, 0X13, 0X13, 0X81,
-  0XAE, 0XAA, 0X9F, 0X08, 0XF4, 0XAC, 0X6D, 0X14, 0X98, 0X77, 0X0A, 0X55,
-  0XB6, 0X23, 0X2E, 0X9C, 0X7C, 0XE8, 0XDC, 0X66, 0X3F, 0X2C, 0X35, 0X4F,
-  0X53, 0XB2, 0X82, 0X88, 0XD0, 0X34, 0X2D, 0X42, 0X37, 0X51, 0X7B, 0X66,
-  0XD6, 0X82, 0XCA, 0XEE, 0X22, 0X46, 0X1E, 0X05, 0X03, 0XA7, 0X75, 0X7F,
-  0XE0, 0XF1, 0X82, 0XE4, 0X71, 0X24, 0X2D, 0X84, 0X34, 0X47, 0XB7, 0X40,
-  0X7C, 0X43, 0X9A, 0X68, 0X8A, 0X5E, 0X7B, 0X1D, 0XD1, 0XAD, 0X0D, 0X14,
-  0X76, 0X1E, 0XD0, 0X1B, 0XB1, 0XAE, 0X89, 0X9B, 0X87, 0X3D, 0XFF, 0X9E,
-  0X50, 0XD6, 0XE4, 0XD1, 0X77, 0X5C, 0X76, 0X40, 0X8E, 0XF7, 0X59, 0X74,
-  0X76, 0XCD, 0X11, 0X01, 0X0F, 0XEA, 0XD5, 0X8A, 0XEF, 0X01, 0XE1, 0X65,
-  0X6D, 0X40, 0X35, 0X40, 0XEF, 0X4F, 0X50, 0X24, 0X4A, 0X18, 0X3F, 0X4E,
-  0X74, 0X5E, 0X21, 0X13, 0X45, 0X35, 0XA1, 0X6E, 0XFF, 0X2D, 0X65, 0XCE,
-  0X48, 0XF1, 0XB4, 0X46, 0XC0, 0XF0, 0XA1, 0X58, 0X39, 0X7A, 0X68, 0X99,
-  0X0F, 0X7A, 0XDE, 0XD4, 0XC3, 0XEC, 0X5C, 0XBD, 0X9A, 0X9B, 0XCC, 0X65,
-  0XB1, 0X77, 0XE0, 0X24, 0XC0, 0X62, 0XE7, 0X83, 0X0B, 0X9F, 0XE5, 0XE3,
-  0XE3, 0XB8, 0X13, 0X00, 0X62, 0X85, 0X2A, 0X20, 0XF0, 0XDE, 0X56, 0XFB,
-  0X85, 0X96, 0X41, 0XAE, 0X82, 0X43, 0X93, 0XDF, 0X99, 0X17, 0XBF, 0XC4,
-  0XDC, 0X7F, 0X31, 0XCD, 0X8C, 0X4E, 0X50, 0XD8, 0X5A, 0XD1, 0XBC, 0XAD,
-  0X53, 0XE7, 0XC6, 0X97, 0X7E, 0X89, 0XEA, 0X8A, 0X31, 0X97, 0X19, 0X96,
-  0XD0, 0X17, 0XBA, 0X57, 0XDD, 0XA8, 0X2C, 0X38, 0X6C, 0XAC, 0XFE, 0X3B,
-  0XB1, 0X7C, 0X05, 0X32, 0X78, 0XFE, 0XD4, 0XF5, 0X9E, 0X3C, 0X73, 0X71,
-  0X41, 0X5A, 0X28, 0X43, 0XFC, 0X2D, 0X43, 0XC2, 0XDE, 0X9E, 0XC5, 0X02,
-  0X72, 0X3A, 0XF5, 0XE8, 0XD3, 0X43, 0X49, 0XCB, 0XA3, 0X51, 0X39, 0X1B,
-  0XB3, 0X77, 0X86, 0X15, 0XB8, 0XEC, 0XC8, 0X25, 0X96, 0X14, 0X9A, 0X06,
-  0X3E, 0XE3, 0XDC, 0X56, 0X49, 0X43, 0XA9, 0X24, 0XC8, 0X2A, 0X01, 0XBC,
-  0X45, 0X80, 0XFA, 0X35, 0XB8, 0X63, 0XEC, 0X11, 0X4B, 0X2E, 0X91, 0X5E,
-  0XB6, 0X77, 0XC1, 0X1B, 0X4E, 0XDE, 0X44, 0X38, 0XB9, 0XBA, 0XBD, 0X44,
-  0X79, 0X12, 0XF0, 0X44, 0XF7, 0XD2, 0X85, 0XF7, 0XDE, 0XC0, 0XCC, 0X35,
-  0X7F, 0XA3, 0XBB, 0X6C, 0XF8, 0XC6, 0X8D, 0XEE, 0X4D, 0XE3, 0X04, 0XA6,
-  0X36, 0X0A, 0X66, 0XED, 0X19, 0XC3, 0X4D, 0X09, 0X37, 0XCF, 0XA0, 0X2C,
-  0X31, 0XC1, 0XBB, 0X19, 0XC8, 0X84, 0XB4, 0X33, 0X9B, 0XEC, 0XF3, 0X17,
-  0X36, 0XF8, 0XA6, 0X7B, 0X63, 0XC3, 0X03, 0X9B, 0XAC, 0X78, 0XBA, 0X83,
-  0X2B, 0XC2, 0X87, 0X97, 0X3C, 0XA1, 0XDA, 0X76, 0XDA, 0XFA, 0X3E, 0X6A,
-  0XD6, 0X9F, 0XBF, 0XE6, 0X66, 0X01, 0XAC, 0X52, 0XBD, 0X61, 0XC7, 0X24,
-  0XCE, 0X0F, 0X73, 0XA5, 0X4F, 0X9B, 0XDD, 0X5E, 0X80, 0X6F, 0XD3, 0XF3,
-  0X87, 0X49, 0XF2, 0X04, 0XB9, 0X44, 0X71, 0X97, 0XAB, 0XC4, 0XF1, 0X34,
-  0X36, 0XD2, 0X72, 0X16, 0X9E, 0X8C, 0X2C, 0XB3, 0XDE, 0X61, 0XD1, 0X9C,
-  0XF2, 0X43, 0X86, 0X7C, 0X03, 0XC1, 0X95, 0XD7, 0XFA, 0X72, 0X7A, 0XE0,
-  0XFB, 0X76, 0XAF, 0X0E, 0X6E, 0XB2, 0X4B, 0X75, 0X12, 0X16, 0XCA, 0XD9,
-  0X1C, 0X68, 0XE8, 0X47, 0X5E, 0X7B, 0X52, 0XAB, 0X1D, 0XE8, 0XD3, 0XE5,
-  0XF1, 0XAA, 0X9D, 0XC4, 0XB8, 0X70, 0X39, 0X62, 0XF5, 0X29, 0X0E, 0X83,
-  0X07, 0X3C, 0X6E, 0X45, 0X54, 0X14, 0X17, 0X48, 0XCD, 0X70, 0X1B, 0XEE,
-  0X70, 0X6B, 0X9F, 0X29, 0XF0, 0X53, 0XE1, 0X43, 0X17, 0X6B, 0X76, 0X3D,
-  0X65, 0X23, 0XAA, 0X00, 0X2C, 0X53, 0X33, 0X0A, 0XD6, 0X85, 0XF0, 0X25,
-  0X77, 0XFE, 0X16, 0X31, 0X8A, 0X0C, 0XE3, 0XD8, 0XCF, 0X3F, 0XFF, 0X59,
-  0XDE, 0XA3, 0X34, 0X15, 0X87, 0XB4, 0X2D, 0X1E, 0X67, 0X54, 0XF5, 0X5B,
-  0XF2, 0X31, 0X19, 0XC4, 0X43, 0X04, 0X9D, 0X6A, 0XCD, 0XCA, 0XD8, 0X1C,
-  0X78, 0XB5, 0X7A, 0X5C, 0XEF, 0X7E, 0X4E, 0X49, 0X1F, 0X3B, 0X93, 0X7A,
-  0X3D, 0XFA, 0X39, 0XA8, 0X55, 0X86, 0X62, 0X1D, 0XFE, 0XE3, 0XF0, 0X6B,
-  0X07, 0X29, 0X55, 0XA7, 0X29, 0XE1, 0X9B, 0X50, 0XAB, 0XC4, 0X88, 0X05,
-  0X38, 0XFE, 0X1C, 0XF5, 0XED, 0X76, 0XDB, 0X0E, 0X63, 0XDB, 0XD3, 0X06,
-  0XEE, 0X98, 0X2C, 0X35, 0X90, 0XCA, 0X65, 0X5C, 0X73, 0X56, 0X67, 0X8C,
-  0XB0, 0X91, 0XA7, 0XD7, 0XFC, 0X0C, 0X4A, 0X75, 0X33, 0XB8, 0X2F, 0X77,
-  0XB3, 0X1A, 0X21, 0XA7, 0X2A, 0X92, 0X5A, 0X69, 0X4B, 0X01, 0X3D, 0X3F,
-  0X79, 0X5E, 0X49, 0XF7, 0X7A, 0XB0, 0X07, 0XFC, 0X3C, 0X48, 0X37, 0XCB,
-  0X3C, 0XB9, 0X9B, 0XC2, 0X15, 0XC7, 0X3B, 0X2B, 0XD5, 0XEE, 0XD4, 0XA5,
-  0XB6, 0X72, 0XF0, 0X31, 0XA7, 0XB7, 0X1C, 0XAF, 0XE0, 0X41, 0X60, 0X09,
-  0X64, 0XE7, 0X06, 0XDB, 0XE6, 0X92, 0X05, 0XE8, 0X67, 0X28, 0X1A, 0XEE,
-  0XD9, 0XFB, 0XB1, 0XE1, 0XA7, 0X01, 0XBF, 0X88, 0X1C, 0X38, 0XD4, 0XF1,
-  0X74, 0X15, 0X4D, 0X9D, 0X9C, 0XFE, 0X43, 0X61, 0X58, 0XBD, 0X27, 0XA8,
-  0X06, 0X16, 0XBE, 0XF5, 0X57, 0XD1, 0X61, 0X08, 0XBC, 0XAE, 0X64, 0XCE,
-  0X22, 0X6D, 0X46, 0X61, 0X35, 0X6B, 0XB6, 0X1D, 0X5A, 0X34, 0X18, 0XD6,
-  0X04, 0X00, 0XF6, 0X84, 0X49, 0XC7, 0X4D, 0X39, 0XDE, 0XD4, 0X61, 0X02,
-  0XC2, 0X19, 0XB8, 0X6A, 0X5A, 0X69, 0X6B, 0X06, 0XCE, 0X8C, 0XF3, 0X29,
-  0X60, 0XB3, 0X18, 0X0A, 0XB2, 0X1A, 0XF3, 0X71, 0X6F, 0X99, 0X0E, 0X74,
-  0X71, 0X2E, 0XD6, 0X30, 0XCF, 0XAE, 0X6F, 0X18, 0X86, 0X78, 0XC5, 0X4D,
-  0X46, 0X44, 0X95, 0X68, 0XF0, 0XD9, 0X1B, 0XE1, 0X5C, 0X78, 0X18, 0XCB,
-  0XC0, 0X25, 0X8C, 0X9D, 0X6D, 0X15, 0XFA, 0X80, 0X3E, 0X55, 0XDA, 0X23,
-  0X13, 0X1C, 0XE6, 0X03, 0X0A, 0X3C, 0X33, 0X13, 0XEA, 0X23, 0X60, 0XEB,
-  0X4D, 0X06, 0X8F, 0XEF, 0X9B, 0X1F, 0X77, 0X1B, 0XDF, 0XD7, 0X10, 0XC6,
-  0XBE, 0XC3, 0X7C, 0XA2, 0XDF, 0XF3, 0X75, 0X80, 0XAA, 0XFD, 0XFE, 0X4A,
-  0X94, 0XD2, 0X5C, 0X89, 0XEC, 0XA6, 0X83, 0X93, 0X06, 0X94, 0X33, 0X1F,
-  0X02, 0XF2, 0X3A, 0XAB, 0X57, 0X4D, 0XB5, 0XA3, 0X8F, 0XDA, 0XB4, 0XA0,
-  0X64, 0XF0, 0XA9, 0XC4, 0XA7, 0X0B, 0X01, 0X0E, 0X17, 0XB4, 0X5D, 0X3B,
-  0X7E, 0XD5, 0X82, 0X2B, 0X24, 0X25, 0XD9, 0XEC, 0X2E, 0X7D, 0X1B, 0X29,
-  0X05, 0X6B, 0XEE, 0X8B, 0X4D, 0X66, 0XCE, 0X27, 0XCA, 0X8B, 0X46, 0X45,
-  0X54, 0X63, 0X13, 0X3D, 0X8F, 0X2E, 0XED, 0XAA, 0XC2, 0X11, 0X92, 0X7D,
-  0XC7, 0X9D, 0XE3, 0X32, 0XFA, 0X09, 0X87, 0XDC, 0X85, 0X6E, 0X98, 0XD7,
-  0XE1, 0X86, 0X69, 0XD7, 0X53, 0X77, 0X73, 0X86, 0X4C, 0X01, 0X8E, 0X2C,
-  0X3E, 0X45, 0X4F, 0X8D, 0XE1, 0X2A, 0X6D, 0X58, 0XEF, 0X21, 0XD0, 0XEC,
-  0XE5, 0X07, 0X25, 0X47, 0X5A, 0X52, 0XBC, 0XF2, 0X78, 0XF2, 0XC3, 0XEE,
-  0X92, 0X7B, 0XC8, 0XCF, 0X7C, 0XC9, 0X80, 0XD5, 0XEE, 0XE8, 0X31, 0X6C,
-  0X77, 0X3C, 0XB5, 0X63, 0X0D, 0X49, 0XD6, 0X14, 0XDF, 0X87, 0XE9, 0X12,
-  0XA2, 0X3E, 0X10, 0X5B, 0X4B, 0XAF, 0X06, 0X9B, 0X8B, 0X20, 0XEE, 0X44,
-  0XEE, 0XA3, 0XF0, 0XEF, 0XD7, 0XCB, 0XE3, 0XDE, 0X55, 0X17, 0X70, 0X58,
-  0XEA, 0X97, 0X63, 0X88, 0X7A, 0XFE, 0X95, 0XB9, 0X70, 0X6E, 0X20, 0X01,
-  0X1C, 0X77, 0X97, 0X5B, 0X36, 0X9C, 0X69, 0XF4, 0X92, 0X89, 0X6F, 0XB6,
-  0XD7, 0X48, 0XFE, 0X28, 0X44, 0X8E, 0X27, 0XB8, 0XE9, 0XE7, 0X69, 0XDF,
-  0X20, 0X7A, 0X24, 0X6B, 0X8C, 0X04, 0X86, 0XDA, 0X85, 0XCC, 0XB7, 0X28,
-  0X8B, 0X9E, 0XA6, 0XC0, 0X19, 0X76, 0XE9, 0XDA, 0X57, 0X20, 0XC0, 0X2F,
-  0X0B, 0X18, 0X74, 0X67, 0X72, 0XDF, 0XB0, 0X76, 0XA9, 0XEF, 0XF7, 0XD6,
-  0X55, 0XE1, 0XC6, 0XDC, 0XAF, 0X87, 0XE1, 0X41, 0X87, 0XF3, 0XFA, 0X42,
-  0X25, 0X56, 0XEC, 0X4E, 0X73, 0X43, 0X0E, 0X71, 0X74, 0X12, 0X59, 0X2B,
-  0XD7, 0X85, 0X93, 0X64, 0X85, 0X9A, 0X39, 0XF7, 0XC9, 0XF3, 0XEF, 0XD5,
-  0XE4, 0X8F, 0X20, 0XC4, 0XD0, 0X86, 0XE2, 0XDD, 0XF5, 0XCA, 0X6A, 0XF6,
-  0XB2, 0X38, 0X19, 0XE2, 0X70, 0X5B, 0X5C, 0X39, 0XB1, 0XAE, 0X58, 0X3F,
-  0X1A, 0X75, 0X98, 0XA3, 0X28, 0X8D, 0X33, 0X27, 0XA7, 0X34, 0X3B, 0X4E,
-  0XB1, 0X6A, 0X29, 0X73, 0XBA, 0XC3, 0XDA, 0XF6, 0X65, 0X8F, 0X17, 0X1F,
-  0X3C, 0X27, 0XFC, 0X7B, 0X41, 0XBD, 0X5B, 0X84, 0X0A, 0X22, 0XD5, 0X9A,
-  0X04, 0X6F, 0X27, 0X79, 0XA0, 0X2B, 0X50, 0X00, 0X79, 0XFE, 0X46, 0X60,
-  0X7D, 0X20, 0X15, 0X8D, 0XE3, 0XCB, 0X3D, 0XC7, 0XC5, 0XD8, 0X0B, 0XDE,
-  0X86, 0X3F, 0XFB, 0XBC, 0X5A, 0XFA, 0XA6, 0X83, 0X96, 0X79, 0XF0, 0XEA,
-  0X2D, 0XB4, 0XAD, 0XB7, 0XB8, 0X29, 0X92, 0X90, 0X53, 0X5F, 0X58, 0XC6,
-  0X7C, 0XC3, 0XCD, 0XF1, 0X4F, 0X47, 0XBA, 0XAE, 0X14, 0X32, 0X8D, 0XED,
-  0X88, 0X1C, 0XE2, 0X0D, 0X38, 0X32, 0X33, 0XCB, 0X4B, 0X7F, 0XD3, 0X96,
-  0XEB, 0X5E, 0X7B, 0XBC, 0X37, 0X9F, 0X10, 0X52, 0X59, 0XDD, 0X1B, 0XE2,
-  0XE6, 0XF3, 0X25, 0X4E, 0X7C, 0X88, 0X4B, 0XD6, 0X20, 0XBA, 0XB7, 0X71,
-  0X9D, 0X64, 0XF7, 0X85, 0X5E, 0X85, 0X8E, 0XCE, 0XC7, 0XD1, 0XD0, 0XBA,
-  0X52, 0XC8, 0X47, 0X8F, 0X84, 0XBE, 0X54, 0XFB, 0XB4, 0XFE, 0X22, 0XCB,
-  0X98, 0XC5, 0X64, 0XB7, 0X71, 0X6C, 0X15, 0X29, 0XEE, 0X1B, 0X7F, 0X5B,
-  0X32, 0X3E, 0X18, 0X98, 0X55, 0X7F, 0X7C, 0XC7, 0XE1, 0XCA, 0X40, 0XB9,
-  0XD4, 0XCE, 0X69, 0X34, 0XF9, 0X29, 0XDE, 0X81, 0X23, 0X25, 0X42, 0XD0,
-  0XB5, 0X7C, 0X2D, 0XF1, 0X8D, 0X09, 0X59, 0X64, 0XFC, 0X2A, 0X65, 0X1B,
-  0X92, 0XEB, 0X98, 0XF4, 0XB8, 0X40, 0X87, 0XCC, 0X33, 0X76, 0XF6, 0X32,
-  0X08, 0XDE, 0XAF, 0X39, 0XAC, 0X3D, 0XC7, 0X37, 0X0B, 0XD3, 0XAF, 0X37,
-  0XA2, 0X12, 0X7C, 0XEF, 0X33, 0XB6, 0XAF, 0X4A, 0XB3, 0X67, 0X3E, 0XF2,
-  0XEA, 0X03, 0X61, 0X23, 0XBB, 0XD3, 0X8B, 0XBC, 0X64, 0X51, 0X45, 0X8D,
-  0XF6, 0X10, 0XCC, 0X50, 0X40, 0XCA, 0X0E, 0X08, 0X99, 0X81, 0XD7, 0X1B,
-  0X8C, 0X03, 0X73, 0X78, 0XE8, 0XA2, 0X14, 0XBD, 0XCB, 0X62, 0XB5, 0X49,
-  0X41, 0XD4, 0X46, 0X55, 0X5E, 0XA4, 0X7B, 0X9A, 0X5A, 0XEB, 0X65, 0X1B,
-  0XF5, 0X02, 0X45, 0XE9, 0XE5, 0X55, 0XBC, 0XA0, 0XD8, 0XB2, 0XC3, 0X46,
-  0XFC, 0X9D, 0XD5, 0XD6, 0X53, 0X8C, 0X41, 0X93, 0X20, 0XBF, 0X64, 0X45,
-  0X43, 0X31, 0X85, 0X5A, 0X9A, 0X5E, 0X7B, 0X20, 0XED, 0X50, 0XD5, 0X1B,
-  0XF4, 0X36, 0X15, 0XC1, 0X08, 0X71, 0X88, 0X89, 0X79, 0XCE, 0X3E, 0XB1,
-  0XB2, 0X78, 0X4A, 0X2A, 0XBB, 0X06, 0XAB, 0X3B, 0X93, 0X2C, 0X72, 0XE5,
-  0X47, 0XBE, 0XF7, 0XDA, 0X20, 0XF9, 0X45, 0X5F, 0X50, 0X81, 0XD9, 0XC6,
-  0XE2, 0XA2, 0X8C, 0XF0, 0X05, 0X62, 0XE0, 0X2B, 0XEF, 0X0B, 0XA9, 0XCD,
-  0X99, 0X30, 0XC3, 0X8A, 0X27, 0XD9, 0X91, 0XF4, 0X53, 0X7E, 0XB3, 0X5A,
-  0X12, 0XB9, 0XC5, 0X19, 0XDB, 0XCF, 0X93, 0X4B, 0X02, 0XDF, 0X38, 0X1F,
-  0XC7, 0X56, 0X8E, 0XB0, 0XEC, 0X07, 0X68, 0X52, 0X2E, 0X79, 0X0B, 0X3D,
-  0X0A, 0X15, 0XA6, 0XA8, 0X86, 0XEB, 0X20, 0X3F, 0XDF, 0X4C, 0XCA, 0X8D,
-  0X21, 0X5D, 0X63, 0XDD, 0X37, 0X68, 0X70, 0X99, 0X61, 0XB5, 0X26, 0XEA,
-  0X15, 0XC4, 0XB6, 0X94, 0XB6, 0X44, 0X49, 0X4F, 0X6C, 0XE2, 0X6A, 0X14,
-  0XCB, 0XC1, 0X8E, 0XD8, 0XB9, 0XE1, 0X7C, 0XA1, 0X52, 0XF9, 0XA7, 0X30,
-  0XE5, 0XB5, 0X3F, 0XC6, 0X97, 0X59, 0XB7, 0X6F, 0X5C, 0XC0, 0X29, 0X53,
-  0XA2, 0XA7, 0X9C, 0X05, 0XD0, 0XEA, 0X04, 0X76, 0X9B, 0X37, 0XBF, 0X48,
-  0XEB, 0X0F, 0X37, 0XE1, 0X96, 0X05, 0X47, 0XAB, 0X83, 0X9C, 0X96, 0XC9,
-  0X19, 0X00, 0X9D, 0X37, 0XCD, 0X53, 0X4B, 0X8E, 0X8D, 0XFE, 0XD2, 0X1D,
-  0XB6, 0XF0, 0XB8, 0XF3, 0X74, 0X8D, 0XD5, 0XD5, 0X3B, 0X6C, 0X6E, 0X2D,
-  0X4C, 0XC7, 0XB6, 0XCB, 0X55, 0X93, 0X92, 0X29, 0X53, 0XCE, 0XBC, 0X99,
-  0X06, 0X07, 0XE1, 0XFA, 0X44, 0X31, 0X22, 0X93, 0X3F, 0XA9, 0XE2, 0XC5,
-  0X8C, 0X29, 0XB6, 0X8D, 0X78, 0X85, 0X6D, 0X6B, 0XC3, 0X72, 0X27, 0X9E,
-  0XB9, 0X5E, 0X74, 0X36, 0X0D, 0X09, 0XA3, 0XDF, 0X00, 0X8A, 0X19, 0X55,
-  0X74, 0X77, 0XAD, 0X0A, 0XE3, 0XE1, 0X59, 0X1C, 0XC1, 0XE6, 0XA0, 0X1C,
-  0X3D, 0X10, 0XAE, 0XE8, 0X47, 0X42, 0X41, 0X05, 0X42, 0XD0, 0XB7, 0X00,
-  0X10, 0XA7, 0X12, 0X49, 0X12, 0XC0, 0X85, 0X55, 0X31, 0XA2, 0XB3, 0X66,
-  0X6E, 0XE9, 0X1B, 0X4F, 0X2B, 0XB1, 0X57, 0XAF, 0X39, 0XE6, 0X47, 0XE8,
-  0XE3, 0XF9, 0XF6, 0XEA, 0X89, 0X39, 0XE9, 0X39, 0XD9, 0X75, 0XA6, 0X8F,
-  0XD8, 0XDF, 0X6E, 0XD9, 0XB0, 0X97, 0X25, 0X33, 0X82, 0XDB, 0X7D, 0XEA,
-  0XAB, 0XAC, 0X6E, 0XFC, 0X55, 0X12, 0X53, 0X91, 0X35, 0XB5, 0XA5, 0X12,
-  0XEF, 0X6D, 0XF7, 0X21, 0XEE, 0XC3, 0X9C, 0X4E, 0X24, 0X7C, 0X29, 0XAE,
-  0X9B, 0X5A, 0XC6, 0XF5, 0X1B, 0X56, 0X9D, 0X46, 0X44, 0X56, 0X64, 0XD1,
-  0X2B, 0XAF, 0XAD, 0X4F, 0XD6, 0XF0, 0XD3, 0X97, 0XC8, 0X64, 0XB1, 0X69,
-  0X4C, 0X7E, 0XAD, 0XE6, 0XC6, 0XA7, 0X9D, 0XCC, 0X0D, 0X59, 0X43, 0X77,
-  0XBC, 0XD4, 0XA5, 0X89, 0X2E, 0XB4, 0X0F, 0X5E, 0XD6, 0X00, 0X6E, 0XFB,
-  0XC5, 0X8B, 0XBF, 0XCB, 0XA5, 0XB3, 0X8B, 0X87, 0XF4, 0XAB, 0XE2, 0X50,
-  0XD9, 0X5A, 0XA5, 0XD0, 0X9D, 0X17, 0X9C, 0X78, 0X98, 0XE6, 0XDF, 0X8D,
-  0X0E, 0XE0, 0X3D, 0X0E, 0XE0, 0X4C, 0X0D, 0X48, 0X77, 0X31, 0X9C, 0X7A,
-  0X9C, 0X98, 0XCC, 0X78, 0XDF, 0X4A, 0XFD, 0X09, 0X48, 0X4C, 0X44, 0X39,
-  0X21, 0XDF, 0XDA, 0X3C, 0X59, 0X3F, 0XFD, 0X97, 0XBF, 0X47, 0XF3, 0X01,
-  0X8E, 0XB7, 0X9C, 0XF6, 0XB3, 0X4C, 0XB6, 0XE2, 0X58, 0XE3, 0XE6, 0X3A,
-  0X1F, 0XEB, 0XD6, 0X5A, 0XA3, 0X21, 0XFD, 0X36, 0XD8, 0XBE, 0XAF, 0XFB,
-  0X55, 0X13, 0X9A, 0X92, 0X00, 0X98, 0XF8, 0XBD, 0X4F, 0XD4, 0XAD, 0XB0,
-  0X5E, 0X04, 0XE0, 0X23, 0XD1, 0X1A, 0X98, 0X12, 0X35, 0X5C, 0X07, 0X53,
-  0X9B, 0X3B, 0X17, 0X98, 0XBD, 0X33, 0X0C, 0X8A, 0X9D, 0X39, 0X4E, 0X5A,
-  0X7B, 0X85, 0XC6, 0X76, 0X6C, 0XA6, 0XFD, 0X2D, 0X1F, 0XB5, 0XBE, 0XD2,
-  0XAE, 0X34, 0XF7, 0X21, 0X97, 0XEF, 0X9E, 0X73, 0X1F, 0X66, 0XD3, 0X7F,
-  0X5B, 0X35, 0XC1, 0XB3, 0X0C, 0XE5, 0X4E, 0X99, 0XC8, 0XA2, 0X70, 0X84,
-  0X51, 0XD2, 0X11, 0X77, 0X13, 0XD8, 0X2B, 0X46, 0X92, 0XB7, 0X4C, 0X40,
-  0X1E, 0XC9, 0XD8, 0XF1, 0X9F, 0X86, 0XA9, 0X5B, 0X62, 0X2F, 0XA7, 0XD5,
-  0XA4, 0X2D, 0XD9, 0X2D, 0X3E, 0X80, 0XE0, 0X2F, 0X01, 0XC2, 0XAA, 0X38,
-  0XCA, 0X32, 0X0A, 0XCD, 0X96, 0X1B, 0XBF, 0X14, 0XC7, 0X13, 0X36, 0X2C,
-  0X89, 0XA4, 0X43, 0X52, 0X26, 0XCF, 0X3B, 0X13, 0XA4, 0X8C, 0X74, 0X3D,
-  0XBC, 0XE5, 0XF0, 0XEA, 0X91, 0X77, 0XE5, 0X8B, 0XA6, 0X09, 0X7F, 0X52,
-  0X70, 0XD3, 0XF3, 0XCB, 0X9A, 0XD2, 0X99, 0XB9, 0XBD, 0XD5, 0X51, 0X59,
-  0X17, 0X7A, 0X94, 0X97, 0X75, 0X07, 0X73, 0X1F, 0X4C, 0X59, 0XAB, 0XAE,
-  0XBB, 0X65, 0X18, 0X46, 0X8E, 0X58, 0XEF, 0X5A, 0X50, 0XE0, 0XC3, 0X6D,
-  0X7C, 0XCD, 0XAB, 0X80, 0X19, 0XA6, 0X63, 0XF3, 0X88, 0XF9, 0X96, 0XFA,
-  0X78, 0X89, 0X5F, 0XBF, 0X54, 0X00, 0X51, 0X78, 0XD5, 0X82, 0XE4, 0X91,
-  0XB7, 0X62, 0X29, 0X82, 0XEA, 0X5C, 0X43, 0X8C, 0XBA, 0X0D, 0XC6, 0X99,
-  0XCD, 0X99, 0X05, 0XF4, 0XE6, 0X2C, 0X14, 0X72, 0XE4, 0X29, 0X61, 0XED,
-  0XA5, 0X61, 0XDA, 0XBC, 0XA5, 0XDC, 0XF6, 0X06, 0X2B, 0X2D, 0X0D, 0X1B,
-  0X50, 0X02, 0X6E, 0X4E, 0X1F, 0XB2, 0XFA, 0XCA, 0X2B, 0XD7, 0XE1, 0X41,
-  0X8D, 0XD5, 0X18, 0XEB, 0XDA, 0XE1, 0X2B, 0XDF, 0X25, 0XA9, 0XAF, 0XAE,
-  0XB0, 0X7C, 0XD5, 0X66, 0XE9, 0X39, 0XEB, 0X26, 0X9E, 0XF2, 0XA1, 0XF2,
-  0X6F, 0X7B, 0X14, 0XA3, 0XA9, 0X15, 0X14, 0X86, 0XDC, 0XC6, 0X6A, 0X55,
-  0X16, 0X21, 0X33, 0X8B, 0X9E, 0X81, 0X36, 0XE9, 0XBD, 0X53, 0XAF, 0XF2,
-  0XC3, 0X8E, 0X4F, 0X7E, 0XD7, 0X7E, 0XEE, 0X5C, 0X8F, 0X36, 0XBB, 0XA3,
-  0XAE, 0X23, 0XF2, 0X23, 0X54, 0X51, 0X4D, 0XB4, 0XC2, 0X8F, 0X8F, 0XD9,
-  0X9C, 0XC5, 0XF0, 0XD3, 0XE3, 0XD6, 0XC8, 0XAF, 0XB5, 0X60, 0X0D, 0X1F,
-  0X49, 0X8C, 0X5F, 0X80, 0X53, 0X3C, 0XD1, 0X77, 0X21, 0X83, 0XF2, 0X6A,
-  0X37, 0X25, 0X43, 0XF9, 0XE8, 0XBA, 0XF5, 0X82, 0XA5, 0X1D, 0X34, 0X07,
-  0X87, 0X6F, 0X98, 0XAC, 0XD5, 0X9C, 0X95, 0X31, 0X67, 0XD3, 0X94, 0XC6,
-  0XBE, 0XA8, 0X1A, 0X37, 0X62, 0XF0, 0XD4, 0XC8, 0XCD, 0XEA, 0X83, 0XAA,
-  0X4F, 0X20, 0XA4, 0X22, 0XAD, 0XA3, 0X25, 0X73, 0XF8, 0X6E, 0XEF, 0XBE,
-  0X16, 0X69, 0XB4, 0X66, 0XD5, 0X3D, 0X78, 0XA4, 0X7C, 0X2F, 0XA7, 0X47,
-  0X8C, 0XEA, 0X86, 0X19, 0X10, 0X5B, 0XD5, 0X7F, 0X85, 0X15, 0X5D, 0X77,
-  0X51, 0X91, 0X2F, 0X40, 0XEB, 0X5E, 0XA5, 0XF3, 0X92, 0XBA, 0X96, 0X55,
-  0XCA, 0X62, 0X0C, 0X54, 0X1A, 0X92, 0X46, 0XAB, 0XD3, 0XFC, 0X96, 0XFB,
-  0X9E, 0X46, 0X65, 0X34, 0XB8, 0XCD, 0X70, 0X5D, 0X09, 0X95, 0XBB, 0XC4,
-  0X40, 0X8D, 0XDF, 0XAB, 0X4F, 0X83, 0X06, 0X8F, 0XEA, 0X8C, 0X55, 0X35,
-  0XBA, 0XFB, 0X9D, 0XF0, 0X75, 0XA2, 0X83, 0XC0, 0X2E, 0X15, 0X3F, 0X3B,
-  0X72, 0XA4, 0X84, 0X27, 0X93, 0X07, 0X19, 0X69, 0XD9, 0X51, 0X7E, 0XA0,
-  0X14, 0X0C, 0XA0, 0X12, 0X78, 0X75, 0XF8, 0XB1, 0X58, 0X4C, 0X4C, 0XAF,
-  0XF0, 0X60, 0XDC, 0XC5, 0XD2, 0XFB, 0XC3, 0XB3, 0X49, 0XB7, 0X96, 0X0C,
-  0XB5, 0XD0, 0XCD, 0XC2, 0XFB, 0XAD, 0X27, 0XC3, 0XF7, 0XA1, 0X8D, 0X26,
-  0X5B, 0XF9, 0X8C, 0X40, 0X0A, 0X51, 0X17, 0XB1, 0X7C, 0XBA, 0XF8, 0XD0,
-  0XE2, 0X0F, 0XCB, 0X30, 0XE8, 0X38, 0X2E, 0XB5, 0X37, 0X21, 0X5C, 0XEA,
-  0X80, 0X53, 0XE2, 0XC7, 0X45, 0X49, 0XDA, 0XD7, 0XFB, 0X53, 0X06, 0X2E,
-  0XCE, 0X30, 0XD8, 0X8A, 0X79, 0X28, 0X60, 0XAC, 0X31, 0XB1, 0XEE, 0XA5,
-  0XF2, 0XE6, 0X5D, 0X35, 0XE3, 0XB9, 0XEF, 0X3D, 0X1E, 0X97, 0X13, 0XA3,
-  0X16, 0X35, 0XE6, 0XAA, 0X50, 0X75, 0X65, 0X45, 0XA9, 0X8F, 0X84, 0X67,
-  0X35, 0X05, 0X89, 0XD9, 0XE2, 0XBD, 0XA1, 0X45, 0X88, 0X3E, 0X49, 0X4F,
-  0X93, 0XCC, 0XE8, 0X03, 0X6C, 0XF3, 0X54, 0X2F, 0X4E, 0XC2, 0X59, 0XB2,
-  0X21, 0X5E, 0XB7, 0X95, 0X75, 0XF7, 0XEE, 0XF6, 0X97, 0X86, 0X5E, 0X54,
-  0XE4, 0XF7, 0XCB, 0X2C, 0X3C, 0XB4, 0X3A, 0X86, 0XCF, 0XBA, 0X02, 0X0B,
-  0X47, 0XE8, 0X05, 0X6F, 0XE4, 0X7C, 0X76, 0X73, 0X94, 0XF0, 0X1A, 0X4A,
-  0X2E, 0XF3, 0X13, 0XF7, 0XC8, 0XD2, 0XDC, 0X29, 0X98, 0XB2, 0X33, 0X4A,
-  0X01, 0XF4, 0XE7, 0X1B, 0X38, 0X3E, 0X2C, 0XAF, 0X05, 0XCA, 0X3B, 0X74,
-  0X3E, 0XE1, 0X57, 0XCD, 0X90, 0X95, 0XB7, 0X9E, 0XB6, 0X70, 0XA7, 0X17,
-  0X9D, 0X86, 0X89, 0X93, 0XB6, 0X67, 0X17, 0XC8, 0X9C, 0XAC, 0X0D, 0XD7,
-  0XE6, 0X6D, 0XDF, 0X35, 0XCA, 0X2A, 0XD8, 0X32, 0XC1, 0X2E, 0X36, 0XA7,
-  0X43, 0X81, 0XEC, 0X3B, 0X03, 0XB8, 0X43, 0X35, 0X5A, 0X01, 0X4D, 0X04,
-  0X5A, 0X7A, 0XD3, 0X22, 0XDA, 0X6C, 0X61, 0X42, 0X23, 0X45, 0XF4, 0X70,
-  0X12, 0X00, 0X4E, 0XD5, 0X6F, 0XE6, 0X76, 0X9D, 0XBA, 0X41, 0X9F, 0X22,
-  0XA2, 0X2C, 0X20, 0X54, 0XE8, 0X1C, 0X65, 0XA6, 0XFE, 0X95, 0X85, 0X89,
-  0XAD, 0X9F, 0X81, 0XAB, 0X11, 0XC8, 0XCB, 0XC5, 0XD5, 0XD6, 0X55, 0X95,
-  0XDB, 0X9C, 0X0D, 0XCD, 0X8C, 0X84, 0X4F, 0XF7, 0X74, 0X67, 0XFE, 0XDD,
-  0X33, 0XA5, 0XBE, 0X36, 0X9F, 0XC2, 0XCD, 0XA6, 0X1A, 0X63, 0XBF, 0X54,
-  0XE9, 0X2B, 0XF2, 0X98, 0XBC, 0X8E, 0X13, 0XD9, 0X5E, 0XA6, 0X70, 0XD2,
-  0X3C, 0X1F, 0XA1, 0X50, 0X52, 0X6E, 0X2F, 0XD0, 0X54, 0X6A, 0X6B, 0X8E,
-  0X6D, 0XEB, 0X4C, 0XDB, 0X09, 0X1E, 0XCF, 0XB4, 0X99, 0X54, 0X93, 0X21,
-  0X4F, 0XB6, 0X10, 0XE8, 0X93, 0XFE, 0X26, 0XF7, 0XA3, 0XA5, 0XFB, 0X91,
-  0XB0, 0XA0, 0X84, 0XC8, 0XA3, 0X49, 0X89, 0XEB, 0X79, 0X09, 0XA8, 0XBD,
-  0X79, 0XB6, 0X59, 0X99, 0X54, 0XA5, 0XA6, 0X8E, 0XCF, 0XAB, 0X0B, 0X4F,
-  0XEA, 0X03, 0X1A, 0X3C, 0X01, 0XF4, 0X2A, 0XE6, 0X0A, 0X64, 0XB7, 0X73,
-  0XB6, 0X7C, 0X03, 0X91, 0XEA, 0X52, 0X68, 0XA8, 0XFD, 0XFC, 0X8F, 0X4E,
-  0XE7, 0XF4, 0X9E, 0XB9, 0X8D, 0X82, 0X57, 0X75, 0X27, 0XD8, 0XEE, 0X4A,
-  0X93, 0X92, 0X73, 0XE5, 0XE1, 0XB4, 0X5E, 0X73, 0X8A, 0X3A, 0X86, 0X7B,
-  0X7D, 0XF8, 0XEB, 0XC2, 0X5C, 0X79, 0X87, 0XE9, 0X76, 0XDF, 0X05, 0XF2,
-  0XE1, 0XC4, 0XCA, 0XAE, 0XD9, 0XC2, 0X81, 0X98, 0X7A, 0X46, 0X1D, 0X67,
-  0XBE, 0X20, 0X9F, 0X82, 0XD4, 0X0A, 0X13, 0XEF, 0X19, 0X93, 0XA5, 0X93,
-  0XB2, 0XC6, 0X02, 0XA3, 0X09, 0X95, 0X86, 0X0C, 0X04, 0X04, 0X50, 0XE9,
-  0X16, 0X48, 0X5D, 0XE6, 0XD4, 0X39, 0X85, 0X8D, 0X2A, 0X33, 0X25, 0XDB,
-  0X1B, 0X48, 0XA9, 0X92, 0X9B, 0X6C, 0X94, 0X65, 0X6B, 0X2E, 0XDE, 0X66,
-  0XBC, 0XDE, 0XEC, 0X29, 0XD5, 0XB3, 0X6E, 0X8A, 0X4B, 0XB1, 0X3D, 0X74,
-  0XEF, 0XCB, 0X48, 0XAF, 0X40, 0X0D, 0X76, 0X9D, 0X0E, 0X6C, 0XEA, 0X62,
-  0X04, 0XCF, 0XD5, 0XDD, 0X50, 0X3D, 0X65, 0X56, 0X44, 0XF8, 0X9D, 0X6B,
-  0X12, 0X36, 0XFA, 0X96, 0XDF, 0X46, 0XC3, 0X8F, 0XC9, 0X43, 0X2B, 0X19,
-  0X32, 0X16, 0XCC, 0X75, 0X65, 0X5B, 0X5A, 0XC5, 0XD7, 0X28, 0X53, 0XB1,
-  0X60, 0X3A, 0X8B, 0X02, 0X4A, 0X69, 0X25, 0X89, 0X67, 0X71, 0X00, 0X06,
-  0X78, 0X1C, 0XE7, 0XFE, 0X1E, 0X6E, 0X4F, 0X63, 0XC0, 0X8B, 0XB8, 0X87,
-  0X35, 0XA2, 0X64, 0XEF, 0X6B, 0X16, 0XFE, 0X9B, 0XAA, 0X88, 0X77, 0XAD,
-  0X77, 0X1F, 0X3D, 0X83, 0XE7, 0X98, 0XE9, 0XF2, 0XF7, 0X47, 0X82, 0X86,
-  0X9D, 0X07, 0XC6, 0X19, 0X7B, 0X88, 0X4D, 0XC8, 0X59, 0X8A, 0XD3, 0X35,
-  0XB3, 0XFC, 0X7D, 0X3B, 0X48, 0X84, 0X0A, 0X39, 0X06, 0X36, 0X63, 0XC5,
-  0X6B, 0X27, 0XF9, 0X60, 0X45, 0XD3, 0X69, 0X56, 0XC8, 0X7A, 0XA4, 0X5B,
-  0X10, 0XBD, 0XF7, 0X15, 0XB1, 0XD7, 0XE4, 0X57, 0XC1, 0X07, 0XAE, 0XFC,
-  0XA2, 0XDC, 0X9D, 0XDC, 0XBB, 0XF5, 0XDD, 0X0C, 0X57, 0X01, 0X68, 0X4A,
-  0XC7, 0X7C, 0XD9, 0X1F, 0X3F, 0XFB, 0XF1, 0X74, 0XE1, 0X47, 0XB8, 0XD1,
-  0X50, 0X6A, 0X8C, 0X7A, 0X45, 0XC9, 0X54, 0XB0, 0XA4, 0XF5, 0XD5, 0X5B,
-  0X0D, 0X55, 0X4E, 0XC4, 0X32, 0X4D, 0X1E, 0X87, 0XAD, 0XF1, 0XDD, 0X66,
-  0XE4, 0XB6, 0X41, 0XEC, 0X78, 0XE5, 0X49, 0XED, 0X2E, 0X2D, 0X77, 0X25,
-  0XAC, 0XFF, 0X4C, 0X78, 0X37, 0XC5, 0X5C, 0XAF, 0X80, 0XB6, 0X34, 0X39,
-  0XC5, 0XE7, 0XA0, 0X2B, 0X5C, 0XF8, 0X34, 0X32, 0XF2, 0XB4, 0X10, 0X38,
-  0X85, 0X65, 0XAE, 0XFB, 0X5D, 0X13, 0X4B, 0XC2, 0X5E, 0X1C, 0X08, 0XAB,
-  0X07, 0X32, 0X34, 0X4A, 0XFD, 0XAA, 0X61, 0XBE, 0X03, 0X09, 0X95, 0X2E,
-  0XB3, 0X88, 0X2C, 0XC4, 0X19, 0XDF, 0XBF, 0X66, 0X80, 0XC1, 0XF8, 0XC4,
-  0XE6, 0X10, 0X57, 0X2B, 0X19, 0XAE, 0X57, 0X40, 0X5E, 0X41, 0X04, 0XAC,
-  0XCA, 0X73, 0X0B, 0XA7, 0XCB, 0XBD, 0XB2, 0X29, 0X11, 0XC1, 0X5C, 0X9F,
-  0XF3, 0X79, 0X2F, 0X92, 0X9E, 0XEC, 0XE5, 0XDA, 0X10, 0X32, 0XCA, 0XC1,
-  0X54, 0X97, 0XAD, 0XB5, 0X36, 0X66, 0X21, 0XDB, 0XBB, 0XBA, 0XAE, 0X7D,
-  0X11, 0XCC, 0X19, 0XE1, 0X1A, 0X80, 0X08, 0XC1, 0XAE, 0X18, 0X94, 0X2F,
-  0XC1, 0XA5, 0X4D, 0X02, 0X26, 0X1A, 0XAF, 0X79, 0X2F, 0X39, 0X72, 0X49,
-  0XAB, 0XF6, 0XD2, 0X61, 0XEA, 0XC5, 0X15, 0X45, 0X51, 0X9C, 0X46, 0X29,
-  0X97, 0X5A, 0X46, 0X10, 0X50, 0X87, 0X2F, 0X68, 0X0E, 0X86, 0XF4, 0X28,
-  0X13, 0X83, 0XCA, 0XD4, 0XD5, 0XAC, 0XB8, 0X65, 0XE7, 0X1F, 0X69, 0X20,
-  0X45, 0X96, 0X14, 0XB2, 0X07, 0XAE, 0XF2, 0XE7, 0X06, 0XF4, 0X51, 0X90,
-  0X43, 0X95, 0X6A, 0X8F, 0XFD, 0X2C, 0XB0, 0XCB, 0X9E, 0XA0, 0X4C, 0XA1,
-  0X2F, 0X6E, 0XD5, 0X49, 0X99, 0X49, 0X78, 0X26, 0XA8, 0X2D, 0XC8, 0X23,
-  0X3A, 0X4A, 0X15, 0XE8, 0XA7, 0X5E, 0XAA, 0X87, 0XB1, 0X22, 0X2C, 0X83,
-  0X8C, 0XD2, 0X87, 0X10, 0X57, 0X2B, 0X92, 0X05, 0X18, 0X27, 0X17, 0X3C,
-  0XF2, 0X94, 0X5C, 0X2A, 0X97, 0XD0, 0X92, 0XD7, 0X9B, 0XE1, 0X9B, 0X7C,
-  0X44, 0X19, 0XDC, 0XCA, 0X97, 0X02, 0X26, 0X98, 0X0B, 0X08, 0X5B, 0XB2,
-  0XD3, 0X86, 0XA8, 0X30, 0XC2, 0XB4, 0X23, 0XF1, 0XAD, 0X39, 0X35, 0X1F,
-  0XC5, 0XFE, 0XDB, 0X00, 0X2E, 0X66, 0X27, 0X07, 0X22, 0X17, 0X82, 0XC9,
-  0X6E, 0X6C, 0X37, 0X6D, 0X6C, 0X36, 0X5A, 0X3E, 0X85, 0X19, 0XF9, 0X23,
-  0X7A, 0X6E, 0XF4, 0X7C, 0X9B, 0X35, 0X80, 0X32, 0XE2, 0XA3, 0X12, 0XA1,
-  0XF4, 0X75, 0XDD, 0XD9, 0XE1, 0X86, 0X2C, 0X85, 0XF8, 0XE2, 0X81, 0X6A,
-  0XA7, 0X49, 0X0F, 0XDB, 0X05, 0XD2, 0X21, 0XBD, 0X5E, 0X2C, 0X0D, 0XE4,
-  0XC3, 0X60, 0X12, 0XB9, 0X79, 0X0E, 0X5A, 0X87, 0X97, 0XD9, 0X09, 0X7E,
-  0XD3, 0X90, 0X46, 0X12, 0X41, 0XD1, 0X4A, 0X15, 0XC1, 0XA3, 0X13, 0XAA,
-  0XF4, 0X1A, 0X8B, 0X60, 0XDD, 0X6B, 0X6C, 0X3B, 0XC4, 0X9A, 0X8B, 0X29,
-  0X8D, 0X8D, 0XCB, 0XC5, 0XA7, 0X73, 0X9D, 0X08, 0XC3, 0X09, 0X6E, 0X06,
-  0XCD, 0XEA, 0X8C, 0X89, 0X1F, 0XAB, 0X77, 0XBF, 0X88, 0XE8, 0X17, 0X0D,
-  0X04, 0XE6, 0X8A, 0XCE, 0X81, 0XAF, 0X5E, 0XCF, 0X4C, 0XB2, 0XEB, 0X73,
-  0X7A, 0X16, 0X36, 0X44, 0X6F, 0XF2, 0XE1, 0X02, 0XC7, 0XC1, 0X09, 0X13,
-  0X76, 0XE2, 0XB4, 0X96, 0XD9, 0X59, 0X36, 0X2C, 0X76, 0X80, 0XD9, 0XE0,
-  0X1C, 0XD4, 0X3C, 0X05, 0X7C, 0X15, 0XA0, 0X74, 0X2B, 0XAE, 0X24, 0X8C,
-  0X0D, 0X91, 0XD6, 0X9F, 0X51, 0X81, 0X5E, 0XA2, 0XAF, 0X5D, 0XF7, 0X81,
-  0XE9, 0X19, 0X37, 0X1B, 0X86, 0XDC, 0XE2, 0X7B, 0XCB, 0X3D, 0X55, 0X61,
-  0X61, 0X5E, 0XED, 0X79, 0X1D, 0XA4, 0X86, 0X6C, 0X22, 0XB2, 0X4D, 0X62,
-  0X2A, 0X42, 0XCA, 0XD2, 0X54, 0X6A, 0XB3, 0X62, 0X7B, 0XC6, 0X4F, 0X20,
-  0X1B, 0X8A, 0XDF, 0X49, 0X55, 0XED, 0X10, 0X42, 0XBF, 0X53, 0X87, 0X6A,
-  0X10, 0X99, 0XE9, 0X6B, 0X9B, 0XEC, 0XEB, 0XA4, 0XBC, 0XF5, 0X72, 0X09,
-  0X9D, 0XD0, 0X46, 0XD3, 0XEB, 0X43, 0XC8, 0XDE, 0XB5, 0X6A, 0XF1, 0XF4,
-  0X74, 0XFA, 0X01, 0XB5, 0XAB, 0XE5, 0X2E, 0X15, 0XE9, 0XC5, 0X73, 0XD5,
-  0XF5, 0XF0, 0XF8, 0X74, 0XFC, 0X2C, 0XDE, 0XAA, 0X7C, 0XD2, 0X1A, 0XB7,
-  0XCA, 0X59, 0X39, 0XBD, 0X56, 0X91, 0X67, 0X59, 0X30, 0X27, 0XED, 0XDD,
-  0XBC, 0X49, 0X15, 0XA0, 0X63, 0X15, 0XDE, 0XD9, 0X57, 0X55, 0X26, 0X79,
-  0X91, 0XE1, 0X7D, 0X90, 0XE7, 0X3E, 0X05, 0X51, 0X3C, 0XF1, 0XA9, 0X67,
-  0X75, 0X74, 0X52, 0X12, 0XB3, 0X9B, 0X37, 0XF4, 0XEA, 0X67, 0XEB, 0XAE,
-  0XC6, 0XA8, 0XE5, 0X19, 0X5C, 0XCE, 0X7F, 0X0A, 0X14, 0XCB, 0XF8, 0X8A,
-  0X59, 0XAF, 0X99, 0X8E, 0XF9, 0X01, 0X8E, 0X2F, 0X96, 0X1B, 0X54, 0XFB,
-  0X3E, 0XB4, 0XEB, 0XBA, 0X3F, 0X0D, 0X88, 0X59, 0XB6, 0X1A, 0X78, 0XB3,
-  0XED, 0XF6, 0X26, 0XCC, 0X69, 0X04, 0XD9, 0X53, 0X1E, 0XA1, 0XF4, 0XDA,
-  0X3B, 0XD6, 0X2F, 0XFF, 0XC5, 0X05, 0X99, 0X78, 0XA6, 0XAF, 0X3B, 0XA8,
-  0XC1, 0XF1, 0X89, 0X68, 0XA6, 0XA9, 0X5E, 0X7A, 0X2F, 0X47, 0X02, 0X2B,
-  0X0B, 0XDB, 0X2C, 0X57, 0X3D, 0XEB, 0X71, 0X66, 0X2F, 0XDB, 0X2C, 0X4C,
-  0X7E, 0X8B, 0X47, 0X40, 0X44, 0X9A, 0XAD, 0XD7, 0X71, 0X20, 0X95, 0X1C,
-  0X8A, 0X82, 0XBD, 0X7D, 0XEE, 0XAE, 0X21, 0X16, 0X36, 0X97, 0XC4, 0X22,
-  0XF8, 0X92, 0X5F, 0XE7, 0X49, 0X06, 0XDA, 0X80, 0XE2, 0X48, 0X92, 0XCB,
-  0X59, 0X4F, 0X35, 0X54, 0XD8, 0XDA, 0X43, 0X56, 0XE1, 0X4E, 0XA9, 0XE1,
-  0X5F, 0X86, 0X40, 0X7B, 0X7E, 0X8A, 0X71, 0X84, 0XE5, 0XFD, 0XED, 0X5D,
-  0X6C, 0X31, 0X9B, 0X59, 0XF5, 0XC8, 0X37, 0X1C, 0X0E, 0X9D, 0X29, 0XB8,
-  0X13, 0X9F, 0X93, 0XB2, 0XEE, 0X2E, 0X78, 0X08, 0X2E, 0XAB, 0X56, 0X07,
-  0X84, 0X8D, 0XA5, 0X23, 0X22, 0X85, 0XDA, 0XD8, 0XD2, 0X27, 0X73, 0X52,
-  0X6B, 0XE2, 0X25, 0X96, 0XEE, 0X31, 0XA9, 0XB2, 0XB6, 0X98, 0X79, 0XD2,
-  0XA1, 0XC4, 0XAF, 0X0F, 0X37, 0XF3, 0X2C, 0X24, 0X8A, 0XAB, 0X72, 0X7D,
-  0X71, 0XB0, 0XB2, 0X1E, 0X6D, 0X14, 0XAC, 0XE1, 0X37, 0X0B, 0X1F, 0X51,
-  0XDA, 0X76, 0XD4, 0X78, 0X14, 0X4B, 0X86, 0X50, 0XB9, 0X4D, 0X5B, 0XE1,
-  0X85, 0XAE, 0XA3, 0XD1, 0X35, 0XAD, 0X55, 0X7A, 0XCD, 0X91, 0XD6, 0XE3,
-  0XB5, 0XD3, 0XB6, 0X7F, 0XE4, 0X15, 0XCB, 0X61, 0X92, 0XE4, 0X82, 0X4D,
-  0X65, 0XD4, 0XCA, 0XA3, 0X6E, 0X8B, 0X5B, 0XE6, 0XCF, 0XA6, 0X92, 0XF4,
-  0XAA, 0X62, 0X99, 0X18, 0X03, 0X05, 0X55, 0X90, 0X1F, 0X1A, 0X31, 0XA6,
-  0XBA, 0XC9, 0XDA, 0X68, 0X45, 0XB2, 0X80, 0X85, 0X9D, 0X96, 0XFB, 0X61,
-  0X0B, 0X29, 0X21, 0X94, 0X20, 0XE8, 0X80, 0XC2, 0X4A, 0X4C, 0XFF, 0XA3,
-  0XBD, 0XBD, 0XF2, 0X29, 0X8A, 0X80, 0X45, 0XA5, 0XB1, 0X89, 0XB0, 0XA0,
-  0XB1, 0XDE, 0X2B, 0XDC, 0X93, 0X00, 0X95, 0X02, 0X87, 0XB4, 0X7C, 0XB1,
-  0XD7, 0XC8, 0X1D, 0XC9, 0XF7, 0XC9, 0XF6, 0XBC, 0XE1, 0X6E, 0XDB, 0XE1,
-  0XD4, 0XA3, 0X95, 0X5F, 0XD5, 0X3A, 0X5B, 0XAC, 0X1E, 0X28, 0X04, 0X84,
-  0XD5, 0XAF, 0X99, 0X1C, 0X54, 0X21, 0XE6, 0X43, 0XCD, 0X57, 0XC5, 0XD5,
-  0XB0, 0X13, 0X96, 0XAE, 0X67, 0XD3, 0X11, 0X49, 0X07, 0X7F, 0XBD, 0X47,
-  0X48, 0X0C, 0X75, 0XC4, 0XCB, 0X1E, 0X62, 0X37, 0X34, 0X1A, 0X36, 0XBE,
-  0X4B, 0X26, 0X57, 0X5D, 0X9C, 0X79, 0X74, 0XDF, 0XEA, 0XAB, 0XDC, 0X20,
-  0X10, 0X66, 0X72, 0XA3, 0XDB, 0X87, 0X88, 0XB3, 0X17, 0X8C, 0XD1, 0X66,
-  0X1D, 0XAF, 0X19, 0X4D, 0XB5, 0XAD, 0XC6, 0X4F, 0X49, 0X00, 0XE3, 0X18,
-  0XDD, 0X47, 0X23, 0XFA, 0XC1, 0X58, 0X20, 0XC1, 0X12, 0XC6, 0XB6, 0X91,
-  0XBA, 0X6F, 0X3F, 0X29, 0XD2, 0X61, 0XEE, 0XFC, 0XF5, 0XFB, 0X4F, 0X6D,
-  0XF1, 0X18, 0X92, 0X46, 0XE4, 0X0B, 0X97, 0XB5, 0XCE, 0XBE, 0X15, 0XE5,
-  0X6D, 0X99, 0X22, 0X25, 0XDC, 0X1C, 0XD3, 0XF2, 0X94, 0X9D, 0X64, 0XCE,
-  0X48, 0XAE, 0X0E, 0XBB, 0XEA, 0X65, 0X28, 0X5A, 0XD1, 0XD9, 0X18, 0X1F,
-  0X72, 0X9C, 0XBF, 0X9F, 0X0A, 0X50, 0XB5, 0X8B, 0XD2, 0XA3, 0X38, 0X6C,
-  0X70, 0XA2, 0X09, 0X7D, 0XC0, 0X5D, 0X54, 0XE8, 0X08, 0X97, 0X13, 0XB4,
-  0X2B, 0XA9, 0XE0, 0XB8, 0XD4, 0X3D, 0X59, 0X0C, 0XA8, 0XC5, 0XE6, 0X0D,
-  0X3A, 0XCE, 0X56, 0X8B, 0X2D, 0XD6, 0X7C, 0XE4, 0X5A, 0XD4, 0X49, 0X75,
-  0XCF, 0X67, 0XD4, 0X9A, 0XCB, 0X02, 0X0D, 0X83, 0XCF, 0X17, 0X00, 0XE2,
-  0XFB, 0X86, 0XBC, 0XC6, 0XF2, 0X98, 0XBE, 0XE0, 0XA4, 0XAD, 0X94, 0X9B,
-  0X06, 0X48, 0X2F, 0X91, 0X57, 0XE4, 0XFA, 0X9C, 0X0C, 0XAC, 0X65, 0XF3,
-  0X4D, 0XCE, 0X58, 0X59, 0X93, 0XCD, 0X2A, 0XD4, 0X28, 0XC0, 0X5C, 0X87,
-  0X84, 0X02, 0XD7, 0X54, 0X12, 0XBA, 0X7C, 0X20, 0X45, 0X53, 0X24, 0X77,
-  0X35, 0X9A, 0X0D, 0X14, 0X37, 0X5F, 0X62, 0X70, 0XAA, 0XD3, 0X46, 0X09,
-  0X2F, 0X11, 0X12, 0X04, 0X55, 0X5E, 0X23, 0X2D, 0XB0, 0XDB, 0XEF, 0X4A,
-  0X3E, 0XDA, 0X34, 0X28, 0XEF, 0X51, 0X69, 0X2D, 0X54, 0XDB, 0X31, 0XBB,
-  0XCC, 0XF5, 0X6B, 0X67, 0X1D, 0X9D, 0X94, 0XD1, 0X6B, 0X0C, 0X3C, 0X3E,
-  0X58, 0X62, 0X4E, 0XB2, 0XD7, 0X47, 0X7E, 0X7D, 0XB9, 0XEA, 0X1D, 0X39,
-  0XA7, 0X63, 0X75, 0X09, 0X35, 0XD5, 0X45, 0X61, 0X6E, 0X25, 0XB0, 0XB8,
-  0XE2, 0XD7, 0XCF, 0X02, 0X46, 0X0C, 0X56, 0XBE, 0X9A, 0X23, 0XB3, 0XF5,
-  0X0D, 0X24, 0X8B, 0X74, 0XC9, 0X24, 0X8D, 0X0F, 0XFD, 0XAE, 0XB1, 0XAD,
-  0X9F, 0X3A, 0XC1, 0X5E, 0XF7, 0X4D, 0X7E, 0X59, 0X83, 0X32, 0XF1, 0X1A,
-  0XE5, 0X96, 0XD0, 0XDA, 0XF2, 0XF2, 0XFE, 0XA1, 0X1E, 0X36, 0X82, 0X54,
-  0X30, 0X73, 0X7D, 0X64, 0X52, 0X6B, 0X61, 0X51, 0X11, 0X55, 0XE6, 0X51,
-  0XD7, 0X75, 0X57, 0X4F, 0X98, 0X14, 0X68, 0X68, 0X9B, 0X87, 0XF6, 0XD6,
-  0X1D, 0X09, 0XAE, 0X5A, 0XD6, 0X31, 0XC8, 0X40, 0XB2, 0X9E, 0X5F, 0X46,
-  0XCD, 0XD2, 0X83, 0XB4, 0XC7, 0X63, 0X32, 0X9B, 0X2F, 0X5F, 0XDB, 0X8E,
-  0X64, 0X52, 0XDE, 0XD3, 0X50, 0X20, 0X35, 0X3C, 0X59, 0X4F, 0XB6, 0X14,
-  0X6B, 0XB2, 0XF2, 0XA0, 0XC7, 0X16, 0X79, 0X9D, 0XC6, 0XDD, 0XBE, 0XD5,
-  0XFA, 0XD4, 0X53, 0X3A, 0X3A, 0X53, 0X7D, 0X4F, 0XBF, 0X1A, 0XB4, 0XCD,
-  0XDC, 0XD3, 0XAF, 0XB7, 0X95, 0X7D, 0X84, 0X8D, 0XAD, 0X96, 0X04, 0XEB,
-  0X84, 0XFD, 0XC7, 0XF1, 0XF6, 0X27, 0XA5, 0X6C, 0XAC, 0X92, 0X94, 0XD1,
-  0X0E, 0X9B, 0X77, 0X23, 0X50, 0X72, 0X9B, 0XEE, 0XD1, 0X80, 0XA1, 0X5B,
-  0X58, 0X14, 0X36, 0X1B, 0X18, 0XC6, 0XFC, 0XB1, 0X69, 0X87, 0X45, 0XF3,
-  0XB1, 0XF6, 0X99, 0X32, 0XFA, 0XAA, 0X78, 0XD3, 0X9D, 0XBD, 0XF6, 0XA1,
-  0X65, 0X43, 0XA5, 0X1E, 0X86, 0X4B, 0X4F, 0X58, 0X36, 0X27, 0XF5, 0X67,
-  0X3A, 0XBF, 0XB4, 0X08, 0X94, 0X43, 0X97, 0X29, 0X58, 0X90, 0XE4, 0X2F,
-  0XA7, 0XC2, 0X5E, 0XDA, 0X4A, 0X8C, 0XE2, 0X2C, 0X33, 0X30, 0X87, 0X5E,
-  0X52, 0X3A, 0X71, 0X6D, 0X3E, 0XB1, 0XFC, 0XCD, 0X1C, 0X4D, 0X62, 0XBE,
-  0X70, 0XD1, 0XAE, 0XE1, 0X14, 0XF1, 0XEB, 0X48, 0X73, 0XB4, 0XAB, 0XE3,
-  0X9F, 0XC6, 0X86, 0XD4, 0X1C, 0X26, 0XBB, 0X1A, 0X73, 0X13, 0XA5, 0X18,
-  0X6B, 0X51, 0X04, 0X43, 0XED, 0X8A, 0X01, 0X8D, 0X93, 0XBE, 0X4F, 0X87,
-  0X37, 0X98, 0X68, 0X19, 0X2B, 0X2E, 0X55, 0XD8, 0XF0, 0XE1, 0XAC, 0X76,
-  0X28, 0X81, 0X44, 0XAE, 0X92, 0XBE, 0XA8, 0XDE, 0XDD, 0X2D, 0X9A, 0XEF,
-  0X40, 0XAD, 0X03, 0XEF, 0XC4, 0X5D, 0X14, 0XAF, 0X67, 0X66, 0XF4, 0X5E,
-  0X4F, 0X50, 0XD9, 0X6A, 0XC3, 0X11, 0X46, 0XC9, 0X79, 0XFA, 0XD6, 0X5B,
-  0X8C, 0X62, 0XF6, 0X8F, 0X60, 0XF1, 0X0C, 0XD9, 0XB5, 0X73, 0X86, 0X0D,
-  0X67, 0X6C, 0X7A, 0X73, 0X6B, 0X64, 0XFB, 0XC2, 0XDB, 0XEC, 0XF9, 0X0C,
-  0X98, 0XBD, 0X65, 0XE7, 0X0A, 0XE6, 0X5D, 0X5F, 0X57, 0X14, 0X1F, 0X8F,
-  0X32, 0XEF, 0XDF, 0X5F, 0X48, 0X21, 0X48, 0XB9, 0X9C, 0X33, 0XD8, 0XD1,
-  0X29, 0X8A, 0X36, 0X9C, 0XEC, 0X61, 0XE9, 0X97, 0XE8, 0X50, 0X06, 0XFE,
-  0X06, 0XD7, 0XAA, 0XD1, 0X98, 0XF1, 0X64, 0XB2, 0XF8, 0XBE, 0X82, 0X32,
-  0X92, 0X97, 0X55, 0X8D, 0XB2, 0XA3, 0X5B, 0XE6, 0XB9, 0X62, 0X3B, 0X7B,
-  0X12, 0XB0, 0X01, 0X05, 0X2E, 0XA4, 0X78, 0XE2, 0X0D, 0X29, 0XBE, 0X57,
-  0X76, 0XB2, 0X69, 0XB5, 0X31, 0X26, 0XE2, 0XB4, 0X3A, 0XE3, 0X28, 0X95,
-  0XBE, 0XC2, 0XF9, 0X53, 0X93, 0XA7, 0X84, 0XE3, 0XB7, 0X29, 0XDD, 0XCE,
-  0X4E, 0XBD, 0XBD, 0X22, 0XB0, 0X46, 0XDB, 0XCB, 0X10, 0X33, 0X1D, 0X98,
-  0XD7, 0X95, 0XFB, 0XBA, 0XC5, 0X15, 0X65, 0XA5, 0X71, 0X1C, 0XCB, 0X87,
-  0X3A, 0X33, 0X74, 0X61, 0X63, 0XBE, 0XFA, 0X77, 0X5A, 0XC8, 0X62, 0X3B,
-  0XBD, 0XC5, 0X7C, 0X10, 0XDF, 0XAC, 0XA0, 0X4B, 0X6A, 0XDE, 0X82, 0X3E,
-  0X74, 0X78, 0X6F, 0XBC, 0X9E, 0X2E, 0XB9, 0X61, 0XB7, 0X87, 0X05, 0X37,
-  0X25, 0X16, 0XF4, 0X26, 0X1B, 0X64, 0X2F, 0X25, 0XAC, 0X49, 0XA9, 0XCA,
-  0XA2, 0XE3, 0X7B, 0X77, 0XEA, 0X60, 0X77, 0XC2, 0XE7, 0X15, 0XC1, 0X11,
-  0XDF, 0X9C, 0XA0, 0X58, 0X3F, 0X8E, 0X0E, 0X0D, 0X1A, 0XE5, 0X3F, 0X3B,
-  0XFA, 0X26, 0X5D, 0X24, 0X33, 0X73, 0X6A, 0X50, 0X5D, 0XDB, 0X0E, 0XEE,
-  0X05, 0X00, 0XBE, 0X06, 0X32, 0X18, 0X06, 0X51, 0X89, 0X7B, 0X01, 0X4F,
-  0XDE, 0X21, 0XDC, 0X61, 0XA0, 0XB9, 0X08, 0XC4, 0X95, 0X99, 0X61, 0X03,
-  0X11, 0X64, 0X55, 0X28, 0X74, 0X6B, 0X17, 0X74, 0X7F, 0X43, 0X9F, 0X6D,
-  0X5F, 0XCE, 0XCE, 0XCF, 0X26, 0XBD, 0X70, 0XDD, 0X47, 0X79, 0X5E, 0XF3,
-  0X90, 0X6F, 0X43, 0X89, 0X6C, 0XEA, 0X65, 0X92, 0X9A, 0X88, 0XC8, 0XA7,
-  0X7A, 0X0C, 0X2D, 0X77, 0X87, 0X1B, 0X4D, 0X83, 0XE6, 0X55, 0XD0, 0X30,
-  0X06, 0XE6, 0X49, 0X89, 0X58, 0X7E, 0X72, 0XAF, 0XD8, 0X81, 0X29, 0X06,
-  0X6A, 0XE4, 0XDF, 0X24, 0X82, 0XB4, 0XEB, 0X54, 0XFA, 0X44, 0X79, 0X8A,
-  0XC9, 0XB4, 0X06, 0X8B, 0X39, 0XB5, 0X14, 0XF0, 0X46, 0X31, 0XF9, 0X10,
-  0X61, 0X4E, 0X7D, 0X1B, 0X10, 0X8A, 0X4F, 0X97, 0X57, 0XBE, 0X40, 0X57,
-  0X7B, 0X09, 0X54, 0X6C, 0X16, 0X21, 0XE6, 0X98, 0XE6, 0X13, 0XD0, 0X8F,
-  0X16, 0XE2, 0X10, 0X5F, 0X1F, 0XD3, 0X4F, 0X26, 0XDC, 0X41, 0X04, 0X97,
-  0XC2, 0X4A, 0X95, 0X07, 0X9D, 0X99, 0X6F, 0XF7, 0X1D, 0X8D, 0XD6, 0X88,
-  0X68, 0XBB, 0XFE, 0X24, 0XEC, 0XDA, 0X0F, 0X43, 0X8C, 0XF9, 0XFA, 0XF7,
-  0XC0, 0XE7, 0X96, 0X93, 0X24, 0X40, 0X23, 0X00, 0XA0, 0X40, 0X87, 0XC2,
-  0X5D, 0XA5, 0X6A, 0X17, 0XDB, 0X05, 0X36, 0X0F, 0X7A, 0X4C, 0X18, 0X15,
-  0X88, 0X6E, 0X3B, 0XAF, 0X8A, 0X0C, 0X48, 0X5F, 0XAC, 0XC3, 0XED, 0XEE,
-  0X7D, 0X02, 0X83, 0X9D, 0X37, 0X28, 0X81, 0XF9, 0XD7, 0XD9, 0XE0, 0X90,
-  0XC1, 0X5F, 0X24, 0X50, 0X20, 0X0D, 0X8C, 0X00, 0XC7, 0X52, 0XA0, 0XAA,
-  0XA9, 0XDA, 0X8D, 0X94, 0X50, 0XD9, 0X7C, 0X17, 0X83, 0XD9, 0X75, 0XF9,
-  0X21, 0XB2, 0X08, 0X44, 0X37, 0X70, 0X6E, 0XD6, 0XED, 0X61, 0X7D, 0X30,
-  0XBD, 0XEF, 0X8D, 0X7E, 0X23, 0XB3, 0XAF, 0X78, 0X87, 0X9A, 0XB4, 0X5B,
-  0XA4, 0X1F, 0X3D, 0X8A, 0X70, 0XC8, 0X1B, 0X8B, 0XCA, 0XD9, 0X3C, 0XC7,
-  0X9D, 0XAD, 0X50, 0X63, 0X3A, 0X74, 0XB2, 0X3E, 0XFE, 0XCE, 0X74, 0X1A,
-  0X7F, 0X28, 0X7B, 0X63, 0X4D, 0X45, 0X41, 0X77, 0X33, 0XDA, 0XB2, 0XEF,
-  0X78, 0X5F, 0X20, 0XB0, 0X99, 0X8E, 0XB0, 0XA6, 0X2F, 0X31, 0X19, 0X8D,
-  0XCF, 0X83, 0XF6, 0X69, 0X26, 0XD4, 0X1D, 0XE3, 0X4D, 0X39, 0X3B, 0X43,
-  0X7C, 0XE2, 0X9E, 0X30, 0X76, 0X80, 0X9B, 0XC5, 0X98, 0XC7, 0X22, 0X5D,
-  0XE8, 0X8A, 0X3D, 0X0E, 0X37, 0X4F, 0XCC, 0XF4, 0X47, 0X17, 0XB4, 0X93,
-  0X74, 0X13, 0XFD, 0X3E, 0XF0, 0X0C, 0X00, 0X2B, 0XDF, 0X60, 0XF5, 0XCE,
-  0XF2, 0XC2, 0XC7, 0XE1, 0X7A, 0X3D, 0X01, 0X68, 0X5D, 0X18, 0XCF, 0XD1,
-  0XD7, 0XDE, 0X7D, 0X17, 0X1E, 0X52, 0X23, 0X0A, 0X73, 0XED, 0X8F, 0X6F,
-  0X50, 0X68, 0XC1, 0X81, 0X05, 0X5A, 0XDD, 0X34, 0XBE, 0X0D, 0X49, 0X33,
-  0XDF, 0XBA, 0X06, 0X50, 0XFA, 0X43, 0X0F, 0X0C, 0XA5, 0XAB, 0X4D, 0X01,
-  0X7D, 0XC3, 0XA4, 0X96, 0X74, 0XFE, 0XC1, 0X84, 0X36, 0XEE, 0XBF, 0X43,
-  0X43, 0X8F, 0XA8, 0XB8, 0X66, 0X97, 0XD1, 0X33, 0X5B, 0X08, 0X72, 0X41,
-  0XCD, 0X56, 0X0C, 0X8D, 0XD2, 0XCD, 0XB5, 0X81, 0X8E, 0X0F, 0X8A, 0XC7,
-  0X33, 0XE9, 0XEA, 0XCC, 0XB6, 0X43, 0XF0, 0X7F, 0X6F, 0XEE, 0X49, 0X9B,
-  0X13, 0X47, 0X96, 0XFC, 0XFE, 0X7E, 0X85, 0X9E, 0X36, 0X36, 0X06, 0X1E,
-  0X6E, 0X40, 0XDC, 0XB8, 0X6D, 0X47, 0X08, 0X71, 0XDF, 0XF7, 0XE1, 0XD9,
-  0X0E, 0X87, 0X90, 0X04, 0X12, 0XE8, 0X42, 0X07, 0XD7, 0X44, 0XFF, 0XF7,
-  0XAD, 0X2A, 0X49, 0X20, 0X81, 0X84, 0XA1, 0XC7, 0X3D, 0XBB, 0X1D, 0X31,
-  0X63, 0X23, 0X65, 0X65, 0X65, 0X65, 0XE5, 0X5D, 0X45, 0X5A, 0X8F, 0XCC,
-  0X05, 0X93, 0XCF, 0X96, 0X99, 0XE4, 0X22, 0X39, 0X36, 0XB9, 0X69, 0XBA,
-  0X74, 0X20, 0X12, 0XE3, 0X14, 0X2D, 0X6D, 0X58, 0XC0, 0X2B, 0X7A, 0XDC,
-  0XD7, 0XF2, 0XD5, 0X66, 0X91, 0X2E, 0X8D, 0X75, 0X79, 0X16, 0X69, 0X28,
-  0XA9, 0X86, 0XC8, 0X94, 0XEB, 0X86, 0X91, 0X28, 0X17, 0XEA, 0X4C, 0X5D,
-  0XCE, 0XB5, 0XF8, 0XF5, 0X30, 0X23, 0X14, 0X0B, 0XB2, 0X6E, 0X28, 0XC9,
-  0X64, 0X3C, 0X95, 0XDE, 0X99, 0X95, 0XA6, 0X5C, 0X2F, 0XEB, 0XB3, 0XA3,
-  0X54, 0X31, 0XDB, 0X11, 0XF5, 0XBD, 0XDE, 0X88, 0X6C, 0X23, 0XBB, 0X19,
-  0XDD, 0XAE, 0X75, 0XF8, 0XF2, 0X68, 0X31, 0X9F, 0X1D, 0X7A, 0X15, 0X6D,
-  0XD6, 0X4A, 0X55, 0X40, 0X22, 0X2B, 0XAE, 0X52, 0X40, 0X51, 0XB6, 0XA6,
-  0X90, 0X16, 0X26, 0X5A, 0XF9, 0X60, 0X24, 0X44, 0X62, 0X29, 0X91, 0XF5,
-  0X7D, 0X63, 0X37, 0X56, 0XF6, 0X6B, 0XB9, 0XC6, 0X19, 0X92, 0XA4, 0XD5,
-  0X98, 0X9D, 0XD6, 0XCA, 0XF4, 0X99, 0X81, 0X51, 0X1A, 0X77, 0XBA, 0X1D,
-  0XA1, 0X2C, 0X68, 0X63, 0X69, 0X54, 0XDC, 0X18, 0XC2, 0X74, 0X92, 0XDD,
-  0X94, 0XE7, 0XF3, 0X83, 0X3A, 0X6E, 0X69, 0XDC, 0X4A, 0X79, 0X9F, 0X24,
-  0X94, 0XC3, 0X70, 0XCD, 0X6C, 0X14, 0X69, 0X3F, 0X1A, 0XC5, 0X99, 0X51,
-  0X75, 0XCC, 0X6F, 0X59, 0X36, 0XD9, 0XC8, 0X4F, 0XD7, 0XC4, 0X74, 0X93,
-  0X1C, 0XBF, 0XEB, 0XBB, 0X85, 0X06, 0X02, 0XFC, 0X89, 0XA4, 0XA8, 0X83,
-  0XEC, 0X5A, 0X98, 0XF1, 0X5B, 0XBA, 0X50, 0X7B, 0X1F, 0X15, 0X8B, 0XCD,
-  0XD4, 0X92, 0X65, 0XD4, 0XC9, 0XBA, 0X57, 0X91, 0XB6, 0X87, 0X92, 0XDE,
-  0X68, 0X77, 0X4B, 0XE9, 0X48, 0X3F, 0X53, 0XEE, 0X35, 0X0C, 0X22, 0X32,
-  0X4E, 0X26, 0X67, 0X74, 0X73, 0X2F, 0X0D, 0X8E, 0X4D, 0X7D, 0X10, 0X6F,
-  0X1C, 0X38, 0X73, 0X2F, 0XAE, 0XD9, 0XF2, 0X96, 0XEC, 0X6F, 0X12, 0X1B,
-  0X79, 0X32, 0XDA, 0X8B, 0X5C, 0X8D, 0X10, 0XF3, 0XAB, 0XDE, 0XAC, 0X43,
-  0XD5, 0XE4, 0X05, 0X09, 0XCC, 0X46, 0X96, 0XC9, 0X25, 0X54, 0XA3, 0XD0,
-  0X4B, 0X64, 0X15, 0XB9, 0XB9, 0XCE, 0XAC, 0XB7, 0X7C, 0X73, 0X29, 0X93,
-  0XD4, 0X22, 0X22, 0X17, 0XA8, 0X5E, 0XA6, 0X34, 0X1E, 0XED, 0XE4, 0XF1,
-  0X74, 0XDA, 0XAB, 0X53, 0X64, 0X24, 0X51, 0X5E, 0X0A, 0XAB, 0X66, 0XA4,
-  0XD6, 0XAA, 0XE8, 0X54, 0XB1, 0XC1, 0X82, 0XEC, 0XAF, 0X95, 0X94, 0X36,
-  0X8C, 0X48, 0XE5, 0X16, 0X6B, 0X25, 0X49, 0X16, 0X0A, 0XCA, 0X91, 0XAE,
-  0XAA, 0XDB, 0X51, 0XA4, 0X74, 0XD8, 0X24, 0X3A, 0X07, 0X25, 0X3D, 0XA8,
-  0X54, 0XDA, 0XCB, 0XF6, 0XA4, 0XDA, 0X67, 0X0A, 0X72, 0XAD, 0XDD, 0X6C,
-  0X64, 0X5A, 0X1B, 0X10, 0X5F, 0XCD, 0X8F, 0X20, 0X38, 0X4E, 0X0E, 0XC4,
-  0XA1, 0XC6, 0X34, 0XE6, 0X4B, 0X62, 0X63, 0XD4, 0X68, 0XAE, 0X7D, 0X50,
-  0XF3, 0X9C, 0X06, 0XAF, 0XAB, 0X75, 0X4A, 0X44, 0X5C, 0X57, 0XB4, 0X99,
-  0XC6, 0X2B, 0X15, 0X25, 0X56, 0X62, 0X5A, 0X93, 0XCD, 0XE8, 0XBD, 0X6D,
-  0X64, 0XD2, 0XAD, 0XA3, 0X6C, 0X96, 0XF5, 0XA5, 0XFA, 0XAE, 0X15, 0X7B,
-  0XBD, 0XF8, 0X3B, 0X3F, 0X68, 0XAF, 0XB3, 0X95, 0X99, 0XC8, 0X70, 0XBD,
-  0XCE, 0X3C, 0X45, 0X49, 0XE5, 0X8C, 0XB1, 0XE1, 0XCD, 0X59, 0X5C, 0X6E,
-  0XAC, 0XC6, 0XBC, 0XA1, 0XAF, 0XCC, 0XF7, 0XF5, 0X9C, 0X9A, 0X6F, 0X8F,
-  0XBD, 0X4D, 0X43, 0X52, 0XD7, 0XB4, 0X39, 0X69, 0X1B, 0X15, 0X71, 0XA3,
-  0X6F, 0X66, 0X4A, 0X75, 0XC3, 0X65, 0XF5, 0X63, 0XA7, 0X29, 0X1C, 0X3B,
-  0X5A, 0X0B, 0XFC, 0X6C, 0X54, 0X0B, 0X47, 0XA9, 0XC0, 0XE9, 0XEF, 0XFB,
-  0X9A, 0XC6, 0X0D, 0X0A, 0XEC, 0X7A, 0XCB, 0X56, 0X95, 0X7C, 0X22, 0X5E,
-  0XA9, 0X47, 0X76, 0XDD, 0X8A, 0X11, 0XAB, 0XB7, 0X0C, 0X7D, 0X6E, 0X96,
-  0XE2, 0XD4, 0X34, 0X0D, 0X0C, 0X39, 0X21, 0X8D, 0X4D, 0X60, 0X8D, 0XB2,
-  0X73, 0X55, 0XEC, 0X95, 0XFA, 0XAC, 0XB6, 0X6D, 0X57, 0XE8, 0XDD, 0X04,
-  0X84, 0X98, 0XE9, 0X8A, 0XB2, 0XAE, 0XC4, 0X56, 0XC0, 0X7F, 0X6F, 0XF3,
-  0X79, 0X25, 0X53, 0XAD, 0XF1, 0X45, 0XB6, 0X5C, 0X68, 0X2B, 0XC7, 0X64,
-  0X36, 0X19, 0XCB, 0XD6, 0XF6, 0XC7, 0XED, 0X78, 0X0F, 0XBF, 0X93, 0XA0,
-  0X96, 0X4A, 0X87, 0XDE, 0X44, 0X97, 0XCB, 0X7C, 0X9D, 0X92, 0XD2, 0X2D,
-  0X89, 0X95, 0XF2, 0XED, 0X6E, 0X2A, 0XA7, 0X80, 0XE0, 0XAB, 0XDB, 0XDC,
-  0X90, 0XEB, 0X82, 0X9C, 0XA5, 0XE4, 0X6E, 0XAF, 0X91, 0X9D, 0X6E, 0X8C,
-  0X31, 0XBD, 0X1D, 0XA7, 0XB5, 0XC4, 0XE8, 0X08, 0XB2, 0X13, 0X72, 0XB0,
-  0XA2, 0X1B, 0X89, 0XBA, 0X54, 0X2C, 0X36, 0X96, 0X65, 0X39, 0XB3, 0X1A,
-  0XB3, 0XE3, 0X2D, 0X35, 0X22, 0XE4, 0XB1, 0XA6, 0X6F, 0X47, 0X99, 0XF2,
-  0X66, 0X29, 0X64, 0X8E, 0X93, 0X66, 0X67, 0X4A, 0XB2, 0X8D, 0XFE, 0X38,
-  0XD7, 0XE9, 0X2B, 0XF5, 0XAC, 0XB1, 0X6D, 0X70, 0X87, 0X44, 0X89, 0X4C,
-  0X54, 0X06, 0X85, 0XC3, 0X92, 0X50, 0XBA, 0XA9, 0X66, 0X76, 0X95, 0X2D,
-  0X56, 0XB7, 0XC5, 0XE9, 0XE0, 0XF0, 0XCE, 0X8F, 0X33, 0XCC, 0X74, 0X35,
-  0XDC, 0X6F, 0X8F, 0X42, 0X5C, 0XEE, 0XCC, 0X99, 0X5C, 0X27, 0XBB, 0XD5,
-  0X89, 0XAD, 0X98, 0X93, 0XB4, 0X44, 0X61, 0X43, 0X74, 0XC6, 0XE3, 0X9A,
-  0XBC, 0X32, 0X37, 0X13, 0XE1, 0XC8, 0X76, 0XCA, 0XE4, 0X71, 0XAB, 0X09,
-  0X93, 0XC2, 0X9A, 0X4C, 0XC6, 0X35, 0XB6, 0XBF, 0X93, 0XD3, 0XDB, 0X41,
-  0X24, 0X59, 0X27, 0X9B, 0X87, 0X82, 0XD2, 0XDA, 0XEC, 0XEB, 0X33, 0X71,
-  0XB7, 0XDD, 0XA5, 0XB2, 0X19, 0X63, 0XA4, 0X57, 0X84, 0XFC, 0X71, 0X26,
-  0XEC, 0X98, 0X61, 0X66, 0XA8, 0X93, 0X52, 0XB9, 0X99, 0X9E, 0X65, 0XE4,
-  0X3A, 0XD3, 0X98, 0X4D, 0X65, 0X3A, 0XD2, 0X02, 0X19, 0XE5, 0X31, 0X97,
-  0XAD, 0X73, 0X31, 0X93, 0X1B, 0XA6, 0X32, 0X32, 0X59, 0X18, 0X0D, 0X4D,
-  0X33, 0XB5, 0X38, 0X8E, 0X5B, 0X43, 0XAE, 0X70, 0X6C, 0XE4, 0X16, 0XA9,
-  0XD9, 0XB8, 0XB1, 0X5B, 0X57, 0XDF, 0X17, 0XBD, 0X0E, 0X71, 0XCC, 0XF5,
-  0X86, 0XCA, 0X34, 0X41, 0X2B, 0XE6, 0X7A, 0X2D, 0X44, 0X14, 0X5A, 0XAD,
-  0X4A, 0XF3, 0XFE, 0X38, 0X33, 0X55, 0X86, 0XA5, 0X99, 0X58, 0XD9, 0X17,
-  0XEA, 0XC4, 0X88, 0XEE, 0X55, 0X26, 0X93, 0XFC, 0XA4, 0XCC, 0X96, 0X56,
-  0X53, 0X10, 0X41, 0XB4, 0XE2, 0X8B, 0XEA, 0X3A, 0X26, 0XD6, 0X96, 0XC7,
-  0X48, 0X7A, 0X68, 0XB4, 0X97, 0X87, 0X81, 0XA2, 0XEC, 0X47, 0XAD, 0XE6,
-  0X3E, 0X3D, 0XEE, 0XCA, 0X45, 0X95, 0XC9, 0XC7, 0X62, 0X46, 0XB7, 0XBE,
-  0X19, 0X12, 0X86, 0XD6, 0X1A, 0X74, 0XB3, 0XD2, 0X71, 0X6B, 0XD2, 0X13,
-  0XED, 0X30, 0X1A, 0X0C, 0X72, 0XFD, 0X18, 0X43, 0X35, 0X2A, 0X87, 0XF2,
-  0X5C, 0XC8, 0XB1, 0X95, 0X74, 0X66, 0XA1, 0X67, 0X76, 0XA5, 0XC2, 0X66,
-  0XA1, 0XC4, 0X17, 0X19, 0X83, 0X1B, 0XA7, 0X76, 0X44, 0XBA, 0X7B, 0X64,
-  0X88, 0XAE, 0X4C, 0X98, 0X94, 0X34, 0X1D, 0XA5, 0X74, 0X7E, 0X92, 0X61,
-  0X38, 0X20, 0XD6, 0X05, 0X21, 0XD9, 0XAE, 0X8A, 0XDB, 0X48, 0X2E, 0XDD,
-  0X5F, 0X74, 0X46, 0X72, 0X2C, 0X1B, 0XD9, 0XB3, 0XB5, 0X6A, 0X24, 0X67,
-  0X24, 0X17, 0XED, 0X3C, 0X5B, 0X5D, 0X6F, 0XFA, 0X24, 0X5B, 0X5D, 0X68,
-  0X99, 0X4C, 0X67, 0X35, 0X1C, 0XC6, 0X32, 0X6D, 0XA3, 0X93, 0X5B, 0X98,
-  0XDD, 0X03, 0XC8, 0XB3, 0XEA, 0X83, 0XF8, 0XFB, 0X92, 0XD8, 0XCE, 0XF9,
-  0X63, 0X67, 0XCC, 0XEB, 0XB3, 0X56, 0X23, 0X32, 0X5C, 0XC4, 0X80, 0X2F,
-  0X1A, 0X6B, 0XC3, 0X59, 0XAD, 0X97, 0X28, 0X53, 0X5A, 0X9A, 0X69, 0X02,
-  0XAD, 0X6B, 0X97, 0X7B, 0X1A, 0X7D, 0X20, 0X52, 0X35, 0X2E, 0XB5, 0XEF,
-  0X17, 0X36, 0XE3, 0X21, 0X71, 0X2C, 0XD7, 0X85, 0X4C, 0XCF, 0XA0, 0X76,
-  0XFD, 0X4A, 0X79, 0X39, 0XDA, 0X52, 0X72, 0XBC, 0X50, 0XCD, 0X95, 0XAA,
-  0X09, 0XB0, 0X7F, 0X6A, 0X6B, 0X3A, 0X31, 0X7A, 0XD9, 0X84, 0X92, 0XA5,
-  0X9A, 0X0B, 0X92, 0XCF, 0XE4, 0XDF, 0X13, 0XCC, 0X3A, 0XDE, 0X6D, 0X51,
-  0X23, 0X29, 0XA2, 0X4B, 0XBD, 0XED, 0X3C, 0X97, 0XEB, 0X8E, 0X73, 0XD3,
-  0X59, 0X3C, 0X45, 0XC7, 0XFA, 0X19, 0X73, 0X3E, 0X56, 0X47, 0XD3, 0X78,
-  0X9B, 0XC8, 0X8D, 0XD2, 0X3D, 0XF1, 0X18, 0X8F, 0XAD, 0X0E, 0X89, 0X03,
-  0X51, 0X4C, 0XF7, 0X06, 0XB4, 0XA8, 0XEE, 0XCA, 0X83, 0XD9, 0X28, 0X56,
-  0X5C, 0X2D, 0XF6, 0XC7, 0X88, 0X3E, 0X91, 0X92, 0XFC, 0X7A, 0XA6, 0X83,
-  0XE0, 0X7D, 0X79, 0XD8, 0XA9, 0XE3, 0X58, 0XBA, 0XB1, 0X4B, 0XB6, 0X96,
-  0X85, 0X2E, 0XB0, 0X4A, 0X9B, 0XE9, 0XFA, 0X50, 0X18, 0X2C, 0XA7, 0XD9,
-  0X38, 0X41, 0X14, 0X57, 0X31, 0X26, 0XDD, 0XCC, 0X19, 0X42, 0X2B, 0X91,
-  0X9F, 0XEF, 0XF8, 0X7A, 0X0B, 0X58, 0X82, 0X01, 0X3D, 0XD8, 0X14, 0X5B,
-  0X65, 0XA9, 0X21, 0X97, 0XC6, 0X39, 0X23, 0XD2, 0XD5, 0XF2, 0X63, 0X75,
-  0XBB, 0XCF, 0X17, 0XAA, 0X42, 0X62, 0XC1, 0XA9, 0X29, 0X35, 0X1D, 0XEF,
-  0XE4, 0XB3, 0XBB, 0X94, 0X9E, 0XE8, 0X55, 0XE5, 0X1E, 0X9F, 0X3E, 0X6C,
-  0XFA, 0X79, 0XA1, 0XC8, 0X6B, 0XF9, 0X0D, 0X4D, 0XA7, 0X6A, 0X9B, 0X62,
-  0X7F, 0XB5, 0XAF, 0X36, 0XF6, 0XC3, 0X56, 0X9D, 0X9C, 0X10, 0XF5, 0XF9,
-  0XA4, 0X97, 0XEF, 0X0E, 0X32, 0X2B, 0XC1, 0X64, 0X34, 0X85, 0X54, 0X1A,
-  0XF2, 0X7B, 0X2B, 0X95, 0X4A, 0XD4, 0X12, 0XC2, 0XB2, 0X36, 0XCB, 0X34,
-  0XFA, 0XEA, 0X7A, 0X3A, 0XC8, 0X74, 0XBB, 0XC7, 0X19, 0XCB, 0XEF, 0XF7,
-  0X9B, 0X83, 0X4A, 0X56, 0X7A, 0X64, 0X3F, 0XDE, 0XAC, 0XB3, 0X64, 0XB3,
-  0X3F, 0X8B, 0X6F, 0X62, 0X0D, 0X7D, 0X31, 0X1A, 0X65, 0XD9, 0X26, 0X31,
-  0X90, 0XA8, 0XD1, 0XE1, 0X7D, 0XD0, 0XE8, 0XD4, 0XE8, 0X04, 0X33, 0X3D,
-  0X30, 0X24, 0X23, 0X50, 0XF9, 0X94, 0X28, 0XEC, 0XC6, 0XD4, 0XFC, 0X3D,
-  0X3F, 0X52, 0XC5, 0X42, 0X4A, 0XE1, 0X86, 0X4A, 0X92, 0XE3, 0XD3, 0X11,
-  0X90, 0X95, 0XA5, 0X87, 0X5B, 0X21, 0X92, 0X49, 0XC5, 0XF4, 0X14, 0XDB,
-  0X52, 0XF7, 0X63, 0X8A, 0XE9, 0X0C, 0XA9, 0X69, 0X4E, 0XDA, 0X94, 0XCC,
-  0X7D, 0XA5, 0X9E, 0XA9, 0XB4, 0XB7, 0XE6, 0XBE, 0X34, 0X4A, 0X6C, 0XC9,
-  0XD4, 0X2A, 0XD2, 0X88, 0X37, 0XD3, 0XF4, 0X50, 0X2C, 0X1D, 0X9B, 0X91,
-  0X19, 0X30, 0XB4, 0X52, 0XA1, 0XB8, 0XA8, 0X2C, 0XF3, 0XBB, 0X7D, 0X4F,
-  0X97, 0X4A, 0X75, 0XE1, 0XD0, 0XE2, 0XD2, 0XBD, 0XC2, 0XA6, 0X3B, 0X8D,
-  0XB4, 0XD7, 0X99, 0XC8, 0X34, 0X36, 0X62, 0X56, 0XB3, 0X5D, 0XAB, 0X48,
-  0XA2, 0XFF, 0X22, 0XD4, 0X3A, 0X42, 0X92, 0X8B, 0XF2, 0XA1, 0XD0, 0X1E,
-  0XBC, 0X53, 0XC5, 0X36, 0XEA, 0XA3, 0X53, 0X12, 0XCB, 0XC3, 0XF5, 0XC0,
-  0XEC, 0X49, 0X14, 0X85, 0XA3, 0XDE, 0X82, 0X58, 0X53, 0X59, 0X2A, 0X38,
-  0XC6, 0X88, 0XB4, 0XAE, 0XBF, 0XE2, 0XEE, 0XBE, 0X47, 0X4E, 0XBB, 0X20,
-  0X9E, 0X70, 0XBA, 0X10, 0X7E, 0XD8, 0X5D, 0X08, 0X5F, 0X62, 0XE0, 0X99,
-  0XF5, 0X52, 0XC5, 0X50, 0XF7, 0XA1, 0X57, 0XDC, 0XDD, 0X71, 0XEB, 0X1B,
-  0X6A, 0X03, 0XE5, 0X6E, 0XD0, 0X15, 0X8F, 0XE6, 0X39, 0XE9, 0XBB, 0XD3,
-  0X8B, 0X4A, 0X5B, 0XCE, 0X43, 0X89, 0X54, 0XF2, 0X09, 0X23, 0XE2, 0XE0,
-  0X7F, 0XC9, 0XF0, 0X77, 0XFC, 0XAD, 0X49, 0XCF, 0X15, 0X91, 0X36, 0X14,
-  0X4D, 0X30, 0X25, 0XAC, 0XC4, 0X0A, 0XA8, 0X37, 0X1E, 0X6C, 0X76, 0XF8,
-  0X12, 0X53, 0X9D, 0XF6, 0X84, 0X76, 0XC7, 0X3C, 0X81, 0X7D, 0XC5, 0XAD,
-  0X4E, 0X57, 0XF8, 0XDB, 0X4B, 0XCC, 0X7E, 0XEA, 0X03, 0X63, 0XB7, 0X92,
-  0X02, 0XB8, 0XAD, 0X5F, 0XA2, 0XD1, 0X28, 0XD6, 0X15, 0X39, 0X5A, 0XE7,
-  0XB0, 0X1D, 0X2D, 0X18, 0XB7, 0X86, 0X6A, 0X80, 0X0D, 0X07, 0XDC, 0X59,
-  0XDA, 0XA9, 0XE3, 0X13, 0X6A, 0XBF, 0X84, 0X9F, 0X3B, 0X24, 0XBE, 0XF0,
-  0X89, 0XB7, 0X18, 0XE0, 0X09, 0X40, 0X4B, 0XCB, 0X31, 0XC0, 0X95, 0X84,
-  0XEB, 0XDD, 0X42, 0XD1, 0X24, 0X4C, 0X91, 0X75, 0X73, 0X2E, 0X09, 0X06,
-  0X40, 0X69, 0XCA, 0XA4, 0X61, 0XD0, 0XCC, 0X3A, 0X14, 0XFE, 0X8E, 0X69,
-  0X1C, 0X88, 0X51, 0X65, 0X6C, 0X41, 0X8B, 0XBA, 0X07, 0XA1, 0X35, 0XD0,
-  0XEE, 0X2B, 0XE7, 0X7D, 0X8C, 0X5E, 0X59, 0XBD, 0X0B, 0XDF, 0X06, 0XA8,
-  0X73, 0X19, 0X66, 0X00, 0X96, 0X73, 0X60, 0X1D, 0XF6, 0XD3, 0X6B, 0X70,
-  0XAB, 0X4B, 0X20, 0X5C, 0X10, 0XAD, 0X7E, 0X13, 0X05, 0XDD, 0X80, 0X0C,
-  0X43, 0X0F, 0X7D, 0X80, 0XD5, 0XB7, 0X17, 0XBB, 0X1D, 0X9C, 0XD5, 0X25,
-  0XCE, 0XFA, 0X80, 0X83, 0X25, 0X30, 0XA2, 0XC0, 0XAC, 0X21, 0X53, 0X16,
-  0X1A, 0XA7, 0XF3, 0XA4, 0X8A, 0X5A, 0X49, 0XF5, 0XAD, 0X4F, 0X2F, 0X31,
-  0X0B, 0XEE, 0XED, 0XB4, 0X4F, 0X27, 0X84, 0X31, 0XFF, 0X85, 0XDC, 0XB1,
-  0X3E, 0X8B, 0X51, 0XB0, 0X87, 0XE5, 0X42, 0X58, 0X9A, 0X1A, 0X0D, 0XF7,
-  0XE5, 0XC6, 0X32, 0XD5, 0XEB, 0X67, 0X16, 0X36, 0X7A, 0XCE, 0X89, 0X40,
-  0X0A, 0X35, 0XB0, 0X7E, 0X84, 0XF1, 0X03, 0XAE, 0X0C, 0X77, 0XD0, 0XC3,
-  0X0F, 0XCF, 0X00, 0X2D, 0X84, 0X0A, 0XC0, 0X60, 0XB5, 0X88, 0XB3, 0X38,
-  0XE8, 0XC2, 0X00, 0X79, 0XC2, 0XD3, 0XF2, 0X12, 0X70, 0XC9, 0X54, 0X59,
-  0XDA, 0XE0, 0X28, 0X87, 0X52, 0XC0, 0XDA, 0X32, 0X5A, 0X5E, 0XC8, 0XE0,
-  0X05, 0X3D, 0X8C, 0X83, 0X9D, 0XDE, 0X98, 0X82, 0XC6, 0XB1, 0XFE, 0X13,
-  0XA0, 0X49, 0X14, 0XD5, 0X12, 0X76, 0X5A, 0X34, 0X01, 0XC2, 0X24, 0X8E,
-  0X39, 0XDD, 0X09, 0XDF, 0XC8, 0XE1, 0X90, 0XA4, 0X1A, 0X1F, 0XB0, 0X85,
-  0XE8, 0X47, 0XB1, 0X33, 0X78, 0X89, 0X59, 0XA0, 0X01, 0XC4, 0XC6, 0XAC,
-  0X71, 0X3E, 0X0C, 0X8A, 0XA9, 0X7F, 0X8B, 0X6B, 0X12, 0X67, 0XF0, 0X0A,
-  0X7B, 0XE2, 0X9B, 0XF5, 0XF1, 0X61, 0XCE, 0XD9, 0X58, 0X1E, 0XE7, 0X08,
-  0XE1, 0XE2, 0X48, 0XB1, 0X44, 0X8E, 0X86, 0XD5, 0X8F, 0X42, 0XBF, 0X43,
-  0X16, 0X29, 0X72, 0X30, 0XC4, 0X42, 0X24, 0X35, 0XAC, 0X8D, 0X4B, 0XE1,
-  0XFF, 0X2B, 0XDE, 0X18, 0X82, 0XC4, 0X29, 0X26, 0X50, 0XAC, 0X21, 0XD8,
-  0X6F, 0XCC, 0X7A, 0X88, 0XF1, 0XB4, 0X0E, 0X6C, 0X05, 0X66, 0XBF, 0X8B,
-  0X62, 0X33, 0XC5, 0XC4, 0X18, 0X5A, 0X06, 0X46, 0X56, 0X01, 0XC6, 0X67,
-  0XAE, 0X29, 0X3B, 0X9D, 0XD3, 0X30, 0X5A, 0X66, 0X61, 0X33, 0X39, 0X20,
-  0XE5, 0X32, 0X64, 0XD5, 0X42, 0X53, 0X24, 0XCC, 0XE0, 0X39, 0XAC, 0X45,
-  0XCB, 0XC0, 0XFA, 0X4A, 0X9C, 0X6C, 0X60, 0X24, 0XC3, 0XC0, 0X2E, 0X76,
-  0X5D, 0XD8, 0XF4, 0X2F, 0X8A, 0XD5, 0X16, 0XD8, 0X01, 0X60, 0XDA, 0X09,
-  0X3A, 0X8F, 0X19, 0X0A, 0XB0, 0X4E, 0X8A, 0X8A, 0X06, 0X58, 0XB3, 0X3E,
-  0X61, 0XAA, 0X65, 0XDC, 0X80, 0X5A, 0X72, 0X06, 0X84, 0XD4, 0XB0, 0XB9,
-  0X42, 0X6B, 0X6C, 0XF4, 0XF6, 0X4E, 0XA1, 0XAE, 0X87, 0XB6, 0XCE, 0XF3,
-  0X02, 0XCB, 0X72, 0X40, 0XE7, 0X25, 0X41, 0X7E, 0XC5, 0XE3, 0X38, 0XEC,
-  0X67, 0XF7, 0X8A, 0X27, 0XD2, 0X69, 0XDC, 0XA3, 0X02, 0XF6, 0X92, 0X4F,
-  0XFB, 0X93, 0X88, 0XDF, 0XDA, 0XD5, 0X20, 0X0E, 0XDB, 0XD6, 0XC6, 0X96,
-  0XAA, 0XC7, 0XEC, 0X08, 0X78, 0X06, 0XAC, 0XEB, 0X9B, 0XD3, 0XFF, 0X2E,
-  0XD8, 0X8E, 0X5B, 0XFD, 0X00, 0X3F, 0XB7, 0XE4, 0XEE, 0XDD, 0X03, 0XBF,
-  0X29, 0XF2, 0X52, 0X81, 0X5D, 0X08, 0X65, 0X65, 0X77, 0XF2, 0X19, 0XD6,
-  0XE6, 0X41, 0XB5, 0X3E, 0XED, 0XE0, 0X4E, 0X90, 0X59, 0X65, 0XF7, 0XF8,
-  0X46, 0X0E, 0X7D, 0X36, 0XEF, 0X6A, 0XD7, 0XB0, 0XF3, 0X6A, 0X75, 0X95,
-  0XF6, 0XAC, 0XE7, 0XD4, 0XDF, 0X10, 0X39, 0X40, 0XF0, 0XF2, 0X0E, 0X4E,
-  0X70, 0XBA, 0X29, 0X1A, 0X77, 0XB8, 0X34, 0X56, 0XD8, 0XBA, 0X06, 0X7C,
-  0X83, 0XCD, 0X85, 0X4F, 0X1E, 0X14, 0XB3, 0X1E, 0X5E, 0XFA, 0X51, 0X30,
-  0X24, 0X18, 0X81, 0XDD, 0X88, 0X18, 0X52, 0XEA, 0X85, 0XFB, 0XCC, 0XD9,
-  0X00, 0X76, 0X38, 0X0E, 0X13, 0X7F, 0X6B, 0X73, 0X3B, 0X9B, 0X53, 0X27,
-  0X41, 0XF1, 0X5F, 0X32, 0XA3, 0X09, 0XAA, 0X2D, 0X28, 0X5B, 0X5A, 0XC3,
-  0X2C, 0X0C, 0XB0, 0X01, 0X22, 0X57, 0X92, 0X41, 0X64, 0XF1, 0X8A, 0XFD,
-  0X85, 0XF5, 0X4B, 0X64, 0X71, 0X06, 0X42, 0X92, 0X27, 0XAC, 0X3F, 0X6A,
-  0XB7, 0X6B, 0XED, 0XCA, 0X33, 0X46, 0X3C, 0X61, 0XE5, 0X5A, 0XBB, 0X36,
-  0XA8, 0X96, 0X8A, 0XCF, 0X58, 0XE2, 0X09, 0X1B, 0XD6, 0X5A, 0XA5, 0XCE,
-  0X68, 0XF8, 0X8C, 0X25, 0X7F, 0X7E, 0XBF, 0XC0, 0X35, 0X04, 0XF4, 0X9E,
-  0X50, 0XB9, 0X0D, 0X74, 0X97, 0X1C, 0X0C, 0X80, 0X25, 0X42, 0X88, 0XDD,
-  0XCF, 0XAB, 0X64, 0XBB, 0X38, 0XA8, 0X92, 0X8D, 0X12, 0X9A, 0XC6, 0X33,
-  0XA2, 0XD5, 0XA8, 0X59, 0XF3, 0X5D, 0X18, 0X7A, 0XEF, 0XBC, 0X8E, 0XF1,
-  0X23, 0XD5, 0X92, 0X88, 0XA4, 0X49, 0X07, 0X73, 0XFF, 0XF9, 0XE3, 0X0C,
-  0XA0, 0X2A, 0XA2, 0XE8, 0XFD, 0XF4, 0X81, 0X9A, 0X84, 0X02, 0XFD, 0X04,
-  0X90, 0XC4, 0XA9, 0X9D, 0X27, 0X7C, 0X6B, 0X4B, 0XD0, 0X87, 0X77, 0X8C,
-  0XFB, 0X69, 0XF0, 0X58, 0XAF, 0XFE, 0X83, 0XD7, 0XAE, 0X77, 0XF0, 0XE1,
-  0X07, 0X87, 0XDA, 0X0D, 0XB3, 0XDE, 0X37, 0X2C, 0XB7, 0XA0, 0X81, 0X20,
-  0XF4, 0X91, 0X38, 0X50, 0X96, 0X34, 0X00, 0X08, 0X56, 0X61, 0X4C, 0XB8,
-  0X98, 0X28, 0X08, 0X61, 0XEC, 0X75, 0X15, 0X0E, 0X35, 0X36, 0XE4, 0X48,
-  0X6A, 0X38, 0X2A, 0X00, 0X75, 0XD2, 0XAA, 0XC3, 0X56, 0XF3, 0X0A, 0X97,
-  0XB5, 0X13, 0X2D, 0XE4, 0X50, 0XF4, 0X5B, 0XB8, 0XBC, 0XAE, 0X27, 0X1C,
-  0X05, 0X64, 0XBB, 0X51, 0X2E, 0X4C, 0XD9, 0XD2, 0X10, 0X57, 0X93, 0X4C,
-  0X57, 0XB7, 0X4F, 0X38, 0XA3, 0XD2, 0XE7, 0X36, 0X60, 0X06, 0X19, 0XC8,
-  0XDF, 0XB4, 0XD5, 0XAC, 0X1A, 0X86, 0X0A, 0X1E, 0X98, 0X9C, 0X6E, 0X80,
-  0X30, 0XEE, 0X04, 0X08, 0X81, 0XA2, 0X56, 0XC3, 0X4D, 0X00, 0XEB, 0X60,
-  0XF5, 0XE0, 0X3A, 0XF1, 0X50, 0X03, 0XC9, 0X57, 0XC1, 0X5C, 0X2C, 0X80,
-  0XF9, 0X78, 0XB5, 0X06, 0X82, 0X05, 0XAB, 0X20, 0X4E, 0XBC, 0X68, 0XD3,
-  0X2C, 0X2C, 0X42, 0X2E, 0XD8, 0X4B, 0X54, 0X17, 0X5B, 0XA2, 0X43, 0X01,
-  0X07, 0XF8, 0X54, 0XD8, 0X48, 0XBC, 0X26, 0X1B, 0X21, 0X48, 0XEF, 0X08,
-  0X6C, 0X64, 0X8E, 0X84, 0X38, 0XDC, 0X98, 0X9E, 0XA0, 0X7C, 0X12, 0XE1,
-  0XF0, 0XF7, 0X5B, 0XF8, 0XA0, 0X52, 0XDE, 0X8B, 0X8E, 0XF8, 0X1C, 0X9D,
-  0X6D, 0X03, 0X3E, 0X60, 0X2E, 0XE0, 0X87, 0X96, 0XC8, 0XF8, 0XE0, 0X4D,
-  0XDC, 0X8D, 0XD7, 0XDE, 0X9F, 0X20, 0X02, 0X53, 0X3E, 0X48, 0XC0, 0X48,
-  0X5D, 0X11, 0XB9, 0XA8, 0XA8, 0X2C, 0X4F, 0X52, 0X82, 0X98, 0XF8, 0X8A,
-  0X63, 0X11, 0X2F, 0X57, 0X23, 0X18, 0XFE, 0XDD, 0XCD, 0X17, 0X37, 0X04,
-  0XE2, 0X93, 0X1B, 0X80, 0X51, 0X4C, 0X7B, 0X9D, 0X6E, 0X30, 0XF7, 0XFA,
-  0X03, 0X56, 0XA4, 0X23, 0XF1, 0X03, 0X2B, 0XC1, 0X4B, 0XFD, 0X7E, 0XA7,
-  0XFF, 0X8C, 0X51, 0XB4, 0X2C, 0X2B, 0X86, 0XC5, 0X2B, 0XC7, 0X33, 0X21,
-  0X82, 0XA2, 0XF8, 0X35, 0X06, 0XE0, 0XB7, 0X39, 0X52, 0X14, 0X07, 0X96,
-  0X2D, 0XD4, 0X43, 0X3E, 0X93, 0XE8, 0X3B, 0XC1, 0X60, 0XF8, 0X90, 0X7B,
-  0X69, 0X7E, 0X42, 0X85, 0X98, 0X03, 0X4D, 0XFB, 0X85, 0XE5, 0X8C, 0X5A,
-  0X56, 0X33, 0X30, 0X66, 0XD3, 0X79, 0X65, 0X67, 0X0D, 0XB1, 0X62, 0X61,
-  0X3F, 0X12, 0X4E, 0XDD, 0X6C, 0X41, 0X7A, 0XB5, 0XFE, 0XFE, 0XC0, 0XD4,
-  0XB6, 0X99, 0XBE, 0X39, 0X79, 0XDF, 0X32, 0X61, 0XB7, 0XE6, 0XF5, 0X6C,
-  0X7A, 0X17, 0X98, 0X3A, 0XFC, 0X06, 0X30, 0X70, 0X3F, 0X43, 0XCB, 0XD0,
-  0X85, 0X4E, 0XD6, 0XE1, 0XC9, 0X6B, 0X5C, 0XBF, 0X70, 0X89, 0X27, 0XEF,
-  0X73, 0X7B, 0X8D, 0XC8, 0X34, 0X86, 0X70, 0X07, 0X1A, 0X7F, 0X72, 0X0B,
-  0XE2, 0X93, 0X9F, 0XB8, 0X5D, 0X3E, 0XFC, 0X42, 0X9A, 0X1D, 0X27, 0X79,
-  0X17, 0XC9, 0X36, 0XF0, 0X3F, 0X46, 0XB1, 0XED, 0X29, 0X82, 0X89, 0X0B,
-  0XF4, 0X19, 0X76, 0X69, 0XC1, 0XE5, 0X7F, 0X90, 0X56, 0XC2, 0XA7, 0X98,
-  0XD3, 0X9D, 0XDA, 0XA5, 0X8F, 0XA6, 0XFE, 0X6F, 0X6C, 0X24, 0XAF, 0X41,
-  0XA4, 0X28, 0X07, 0XEB, 0XE7, 0XCF, 0XAB, 0X27, 0X56, 0X05, 0XE0, 0X1A,
-  0XF2, 0X5F, 0XFE, 0XC3, 0X7E, 0X5E, 0X39, 0X1B, 0X44, 0XE6, 0X2D, 0X6F,
-  0XE3, 0X91, 0X76, 0XDB, 0X69, 0X61, 0X68, 0XD4, 0XA5, 0XD8, 0X3F, 0XC8,
-  0X0A, 0XDB, 0X32, 0X01, 0XDE, 0X33, 0X3C, 0X86, 0X2A, 0X43, 0X51, 0X8C,
-  0XE2, 0X39, 0X98, 0X51, 0XF3, 0X34, 0X0A, 0X61, 0X81, 0X97, 0XE3, 0X30,
-  0X3B, 0X1C, 0X06, 0XE1, 0X00, 0XC8, 0X55, 0X24, 0X57, 0X28, 0XDC, 0XB5,
-  0X12, 0X22, 0X09, 0X76, 0XC3, 0X86, 0X9E, 0XD7, 0X15, 0X3B, 0X03, 0X60,
-  0XD6, 0XD4, 0XCE, 0X1C, 0XBE, 0XE4, 0XA5, 0XCB, 0X4F, 0X7F, 0XBF, 0XC1,
-  0X9B, 0X73, 0X84, 0XF2, 0X18, 0X77, 0X9C, 0XCC, 0X26, 0X1C, 0X3C, 0XAB,
-  0X6B, 0X87, 0XAE, 0XE6, 0X55, 0X39, 0X39, 0X84, 0X57, 0X4A, 0X50, 0XC8,
-  0X71, 0X1E, 0X44, 0X0A, 0XCF, 0XB1, 0X18, 0X91, 0X4F, 0X44, 0X89, 0X4C,
-  0X2E, 0X9A, 0X8A, 0X12, 0X31, 0X4B, 0X5A, 0XC0, 0X4B, 0X43, 0X33, 0XB9,
-  0XCB, 0XE8, 0XC1, 0X09, 0X02, 0X86, 0X96, 0XE7, 0XC5, 0X91, 0X07, 0X9B,
-  0X23, 0X0F, 0X86, 0X5F, 0X80, 0XEA, 0X9C, 0XCC, 0X3A, 0XEB, 0XFF, 0XE9,
-  0X8D, 0X63, 0XAE, 0XFC, 0XC0, 0X79, 0XD1, 0X20, 0X61, 0X0A, 0X89, 0X80,
-  0XD9, 0X4E, 0X52, 0XA0, 0X2C, 0XFC, 0XF6, 0X5D, 0X2F, 0X1C, 0X86, 0XF4,
-  0XB2, 0X4D, 0X4B, 0X5C, 0X08, 0XB7, 0X21, 0XF1, 0X70, 0XD8, 0XCB, 0X3A,
-  0XFB, 0X79, 0X14, 0XA5, 0X12, 0X51, 0X3B, 0X93, 0X80, 0X34, 0XC3, 0X5C,
-  0X02, 0XBF, 0XDA, 0X97, 0X0B, 0X12, 0X3D, 0XB6, 0XFA, 0X8C, 0XF8, 0X86,
-  0X07, 0X0B, 0X8E, 0X14, 0XED, 0XEC, 0X2E, 0X7C, 0X4D, 0X0A, 0XEA, 0XCD,
-  0X8E, 0XFB, 0X12, 0X80, 0X5C, 0X74, 0XD7, 0X4E, 0XA0, 0XDC, 0X24, 0X80,
-  0X88, 0XCB, 0X13, 0XC5, 0XBE, 0XBD, 0X5E, 0X44, 0XBC, 0X17, 0X7C, 0X78,
-  0X50, 0X6D, 0XBA, 0X4E, 0X76, 0XEE, 0XE4, 0X89, 0X97, 0X6A, 0X81, 0X3F,
-  0XAA, 0X95, 0X37, 0X57, 0X7D, 0X12, 0X74, 0X30, 0XAD, 0X56, 0XB3, 0X3D,
-  0X56, 0XC8, 0X1D, 0XE8, 0X87, 0X2F, 0X3B, 0XC9, 0XDF, 0XC3, 0XEC, 0X73,
-  0XEA, 0X79, 0XB1, 0XBC, 0XFF, 0X87, 0X19, 0XB4, 0X8B, 0X13, 0XEE, 0X8D,
-  0X8D, 0X44, 0X02, 0X05, 0XD3, 0X1B, 0XC1, 0XFC, 0X75, 0X07, 0X57, 0X50,
-  0XA1, 0XF8, 0X8E, 0XAD, 0X70, 0X17, 0X4F, 0X83, 0XF5, 0XC2, 0X72, 0X96,
-  0XBA, 0X1D, 0X6C, 0X3C, 0XEC, 0X29, 0XEF, 0X52, 0X27, 0XAF, 0X40, 0X5C,
-  0X08, 0XC2, 0X03, 0X59, 0X19, 0XCC, 0XBB, 0X7C, 0X52, 0XBB, 0X47, 0X70,
-  0X7D, 0XCA, 0XB5, 0X4F, 0X50, 0X58, 0XD5, 0X09, 0X2F, 0X4D, 0X76, 0X20,
-  0X0D, 0X82, 0XF2, 0X97, 0XB9, 0XF6, 0XE6, 0X16, 0X01, 0XDB, 0XB2, 0XDE,
-  0X88, 0XAF, 0X21, 0X88, 0X5B, 0X6A, 0XBC, 0X31, 0X33, 0X7C, 0X7B, 0XE5,
-  0X46, 0XCE, 0X81, 0X91, 0X53, 0X18, 0X88, 0XFA, 0X15, 0X05, 0XAE, 0XFC,
-  0XBC, 0X43, 0X8D, 0X0F, 0XB0, 0X4F, 0XFC, 0XE0, 0X13, 0XE8, 0X7C, 0X36,
-  0XF3, 0XB9, 0XEC, 0X70, 0XD7, 0XDC, 0X27, 0X70, 0X9F, 0XD9, 0X2D, 0X66,
-  0X57, 0X81, 0X92, 0XEA, 0X3C, 0XBD, 0XE6, 0X42, 0X5E, 0XA9, 0X7B, 0XBA,
-  0X33, 0XCB, 0XF9, 0X85, 0X35, 0X58, 0X05, 0X92, 0XFB, 0X78, 0X07, 0X41,
-  0X03, 0X69, 0XEF, 0X4A, 0X6B, 0X81, 0XFD, 0XE7, 0XE8, 0X86, 0X25, 0X9C,
-  0XBB, 0XA8, 0X06, 0X80, 0XF7, 0XED, 0X76, 0X60, 0X38, 0XEB, 0X60, 0X1D,
-  0XB5, 0X1B, 0XED, 0XCE, 0XA4, 0X8D, 0X3F, 0X66, 0XD3, 0X03, 0XB4, 0X28,
-  0XF2, 0X8A, 0X39, 0X99, 0XAD, 0X4B, 0X89, 0X2E, 0X0C, 0X96, 0XDB, 0XA2,
-  0X61, 0X77, 0X98, 0X4A, 0XE7, 0X08, 0XEA, 0XC2, 0X6F, 0X38, 0XA5, 0X45,
-  0X74, 0X60, 0X02, 0X1C, 0XE2, 0X01, 0X33, 0X80, 0X8C, 0X61, 0X34, 0XB6,
-  0XE3, 0X05, 0X91, 0X0B, 0X47, 0XA3, 0X6E, 0X85, 0XFC, 0XEA, 0X8A, 0XCC,
-  0XA3, 0XC4, 0XBE, 0X18, 0XFC, 0X1B, 0XD0, 0XD1, 0XE2, 0X4B, 0X0C, 0XFC,
-  0X02, 0X3F, 0X14, 0X3C, 0X9F, 0XFA, 0XE0, 0X13, 0XFA, 0X70, 0XB1, 0XA9,
-  0XBF, 0XA1, 0XF0, 0X33, 0X3F, 0X18, 0X1C, 0XAA, 0X75, 0XDC, 0X2C, 0X7E,
-  0XF8, 0X88, 0X33, 0X88, 0X03, 0X31, 0X0C, 0X45, 0X82, 0X02, 0XAA, 0XD3,
-  0X81, 0X1F, 0X2F, 0X67, 0X6C, 0X51, 0XF8, 0X5B, 0X93, 0X93, 0X97, 0X06,
-  0XFF, 0X1D, 0X01, 0X08, 0X40, 0X08, 0X52, 0XF1, 0XA0, 0X4A, 0X01, 0XAA,
-  0XFC, 0X69, 0XEE, 0X0A, 0X1C, 0X03, 0X64, 0X17, 0XE4, 0X87, 0X16, 0X2F,
-  0X43, 0X7F, 0X18, 0XDA, 0X1F, 0X01, 0XF9, 0X1B, 0XFA, 0X2B, 0X5C, 0XB0,
-  0X92, 0XA7, 0X09, 0X73, 0XD3, 0X00, 0XE1, 0XA6, 0XC0, 0X82, 0XD0, 0X58,
-  0XC0, 0X62, 0X70, 0XBA, 0X3B, 0X87, 0X28, 0X32, 0X05, 0XAB, 0XC5, 0X30,
-  0XDE, 0XB6, 0X8A, 0XA4, 0XA4, 0X6A, 0X9F, 0XBB, 0X05, 0X60, 0X40, 0XF4,
-  0XB2, 0X1F, 0XBA, 0X2E, 0XB0, 0XB7, 0X88, 0X66, 0XFF, 0XB8, 0X3D, 0X5E,
-  0X03, 0X08, 0XFE, 0XCE, 0XF8, 0XF9, 0X2F, 0X13, 0X60, 0X13, 0XEF, 0X91,
-  0X4A, 0XB8, 0XFD, 0X43, 0X6E, 0X6F, 0X14, 0X41, 0X64, 0XC9, 0X72, 0X5A,
-  0XC8, 0XFE, 0X33, 0X82, 0XE1, 0X28, 0X8B, 0X1E, 0X84, 0XCE, 0X9B, 0XAB,
-  0X9B, 0X73, 0X24, 0X1C, 0X21, 0XB8, 0XAB, 0XF1, 0X27, 0XB4, 0XB9, 0XC9,
-  0X44, 0X38, 0X98, 0XDD, 0XB4, 0X0A, 0X72, 0X1A, 0X96, 0X02, 0X9A, 0XC8,
-  0X86, 0XEC, 0XA9, 0X03, 0X80, 0X9D, 0XF4, 0X62, 0X65, 0X09, 0XD5, 0X0A,
-  0X08, 0X55, 0X06, 0XFC, 0X88, 0X44, 0XC2, 0X7F, 0X05, 0XA6, 0XE0, 0X0E,
-  0X27, 0XBC, 0X96, 0XC7, 0X84, 0X92, 0X3C, 0X54, 0XAA, 0XDC, 0XFE, 0X4C,
-  0XF9, 0X9F, 0X88, 0XD2, 0X24, 0XF8, 0XDF, 0XEA, 0X47, 0X18, 0X9A, 0XA5,
-  0X67, 0XDC, 0X9F, 0X8C, 0X9F, 0X77, 0XAE, 0X64, 0X7E, 0X63, 0X29, 0XF6,
-  0X06, 0X7B, 0X78, 0X7C, 0X41, 0X49, 0XFE, 0X07, 0XF6, 0X0D, 0X4B, 0XA4,
-  0XD3, 0XF7, 0X32, 0X0E, 0XE2, 0X0B, 0X98, 0XED, 0X0E, 0X13, 0XE4, 0X41,
-  0XE6, 0XA7, 0XD3, 0X3F, 0XBF, 0XAE, 0X6A, 0XF0, 0XA8, 0X45, 0X44, 0XD1,
-  0X14, 0XFE, 0XFD, 0X97, 0X93, 0X62, 0X07, 0XED, 0XEF, 0XCC, 0X8A, 0X4F,
-  0XB6, 0X81, 0X13, 0X6F, 0X95, 0X01, 0X38, 0X31, 0X8A, 0X64, 0XE2, 0XC2,
-  0X1A, 0X63, 0XA1, 0XEB, 0X03, 0X18, 0XC0, 0X03, 0X46, 0X34, 0X59, 0X4E,
-  0X87, 0X28, 0XFD, 0X8C, 0XA3, 0XEF, 0X99, 0X8D, 0X0F, 0X9E, 0X85, 0X20,
-  0X82, 0X40, 0X3C, 0X24, 0X18, 0X9C, 0X84, 0XBD, 0XBE, 0X61, 0XE8, 0XE7,
-  0XBF, 0X5F, 0X5F, 0X31, 0XCE, 0XAF, 0XB8, 0X08, 0X08, 0X44, 0XD7, 0X74,
-  0X9A, 0X80, 0X61, 0X80, 0X35, 0X92, 0XB2, 0X45, 0X59, 0XBA, 0X85, 0XF4,
-  0XD2, 0XE4, 0XFD, 0X04, 0XE0, 0X3A, 0X77, 0X17, 0X69, 0X51, 0XD5, 0XD4,
-  0XF9, 0XD0, 0XE7, 0X53, 0XD2, 0X2C, 0X7B, 0X63, 0X3E, 0XDF, 0X18, 0XE1,
-  0X7C, 0XE9, 0XC5, 0X45, 0X49, 0X2C, 0X06, 0X7C, 0XDC, 0X15, 0X19, 0X18,
-  0X58, 0XF6, 0X37, 0XC2, 0X93, 0X8F, 0XFB, 0XB2, 0X5E, 0X44, 0XDE, 0X09,
-  0X40, 0X03, 0X43, 0X73, 0XB3, 0XAA, 0XD3, 0X56, 0X40, 0X52, 0X7D, 0X5A,
-  0X6E, 0XD4, 0X0E, 0XD8, 0X30, 0X18, 0XF5, 0X83, 0X24, 0X41, 0X83, 0XCF,
-  0XFE, 0X66, 0X25, 0XEC, 0X9E, 0X19, 0XBC, 0X13, 0X5C, 0X96, 0XFD, 0X7E,
-  0XFE, 0XEE, 0X02, 0X88, 0X8B, 0XE9, 0X3E, 0X61, 0X08, 0X74, 0X1D, 0XE4,
-  0XF9, 0X49, 0XC8, 0X7D, 0X54, 0X62, 0X0F, 0X30, 0X4F, 0X81, 0XC5, 0XBD,
-  0X91, 0X06, 0X18, 0X78, 0X1E, 0XF4, 0X67, 0XFC, 0X87, 0XFB, 0XC4, 0XE7,
-  0X6A, 0X3F, 0XA3, 0X1E, 0X33, 0XEC, 0X1D, 0X4A, 0X78, 0X86, 0X7E, 0X76,
-  0XC8, 0X87, 0X6E, 0XE6, 0X84, 0XA3, 0XE8, 0X52, 0X42, 0X20, 0XCA, 0XC4,
-  0X43, 0X28, 0X4F, 0XE7, 0X86, 0XB7, 0X91, 0X26, 0X1F, 0XA3, 0XD3, 0X29,
-  0X32, 0XFA, 0X61, 0XBD, 0X3B, 0XC0, 0X05, 0XB0, 0X2E, 0XFB, 0XDA, 0XED,
-  0X0C, 0X82, 0X0C, 0X2C, 0X90, 0X91, 0X6F, 0XD6, 0XCC, 0XD7, 0X36, 0XD6,
-  0X41, 0X82, 0X6C, 0XA7, 0X77, 0X33, 0X3D, 0X21, 0XB7, 0X80, 0X4E, 0X59,
-  0XAD, 0X18, 0X02, 0XD6, 0X66, 0X7C, 0XD4, 0X32, 0X1C, 0X95, 0X68, 0X68,
-  0X60, 0XA1, 0X15, 0X3B, 0XB1, 0XC2, 0XB2, 0XA8, 0XB0, 0X68, 0XEA, 0X53,
-  0XE0, 0X46, 0X4B, 0XD5, 0X84, 0XA5, 0X20, 0XD3, 0X62, 0XD3, 0XD6, 0X69,
-  0X38, 0X93, 0XAD, 0XE0, 0XDF, 0XCF, 0X90, 0X2E, 0X7A, 0X4D, 0X15, 0X96,
-  0XCD, 0X88, 0X38, 0X56, 0X2B, 0XEA, 0XA7, 0XC7, 0X28, 0X53, 0XC0, 0X42,
-  0XE7, 0XB1, 0X20, 0XF8, 0X20, 0XAE, 0X6C, 0X03, 0X7C, 0X8D, 0X0C, 0X5D,
-  0X3C, 0XEC, 0XFB, 0X67, 0X1F, 0XEF, 0XD0, 0X0E, 0XE0, 0XFA, 0XCF, 0X93,
-  0X80, 0X65, 0X01, 0XFE, 0XA5, 0XB0, 0X39, 0XBD, 0X32, 0X0E, 0X98, 0X4C,
-  0XC3, 0X65, 0XD3, 0X40, 0X62, 0XB4, 0X03, 0X00, 0X93, 0X04, 0X6E, 0XA5,
-  0X33, 0X1C, 0X7C, 0X0C, 0X2C, 0X84, 0X9B, 0XD8, 0XC7, 0X74, 0XEA, 0X34,
-  0X2C, 0X50, 0XA3, 0X7E, 0X51, 0X2D, 0X7E, 0X59, 0XCD, 0X02, 0X75, 0XE2,
-  0X97, 0XB5, 0X2C, 0X58, 0X21, 0X2E, 0X75, 0XCC, 0X2B, 0X2E, 0X40, 0X42,
-  0XFE, 0XE5, 0XDE, 0X5C, 0X10, 0X82, 0X96, 0X68, 0X86, 0X0F, 0X01, 0X41,
-  0X80, 0X7F, 0XCB, 0X95, 0XE5, 0XF6, 0X61, 0X28, 0X8D, 0X5E, 0X29, 0X70,
-  0XA1, 0X44, 0XDB, 0X09, 0XC1, 0X7E, 0X20, 0XC1, 0X73, 0X09, 0X85, 0X9B,
-  0XF1, 0X30, 0XA8, 0XD5, 0X2C, 0XFD, 0X2B, 0XD2, 0X06, 0X0D, 0XAF, 0X7D,
-  0X78, 0X10, 0XBA, 0XD8, 0XFC, 0XEC, 0XDD, 0XA5, 0X27, 0X3F, 0X38, 0XFB,
-  0XF2, 0X9C, 0X97, 0XFF, 0XBE, 0X90, 0X36, 0X5B, 0X9E, 0XBD, 0X8C, 0XBD,
-  0X00, 0X55, 0XAD, 0X13, 0XE7, 0X67, 0X2F, 0XAB, 0XAE, 0X80, 0X00, 0X7B,
-  0X9E, 0XDD, 0XFA, 0X7B, 0X86, 0X8E, 0XEA, 0X20, 0X83, 0XE2, 0X42, 0XA9,
-  0X27, 0X0C, 0XB2, 0XC3, 0X4D, 0X55, 0XFC, 0X47, 0X38, 0XEC, 0X0E, 0XEB,
-  0XFE, 0XE5, 0XEB, 0X64, 0X5F, 0XE1, 0X3F, 0XC7, 0XF1, 0X39, 0XE7, 0X28,
-  0X16, 0XA3, 0XE0, 0X3F, 0XB7, 0X83, 0X75, 0XC6, 0XA1, 0X0B, 0XA8, 0X21,
-  0X17, 0X4F, 0X7D, 0X60, 0XAC, 0X63, 0X19, 0X7A, 0XE7, 0XA2, 0XE8, 0X19,
-  0XD8, 0XAF, 0XF3, 0XA7, 0X4B, 0X13, 0XF5, 0X40, 0X55, 0XE0, 0XEF, 0X58,
-  0XCC, 0X20, 0X73, 0X79, 0XB6, 0X50, 0XBE, 0X47, 0X54, 0X57, 0X37, 0X67,
-  0XBE, 0X40, 0X39, 0XFC, 0X6F, 0XDC, 0X58, 0X44, 0XB8, 0XCB, 0XFC, 0X28,
-  0XF0, 0X34, 0X4E, 0X05, 0X5F, 0XCF, 0XF1, 0XC7, 0X93, 0XFF, 0XCD, 0X9F,
-  0X70, 0X40, 0XC1, 0XC7, 0X75, 0X25, 0XEB, 0XAE, 0X52, 0XF3, 0XAD, 0X4B,
-  0X01, 0XBF, 0XB2, 0X69, 0XD5, 0X12, 0X59, 0X0C, 0XDA, 0X34, 0X48, 0XDC,
-  0XAD, 0XFD, 0X0A, 0X5C, 0XD3, 0X43, 0XE5, 0X41, 0XEF, 0XE5, 0X20, 0X89,
-  0X66, 0X3E, 0X68, 0X15, 0X86, 0X5B, 0X17, 0X35, 0X2A, 0XF8, 0X42, 0X47,
-  0XC6, 0XE2, 0XF2, 0X8D, 0X9D, 0XF9, 0XFB, 0X3D, 0XFE, 0X80, 0X7F, 0X04,
-  0XDD, 0XE7, 0X9D, 0X0A, 0XA9, 0XF3, 0X79, 0X8E, 0X6C, 0X97, 0X77, 0XE7,
-  0X9D, 0X2C, 0XDC, 0X55, 0XDA, 0XC9, 0X9C, 0XEB, 0X38, 0X44, 0XF8, 0XEA,
-  0XAF, 0XCD, 0X23, 0XFA, 0XBD, 0X49, 0XB7, 0X77, 0XD9, 0X7F, 0X5A, 0XB3,
-  0X00, 0X4B, 0XF9, 0XC3, 0XF7, 0XBC, 0XC8, 0X21, 0XC2, 0X01, 0XCB, 0XFC,
-  0X2D, 0X62, 0X20, 0XCF, 0XFE, 0X39, 0X6A, 0XFC, 0X70, 0XFF, 0XB8, 0X41,
-  0X21, 0XDA, 0XBB, 0XBB, 0XC8, 0X23, 0X2E, 0X49, 0X74, 0X86, 0X5B, 0X7B,
-  0X0C, 0X70, 0X0C, 0X0C, 0X78, 0XCC, 0X8D, 0XAC, 0X31, 0XC5, 0XD3, 0X1A,
-  0X05, 0X0B, 0X35, 0XF7, 0X22, 0X0B, 0X5E, 0XAF, 0XEF, 0X8A, 0X20, 0X0A,
-  0X1F, 0X89, 0XFA, 0X60, 0X64, 0XE3, 0X53, 0XE9, 0XF1, 0XBB, 0XC0, 0XF5,
-  0XCD, 0X9A, 0XEE, 0X06, 0XA3, 0X40, 0X7A, 0X17, 0X12, 0XB0, 0XFF, 0XC6,
-  0X88, 0X4C, 0X18, 0X43, 0X69, 0XDA, 0X75, 0X16, 0X6A, 0X09, 0X75, 0XE4,
-  0XF5, 0XEA, 0X98, 0XC6, 0X07, 0X20, 0X06, 0XCB, 0X58, 0X6F, 0XA8, 0XC2,
-  0X8F, 0XFD, 0X17, 0XBC, 0X56, 0X75, 0XA6, 0X1F, 0X96, 0X82, 0XB0, 0X17,
-  0XF4, 0X3E, 0X08, 0X87, 0X05, 0XF7, 0XEA, 0XE6, 0XC1, 0X75, 0XCD, 0XE4,
-  0X34, 0XDB, 0X2F, 0X8B, 0XDE, 0X67, 0X45, 0X76, 0XE7, 0X1E, 0XEC, 0X45,
-  0X0A, 0XF9, 0XC0, 0X61, 0X97, 0X1F, 0X06, 0XC8, 0X9F, 0X16, 0X49, 0X81,
-  0X20, 0XF3, 0XC4, 0X06, 0X18, 0X7D, 0XDA, 0X7A, 0X7D, 0XE2, 0XDD, 0X05,
-  0X8F, 0XFF, 0XCE, 0X4C, 0X83, 0X21, 0X79, 0X39, 0X15, 0XD2, 0XDA, 0XAF,
-  0X9E, 0X2B, 0X54, 0X0A, 0XC3, 0XDA, 0XBA, 0X7B, 0X2E, 0X4B, 0XFF, 0X4E,
-  0X13, 0X61, 0X21, 0XE7, 0XA1, 0XAD, 0X55, 0X18, 0X1E, 0XFE, 0X82, 0X89,
-  0XCF, 0XF3, 0XD9, 0X42, 0XF1, 0XD5, 0X2B, 0X83, 0X68, 0XAA, 0XB4, 0XCE,
-  0X33, 0X34, 0XBA, 0X44, 0XC3, 0X1E, 0XA0, 0XE2, 0X49, 0XB4, 0XF1, 0X8C,
-  0XFF, 0X0E, 0XDA, 0XFF, 0XE3, 0X15, 0X88, 0XFF, 0XB8, 0X37, 0XED, 0XF4,
-  0X00, 0X71, 0XD6, 0X7F, 0XA5, 0XBE, 0X0E, 0XF3, 0XB1, 0XB3, 0XC0, 0XBF,
-  0XBE, 0X50, 0X49, 0X90, 0XF9, 0X62, 0X40, 0X48, 0X2B, 0X0A, 0XF2, 0X3A,
-  0XB8, 0X84, 0X8E, 0XD3, 0XEE, 0XC8, 0XF3, 0X34, 0XE0, 0XE2, 0XFC, 0X80,
-  0XD7, 0XB8, 0X05, 0X8C, 0X27, 0XC0, 0X6B, 0XC3, 0XD4, 0XB8, 0X28, 0X84,
-  0XF3, 0X1F, 0XE7, 0XB8, 0XE6, 0XA2, 0XB2, 0XB3, 0X0E, 0X95, 0XBA, 0X14,
-  0XC8, 0XEB, 0X16, 0X20, 0XEF, 0XBC, 0XA0, 0X8D, 0X67, 0XC0, 0X98, 0XFD,
-  0X43, 0XD4, 0XB9, 0X86, 0X7C, 0X42, 0X9F, 0X05, 0X19, 0X34, 0XF6, 0X8A,
-  0XC6, 0X2A, 0X05, 0X88, 0X9C, 0X5E, 0X52, 0XF9, 0XCB, 0XB2, 0XA5, 0X5A,
-  0X82, 0X75, 0XE2, 0XC9, 0XE9, 0X32, 0XB5, 0X25, 0X38, 0XEA, 0XDB, 0XD7,
-  0X4D, 0XE2, 0X5E, 0XD6, 0XAD, 0X69, 0X10, 0XC7, 0X1D, 0X59, 0XD4, 0X2F,
-  0X44, 0XE5, 0X3E, 0X77, 0X76, 0XC3, 0X8D, 0XB9, 0X30, 0XDF, 0XF6, 0X0C,
-  0X97, 0X9E, 0X1E, 0XF8, 0X3F, 0XE8, 0XFE, 0XD2, 0X71, 0XE8, 0XFD, 0X52,
-  0X79, 0XBF, 0X02, 0XB1, 0X17, 0X37, 0XFE, 0X3F, 0X32, 0X1E, 0XE4, 0X9E,
-  0X7E, 0X7E, 0X01, 0X53, 0X35, 0XA0, 0XD2, 0X27, 0XD3, 0XE0, 0X9E, 0XFA,
-  0XAC, 0XF1, 0X31, 0X08, 0XE4, 0XAF, 0XF3, 0XAE, 0X95, 0XA3, 0X5F, 0X5D,
-  0X0A, 0X6D, 0X7F, 0X91, 0X31, 0X84, 0XC7, 0XE3, 0XB8, 0X93, 0X3F, 0X46,
-  0X0D, 0XC5, 0X8A, 0X6E, 0X42, 0XC0, 0XFF, 0X87, 0XED, 0X04, 0XF3, 0X5B,
-  0XC2, 0X3F, 0X00, 0X0F, 0XFC, 0XFE, 0X1C, 0X27, 0XDE, 0X63, 0X37, 0X02,
-  0X2F, 0XF8, 0X9F, 0X6F, 0XA7, 0X78, 0XBE, 0X2C, 0X70, 0X75, 0XB7, 0XC3,
-  0X5D, 0XAB, 0XB2, 0X32, 0XAC, 0XF0, 0X17, 0XDD, 0XF0, 0XF0, 0XDE, 0X36,
-  0XB6, 0XA0, 0XBC, 0X5F, 0X69, 0XC4, 0XC3, 0XBF, 0XFB, 0XA6, 0X87, 0X87,
-  0X86, 0X13, 0XDC, 0XE7, 0X54, 0X3C, 0X98, 0X95, 0X02, 0X66, 0X67, 0XE2,
-  0X3E, 0X57, 0XCE, 0X39, 0X2F, 0XF3, 0X43, 0X7F, 0XE2, 0XF6, 0XF7, 0XF7,
-  0XFA, 0X9D, 0XCA, 0XA8, 0XF4, 0X01, 0X2C, 0X68, 0XC8, 0X66, 0X4C, 0X18,
-  0X9A, 0XB9, 0XC0, 0X2F, 0XF7, 0XC1, 0X97, 0XC0, 0X94, 0X0D, 0X47, 0XFD,
-  0XD2, 0X47, 0XA7, 0XDD, 0X9C, 0XB9, 0X86, 0XFD, 0XF8, 0XAD, 0X37, 0X4D,
-  0XBC, 0X7B, 0X88, 0X02, 0XD0, 0XDF, 0XC0, 0XBB, 0XF4, 0XEF, 0XBB, 0X74,
-  0XE2, 0X59, 0X00, 0X80, 0XF8, 0X1D, 0XE4, 0X13, 0X89, 0XDF, 0XBD, 0XF7,
-  0XF6, 0X4B, 0XAA, 0XD3, 0X2A, 0XD4, 0XDA, 0X60, 0X6C, 0XB3, 0X79, 0XEF,
-  0XBE, 0X07, 0XDE, 0X9B, 0XF1, 0X30, 0XC6, 0XB9, 0XBF, 0XED, 0XBA, 0X06,
-  0X76, 0X87, 0X6E, 0XFE, 0XF4, 0X3F, 0X6B, 0XBC, 0X58, 0X37, 0XED, 0XFE,
-  0X64, 0X95, 0XAE, 0X7E, 0XC1, 0XAE, 0X59, 0XA7, 0X7D, 0XAE, 0XD0, 0X80,
-  0X15, 0X74, 0X68, 0X2C, 0X3D, 0XC7, 0X70, 0XD7, 0X53, 0X9D, 0X6A, 0XA2,
-  0XA7, 0XF3, 0X5E, 0X0B, 0XA3, 0X53, 0X1F, 0XF5, 0X9A, 0X3A, 0XE8, 0X2C,
-  0XED, 0XAF, 0XDE, 0X06, 0X87, 0X2E, 0X16, 0XC0, 0X25, 0X7B, 0XAC, 0XA7,
-  0X27, 0X91, 0XB0, 0X12, 0X44, 0X3F, 0X08, 0X3B, 0X48, 0XB1, 0XC8, 0XF0,
-  0X85, 0X70, 0XCE, 0X16, 0X00, 0X14, 0X2C, 0XE6, 0XDC, 0X79, 0X40, 0X77,
-  0XC9, 0X30, 0XF7, 0X99, 0XB9, 0X85, 0X38, 0XEC, 0X2D, 0XF0, 0X9E, 0XF7,
-  0XEE, 0X25, 0XE6, 0X7C, 0X6B, 0XF0, 0X25, 0X36, 0X57, 0XD8, 0X03, 0XFC,
-  0XC9, 0X1B, 0X92, 0XF8, 0XF6, 0XBF, 0XF9, 0XF6, 0X2A, 0X39, 0XC1, 0X91,
-  0X00, 0X00
-};
-unsigned int page_index_len = 18374;
-
-
@@ -0,0 +1,46 @@
+#!/bin/bash
+#
+# Converts all files from assets/ into gzipped arrays and builds table of assets
+# with content type and strong ETag. Result is written into pages/page_assets.h.
+# Run it after every change of web assets.
+
+set -e
+
+component_dir="$(cd "$(dirname "$0")/.." && pwd)"
+assets_location="$component_dir/assets"
+output_filename="$component_dir/pages/page_assets.h"
+work_dir=$(mktemp -d)
+trap 'rm -rf "$work_dir"' EXIT
+
+table=""
+echo "// This file was generated using utils/convert_assets_to_header_file.sh" > "$output_filename"
+
+for asset in "$assets_location"/*; do
+    name=$(basename "$asset")
+    array_name="asset_$(echo "$name" | tr -c 'a-zA-Z0-9\n' '_')"
+
+    case "$name" in
+        *.html) content_type="text/html" ;;
+        *.js)   content_type="application/javascript" ;;
+        *.css)  content_type="text/css" ;;
+        *.png)  content_type="image/png" ;;
+        *.svg)  content_type="image/svg+xml" ;;
+        *)      content_type="application/octet-stream" ;;
+    esac
+
+    path="/$name"
+    if [ "$name" == "index.html" ] ; then
+        path="/"
+    fi
+
+    # -n keeps gzip output independent of file timestamps, so ETag changes only with content
+    gzip --best -n -c "$asset" > "$work_dir/$array_name"
+    etag=$(sha256sum "$work_dir/$array_name" | cut -c 1-16)
+    (cd "$work_dir" && xxd -i -u "$array_name") \
+        | sed 's/^unsigned char/static const unsigned char/; /_len = /d' >> "$output_filename"
+
+    table="$table    { \"$path\", \"$content_type\", \"\\\"$etag\\\"\", $array_name, sizeof($array_name) },\n"
+    echo "$path -> $array_name ($content_type, $(stat -c %s "$work_dir/$array_name") B gzipped)"
+done
+
+echo -e "\nstatic const webserver_asset_t page_assets[] = {\n$table};" >> "$output_filename"
@@ -15,39 +15,102 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_event.h"
+#include "esp_heap_caps.h"
 #include "esp_http_server.h"
+#include "esp_timer.h"
 #include "esp_wifi_types.h"
 
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+
 #include "wifi_controller.h"
 #include "attack.h"
 #include "pcap_serializer.h"
 #include "hccapx_serializer.h"
+#include "capture_store.h"
+#include "mem_alloc.h"
+
+#include "attack_request.h"
+#include "webserver_assets.h"
+#include "pages/page_assets.h"
 
-#include "pages/page_index.h"
+/**
+ * @brief Maximum number of sessions returned by \c /sessions endpoint
+ */
+#define SESSIONS_MAX 32
+/**
+ * @brief Maximum number of WebSocket clients receiving pushed messages
+ */
+#define WS_CLIENTS_MAX 4
+/**
+ * @brief Period of checking capture counters for changes that are pushed to WebSocket clients
+ */
+#define WS_COUNTERS_PERIOD_US 1000000
+/**
+ * @brief Largest WebSocket message allocated from internal RAM. Status with content is unbounded and goes to PSRAM.
+ */
+#define WS_MESSAGE_INTERNAL_MAX 64
+/**
+ * @brief Number of receive timeouts tolerated while request body is being received
+ */
+#define RECV_TIMEOUT_RETRIES 3
+/**
+ * @brief Size of buffer for If-None-Match header, enough for few ETags
+ */
+#define ASSET_ETAG_HEADER_MAX 128
 
 static const char* TAG = "webserver";
+static httpd_handle_t server = NULL;
+/**
+ * @brief Sockets of connected WebSocket clients, -1 marks free slot. Accessed only from webserver task.
+ */
+static int ws_clients[WS_CLIENTS_MAX];
+static volatile unsigned ws_client_count = 0;
+static esp_timer_handle_t ws_counters_timer;
 ESP_EVENT_DEFINE_BASE(WEBSERVER_EVENTS);
 
 /**
- * @brief Handlers for index/root \c / path endpoint
+ * @brief Handlers for static assets, including index/root \c / path endpoint
  *
- * This endpoint provides index page source
+ * Assets are stored gzipped with strong ETag. Clients always revalidate them and get 304 Not Modified
+ * with empty body if their cached copy is still current, so reconnecting clients don't download the UI again.
  * @param req
  * @return esp_err_t
  * @{
  */
-static esp_err_t uri_root_get_handler(httpd_req_t *req) {
-    httpd_resp_set_type(req, "text/html");
+static esp_err_t uri_asset_get_handler(httpd_req_t *req) {
+    const webserver_asset_t *asset = (const webserver_asset_t *) req->user_ctx;
+    char if_none_match[ASSET_ETAG_HEADER_MAX];
+
+    httpd_resp_set_hdr(req, "ETag", asset->etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    if((httpd_req_get_hdr_value_str(req, "If-None-Match", if_none_match, sizeof(if_none_match)) == ESP_OK)
+        && (strstr(if_none_match, asset->etag) != NULL)){
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    httpd_resp_set_type(req, asset->content_type);
     httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-    return httpd_resp_send(req, (const char *)page_index, page_index_len);
+    return httpd_resp_send(req, (const char *) asset->data, asset->size);
 }
 
-static httpd_uri_t uri_root_get = {
-    .uri = "/",
-    .method = HTTP_GET,
-    .handler = uri_root_get_handler,
-    .user_ctx = NULL
-};
+/**
+ * @brief Registers handler for every asset from generated table
+ */
+static void register_asset_handlers() {
+    for(unsigned i = 0; i < sizeof(page_assets) / sizeof(page_assets[0]); i++){
+        httpd_uri_t uri_asset_get = {
+            .uri = page_assets[i].path,
+            .method = HTTP_GET,
+            .handler = uri_asset_get_handler,
+            .user_ctx = (void *) &page_assets[i]
+        };
+        ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_asset_get));
+    }
+}
 //@}
 
 /**
@@ -112,38 +175,54 @@ static httpd_uri_t uri_ap_list_get = {
 /**
  * @brief Handlers for \c /run-attack endpoint
  *
- * This endpoint receives attack configuration from client. It deserialize it from octet stream to attack_request_t structure.
+ * This endpoint receives attack configuration from client. Body is attack_request_header_t followed by AP IDs.
+ * It's decoded incrementally as it comes from socket and validated into attack_request_t structure.
+ * Oversized bodies are rejected based on Content-Length before anything is received.
  * @param req
  * @return esp_err_t
  * @{
  */
 static esp_err_t uri_run_attack_post_handler(httpd_req_t *req) {
-
-    // Dynamic memory allocation
-    attack_request_t *attack_request_deb = malloc(sizeof(attack_request_t));
-    if (attack_request_deb == NULL) {
-        ESP_LOGE(TAG, "Failed to allocate memory for attack_request_deb!");
-        return ESP_FAIL;
+    esp_err_t err = attack_request_check_length(req->content_len);
+    if(err == ESP_ERR_INVALID_SIZE){
+        ESP_LOGW(TAG, "Attack request too large: %u B", (unsigned) req->content_len);
+        httpd_resp_set_status(req, "413 Payload Too Large");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    if(err != ESP_OK){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Attack request too short");
     }
 
-    // Receive data from HTTP request
-    char buffer[128];
-    int recv_size = httpd_req_recv(req, buffer, sizeof(buffer));
-    
-    ESP_LOGI(TAG, "recv_size: %d", recv_size);
-    if (recv_size > 0) {
-        ESP_LOG_BUFFER_HEX(TAG, buffer, recv_size);
-        memcpy(attack_request_deb, buffer, sizeof(attack_request_t)); // Copy data to allocated memory
-    } else {
-        ESP_LOGE(TAG, "Failed to receive data");
-        free(attack_request_deb);  // Free memory if something goes wrong
-        return ESP_FAIL;
+    attack_request_decoder_t decoder;
+    attack_request_decoder_init(&decoder);
+    uint8_t buffer[16];
+    size_t remaining = req->content_len;
+    unsigned timeouts = 0;
+    while(remaining > 0){
+        int recv_size = httpd_req_recv(req, (char *) buffer, (remaining < sizeof(buffer)) ? remaining : sizeof(buffer));
+        if((recv_size == HTTPD_SOCK_ERR_TIMEOUT) && (++timeouts <= RECV_TIMEOUT_RETRIES)){
+            continue;
+        }
+        if(recv_size <= 0){
+            ESP_LOGE(TAG, "Failed to receive attack request");
+            return ESP_FAIL;
+        }
+        err = attack_request_decoder_feed(&decoder, buffer, recv_size);
+        if(err != ESP_OK){
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, (err == ESP_ERR_INVALID_VERSION) ? "Unsupported request version" : "Invalid attack request");
+        }
+        remaining -= recv_size;
+    }
+    if(!attack_request_decoder_done(&decoder)){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Incomplete attack request");
     }
 
-    // Sent a new event with an allocated structure:
+    // respond first, attack may reconfigure Wi-Fi right away and management AP goes down
     esp_err_t res = httpd_resp_send(req, NULL, 0);
-    ESP_ERROR_CHECK(esp_event_post(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_REQUEST, attack_request_deb, sizeof(attack_request_t), portMAX_DELAY));
-
+    err = esp_event_post(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_REQUEST, &decoder.request, sizeof(attack_request_t), pdMS_TO_TICKS(1000));
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Failed to post attack request: %s", esp_err_to_name(err));
+    }
     return res;
 }
 
@@ -163,17 +242,27 @@ static httpd_uri_t uri_run_attack_post = {
  * @return esp_err_t
  * @{
  */
+static esp_err_t send_status_content_chunk(const char *data, unsigned size, void *ctx) {
+    return httpd_resp_send_chunk((httpd_req_t *) ctx, data, size);
+}
+
 static esp_err_t uri_status_get_handler(httpd_req_t *req) {
     //ESP_LOGD(TAG, "Fetching attack status...");
-    const attack_status_t *attack_status;
-    attack_status = attack_get_status();
+    // snapshot stays consistent even if attack appends to or resets the status while it is being sent
+    attack_status_t attack_status;
+    attack_status_snapshot_acquire(&attack_status);
 
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
     // first send attack result header
-    ESP_ERROR_CHECK(httpd_resp_send_chunk(req, (char *) attack_status, 4));
+    esp_err_t err = httpd_resp_send_chunk(req, (char *) &attack_status, 4);
     // send attack result content
-    if(((attack_status->state == FINISHED) || (attack_status->state == TIMEOUT)) && (attack_status->content_size > 0)){
-        ESP_ERROR_CHECK(httpd_resp_send_chunk(req, attack_status->content, attack_status->content_size));
+    if((err == ESP_OK) && ((attack_status.state == FINISHED) || (attack_status.state == TIMEOUT))){
+        err = attack_status_snapshot_for_each(&attack_status, send_status_content_chunk, req);
+    }
+    attack_status_snapshot_release(&attack_status);
+    if(err != ESP_OK){
+        ESP_LOGW(TAG, "Sending attack status failed: %s", esp_err_to_name(err));
+        return err;
     }
     return httpd_resp_send_chunk(req, NULL, 0);
 }
@@ -196,10 +285,42 @@ static httpd_uri_t uri_status_get = {
  * @return esp_err_t
  * @{
  */
+static esp_err_t send_stored_artifact(httpd_req_t *req, uint16_t id, capture_store_artifact_t artifact);
+
 static esp_err_t uri_capture_pcap_get_handler(httpd_req_t *req){
     ESP_LOGD(TAG, "Providing PCAP file...");
+    int store_session = pcap_serializer_get_store_session();
+    if(store_session >= 0){
+        return send_stored_artifact(req, store_session, CAPTURE_STORE_ARTIFACT_PCAP);
+    }
+
+    char *chunk = mem_alloc(MEM_CATEGORY_CAPTURE, CONFIG_WEBSERVER_STREAM_CHUNK_SIZE);
+    if(chunk == NULL){
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) pcap_serializer_get_buffer(), pcap_serializer_get_size());
+    // capture may be running, kept frames are not overwritten until reading ends
+    unsigned size = pcap_serializer_read_begin();
+    esp_err_t res = ESP_OK;
+    for(unsigned offset = 0; offset < size; offset += CONFIG_WEBSERVER_STREAM_CHUNK_SIZE){
+        unsigned chunk_size = (size - offset < CONFIG_WEBSERVER_STREAM_CHUNK_SIZE) ? size - offset : CONFIG_WEBSERVER_STREAM_CHUNK_SIZE;
+        if(pcap_serializer_read(offset, (uint8_t *) chunk, chunk_size) != chunk_size){
+            // capture was reset meanwhile, abort transfer
+            res = ESP_FAIL;
+            break;
+        }
+        res = httpd_resp_send_chunk(req, chunk, chunk_size);
+        if(res != ESP_OK){
+            // client disconnected, abort transfer
+            break;
+        }
+    }
+    pcap_serializer_read_end();
+    mem_free(MEM_CATEGORY_CAPTURE, chunk);
+    if(res != ESP_OK){
+        return res;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
 }
 
 static httpd_uri_t uri_capture_pcap_get = {
@@ -214,6 +335,7 @@ static httpd_uri_t uri_capture_pcap_get = {
  * @brief Handlers for \c /capture.hccapx endpoint
  *
  * This endpoint forwards HCCAPX binary data from hccapx_serializer via octet stream to client.
+ * Responds with 404 if no handshake message pair was captured.
  *
  * @note Most browsers will start download process when this endpoint is called.
  * @param req
@@ -222,8 +344,12 @@ static httpd_uri_t uri_capture_pcap_get = {
  */
 static esp_err_t uri_capture_hccapx_get_handler(httpd_req_t *req){
     ESP_LOGD(TAG, "Providing HCCAPX file...");
+    hccapx_t *hccapx = hccapx_serializer_get();
+    if(hccapx == NULL){
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "No handshake captured");
+    }
     ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
-    return httpd_resp_send(req, (char *) hccapx_serializer_get(), sizeof(hccapx_t));
+    return httpd_resp_send(req, (char *) hccapx, sizeof(hccapx_t));
 }
 
 static httpd_uri_t uri_capture_hccapx_get = {
@@ -233,20 +359,540 @@ static httpd_uri_t uri_capture_hccapx_get = {
     .user_ctx = NULL
 };
 
+//@}
+
+/**
+ * @brief Streams stored session artifact from capture_store in chunks.
+ *
+ * Responds with 409 if the session is still being recorded and with 404 if it doesn't exist.
+ * @param req
+ * @param id session id
+ * @param artifact
+ * @return esp_err_t
+ */
+static esp_err_t send_stored_artifact(httpd_req_t *req, uint16_t id, capture_store_artifact_t artifact){
+    if(capture_store_session_id() == id){
+        httpd_resp_set_status(req, "409 Conflict");
+        return httpd_resp_send(req, NULL, 0);
+    }
+    size_t size;
+    int fd = capture_store_open(id, artifact, &size);
+    if(fd < 0){
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, NULL);
+    }
+
+    char *chunk = mem_alloc(MEM_CATEGORY_CAPTURE, CONFIG_WEBSERVER_STREAM_CHUNK_SIZE);
+    if(chunk == NULL){
+        close(fd);
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    ESP_LOGD(TAG, "Streaming session %04x (%u bytes)", id, (unsigned) size);
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    esp_err_t res = ESP_OK;
+    ssize_t read_size;
+    while((read_size = read(fd, chunk, CONFIG_WEBSERVER_STREAM_CHUNK_SIZE)) > 0){
+        res = httpd_resp_send_chunk(req, chunk, read_size);
+        if(res != ESP_OK){
+            // client disconnected, abort transfer
+            break;
+        }
+    }
+    mem_free(MEM_CATEGORY_CAPTURE, chunk);
+    close(fd);
+    if(res != ESP_OK){
+        return res;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+/**
+ * @brief Handlers for \c /sessions endpoint
+ *
+ * This endpoint returns list of capture sessions stored in flash as array of capture_store_session_t records.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_sessions_get_handler(httpd_req_t *req){
+    capture_store_session_t *sessions = mem_alloc(MEM_CATEGORY_HISTORY, SESSIONS_MAX * sizeof(capture_store_session_t));
+    if(sessions == NULL){
+        return httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, NULL);
+    }
+    unsigned count = capture_store_list(sessions, SESSIONS_MAX);
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    esp_err_t res = httpd_resp_send(req, (char *) sessions, count * sizeof(capture_store_session_t));
+    mem_free(MEM_CATEGORY_HISTORY, sessions);
+    return res;
+}
+
+static httpd_uri_t uri_sessions_get = {
+    .uri = "/sessions",
+    .method = HTTP_GET,
+    .handler = uri_sessions_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Parses whole query parameter as unsigned number
+ *
+ * @param text
+ * @param base passed to strtoul(), 0 accepts decimal, hexadecimal and octal notation
+ * @param max largest accepted value
+ * @param value output
+ * @return true text is a number not greater than max
+ */
+static bool parse_unsigned(const char *text, int base, unsigned long max, unsigned long *value){
+    char *end;
+    errno = 0;
+    unsigned long number = strtoul(text, &end, base);
+    // strtoul() would skip whitespace and accept sign
+    if(!isalnum((unsigned char) text[0]) || (*end != '\0') || (errno == ERANGE) || (number > max)){
+        return false;
+    }
+    *value = number;
+    return true;
+}
+
+/**
+ * @brief Parses hexadecimal session id
+ *
+ * @param text
+ * @param id output
+ * @return true id is valid
+ */
+static bool parse_session_id(const char *text, uint16_t *id){
+    unsigned long value;
+    if(!parse_unsigned(text, 16, UINT16_MAX, &value)){
+        return false;
+    }
+    *id = (uint16_t) value;
+    return true;
+}
+
+/**
+ * @brief Handlers for \c /session endpoint
+ *
+ * This endpoint streams stored capture session. Session is selected by hexadecimal \c id query parameter.
+ * HCCAPX artifact is provided instead of PCAP when \c artifact=hccapx query parameter is present.
+ *
+ * @note Most browsers will start download process when this endpoint is called.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_session_get_handler(httpd_req_t *req){
+    char query[48];
+    char value[8];
+    if(httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK
+        || httpd_query_key_value(query, "id", value, sizeof(value)) != ESP_OK){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing session id");
+    }
+    uint16_t id;
+    if(!parse_session_id(value, &id)){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid session id");
+    }
+
+    capture_store_artifact_t artifact = CAPTURE_STORE_ARTIFACT_PCAP;
+    if((httpd_query_key_value(query, "artifact", value, sizeof(value)) == ESP_OK) && (strcmp(value, "hccapx") == 0)){
+        artifact = CAPTURE_STORE_ARTIFACT_HCCAPX;
+    }
+    return send_stored_artifact(req, id, artifact);
+}
+
+static httpd_uri_t uri_session_get = {
+    .uri = "/session",
+    .method = HTTP_GET,
+    .handler = uri_session_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Parses MAC address in \c aabbccddeeff or \c aa:bb:cc:dd:ee:ff format
+ *
+ * @param text
+ * @param mac output, 6 bytes
+ * @return true address is valid
+ */
+static bool parse_mac(const char *text, uint8_t *mac){
+    for(unsigned i = 0; i < 6; i++){
+        if((i > 0) && (*text == ':')){
+            text++;
+        }
+        if(!isxdigit((unsigned char) text[0]) || !isxdigit((unsigned char) text[1])){
+            return false;
+        }
+        char byte[3] = { text[0], text[1], '\0' };
+        mac[i] = strtoul(byte, NULL, 16);
+        text += 2;
+    }
+    return *text == '\0';
+}
+
+static esp_err_t send_query_chunk(const void *data, size_t size, void *ctx){
+    return httpd_resp_send_chunk((httpd_req_t *) ctx, (const char *) data, size);
+}
+
+/**
+ * @brief Handlers for \c /session-query endpoint
+ *
+ * This endpoint streams PCAP records of stored session that match query parameters:
+ * - \c id hexadecimal session id (required)
+ * - \c bssid and \c sta MAC addresses
+ * - \c kinds bit mask of capture_store_frame_kind_t (e.g. 8 for EAPOL frames only)
+ * - \c complete=1 only EAPOL frames of complete handshakes
+ * - \c from and \c to range of milliseconds since session start
+ *
+ * Sorted session index is used, so only matching records are read and sent, in the order they were captured.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_session_query_get_handler(httpd_req_t *req){
+    char query_str[160];
+    char value[20];
+    uint8_t bssid[6];
+    uint8_t sta[6];
+    capture_store_query_t query = {
+        .bssid = NULL,
+        .sta = NULL,
+        .kinds = 0,
+        .complete_only = false,
+        .from_ms = 0,
+        .to_ms = UINT32_MAX
+    };
+
+    if(httpd_req_get_url_query_str(req, query_str, sizeof(query_str)) != ESP_OK
+        || httpd_query_key_value(query_str, "id", value, sizeof(value)) != ESP_OK){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing session id");
+    }
+    if(!parse_session_id(value, &query.id)){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid session id");
+    }
+    if(httpd_query_key_value(query_str, "bssid", value, sizeof(value)) == ESP_OK){
+        if(!parse_mac(value, bssid)){
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid BSSID");
+        }
+        query.bssid = bssid;
+    }
+    if(httpd_query_key_value(query_str, "sta", value, sizeof(value)) == ESP_OK){
+        if(!parse_mac(value, sta)){
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid STA");
+        }
+        query.sta = sta;
+    }
+    unsigned long number;
+    if(httpd_query_key_value(query_str, "kinds", value, sizeof(value)) == ESP_OK){
+        if(!parse_unsigned(value, 0, UINT8_MAX, &number)){
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid kinds");
+        }
+        query.kinds = number;
+    }
+    if(httpd_query_key_value(query_str, "complete", value, sizeof(value)) == ESP_OK){
+        query.complete_only = (strcmp(value, "1") == 0);
+    }
+    if(httpd_query_key_value(query_str, "from", value, sizeof(value)) == ESP_OK){
+        if(!parse_unsigned(value, 10, UINT32_MAX, &number)){
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid from");
+        }
+        query.from_ms = number;
+    }
+    if(httpd_query_key_value(query_str, "to", value, sizeof(value)) == ESP_OK){
+        if(!parse_unsigned(value, 10, UINT32_MAX, &number)){
+            return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid to");
+        }
+        query.to_ms = number;
+    }
+
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    esp_err_t res = capture_store_query(&query, send_query_chunk, req);
+    if(res == ESP_ERR_NOT_FOUND){
+        return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "Session not found or not indexed");
+    }
+    if(res != ESP_OK){
+        // part of response was probably sent already, connection has to be closed
+        ESP_LOGW(TAG, "Session query failed: %s", esp_err_to_name(res));
+        return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+static httpd_uri_t uri_session_query_get = {
+    .uri = "/session-query",
+    .method = HTTP_GET,
+    .handler = uri_session_query_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief Handlers for \c /heap endpoint
+ *
+ * This endpoint returns free heap and mem_alloc statistics of all categories as webserver_heap_header_t
+ * followed by webserver_heap_category_t records. It's used to watch server memory under load.
+ * @param req
+ * @return esp_err_t
+ * @{
+ */
+static esp_err_t uri_heap_get_handler(httpd_req_t *req){
+    struct __attribute__((packed)) {
+        webserver_heap_header_t header;
+        webserver_heap_category_t categories[MEM_CATEGORY_MAX];
+    } response = {
+        .header = {
+            .free_internal = heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+            .minimum_free_internal = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+            .largest_free_internal = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL),
+            .free_spiram = heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+            .category_count = MEM_CATEGORY_MAX
+        }
+    };
+    for(unsigned i = 0; i < MEM_CATEGORY_MAX; i++){
+        mem_alloc_stats_t stats;
+        mem_alloc_get_stats((mem_category_t) i, &stats);
+        response.categories[i] = (webserver_heap_category_t) {
+            .in_use = stats.in_use,
+            .peak = stats.peak,
+            .allocations = stats.allocations,
+            .failures = stats.failures,
+            .fallbacks = stats.fallbacks
+        };
+    }
+    ESP_ERROR_CHECK(httpd_resp_set_type(req, HTTPD_TYPE_OCTET));
+    return httpd_resp_send(req, (char *) &response, sizeof(response));
+}
+
+static httpd_uri_t uri_heap_get = {
+    .uri = "/heap",
+    .method = HTTP_GET,
+    .handler = uri_heap_get_handler,
+    .user_ctx = NULL
+};
+//@}
+
+/**
+ * @brief WebSocket push channel on \c /ws endpoint
+ *
+ * Clients get status transitions, capture counters and handshake summaries as they happen instead of polling \c /status.
+ * Messages are queued into webserver task and sent to all clients from there.
+ * @{
+ */
+typedef struct {
+    mem_category_t category;
+    size_t size;
+    uint8_t data[];
+} ws_message_t;
+
+static bool ws_client_add(int fd){
+    for(unsigned i = 0; i < WS_CLIENTS_MAX; i++){
+        if(ws_clients[i] == fd){
+            return true;
+        }
+    }
+    for(unsigned i = 0; i < WS_CLIENTS_MAX; i++){
+        if(ws_clients[i] < 0){
+            ws_clients[i] = fd;
+            ws_client_count++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void ws_client_remove(int fd){
+    for(unsigned i = 0; i < WS_CLIENTS_MAX; i++){
+        if(ws_clients[i] == fd){
+            ws_clients[i] = -1;
+            ws_client_count--;
+        }
+    }
+}
+
+static ws_message_t *ws_message_alloc(webserver_push_type_t type, size_t size){
+    mem_category_t category = (1 + size <= WS_MESSAGE_INTERNAL_MAX) ? MEM_CATEGORY_INTERNAL : MEM_CATEGORY_HISTORY;
+    ws_message_t *message = mem_alloc(category, sizeof(ws_message_t) + 1 + size);
+    if(message == NULL){
+        ESP_LOGW(TAG, "Cannot allocate WebSocket message");
+        return NULL;
+    }
+    message->category = category;
+    message->size = 1 + size;
+    message->data[0] = type;
+    return message;
+}
+
+static void ws_broadcast_work(void *arg){
+    ws_message_t *message = (ws_message_t *) arg;
+    httpd_ws_frame_t frame = {
+        .final = true,
+        .type = HTTPD_WS_TYPE_BINARY,
+        .payload = message->data,
+        .len = message->size
+    };
+    for(unsigned i = 0; i < WS_CLIENTS_MAX; i++){
+        int fd = ws_clients[i];
+        if(fd < 0){
+            continue;
+        }
+        if((httpd_ws_get_fd_info(server, fd) != HTTPD_WS_CLIENT_WEBSOCKET) || (httpd_ws_send_frame_async(server, fd, &frame) != ESP_OK)){
+            ESP_LOGD(TAG, "Dropping WebSocket client %d", fd);
+            ws_client_remove(fd);
+            httpd_sess_trigger_close(server, fd);
+        }
+    }
+    mem_free(message->category, message);
+}
+
+/**
+ * @brief Hands message over to webserver task. Takes ownership of message.
+ */
+static void ws_broadcast(ws_message_t *message){
+    if((ws_client_count == 0) || (httpd_queue_work(server, ws_broadcast_work, message) != ESP_OK)){
+        mem_free(message->category, message);
+    }
+}
+
+static esp_err_t copy_status_content_chunk(const char *data, unsigned size, void *ctx){
+    uint8_t **cursor = (uint8_t **) ctx;
+    memcpy(*cursor, data, size);
+    *cursor += size;
+    return ESP_OK;
+}
+
+void webserver_push_status(){
+    if(ws_client_count == 0){
+        return;
+    }
+    attack_status_t attack_status;
+    attack_status_snapshot_acquire(&attack_status);
+    bool with_content = (attack_status.state == FINISHED) || (attack_status.state == TIMEOUT);
+    ws_message_t *message = ws_message_alloc(WEBSERVER_PUSH_STATUS, 4 + (with_content ? attack_status.content_size : 0));
+    if(message != NULL){
+        memcpy(&message->data[1], &attack_status, 4);
+        uint8_t *cursor = &message->data[5];
+        if(with_content){
+            attack_status_snapshot_for_each(&attack_status, copy_status_content_chunk, &cursor);
+        }
+    }
+    attack_status_snapshot_release(&attack_status);
+    if(message != NULL){
+        ws_broadcast(message);
+    }
+}
+
+void webserver_push_handshake(const webserver_handshake_summary_t *summary){
+    if(ws_client_count == 0){
+        return;
+    }
+    ws_message_t *message = ws_message_alloc(WEBSERVER_PUSH_HANDSHAKE, sizeof(webserver_handshake_summary_t));
+    if(message != NULL){
+        memcpy(&message->data[1], summary, sizeof(webserver_handshake_summary_t));
+        ws_broadcast(message);
+    }
+}
+
+/**
+ * @brief Periodically pushes capture counters, but only when they changed since last push.
+ *
+ * @param arg not used
+ */
+static void ws_counters_timer_callback(void *arg){
+    static webserver_push_counters_t last_counters = { 0 };
+    if(ws_client_count == 0){
+        return;
+    }
+    unsigned frames, bytes, dropped_frames, dropped_bytes;
+    pcap_serializer_get_counters(&frames, &bytes);
+    pcap_serializer_get_dropped(&dropped_frames, &dropped_bytes);
+    if((frames == last_counters.frames) && (bytes == last_counters.bytes)
+        && (dropped_frames == last_counters.dropped_frames) && (dropped_bytes == last_counters.dropped_bytes)){
+        return;
+    }
+    last_counters.frames = frames;
+    last_counters.bytes = bytes;
+    last_counters.dropped_frames = dropped_frames;
+    last_counters.dropped_bytes = dropped_bytes;
+    ws_message_t *message = ws_message_alloc(WEBSERVER_PUSH_COUNTERS, sizeof(webserver_push_counters_t));
+    if(message != NULL){
+        memcpy(&message->data[1], &last_counters, sizeof(webserver_push_counters_t));
+        ws_broadcast(message);
+    }
+}
+
+static void ws_close_callback(httpd_handle_t hd, int sockfd){
+    ws_client_remove(sockfd);
+    close(sockfd);
+}
+
+static esp_err_t uri_ws_handler(httpd_req_t *req){
+    if(req->method == HTTP_GET){
+        // handshake is done, register client and send it current status right away
+        if(!ws_client_add(httpd_req_to_sockfd(req))){
+            ESP_LOGW(TAG, "Too many WebSocket clients");
+            return ESP_FAIL;
+        }
+        webserver_push_status();
+        return ESP_OK;
+    }
+    // clients are not expected to send anything, small frames are drained and dropped
+    uint8_t buffer[32];
+    httpd_ws_frame_t frame = { .payload = buffer };
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if((err != ESP_OK) || (frame.len == 0)){
+        return err;
+    }
+    if(frame.len > sizeof(buffer)){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return httpd_ws_recv_frame(req, &frame, frame.len);
+}
+
+static httpd_uri_t uri_ws = {
+    .uri = "/ws",
+    .method = HTTP_GET,
+    .handler = uri_ws_handler,
+    .user_ctx = NULL,
+    .is_websocket = true
+};
+//@}
 
 void webserver_run(){
     ESP_LOGD(TAG, "Running webserver");
 
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.recv_wait_timeout = 10;
-    httpd_handle_t server = NULL;
+    config.stack_size = CONFIG_WEBSERVER_STACK_SIZE;
+    config.max_open_sockets = CONFIG_WEBSERVER_MAX_OPEN_SOCKETS;
+    config.backlog_conn = CONFIG_WEBSERVER_BACKLOG;
+#ifdef CONFIG_WEBSERVER_LRU_PURGE
+    config.lru_purge_enable = true;
+#endif
+    config.recv_wait_timeout = CONFIG_WEBSERVER_RECV_TIMEOUT;
+    config.send_wait_timeout = CONFIG_WEBSERVER_SEND_TIMEOUT;
+    config.max_uri_handlers = 24;
+    config.close_fn = ws_close_callback;
+    for(unsigned i = 0; i < WS_CLIENTS_MAX; i++){
+        ws_clients[i] = -1;
+    }
 
     ESP_ERROR_CHECK(httpd_start(&server, &config));
-    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_root_get));
+    register_asset_handlers();
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_reset_head));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_ap_list_get));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_run_attack_post));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_status_get));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_pcap_get));
     ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_capture_hccapx_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_sessions_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_session_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_session_query_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_heap_get));
+    ESP_ERROR_CHECK(httpd_register_uri_handler(server, &uri_ws));
+
+    const esp_timer_create_args_t ws_counters_timer_args = {
+        .callback = &ws_counters_timer_callback,
+        .name = "ws_counters"
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&ws_counters_timer_args, &ws_counters_timer));
+    ESP_ERROR_CHECK(esp_timer_start_periodic(ws_counters_timer, WS_COUNTERS_PERIOD_US));
 }
\ No newline at end of file
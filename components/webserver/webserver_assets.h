@@ -0,0 +1,23 @@
+/**
+ * @file webserver_assets.h
+ * @date 2026-10-19
+ *
+ * @brief Table of static web assets embedded into firmware
+ *
+ * Table itself is generated into pages/page_assets.h by utils/convert_assets_to_header_file.sh
+ */
+#ifndef WEBSERVER_ASSETS_H
+#define WEBSERVER_ASSETS_H
+
+/**
+ * @brief Single gzipped static asset
+ */
+typedef struct {
+    const char *path;           ///< URI the asset is served on
+    const char *content_type;
+    const char *etag;           ///< strong ETag including quotes, derived from gzipped data
+    const unsigned char *data;  ///< gzipped content
+    unsigned size;
+} webserver_asset_t;
+
+#endif
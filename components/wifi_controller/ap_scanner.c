@@ -12,40 +12,118 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+
+#include "mem_alloc.h"
 
 static const char* TAG = "wifi_controller/ap_scanner";
 /**
  * @brief Stores last scanned AP records into linked list.
  * 
+ * Allocated on first use from AP table memory category, so it's kept in PSRAM if available.
+ */
+static wifictl_ap_records_t *ap_records = NULL;
+/**
+ * @brief Guards ap_records pointer and reference counters of tables.
+ */
+static portMUX_TYPE ap_records_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static wifictl_ap_records_t *get_ap_records_table(){
+    if(ap_records == NULL){
+        ap_records = (wifictl_ap_records_t *) mem_calloc(MEM_CATEGORY_AP_TABLE, 1, sizeof(wifictl_ap_records_t));
+        if(ap_records == NULL){
+            ESP_LOGE(TAG, "Cannot allocate AP records table!");
+            ESP_ERROR_CHECK(ESP_ERR_NO_MEM);
+        }
+    }
+    return ap_records;
+}
+
+/**
+ * @brief Scans nearby APs with given scan config and stores result into current AP table.
+ * 
+ * @param scan_config
  */
-static wifictl_ap_records_t ap_records;
+static void scan_nearby_aps(const wifi_scan_config_t *scan_config){
+    // pinned table must not change, so it's left to its users and new one is allocated
+    portENTER_CRITICAL(&ap_records_lock);
+    if((ap_records != NULL) && (ap_records->refs > 0)){
+        ap_records = NULL;
+    }
+    portEXIT_CRITICAL(&ap_records_lock);
+    wifictl_ap_records_t *records = get_ap_records_table();
+    records->count = CONFIG_SCAN_MAX_AP;
+
+    ESP_ERROR_CHECK(esp_wifi_scan_start(scan_config, true));
+    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&records->count, records->records));
+    ESP_LOGI(TAG, "Found %u APs.", records->count);
+    ESP_LOGD(TAG, "Scan done.");
+}
 
 void wifictl_scan_nearby_aps(){
     ESP_LOGD(TAG, "Scanning nearby APs...");
 
-    ap_records.count = CONFIG_SCAN_MAX_AP;
-
     wifi_scan_config_t scan_config = {
         .ssid = NULL,
         .bssid = NULL,
         .channel = 0,
         .scan_type = WIFI_SCAN_TYPE_ACTIVE
     };
-    
-    ESP_ERROR_CHECK(esp_wifi_scan_start(&scan_config, true));
-    ESP_ERROR_CHECK(esp_wifi_scan_get_ap_records(&ap_records.count, ap_records.records));
-    ESP_LOGI(TAG, "Found %u APs.", ap_records.count);
-    ESP_LOGD(TAG, "Scan done.");
+    scan_nearby_aps(&scan_config);
+}
+
+void wifictl_survey_nearby_aps(unsigned dwell_ms){
+    ESP_LOGD(TAG, "Surveying nearby APs, %u ms per channel...", dwell_ms);
+
+    wifi_scan_config_t scan_config = {
+        .ssid = NULL,
+        .bssid = NULL,
+        .channel = 0,
+        .show_hidden = true,
+        .scan_type = WIFI_SCAN_TYPE_PASSIVE,
+        .scan_time.passive = dwell_ms
+    };
+    scan_nearby_aps(&scan_config);
 }
 
 const wifictl_ap_records_t *wifictl_get_ap_records() {
-    return &ap_records;
+    return get_ap_records_table();
+}
+
+const wifictl_ap_records_t *wifictl_ap_records_acquire() {
+    wifictl_ap_records_t *records = get_ap_records_table();
+    portENTER_CRITICAL(&ap_records_lock);
+    records->refs++;
+    portEXIT_CRITICAL(&ap_records_lock);
+    return records;
+}
+
+const wifictl_ap_records_t *wifictl_ap_records_retain(const wifictl_ap_records_t *records) {
+    wifictl_ap_records_t *table = (wifictl_ap_records_t *) records;
+    portENTER_CRITICAL(&ap_records_lock);
+    table->refs++;
+    portEXIT_CRITICAL(&ap_records_lock);
+    return records;
+}
+
+void wifictl_ap_records_release(const wifictl_ap_records_t *records) {
+    if(records == NULL){
+        return;
+    }
+    wifictl_ap_records_t *table = (wifictl_ap_records_t *) records;
+    portENTER_CRITICAL(&ap_records_lock);
+    bool unused = (--table->refs == 0) && (table != ap_records);
+    portEXIT_CRITICAL(&ap_records_lock);
+    if(unused){
+        mem_free(MEM_CATEGORY_AP_TABLE, table);
+    }
 }
 
 const wifi_ap_record_t *wifictl_get_ap_record(unsigned index) {
-    if(index >= ap_records.count){
-        ESP_LOGE(TAG, "Index out of bounds! %u records available, but %u requested", ap_records.count, index);
+    const wifictl_ap_records_t *records = get_ap_records_table();
+    if(index >= records->count){
+        ESP_LOGE(TAG, "Index out of bounds! %u records available, but %u requested", records->count, index);
         return NULL;
     }
-    return &ap_records.records[index];
+    return &records->records[index];
 }
\ No newline at end of file
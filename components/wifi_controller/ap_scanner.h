@@ -17,6 +17,7 @@
  */
 typedef struct {
     uint16_t count;
+    uint16_t refs;      ///< number of users that pinned this table by wifictl_ap_records_acquire()
     wifi_ap_record_t records[CONFIG_SCAN_MAX_AP];
 } wifictl_ap_records_t;
 
@@ -26,6 +27,15 @@ typedef struct {
  */
 void wifictl_scan_nearby_aps();
 
+/**
+ * @brief Passively scans nearby APs without transmitting probe requests and stores result.
+ * 
+ * Result replaces current list of scanned APs the same way as wifictl_scan_nearby_aps() does.
+ * 
+ * @param dwell_ms time spent listening on each channel in milliseconds
+ */
+void wifictl_survey_nearby_aps(unsigned dwell_ms);
+
 /**
  * @brief Returns current list of scanned APs.
  * 
@@ -33,6 +43,31 @@ void wifictl_scan_nearby_aps();
  */
 const wifictl_ap_records_t *wifictl_get_ap_records();
 
+/**
+ * @brief Pins current list of scanned APs.
+ * 
+ * Pinned list and its records stay valid and unchanged until wifictl_ap_records_release() is called.
+ * If APs are rescanned in the meantime, new scan result is stored into a new list.
+ * 
+ * @return const wifictl_ap_records_t* 
+ */
+const wifictl_ap_records_t *wifictl_ap_records_acquire();
+
+/**
+ * @brief Pins list of scanned APs that is already pinned by caller once more.
+ * 
+ * @param records list returned by wifictl_ap_records_acquire() and not released yet
+ * @return const wifictl_ap_records_t* records
+ */
+const wifictl_ap_records_t *wifictl_ap_records_retain(const wifictl_ap_records_t *records);
+
+/**
+ * @brief Unpins list of scanned APs acquired by wifictl_ap_records_acquire() or wifictl_ap_records_retain().
+ * 
+ * @param records 
+ */
+void wifictl_ap_records_release(const wifictl_ap_records_t *records);
+
 /**
  * @brief Returns AP record on given index
  * 
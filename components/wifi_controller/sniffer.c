@@ -14,6 +14,7 @@
 #include "esp_event.h"
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
+#include "hotpath_log.h"
 
 static const char *TAG = "sniffer"; 
 
@@ -31,7 +32,7 @@ ESP_EVENT_DEFINE_BASE(SNIFFER_EVENTS);
  * @param type 
  */
 static void frame_handler(void *buf, wifi_promiscuous_pkt_type_t type) {
-    ESP_LOGV(TAG, "Captured frame %d.", (int) type);
+    HOTPATH_LOGV(TAG, "Captured frame %d.", (int) type);
 
     wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) buf;
 
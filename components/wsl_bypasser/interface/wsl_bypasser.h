@@ -13,8 +13,34 @@
 #define WSL_BYPASSER_H
 
 #include "esp_wifi.h"
+#include "esp_event.h"
 #include <stdint.h>
 
+/**
+ * @brief Maximum number of attacked SSIDs kept in telemetry. All given APs are attacked regardless.
+ */
+#define WSL_BYPASSER_TELEMETRY_MAX_TARGETS 10
+
+ESP_EVENT_DECLARE_BASE(WSL_BYPASSER_EVENTS);
+
+/**
+ * @brief Events posted by wsl_bypasser_send_deauth_frame_multiple_aps() when displayed values change
+ */
+enum {
+    WSL_BYPASSER_EVENT_TARGETS_CHANGED,     ///< list of attacked SSIDs changed
+    WSL_BYPASSER_EVENT_RATE_CHANGED         ///< number of frames sent per second changed
+};
+
+/**
+ * @brief Snapshot of deauthentication attack telemetry
+ */
+typedef struct {
+    uint32_t version;               ///< incremented by every change, equal versions mean equal content
+    uint32_t frames_per_second;     ///< frames sent during last second
+    uint8_t target_count;           ///< number of valid items in targets
+    char targets[WSL_BYPASSER_TELEMETRY_MAX_TARGETS][33];   ///< NUL terminated SSIDs of first attacked APs
+} wsl_bypasser_telemetry_t;
+
 /**
  * @brief Sends frame in frame_buffer using esp_wifi_80211_tx but bypasses blocking mechanism
  * 
@@ -33,6 +59,24 @@ void wsl_bypasser_send_raw_frame(const uint8_t *frame_buffer, int size);
  */
 void wsl_bypasser_send_deauth_frame(const wifi_ap_record_t *ap_record);
 
-void wsl_bypasser_send_deauth_frame_multiple_aps(wifi_ap_record_t *ap_records, size_t count);
+/**
+ * @brief Sends deauthentication frame for every given AP, switching channel for each of them
+ * 
+ * Attacked SSIDs and frame rate are published for display, WSL_BYPASSER_EVENTS are posted when they change.
+ * 
+ * @param ap_records AP records with valid AP information
+ * @param count number of AP records
+ */
+void wsl_bypasser_send_deauth_frame_multiple_aps(const wifi_ap_record_t *const ap_records[], size_t count);
+
+/**
+ * @brief Copies consistent snapshot of telemetry. Can be called from any task.
+ * 
+ * Telemetry is protected by sequence lock, so the writer never waits for readers. Reader retries the copy
+ * if it overlapped with an update.
+ * 
+ * @param snapshot output
+ */
+void wsl_bypasser_get_telemetry(wsl_bypasser_telemetry_t *snapshot);
 
 #endif
\ No newline at end of file
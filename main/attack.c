@@ -9,6 +9,8 @@
 
 #include "attack.h"
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
@@ -17,89 +19,424 @@
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
 
 #include "attack_pmkid.h"
 #include "attack_handshake.h"
 #include "attack_dos.h"
 #include "webserver.h"
 #include "wifi_controller.h"
+#include "frame_analyzer.h"
+#include "capture_store.h"
+#include "pcap_serializer.h"
+#include "hccapx_serializer.h"
+#include "mem_alloc.h"
+
+/**
+ * @brief Capacity of chunks allocated by attack_append_status_content()
+ */
+#define ATTACK_STATUS_CHUNK_SIZE 512
+
+/**
+ * @brief Delay before timed out attack is posted again when event loop queue is full
+ */
+#define ATTACK_TIMEOUT_RETRY_US 100000
+
+/**
+ * @brief Events posted by attack wrapper to itself, so work requested from other tasks runs in event loop task.
+ */
+ESP_EVENT_DEFINE_BASE(ATTACK_EVENTS);
+enum {
+    ATTACK_EVENT_TIMEOUT    ///< attack timed out, event data is session number of the attack
+};
+
+typedef struct attack_status_chunk {
+    struct attack_status_chunk *next;
+    unsigned capacity;
+    char data[];
+} attack_status_chunk_t;
+
+struct attack_status_content {
+    unsigned refs;                  ///< guarded by status_lock
+    attack_status_chunk_t *head;
+    attack_status_chunk_t *tail;    ///< accessed by writer only
+    unsigned tail_used;             ///< accessed by writer only
+};
+
+/**
+ * @brief Lifecycle of attack session. Only IDLE -> STARTING -> RUNNING -> STOPPING -> IDLE transitions are allowed.
+ */
+typedef enum {
+    ATTACK_SESSION_IDLE,
+    ATTACK_SESSION_STARTING,
+    ATTACK_SESSION_RUNNING,
+    ATTACK_SESSION_STOPPING
+} attack_session_state_t;
 
 static const char* TAG = "attack";
 static attack_status_t attack_status = { .state = READY, .type = -1, .content_size = 0, .content = NULL };
+/**
+ * @brief Size of content allocated by attack_alloc_result_content() that gets published by next status update.
+ */
+static unsigned pending_content_size = 0;
+/**
+ * @brief Guards attack_status fields and content reference counters. Never held while allocating or copying content.
+ */
+static portMUX_TYPE status_lock = portMUX_INITIALIZER_UNLOCKED;
 static esp_timer_handle_t attack_timeout_handle;
+/**
+ * @brief Session of current or last attack. Changed only by task that owns STARTING or STOPPING transition.
+ */
+static attack_config_t attack_session = { 0 };
+/**
+ * @brief Guards session state transitions that may come from event loop, timer and CLI tasks.
+ * Never held while starting or stopping the attack.
+ */
+static portMUX_TYPE session_lock = portMUX_INITIALIZER_UNLOCKED;
+static attack_session_state_t session_state = ATTACK_SESSION_IDLE;
+/**
+ * @brief Stop requested while session was STARTING, performed once the attack is started.
+ */
+static bool session_stop_requested = false;
+static attack_state_t session_stop_state = FINISHED;
+static const attack_ops_t *session_ops = NULL;
+/**
+ * @brief Number of attacks started since boot, guarded by session_lock
+ */
+static unsigned session_number = 0;
+/**
+ * @brief attack_resource_t flags of resources acquired by running session. Accessed only by task that owns
+ * STARTING or STOPPING transition.
+ */
+static unsigned session_resources = 0;
 
 const attack_status_t *attack_get_status() {
     return &attack_status;
 }
 
+static attack_status_chunk_t *attack_status_chunk_alloc(unsigned capacity) {
+    attack_status_chunk_t *chunk = mem_alloc(MEM_CATEGORY_HISTORY, sizeof(attack_status_chunk_t) + capacity);
+    if(chunk != NULL){
+        chunk->next = NULL;
+        chunk->capacity = capacity;
+    }
+    return chunk;
+}
+
+static void attack_status_chunks_free(attack_status_chunk_t *chunk) {
+    while(chunk != NULL){
+        attack_status_chunk_t *next = chunk->next;
+        mem_free(MEM_CATEGORY_HISTORY, chunk);
+        chunk = next;
+    }
+}
+
+/**
+ * @brief Drops one reference of status content and frees it once nobody uses it.
+ * 
+ * @param content may be NULL
+ */
+static void attack_status_content_release(attack_status_content_t *content) {
+    if(content == NULL){
+        return;
+    }
+    portENTER_CRITICAL(&status_lock);
+    bool unused = (--content->refs == 0);
+    portEXIT_CRITICAL(&status_lock);
+    if(unused){
+        attack_status_chunks_free(content->head);
+        mem_free(MEM_CATEGORY_HISTORY, content);
+    }
+}
+
+/**
+ * @brief Replaces current status content by new one and releases the previous.
+ * 
+ * @param content new content with single reference owned by attack_status, may be NULL
+ * @param published_size size of new content visible to readers
+ * @param pending_size size of new content published by next status update
+ */
+static void attack_status_content_replace(attack_status_content_t *content, unsigned published_size, unsigned pending_size) {
+    portENTER_CRITICAL(&status_lock);
+    attack_status_content_t *previous = attack_status.content;
+    attack_status.content = content;
+    attack_status.content_size = published_size;
+    pending_content_size = pending_size;
+    portEXIT_CRITICAL(&status_lock);
+    attack_status_content_release(previous);
+}
+
+void attack_status_snapshot_acquire(attack_status_t *snapshot) {
+    portENTER_CRITICAL(&status_lock);
+    *snapshot = attack_status;
+    if(snapshot->content != NULL){
+        snapshot->content->refs++;
+    }
+    portEXIT_CRITICAL(&status_lock);
+}
+
+void attack_status_snapshot_release(attack_status_t *snapshot) {
+    attack_status_content_release(snapshot->content);
+    snapshot->content = NULL;
+    snapshot->content_size = 0;
+}
+
+esp_err_t attack_status_snapshot_for_each(const attack_status_t *snapshot, attack_status_content_cb_t callback, void *ctx) {
+    unsigned remaining = snapshot->content_size;
+    const attack_status_chunk_t *chunk = (snapshot->content != NULL) ? snapshot->content->head : NULL;
+    // all chunks except the last one are full, so published size determines what is readable
+    while((remaining > 0) && (chunk != NULL)){
+        unsigned size = (remaining < chunk->capacity) ? remaining : chunk->capacity;
+        esp_err_t err = callback(chunk->data, size, ctx);
+        if(err != ESP_OK){
+            return err;
+        }
+        remaining -= size;
+        chunk = chunk->next;
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Unpins AP table of the last attack session and clears the session.
+ */
+static void attack_session_release() {
+    wifictl_ap_records_release(attack_session.ap_table);
+    memset(&attack_session, 0, sizeof(attack_config_t));
+}
+
+/**
+ * @brief Closes capture store session of the attack, if there is any.
+ * 
+ * HCCAPX result is stored next to the capture if handshake was captured.
+ */
+static void attack_capture_store_end() {
+    if(!capture_store_session_active()){
+        return;
+    }
+    hccapx_t *hccapx = hccapx_serializer_get();
+    if(hccapx != NULL){
+        capture_store_session_attach(CAPTURE_STORE_ARTIFACT_HCCAPX, hccapx, sizeof(hccapx_t));
+    }
+    capture_store_session_end();
+}
+
 void attack_update_status(attack_state_t state) {
+    portENTER_CRITICAL(&status_lock);
     attack_status.state = state;
-    if(state == FINISHED) {
-        ESP_LOGD(TAG, "Stopping attack timeout timer");
-        esp_err_t err = esp_timer_stop(attack_timeout_handle);
-        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
-            ESP_LOGE(TAG, "Failed to stop timer: %s", esp_err_to_name(err));
-        }
+    if(pending_content_size > 0){
+        attack_status.content_size = pending_content_size;
+        pending_content_size = 0;
     }
+    portEXIT_CRITICAL(&status_lock);
+    webserver_push_status();
 }
 
 void attack_append_status_content(uint8_t *buffer, unsigned size){
     if(size == 0){
-        ESP_LOGE(TAG, "Size can't be 0 if you want to reallocate");
+        ESP_LOGE(TAG, "Size can't be 0 if you want to append content");
         return;
     }
-    // temporarily save new location in case of realloc failure to preserve current content
-    char *reallocated_content = realloc(attack_status.content, attack_status.content_size + size);
-    if(reallocated_content == NULL){
-        ESP_LOGE(TAG, "Error reallocating status content! Status content may not be complete.");
+    if(attack_status.content_size + pending_content_size + size > UINT16_MAX){
+        ESP_LOGE(TAG, "Status content is full! Status content may not be complete.");
         return;
     }
-    // copy new data after current content
-    memcpy(&reallocated_content[attack_status.content_size], buffer, size);
-    attack_status.content = reallocated_content;
-    attack_status.content_size += size;
+    attack_status_content_t *content = attack_status.content;
+    if(content == NULL){
+        content = mem_calloc(MEM_CATEGORY_HISTORY, 1, sizeof(attack_status_content_t));
+        if(content == NULL){
+            ESP_LOGE(TAG, "Error allocating status content!");
+            return;
+        }
+        content->refs = 1;
+        attack_status_content_replace(content, 0, 0);
+    }
+
+    // allocate all missing chunks first, so failure leaves current content untouched
+    unsigned tail_free = (content->tail != NULL) ? content->tail->capacity - content->tail_used : 0;
+    attack_status_chunk_t *new_chunks = NULL;
+    attack_status_chunk_t **new_chunks_end = &new_chunks;
+    for(unsigned allocated = tail_free; allocated < size; allocated += ATTACK_STATUS_CHUNK_SIZE){
+        *new_chunks_end = attack_status_chunk_alloc(ATTACK_STATUS_CHUNK_SIZE);
+        if(*new_chunks_end == NULL){
+            ESP_LOGE(TAG, "Error allocating status content chunk! Status content may not be complete.");
+            attack_status_chunks_free(new_chunks);
+            return;
+        }
+        new_chunks_end = &(*new_chunks_end)->next;
+    }
+
+    // bytes behind published size are not visible to readers, so they can be written without locking
+    unsigned copied = (tail_free < size) ? tail_free : size;
+    if(copied > 0){
+        memcpy(&content->tail->data[content->tail_used], buffer, copied);
+        content->tail_used += copied;
+    }
+    while(new_chunks != NULL){
+        attack_status_chunk_t *chunk = new_chunks;
+        new_chunks = chunk->next;
+        chunk->next = NULL;
+        unsigned part = ((size - copied) < chunk->capacity) ? (size - copied) : chunk->capacity;
+        memcpy(chunk->data, &buffer[copied], part);
+        copied += part;
+        if(content->tail == NULL){
+            content->head = chunk;
+        } else {
+            content->tail->next = chunk;
+        }
+        content->tail = chunk;
+        content->tail_used = part;
+    }
+
+    // content allocated by attack_alloc_result_content() precedes appended data, so it has to be published too
+    portENTER_CRITICAL(&status_lock);
+    attack_status.content_size += pending_content_size + size;
+    pending_content_size = 0;
+    portEXIT_CRITICAL(&status_lock);
 }
 
 char *attack_alloc_result_content(unsigned size) {
-    attack_status.content_size = size;
-    attack_status.content = (char *) malloc(size);
-    return attack_status.content;
+    if((size == 0) || (size > UINT16_MAX)){
+        ESP_LOGE(TAG, "Invalid status content size %u", size);
+        return NULL;
+    }
+    attack_status_content_t *content = mem_calloc(MEM_CATEGORY_HISTORY, 1, sizeof(attack_status_content_t));
+    attack_status_chunk_t *chunk = attack_status_chunk_alloc(size);
+    if((content == NULL) || (chunk == NULL)){
+        ESP_LOGE(TAG, "Error allocating status content!");
+        mem_free(MEM_CATEGORY_HISTORY, content);
+        mem_free(MEM_CATEGORY_HISTORY, chunk);
+        return NULL;
+    }
+    content->refs = 1;
+    content->head = chunk;
+    content->tail = chunk;
+    content->tail_used = size;
+    attack_status_content_replace(content, 0, size);
+    return chunk->data;
 }
 
 /**
  * @brief Callback function for attack timeout timer.
  * 
- * This function is called when attack times out. 
- * It updates attack status state to TIMEOUT.
- * It calls appropriate abort functions based on current attack type.
+ * Stopping the attack ends capture store session and waits for flash, which must not block esp_timer task.
+ * So it only posts ATTACK_EVENT_TIMEOUT and the attack is stopped in event loop task.
  * @param arg not used.
  */
 static void attack_timeout(void* arg){
     ESP_LOGD(TAG, "Attack timed out");
-    
-    attack_update_status(TIMEOUT);
+    unsigned number = attack_get_session_number();
+    if(esp_event_post(ATTACK_EVENTS, ATTACK_EVENT_TIMEOUT, &number, sizeof(number), 0) != ESP_OK){
+        ESP_LOGW(TAG, "Event queue is full, retrying attack timeout");
+        esp_timer_start_once(attack_timeout_handle, ATTACK_TIMEOUT_RETRY_US);
+    }
+}
 
-    switch(attack_status.type) {
+/**
+ * @brief Callback for ATTACK_EVENT_TIMEOUT event.
+ * 
+ * Attack is stopped with TIMEOUT state only if it's still the one that timed out, because it could have been
+ * stopped and another one started while the event was queued.
+ * 
+ * @param args not used
+ * @param event_base expects ATTACK_EVENTS
+ * @param event_id expects ATTACK_EVENT_TIMEOUT
+ * @param event_data expects session number of timed out attack
+ */
+static void attack_timeout_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    if(*(unsigned *) event_data != attack_get_session_number()){
+        ESP_LOGD(TAG, "Timed out attack is no longer running");
+        return;
+    }
+    attack_stop(TIMEOUT);
+}
+
+/**
+ * @brief Returns attack specific operations for given attack type.
+ * 
+ * @param type attack_type_t
+ * @return const attack_ops_t* NULL if type is unknown or not implemented
+ */
+static const attack_ops_t *attack_get_ops(uint8_t type) {
+    switch(type) {
         case ATTACK_TYPE_PMKID:
-            ESP_LOGI(TAG, "Aborting PMKID attack...");
-            attack_pmkid_stop();
-            break;
+            return &attack_pmkid_ops;
         case ATTACK_TYPE_HANDSHAKE:
-            ESP_LOGI(TAG, "Abort HANDSHAKE attack...");
-            attack_handshake_stop();
-            break;
-        case ATTACK_TYPE_PASSIVE:
-            ESP_LOGI(TAG, "Abort PASSIVE attack...");
-            break;
+            return &attack_handshake_ops;
         case ATTACK_TYPE_DOS:
-            ESP_LOGI(TAG, "Abort DOS attack...");
-            attack_dos_stop();
-            break;
+            return &attack_dos_ops;
         default:
-            ESP_LOGE(TAG, "Unknown attack type. Not aborting anything");
+            return NULL;
     }
 }
 
+/**
+ * @brief Releases resources acquired by session in reverse order of acquisition.
+ * 
+ * Each resource is released only if it was acquired, so partially started session can be released too.
+ * Serializers are kept, because their results are available until attack reset.
+ */
+static void attack_session_release_resources() {
+    if(session_resources & ATTACK_RESOURCE_TIMEOUT_TIMER){
+        ESP_LOGD(TAG, "Stopping attack timeout timer");
+        esp_err_t err = esp_timer_stop(attack_timeout_handle);
+        if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+            ESP_LOGE(TAG, "Failed to stop timer: %s", esp_err_to_name(err));
+        }
+    }
+    if(session_resources & ATTACK_RESOURCE_EVENT_HANDLER){
+        ESP_ERROR_CHECK(esp_event_handler_unregister(FRAME_ANALYZER_EVENTS, session_ops->event_id, session_ops->event_handler));
+    }
+    if(session_resources & ATTACK_RESOURCE_SNIFFER){
+        frame_analyzer_capture_stop();
+        wifictl_sniffer_stop();
+    }
+    if(session_resources & ATTACK_RESOURCE_CAPTURE_STORE){
+        attack_capture_store_end();
+    }
+    session_resources = 0;
+}
+
+void attack_stop(attack_state_t state) {
+    portENTER_CRITICAL(&session_lock);
+    if(session_state == ATTACK_SESSION_STARTING){
+        session_stop_requested = true;
+        session_stop_state = state;
+    }
+    if(session_state != ATTACK_SESSION_RUNNING){
+        portEXIT_CRITICAL(&session_lock);
+        ESP_LOGD(TAG, "No attack running, nothing to stop");
+        return;
+    }
+    session_state = ATTACK_SESSION_STOPPING;
+    portEXIT_CRITICAL(&session_lock);
+
+    ESP_LOGI(TAG, "Stopping %s attack...", session_ops->name);
+    // timeout timer goes first so it cannot fire while attack is being stopped
+    if(session_resources & ATTACK_RESOURCE_TIMEOUT_TIMER){
+        esp_timer_stop(attack_timeout_handle);
+    }
+    session_ops->stop();
+    attack_session_release_resources();
+    attack_update_status(state);
+
+    portENTER_CRITICAL(&session_lock);
+    session_state = ATTACK_SESSION_IDLE;
+    portEXIT_CRITICAL(&session_lock);
+}
+
+unsigned attack_get_session_number() {
+    portENTER_CRITICAL(&session_lock);
+    unsigned number = session_number;
+    portEXIT_CRITICAL(&session_lock);
+    return number;
+}
+
+bool attack_is_running() {
+    attack_session_state_t state = session_state;
+    return (state == ATTACK_SESSION_STARTING) || (state == ATTACK_SESSION_RUNNING);
+}
+
 void log_attack_request(const attack_request_t *request) {
     if (!request) {
         ESP_LOGI(TAG, "attack_request_t is NULL");
@@ -138,104 +475,193 @@ void log_attack_config(const attack_config_t *config) {
     ESP_LOGI(TAG, "Actual Amount of AP Records: %d", config->actualAmount);
 
     // Logowanie poszczególnych rekordów AP
-    for (uint16_t i = 0; i < config->actualAmount && i < 10; i++) {
+    for (uint16_t i = 0; i < config->actualAmount; i++) {
         ESP_LOGI(TAG, "AP Record [%d]", i);
-        ESP_LOGI(TAG, "SSID: %s", config->ap_records[i].ssid);
+        ESP_LOGI(TAG, "SSID: %s", config->ap_records[i]->ssid);
     }
 }
 
 
 /**
- * @brief Callback for WEBSERVER_EVENT_ATTACK_REQUEST event.
+ * @brief Acquires common resources requested by attack_ops_t of the session.
  * 
- * This function handles WEBSERVER_EVENT_ATTACK_REQUEST event from event loop.
- * It parses attack_request_t structure and set initial values to attack_status.
- * It sets attack state to RUNNING.
- * It starts attack timeout timer.
- * It starts attack based on chosen type.
+ * Capture store session has to be opened before serializers, so PCAP stream goes into it.
  * 
- * @param args not used
- * @param event_base expects WEBSERVER_EVENTS
- * @param event_id expects WEBSERVER_EVENT_ATTACK_REQUEST
- * @param event_data expects attack_request_t
+ * @param attack_config session with at least one target AP if sniffer is requested
+ * @return esp_err_t ESP_ERR_INVALID_ARG if there is no target AP for sniffer
  */
-static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+static esp_err_t attack_session_acquire_resources(const attack_config_t *attack_config) {
+    const attack_ops_t *ops = session_ops;
+    const wifi_ap_record_t *ap_record = (attack_config->actualAmount > 0) ? attack_config->ap_records[0] : NULL;
+    if((ops->resources & (ATTACK_RESOURCE_SNIFFER | ATTACK_RESOURCE_SERIALIZERS)) && (ap_record == NULL)){
+        ESP_LOGE(TAG, "%s attack requires target AP", ops->name);
+        return ESP_ERR_INVALID_ARG;
+    }
+    if(ops->resources & ATTACK_RESOURCE_CAPTURE_STORE){
+        if(capture_store_session_begin(attack_config->type, ap_record->bssid) == ESP_OK){
+            session_resources |= ATTACK_RESOURCE_CAPTURE_STORE;
+        } else {
+            ESP_LOGW(TAG, "Capture will not be stored persistently");
+        }
+    }
+    if(ops->resources & ATTACK_RESOURCE_SERIALIZERS){
+        pcap_serializer_init();
+        hccapx_serializer_init(ap_record->ssid, strlen((char *) ap_record->ssid));
+        session_resources |= ATTACK_RESOURCE_SERIALIZERS;
+    }
+    if(ops->resources & ATTACK_RESOURCE_SNIFFER){
+        wifictl_sniffer_filter_frame_types(true, false, false);
+        wifictl_sniffer_start(ap_record->primary);
+        frame_analyzer_capture_start(ops->search, ap_record->bssid);
+        session_resources |= ATTACK_RESOURCE_SNIFFER;
+    }
+    if(ops->resources & ATTACK_RESOURCE_EVENT_HANDLER){
+        ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, ops->event_id, ops->event_handler, NULL));
+        session_resources |= ATTACK_RESOURCE_EVENT_HANDLER;
+    }
+    if(attack_config->timeout > 0){
+        ESP_LOGD(TAG, "Starting timeout timer for %d seconds", attack_config->timeout);
+        ESP_ERROR_CHECK(esp_timer_start_once(attack_timeout_handle, attack_config->timeout * 1000000ULL));
+        session_resources |= ATTACK_RESOURCE_TIMEOUT_TIMER;
+    }
+    return ESP_OK;
+}
 
-    ESP_LOGI(TAG, "Starting attack...");
+esp_err_t attack_start(const attack_request_t *attack_request) {
+    const wifictl_ap_records_t *ap_table = wifictl_ap_records_acquire();
+    esp_err_t err = attack_start_on_table(attack_request, ap_table);
+    wifictl_ap_records_release(ap_table);
+    return err;
+}
 
-    const attack_request_t *attack_request = (const attack_request_t *) event_data;
+esp_err_t attack_start_on_table(const attack_request_t *attack_request, const wifictl_ap_records_t *ap_table) {
 
-    attack_config_t attack_config = { .type = attack_request->type, .method = attack_request->method, .timeout = attack_request->timeout };
-    attack_config.actualAmount = attack_request->num_aps;
+    ESP_LOGI(TAG, "Starting attack...");
+
+    if(attack_request->num_aps > ATTACK_REQUEST_AP_MAX){
+        ESP_LOGE(TAG, "Attack request with %u APs rejected", attack_request->num_aps);
+        return ESP_ERR_INVALID_ARG;
+    }
+    const attack_ops_t *ops = attack_get_ops(attack_request->type);
+    if(ops == NULL){
+        ESP_LOGW(TAG, "Attack type %d is not implemented, request ignored", attack_request->type);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
 
-    vTaskDelay(pdMS_TO_TICKS(500));
+    portENTER_CRITICAL(&session_lock);
+    if(session_state != ATTACK_SESSION_IDLE){
+        portEXIT_CRITICAL(&session_lock);
+        ESP_LOGW(TAG, "Attack is already running, request ignored");
+        return ESP_ERR_INVALID_STATE;
+    }
+    session_state = ATTACK_SESSION_STARTING;
+    session_stop_requested = false;
+    session_number++;
+    portEXIT_CRITICAL(&session_lock);
+    session_ops = ops;
 
+    attack_session_release();
+    attack_config_t *attack_config = &attack_session;
+    attack_config->type = attack_request->type;
+    attack_config->method = attack_request->method;
+    attack_config->timeout = attack_request->timeout;
+    attack_config->ap_table = wifictl_ap_records_retain(ap_table);
     for (int i = 0; i < attack_request->num_aps; i++) {
-        const wifi_ap_record_t *ap_record = wifictl_get_ap_record(attack_request->ap_ids[i]);
-        if (ap_record) {
-            attack_config.ap_records[i] = *ap_record;
-            //ESP_LOGI(TAG, "Stored AP Record [%d]: SSID: %s, RSSI: %d", i, ap_record->ssid, ap_record->rssi);
+        uint8_t ap_id = attack_request->ap_ids[i];
+        if (ap_id < attack_config->ap_table->count) {
+            attack_config->ap_records[attack_config->actualAmount++] = &attack_config->ap_table->records[ap_id];
         } else {
-            ESP_LOGE(TAG, "wifictl_get_ap_record() returned NULL for AP ID %d", attack_request->ap_ids[i]);
+            ESP_LOGE(TAG, "AP ID %d is not in AP table", ap_id);
         }
     }
 
-    log_attack_config (&attack_config);
+    log_attack_config (attack_config);
+
+    esp_err_t err = attack_session_acquire_resources(attack_config);
+    if(err != ESP_OK){
+        attack_session_release_resources();
+        attack_session_release();
+        portENTER_CRITICAL(&session_lock);
+        session_state = ATTACK_SESSION_IDLE;
+        portEXIT_CRITICAL(&session_lock);
+        return err;
+    }
 
+    portENTER_CRITICAL(&status_lock);
     attack_status.state = RUNNING;
-    attack_status.type = attack_config.type;
+    attack_status.type = attack_config->type;
+    portEXIT_CRITICAL(&status_lock);
+    webserver_push_status();
 
-    if(attack_config.timeout > 0){
-        ESP_LOGD(TAG, "Starting timeout timer for %d seconds", attack_config.timeout);
-        ESP_ERROR_CHECK(esp_timer_start_once(attack_timeout_handle, attack_config.timeout * 1000000ULL));
-    }
-    
-    // start attack based on it's type
-    switch(attack_config.type) {
-        case ATTACK_TYPE_PMKID:
-            attack_pmkid_start(&attack_config);
-            break;
-        case ATTACK_TYPE_HANDSHAKE:
-            attack_handshake_start(&attack_config);
-            break;
-        case ATTACK_TYPE_PASSIVE:
-            ESP_LOGW(TAG, "ATTACK_TYPE_PASSIVE not implemented yet!");
-            break;
-        case ATTACK_TYPE_DOS:
-            attack_dos_start(&attack_config);
-            break;
-        default:
-            ESP_LOGE(TAG, "Unknown attack type!");
-    }
+    ESP_LOGI(TAG, "Starting %s attack...", ops->name);
+    ops->start(attack_config);
 
+    portENTER_CRITICAL(&session_lock);
+    session_state = ATTACK_SESSION_RUNNING;
+    bool stop_requested = session_stop_requested;
+    portEXIT_CRITICAL(&session_lock);
+    if(stop_requested){
+        attack_stop(session_stop_state);
+    }
+    return ESP_OK;
 }
 
 /**
- * @brief Callback for WEBSERVER_EVENT_ATTACK_RESET event.
+ * @brief Callback for WEBSERVER_EVENT_ATTACK_REQUEST event.
  * 
- * This callback resets attack status by freeing previously allocated status content and putting attack to READY state.
+ * This function handles WEBSERVER_EVENT_ATTACK_REQUEST event from event loop and starts requested attack.
  * 
  * @param args not used
  * @param event_base expects WEBSERVER_EVENTS
- * @param event_id expects WEBSERVER_EVENT_ATTACK_RESET
- * @param event_data not used
+ * @param event_id expects WEBSERVER_EVENT_ATTACK_REQUEST
+ * @param event_data expects attack_request_t
  */
-static void attack_reset_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+static void attack_request_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    attack_start((const attack_request_t *) event_data);
+}
+
+void attack_reset() {
     ESP_LOGD(TAG, "Resetting attack status...");
-    if(attack_status.content){
-        free(attack_status.content);
-        attack_status.content = NULL;
+    attack_stop(FINISHED);
+    // session is claimed by STOPPING state, so no attack can start while it is being released
+    portENTER_CRITICAL(&session_lock);
+    if(session_state != ATTACK_SESSION_IDLE){
+        portEXIT_CRITICAL(&session_lock);
+        ESP_LOGW(TAG, "Attack is still being started or stopped, keeping its session");
+        return;
     }
-    attack_status.content_size = 0;
+    session_state = ATTACK_SESSION_STOPPING;
+    portEXIT_CRITICAL(&session_lock);
+    attack_session_release();
+    pcap_serializer_deinit();
+    attack_status_content_replace(NULL, 0, 0);
+    portENTER_CRITICAL(&status_lock);
     attack_status.type = -1;
     attack_status.state = READY;
+    portEXIT_CRITICAL(&status_lock);
+    portENTER_CRITICAL(&session_lock);
+    session_state = ATTACK_SESSION_IDLE;
+    portEXIT_CRITICAL(&session_lock);
+    webserver_push_status();
+}
+
+/**
+ * @brief Callback for WEBSERVER_EVENT_ATTACK_RESET event.
+ * 
+ * @param args not used
+ * @param event_base expects WEBSERVER_EVENTS
+ * @param event_id expects WEBSERVER_EVENT_ATTACK_RESET
+ * @param event_data not used
+ */
+static void attack_reset_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    attack_reset();
 }
 
 /**
  * @brief Initialises common attack resources.
  * 
  * Creates attack timeout timer.
- * Registers event loop event handlers.
+ * Registers event loop event handlers, including the one that stops timed out attack.
  */
 void attack_init(){
     const esp_timer_create_args_t attack_timeout_args = {
@@ -245,4 +671,5 @@ void attack_init(){
 
     ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_REQUEST, &attack_request_handler, NULL));
     ESP_ERROR_CHECK(esp_event_handler_register(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_RESET, &attack_reset_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(ATTACK_EVENTS, ATTACK_EVENT_TIMEOUT, &attack_timeout_handler, NULL));
 }
\ No newline at end of file
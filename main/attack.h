@@ -13,7 +13,14 @@
 #ifndef ATTACK_H
 #define ATTACK_H
 
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "esp_event.h"
 #include "esp_wifi_types.h"
+#include "wifi_controller.h"
+#include "frame_analyzer.h"
+#include "webserver.h"
 
 /**
  * @brief Implemented attack types that can be chosen.
@@ -39,46 +46,175 @@ typedef enum {
 } attack_state_t;
 
 /**
- * @brief Attack config parsed from webserver request
+ * @brief Attack session created from webserver request
  * 
- * @deprecated will be removed in #45
+ * Session pins AP table the request refers to and keeps pointers to chosen records in it, so they stay valid
+ * for the whole attack even if APs are rescanned. It's created once per attack and released when the attack is reset.
  */
 typedef struct {
     uint8_t type;
     uint8_t method;
     uint8_t timeout;
-    wifi_ap_record_t ap_records[10];
-    uint16_t actualAmount;
+    uint16_t actualAmount;                                      ///< number of valid items in ap_records
+    const wifictl_ap_records_t *ap_table;                       ///< pinned AP table
+    const wifi_ap_record_t *ap_records[ATTACK_REQUEST_AP_MAX];  ///< chosen APs, pointing into ap_table
 } attack_config_t;
 
+/**
+ * @brief Common resources acquired by session manager before attack start and released after attack stop.
+ */
+typedef enum {
+    ATTACK_RESOURCE_SNIFFER = 0x01,         ///< sniffer on channel of the first target AP with frame analyzer searching attack_ops_t.search
+    ATTACK_RESOURCE_SERIALIZERS = 0x02,     ///< PCAP and HCCAPX serializers
+    ATTACK_RESOURCE_CAPTURE_STORE = 0x04,   ///< capture store session that receives PCAP stream
+    ATTACK_RESOURCE_EVENT_HANDLER = 0x08,   ///< attack_ops_t.event_handler registered for attack_ops_t.event_id
+    ATTACK_RESOURCE_TIMEOUT_TIMER = 0x10    ///< attack timeout timer, acquired if attack_config_t.timeout is set
+} attack_resource_t;
+
+/**
+ * @brief Attack specific part of attack session.
+ * 
+ * Every attack type implements only what is specific to it. Session manager acquires all common resources
+ * listed in resources before start() is called and releases them after stop().
+ */
+typedef struct {
+    const char *name;
+    unsigned resources;                     ///< attack_resource_t flags
+    search_type_t search;                   ///< used with ATTACK_RESOURCE_SNIFFER
+    int32_t event_id;                       ///< FRAME_ANALYZER_EVENTS event used with ATTACK_RESOURCE_EVENT_HANDLER
+    esp_event_handler_t event_handler;
+    void (*start)(const attack_config_t *attack_config);
+    void (*stop)();                         ///< reverts everything done by start(), called exactly once per start()
+} attack_ops_t;
+
+
+/**
+ * @brief Refcounted chunked storage of attack status content.
+ * 
+ * Content is append-only. Bytes that were published once are never modified or moved,
+ * so readers holding a snapshot can access them while writer keeps appending.
+ */
+typedef struct attack_status_content attack_status_content_t;
 
 /**
  * @brief Contains current attack status.
  * 
  * This structure contains all information and data about latest attack.
+ * First 4 bytes are sent as header of \c /status response.
  */
 typedef struct {
     uint8_t state;  ///< attack_state_t
     uint8_t type;   ///< attack_type_t
     uint16_t content_size;
-    char *content;
+    attack_status_content_t *content;
 } attack_status_t;
 
+/**
+ * @brief Callback receiving continuous parts of status content.
+ * 
+ * @param data part of the content
+ * @param size size of the part
+ * @param ctx user context
+ * @return esp_err_t ESP_OK to continue with next part
+ */
+typedef esp_err_t (*attack_status_content_cb_t)(const char *data, unsigned size, void *ctx);
+
 /**
  * @brief Returns pointer to attack_status_t structure.
  * 
+ * Only state and type may be read from returned structure. Use attack_status_snapshot_acquire() to access content.
+ * 
  * @return const attack_status_t*  pointer to the status strucutre
  */
 const attack_status_t *attack_get_status();
 
+/**
+ * @brief Takes consistent snapshot of current attack status.
+ * 
+ * Snapshot keeps reference to status content, so the content stays valid even if attack is reset in the meantime.
+ * Snapshot has to be released by attack_status_snapshot_release().
+ * 
+ * @param snapshot output snapshot
+ */
+void attack_status_snapshot_acquire(attack_status_t *snapshot);
+
+/**
+ * @brief Releases status content referenced by snapshot.
+ * 
+ * @param snapshot
+ */
+void attack_status_snapshot_release(attack_status_t *snapshot);
+
+/**
+ * @brief Passes content of snapshot to callback as sequence of continuous parts.
+ * 
+ * @param snapshot snapshot acquired by attack_status_snapshot_acquire()
+ * @param callback
+ * @param ctx user context passed to callback
+ * @return esp_err_t ESP_OK or first error returned by callback
+ */
+esp_err_t attack_status_snapshot_for_each(const attack_status_t *snapshot, attack_status_content_cb_t callback, void *ctx);
+
 /**
  * @brief Function to update current status of attack.
  * 
- * If FINISHED state is passed, then the attack timeout timer is stopped.
+ * Only updates and publishes status, use attack_stop() to stop running attack.
  * @param state new attack state of type attack_state_t to be set
  */
 void attack_update_status(attack_state_t state);
 
+/**
+ * @brief Starts attack described by attack request.
+ * 
+ * Builds attack session, acquires all common resources of chosen attack type and starts the attack.
+ * Attack state is set to RUNNING. Can be called from any task.
+ * @param attack_request
+ * @return esp_err_t ESP_ERR_INVALID_STATE if another attack is running,
+ *  ESP_ERR_NOT_SUPPORTED if attack type is not implemented, ESP_ERR_INVALID_ARG for invalid request
+ */
+esp_err_t attack_start(const attack_request_t *attack_request);
+
+/**
+ * @brief Starts attack whose AP IDs refer to AP table pinned by caller.
+ * 
+ * Same as attack_start(), but AP IDs are resolved in given table instead of current one, so a rescan
+ * between looking up the APs and starting the attack cannot change its targets. Session retains its own reference.
+ * @param attack_request
+ * @param ap_table pinned by wifictl_ap_records_acquire()
+ * @return esp_err_t see attack_start()
+ */
+esp_err_t attack_start_on_table(const attack_request_t *attack_request, const wifictl_ap_records_t *ap_table);
+
+/**
+ * @brief Stops running attack and releases all its resources.
+ * 
+ * Can be called from any task and any number of times, only the first call stops the attack.
+ * Attack results stay available until the attack is reset.
+ * @param state final state, FINISHED or TIMEOUT
+ */
+void attack_stop(attack_state_t state);
+
+/**
+ * @brief Stops running attack, frees results of the last attack and puts attack to READY state.
+ */
+void attack_reset();
+
+/**
+ * @brief Returns number of attacks started since boot.
+ * 
+ * Identifies the attack whose results are currently kept, e.g. to find out whether another attack was started meanwhile.
+ * @return unsigned 0 if no attack was started yet
+ */
+unsigned attack_get_session_number();
+
+/**
+ * @brief Returns true if attack session is starting or running.
+ * 
+ * @return true 
+ * @return false 
+ */
+bool attack_is_running();
+
 /**
  * @brief Initialises attack wrapper. This function should be callend only once.
  * 
@@ -89,13 +225,18 @@ void attack_init();
 /**
  * @brief Allocates status content of given size.
  *  
+ * Previous content is discarded. Returned buffer is not visible to readers until next attack_update_status() call,
+ * so it has to be filled before the attack is stopped.
+ * 
  * @param size size to be allocated
  * @return char* pointer to newly allocated status content
  */
 char *attack_alloc_result_content(unsigned size);
 
 /**
- * @brief Reallocates current status content and appends new data.
+ * @brief Appends new data to current status content.
+ * 
+ * Data are copied into content chunks and published at once. Readers are never blocked by appending.
  * 
  * @param buffer new data to be appended to status content
  * @param size size of the new data to be appended
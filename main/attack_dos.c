@@ -19,7 +19,7 @@
 static const char *TAG = "main:attack_dos";
 static attack_dos_methods_t method = -1;
 
-void attack_dos_start(attack_config_t *attack_config) {
+static void attack_dos_start(const attack_config_t *attack_config) {
     ESP_LOGI(TAG, "Starting DoS attack...");
     method = attack_config->method;
     ESP_LOGI(TAG, "Attack Method selected: %d", method);
@@ -27,8 +27,8 @@ void attack_dos_start(attack_config_t *attack_config) {
         case ATTACK_DOS_METHOD_BROADCAST:
             ESP_LOGI(TAG, "ATTACK_DOS_METHOD_BROADCAST starting for mutiple APs listed below");
             for (int i=0; i< attack_config->actualAmount; i++) {
-                ESP_LOGI(TAG, "About to invoke ATTACK_DOS_METHOD_BROADCAST 4 SSID: %s", attack_config->ap_records[i].ssid);
-                ESP_LOGI(TAG, "Channel is: %d", attack_config->ap_records[i].primary);
+                ESP_LOGI(TAG, "About to invoke ATTACK_DOS_METHOD_BROADCAST 4 SSID: %s", attack_config->ap_records[i]->ssid);
+                ESP_LOGI(TAG, "Channel is: %d", attack_config->ap_records[i]->primary);
             }            
             attack_method_broadcast_multiple_ap(attack_config->ap_records, attack_config->actualAmount, 1);
             break;
@@ -46,7 +46,7 @@ void attack_dos_start(attack_config_t *attack_config) {
     }
 }
 
-void attack_dos_stop() {
+static void attack_dos_stop() {
     switch(method){
         case ATTACK_DOS_METHOD_BROADCAST:
             attack_method_broadcast_stop();
@@ -64,5 +64,13 @@ void attack_dos_stop() {
         default:
             ESP_LOGE(TAG, "Unknown attack method! Attack may not be stopped properly.");
     }
+    method = -1;
     ESP_LOGI(TAG, "DoS attack stopped");
-}
\ No newline at end of file
+}
+
+const attack_ops_t attack_dos_ops = {
+    .name = "DoS",
+    .resources = 0,
+    .start = &attack_dos_start,
+    .stop = &attack_dos_stop
+};
\ No newline at end of file
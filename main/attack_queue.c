@@ -0,0 +1,271 @@
+/**
+ * @file attack_queue.c
+ * @date 2026-10-19
+ *
+ * @brief Implements queue of receive-only jobs run by dedicated task.
+ *
+ * Jobs are run through attack session manager, so queue never touches sniffer or serializers directly.
+ * Task is created on first run and then waits for next run, so it can always be notified safely.
+ */
+#include "attack_queue.h"
+
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "attack.h"
+#include "attack_handshake.h"
+#include "capture_store.h"
+#include "led_status.h"
+#include "webserver.h"
+#include "wifi_controller.h"
+
+/**
+ * @brief Longest time the task sleeps before it checks whether running capture was stopped from outside.
+ */
+#define ATTACK_QUEUE_POLL_MS 1000
+
+static const char *TAG = "main:attack_queue";
+static attack_queue_entry_t entries[CONFIG_ATTACK_QUEUE_MAX_JOBS];
+/**
+ * @brief AP tables pinned by finished survey jobs
+ */
+static const wifictl_ap_records_t *surveys[CONFIG_ATTACK_QUEUE_MAX_JOBS];
+static unsigned entry_count = 0;
+static bool running = false;
+static volatile bool cancel_requested = false;
+/**
+ * @brief Attack session of the last capture job, its results can be discarded by next job. 0 if there is none.
+ */
+static unsigned queue_session_number = 0;
+/**
+ * @brief Guards entries, surveys, entry_count and running
+ */
+static portMUX_TYPE queue_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t queue_task = NULL;
+
+static void set_state(unsigned index, attack_queue_job_state_t state) {
+    portENTER_CRITICAL(&queue_lock);
+    entries[index].state = state;
+    portEXIT_CRITICAL(&queue_lock);
+}
+
+/**
+ * @brief Finds BSSID in AP table.
+ *
+ * @param records pinned AP table
+ * @param bssid
+ * @return int index of AP in AP table or -1 if not found
+ */
+static int find_ap(const wifictl_ap_records_t *records, const uint8_t *bssid) {
+    for(unsigned i = 0; i < records->count; i++){
+        if(memcmp(records->records[i].bssid, bssid, 6) == 0){
+            return i;
+        }
+    }
+    return -1;
+}
+
+static attack_queue_job_state_t run_capture(unsigned index, const attack_queue_job_t *job) {
+    if(attack_is_running()){
+        ESP_LOGE(TAG, "Job %u: capture cannot run while attack is running", index);
+        return ATTACK_QUEUE_JOB_FAILED;
+    }
+    // attack is started on the same table, so rescan meanwhile cannot change its target
+    const wifictl_ap_records_t *records = wifictl_ap_records_acquire();
+    int ap_id = find_ap(records, job->bssid);
+    if(ap_id < 0){
+        wifictl_ap_records_release(records);
+        ESP_LOGE(TAG, "Job %u: BSSID %02x:%02x:%02x:%02x:%02x:%02x is not in AP table", index,
+            job->bssid[0], job->bssid[1], job->bssid[2], job->bssid[3], job->bssid[4], job->bssid[5]);
+        return ATTACK_QUEUE_JOB_FAILED;
+    }
+
+    // results of previous job are kept in capture store, so its status can be discarded,
+    // but results of attack started from elsewhere meanwhile are kept
+    if((queue_session_number != 0) && (attack_get_session_number() == queue_session_number)){
+        attack_reset();
+    }
+    attack_request_t request = {
+        .type = ATTACK_TYPE_HANDSHAKE,
+        .method = ATTACK_HANDSHAKE_METHOD_PASSIVE,
+        .timeout = 0,
+        .num_aps = 1,
+        .ap_ids = { ap_id }
+    };
+    esp_err_t err = attack_start_on_table(&request, records);
+    wifictl_ap_records_release(records);
+    if(err != ESP_OK){
+        ESP_LOGE(TAG, "Job %u: capture could not be started", index);
+        return ATTACK_QUEUE_JOB_FAILED;
+    }
+    queue_session_number = attack_get_session_number();
+    int session = capture_store_session_id();
+    portENTER_CRITICAL(&queue_lock);
+    entries[index].session = session;
+    portEXIT_CRITICAL(&queue_lock);
+    led_status_set_state(LED_STATE_ATTACK);
+
+    TickType_t started = xTaskGetTickCount();
+    TickType_t duration = pdMS_TO_TICKS(job->duration * 1000U);
+    while(attack_is_running() && !cancel_requested){
+        TickType_t elapsed = xTaskGetTickCount() - started;
+        if(elapsed >= duration){
+            break;
+        }
+        TickType_t wait = duration - elapsed;
+        ulTaskNotifyTake(pdTRUE, (wait < pdMS_TO_TICKS(ATTACK_QUEUE_POLL_MS)) ? wait : pdMS_TO_TICKS(ATTACK_QUEUE_POLL_MS));
+    }
+    // attack started from elsewhere after this one stopped on its own must not be stopped
+    if(attack_get_session_number() == queue_session_number){
+        attack_stop(FINISHED);
+    }
+    return cancel_requested ? ATTACK_QUEUE_JOB_CANCELLED : ATTACK_QUEUE_JOB_DONE;
+}
+
+static attack_queue_job_state_t run_survey(unsigned index, const attack_queue_job_t *job) {
+    if(attack_is_running()){
+        ESP_LOGE(TAG, "Job %u: survey cannot run while attack is running", index);
+        return ATTACK_QUEUE_JOB_FAILED;
+    }
+    led_status_set_state(LED_STATE_SCAN);
+    wifictl_survey_nearby_aps(job->dwell_ms);
+    const wifictl_ap_records_t *records = wifictl_ap_records_acquire();
+    portENTER_CRITICAL(&queue_lock);
+    surveys[index] = records;
+    entries[index].aps = records->count;
+    portEXIT_CRITICAL(&queue_lock);
+    return ATTACK_QUEUE_JOB_DONE;
+}
+
+/**
+ * @brief Runs all pending jobs in order, including jobs added while running.
+ */
+static void run_jobs() {
+    for(unsigned index = 0; ; index++){
+        portENTER_CRITICAL(&queue_lock);
+        if(index >= entry_count){
+            portEXIT_CRITICAL(&queue_lock);
+            break;
+        }
+        attack_queue_job_t job = entries[index].job;
+        bool pending = (entries[index].state == ATTACK_QUEUE_JOB_PENDING);
+        if(pending){
+            entries[index].state = cancel_requested ? ATTACK_QUEUE_JOB_CANCELLED : ATTACK_QUEUE_JOB_RUNNING;
+        }
+        portEXIT_CRITICAL(&queue_lock);
+        if(!pending || cancel_requested){
+            continue;
+        }
+
+        ESP_LOGI(TAG, "Running job %u", index);
+        attack_queue_job_state_t state = (job.type == ATTACK_QUEUE_JOB_CAPTURE) ? run_capture(index, &job) : run_survey(index, &job);
+        set_state(index, state);
+        ESP_LOGI(TAG, "Job %u finished with state %d", index, state);
+    }
+    led_status_set_state(LED_STATE_IDLE);
+}
+
+static void queue_task_main(void *arg) {
+    while(true){
+        portENTER_CRITICAL(&queue_lock);
+        bool run = running;
+        portEXIT_CRITICAL(&queue_lock);
+        if(!run){
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+        run_jobs();
+        portENTER_CRITICAL(&queue_lock);
+        running = false;
+        portEXIT_CRITICAL(&queue_lock);
+        ESP_LOGI(TAG, "Queue finished");
+    }
+}
+
+esp_err_t attack_queue_add(const attack_queue_job_t *job) {
+    portENTER_CRITICAL(&queue_lock);
+    if(entry_count >= CONFIG_ATTACK_QUEUE_MAX_JOBS){
+        portEXIT_CRITICAL(&queue_lock);
+        ESP_LOGE(TAG, "Queue is full");
+        return ESP_ERR_NO_MEM;
+    }
+    entries[entry_count] = (attack_queue_entry_t){
+        .job = *job,
+        .state = ATTACK_QUEUE_JOB_PENDING,
+        .session = -1,
+        .aps = 0
+    };
+    surveys[entry_count] = NULL;
+    entry_count++;
+    portEXIT_CRITICAL(&queue_lock);
+    return ESP_OK;
+}
+
+esp_err_t attack_queue_run() {
+    portENTER_CRITICAL(&queue_lock);
+    if(running){
+        portEXIT_CRITICAL(&queue_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    running = true;
+    cancel_requested = false;
+    portEXIT_CRITICAL(&queue_lock);
+
+    if(queue_task == NULL){
+        xTaskCreate(queue_task_main, "attack_queue", 4096, NULL, 5, &queue_task);
+    } else {
+        xTaskNotifyGive(queue_task);
+    }
+    return ESP_OK;
+}
+
+void attack_queue_cancel() {
+    cancel_requested = true;
+    if(queue_task != NULL){
+        xTaskNotifyGive(queue_task);
+    }
+}
+
+esp_err_t attack_queue_clear() {
+    const wifictl_ap_records_t *released[CONFIG_ATTACK_QUEUE_MAX_JOBS];
+    portENTER_CRITICAL(&queue_lock);
+    if(running){
+        portEXIT_CRITICAL(&queue_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    unsigned count = entry_count;
+    memcpy(released, surveys, count * sizeof(surveys[0]));
+    entry_count = 0;
+    portEXIT_CRITICAL(&queue_lock);
+
+    for(unsigned i = 0; i < count; i++){
+        wifictl_ap_records_release(released[i]);
+    }
+    return ESP_OK;
+}
+
+bool attack_queue_is_running() {
+    return running;
+}
+
+unsigned attack_queue_get_entries(attack_queue_entry_t *out, unsigned max) {
+    portENTER_CRITICAL(&queue_lock);
+    unsigned count = (entry_count < max) ? entry_count : max;
+    memcpy(out, entries, count * sizeof(attack_queue_entry_t));
+    portEXIT_CRITICAL(&queue_lock);
+    return count;
+}
+
+const wifictl_ap_records_t *attack_queue_survey_acquire(unsigned index) {
+    const wifictl_ap_records_t *records = NULL;
+    portENTER_CRITICAL(&queue_lock);
+    if((index < entry_count) && (surveys[index] != NULL)){
+        records = wifictl_ap_records_retain(surveys[index]);
+    }
+    portEXIT_CRITICAL(&queue_lock);
+    return records;
+}
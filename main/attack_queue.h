@@ -0,0 +1,112 @@
+/**
+ * @file attack_queue.h
+ * @date 2026-10-19
+ *
+ * @brief Provides interface to queue of receive-only jobs that are run back to back without user interaction.
+ *
+ * Capture jobs run passive handshake capture against given BSSID, each one into its own capture store session.
+ * Capture and survey jobs fail if another attack is running when they start, they never stop it.
+ * Survey jobs passively scan nearby APs and keep their AP table pinned as the job result.
+ */
+#ifndef ATTACK_QUEUE_H
+#define ATTACK_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "esp_err.h"
+#include "wifi_controller.h"
+
+/**
+ * @brief Kinds of queued jobs
+ */
+typedef enum {
+    ATTACK_QUEUE_JOB_CAPTURE,   ///< passive handshake capture on BSSID for given duration
+    ATTACK_QUEUE_JOB_SURVEY     ///< passive scan of all channels
+} attack_queue_job_type_t;
+
+/**
+ * @brief States of queued job
+ */
+typedef enum {
+    ATTACK_QUEUE_JOB_PENDING,
+    ATTACK_QUEUE_JOB_RUNNING,
+    ATTACK_QUEUE_JOB_DONE,
+    ATTACK_QUEUE_JOB_FAILED,    ///< job could not be started, e.g. BSSID is not in AP table
+    ATTACK_QUEUE_JOB_CANCELLED
+} attack_queue_job_state_t;
+
+/**
+ * @brief Job description
+ */
+typedef struct {
+    uint8_t type;           ///< attack_queue_job_type_t
+    uint8_t bssid[6];       ///< capture target, has to be present in AP table when job starts
+    uint16_t duration;      ///< capture duration in seconds
+    uint16_t dwell_ms;      ///< survey listening time per channel in milliseconds
+} attack_queue_job_t;
+
+/**
+ * @brief Queued job with its result
+ */
+typedef struct {
+    attack_queue_job_t job;
+    uint8_t state;          ///< attack_queue_job_state_t
+    int session;            ///< capture store session of capture job, -1 if capture was not stored
+    uint16_t aps;           ///< number of APs found by survey job
+} attack_queue_entry_t;
+
+/**
+ * @brief Appends job to the end of the queue. Jobs can be added while the queue is running.
+ *
+ * @param job
+ * @return esp_err_t ESP_ERR_NO_MEM if queue is full
+ */
+esp_err_t attack_queue_add(const attack_queue_job_t *job);
+
+/**
+ * @brief Starts running pending jobs in order in a separate task.
+ *
+ * @return esp_err_t ESP_ERR_INVALID_STATE if queue is already running
+ */
+esp_err_t attack_queue_run();
+
+/**
+ * @brief Stops running job and cancels all pending jobs.
+ */
+void attack_queue_cancel();
+
+/**
+ * @brief Removes all jobs and their results from the queue.
+ *
+ * @return esp_err_t ESP_ERR_INVALID_STATE if queue is running
+ */
+esp_err_t attack_queue_clear();
+
+/**
+ * @brief Returns whether queue is running.
+ *
+ * @return true
+ * @return false
+ */
+bool attack_queue_is_running();
+
+/**
+ * @brief Copies queued jobs with their results.
+ *
+ * @param entries output
+ * @param max capacity of entries
+ * @return unsigned number of copied entries
+ */
+unsigned attack_queue_get_entries(attack_queue_entry_t *entries, unsigned max);
+
+/**
+ * @brief Pins AP table found by survey job.
+ *
+ * @param index index of the job in queue
+ * @return const wifictl_ap_records_t* NULL if job is not finished survey, otherwise has to be released
+ *  by wifictl_ap_records_release()
+ */
+const wifictl_ap_records_t *attack_queue_survey_acquire(unsigned index);
+
+#endif
@@ -0,0 +1,151 @@
+/**
+ * @file gui.c
+ * @date 2026-10-19
+ *
+ * @brief Implements event driven GUI.
+ *
+ * Display refresh timer of LVGL is paused, GUI task refreshes the display itself after it updated
+ * changed widgets. lv_label_set_text() invalidates only area of the label, so lv_refr_now() redraws
+ * and flushes only those areas. Labels whose text did not change are not touched at all.
+ */
+#include "gui.h"
+
+#include <stdio.h>
+#include <string.h>
+#define LOG_LOCAL_LEVEL ESP_LOG_VERBOSE
+#include "esp_log.h"
+#include "esp_event.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+
+#include "mem_alloc.h"
+#include "st7789.h"
+#include "wsl_bypasser.h"
+
+#define GUI_STACK_SIZE 4000
+#define GUI_LABEL_COUNT 15
+#define GUI_LABEL_HEIGHT 15
+
+static const char *TAG = "main:gui";
+static TaskHandle_t gui_task_handle = NULL;
+static lv_obj_t *labels[GUI_LABEL_COUNT];
+
+static uint32_t gui_tick_ms(void) {
+    return esp_timer_get_time() / 1000;
+}
+
+/**
+ * @brief Sets label text only if it differs, so unchanged labels are not invalidated.
+ */
+static void set_label_text(unsigned index, const char *text) {
+    if(strcmp(lv_label_get_text(labels[index]), text) != 0){
+        lv_label_set_text(labels[index], text);
+    }
+}
+
+static void update_widgets(uint32_t changes) {
+    // consistent copy, attack timer can update telemetry meanwhile
+    wsl_bypasser_telemetry_t telemetry;
+    wsl_bypasser_get_telemetry(&telemetry);
+    if(telemetry.target_count == 0){
+        set_label_text(0, "AP: Livebox");
+        set_label_text(1, "Pass: mgmtadmin");
+        set_label_text(2, "IP: 192.168.4.1");
+        return;
+    }
+    if(changes & GUI_CHANGE_RATE){
+        char buffer[32];
+        snprintf(buffer, sizeof(buffer), "Frames per second: %u", (unsigned) telemetry.frames_per_second);
+        set_label_text(0, buffer);
+    }
+    if(changes & GUI_CHANGE_TARGETS){
+        set_label_text(1, "SSIDs attacked:");
+        for(unsigned i = 2; i < GUI_LABEL_COUNT; i++){
+            unsigned target = i - 2;
+            set_label_text(i, (target < telemetry.target_count) ? telemetry.targets[target] : "");
+        }
+    }
+}
+
+static void wsl_bypasser_event_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data) {
+    gui_notify((event_id == WSL_BYPASSER_EVENT_RATE_CHANGED) ? GUI_CHANGE_RATE : GUI_CHANGE_ALL);
+}
+
+static void gui_task(void *arg) {
+    lv_init();
+    lv_tick_set_cb(gui_tick_ms);
+
+    lv_display_t *display = lv_display_create(MY_DISP_HOR_RES, MY_DISP_VER_RES);
+    lv_display_set_resolution(display, MY_DISP_HOR_RES, MY_DISP_VER_RES);
+
+    // draw buffers are only written by CPU, flush copies them into internal DMA chunks
+    const size_t buf_size = MY_DISP_HOR_RES * CONFIG_GUI_DRAW_BUFFER_LINES
+                            * lv_color_format_get_size(lv_display_get_color_format(display));
+    lv_color_t *buf1 = mem_alloc(MEM_CATEGORY_DISPLAY, buf_size);
+    lv_color_t *buf2 = mem_alloc(MEM_CATEGORY_DISPLAY, buf_size);
+    if((buf1 == NULL) || (buf2 == NULL)){
+        ESP_LOGE(TAG, "Cannot allocate LVGL draw buffers!");
+        vTaskDelete(NULL);
+        return;
+    }
+    lv_display_set_buffers(display, buf1, buf2, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(display, st7789_flush);
+    // flush completes asynchronously, LVGL blocks on it instead of busy waiting
+    lv_display_set_flush_wait_cb(display, st7789_flush_wait);
+    // display is refreshed by this task only after widgets changed
+    lv_timer_pause(lv_display_get_refr_timer(display));
+
+    static lv_style_t st;
+    lv_style_init(&st);
+    lv_style_set_text_font(&st, &lv_font_montserrat_14);
+
+    lv_obj_t *screen = lv_screen_active();
+    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
+    lv_style_set_bg_color(&st, lv_color_black());
+    lv_style_set_text_color(&st, lv_color_white());
+
+    for(unsigned i = 0; i < GUI_LABEL_COUNT; i++){
+        labels[i] = lv_label_create(screen);
+        lv_label_set_text(labels[i], "");
+        lv_obj_set_pos(labels[i], 0, GUI_LABEL_HEIGHT * i);
+        lv_obj_add_style(labels[i], &st, 0);
+    }
+
+    const TickType_t frame_period = pdMS_TO_TICKS(1000 / CONFIG_GUI_MAX_FPS);
+    TickType_t last_refresh = xTaskGetTickCount() - frame_period;
+    uint32_t changes = GUI_CHANGE_ALL;
+    while(true){
+        if(changes != 0){
+            // notifications arriving before the frame period elapses are merged into this redraw
+            TickType_t elapsed = xTaskGetTickCount() - last_refresh;
+            if(elapsed < frame_period){
+                vTaskDelay(frame_period - elapsed);
+                uint32_t more_changes = 0;
+                xTaskNotifyWait(0, UINT32_MAX, &more_changes, 0);
+                changes |= more_changes;
+            }
+            update_widgets(changes);
+            lv_refr_now(display);
+            last_refresh = xTaskGetTickCount();
+            changes = 0;
+        }
+
+        // other LVGL timers (e.g. animations) still run, task sleeps until the nearest one
+        uint32_t next_timer_ms = lv_timer_handler();
+        TickType_t wait = (next_timer_ms == LV_NO_TIMER_READY) ? portMAX_DELAY : pdMS_TO_TICKS(next_timer_ms) + 1;
+        xTaskNotifyWait(0, UINT32_MAX, &changes, wait);
+    }
+}
+
+void gui_start() {
+    xTaskCreate(gui_task, "gui", GUI_STACK_SIZE, NULL, 3, &gui_task_handle);
+    ESP_ERROR_CHECK(esp_event_handler_register(WSL_BYPASSER_EVENTS, ESP_EVENT_ANY_ID, &wsl_bypasser_event_handler, NULL));
+}
+
+void gui_notify(uint32_t changes) {
+    if(gui_task_handle != NULL){
+        xTaskNotify(gui_task_handle, changes, eSetBits);
+    }
+}
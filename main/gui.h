@@ -0,0 +1,40 @@
+/**
+ * @file gui.h
+ * @date 2026-10-19
+ *
+ * @brief Provides event driven GUI on the display.
+ *
+ * GUI task sleeps until some displayed value changes. Only widgets of changed values are updated,
+ * so LVGL redraws and flushes only their areas, at most CONFIG_GUI_MAX_FPS times per second.
+ */
+#ifndef GUI_H
+#define GUI_H
+
+#include <stdint.h>
+
+/**
+ * @brief Displayed values that can change, used as bits of change notification
+ */
+typedef enum {
+    GUI_CHANGE_TARGETS = 0x01,  ///< list of attacked SSIDs
+    GUI_CHANGE_RATE = 0x02,     ///< frames sent per second
+    GUI_CHANGE_ALL = 0x03
+} gui_change_t;
+
+/**
+ * @brief Initialises LVGL and display and starts GUI task.
+ *
+ * Display has to be initialised by spi_display_init() and st7789_init() before.
+ */
+void gui_start();
+
+/**
+ * @brief Notifies GUI task that displayed values changed. Can be called from any task.
+ *
+ * Notifications that come within one frame period are merged into single redraw.
+ *
+ * @param changes bitwise OR of gui_change_t
+ */
+void gui_notify(uint32_t changes);
+
+#endif
@@ -12,6 +12,7 @@
 #include "esp_psram.h"
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 
@@ -26,11 +27,12 @@
 
 #include "attack.h"
 #include "attack_dos.h"
-#include "attack_handshake.h"
-#include "attack_pmkid.h"
+#include "attack_queue.h"
 #include "wifi_controller.h"
 #include "webserver.h"
 #include "led_status.h"
+#include "capture_store.h"
+#include "mem_alloc.h"
 
 #include <stdbool.h>
 #include <unistd.h>
@@ -42,7 +44,7 @@
 #include "utime.h"
 #include "esp_timer.h"
 
-#include "global.h"
+#include "gui.h"
 
 
 static const char* TAG = "main";
@@ -50,6 +52,9 @@ static const char* TAG = "main";
 
 #define CLI_UART_BUF_SIZE 128
 #define CLI_UART_PORT UART_NUM_0
+#define CLI_MAX_SESSIONS 32
+#define CLI_DUMP_LINE_SIZE 32
+#define CLI_MAX_JOBS CONFIG_ATTACK_QUEUE_MAX_JOBS
 
 static volatile bool scan_running = false;
 static TaskHandle_t scan_task_handle = NULL;
@@ -65,8 +70,7 @@ static const char *get_band_from_channel(uint8_t ch){
     return "?";
 }
 
-static void print_ap_list_flipper_band(void){
-    const wifictl_ap_records_t *records = wifictl_get_ap_records();
+static void print_ap_list_flipper_band(const wifictl_ap_records_t *records){
     for(int i = 0; i < records->count; i++){
         const wifi_ap_record_t *rec = &records->records[i];
         const char* enc = "OPEN";
@@ -110,7 +114,7 @@ static void scan_loop_task(void *pv){
         if(!scan_running){
             break;
         }
-        print_ap_list_flipper_band();
+        print_ap_list_flipper_band(wifictl_get_ap_records());
         vTaskDelay(pdMS_TO_TICKS(1700));
     }
     led_status_set_state(LED_STATE_IDLE);
@@ -134,10 +138,10 @@ static void cli_start_attack(int *ids, int count){
         .type = ATTACK_TYPE_DOS,
         .method = ATTACK_DOS_METHOD_BROADCAST,
         .timeout = 0,
-        .num_aps = count
+        .num_aps = (count < ATTACK_REQUEST_AP_MAX) ? count : ATTACK_REQUEST_AP_MAX
     };
 
-    for(int i=0;i<count && i<10;i++){
+    for(int i=0;i<req->num_aps;i++){
         req->ap_ids[i] = ids[i];
     }
 
@@ -153,32 +157,153 @@ static void cli_start_attack(int *ids, int count){
 }
 
 static void cli_stop_attack(void){
-    const attack_status_t *status = attack_get_status();
-    if(status->state != RUNNING){
+    if(!attack_is_running()){
         printf("No attack running.\n");
         return;
     }
-
-    switch(status->type){
-        case ATTACK_TYPE_DOS:
-            attack_dos_stop();
-            break;
-        case ATTACK_TYPE_HANDSHAKE:
-            attack_handshake_stop();
-            break;
-        case ATTACK_TYPE_PMKID:
-            attack_pmkid_stop();
-            break;
-        default:
-            break;
-    }
-    attack_update_status(FINISHED);
+    attack_stop(FINISHED);
     esp_event_post(WEBSERVER_EVENTS, WEBSERVER_EVENT_ATTACK_RESET, NULL, 0, portMAX_DELAY);
-    wifictl_mgmt_ap_start();
     led_status_set_state(LED_STATE_IDLE);
     printf("Attack stopped.\n");
 }
 
+static void cli_list_sessions(void){
+    static capture_store_session_t sessions[CLI_MAX_SESSIONS];
+    if(!capture_store_is_available()){
+        printf("Capture store not available.\n");
+        return;
+    }
+    unsigned count = capture_store_list(sessions, CLI_MAX_SESSIONS);
+    if(count == 0){
+        printf("No stored sessions.\n");
+        return;
+    }
+    for(unsigned i = 0; i < count; i++){
+        const capture_store_session_t *session = &sessions[i];
+        printf("[%04x] type:%u BSSID:%02x:%02x:%02x:%02x:%02x:%02x size:%lu frames:%lu duration:%lus boot:%u%s%s%s\n",
+               session->id, session->type,
+               session->bssid[0], session->bssid[1], session->bssid[2],
+               session->bssid[3], session->bssid[4], session->bssid[5],
+               (unsigned long) session->size, (unsigned long) session->frames,
+               (unsigned long) (session->duration_ms / 1000), session->boot,
+               (session->flags & CAPTURE_STORE_SESSION_CLOSED) ? "" : " OPEN",
+               (session->flags & CAPTURE_STORE_SESSION_TRUNCATED) ? " TRUNCATED" : "",
+               (session->flags & CAPTURE_STORE_SESSION_HAS_HCCAPX) ? " HCCAPX" : "");
+    }
+}
+
+/**
+ * @brief Dumps stored PCAP of given session as hex lines enclosed by BEGIN/END markers.
+ */
+static void cli_dump_session(uint16_t id){
+    size_t size = 0;
+    int fd = capture_store_open(id, CAPTURE_STORE_ARTIFACT_PCAP, &size);
+    if(fd < 0){
+        printf("Session %04x not available.\n", id);
+        return;
+    }
+    uint8_t line[CLI_DUMP_LINE_SIZE];
+    int len;
+    printf("BEGIN %04x %u\n", id, (unsigned) size);
+    while((len = read(fd, line, sizeof(line))) > 0){
+        for(int i = 0; i < len; i++){
+            printf("%02x", line[i]);
+        }
+        printf("\n");
+    }
+    printf("END\n");
+    close(fd);
+}
+
+static void cli_delete_session(uint16_t id){
+    esp_err_t err = capture_store_delete(id);
+    if(err == ESP_OK){
+        printf("Session %04x deleted.\n", id);
+    }else{
+        printf("Failed to delete session %04x: %s\n", id, esp_err_to_name(err));
+    }
+}
+
+static void cli_add_capture_job(const char *args){
+    attack_queue_job_t job = { .type = ATTACK_QUEUE_JOB_CAPTURE };
+    // separators in BSSID are already turned into spaces
+    if(sscanf(args, "%hhx %hhx %hhx %hhx %hhx %hhx %hu", &job.bssid[0], &job.bssid[1], &job.bssid[2],
+              &job.bssid[3], &job.bssid[4], &job.bssid[5], &job.duration) != 7 || job.duration == 0){
+        printf("Usage: jobcapture BSSID SECONDS\n");
+        return;
+    }
+    esp_err_t err = attack_queue_add(&job);
+    if(err == ESP_OK){
+        printf("Capture job queued.\n");
+    }else{
+        printf("Failed to queue job: %s\n", esp_err_to_name(err));
+    }
+}
+
+static void cli_add_survey_job(const char *args){
+    attack_queue_job_t job = { .type = ATTACK_QUEUE_JOB_SURVEY };
+    if(sscanf(args, "%hu", &job.dwell_ms) != 1 || job.dwell_ms == 0){
+        printf("Usage: jobsurvey DWELL_MS\n");
+        return;
+    }
+    esp_err_t err = attack_queue_add(&job);
+    if(err == ESP_OK){
+        printf("Survey job queued.\n");
+    }else{
+        printf("Failed to queue job: %s\n", esp_err_to_name(err));
+    }
+}
+
+static void cli_list_jobs(void){
+    static const char *states[] = { "PENDING", "RUNNING", "DONE", "FAILED", "CANCELLED" };
+    static attack_queue_entry_t entries[CLI_MAX_JOBS];
+    unsigned count = attack_queue_get_entries(entries, CLI_MAX_JOBS);
+    if(count == 0){
+        printf("No jobs queued.\n");
+        return;
+    }
+    for(unsigned i = 0; i < count; i++){
+        const attack_queue_entry_t *entry = &entries[i];
+        if(entry->job.type == ATTACK_QUEUE_JOB_CAPTURE){
+            printf("[%u] %-9s capture %02x:%02x:%02x:%02x:%02x:%02x %us",
+                   i, states[entry->state],
+                   entry->job.bssid[0], entry->job.bssid[1], entry->job.bssid[2],
+                   entry->job.bssid[3], entry->job.bssid[4], entry->job.bssid[5], entry->job.duration);
+            if(entry->session >= 0){
+                printf(" session %04x", entry->session);
+            }
+            printf("\n");
+        }else{
+            printf("[%u] %-9s survey %ums/channel %u APs\n", i, states[entry->state], entry->job.dwell_ms, entry->aps);
+        }
+    }
+    printf("Queue %s.\n", attack_queue_is_running() ? "running" : "stopped");
+}
+
+static void cli_print_survey(unsigned index){
+    const wifictl_ap_records_t *records = attack_queue_survey_acquire(index);
+    if(records == NULL){
+        printf("Job %u is not a finished survey.\n", index);
+        return;
+    }
+    print_ap_list_flipper_band(records);
+    wifictl_ap_records_release(records);
+}
+
+static void cli_print_memory(void){
+    printf("%-9s %9s %9s %8s %7s %9s\n", "CATEGORY", "IN_USE", "PEAK", "ALLOCS", "FAILED", "FALLBACK");
+    for(mem_category_t category = 0; category < MEM_CATEGORY_MAX; category++){
+        mem_alloc_stats_t stats;
+        mem_alloc_get_stats(category, &stats);
+        printf("%-9s %9u %9u %8u %7u %9u\n", mem_alloc_category_name(category),
+               (unsigned)stats.in_use, (unsigned)stats.peak, (unsigned)stats.allocations,
+               (unsigned)stats.failures, (unsigned)stats.fallbacks);
+    }
+    printf("Free internal: %u B, free PSRAM: %u B\n",
+           (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+           (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+}
+
 static void sanitize_command(char *dst, const uint8_t *src, size_t maxlen){
     size_t pos = 0;
     for(size_t i = 0; src[i] && pos < maxlen - 1; ++i){
@@ -224,8 +349,6 @@ static void cli_task(void *pv){
                         printf("Scan stopped.\n");
                     } else if(strcmp(command, "attackstop") == 0){
                         cli_stop_attack();
-                        attack_dos_stop();
-                        printf("Attack stopped.\n");
                     } else if(strncmp(command, "attack", 6) == 0){
                         int ids[10];
                         int count = 0;
@@ -237,6 +360,29 @@ static void cli_task(void *pv){
                             while(*ptr && !isspace((unsigned char)*ptr)) ptr++;
                         }
                         cli_start_attack(ids, count);
+                    } else if(strcmp(command, "sessions") == 0){
+                        cli_list_sessions();
+                    } else if(strncmp(command, "sessiondump", 11) == 0){
+                        cli_dump_session((uint16_t) strtoul(command + 11, NULL, 16));
+                    } else if(strncmp(command, "sessiondel", 10) == 0){
+                        cli_delete_session((uint16_t) strtoul(command + 10, NULL, 16));
+                    } else if(strncmp(command, "jobcapture", 10) == 0){
+                        cli_add_capture_job(command + 10);
+                    } else if(strncmp(command, "jobsurvey", 9) == 0){
+                        cli_add_survey_job(command + 9);
+                    } else if(strcmp(command, "jobs") == 0){
+                        cli_list_jobs();
+                    } else if(strncmp(command, "jobaps", 6) == 0){
+                        cli_print_survey((unsigned) strtoul(command + 6, NULL, 10));
+                    } else if(strcmp(command, "jobrun") == 0){
+                        printf(attack_queue_run() == ESP_OK ? "Queue started.\n" : "Queue already running.\n");
+                    } else if(strcmp(command, "jobcancel") == 0){
+                        attack_queue_cancel();
+                        printf("Queue cancelled.\n");
+                    } else if(strcmp(command, "jobclear") == 0){
+                        printf(attack_queue_clear() == ESP_OK ? "Queue cleared.\n" : "Queue is running, cancel it first.\n");
+                    } else if(strcmp(command, "mem") == 0){
+                        cli_print_memory();
                     } else if(strcmp(command, "reboot") == 0){
                         printf("Rebooting...\n");
                         fflush(stdout);
@@ -247,6 +393,17 @@ static void cli_task(void *pv){
                         printf("  scanstop - Stop AP scan\n");
                         printf("  attack N [M ...] - Attack AP indexes\n");
                         printf("  attackstop - Stop running attack\n");
+                        printf("  sessions - List stored captures\n");
+                        printf("  sessiondump ID - Dump stored capture as hex\n");
+                        printf("  sessiondel ID - Delete stored capture\n");
+                        printf("  jobcapture BSSID SEC - Queue passive handshake capture\n");
+                        printf("  jobsurvey MS - Queue passive survey, MS per channel\n");
+                        printf("  jobs     - List queued jobs and results\n");
+                        printf("  jobaps N - Show APs found by survey job N\n");
+                        printf("  jobrun   - Run queued jobs\n");
+                        printf("  jobcancel - Cancel running queue\n");
+                        printf("  jobclear - Remove all jobs\n");
+                        printf("  mem      - Show memory usage per category\n");
                         printf("  reboot   - Restart ESP32\n");
                         printf("  help     - Show this help\n");
                     } else {
@@ -267,77 +424,10 @@ static void cli_task(void *pv){
     }
 }
 
-#define LV_TICK_PERIOD_MS 1
-
-SemaphoreHandle_t xGuiSemaphore;
-
-TaskHandle_t gui_task_Handle;
 TaskHandle_t server_task_Handle;
 
 #define STACK_SIZE 4000
 
-char * globalData[MAX_STRINGS] = {0};  
-int globalDataCount = 0;
-int framesPerSecond = 0;
-//portMUX_TYPE dataMutex = portMUX_INITIALIZER_UNLOCKED;
-
-#define SSID_MAX_LENGTH 36
-
-void gui_task(void *arg) {
-    lv_init();
-
-    lv_display_t *display = lv_display_create(MY_DISP_HOR_RES, MY_DISP_VER_RES);
-    lv_display_set_resolution(display, MY_DISP_HOR_RES, MY_DISP_VER_RES);
-
-    static lv_color_t buf1[DISP_BUF_SIZE / 10];
-    static lv_color_t buf2[DISP_BUF_SIZE / 10];
-    lv_display_set_buffers(display, buf1, buf2, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
-    lv_display_set_flush_cb(display, st7789_flush);
-    
-    static lv_style_t st;
-    lv_style_init(&st);
-    lv_style_set_text_font(&st, &lv_font_montserrat_14);
-
-    lv_obj_t * screen = lv_scr_act();
-    lv_obj_set_style_bg_color(screen, lv_color_black(), 0);
-    lv_style_set_bg_color(&st, lv_color_black());
-    lv_style_set_text_color(&st, lv_color_white()); 
-
-
-    lv_obj_t *labels[15];
-
-    for (size_t i = 0; i < 15; i++) {
-        labels[i] = lv_label_create(lv_scr_act()); 
-        lv_label_set_text(labels[i], ""); 
-        lv_obj_set_pos(labels[i],0, 15 * i);
-        lv_obj_add_style(labels[i], &st, 0);
-    }
-
-    while (1) {
-        vTaskDelay(10 / portTICK_PERIOD_MS);
-
-        if (pdTRUE == xSemaphoreTake(xGuiSemaphore, 50 / portTICK_PERIOD_MS)) {
-            if (globalDataCount == 0) {
-                lv_label_set_text(labels[0], "AP: Livebox");
-                lv_label_set_text(labels[1], "Pass: mgmtadmin");
-                lv_label_set_text(labels[2], "IP: 192.168.4.1");
-            } else {
-                char buffer[32];
-                sprintf(buffer, "Frames per second: %d", framesPerSecond);
-                lv_label_set_text(labels[0], buffer);
-                lv_label_set_text(labels[1], "SSIDs attacked:");
-                for (int j=0; j<globalDataCount; j++) {
-                    lv_label_set_text(labels[j+2], globalData[j]);
-                }
-            }
-
-            lv_task_handler();  
-            lv_refr_now(NULL);
-            xSemaphoreGive(xGuiSemaphore);
-        }
-    }
-}
-
 
 void webserver_task(void *arg) {
     webserver_run();
@@ -356,13 +446,7 @@ void app_main(void) {
         ESP_LOGW(TAG, "PSRAM not detected\n");
     }
 
-    void* ptr = heap_caps_malloc(1024, MALLOC_CAP_SPIRAM);
-    if (ptr != NULL) {
-        ESP_LOGW(TAG, "Malloc from PSRAM succeeded\n");
-        heap_caps_free(ptr);
-    } else {
-        ESP_LOGW(TAG, "Malloc from PSRAM failed\n");
-    }
+    mem_alloc_init();
 
     ESP_ERROR_CHECK(esp_event_loop_create_default());
 
@@ -378,13 +462,13 @@ void app_main(void) {
     uart_set_pin(CLI_UART_PORT, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
 
     wifictl_mgmt_ap_start();
+    capture_store_init();
     attack_init();
 
-    xGuiSemaphore = xSemaphoreCreateMutex();
     spi_display_init();
     st7789_init();
 
-    xTaskCreate(gui_task,       "gui",       STACK_SIZE, NULL, 3, &gui_task_Handle);
+    gui_start();
     xTaskCreate(webserver_task, "webserver", STACK_SIZE, NULL, 5, &server_task_Handle);
     xTaskCreate(cli_task, "cli_task", 4096, NULL, 5, NULL);
 
@@ -398,4 +482,5 @@ void app_main(void) {
     ESP_LOGW(TAG, "heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT): %d bytes\n", largest_block);
     ESP_LOGW(TAG, "heap_caps_get_free_size(MALLOC_CAP_DEFAULT): %d bytes\n", free_size);
     ESP_LOGW(TAG, "heap_caps_get_free_size(MALLOC_CAP_8BIT): %u bytes", heap_caps_get_free_size(MALLOC_CAP_8BIT));
+    mem_alloc_log_stats();
 }
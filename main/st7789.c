@@ -17,6 +17,7 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "rom/gpio.h"
+#include "mem_alloc.h"
 
 /*********************
  *      DEFINES
@@ -39,13 +40,18 @@ typedef struct {
 static void st7789_set_orientation(uint8_t orientation);
 
 static void st7789_send_color(void *data, size_t length);
+static void st7789_queue_cmd(uint8_t cmd);
+static void st7789_queue_data(uint8_t *data, size_t length);
 
 static void disp_wait_for_pending_transactions();
 void disp_spi_transaction(const uint8_t *data, size_t length,
     disp_spi_send_flag_t flags, uint8_t *out,
     uint64_t addr, uint8_t dummy_bits);
-static void disp_spi_send_colors(uint8_t *data, size_t length);
-static void disp_spi_send_data(uint8_t *data, size_t length);
+static void disp_spi_send_colors(uint8_t *data, size_t length, disp_spi_send_flag_t flags);
+static void disp_spi_send_data(uint8_t *data, size_t length, disp_spi_send_flag_t flags);
+static void disp_spi_pre_transfer_cb(spi_transaction_t *t);
+static void disp_spi_post_transfer_cb(spi_transaction_t *t);
+static void disp_wait_for_color_buffer(unsigned index);
 
 /**********************
  *  STATIC VARIABLES
@@ -53,6 +59,13 @@ static void disp_spi_send_data(uint8_t *data, size_t length);
 static QueueHandle_t TransactionPool = NULL;
 static spi_device_handle_t spi;
 static spi_host_device_t spi_host;
+/* Byte swapped chunks of LVGL draw buffer sent by DMA. LVGL buffers may be in PSRAM, these stay internal. */
+static uint8_t *color_buffers[2] = {NULL, NULL};
+/* Set when chunk is queued, cleared by post-transaction callback when it was sent */
+static volatile bool color_buffer_busy[2] = {false, false};
+/* Display whose flush is in progress, signalled from post-transaction callback */
+static lv_display_t *flush_display = NULL;
+static SemaphoreHandle_t flush_done = NULL;
 
 /**********************
  *      MACROS
@@ -190,10 +203,12 @@ void spi_display_init(void){
 	assert(ret==ESP_OK);
 
 	spi_device_interface_config_t devcfg={
-		.clock_speed_hz = SPI_MASTER_FREQ_20M,
+		.clock_speed_hz = CONFIG_DISPLAY_SPI_CLOCK_MHZ * 1000 * 1000,
 		.queue_size = SPI_TRANSACTION_POOL_SIZE,
 		.mode = 2,
 		.flags = SPI_DEVICE_NO_DUMMY,
+		.pre_cb = disp_spi_pre_transfer_cb,
+		.post_cb = disp_spi_post_transfer_cb,
 	};
 
 	if ( CONFIG_CS_GPIO >= 0 ) {
@@ -213,12 +228,24 @@ void spi_display_init(void){
 		assert(TransactionPool != NULL);
 		for (size_t i = 0; i < SPI_TRANSACTION_POOL_SIZE; i++)
 		{
-			spi_transaction_ext_t* pTransaction = (spi_transaction_ext_t*)heap_caps_malloc(sizeof(spi_transaction_ext_t), MALLOC_CAP_DMA);
+			spi_transaction_ext_t* pTransaction = (spi_transaction_ext_t*)mem_alloc(MEM_CATEGORY_DMA, sizeof(spi_transaction_ext_t));
 			assert(pTransaction != NULL);
 			memset(pTransaction, 0, sizeof(spi_transaction_ext_t));
 			xQueueSend(TransactionPool, &pTransaction, portMAX_DELAY);
 		}
 	}
+
+	for (size_t i = 0; i < 2; i++) {
+		if(color_buffers[i] == NULL) {
+			color_buffers[i] = (uint8_t *)mem_alloc(MEM_CATEGORY_DMA, DISP_DMA_CHUNK_SIZE);
+			assert(color_buffers[i] != NULL);
+		}
+	}
+
+	if(flush_done == NULL) {
+		flush_done = xSemaphoreCreateBinary();
+		assert(flush_done != NULL);
+	}
 }
 
 /* The ST7789 display controller can drive up to 320*240 displays, when using a 240*240 or 240*135
@@ -268,30 +295,39 @@ void st7789_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * pixmap)
     #endif
 #endif
 
+    /* LVGL calls flush only after previous one is ready, so any pending signal is stale */
+    xSemaphoreTake(flush_done, 0);
+    flush_display = disp;
+
     /*Column addresses*/
-    st7789_send_cmd(ST7789_CASET);
+    st7789_queue_cmd(ST7789_CASET);
     data[0] = (offsetx1 >> 8) & 0xFF;
     data[1] = offsetx1 & 0xFF;
     data[2] = (offsetx2 >> 8) & 0xFF;
     data[3] = offsetx2 & 0xFF;
-    st7789_send_data(data, 4);
+    st7789_queue_data(data, 4);
 
     /*Page addresses*/
-    st7789_send_cmd(ST7789_RASET);
+    st7789_queue_cmd(ST7789_RASET);
     data[0] = (offsety1 >> 8) & 0xFF;
     data[1] = offsety1 & 0xFF;
     data[2] = (offsety2 >> 8) & 0xFF;
     data[3] = offsety2 & 0xFF;
-    st7789_send_data(data, 4);
+    st7789_queue_data(data, 4);
 
     /*Memory write*/
-    st7789_send_cmd(ST7789_RAMWR);
+    st7789_queue_cmd(ST7789_RAMWR);
 
     size_t size = (size_t)lv_area_get_width(area) * (size_t)lv_area_get_height(area);
 
+    /* lv_display_flush_ready() is called by post-transaction callback of the last color chunk,
+     * LVGL renders next area into the other draw buffer meanwhile */
     st7789_send_color((void*)pixmap, size * 2);
+}
 
-    lv_display_flush_ready(disp);         /* Indicate you are ready with the flushing*/
+void st7789_flush_wait(lv_display_t * disp)
+{
+    xSemaphoreTake(flush_done, portMAX_DELAY);
 }
 
 /**********************
@@ -391,14 +427,47 @@ void disp_spi_transaction(const uint8_t *data, size_t length,
     }
 }
 
-static inline void disp_spi_send_data(uint8_t *data, size_t length) {
-    disp_spi_transaction(data, length, DISP_SPI_SEND_POLLING, NULL, 0, 0);
+static inline void disp_spi_send_data(uint8_t *data, size_t length, disp_spi_send_flag_t flags) {
+    disp_spi_transaction(data, length, flags, NULL, 0, 0);
+}
+
+static inline void disp_spi_send_colors(uint8_t *data, size_t length, disp_spi_send_flag_t flags) {
+    disp_spi_transaction(data, length, DISP_SPI_SEND_QUEUED | DISP_SPI_DATA | flags, NULL, 0, 0);
 }
 
-static inline void disp_spi_send_colors(uint8_t *data, size_t length) {
-    disp_spi_transaction(data, length,
-        DISP_SPI_SEND_QUEUED | DISP_SPI_SIGNAL_FLUSH,
-        NULL, 0, 0);
+/* DC line is switched per transaction, so commands and data can be queued back to back */
+static void disp_spi_pre_transfer_cb(spi_transaction_t *t)
+{
+    disp_spi_send_flag_t flags = (disp_spi_send_flag_t) t->user;
+    gpio_set_level(ST7789_DC, (flags & DISP_SPI_DATA) ? 1 : 0);
+}
+
+static void disp_spi_post_transfer_cb(spi_transaction_t *t)
+{
+    disp_spi_send_flag_t flags = (disp_spi_send_flag_t) t->user;
+    for (size_t i = 0; i < 2; i++) {
+        if (t->tx_buffer == color_buffers[i]) {
+            color_buffer_busy[i] = false;
+        }
+    }
+    if (flags & DISP_SPI_SIGNAL_FLUSH) {
+        lv_display_flush_ready(flush_display);
+        BaseType_t task_woken = pdFALSE;
+        xSemaphoreGiveFromISR(flush_done, &task_woken);
+        portYIELD_FROM_ISR(task_woken);
+    }
+}
+
+/* Services finished transactions until chunk was sent and can be filled again */
+static void disp_wait_for_color_buffer(unsigned index)
+{
+    spi_transaction_t *presult;
+
+    while(color_buffer_busy[index]) {
+        if (spi_device_get_trans_result(spi, &presult, 1) == ESP_OK) {
+            xQueueSend(TransactionPool, &presult, portMAX_DELAY);
+        }
+    }
 }
 
 
@@ -417,31 +486,47 @@ void disp_wait_for_pending_transactions(void)
 
 void st7789_send_cmd(uint8_t cmd)
 {
-    disp_wait_for_pending_transactions();
-    gpio_set_level(ST7789_DC, 0);
-    disp_spi_send_data(&cmd, 1);
+    disp_spi_send_data(&cmd, 1, DISP_SPI_SEND_POLLING);
 }
 
 void st7789_send_data(void * data, uint16_t length)
 {
-    disp_wait_for_pending_transactions();
-    gpio_set_level(ST7789_DC, 1);
-    disp_spi_send_data(data, length);
+    disp_spi_send_data(data, length, DISP_SPI_SEND_POLLING | DISP_SPI_DATA);
+}
+
+static void st7789_queue_cmd(uint8_t cmd)
+{
+    disp_spi_send_data(&cmd, 1, DISP_SPI_SEND_QUEUED);
+}
+
+/* data up to 4 bytes is copied into the transaction, so it does not have to outlive the call */
+static void st7789_queue_data(uint8_t *data, size_t length)
+{
+    assert(length <= 4);
+    disp_spi_send_data(data, length, DISP_SPI_SEND_QUEUED | DISP_SPI_DATA);
 }
 
-#define SIZE_B 23040	//2*DISP_BUF_SIZE / 10;
 static void st7789_send_color(void * data, size_t length)
 {
-	static uint8_t buf_c[SIZE_B];
 	uint8_t *data_i = data;
-	int asd = (uint8_t)data_i[0];
-    disp_wait_for_pending_transactions();
-    gpio_set_level(ST7789_DC, 1);
-    for(int idx = 0; idx < length ; idx +=2){		//Invert color bytes
-    	buf_c[idx] = data_i[idx +1];
-    	buf_c[idx+1] = data_i[idx];
-    }
-    disp_spi_send_colors(buf_c, length);
+	unsigned chunk = 0;
+	for(size_t offset = 0; offset < length; offset += DISP_DMA_CHUNK_SIZE, chunk ^= 1){
+		size_t chunk_length = length - offset;
+		if(chunk_length > DISP_DMA_CHUNK_SIZE){
+			chunk_length = DISP_DMA_CHUNK_SIZE;
+		}
+		bool last = (offset + chunk_length) == length;
+
+		/* chunk sent two steps before is the only one that can still be in flight */
+		disp_wait_for_color_buffer(chunk);
+		uint8_t *buf_c = color_buffers[chunk];
+		for(size_t idx = 0; idx < chunk_length; idx += 2){		//Invert color bytes
+			buf_c[idx] = data_i[offset + idx + 1];
+			buf_c[idx + 1] = data_i[offset + idx];
+		}
+		color_buffer_busy[chunk] = true;
+		disp_spi_send_colors(buf_c, chunk_length, last ? DISP_SPI_SIGNAL_FLUSH : 0);
+	}
 }
 
 static void st7789_set_orientation(uint8_t orientation)
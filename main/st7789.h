@@ -40,6 +40,7 @@ typedef enum _disp_spi_send_flag_t {
     DISP_SPI_MODE_QIO           = 0x00000800,
     DISP_SPI_MODE_DIOQIO_ADDR   = 0x00001000,
 	DISP_SPI_VARIABLE_DUMMY		= 0x00002000,
+    DISP_SPI_DATA               = 0x00004000, /* DC line high (data), low (command) otherwise; set by pre-transaction callback */
 } disp_spi_send_flag_t;
 
 
@@ -70,7 +71,10 @@ typedef enum _disp_spi_send_flag_t {
 #define MY_DISP_HOR_RES	240
 #define MY_DISP_VER_RES 320
 #define DISP_BUF_SIZE MY_DISP_HOR_RES * MY_DISP_VER_RES
-#define SPI_BUS_MAX_TRANSFER_SZ (DISP_BUF_SIZE * 2)
+/* Colors are byte swapped from LVGL draw buffer (may be in PSRAM) into two internal DMA chunks of this size.
+ * While one chunk is being sent, the next one is filled, so draw buffer size does not cost internal RAM. */
+#define DISP_DMA_CHUNK_SIZE (MY_DISP_HOR_RES * 20 * 2)
+#define SPI_BUS_MAX_TRANSFER_SZ DISP_DMA_CHUNK_SIZE
 
 /* ST7789 commands */
 #define ST7789_NOP      0x00
@@ -150,7 +154,10 @@ typedef enum _disp_spi_send_flag_t {
 
 void st7789_init(void);
 void spi_display_init(void);
+/* Queues window commands and colors and returns, lv_display_flush_ready() is called when the last chunk was sent */
 void st7789_flush( lv_display_t * disp, const lv_area_t * area, uint8_t * pixmap);
+/* Blocks until the last flush was sent, to be set by lv_display_set_flush_wait_cb() instead of busy waiting */
+void st7789_flush_wait(lv_display_t * disp);
 
 void st7789_send_cmd(uint8_t cmd);
 void st7789_send_data(void *data, uint16_t length);
@@ -0,0 +1,166 @@
+/**
+ * @file analyzer_check.c
+ * @date 2026-10-19
+ *
+ * @brief Checks that frame analyzer stops receiving frames from sniffer when analysis is stopped.
+ *
+ * Frames of given pcap are posted as sniffer events before analysis starts, while it runs and after it was stopped.
+ * EAPOL-Key frames have to be forwarded only while analysis runs. Sequence numbers of
+ * the second round are changed, so they are not dropped as retransmissions of the first round.
+ */
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_err.h"
+#include "esp_event.h"
+
+#include "frame_analyzer.h"
+#include "frame_analyzer_parser.h"
+#include "mem_alloc.h"
+#include "wifi_controller.h"
+
+#define FRAME_MAX_SIZE 2500
+
+ESP_EVENT_DEFINE_BASE(ANALYZER_CHECK_EVENTS);
+enum {
+    ANALYZER_CHECK_EVENT_FLUSH,
+    ANALYZER_CHECK_EVENT_FLUSHED
+};
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t flushed_cond = PTHREAD_COND_INITIALIZER;
+static bool flushed = false;
+static unsigned eapolkey_events = 0;
+
+typedef struct {
+    uint32_t magic_number;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t network;
+} pcap_global_header_t;
+
+typedef struct {
+    uint32_t ts_sec;
+    uint32_t ts_usec;
+    uint32_t incl_len;
+    uint32_t orig_len;
+} pcap_record_header_t;
+
+static void eapolkey_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    pthread_mutex_lock(&lock);
+    eapolkey_events++;
+    pthread_mutex_unlock(&lock);
+}
+
+/**
+ * @brief Events posted by handlers of earlier events are queued behind the first flush event,
+ * so the second one is handled only after all of them.
+ */
+static void flush_handler(void *args, esp_event_base_t event_base, int32_t event_id, void *event_data){
+    if(event_id == ANALYZER_CHECK_EVENT_FLUSH){
+        ESP_ERROR_CHECK(esp_event_post(ANALYZER_CHECK_EVENTS, ANALYZER_CHECK_EVENT_FLUSHED, NULL, 0, portMAX_DELAY));
+        return;
+    }
+    pthread_mutex_lock(&lock);
+    flushed = true;
+    pthread_cond_signal(&flushed_cond);
+    pthread_mutex_unlock(&lock);
+}
+
+static unsigned flush_events(){
+    pthread_mutex_lock(&lock);
+    flushed = false;
+    pthread_mutex_unlock(&lock);
+    ESP_ERROR_CHECK(esp_event_post(ANALYZER_CHECK_EVENTS, ANALYZER_CHECK_EVENT_FLUSH, NULL, 0, portMAX_DELAY));
+    pthread_mutex_lock(&lock);
+    while(!flushed){
+        pthread_cond_wait(&flushed_cond, &lock);
+    }
+    unsigned events = eapolkey_events;
+    pthread_mutex_unlock(&lock);
+    return events;
+}
+
+/**
+ * @brief Posts every frame of pcap as captured data frame
+ *
+ * @param bssid output, BSSID of the first parsed data frame, may be NULL
+ * @param sequence_offset added to sequence number of every frame
+ * @return number of posted frames, 0 on error
+ */
+static unsigned post_frames(const char *path, uint8_t *bssid, unsigned sequence_offset){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        perror(path);
+        return 0;
+    }
+    pcap_global_header_t global_header;
+    if((fread(&global_header, sizeof(global_header), 1, file) != 1) || (global_header.network != 105)){
+        fprintf(stderr, "%s: expected little endian pcap with linktype 105\n", path);
+        fclose(file);
+        return 0;
+    }
+    static uint8_t buffer[sizeof(wifi_promiscuous_pkt_t) + FRAME_MAX_SIZE];
+    wifi_promiscuous_pkt_t *packet = (wifi_promiscuous_pkt_t *) buffer;
+    pcap_record_header_t record;
+    unsigned posted = 0;
+    while(fread(&record, sizeof(record), 1, file) == 1){
+        if((record.incl_len > FRAME_MAX_SIZE) || (fread(packet->payload, record.incl_len, 1, file) != 1)){
+            break;
+        }
+        memset(&packet->rx_ctrl, 0, sizeof(packet->rx_ctrl));
+        packet->rx_ctrl.sig_len = record.incl_len;
+        frame_view_t view;
+        if(!parse_frame_view(packet->payload, record.incl_len, false, &view) || (view.type != FRAME_TYPE_DATA)){
+            continue;
+        }
+        if((bssid != NULL) && (posted == 0)){
+            memcpy(bssid, &packet->payload[view.bssid], 6);
+        }
+        data_frame_mac_header_t *mac_header = (data_frame_mac_header_t *) &packet->payload[view.frame_offset];
+        mac_header->sequence_control += sequence_offset << 4;
+        ESP_ERROR_CHECK(esp_event_post(SNIFFER_EVENTS, SNIFFER_EVENT_CAPTURED_DATA, packet,
+                                       sizeof(wifi_promiscuous_pkt_t) + record.incl_len, portMAX_DELAY));
+        posted++;
+    }
+    fclose(file);
+    return posted;
+}
+
+int main(int argc, char *argv[]){
+    if(argc != 2){
+        fprintf(stderr, "Usage: %s FRAMES.pcap\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    mem_alloc_init();
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    ESP_ERROR_CHECK(esp_event_handler_register(FRAME_ANALYZER_EVENTS, DATA_FRAME_EVENT_EAPOLKEY_FRAME, &eapolkey_handler, NULL));
+    ESP_ERROR_CHECK(esp_event_handler_register(ANALYZER_CHECK_EVENTS, ESP_EVENT_ANY_ID, &flush_handler, NULL));
+
+    // BSSID is taken from the frames themselves
+    uint8_t bssid[6];
+    if(post_frames(argv[1], bssid, 0) == 0){
+        return EXIT_FAILURE;
+    }
+    unsigned before = flush_events();
+
+    frame_analyzer_capture_start(SEARCH_HANDSHAKE, bssid);
+    post_frames(argv[1], NULL, 0);
+    unsigned running = flush_events() - before;
+    frame_analyzer_capture_stop();
+    post_frames(argv[1], NULL, 1);
+    unsigned stopped = flush_events() - before - running;
+
+    if((before != 0) || (running == 0) || (stopped != 0)){
+        printf("FAIL: %u EAPOL-Key frames forwarded before analysis, %u while it ran, %u after it was stopped\n",
+               before, running, stopped);
+        return EXIT_FAILURE;
+    }
+    printf("ok: analyzer stop (%u EAPOL-Key frames forwarded, none after stop)\n", running);
+    return EXIT_SUCCESS;
+}
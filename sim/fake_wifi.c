@@ -0,0 +1,453 @@
+/**
+ * @file fake_wifi.c
+ * @date 2026-10-19
+ *
+ * @brief Implements fake Wi-Fi backend of simulator.
+ *
+ * Replay runs on a detached thread. Disabling promiscuous mode only bumps replay generation, the thread
+ * notices it before delivering the next frame and exits. It is never joined, because its frame callback
+ * can block on full event queue whose handler may be the one disabling promiscuous mode.
+ */
+#include "fake_wifi.h"
+
+#include <ctype.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+
+#define PCAP_MAGIC 0xa1b2c3d4
+#define PCAP_MAGIC_NSEC 0xa1b23c4d
+#define PCAP_LINKTYPE_IEEE802_11 105
+#define PCAP_LINKTYPE_IEEE802_11_RADIOTAP 127
+#define FRAME_MAX_SIZE 4095
+/**
+ * @brief Longest gap between replayed frames, long pauses of recordings are shortened to it
+ */
+#define REPLAY_GAP_MAX_US 1000000
+#define REPLAY_RSSI -50
+#define SCAN_LINE_MAX 128
+
+typedef struct __attribute__((packed)) {
+    uint32_t magic;
+    uint16_t version_major;
+    uint16_t version_minor;
+    int32_t thiszone;
+    uint32_t sigfigs;
+    uint32_t snaplen;
+    uint32_t linktype;
+} pcap_global_header_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t ts_sec;
+    uint32_t ts_frac;
+    uint32_t incl_len;
+    uint32_t orig_len;
+} pcap_record_header_t;
+
+static const char *TAG = "sim:wifi";
+static const char *scan_file = NULL;
+static const char *frames_file = NULL;
+static bool replay_loop = false;
+
+static pthread_mutex_t wifi_lock = PTHREAD_MUTEX_INITIALIZER;
+static bool wifi_initialised = false;
+static bool wifi_started = false;
+static bool promiscuous = false;
+static unsigned replay_generation = 0;
+static wifi_promiscuous_cb_t promiscuous_cb = NULL;
+static uint32_t filter_mask = WIFI_PROMIS_FILTER_MASK_ALL;
+static uint8_t channel = 1;
+static uint8_t mac_ap[6] = { 0x02, 0x5e, 0x00, 0x00, 0x00, 0x01 };
+static uint8_t mac_sta[6] = { 0x02, 0x5e, 0x00, 0x00, 0x00, 0x02 };
+static wifi_ap_record_t scan_records[CONFIG_SCAN_MAX_AP];
+static uint16_t scan_record_count = 0;
+static uint32_t tx_count = 0;
+static uint32_t rx_count = 0;
+
+void fake_wifi_configure(const char *scan_path, const char *frames_path, bool loop){
+    scan_file = scan_path;
+    frames_file = frames_path;
+    replay_loop = loop;
+}
+
+uint32_t fake_wifi_tx_count(void){
+    return __atomic_load_n(&tx_count, __ATOMIC_RELAXED);
+}
+
+uint32_t fake_wifi_rx_count(void){
+    return __atomic_load_n(&rx_count, __ATOMIC_RELAXED);
+}
+
+esp_err_t esp_wifi_init(const wifi_init_config_t *config){
+    pthread_mutex_lock(&wifi_lock);
+    wifi_initialised = true;
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_storage(wifi_storage_t storage){
+    return wifi_initialised ? ESP_OK : ESP_ERR_WIFI_NOT_INIT;
+}
+
+esp_err_t esp_wifi_set_mode(wifi_mode_t mode){
+    return wifi_initialised ? ESP_OK : ESP_ERR_WIFI_NOT_INIT;
+}
+
+esp_err_t esp_wifi_start(void){
+    if(!wifi_initialised){
+        return ESP_ERR_WIFI_NOT_INIT;
+    }
+    pthread_mutex_lock(&wifi_lock);
+    wifi_started = true;
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_config(wifi_interface_t interface, wifi_config_t *conf){
+    if(!wifi_initialised){
+        return ESP_ERR_WIFI_NOT_INIT;
+    }
+    if(interface == WIFI_IF_AP){
+        ESP_LOGD(TAG, "AP config: SSID=%.32s channel=%u max_connection=%u", (const char *) conf->ap.ssid,
+                 conf->ap.channel, conf->ap.max_connection);
+    }
+    else {
+        ESP_LOGD(TAG, "STA config: SSID=%.32s channel=%u", (const char *) conf->sta.ssid, conf->sta.channel);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_connect(void){
+    ESP_LOGD(TAG, "STA connecting");
+    return wifi_started ? ESP_OK : ESP_ERR_WIFI_NOT_STARTED;
+}
+
+esp_err_t esp_wifi_disconnect(void){
+    ESP_LOGD(TAG, "STA disconnecting");
+    return wifi_started ? ESP_OK : ESP_ERR_WIFI_NOT_STARTED;
+}
+
+esp_err_t esp_wifi_deauth_sta(uint16_t aid){
+    return wifi_started ? ESP_OK : ESP_ERR_WIFI_NOT_STARTED;
+}
+
+esp_err_t esp_wifi_get_mac(wifi_interface_t ifx, uint8_t mac[6]){
+    pthread_mutex_lock(&wifi_lock);
+    memcpy(mac, (ifx == WIFI_IF_AP) ? mac_ap : mac_sta, 6);
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_mac(wifi_interface_t ifx, const uint8_t mac[6]){
+    if(mac[0] & 0x01){
+        return ESP_ERR_INVALID_MAC;
+    }
+    pthread_mutex_lock(&wifi_lock);
+    memcpy((ifx == WIFI_IF_AP) ? mac_ap : mac_sta, mac, 6);
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_channel(uint8_t primary, wifi_second_chan_t second){
+    if(!wifi_started){
+        return ESP_ERR_WIFI_NOT_STARTED;
+    }
+    pthread_mutex_lock(&wifi_lock);
+    channel = primary;
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+static bool parse_authmode(const char *name, wifi_auth_mode_t *authmode){
+    static const char *names[WIFI_AUTH_MAX] = {
+        [WIFI_AUTH_OPEN] = "open",
+        [WIFI_AUTH_WEP] = "wep",
+        [WIFI_AUTH_WPA_PSK] = "wpa",
+        [WIFI_AUTH_WPA2_PSK] = "wpa2",
+        [WIFI_AUTH_WPA_WPA2_PSK] = "wpa_wpa2",
+        [WIFI_AUTH_ENTERPRISE] = "enterprise",
+        [WIFI_AUTH_WPA3_PSK] = "wpa3",
+        [WIFI_AUTH_WPA2_WPA3_PSK] = "wpa2_wpa3"
+    };
+    for(unsigned i = 0; i < WIFI_AUTH_MAX; i++){
+        if(strcasecmp(name, names[i]) == 0){
+            *authmode = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Parses one line of scan file.
+ *
+ * @return false if line is not an AP record
+ */
+static bool parse_scan_line(char *line, unsigned line_number, wifi_ap_record_t *record){
+    line[strcspn(line, "\r\n")] = '\0';
+    if((line[0] == '#') || (line[strspn(line, " \t")] == '\0')){
+        return false;
+    }
+    memset(record, 0, sizeof(wifi_ap_record_t));
+    int rssi = 0;
+    unsigned primary = 0;
+    char authmode[16];
+    int ssid_offset = 0;
+    if((sscanf(line, "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx %u %d %15s %n", &record->bssid[0], &record->bssid[1], &record->bssid[2],
+               &record->bssid[3], &record->bssid[4], &record->bssid[5], &primary, &rssi, authmode, &ssid_offset) < 9)
+       || !parse_authmode(authmode, &record->authmode)){
+        ESP_LOGW(TAG, "%s:%u: invalid AP record", scan_file, line_number);
+        return false;
+    }
+    record->primary = primary;
+    record->rssi = rssi;
+    strncpy((char *) record->ssid, &line[ssid_offset], 32);
+    return true;
+}
+
+static int compare_rssi(const void *a, const void *b){
+    return ((const wifi_ap_record_t *) b)->rssi - ((const wifi_ap_record_t *) a)->rssi;
+}
+
+static bool scan_matches(const wifi_scan_config_t *config, const wifi_ap_record_t *record){
+    if(config == NULL){
+        return record->ssid[0] != '\0';
+    }
+    if((config->channel != 0) && (config->channel != record->primary)){
+        return false;
+    }
+    if((config->ssid != NULL) && (strncmp((const char *) config->ssid, (const char *) record->ssid, 32) != 0)){
+        return false;
+    }
+    if((config->bssid != NULL) && (memcmp(config->bssid, record->bssid, 6) != 0)){
+        return false;
+    }
+    return config->show_hidden || (record->ssid[0] != '\0');
+}
+
+esp_err_t esp_wifi_scan_start(const wifi_scan_config_t *config, bool block){
+    if(!wifi_started){
+        return ESP_ERR_WIFI_NOT_STARTED;
+    }
+    // driver keeps strongest APs when more are in range than it has room for, like on device
+    wifi_ap_record_t found[CONFIG_SCAN_MAX_AP * 4];
+    unsigned found_count = 0;
+    FILE *file = (scan_file != NULL) ? fopen(scan_file, "r") : NULL;
+    if((scan_file != NULL) && (file == NULL)){
+        ESP_LOGW(TAG, "Cannot open scan file %s", scan_file);
+    }
+    char line[SCAN_LINE_MAX];
+    unsigned line_number = 0;
+    while((file != NULL) && (fgets(line, sizeof(line), file) != NULL) && (found_count < sizeof(found) / sizeof(found[0]))){
+        line_number++;
+        if(parse_scan_line(line, line_number, &found[found_count]) && scan_matches(config, &found[found_count])){
+            found_count++;
+        }
+    }
+    if(file != NULL){
+        fclose(file);
+    }
+    qsort(found, found_count, sizeof(wifi_ap_record_t), compare_rssi);
+
+    pthread_mutex_lock(&wifi_lock);
+    scan_record_count = (found_count < CONFIG_SCAN_MAX_AP) ? found_count : CONFIG_SCAN_MAX_AP;
+    memcpy(scan_records, found, scan_record_count * sizeof(wifi_ap_record_t));
+    pthread_mutex_unlock(&wifi_lock);
+    ESP_LOGD(TAG, "Scan found %u APs", found_count);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_scan_get_ap_records(uint16_t *number, wifi_ap_record_t *ap_records){
+    pthread_mutex_lock(&wifi_lock);
+    if(*number > scan_record_count){
+        *number = scan_record_count;
+    }
+    memcpy(ap_records, scan_records, *number * sizeof(wifi_ap_record_t));
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+static bool replay_active(unsigned generation){
+    pthread_mutex_lock(&wifi_lock);
+    bool active = promiscuous && (generation == replay_generation);
+    pthread_mutex_unlock(&wifi_lock);
+    return active;
+}
+
+/**
+ * @brief Sleeps until deadline in short steps, so stopped replay ends quickly.
+ *
+ * @return false if replay was stopped meanwhile
+ */
+static bool replay_sleep_until(int64_t deadline_us, unsigned generation){
+    while(replay_active(generation)){
+        int64_t remaining = deadline_us - esp_timer_get_time();
+        if(remaining <= 0){
+            return true;
+        }
+        if(remaining > 50000){
+            remaining = 50000;
+        }
+        struct timespec delay = { .tv_sec = 0, .tv_nsec = remaining * 1000 };
+        nanosleep(&delay, NULL);
+    }
+    return false;
+}
+
+static void replay_deliver(const uint8_t *frame, unsigned size){
+    uint8_t buffer[sizeof(wifi_promiscuous_pkt_t) + FRAME_MAX_SIZE];
+    wifi_promiscuous_pkt_t *packet = (wifi_promiscuous_pkt_t *) buffer;
+    wifi_promiscuous_pkt_type_t type;
+    uint32_t type_mask;
+    switch((frame[0] >> 2) & 0x03){
+        case 0:
+            type = WIFI_PKT_MGMT;
+            type_mask = WIFI_PROMIS_FILTER_MASK_MGMT;
+            break;
+        case 1:
+            type = WIFI_PKT_CTRL;
+            type_mask = WIFI_PROMIS_FILTER_MASK_CTRL;
+            break;
+        case 2:
+            type = WIFI_PKT_DATA;
+            type_mask = WIFI_PROMIS_FILTER_MASK_DATA;
+            break;
+        default:
+            type = WIFI_PKT_MISC;
+            type_mask = WIFI_PROMIS_FILTER_MASK_MISC;
+            break;
+    }
+    pthread_mutex_lock(&wifi_lock);
+    wifi_promiscuous_cb_t cb = promiscuous_cb;
+    bool accepted = (filter_mask & type_mask) != 0;
+    memset(&packet->rx_ctrl, 0, sizeof(packet->rx_ctrl));
+    packet->rx_ctrl.channel = channel;
+    pthread_mutex_unlock(&wifi_lock);
+    if((cb == NULL) || !accepted){
+        return;
+    }
+    packet->rx_ctrl.rssi = REPLAY_RSSI;
+    packet->rx_ctrl.sig_len = size;
+    packet->rx_ctrl.timestamp = (uint32_t) esp_timer_get_time();
+    memcpy(packet->payload, frame, size);
+    __atomic_fetch_add(&rx_count, 1, __ATOMIC_RELAXED);
+    cb(packet, type);
+}
+
+static void *replay_thread(void *arg){
+    unsigned generation = (unsigned) (uintptr_t) arg;
+    FILE *file = fopen(frames_file, "rb");
+    pcap_global_header_t header;
+    if((file == NULL) || (fread(&header, sizeof(header), 1, file) != 1)
+       || ((header.magic != PCAP_MAGIC) && (header.magic != PCAP_MAGIC_NSEC))
+       || ((header.linktype != PCAP_LINKTYPE_IEEE802_11) && (header.linktype != PCAP_LINKTYPE_IEEE802_11_RADIOTAP))){
+        ESP_LOGE(TAG, "Cannot replay %s, expected little endian pcap with linktype 105 or 127", frames_file);
+        if(file != NULL){
+            fclose(file);
+        }
+        return NULL;
+    }
+    uint32_t frac_per_us = (header.magic == PCAP_MAGIC_NSEC) ? 1000 : 1;
+    ESP_LOGI(TAG, "Replaying frames from %s", frames_file);
+
+    uint8_t frame[FRAME_MAX_SIZE];
+    int64_t previous_ts = -1;
+    int64_t deadline = esp_timer_get_time();
+    unsigned delivered = 0;
+    while(replay_active(generation)){
+        pcap_record_header_t record;
+        if(fread(&record, sizeof(record), 1, file) != 1){
+            if(!replay_loop || (delivered == 0)){
+                break;
+            }
+            fseek(file, sizeof(header), SEEK_SET);
+            previous_ts = -1;
+            continue;
+        }
+        if(record.incl_len > sizeof(frame)){
+            ESP_LOGW(TAG, "Frame of %u B is too long, replay stopped", record.incl_len);
+            break;
+        }
+        if(fread(frame, record.incl_len, 1, file) != 1){
+            break;
+        }
+        int64_t ts = ((int64_t) record.ts_sec * 1000000) + (record.ts_frac / frac_per_us);
+        if(previous_ts >= 0){
+            int64_t gap = ts - previous_ts;
+            deadline += (gap < 0) ? 0 : (gap > REPLAY_GAP_MAX_US) ? REPLAY_GAP_MAX_US : gap;
+        }
+        previous_ts = ts;
+        if(!replay_sleep_until(deadline, generation)){
+            break;
+        }
+
+        unsigned offset = 0;
+        if(header.linktype == PCAP_LINKTYPE_IEEE802_11_RADIOTAP){
+            offset = (record.incl_len >= 4) ? (frame[2] | (frame[3] << 8)) : record.incl_len;
+        }
+        if(offset + 2 > record.incl_len){
+            continue;
+        }
+        replay_deliver(&frame[offset], record.incl_len - offset);
+        delivered++;
+    }
+    fclose(file);
+    ESP_LOGD(TAG, "Replay finished after %u frames", delivered);
+    return NULL;
+}
+
+esp_err_t esp_wifi_set_promiscuous(bool en){
+    if(!wifi_started){
+        return ESP_ERR_WIFI_NOT_STARTED;
+    }
+    pthread_mutex_lock(&wifi_lock);
+    bool start = en && !promiscuous && (frames_file != NULL);
+    promiscuous = en;
+    unsigned generation = ++replay_generation;
+    pthread_mutex_unlock(&wifi_lock);
+    if(start){
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, replay_thread, (void *) (uintptr_t) generation) != 0){
+            ESP_LOGE(TAG, "Cannot start replay thread");
+            return ESP_ERR_NO_MEM;
+        }
+        pthread_setname_np(thread, "replay");
+        pthread_detach(thread);
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_promiscuous_rx_cb(wifi_promiscuous_cb_t cb){
+    pthread_mutex_lock(&wifi_lock);
+    promiscuous_cb = cb;
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_set_promiscuous_filter(const wifi_promiscuous_filter_t *filter){
+    pthread_mutex_lock(&wifi_lock);
+    filter_mask = filter->filter_mask;
+    pthread_mutex_unlock(&wifi_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_wifi_80211_tx(wifi_interface_t ifx, const void *buffer, int len, bool en_sys_seq){
+    if(!wifi_started){
+        return ESP_ERR_WIFI_NOT_STARTED;
+    }
+    if((len < 24) || (len > 1500)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    const uint8_t *frame = buffer;
+    __atomic_fetch_add(&tx_count, 1, __ATOMIC_RELAXED);
+    ESP_LOGV(TAG, "TX %d B subtype 0x%02x to %02x:%02x:%02x:%02x:%02x:%02x", len, frame[0],
+             frame[4], frame[5], frame[6], frame[7], frame[8], frame[9]);
+    return ESP_OK;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file fake_wifi.h
+ * @date 2026-10-19
+ *
+ * @brief Fake Wi-Fi backend of simulator. Implements esp_wifi API on top of recorded scan results and frames.
+ *
+ * Scan results are read from a text file on every scan, one AP per line:
+ *
+ *     BSSID CHANNEL RSSI AUTHMODE SSID
+ *
+ * e.g. \c 02:00:00:00:00:01 6 -42 wpa2 corpus-ap. AUTHMODE is one of open, wep, wpa, wpa2, wpa_wpa2,
+ * enterprise, wpa3 and wpa2_wpa3. SSID is rest of the line and can be empty for hidden APs.
+ * Lines starting with # are ignored.
+ *
+ * Frames are replayed from pcap file (linktype 105 or 127) while promiscuous mode is enabled,
+ * with their recorded timing. Transmitted frames are only counted.
+ */
+#ifndef FAKE_WIFI_H
+#define FAKE_WIFI_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Sets files the backend replays. Has to be called before Wi-Fi is started.
+ *
+ * @param scan_path scan results, NULL for no APs
+ * @param frames_path pcap file with frames delivered in promiscuous mode, NULL for no frames
+ * @param loop replay frames again from the start after the last one
+ */
+void fake_wifi_configure(const char *scan_path, const char *frames_path, bool loop);
+
+/**
+ * @brief Returns number of frames transmitted by esp_wifi_80211_tx() so far.
+ */
+uint32_t fake_wifi_tx_count(void);
+
+/**
+ * @brief Returns number of frames delivered to promiscuous callback so far.
+ */
+uint32_t fake_wifi_rx_count(void);
+
+#endif
@@ -0,0 +1,20 @@
+/**
+ * @file led_status.c
+ * @date 2026-10-19
+ *
+ * @brief Simulator replacement of status LED, state changes are logged.
+ */
+#include "led_status.h"
+
+#include "esp_log.h"
+
+static const char *TAG = "sim:led";
+
+void led_status_init(void){
+    led_status_set_state(LED_STATE_BOOT);
+}
+
+void led_status_set_state(led_state_t state){
+    static const char *names[] = { "BOOT", "SCAN", "ATTACK", "IDLE" };
+    ESP_LOGD(TAG, "LED state %s", names[state]);
+}
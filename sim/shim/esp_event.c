@@ -0,0 +1,197 @@
+/**
+ * @file esp_event.c
+ * @date 2026-10-19
+ *
+ * @brief Implements host shim of ESP-IDF default event loop.
+ *
+ * Handlers matching an event are copied under the lock and called without it, so handlers may
+ * post events and register or unregister handlers.
+ */
+#include "esp_event.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    esp_event_base_t base;
+    int32_t id;
+    esp_event_handler_t handler;
+    void *arg;
+} handler_entry_t;
+
+typedef struct {
+    esp_event_base_t base;
+    int32_t id;
+    void *data;
+} queued_event_t;
+
+static pthread_mutex_t loop_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t loop_not_empty;
+static pthread_cond_t loop_not_full;
+static bool loop_created = false;
+static queued_event_t queue[HOST_EVENT_QUEUE_SIZE];
+static unsigned queue_head = 0;
+static unsigned queue_count = 0;
+static handler_entry_t *handlers = NULL;
+static unsigned handler_count = 0;
+static unsigned handler_capacity = 0;
+
+static bool base_matches(esp_event_base_t registered, esp_event_base_t posted){
+    // bases are compared by pointer like on device, every base is defined once
+    return (registered == ESP_EVENT_ANY_BASE) || (registered == posted);
+}
+
+static void *event_loop_thread(void *arg){
+    handler_entry_t *matching = NULL;
+    unsigned matching_capacity = 0;
+    while(true){
+        pthread_mutex_lock(&loop_lock);
+        while(queue_count == 0){
+            pthread_cond_wait(&loop_not_empty, &loop_lock);
+        }
+        queued_event_t event = queue[queue_head];
+        queue_head = (queue_head + 1) % HOST_EVENT_QUEUE_SIZE;
+        queue_count--;
+        pthread_cond_signal(&loop_not_full);
+
+        if(matching_capacity < handler_count){
+            matching_capacity = handler_capacity;
+            matching = realloc(matching, matching_capacity * sizeof(handler_entry_t));
+        }
+        unsigned matching_count = 0;
+        for(unsigned i = 0; i < handler_count; i++){
+            if(base_matches(handlers[i].base, event.base)
+               && ((handlers[i].id == ESP_EVENT_ANY_ID) || (handlers[i].id == event.id))){
+                matching[matching_count++] = handlers[i];
+            }
+        }
+        pthread_mutex_unlock(&loop_lock);
+
+        for(unsigned i = 0; i < matching_count; i++){
+            matching[i].handler(matching[i].arg, event.base, event.id, event.data);
+        }
+        free(event.data);
+    }
+    return NULL;
+}
+
+esp_err_t esp_event_loop_create_default(void){
+    pthread_mutex_lock(&loop_lock);
+    if(loop_created){
+        pthread_mutex_unlock(&loop_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&loop_not_empty, &attr);
+    pthread_cond_init(&loop_not_full, &attr);
+    pthread_condattr_destroy(&attr);
+    pthread_t thread;
+    if(pthread_create(&thread, NULL, event_loop_thread, NULL) != 0){
+        pthread_mutex_unlock(&loop_lock);
+        return ESP_ERR_NO_MEM;
+    }
+    pthread_setname_np(thread, "sys_evt");
+    pthread_detach(thread);
+    loop_created = true;
+    pthread_mutex_unlock(&loop_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_event_handler_register(esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler,
+                                     void *event_handler_arg){
+    if((event_handler == NULL) || ((event_base == ESP_EVENT_ANY_BASE) && (event_id != ESP_EVENT_ANY_ID))){
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&loop_lock);
+    for(unsigned i = 0; i < handler_count; i++){
+        if((handlers[i].base == event_base) && (handlers[i].id == event_id) && (handlers[i].handler == event_handler)){
+            handlers[i].arg = event_handler_arg;
+            pthread_mutex_unlock(&loop_lock);
+            return ESP_OK;
+        }
+    }
+    if(handler_count == handler_capacity){
+        unsigned capacity = (handler_capacity == 0) ? 16 : handler_capacity * 2;
+        handler_entry_t *resized = realloc(handlers, capacity * sizeof(handler_entry_t));
+        if(resized == NULL){
+            err = ESP_ERR_NO_MEM;
+        }
+        else {
+            handlers = resized;
+            handler_capacity = capacity;
+        }
+    }
+    if(err == ESP_OK){
+        handlers[handler_count++] = (handler_entry_t) {
+            .base = event_base,
+            .id = event_id,
+            .handler = event_handler,
+            .arg = event_handler_arg
+        };
+    }
+    pthread_mutex_unlock(&loop_lock);
+    return err;
+}
+
+esp_err_t esp_event_handler_unregister(esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler){
+    if((event_base == ESP_EVENT_ANY_BASE) && (event_id != ESP_EVENT_ANY_ID)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&loop_lock);
+    for(unsigned i = 0; i < handler_count; i++){
+        if((handlers[i].base == event_base) && (handlers[i].id == event_id) && (handlers[i].handler == event_handler)){
+            memmove(&handlers[i], &handlers[i + 1], (handler_count - i - 1) * sizeof(handler_entry_t));
+            handler_count--;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&loop_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void *event_data, size_t event_data_size,
+                         TickType_t ticks_to_wait){
+    void *data = NULL;
+    if((event_data != NULL) && (event_data_size > 0)){
+        data = malloc(event_data_size);
+        if(data == NULL){
+            return ESP_ERR_NO_MEM;
+        }
+        memcpy(data, event_data, event_data_size);
+    }
+
+    struct timespec deadline;
+    host_ticks_to_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&loop_lock);
+    if(!loop_created){
+        pthread_mutex_unlock(&loop_lock);
+        free(data);
+        return ESP_ERR_INVALID_STATE;
+    }
+    while(queue_count == HOST_EVENT_QUEUE_SIZE){
+        if((ticks_to_wait == 0)
+           || ((ticks_to_wait == portMAX_DELAY) ? pthread_cond_wait(&loop_not_full, &loop_lock) != 0
+                                                : pthread_cond_timedwait(&loop_not_full, &loop_lock, &deadline) != 0)){
+            break;
+        }
+    }
+    if(queue_count == HOST_EVENT_QUEUE_SIZE){
+        pthread_mutex_unlock(&loop_lock);
+        free(data);
+        return ESP_ERR_TIMEOUT;
+    }
+    queue[(queue_head + queue_count) % HOST_EVENT_QUEUE_SIZE] = (queued_event_t) {
+        .base = event_base,
+        .id = event_id,
+        .data = data
+    };
+    queue_count++;
+    pthread_cond_signal(&loop_not_empty);
+    pthread_mutex_unlock(&loop_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file esp_event.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF default event loop. Events are queued and dispatched by event loop thread.
+ */
+#ifndef ESP_EVENT_H
+#define ESP_EVENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+typedef const char *esp_event_base_t;
+typedef void (*esp_event_handler_t)(void *event_handler_arg, esp_event_base_t event_base, int32_t event_id, void *event_data);
+
+#define ESP_EVENT_DECLARE_BASE(id) extern esp_event_base_t const id
+#define ESP_EVENT_DEFINE_BASE(id) esp_event_base_t const id = #id
+
+#define ESP_EVENT_ANY_BASE NULL
+#define ESP_EVENT_ANY_ID -1
+
+/**
+ * @brief Number of events default loop queues, same as ESP-IDF default CONFIG_ESP_SYSTEM_EVENT_QUEUE_SIZE
+ */
+#define HOST_EVENT_QUEUE_SIZE 32
+
+esp_err_t esp_event_loop_create_default(void);
+
+/**
+ * @brief Registers handler, registering same handler for same event again only updates its argument.
+ */
+esp_err_t esp_event_handler_register(esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler,
+                                     void *event_handler_arg);
+
+/**
+ * @brief Unregisters handler registered for exactly the same event base and ID, like ESP-IDF does.
+ */
+esp_err_t esp_event_handler_unregister(esp_event_base_t event_base, int32_t event_id, esp_event_handler_t event_handler);
+
+/**
+ * @brief Copies event data and queues the event.
+ *
+ * @return ESP_ERR_TIMEOUT queue stayed full for ticks_to_wait
+ */
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void *event_data, size_t event_data_size,
+                         TickType_t ticks_to_wait);
+
+#endif
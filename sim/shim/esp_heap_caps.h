@@ -0,0 +1,71 @@
+/**
+ * @file esp_heap_caps.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF capability heap. Everything is allocated from host heap, simulator has no PSRAM.
+ *
+ * Host heap is reported as internal RAM of HOST_HEAP_SIZE, free size is that minus bytes allocated by malloc.
+ */
+#ifndef ESP_HEAP_CAPS_H
+#define ESP_HEAP_CAPS_H
+
+#include <malloc.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_EXEC (1 << 0)
+#define MALLOC_CAP_32BIT (1 << 1)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+/**
+ * @brief Size reported as free and total size of internal RAM
+ */
+#define HOST_HEAP_SIZE (64 * 1024 * 1024)
+
+static inline void *heap_caps_malloc(size_t size, uint32_t caps){
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : malloc(size);
+}
+
+static inline void *heap_caps_calloc(size_t n, size_t size, uint32_t caps){
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : calloc(n, size);
+}
+
+static inline void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps){
+    return (caps & MALLOC_CAP_SPIRAM) ? NULL : realloc(ptr, size);
+}
+
+static inline void heap_caps_free(void *ptr){
+    free(ptr);
+}
+
+static inline size_t heap_caps_get_allocated_size(void *ptr){
+    return malloc_usable_size(ptr);
+}
+
+static inline size_t heap_caps_get_total_size(uint32_t caps){
+    return (caps & MALLOC_CAP_SPIRAM) ? 0 : HOST_HEAP_SIZE;
+}
+
+static inline size_t heap_caps_get_free_size(uint32_t caps){
+    size_t total = heap_caps_get_total_size(caps);
+    size_t used = mallinfo2().uordblks;
+    return (used < total) ? (total - used) : 0;
+}
+
+/**
+ * @brief Low watermark is not tracked on host, current free size is returned.
+ */
+static inline size_t heap_caps_get_minimum_free_size(uint32_t caps){
+    return heap_caps_get_free_size(caps);
+}
+
+static inline size_t heap_caps_get_largest_free_block(uint32_t caps){
+    return heap_caps_get_free_size(caps);
+}
+
+#endif
@@ -0,0 +1,1068 @@
+/**
+ * @file esp_http_server.c
+ * @date 2026-10-19
+ *
+ * @brief Implements host shim of ESP-IDF HTTP server.
+ *
+ * Server thread polls listening socket, open sessions and a pipe carrying work queued by httpd_queue_work().
+ * Every session has a receive buffer. Request header has to fit into it, bytes received after the header
+ * are consumed by httpd_req_recv() or WebSocket frame reads first, so pipelined requests are not lost.
+ */
+#include "esp_http_server.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "sha1.h"
+
+#define WS_GUID "258EAFA5-E914-47DA-95CA-C5AB0DC11B27"
+#define WS_PAYLOAD_MAX (64 * 1024)
+#define WS_CONTROL_PAYLOAD_MAX 125
+#define RESP_HEADER_SIZE 1024
+#define RESP_HEADERS_MAX 32
+
+typedef struct {
+    int fd;                         ///< -1 marks free slot
+    bool websocket;
+    bool close_requested;
+    bool keep_alive;
+    uint64_t lru;                   ///< value of server LRU counter when session was last active
+    const httpd_uri_t *ws_handler;  ///< handler that accepted WebSocket handshake
+    char buffer[HTTPD_MAX_REQ_HDR_LEN];
+    size_t head;                    ///< first unconsumed byte of buffer
+    size_t tail;                    ///< end of received bytes in buffer
+} session_t;
+
+typedef struct {
+    httpd_work_fn_t work;
+    void *arg;
+} work_item_t;
+
+typedef struct {
+    httpd_config_t config;
+    int listen_fd;
+    int work_pipe[2];
+    pthread_t thread;
+    volatile bool running;
+    pthread_mutex_t handlers_lock;
+    httpd_uri_t *handlers;
+    unsigned handler_count;
+    pthread_mutex_t send_lock;      ///< serialises WebSocket frames sent from other threads
+    session_t *sessions;
+    uint64_t lru_counter;
+} server_t;
+
+/**
+ * @brief State of request being processed, referenced by httpd_req_t::aux
+ */
+typedef struct {
+    server_t *server;
+    session_t *session;
+    char header[HTTPD_MAX_REQ_HDR_LEN + 1];
+    const char *fields;             ///< header fields following request line
+    size_t body_remaining;
+    const char *status;
+    const char *content_type;
+    const char *resp_fields[RESP_HEADERS_MAX][2];
+    unsigned resp_field_count;
+    bool chunked;                   ///< header of chunked response was already sent
+    bool head_request;
+    // WebSocket frame received from client
+    bool ws_frame_valid;
+    httpd_ws_type_t ws_type;
+    bool ws_final;
+    size_t ws_len;
+    size_t ws_remaining;
+    uint8_t ws_mask[4];
+} req_aux_t;
+
+static const char *TAG = "httpd";
+static uint16_t port_override = 0;
+
+static const struct {
+    const char *status;
+    const char *message;
+} error_table[HTTPD_ERR_CODE_MAX] = {
+    [HTTPD_500_INTERNAL_SERVER_ERROR] = { "500 Internal Server Error", "Server has encountered an unexpected error" },
+    [HTTPD_501_METHOD_NOT_IMPLEMENTED] = { "501 Method Not Implemented", "Server does not support this method" },
+    [HTTPD_505_VERSION_NOT_SUPPORTED] = { "505 Version Not Supported", "HTTP version not supported by server" },
+    [HTTPD_400_BAD_REQUEST] = { "400 Bad Request", "Bad request syntax" },
+    [HTTPD_401_UNAUTHORIZED] = { "401 Unauthorized", "No permission -- see authorization schemes" },
+    [HTTPD_403_FORBIDDEN] = { "403 Forbidden", "Request forbidden -- authorization will not help" },
+    [HTTPD_404_NOT_FOUND] = { "404 Not Found", "Nothing matches the given URI" },
+    [HTTPD_405_METHOD_NOT_ALLOWED] = { "405 Method Not Allowed", "Specified method is invalid for this resource" },
+    [HTTPD_408_REQ_TIMEOUT] = { "408 Request Timeout", "Server closed this connection" },
+    [HTTPD_411_LENGTH_REQUIRED] = { "411 Length Required", "Client must specify Content-Length" },
+    [HTTPD_414_URI_TOO_LONG] = { "414 URI Too Long", "URI is too long" },
+    [HTTPD_431_REQ_HDR_FIELDS_TOO_LARGE] = { "431 Request Header Fields Too Large", "Header fields are too long" }
+};
+
+static const char *method_names[] = {
+    [HTTP_DELETE] = "DELETE",
+    [HTTP_GET] = "GET",
+    [HTTP_HEAD] = "HEAD",
+    [HTTP_POST] = "POST",
+    [HTTP_PUT] = "PUT"
+};
+
+void host_httpd_set_port(uint16_t port){
+    port_override = port;
+}
+
+static req_aux_t *req_aux(httpd_req_t *r){
+    return (req_aux_t *) r->aux;
+}
+
+static session_t *session_find(server_t *server, int fd){
+    for(unsigned i = 0; i < server->config.max_open_sockets; i++){
+        if(server->sessions[i].fd == fd){
+            return &server->sessions[i];
+        }
+    }
+    return NULL;
+}
+
+static void session_close(server_t *server, session_t *session){
+    ESP_LOGD(TAG, "Closing session %d", session->fd);
+    int fd = session->fd;
+    session->fd = -1;
+    session->websocket = false;
+    session->close_requested = false;
+    session->ws_handler = NULL;
+    session->head = 0;
+    session->tail = 0;
+    if(server->config.close_fn != NULL){
+        server->config.close_fn(server, fd);
+    }
+    else {
+        close(fd);
+    }
+}
+
+static bool send_all(int fd, const void *data, size_t size){
+    const uint8_t *cursor = data;
+    while(size > 0){
+        ssize_t sent = send(fd, cursor, size, MSG_NOSIGNAL);
+        if(sent < 0){
+            if(errno == EINTR){
+                continue;
+            }
+            ESP_LOGD(TAG, "Sending to %d failed: %s", fd, strerror(errno));
+            return false;
+        }
+        cursor += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+/**
+ * @brief Receives from session buffer first, then from socket.
+ *
+ * @return int received size, 0 if peer closed connection or HTTPD_SOCK_ERR_*
+ */
+static int session_recv(session_t *session, void *buf, size_t size){
+    if(session->head < session->tail){
+        size_t available = session->tail - session->head;
+        size_t copied = (size < available) ? size : available;
+        memcpy(buf, &session->buffer[session->head], copied);
+        session->head += copied;
+        return (int) copied;
+    }
+    while(true){
+        ssize_t received = recv(session->fd, buf, size, 0);
+        if(received >= 0){
+            return (int) received;
+        }
+        if(errno == EINTR){
+            continue;
+        }
+        return ((errno == EAGAIN) || (errno == EWOULDBLOCK)) ? HTTPD_SOCK_ERR_TIMEOUT : HTTPD_SOCK_ERR_FAIL;
+    }
+}
+
+static bool session_recv_all(session_t *session, void *buf, size_t size){
+    uint8_t *cursor = buf;
+    while(size > 0){
+        int received = session_recv(session, cursor, size);
+        if(received <= 0){
+            return false;
+        }
+        cursor += received;
+        size -= received;
+    }
+    return true;
+}
+
+/**
+ * @brief Moves unconsumed bytes to start of session buffer.
+ */
+static void session_compact(session_t *session){
+    memmove(session->buffer, &session->buffer[session->head], session->tail - session->head);
+    session->tail -= session->head;
+    session->head = 0;
+}
+
+static const char *find_field(const char *fields, const char *field, size_t *value_len){
+    size_t field_len = strlen(field);
+    const char *line = fields;
+    while((line != NULL) && (*line != '\0') && (strncmp(line, "\r\n", 2) != 0)){
+        const char *line_end = strstr(line, "\r\n");
+        if((strncasecmp(line, field, field_len) == 0) && (line[field_len] == ':')){
+            const char *value = &line[field_len + 1];
+            while((*value == ' ') || (*value == '\t')){
+                value++;
+            }
+            const char *value_end = (line_end != NULL) ? line_end : value + strlen(value);
+            while((value_end > value) && ((value_end[-1] == ' ') || (value_end[-1] == '\t'))){
+                value_end--;
+            }
+            *value_len = value_end - value;
+            return value;
+        }
+        line = (line_end != NULL) ? line_end + 2 : NULL;
+    }
+    return NULL;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field){
+    size_t value_len = 0;
+    return (find_field(req_aux(r)->fields, field, &value_len) != NULL) ? value_len : 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size){
+    size_t value_len = 0;
+    const char *value = find_field(req_aux(r)->fields, field, &value_len);
+    if(value == NULL){
+        return ESP_ERR_NOT_FOUND;
+    }
+    if(val_size == 0){
+        return ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+    size_t copied = (value_len < val_size) ? value_len : val_size - 1;
+    memcpy(val, value, copied);
+    val[copied] = '\0';
+    return (copied < value_len) ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+static bool field_has_token(httpd_req_t *r, const char *field, const char *token){
+    size_t value_len = 0;
+    const char *value = find_field(req_aux(r)->fields, field, &value_len);
+    size_t token_len = strlen(token);
+    for(size_t i = 0; (value != NULL) && (i + token_len <= value_len); i++){
+        if(strncasecmp(&value[i], token, token_len) == 0){
+            return true;
+        }
+    }
+    return false;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len){
+    const char *query = strchr(r->uri, '?');
+    if(query == NULL){
+        return ESP_ERR_NOT_FOUND;
+    }
+    query++;
+    if(buf_len == 0){
+        return ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+    size_t query_len = strlen(query);
+    size_t copied = (query_len < buf_len) ? query_len : buf_len - 1;
+    memcpy(buf, query, copied);
+    buf[copied] = '\0';
+    return (copied < query_len) ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size){
+    size_t key_len = strlen(key);
+    const char *pair = qry;
+    while(pair != NULL){
+        const char *pair_end = strchr(pair, '&');
+        size_t pair_len = (pair_end != NULL) ? (size_t) (pair_end - pair) : strlen(pair);
+        if((pair_len > key_len) && (strncmp(pair, key, key_len) == 0) && (pair[key_len] == '=')){
+            if(val_size == 0){
+                return ESP_ERR_HTTPD_RESULT_TRUNC;
+            }
+            size_t value_len = pair_len - key_len - 1;
+            size_t copied = (value_len < val_size) ? value_len : val_size - 1;
+            memcpy(val, &pair[key_len + 1], copied);
+            val[copied] = '\0';
+            return (copied < value_len) ? ESP_ERR_HTTPD_RESULT_TRUNC : ESP_OK;
+        }
+        pair = (pair_end != NULL) ? pair_end + 1 : NULL;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r){
+    return req_aux(r)->session->fd;
+}
+
+int httpd_req_recv(httpd_req_t *r, char *buf, size_t buf_len){
+    req_aux_t *aux = req_aux(r);
+    if(buf_len > aux->body_remaining){
+        buf_len = aux->body_remaining;
+    }
+    if(buf_len == 0){
+        return 0;
+    }
+    int received = session_recv(aux->session, buf, buf_len);
+    if(received > 0){
+        aux->body_remaining -= received;
+    }
+    return received;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status){
+    req_aux(r)->status = status;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type){
+    req_aux(r)->content_type = type;
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value){
+    req_aux_t *aux = req_aux(r);
+    if((aux->resp_field_count >= aux->server->config.max_resp_headers) || (aux->resp_field_count >= RESP_HEADERS_MAX)){
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    aux->resp_fields[aux->resp_field_count][0] = field;
+    aux->resp_fields[aux->resp_field_count][1] = value;
+    aux->resp_field_count++;
+    return ESP_OK;
+}
+
+/**
+ * @brief Sends status line and header fields, framing is given by Content-Length or chunked encoding.
+ */
+static esp_err_t send_resp_header(httpd_req_t *r, bool chunked, size_t content_len){
+    req_aux_t *aux = req_aux(r);
+    char header[RESP_HEADER_SIZE];
+    int len = snprintf(header, sizeof(header), "HTTP/1.1 %s\r\nContent-Type: %s\r\n", aux->status, aux->content_type);
+    if(chunked){
+        len += snprintf(&header[len], sizeof(header) - len, "Transfer-Encoding: chunked\r\n");
+    }
+    else {
+        len += snprintf(&header[len], sizeof(header) - len, "Content-Length: %zu\r\n", content_len);
+    }
+    for(unsigned i = 0; (i < aux->resp_field_count) && (len < (int) sizeof(header)); i++){
+        len += snprintf(&header[len], sizeof(header) - len, "%s: %s\r\n", aux->resp_fields[i][0], aux->resp_fields[i][1]);
+    }
+    if(len < (int) sizeof(header)){
+        len += snprintf(&header[len], sizeof(header) - len, "\r\n");
+    }
+    if(len >= (int) sizeof(header)){
+        return ESP_ERR_HTTPD_RESP_HDR;
+    }
+    return send_all(aux->session->fd, header, len) ? ESP_OK : ESP_ERR_HTTPD_RESP_SEND;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len){
+    req_aux_t *aux = req_aux(r);
+    if(aux->chunked){
+        return ESP_ERR_HTTPD_INVALID_REQ;
+    }
+    if(buf_len == HTTPD_RESP_USE_STRLEN){
+        buf_len = (buf != NULL) ? (ssize_t) strlen(buf) : 0;
+    }
+    esp_err_t err = send_resp_header(r, false, buf_len);
+    if((err == ESP_OK) && (buf_len > 0) && !aux->head_request && !send_all(aux->session->fd, buf, buf_len)){
+        err = ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return err;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len){
+    req_aux_t *aux = req_aux(r);
+    if(buf_len == HTTPD_RESP_USE_STRLEN){
+        buf_len = (buf != NULL) ? (ssize_t) strlen(buf) : 0;
+    }
+    if(!aux->chunked){
+        esp_err_t err = send_resp_header(r, true, 0);
+        if(err != ESP_OK){
+            return err;
+        }
+        aux->chunked = true;
+    }
+    if(aux->head_request){
+        return ESP_OK;
+    }
+    char size_line[16];
+    int size_len = snprintf(size_line, sizeof(size_line), "%zx\r\n", (size_t) buf_len);
+    if(!send_all(aux->session->fd, size_line, size_len)
+       || ((buf_len > 0) && !send_all(aux->session->fd, buf, buf_len))
+       || !send_all(aux->session->fd, "\r\n", 2)){
+        return ESP_ERR_HTTPD_RESP_SEND;
+    }
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg){
+    if(error >= HTTPD_ERR_CODE_MAX){
+        error = HTTPD_500_INTERNAL_SERVER_ERROR;
+    }
+    httpd_resp_set_status(req, error_table[error].status);
+    httpd_resp_set_type(req, HTTPD_TYPE_TEXT);
+    return httpd_resp_send(req, (msg != NULL) ? msg : error_table[error].message, HTTPD_RESP_USE_STRLEN);
+}
+
+/**
+ * @brief Sends error on session whose request could not be parsed, session is closed afterwards.
+ */
+static void session_send_err(server_t *server, session_t *session, httpd_err_code_t error){
+    req_aux_t aux = {
+        .server = server,
+        .session = session,
+        .fields = "",
+        .content_type = HTTPD_TYPE_TEXT
+    };
+    httpd_req_t req = {
+        .handle = server,
+        .aux = &aux
+    };
+    httpd_resp_send_err(&req, error, NULL);
+}
+
+static void base64_encode(const uint8_t *data, size_t size, char *out){
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    size_t i = 0;
+    for(; i + 2 < size; i += 3){
+        uint32_t triple = (data[i] << 16) | (data[i + 1] << 8) | data[i + 2];
+        *out++ = alphabet[(triple >> 18) & 0x3f];
+        *out++ = alphabet[(triple >> 12) & 0x3f];
+        *out++ = alphabet[(triple >> 6) & 0x3f];
+        *out++ = alphabet[triple & 0x3f];
+    }
+    if(i < size){
+        uint32_t triple = (data[i] << 16) | ((i + 1 < size) ? data[i + 1] << 8 : 0);
+        *out++ = alphabet[(triple >> 18) & 0x3f];
+        *out++ = alphabet[(triple >> 12) & 0x3f];
+        *out++ = (i + 1 < size) ? alphabet[(triple >> 6) & 0x3f] : '=';
+        *out++ = '=';
+    }
+    *out = '\0';
+}
+
+static esp_err_t ws_send_frame(server_t *server, int fd, httpd_ws_type_t type, bool final, const uint8_t *payload, size_t len){
+    uint8_t header[10];
+    size_t header_len = 2;
+    header[0] = (final ? 0x80 : 0x00) | type;
+    if(len < 126){
+        header[1] = len;
+    }
+    else if(len <= 0xffff){
+        header[1] = 126;
+        header[2] = len >> 8;
+        header[3] = len;
+        header_len = 4;
+    }
+    else {
+        header[1] = 127;
+        for(unsigned i = 0; i < 8; i++){
+            header[2 + i] = (uint64_t) len >> (56 - (8 * i));
+        }
+        header_len = 10;
+    }
+    pthread_mutex_lock(&server->send_lock);
+    bool sent = send_all(fd, header, header_len) && ((len == 0) || send_all(fd, payload, len));
+    pthread_mutex_unlock(&server->send_lock);
+    return sent ? ESP_OK : ESP_FAIL;
+}
+
+httpd_ws_client_info_t httpd_ws_get_fd_info(httpd_handle_t hd, int fd){
+    session_t *session = session_find((server_t *) hd, fd);
+    if(session == NULL){
+        return HTTPD_WS_CLIENT_INVALID;
+    }
+    return session->websocket ? HTTPD_WS_CLIENT_WEBSOCKET : HTTPD_WS_CLIENT_HTTP;
+}
+
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t *frame){
+    server_t *server = (server_t *) hd;
+    if((frame == NULL) || (session_find(server, fd) == NULL)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    // like on device, FIN is set for every frame that is not part of fragmented message
+    bool final = frame->fragmented ? frame->final : true;
+    return ws_send_frame(server, fd, frame->type, final, frame->payload, frame->len);
+}
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t *req, httpd_ws_frame_t *pkt, size_t max_len){
+    req_aux_t *aux = req_aux(req);
+    if(!aux->ws_frame_valid || (pkt == NULL)){
+        return ESP_ERR_INVALID_STATE;
+    }
+    pkt->type = aux->ws_type;
+    pkt->final = aux->ws_final;
+    pkt->fragmented = false;
+    pkt->len = aux->ws_len;
+    if(max_len == 0){
+        return ESP_OK;
+    }
+    if(max_len < aux->ws_remaining){
+        return ESP_ERR_INVALID_SIZE;
+    }
+    size_t offset = aux->ws_len - aux->ws_remaining;
+    if(!session_recv_all(aux->session, &pkt->payload[offset], aux->ws_remaining)){
+        return ESP_FAIL;
+    }
+    for(size_t i = offset; i < aux->ws_len; i++){
+        pkt->payload[i] ^= aux->ws_mask[i % 4];
+    }
+    aux->ws_remaining = 0;
+    return ESP_OK;
+}
+
+static bool ws_discard(session_t *session, size_t size){
+    uint8_t scratch[256];
+    while(size > 0){
+        size_t chunk = (size < sizeof(scratch)) ? size : sizeof(scratch);
+        if(!session_recv_all(session, scratch, chunk)){
+            return false;
+        }
+        size -= chunk;
+    }
+    return true;
+}
+
+/**
+ * @brief Receives one frame from WebSocket client. Control frames are answered here, data frames go to URI handler.
+ *
+ * @return false if session has to be closed
+ */
+static bool ws_process(server_t *server, session_t *session){
+    uint8_t header[2];
+    if(!session_recv_all(session, header, sizeof(header))){
+        return false;
+    }
+    req_aux_t *aux = calloc(1, sizeof(req_aux_t));
+    if(aux == NULL){
+        return false;
+    }
+    aux->server = server;
+    aux->session = session;
+    aux->fields = "";
+    aux->ws_frame_valid = true;
+    aux->ws_final = (header[0] & 0x80) != 0;
+    aux->ws_type = header[0] & 0x0f;
+    uint64_t len = header[1] & 0x7f;
+    bool masked = (header[1] & 0x80) != 0;
+    bool keep = masked;
+    if(keep && (len >= 126)){
+        uint8_t extended[8];
+        size_t extended_len = (len == 126) ? 2 : 8;
+        keep = session_recv_all(session, extended, extended_len);
+        len = 0;
+        for(size_t i = 0; i < extended_len; i++){
+            len = (len << 8) | extended[i];
+        }
+    }
+    keep = keep && session_recv_all(session, aux->ws_mask, sizeof(aux->ws_mask));
+    if(!keep || (len > WS_PAYLOAD_MAX) || ((aux->ws_type >= HTTPD_WS_TYPE_CLOSE) && (len > WS_CONTROL_PAYLOAD_MAX))){
+        ESP_LOGD(TAG, "Invalid WebSocket frame on %d", session->fd);
+        free(aux);
+        return false;
+    }
+    aux->ws_len = len;
+    aux->ws_remaining = len;
+
+    if(aux->ws_type >= HTTPD_WS_TYPE_CLOSE){
+        uint8_t payload[WS_CONTROL_PAYLOAD_MAX];
+        httpd_ws_frame_t frame = { .payload = payload };
+        httpd_req_t req = { .handle = server, .aux = aux };
+        keep = httpd_ws_recv_frame(&req, &frame, sizeof(payload)) == ESP_OK;
+        if(keep && (aux->ws_type == HTTPD_WS_TYPE_PING)){
+            keep = ws_send_frame(server, session->fd, HTTPD_WS_TYPE_PONG, true, payload, frame.len) == ESP_OK;
+        }
+        else if(keep && (aux->ws_type == HTTPD_WS_TYPE_CLOSE)){
+            // echo status code and close the session
+            ws_send_frame(server, session->fd, HTTPD_WS_TYPE_CLOSE, true, payload, (frame.len >= 2) ? 2 : 0);
+            keep = false;
+        }
+        free(aux);
+        return keep;
+    }
+
+    httpd_req_t *req = calloc(1, sizeof(httpd_req_t));
+    if(req == NULL){
+        free(aux);
+        return false;
+    }
+    req->handle = server;
+    req->method = 0;
+    strncpy(req->uri, session->ws_handler->uri, HTTPD_MAX_URI_LEN);
+    req->user_ctx = session->ws_handler->user_ctx;
+    req->aux = aux;
+    keep = session->ws_handler->handler(req) == ESP_OK;
+    keep = keep && ws_discard(session, aux->ws_remaining);
+    free(req);
+    free(aux);
+    return keep;
+}
+
+/**
+ * @brief Copies registered handler of the URI and method.
+ *
+ * @return HTTPD_404_NOT_FOUND, HTTPD_405_METHOD_NOT_ALLOWED or HTTPD_ERR_CODE_MAX if handler was found
+ */
+static httpd_err_code_t find_handler(server_t *server, const char *uri, int method, httpd_uri_t *handler){
+    size_t path_len = strcspn(uri, "?");
+    httpd_err_code_t result = HTTPD_404_NOT_FOUND;
+    pthread_mutex_lock(&server->handlers_lock);
+    for(unsigned i = 0; i < server->handler_count; i++){
+        const httpd_uri_t *candidate = &server->handlers[i];
+        if((strlen(candidate->uri) != path_len) || (strncmp(candidate->uri, uri, path_len) != 0)){
+            continue;
+        }
+        result = HTTPD_405_METHOD_NOT_ALLOWED;
+        if(candidate->method == method){
+            *handler = *candidate;
+            result = HTTPD_ERR_CODE_MAX;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&server->handlers_lock);
+    return result;
+}
+
+static esp_err_t ws_handshake(httpd_req_t *req){
+    char key[64];
+    if(httpd_req_get_hdr_value_str(req, "Sec-WebSocket-Key", key, sizeof(key)) != ESP_OK){
+        return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Missing Sec-WebSocket-Key");
+    }
+    sha1_ctx_t ctx;
+    uint8_t digest[SHA1_DIGEST_SIZE];
+    sha1_init(&ctx);
+    sha1_update(&ctx, key, strlen(key));
+    sha1_update(&ctx, WS_GUID, strlen(WS_GUID));
+    sha1_final(&ctx, digest);
+    char accept[32];
+    base64_encode(digest, sizeof(digest), accept);
+
+    char response[256];
+    int len = snprintf(response, sizeof(response),
+                       "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: %s\r\n\r\n",
+                       accept);
+    return send_all(req_aux(req)->session->fd, response, len) ? ESP_OK : ESP_ERR_HTTPD_RESP_SEND;
+}
+
+/**
+ * @brief Parses request whose header is at start of session buffer and passes it to URI handler.
+ *
+ * @return false if session has to be closed
+ */
+static bool request_process(server_t *server, session_t *session, size_t header_len){
+    // request and its state are on heap, handlers get stack of their own thread only on device
+    req_aux_t *aux = calloc(1, sizeof(req_aux_t));
+    httpd_req_t *req = calloc(1, sizeof(httpd_req_t));
+    if((aux == NULL) || (req == NULL)){
+        free(aux);
+        free(req);
+        return false;
+    }
+    aux->server = server;
+    aux->session = session;
+    aux->status = "200 OK";
+    aux->content_type = HTTPD_TYPE_TEXT;
+    memcpy(aux->header, session->buffer, header_len);
+    aux->header[header_len] = '\0';
+    session->head = header_len;
+    req->handle = server;
+    req->aux = aux;
+
+    char *line_end = strstr(aux->header, "\r\n");
+    *line_end = '\0';
+    aux->fields = line_end + 2;
+    char *method = aux->header;
+    char *uri = strchr(method, ' ');
+    char *version = (uri != NULL) ? strchr(uri + 1, ' ') : NULL;
+    httpd_err_code_t error = HTTPD_ERR_CODE_MAX;
+    if(version == NULL){
+        error = HTTPD_400_BAD_REQUEST;
+    }
+    else {
+        *uri++ = '\0';
+        *version++ = '\0';
+        req->method = -1;
+        for(unsigned i = 0; i < sizeof(method_names) / sizeof(method_names[0]); i++){
+            if(strcmp(method, method_names[i]) == 0){
+                req->method = i;
+            }
+        }
+        if(req->method < 0){
+            error = HTTPD_501_METHOD_NOT_IMPLEMENTED;
+        }
+        else if(strlen(uri) > HTTPD_MAX_URI_LEN){
+            error = HTTPD_414_URI_TOO_LONG;
+        }
+        else if((strcmp(version, "HTTP/1.1") != 0) && (strcmp(version, "HTTP/1.0") != 0)){
+            error = HTTPD_505_VERSION_NOT_SUPPORTED;
+        }
+    }
+    if(error != HTTPD_ERR_CODE_MAX){
+        ESP_LOGW(TAG, "Invalid request on %d: %s", session->fd, error_table[error].status);
+        httpd_resp_send_err(req, error, NULL);
+        free(req);
+        free(aux);
+        return false;
+    }
+    strcpy(req->uri, uri);
+    aux->head_request = req->method == HTTP_HEAD;
+    session->keep_alive = (strcmp(version, "HTTP/1.1") == 0) ? !field_has_token(req, "Connection", "close")
+                                                            : field_has_token(req, "Connection", "keep-alive");
+
+    char content_length[24];
+    if(httpd_req_get_hdr_value_str(req, "Content-Length", content_length, sizeof(content_length)) == ESP_OK){
+        char *end = NULL;
+        req->content_len = strtoul(content_length, &end, 10);
+        if((end == content_length) || (*end != '\0')){
+            error = HTTPD_400_BAD_REQUEST;
+        }
+    }
+    else if(httpd_req_get_hdr_value_len(req, "Transfer-Encoding") > 0){
+        // chunked request bodies are not supported on device either
+        error = HTTPD_411_LENGTH_REQUIRED;
+    }
+    aux->body_remaining = req->content_len;
+
+    httpd_uri_t handler;
+    if(error == HTTPD_ERR_CODE_MAX){
+        error = find_handler(server, req->uri, req->method, &handler);
+    }
+    bool keep = true;
+    if(error != HTTPD_ERR_CODE_MAX){
+        ESP_LOGD(TAG, "%s %s: %s", method_names[(req->method >= 0) ? req->method : HTTP_GET], req->uri, error_table[error].status);
+        keep = httpd_resp_send_err(req, error, NULL) == ESP_OK;
+        keep = keep && (error != HTTPD_400_BAD_REQUEST) && (error != HTTPD_411_LENGTH_REQUIRED);
+    }
+    else if(handler.is_websocket && field_has_token(req, "Upgrade", "websocket")){
+        req->user_ctx = handler.user_ctx;
+        keep = ws_handshake(req) == ESP_OK;
+        if(keep){
+            session->websocket = true;
+            session->keep_alive = true;
+            pthread_mutex_lock(&server->handlers_lock);
+            for(unsigned i = 0; i < server->handler_count; i++){
+                if(server->handlers[i].handler == handler.handler){
+                    session->ws_handler = &server->handlers[i];
+                }
+            }
+            pthread_mutex_unlock(&server->handlers_lock);
+            keep = handler.handler(req) == ESP_OK;
+        }
+    }
+    else {
+        req->user_ctx = handler.user_ctx;
+        esp_err_t err = handler.handler(req);
+        if(err != ESP_OK){
+            ESP_LOGW(TAG, "URI handler of %s %s failed: %s", method_names[req->method], req->uri, esp_err_to_name(err));
+            keep = false;
+        }
+    }
+
+    // unread rest of body would be parsed as next request
+    char scratch[256];
+    while(keep && (aux->body_remaining > 0)){
+        keep = httpd_req_recv(req, scratch, sizeof(scratch)) > 0;
+    }
+    free(req);
+    free(aux);
+    session_compact(session);
+    return keep && session->keep_alive;
+}
+
+/**
+ * @brief Processes readable session, all complete requests it buffered are processed.
+ *
+ * @return false if session has to be closed
+ */
+static bool session_process(server_t *server, session_t *session){
+    session->lru = ++server->lru_counter;
+    if(session->websocket){
+        return ws_process(server, session);
+    }
+    ssize_t received = recv(session->fd, &session->buffer[session->tail], sizeof(session->buffer) - session->tail, 0);
+    if(received <= 0){
+        return false;
+    }
+    session->tail += received;
+    while(!session->close_requested){
+        char *header_end = memmem(session->buffer, session->tail, "\r\n\r\n", 4);
+        if(header_end != NULL){
+            if(!request_process(server, session, header_end - session->buffer + 4)){
+                return false;
+            }
+            if(session->websocket){
+                return (session->tail == 0) || ws_process(server, session);
+            }
+            if(session->tail == 0){
+                return true;
+            }
+            continue;
+        }
+        if(session->tail == sizeof(session->buffer)){
+            session_send_err(server, session, HTTPD_431_REQ_HDR_FIELDS_TOO_LARGE);
+            return false;
+        }
+        // rest of partially received header has to come within receive timeout
+        received = recv(session->fd, &session->buffer[session->tail], sizeof(session->buffer) - session->tail, 0);
+        if(received <= 0){
+            if((received < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))){
+                session_send_err(server, session, HTTPD_408_REQ_TIMEOUT);
+            }
+            return false;
+        }
+        session->tail += received;
+    }
+    return true;
+}
+
+static void session_accept(server_t *server){
+    int fd = accept(server->listen_fd, NULL, NULL);
+    if(fd < 0){
+        ESP_LOGW(TAG, "Accept failed: %s", strerror(errno));
+        return;
+    }
+    struct timeval recv_timeout = { .tv_sec = server->config.recv_wait_timeout };
+    struct timeval send_timeout = { .tv_sec = server->config.send_wait_timeout };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &recv_timeout, sizeof(recv_timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &send_timeout, sizeof(send_timeout));
+
+    session_t *free_session = session_find(server, -1);
+    if((free_session == NULL) && server->config.lru_purge_enable){
+        session_t *lru = &server->sessions[0];
+        for(unsigned i = 1; i < server->config.max_open_sockets; i++){
+            if(server->sessions[i].lru < lru->lru){
+                lru = &server->sessions[i];
+            }
+        }
+        ESP_LOGD(TAG, "Closing least recently used session %d", lru->fd);
+        session_close(server, lru);
+        free_session = lru;
+    }
+    if(free_session == NULL){
+        ESP_LOGW(TAG, "Max open sessions reached, closing new connection");
+        close(fd);
+        return;
+    }
+    free_session->fd = fd;
+    free_session->lru = ++server->lru_counter;
+    ESP_LOGD(TAG, "New session %d", fd);
+}
+
+static void run_queued_work(server_t *server){
+    work_item_t item;
+    while(read(server->work_pipe[0], &item, sizeof(item)) == sizeof(item)){
+        if(item.work != NULL){
+            item.work(item.arg);
+        }
+    }
+}
+
+static void close_requested_sessions(server_t *server){
+    for(unsigned i = 0; i < server->config.max_open_sockets; i++){
+        if((server->sessions[i].fd >= 0) && server->sessions[i].close_requested){
+            session_close(server, &server->sessions[i]);
+        }
+    }
+}
+
+static void *server_thread(void *arg){
+    server_t *server = (server_t *) arg;
+    unsigned max_fds = server->config.max_open_sockets + 2;
+    struct pollfd *fds = calloc(max_fds, sizeof(struct pollfd));
+    session_t **polled = calloc(max_fds, sizeof(session_t *));
+    while(server->running){
+        unsigned count = 0;
+        fds[count++] = (struct pollfd) { .fd = server->work_pipe[0], .events = POLLIN };
+        fds[count++] = (struct pollfd) { .fd = server->listen_fd, .events = POLLIN };
+        for(unsigned i = 0; i < server->config.max_open_sockets; i++){
+            if(server->sessions[i].fd >= 0){
+                polled[count] = &server->sessions[i];
+                fds[count++] = (struct pollfd) { .fd = server->sessions[i].fd, .events = POLLIN };
+            }
+        }
+        if(poll(fds, count, -1) < 0){
+            continue;
+        }
+        if(fds[0].revents & POLLIN){
+            run_queued_work(server);
+            close_requested_sessions(server);
+        }
+        for(unsigned i = 2; i < count; i++){
+            session_t *session = polled[i];
+            // session may have been closed or replaced by work or by another session's handler meanwhile
+            if((fds[i].revents == 0) || (session->fd != fds[i].fd) || session->close_requested){
+                continue;
+            }
+            if(!session_process(server, session)){
+                session_close(server, session);
+            }
+            close_requested_sessions(server);
+        }
+        if(fds[1].revents & POLLIN){
+            session_accept(server);
+        }
+    }
+    free(polled);
+    free(fds);
+    return NULL;
+}
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config){
+    if((handle == NULL) || (config == NULL) || (config->max_open_sockets == 0)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    server_t *server = calloc(1, sizeof(server_t));
+    if(server == NULL){
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    server->config = *config;
+    if(port_override != 0){
+        server->config.server_port = port_override;
+    }
+    server->handlers = calloc(config->max_uri_handlers, sizeof(httpd_uri_t));
+    server->sessions = calloc(config->max_open_sockets, sizeof(session_t));
+    if((server->handlers == NULL) || (server->sessions == NULL)){
+        free(server->handlers);
+        free(server->sessions);
+        free(server);
+        return ESP_ERR_HTTPD_ALLOC_MEM;
+    }
+    for(unsigned i = 0; i < config->max_open_sockets; i++){
+        server->sessions[i].fd = -1;
+    }
+    pthread_mutex_init(&server->handlers_lock, NULL);
+    pthread_mutex_init(&server->send_lock, NULL);
+
+    server->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(server->listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    struct sockaddr_in address = {
+        .sin_family = AF_INET,
+        .sin_port = htons(server->config.server_port),
+        .sin_addr.s_addr = htonl(INADDR_LOOPBACK)
+    };
+    if((server->listen_fd < 0)
+       || (bind(server->listen_fd, (struct sockaddr *) &address, sizeof(address)) != 0)
+       || (listen(server->listen_fd, config->backlog_conn) != 0)){
+        ESP_LOGE(TAG, "Cannot listen on port %u: %s", server->config.server_port, strerror(errno));
+        close(server->listen_fd);
+        free(server->handlers);
+        free(server->sessions);
+        free(server);
+        return ESP_FAIL;
+    }
+    if(pipe(server->work_pipe) != 0){
+        close(server->listen_fd);
+        free(server->handlers);
+        free(server->sessions);
+        free(server);
+        return ESP_ERR_HTTPD_TASK;
+    }
+    fcntl(server->work_pipe[0], F_SETFL, O_NONBLOCK);
+
+    server->running = true;
+    if(pthread_create(&server->thread, NULL, server_thread, server) != 0){
+        close(server->work_pipe[0]);
+        close(server->work_pipe[1]);
+        close(server->listen_fd);
+        free(server->handlers);
+        free(server->sessions);
+        free(server);
+        return ESP_ERR_HTTPD_TASK;
+    }
+    pthread_setname_np(server->thread, "httpd");
+    ESP_LOGI(TAG, "Started server on 127.0.0.1:%u", server->config.server_port);
+    *handle = server;
+    return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle){
+    server_t *server = (server_t *) handle;
+    if(server == NULL){
+        return ESP_ERR_INVALID_ARG;
+    }
+    server->running = false;
+    work_item_t wakeup = { 0 };
+    if(write(server->work_pipe[1], &wakeup, sizeof(wakeup)) != sizeof(wakeup)){
+        return ESP_FAIL;
+    }
+    pthread_join(server->thread, NULL);
+    for(unsigned i = 0; i < server->config.max_open_sockets; i++){
+        if(server->sessions[i].fd >= 0){
+            session_close(server, &server->sessions[i]);
+        }
+    }
+    for(unsigned i = 0; i < server->handler_count; i++){
+        free((char *) server->handlers[i].uri);
+    }
+    close(server->work_pipe[0]);
+    close(server->work_pipe[1]);
+    close(server->listen_fd);
+    free(server->handlers);
+    free(server->sessions);
+    free(server);
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler){
+    server_t *server = (server_t *) handle;
+    if((server == NULL) || (uri_handler == NULL) || (uri_handler->uri == NULL) || (uri_handler->handler == NULL)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&server->handlers_lock);
+    for(unsigned i = 0; i < server->handler_count; i++){
+        if((strcmp(server->handlers[i].uri, uri_handler->uri) == 0) && (server->handlers[i].method == uri_handler->method)){
+            err = ESP_ERR_HTTPD_HANDLER_EXISTS;
+        }
+    }
+    if((err == ESP_OK) && (server->handler_count == server->config.max_uri_handlers)){
+        ESP_LOGW(TAG, "No slot left for URI handler %s", uri_handler->uri);
+        err = ESP_ERR_HTTPD_HANDLERS_FULL;
+    }
+    if(err == ESP_OK){
+        httpd_uri_t *slot = &server->handlers[server->handler_count];
+        *slot = *uri_handler;
+        slot->uri = strdup(uri_handler->uri);
+        server->handler_count++;
+    }
+    pthread_mutex_unlock(&server->handlers_lock);
+    return err;
+}
+
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void *arg){
+    server_t *server = (server_t *) handle;
+    if((server == NULL) || (work == NULL)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    work_item_t item = { .work = work, .arg = arg };
+    return (write(server->work_pipe[1], &item, sizeof(item)) == sizeof(item)) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd){
+    server_t *server = (server_t *) handle;
+    session_t *session = session_find(server, sockfd);
+    if(session == NULL){
+        return ESP_ERR_NOT_FOUND;
+    }
+    session->close_requested = true;
+    // wakes server thread up if called from other thread
+    work_item_t wakeup = { 0 };
+    return (write(server->work_pipe[1], &wakeup, sizeof(wakeup)) == sizeof(wakeup)) ? ESP_OK : ESP_FAIL;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file esp_log.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF logging. Messages go to stderr if they pass level set by host_log_set_level().
+ *
+ * LOG_LOCAL_LEVEL of firmware sources is ignored, all of them share the same run time level.
+ */
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+extern esp_log_level_t host_log_level;
+
+/**
+ * @brief Sets level of messages printed by simulator, ESP_LOG_INFO by default.
+ */
+void host_log_set_level(esp_log_level_t level);
+
+/**
+ * @brief Returns milliseconds since simulator start, printed like esp_log_timestamp() on device.
+ */
+uint32_t esp_log_timestamp(void);
+
+#define ESP_LOG_LEVEL_LOCAL(level, tag, format, ...) do { \
+        if ((level) <= host_log_level) { \
+            fprintf(stderr, "%c (%u) %s: " format "\n", "NEWIDV"[level], (unsigned) esp_log_timestamp(), tag, ##__VA_ARGS__); \
+        } \
+    } while(0)
+
+#define ESP_LOGE(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+#define ESP_LOG_BUFFER_HEXDUMP(tag, buffer, buff_len, level) do { \
+        if ((level) <= host_log_level) { \
+            fprintf(stderr, "%s: ", tag); \
+            for (unsigned hexdump_i_ = 0; hexdump_i_ < (unsigned) (buff_len); hexdump_i_++) { \
+                fprintf(stderr, "%02x", ((const unsigned char *) (buffer))[hexdump_i_]); \
+            } \
+            fprintf(stderr, "\n"); \
+        } \
+    } while(0)
+
+#define ESP_LOG_BUFFER_HEX(tag, buffer, buff_len) ESP_LOG_BUFFER_HEXDUMP(tag, buffer, buff_len, ESP_LOG_INFO)
+
+#endif
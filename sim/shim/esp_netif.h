@@ -0,0 +1,27 @@
+/**
+ * @file esp_netif.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF network interfaces. Simulator uses network stack of the host.
+ */
+#ifndef ESP_NETIF_H
+#define ESP_NETIF_H
+
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef struct esp_netif_obj esp_netif_t;
+
+static inline esp_err_t esp_netif_init(void){
+    return ESP_OK;
+}
+
+static inline esp_netif_t *esp_netif_create_default_wifi_ap(void){
+    return NULL;
+}
+
+static inline esp_netif_t *esp_netif_create_default_wifi_sta(void){
+    return NULL;
+}
+
+#endif
@@ -0,0 +1,48 @@
+/**
+ * @file esp_system.c
+ * @date 2026-10-19
+ *
+ * @brief Implements host shim of ESP-IDF error names and logging.
+ */
+#include <time.h>
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+esp_log_level_t host_log_level = ESP_LOG_INFO;
+
+void host_log_set_level(esp_log_level_t level){
+    host_log_level = level;
+}
+
+uint32_t esp_log_timestamp(void){
+    static uint64_t start_ms = 0;
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    uint64_t now_ms = ((uint64_t) now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+    if(start_ms == 0){
+        start_ms = now_ms;
+    }
+    return (uint32_t) (now_ms - start_ms);
+}
+
+const char *esp_err_to_name(esp_err_t code){
+    switch(code){
+        case ESP_OK: return "ESP_OK";
+        case ESP_FAIL: return "ESP_FAIL";
+        case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+        case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+        case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+        case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+        case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+        case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+        case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+        case ESP_ERR_INVALID_RESPONSE: return "ESP_ERR_INVALID_RESPONSE";
+        case ESP_ERR_INVALID_CRC: return "ESP_ERR_INVALID_CRC";
+        case ESP_ERR_INVALID_VERSION: return "ESP_ERR_INVALID_VERSION";
+        case ESP_ERR_INVALID_MAC: return "ESP_ERR_INVALID_MAC";
+        case ESP_ERR_NOT_FINISHED: return "ESP_ERR_NOT_FINISHED";
+        case ESP_ERR_NOT_ALLOWED: return "ESP_ERR_NOT_ALLOWED";
+        default: return "UNKNOWN ERROR";
+    }
+}
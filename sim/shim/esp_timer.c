@@ -0,0 +1,205 @@
+/**
+ * @file esp_timer.c
+ * @date 2026-10-19
+ *
+ * @brief Implements host shim of ESP-IDF high resolution timer.
+ *
+ * Armed timers are kept in a list and timer thread sleeps until the nearest alarm. Callbacks run
+ * without the lock, so they may start and stop timers, including their own one.
+ */
+#include "esp_timer.h"
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void *arg;
+    bool skip_unhandled_events;
+    bool armed;
+    uint64_t alarm;             ///< absolute time of next callback in us
+    uint64_t period;            ///< 0 for one shot timers
+    struct esp_timer *next;     ///< next armed timer
+};
+
+static pthread_mutex_t timers_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t timers_cond;
+static struct esp_timer *armed_timers = NULL;
+static bool timer_thread_started = false;
+static uint64_t start_us;
+
+static uint64_t monotonic_us(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000000) + (now.tv_nsec / 1000);
+}
+
+__attribute__((constructor)) static void esp_timer_shim_init(void){
+    start_us = monotonic_us();
+}
+
+int64_t esp_timer_get_time(void){
+    return (int64_t) (monotonic_us() - start_us);
+}
+
+static void list_remove(struct esp_timer *timer){
+    for(struct esp_timer **it = &armed_timers; *it != NULL; it = &(*it)->next){
+        if(*it == timer){
+            *it = timer->next;
+            break;
+        }
+    }
+    timer->armed = false;
+}
+
+/**
+ * @brief Inserts timer sorted by alarm time, timers with equal alarm keep order in which they were armed.
+ */
+static void list_insert(struct esp_timer *timer){
+    struct esp_timer **it = &armed_timers;
+    while((*it != NULL) && ((*it)->alarm <= timer->alarm)){
+        it = &(*it)->next;
+    }
+    timer->next = *it;
+    *it = timer;
+    timer->armed = true;
+}
+
+static void *timer_thread(void *arg){
+    pthread_mutex_lock(&timers_lock);
+    while(true){
+        if(armed_timers == NULL){
+            pthread_cond_wait(&timers_cond, &timers_lock);
+            continue;
+        }
+        uint64_t now = monotonic_us();
+        struct esp_timer *timer = armed_timers;
+        if(timer->alarm > now){
+            struct timespec deadline = {
+                .tv_sec = timer->alarm / 1000000,
+                .tv_nsec = (timer->alarm % 1000000) * 1000
+            };
+            pthread_cond_timedwait(&timers_cond, &timers_lock, &deadline);
+            continue;
+        }
+        list_remove(timer);
+        if(timer->period > 0){
+            // like on device, late periodic timer catches up unless it skips unhandled events
+            timer->alarm += timer->period;
+            if(timer->skip_unhandled_events && (timer->alarm < now)){
+                timer->alarm = now + timer->period;
+            }
+            list_insert(timer);
+        }
+        // timer may be stopped and deleted while callback runs, so nothing of it is touched after unlock
+        esp_timer_cb_t callback = timer->callback;
+        void *callback_arg = timer->arg;
+        pthread_mutex_unlock(&timers_lock);
+        callback(callback_arg);
+        pthread_mutex_lock(&timers_lock);
+    }
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle){
+    if((create_args == NULL) || (create_args->callback == NULL) || (out_handle == NULL)){
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_timer *timer = calloc(1, sizeof(struct esp_timer));
+    if(timer == NULL){
+        return ESP_ERR_NO_MEM;
+    }
+    timer->callback = create_args->callback;
+    timer->arg = create_args->arg;
+    timer->skip_unhandled_events = create_args->skip_unhandled_events;
+
+    pthread_mutex_lock(&timers_lock);
+    if(!timer_thread_started){
+        pthread_condattr_t attr;
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&timers_cond, &attr);
+        pthread_condattr_destroy(&attr);
+        pthread_t thread;
+        if(pthread_create(&thread, NULL, timer_thread, NULL) != 0){
+            pthread_mutex_unlock(&timers_lock);
+            free(timer);
+            return ESP_ERR_NO_MEM;
+        }
+        pthread_setname_np(thread, "esp_timer");
+        pthread_detach(thread);
+        timer_thread_started = true;
+    }
+    pthread_mutex_unlock(&timers_lock);
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+static esp_err_t timer_start(esp_timer_handle_t timer, uint64_t timeout_us, uint64_t period){
+    if(timer == NULL){
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&timers_lock);
+    if(timer->armed){
+        err = ESP_ERR_INVALID_STATE;
+    }
+    else {
+        timer->alarm = monotonic_us() + timeout_us;
+        timer->period = period;
+        list_insert(timer);
+        pthread_cond_signal(&timers_cond);
+    }
+    pthread_mutex_unlock(&timers_lock);
+    return err;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us){
+    return timer_start(timer, timeout_us, 0);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period){
+    if(period == 0){
+        return ESP_ERR_INVALID_ARG;
+    }
+    return timer_start(timer, period, period);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer){
+    if(timer == NULL){
+        return ESP_ERR_INVALID_ARG;
+    }
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&timers_lock);
+    if(!timer->armed){
+        err = ESP_ERR_INVALID_STATE;
+    }
+    else {
+        list_remove(timer);
+    }
+    pthread_mutex_unlock(&timers_lock);
+    return err;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer){
+    if(timer == NULL){
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timers_lock);
+    bool armed = timer->armed;
+    pthread_mutex_unlock(&timers_lock);
+    if(armed){
+        return ESP_ERR_INVALID_STATE;
+    }
+    free(timer);
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer){
+    pthread_mutex_lock(&timers_lock);
+    bool armed = timer->armed;
+    pthread_mutex_unlock(&timers_lock);
+    return armed;
+}
@@ -0,0 +1,42 @@
+/**
+ * @file esp_vfs_fat.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF FAT filesystem. Base path is a directory of the host filesystem.
+ */
+#ifndef ESP_VFS_FAT_H
+#define ESP_VFS_FAT_H
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/stat.h>
+
+#include "esp_err.h"
+
+typedef int32_t wl_handle_t;
+
+#define WL_INVALID_HANDLE -1
+
+typedef struct {
+    bool format_if_mount_failed;
+    int max_files;
+    size_t allocation_unit_size;
+    bool disk_status_check_enable;
+} esp_vfs_fat_mount_config_t;
+
+/**
+ * @brief Creates base path directory if it does not exist
+ */
+static inline esp_err_t esp_vfs_fat_spiflash_mount_rw_wl(const char *base_path, const char *partition_label,
+                                                         const esp_vfs_fat_mount_config_t *mount_config, wl_handle_t *wl_handle){
+    (void) partition_label;
+    (void) mount_config;
+    *wl_handle = 0;
+    if((mkdir(base_path, 0777) != 0) && (errno != EEXIST)){
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+#endif
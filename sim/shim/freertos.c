@@ -0,0 +1,283 @@
+/**
+ * @file freertos.c
+ * @date 2026-10-19
+ *
+ * @brief Implements host shim of FreeRTOS tasks, notifications and semaphores on pthreads.
+ */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+struct host_task {
+    TaskFunction_t task_code;
+    void *parameters;
+    char name[16];
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notification_value;
+    bool notification_pending;
+};
+
+struct host_semaphore {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max_count;
+};
+
+static const char *TAG = "sim:freertos";
+static __thread TaskHandle_t current_task = NULL;
+
+static uint64_t monotonic_ms(void){
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t) now.tv_sec * 1000) + (now.tv_nsec / 1000000);
+}
+
+static uint64_t start_ms;
+
+__attribute__((constructor)) static void freertos_shim_init(void){
+    start_ms = monotonic_ms();
+}
+
+void host_ticks_to_deadline(TickType_t ticks, struct timespec *deadline){
+    clock_gettime(CLOCK_MONOTONIC, deadline);
+    uint64_t nsec = (uint64_t) deadline->tv_nsec + ((uint64_t) ticks * portTICK_PERIOD_MS * 1000000);
+    deadline->tv_sec += nsec / 1000000000;
+    deadline->tv_nsec = nsec % 1000000000;
+}
+
+static void monotonic_cond_init(pthread_cond_t *cond){
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+/**
+ * @brief Waits on condition until it is signalled or ticks elapse. Caller checks the predicate.
+ *
+ * @return false on timeout
+ */
+static bool cond_wait_ticks(pthread_cond_t *cond, pthread_mutex_t *lock, const struct timespec *deadline, TickType_t ticks){
+    if(ticks == portMAX_DELAY){
+        pthread_cond_wait(cond, lock);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, lock, deadline) != ETIMEDOUT;
+}
+
+static TaskHandle_t task_alloc(const char *name){
+    TaskHandle_t task = calloc(1, sizeof(struct host_task));
+    if(task == NULL){
+        return NULL;
+    }
+    strncpy(task->name, name, sizeof(task->name) - 1);
+    pthread_mutex_init(&task->lock, NULL);
+    monotonic_cond_init(&task->cond);
+    return task;
+}
+
+static void *task_entry(void *arg){
+    current_task = arg;
+    current_task->task_code(current_task->parameters);
+    ESP_LOGE(TAG, "Task %s returned from its function!", current_task->name);
+    abort();
+}
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created_task){
+    TaskHandle_t task = task_alloc(name);
+    if(task == NULL){
+        return pdFAIL;
+    }
+    task->task_code = task_code;
+    task->parameters = parameters;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    pthread_t thread;
+    int err = pthread_create(&thread, &attr, task_entry, task);
+    pthread_attr_destroy(&attr);
+    if(err != 0){
+        free(task);
+        return pdFAIL;
+    }
+    pthread_setname_np(thread, task->name);
+    if(created_task != NULL){
+        *created_task = task;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task){
+    if((task != NULL) && (task != current_task)){
+        ESP_LOGE(TAG, "Deleting other tasks is not supported!");
+        abort();
+    }
+    // handle may still be referenced by notifiers, so it is never freed
+    pthread_exit(NULL);
+}
+
+void vTaskDelay(TickType_t ticks){
+    struct timespec delay = {
+        .tv_sec = ((uint64_t) ticks * portTICK_PERIOD_MS) / 1000,
+        .tv_nsec = (((uint64_t) ticks * portTICK_PERIOD_MS) % 1000) * 1000000
+    };
+    while(nanosleep(&delay, &delay) != 0 && errno == EINTR){
+    }
+}
+
+TickType_t xTaskGetTickCount(void){
+    return (TickType_t) ((monotonic_ms() - start_ms) / portTICK_PERIOD_MS);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void){
+    if(current_task == NULL){
+        current_task = task_alloc("thread");
+    }
+    return current_task;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action){
+    BaseType_t result = pdPASS;
+    pthread_mutex_lock(&task->lock);
+    switch(action){
+        case eSetBits:
+            task->notification_value |= value;
+            break;
+        case eIncrement:
+            task->notification_value++;
+            break;
+        case eSetValueWithOverwrite:
+            task->notification_value = value;
+            break;
+        case eSetValueWithoutOverwrite:
+            if(task->notification_pending){
+                result = pdFAIL;
+            }
+            else {
+                task->notification_value = value;
+            }
+            break;
+        case eNoAction:
+            break;
+    }
+    task->notification_pending = true;
+    pthread_cond_broadcast(&task->cond);
+    pthread_mutex_unlock(&task->lock);
+    return result;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task){
+    return xTaskNotify(task, 0, eIncrement);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait){
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    host_ticks_to_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&task->lock);
+    while((task->notification_value == 0) && (ticks_to_wait > 0)){
+        if(!cond_wait_ticks(&task->cond, &task->lock, &deadline, ticks_to_wait)){
+            break;
+        }
+    }
+    uint32_t value = task->notification_value;
+    if(value > 0){
+        task->notification_value = clear_count_on_exit ? 0 : value - 1;
+    }
+    task->notification_pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t bits_to_clear_on_entry, uint32_t bits_to_clear_on_exit, uint32_t *notification_value,
+                           TickType_t ticks_to_wait){
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    host_ticks_to_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&task->lock);
+    if(!task->notification_pending){
+        task->notification_value &= ~bits_to_clear_on_entry;
+    }
+    while(!task->notification_pending && (ticks_to_wait > 0)){
+        if(!cond_wait_ticks(&task->cond, &task->lock, &deadline, ticks_to_wait)){
+            break;
+        }
+    }
+    BaseType_t result = task->notification_pending ? pdPASS : pdFAIL;
+    if(notification_value != NULL){
+        *notification_value = task->notification_value;
+    }
+    if(result == pdPASS){
+        task->notification_value &= ~bits_to_clear_on_exit;
+    }
+    task->notification_pending = false;
+    pthread_mutex_unlock(&task->lock);
+    return result;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count){
+    SemaphoreHandle_t semaphore = calloc(1, sizeof(struct host_semaphore));
+    if(semaphore == NULL){
+        return NULL;
+    }
+    pthread_mutex_init(&semaphore->lock, NULL);
+    monotonic_cond_init(&semaphore->cond);
+    semaphore->count = initial_count;
+    semaphore->max_count = max_count;
+    return semaphore;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void){
+    return xSemaphoreCreateCounting(1, 1);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void){
+    return xSemaphoreCreateCounting(1, 0);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t semaphore){
+    pthread_cond_destroy(&semaphore->cond);
+    pthread_mutex_destroy(&semaphore->lock);
+    free(semaphore);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks_to_wait){
+    struct timespec deadline;
+    host_ticks_to_deadline(ticks_to_wait, &deadline);
+    pthread_mutex_lock(&semaphore->lock);
+    while((semaphore->count == 0) && (ticks_to_wait > 0)){
+        if(!cond_wait_ticks(&semaphore->cond, &semaphore->lock, &deadline, ticks_to_wait)){
+            break;
+        }
+    }
+    BaseType_t result = pdFAIL;
+    if(semaphore->count > 0){
+        semaphore->count--;
+        result = pdPASS;
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return result;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore){
+    BaseType_t result = pdFAIL;
+    pthread_mutex_lock(&semaphore->lock);
+    if(semaphore->count < semaphore->max_count){
+        semaphore->count++;
+        pthread_cond_signal(&semaphore->cond);
+        result = pdPASS;
+    }
+    pthread_mutex_unlock(&semaphore->lock);
+    return result;
+}
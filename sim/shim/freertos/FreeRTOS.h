@@ -0,0 +1,49 @@
+/**
+ * @file FreeRTOS.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of FreeRTOS base types. Tick is 1 ms, critical sections are recursive pthread mutexes.
+ */
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+#include <pthread.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS pdTRUE
+#define pdFAIL pdFALSE
+
+#define portMAX_DELAY ((TickType_t) UINT32_MAX)
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms) ((TickType_t) (((uint64_t) (ms) * configTICK_RATE_HZ) / 1000))
+
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+// critical sections of firmware are short and may nest, so recursive mutex is closest to spinlock semantics
+typedef pthread_mutex_t portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP
+
+#define portENTER_CRITICAL(mux) pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL(mux) pthread_mutex_unlock(mux)
+#define portENTER_CRITICAL_ISR(mux) pthread_mutex_lock(mux)
+#define portEXIT_CRITICAL_ISR(mux) pthread_mutex_unlock(mux)
+#define portYIELD_FROM_ISR(woken) ((void) (woken))
+
+/**
+ * @brief Converts ticks relative to now into absolute CLOCK_MONOTONIC deadline.
+ *
+ * @param ticks
+ * @param deadline output
+ */
+struct timespec;
+void host_ticks_to_deadline(TickType_t ticks, struct timespec *deadline);
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file task.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of FreeRTOS tasks. Every task is a detached pthread with its own notification value.
+ *
+ * Stack size and priority are ignored, host threads use default stack size.
+ */
+#ifndef TASK_H
+#define TASK_H
+
+#include <stdint.h>
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite
+} eNotifyAction;
+
+BaseType_t xTaskCreate(TaskFunction_t task_code, const char *name, uint32_t stack_depth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created_task);
+
+/**
+ * @brief Only deletion of calling task (NULL) is supported, it exits the thread.
+ */
+void vTaskDelete(TaskHandle_t task);
+
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount(void);
+
+/**
+ * @brief Returns handle of calling thread. Threads not created by xTaskCreate() get their handle on first call.
+ */
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait);
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyWait(uint32_t bits_to_clear_on_entry, uint32_t bits_to_clear_on_exit, uint32_t *notification_value,
+                           TickType_t ticks_to_wait);
+
+#endif
@@ -0,0 +1,10 @@
+/**
+ * @file led_strip.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of led_strip managed component. Simulator has no LED, see led_status.c of simulator.
+ */
+#ifndef LED_STRIP_H
+#define LED_STRIP_H
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * @file sdkconfig.h
+ * @date 2026-10-19
+ *
+ * @brief Host configuration of firmware built into simulator, defaults of Kconfig options
+ */
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_HOTPATH_LOG_LEVEL 0
+#define CONFIG_HOTPATH_LOG_SAMPLE_RATE 1
+
+#define CONFIG_MEM_ALLOC_USE_SPIRAM 1
+#define CONFIG_MEM_ALLOC_INTERNAL_FALLBACK 1
+
+#define CONFIG_SCAN_MAX_AP 20
+#define CONFIG_MGMT_AP_SSID "ManagementAP"
+#define CONFIG_MGMT_AP_PASSWORD "mgmtadmin"
+#define CONFIG_MGMT_AP_CHANNEL 3
+#define CONFIG_MGMT_AP_MAX_CONNECTIONS 1
+#define CONFIG_MGMT_AP_AUTH_ON 1
+
+#define CONFIG_CAPTURE_STORE_ENABLED 1
+#define CONFIG_CAPTURE_STORE_PARTITION_LABEL "storage"
+// relative to working directory of simulator
+#define CONFIG_CAPTURE_STORE_BASE_PATH "captures"
+#define CONFIG_CAPTURE_STORE_SEGMENT_SIZE 4096
+#define CONFIG_CAPTURE_STORE_SYNC_INTERVAL 8
+#define CONFIG_CAPTURE_STORE_MAX_SESSIONS 32
+#define CONFIG_CAPTURE_STORE_INDEX_RUN_ENTRIES 1024
+#define CONFIG_CAPTURE_STORE_INDEX_MERGE_BUFFER 8192
+#define CONFIG_CAPTURE_STORE_INDEX_EAPOL_PAIRS 16
+#define CONFIG_WL_SECTOR_SIZE 4096
+
+#define CONFIG_WEBSERVER_STACK_SIZE 6144
+#define CONFIG_WEBSERVER_MAX_OPEN_SOCKETS 7
+#define CONFIG_WEBSERVER_BACKLOG 8
+#define CONFIG_WEBSERVER_LRU_PURGE 1
+#define CONFIG_WEBSERVER_RECV_TIMEOUT 10
+#define CONFIG_WEBSERVER_SEND_TIMEOUT 10
+#define CONFIG_WEBSERVER_STREAM_CHUNK_SIZE 4096
+
+#define CONFIG_FRAME_ANALYZER_DEDUP_ENTRIES 8
+
+#define CONFIG_PCAP_SERIALIZER_BUFFER_SIZE 262144
+#define CONFIG_PCAP_SERIALIZER_RETENTION_STOP 1
+
+#define CONFIG_ATTACK_HANDSHAKE_STOP_SCORE 70
+#define CONFIG_ATTACK_QUEUE_MAX_JOBS 16
+
+#endif
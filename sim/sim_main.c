@@ -0,0 +1,126 @@
+/**
+ * @file sim_main.c
+ * @date 2026-10-19
+ *
+ * @brief Host simulator of the firmware control plane.
+ *
+ * Starts the same components as app_main() does on device, except display, GUI and UART CLI.
+ * Wi-Fi driver is replaced by fake backend replaying files and webserver listens on localhost.
+ */
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "esp_err.h"
+#include "esp_event.h"
+#include "esp_http_server.h"
+#include "esp_log.h"
+
+#include "attack.h"
+#include "capture_store.h"
+#include "fake_wifi.h"
+#include "led_status.h"
+#include "mem_alloc.h"
+#include "webserver.h"
+#include "wifi_controller.h"
+
+#define SIM_DEFAULT_PORT 8080
+
+static const char *TAG = "sim";
+
+static void usage(const char *name){
+    fprintf(stderr,
+            "Usage: %s [-p PORT] [-s SCAN] [-f FRAMES.pcap] [-l] [-C DIR] [-v LEVEL]\n"
+            "  -p PORT   port of webserver on 127.0.0.1, default %u\n"
+            "  -s SCAN   text file with scan results, see fake_wifi.h\n"
+            "  -f FRAMES pcap file replayed in promiscuous mode\n"
+            "  -l        replay frames in a loop\n"
+            "  -C DIR    working directory, capture store is kept in DIR/%s\n"
+            "  -v LEVEL  log level 0 (none) - 5 (verbose), default 3 (info)\n",
+            name, SIM_DEFAULT_PORT, CONFIG_CAPTURE_STORE_BASE_PATH);
+}
+
+/**
+ * @brief Resolves path given on command line before working directory changes.
+ */
+static const char *absolute_path(const char *path){
+    if(path == NULL){
+        return NULL;
+    }
+    char *resolved = realpath(path, NULL);
+    if(resolved == NULL){
+        fprintf(stderr, "%s: %s\n", path, strerror(errno));
+        exit(EXIT_FAILURE);
+    }
+    return resolved;
+}
+
+int main(int argc, char *argv[]){
+    unsigned port = SIM_DEFAULT_PORT;
+    const char *scan_path = NULL;
+    const char *frames_path = NULL;
+    const char *directory = NULL;
+    bool loop = false;
+    int opt;
+    while((opt = getopt(argc, argv, "p:s:f:lC:v:h")) != -1){
+        switch(opt){
+            case 'p':
+                port = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                scan_path = optarg;
+                break;
+            case 'f':
+                frames_path = optarg;
+                break;
+            case 'l':
+                loop = true;
+                break;
+            case 'C':
+                directory = optarg;
+                break;
+            case 'v':
+                host_log_set_level((esp_log_level_t) strtoul(optarg, NULL, 10));
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if((port == 0) || (port > 65535) || (optind != argc)){
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+    scan_path = absolute_path(scan_path);
+    frames_path = absolute_path(frames_path);
+    if(directory != NULL){
+        if(((mkdir(directory, 0777) != 0) && (errno != EEXIST)) || (chdir(directory) != 0)){
+            fprintf(stderr, "%s: %s\n", directory, strerror(errno));
+            return EXIT_FAILURE;
+        }
+    }
+    // client closing connection while response is sent must not kill the simulator
+    signal(SIGPIPE, SIG_IGN);
+
+    fake_wifi_configure(scan_path, frames_path, loop);
+    host_httpd_set_port(port);
+
+    led_status_init();
+    mem_alloc_init();
+    ESP_ERROR_CHECK(esp_event_loop_create_default());
+    wifictl_mgmt_ap_start();
+    capture_store_init();
+    attack_init();
+    webserver_run();
+    led_status_set_state(LED_STATE_IDLE);
+    ESP_LOGI(TAG, "Simulator running, http://127.0.0.1:%u/", port);
+
+    while(true){
+        pause();
+    }
+    return EXIT_SUCCESS;
+}
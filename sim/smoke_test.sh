@@ -0,0 +1,83 @@
+#!/bin/sh
+# Smoke test of simulator: scans, captures handshake of the corpus passively and downloads results over HTTP.
+set -eu
+
+cd "$(dirname "$0")"
+VERIFY=../tools/hccapx_verify/hccapx_verify
+PORT=${SIM_PORT:-18080}
+URL=http://127.0.0.1:$PORT
+WORK=$(mktemp -d)
+SIM_PID=
+
+cleanup() {
+    if [ -n "$SIM_PID" ]; then
+        kill "$SIM_PID" 2>/dev/null || true
+        wait "$SIM_PID" 2>/dev/null || true
+    fi
+    rm -rf "$WORK"
+}
+trap cleanup EXIT
+
+fail() {
+    echo "FAIL: $*"
+    echo "--- simulator log ---"
+    cat "$WORK/sim.log"
+    exit 1
+}
+
+./sim -p "$PORT" -s corpus/scan.txt -f ../tools/hccapx_verify/corpus/full.pcap -C "$WORK" > "$WORK/sim.log" 2>&1 &
+SIM_PID=$!
+for i in $(seq 50); do
+    curl -s -o /dev/null "$URL/ap-list" && break
+    sleep 0.1
+done
+
+# every AP record is 40 B, hidden AP of scan file is not listed
+curl -sf -o "$WORK/ap-list" "$URL/ap-list" || fail "GET /ap-list"
+[ "$(wc -c < "$WORK/ap-list")" -eq 120 ] || fail "/ap-list returned $(wc -c < "$WORK/ap-list") B, expected 3 records"
+[ "$(head -c 9 "$WORK/ap-list")" = "corpus-ap" ] || fail "strongest AP is not listed first"
+echo "ok: /ap-list"
+
+# version 1, handshake attack, passive method, 10 s timeout, AP 0
+printf '\001\001\002\012\001\000' > "$WORK/request"
+[ "$(curl -s -o /dev/null -w '%{http_code}' --data-binary @"$WORK/request" "$URL/run-attack")" = 200 ] || fail "POST /run-attack"
+echo "ok: /run-attack"
+
+# state byte of /status: 0 READY, 1 RUNNING, 2 FINISHED, 3 TIMEOUT
+state=
+for i in $(seq 100); do
+    state=$(curl -sf "$URL/status" | od -An -tu1 -N1 | tr -d ' ')
+    [ "$state" = 1 ] || break
+    sleep 0.1
+done
+[ "$state" = 2 ] || fail "attack ended in state $state, expected FINISHED"
+echo "ok: /status"
+
+curl -sf -o "$WORK/capture.pcap" "$URL/capture.pcap" || fail "GET /capture.pcap"
+[ "$(od -An -tx4 -N4 "$WORK/capture.pcap" | tr -d ' ')" = a1b2c3d4 ] || fail "capture.pcap has no pcap header"
+echo "ok: /capture.pcap"
+
+curl -sf -o "$WORK/capture.hccapx" "$URL/capture.hccapx" || fail "GET /capture.hccapx"
+"$VERIFY" "$WORK/capture.hccapx" corpus-ap correct-horse-battery > "$WORK/verify.log" 2>&1 || fail "$(cat "$WORK/verify.log")"
+echo "ok: /capture.hccapx"
+
+curl -sf -o "$WORK/sessions" "$URL/sessions" || fail "GET /sessions"
+[ -s "$WORK/sessions" ] || fail "capture store has no session"
+echo "ok: /sessions"
+
+[ "$(curl -s -o /dev/null -w '%{http_code}' "$URL/session-query?id=zz")" = 400 ] || fail "/session-query accepted invalid id"
+[ "$(curl -s -o /dev/null -w '%{http_code}' "$URL/session-query?id=0&kinds=256")" = 400 ] || fail "/session-query accepted kinds out of range"
+echo "ok: /session-query"
+
+# version 1, DoS attack, broadcast method, 1 s timeout, AP 0; it runs until timeout stops it from event loop
+curl -sf -o /dev/null -I "$URL/reset" || fail "HEAD /reset"
+printf '\001\003\001\001\001\000' > "$WORK/request"
+[ "$(curl -s -o /dev/null -w '%{http_code}' --data-binary @"$WORK/request" "$URL/run-attack")" = 200 ] || fail "POST /run-attack (DoS)"
+state=
+for i in $(seq 50); do
+    state=$(curl -sf "$URL/status" | od -An -tu1 -N1 | tr -d ' ')
+    [ "$state" = 3 ] && break
+    sleep 0.1
+done
+[ "$state" = 3 ] || fail "DoS attack ended in state $state, expected TIMEOUT"
+echo "ok: attack timeout"
@@ -0,0 +1,31 @@
+/**
+ * @file fuzz.h
+ * @date 2026-10-19
+ *
+ * @brief Provides entry point of fuzz targets, shared by libFuzzer, AFL and standalone builds
+ */
+#ifndef FUZZ_H
+#define FUZZ_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Runs one input through fuzz target. Implemented by every target.
+ *
+ * @param data
+ * @param size
+ * @return int always 0
+ */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/**
+ * @brief Copies input into buffer of exactly given size, so sanitizers catch every read behind its end.
+ *
+ * @param data
+ * @param size
+ * @return uint8_t* to be freed by caller
+ */
+uint8_t *fuzz_exact_copy(const uint8_t *data, size_t size);
+
+#endif
@@ -0,0 +1,65 @@
+/**
+ * @file fuzz_eapol.c
+ * @date 2026-10-19
+ *
+ * @brief Fuzz target of frame analyzer parsers. Input is single IEEE 802.11 frame without FCS.
+ *
+ * Frame goes through the same chain as in frame_analyzer.c: frame view, EAPoL packet, EAPoL-Key packet, its Key MIC
+ * and Key Data and PMKIDs from key data. Input is parsed twice, as bare frame and as frame preceded by radiotap header.
+ */
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+
+#include "frame_analyzer_parser.h"
+#include "fuzz.h"
+
+/**
+ * @brief Runs parser chain on the frame
+ *
+ * @param frame
+ * @param size
+ * @param radiotap
+ */
+static void parse_frame(uint8_t *frame, size_t size, bool radiotap){
+    frame_view_t view;
+    if(!parse_frame_view(frame, size, radiotap, &view)){
+        return;
+    }
+    // every field of the view has to lie within the frame
+    if((view.frame_offset + view.frame_length != size) || (view.body + view.body_length != size)
+        || (view.addr4 + 6 > view.body) || (view.sta + 6 > view.body) || (view.bssid + 6 > view.body)){
+        abort();
+    }
+    uint8_t bssid[6] = { 0 };
+    is_frame_bssid_matching(frame, &view, bssid);
+    eapol_packet_t *eapol_packet = parse_eapol_packet(frame, &view);
+    eapol_key_packet_t *eapol_key_packet = (eapol_packet != NULL) ? parse_eapol_key_packet(eapol_packet) : NULL;
+    eapol_key_fields_t fields;
+    if((eapol_key_packet != NULL) && parse_eapol_key_fields(eapol_key_packet, ntohs(eapol_packet->header.packet_body_length), &fields)){
+        const uint8_t *key_end = (const uint8_t *) eapol_key_packet + ntohs(eapol_packet->header.packet_body_length);
+        if((fields.key_mic + fields.mic_length > key_end) || ((fields.key_data != NULL) && (fields.key_data + fields.key_data_length > key_end))){
+            abort();
+        }
+    }
+    pmkid_item_t *pmkid_items = (eapol_key_packet != NULL) ? parse_pmkid(eapol_key_packet, ntohs(eapol_packet->header.packet_body_length)) : NULL;
+    while(pmkid_items != NULL){
+        pmkid_item_t *next = pmkid_items->next;
+        // make sure the whole PMKID was read from the frame
+        volatile uint8_t sum = 0;
+        for(unsigned i = 0; i < sizeof(pmkid_items->pmkid); i++){
+            sum += pmkid_items->pmkid[i];
+        }
+        free(pmkid_items);
+        pmkid_items = next;
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+    uint8_t *frame = fuzz_exact_copy(data, size);
+    parse_frame(frame, size, false);
+    parse_frame(frame, size, true);
+    free(frame);
+    return 0;
+}
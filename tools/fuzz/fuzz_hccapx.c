@@ -0,0 +1,46 @@
+/**
+ * @file fuzz_hccapx.c
+ * @date 2026-10-19
+ *
+ * @brief Fuzz target of HCCAPX serializer state machine.
+ *
+ * Input is sequence of frames, each preceded by its length as 2 bytes big endian. All frames are added
+ * into one HCCAPX, as captured frames of one attack are, so the state machine sees messages of several
+ * attempts in any order. Timestamps advance by 10 ms per frame.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzz.h"
+#include "frame_analyzer_parser.h"
+#include "hccapx_serializer.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size){
+    static const uint8_t ssid[] = "fuzz";
+    hccapx_serializer_init(ssid, sizeof(ssid));
+    unsigned ts_usec = 0;
+    while(size >= 2){
+        size_t frame_size = (data[0] << 8) | data[1];
+        data += 2;
+        size -= 2;
+        if(frame_size > size){
+            frame_size = size;
+        }
+        uint8_t *frame = fuzz_exact_copy(data, frame_size);
+        frame_view_t view;
+        if(parse_frame_view(frame, frame_size, false, &view)){
+            hccapx_serializer_add_frame(frame, &view, ts_usec);
+        }
+        free(frame);
+        data += frame_size;
+        size -= frame_size;
+        ts_usec += 10000;
+    }
+    hccapx_quality_t quality;
+    hccapx_serializer_get_quality(&quality);
+    hccapx_t *hccapx = hccapx_serializer_get();
+    if((hccapx != NULL) && (hccapx->eapol_len > sizeof(hccapx->eapol))){
+        abort();
+    }
+    return 0;
+}
@@ -0,0 +1,76 @@
+/**
+ * @file fuzz_main.c
+ * @date 2026-10-19
+ *
+ * @brief Standalone driver of fuzz targets for builds without libFuzzer.
+ *
+ * Runs every file given on command line (directories are walked one level deep) through the target.
+ * Without arguments single input is read from stdin, which is how AFL runs the target.
+ */
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "fuzz.h"
+
+/**
+ * @brief Largest input that is read, longer inputs are truncated
+ */
+#define FUZZ_INPUT_MAX (1024 * 1024)
+
+static size_t read_input(FILE *file, uint8_t *buffer){
+    return fread(buffer, 1, FUZZ_INPUT_MAX, file);
+}
+
+static int run_file(const char *path, uint8_t *buffer){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        perror(path);
+        return 1;
+    }
+    size_t size = read_input(file, buffer);
+    fclose(file);
+    LLVMFuzzerTestOneInput(buffer, size);
+    return 0;
+}
+
+int main(int argc, char *argv[]){
+    uint8_t *buffer = malloc(FUZZ_INPUT_MAX);
+    if(buffer == NULL){
+        return 1;
+    }
+    if(argc < 2){
+        LLVMFuzzerTestOneInput(buffer, read_input(stdin, buffer));
+        free(buffer);
+        return 0;
+    }
+    int res = 0;
+    unsigned inputs = 0;
+    for(int i = 1; i < argc; i++){
+        struct stat st;
+        if((stat(argv[i], &st) == 0) && S_ISDIR(st.st_mode)){
+            DIR *dir = opendir(argv[i]);
+            struct dirent *entry;
+            while((dir != NULL) && ((entry = readdir(dir)) != NULL)){
+                if(entry->d_name[0] == '.'){
+                    continue;
+                }
+                char path[4096];
+                snprintf(path, sizeof(path), "%s/%s", argv[i], entry->d_name);
+                res |= run_file(path, buffer);
+                inputs++;
+            }
+            if(dir != NULL){
+                closedir(dir);
+            }
+        } else {
+            res |= run_file(argv[i], buffer);
+            inputs++;
+        }
+    }
+    printf("%s: %u inputs passed\n", argv[0], inputs);
+    free(buffer);
+    return res;
+}
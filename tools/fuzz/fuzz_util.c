@@ -0,0 +1,20 @@
+/**
+ * @file fuzz_util.c
+ * @date 2026-10-19
+ *
+ * @brief Implements helpers shared by fuzz targets
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "fuzz.h"
+
+uint8_t *fuzz_exact_copy(const uint8_t *data, size_t size){
+    // malloc(0) may return NULL, zero size allocation is still exact for sanitizers
+    uint8_t *copy = malloc((size > 0) ? size : 1);
+    if(copy == NULL){
+        abort();
+    }
+    memcpy(copy, data, size);
+    return copy;
+}
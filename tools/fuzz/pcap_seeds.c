@@ -0,0 +1,133 @@
+/**
+ * @file pcap_seeds.c
+ * @date 2026-10-19
+ *
+ * @brief Splits PCAP captures into seed inputs of fuzz targets.
+ *
+ * Every frame becomes one input of fuzz_eapol, every capture becomes one input of fuzz_hccapx
+ * (frames prefixed by their length). Radiotap headers are stripped.
+ */
+#include <libgen.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PCAP_MAGIC 0xa1b2c3d4
+#define PCAP_MAGIC_NSEC 0xa1b23c4d
+#define PCAP_LINKTYPE_IEEE802_11 105
+#define PCAP_LINKTYPE_IEEE802_11_RADIOTAP 127
+#define FRAME_MAX_SIZE 65535
+/**
+ * @brief Frames of capture that don't fit into fuzz_hccapx input of this size are left out of it
+ */
+#define SEQUENCE_MAX_SIZE 65536
+
+static uint32_t swap32(uint32_t value){
+    return ((value & 0xff) << 24) | ((value & 0xff00) << 8) | ((value >> 8) & 0xff00) | (value >> 24);
+}
+
+static int write_file(const char *path, const uint8_t *data, size_t size){
+    FILE *file = fopen(path, "wb");
+    if((file == NULL) || (fwrite(data, 1, size, file) != size)){
+        perror(path);
+        if(file != NULL){
+            fclose(file);
+        }
+        return 1;
+    }
+    fclose(file);
+    return 0;
+}
+
+/**
+ * @brief Splits one capture.
+ *
+ * @return int number of frames, -1 if capture cannot be read
+ */
+static int split(const char *path, const char *out_dir, uint8_t *frame, uint8_t *sequence){
+    FILE *file = fopen(path, "rb");
+    uint32_t header[6];
+    if((file == NULL) || (fread(header, sizeof(header), 1, file) != 1)){
+        fprintf(stderr, "%s: not a PCAP file\n", path);
+        if(file != NULL){
+            fclose(file);
+        }
+        return -1;
+    }
+    int swapped = (header[0] == swap32(PCAP_MAGIC)) || (header[0] == swap32(PCAP_MAGIC_NSEC));
+    uint32_t linktype = swapped ? swap32(header[5]) : header[5];
+    if((!swapped && (header[0] != PCAP_MAGIC) && (header[0] != PCAP_MAGIC_NSEC))
+       || ((linktype != PCAP_LINKTYPE_IEEE802_11) && (linktype != PCAP_LINKTYPE_IEEE802_11_RADIOTAP))){
+        fprintf(stderr, "%s: expected PCAP with link type 105 or 127\n", path);
+        fclose(file);
+        return -1;
+    }
+
+    char *path_copy = strdup(path);
+    char *name = basename(path_copy);
+    char *extension = strrchr(name, '.');
+    if(extension != NULL){
+        *extension = '\0';
+    }
+    size_t sequence_size = 0;
+    int frames = 0;
+    uint32_t record[4];
+    while(fread(record, sizeof(record), 1, file) == 1){
+        uint32_t incl_len = swapped ? swap32(record[2]) : record[2];
+        if((incl_len > FRAME_MAX_SIZE) || (fread(frame, 1, incl_len, file) != incl_len)){
+            fprintf(stderr, "%s: truncated\n", path);
+            break;
+        }
+        unsigned offset = 0;
+        if(linktype == PCAP_LINKTYPE_IEEE802_11_RADIOTAP){
+            offset = (incl_len >= 4) ? (uint32_t) (frame[2] | (frame[3] << 8)) : incl_len;
+            if(offset > incl_len){
+                continue;
+            }
+        }
+        unsigned size = incl_len - offset;
+        char out_path[4096];
+        snprintf(out_path, sizeof(out_path), "%s/eapol/%s-%04d", out_dir, name, frames);
+        write_file(out_path, &frame[offset], size);
+        if(sequence_size + 2 + size <= SEQUENCE_MAX_SIZE){
+            sequence[sequence_size++] = size >> 8;
+            sequence[sequence_size++] = size & 0xff;
+            memcpy(&sequence[sequence_size], &frame[offset], size);
+            sequence_size += size;
+        }
+        frames++;
+    }
+    fclose(file);
+    char out_path[4096];
+    snprintf(out_path, sizeof(out_path), "%s/hccapx/%s", out_dir, name);
+    write_file(out_path, sequence, sequence_size);
+    free(path_copy);
+    return frames;
+}
+
+int main(int argc, char *argv[]){
+    if(argc < 3){
+        fprintf(stderr, "Usage: %s OUT_DIR CAPTURE.pcap...\n"
+                        "  writes OUT_DIR/eapol/CAPTURE-N per frame and OUT_DIR/hccapx/CAPTURE per capture,\n"
+                        "  both directories have to exist\n", argv[0]);
+        return 2;
+    }
+    uint8_t *frame = malloc(FRAME_MAX_SIZE);
+    uint8_t *sequence = malloc(SEQUENCE_MAX_SIZE);
+    if((frame == NULL) || (sequence == NULL)){
+        return 2;
+    }
+    int res = 0;
+    for(int i = 2; i < argc; i++){
+        int frames = split(argv[i], argv[1], frame, sequence);
+        if(frames < 0){
+            res = 1;
+            continue;
+        }
+        printf("%s: %d frames\n", argv[i], frames);
+    }
+    free(frame);
+    free(sequence);
+    return res;
+}
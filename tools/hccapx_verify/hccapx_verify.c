@@ -0,0 +1,682 @@
+/**
+ * @file hccapx_verify.c
+ * @date 2026-10-19
+ *
+ * @brief Verifies handshakes exported by HCCAPX serializer against known passphrase on host.
+ *
+ * PCAP captures are replayed through the same hccapx_serializer.c that runs on the device,
+ * then PMK and PTK are derived from the passphrase and key MIC of the exported EAPoL is checked.
+ * This proves the exported HCCAPX is crackable without running hashcat.
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "esp_log.h"
+#include "hccapx_serializer.h"
+#include "pbkdf2_batch.h"
+#include "pcap_file.h"
+#include "sha1.h"
+#include "wpa.h"
+
+#define MANIFEST_LINE_MAX 1024
+#define MAX_RECORDS 64
+/**
+ * @brief Number of passphrases whose PMKs are derived at once
+ */
+#define WORDLIST_BATCH 4096
+
+/**
+ * @brief Addresses used in generated captures
+ */
+//@{
+static const uint8_t generated_mac_ap[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x01 };
+static const uint8_t generated_mac_sta[6] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x02 };
+//@}
+
+/**
+ * @brief Key Information values of handshake messages with HMAC-SHA1 MIC
+ *
+ * @see Ref: 802.11-2016 [12.7.6.2 - 12.7.6.5]
+ */
+static const uint16_t generated_key_information[5] = { 0, 0x008a, 0x010a, 0x13ca, 0x030a };
+#define KEY_INFORMATION_VERSION_MASK 0x0007
+
+/**
+ * @brief RSN element of generated M2, AKM suite type is the last byte before RSN Capabilities
+ */
+static const uint8_t generated_rsn_element[] = {
+    0x30, 0x14, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x04, 0x01, 0x00, 0x00, 0x0f, 0xac, 0x02, 0x00, 0x00
+};
+
+/**
+ * @brief Offsets inside generated data frame
+ */
+//@{
+#define FRAME_EAPOL_OFFSET (24 + 8)
+#define EAPOL_MIC_OFFSET 81
+#define RSN_ELEMENT_AKM_OFFSET 19
+/**
+ * @brief Number of M1s and gap between them in generated \c unanswered capture
+ */
+#define UNANSWERED_ATTEMPTS 1000
+#define UNANSWERED_GAP_US 100
+//@}
+
+static const char *TAG = "hccapx_verify";
+
+static double now_seconds(){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool has_suffix(const char *string, const char *suffix){
+    size_t string_len = strlen(string);
+    size_t suffix_len = strlen(suffix);
+    return (string_len >= suffix_len) && (strcmp(&string[string_len - suffix_len], suffix) == 0);
+}
+
+static void print_hex(const uint8_t *data, unsigned size){
+    for(unsigned i = 0; i < size; i++){
+        printf("%02x", data[i]);
+    }
+}
+
+/**
+ * @brief Loads handshake records from capture.
+ *
+ * @param path .hccapx file or PCAP capture, PCAP is replayed through HCCAPX serializer
+ * @param ssid
+ * @param records output
+ * @param max capacity of records
+ * @return int number of loaded records, -1 if file cannot be read
+ */
+static int load_records(const char *path, const char *ssid, hccapx_t *records, unsigned max){
+    if(has_suffix(path, ".hccapx")){
+        FILE *file = fopen(path, "rb");
+        if(file == NULL){
+            ESP_LOGE(TAG, "Cannot open %s", path);
+            return -1;
+        }
+        unsigned count = 0;
+        while((count < max) && (fread(&records[count], sizeof(hccapx_t), 1, file) == 1)){
+            count++;
+        }
+        fclose(file);
+        return count;
+    }
+
+    hccapx_serializer_init((const uint8_t *) ssid, strlen(ssid));
+    if(pcap_file_replay(path) < 0){
+        return -1;
+    }
+    hccapx_t *hccapx = hccapx_serializer_get();
+    if(hccapx == NULL){
+        ESP_LOGW(TAG, "No handshake found in %s", path);
+        return 0;
+    }
+    records[0] = *hccapx;
+    return 1;
+}
+
+/**
+ * @brief Verifies loaded records against PMK.
+ *
+ * @return wpa_verify_result_t WPA_VERIFY_OK if any record matches, WPA_VERIFY_UNSUPPORTED if none can be verified
+ */
+static wpa_verify_result_t verify_records(const hccapx_t *records, unsigned count, const uint8_t pmk[WPA_PMK_SIZE]){
+    wpa_verify_result_t result = WPA_VERIFY_UNSUPPORTED;
+    for(unsigned i = 0; i < count; i++){
+        wpa_verify_result_t record_result = wpa_verify_hccapx(&records[i], pmk);
+        if(record_result == WPA_VERIFY_OK){
+            return WPA_VERIFY_OK;
+        }
+        if(record_result == WPA_VERIFY_MISMATCH){
+            result = WPA_VERIFY_MISMATCH;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Verifies capture against passphrase.
+ *
+ * @param path .hccapx file or PCAP capture
+ * @param ssid
+ * @param passphrase
+ * @return wpa_verify_result_t WPA_VERIFY_UNSUPPORTED also if no handshake was found
+ */
+static wpa_verify_result_t verify_file(const char *path, const char *ssid, const char *passphrase){
+    static hccapx_t records[MAX_RECORDS];
+    int count = load_records(path, ssid, records, MAX_RECORDS);
+    if(count <= 0){
+        return WPA_VERIFY_UNSUPPORTED;
+    }
+    uint8_t pmk[WPA_PMK_SIZE];
+    wpa_pmk(passphrase, (const uint8_t *) ssid, strlen(ssid), pmk);
+    return verify_records(records, count, pmk);
+}
+
+/**
+ * @brief Derives PMK of every wordlist line in batches and verifies capture against each of them.
+ *
+ * Lines that are not valid WPA passphrases (8-63 characters) are skipped.
+ *
+ * @param wordlist_path
+ * @param path .hccapx file or PCAP capture
+ * @param ssid
+ * @param pool
+ * @return wpa_verify_result_t WPA_VERIFY_OK if passphrase was found
+ */
+static wpa_verify_result_t verify_wordlist(const char *wordlist_path, const char *path, const char *ssid, pbkdf2_pool_t *pool){
+    static hccapx_t records[MAX_RECORDS];
+    int record_count = load_records(path, ssid, records, MAX_RECORDS);
+    if(record_count <= 0){
+        return WPA_VERIFY_UNSUPPORTED;
+    }
+    FILE *wordlist = fopen(wordlist_path, "r");
+    if(wordlist == NULL){
+        ESP_LOGE(TAG, "Cannot open %s", wordlist_path);
+        return WPA_VERIFY_UNSUPPORTED;
+    }
+
+    static char words[WORDLIST_BATCH][64];
+    static const char *passphrases[WORDLIST_BATCH];
+    static uint8_t pmks[WORDLIST_BATCH][WPA_PMK_SIZE];
+    wpa_verify_result_t result = WPA_VERIFY_MISMATCH;
+    unsigned total = 0;
+    double started = now_seconds();
+    bool end = false;
+    while(!end && (result != WPA_VERIFY_OK)){
+        unsigned count = 0;
+        char line[MANIFEST_LINE_MAX];
+        while(count < WORDLIST_BATCH){
+            if(fgets(line, sizeof(line), wordlist) == NULL){
+                end = true;
+                break;
+            }
+            line[strcspn(line, "\r\n")] = '\0';
+            size_t length = strlen(line);
+            if((length < 8) || (length > 63)){
+                continue;
+            }
+            memcpy(words[count], line, length + 1);
+            passphrases[count] = words[count];
+            count++;
+        }
+        pbkdf2_pool_wpa_pmk(pool, passphrases, count, (const uint8_t *) ssid, strlen(ssid), pmks);
+        for(unsigned i = 0; i < count; i++){
+            if(verify_records(records, record_count, pmks[i]) == WPA_VERIFY_OK){
+                printf("found: %s\n", passphrases[i]);
+                result = WPA_VERIFY_OK;
+                break;
+            }
+        }
+        total += count;
+    }
+    fclose(wordlist);
+    double elapsed = now_seconds() - started;
+    printf("%u passphrases, %.3f s, %.1f PMK/s (kernel %s, threads %u)\n", total, elapsed, (elapsed > 0) ? total / elapsed : 0,
+        pbkdf2_kernel_name(pbkdf2_pool_kernel(pool)), pbkdf2_pool_threads(pool));
+    return result;
+}
+
+static const char *result_name(wpa_verify_result_t result){
+    switch(result){
+        case WPA_VERIFY_OK:
+            return "ok";
+        case WPA_VERIFY_MISMATCH:
+            return "fail";
+        default:
+            return "unsupported";
+    }
+}
+
+/**
+ * @brief Verifies all captures listed in manifest and compares results with expected ones.
+ *
+ * Each manifest line contains: capture path relative to manifest, SSID, passphrase and expected result (ok, fail or unsupported).
+ * Empty lines and lines starting with # are ignored.
+ *
+ * @param manifest_path
+ * @return int number of captures that did not give expected result, -1 if manifest cannot be read
+ */
+static int verify_corpus(const char *manifest_path){
+    FILE *manifest = fopen(manifest_path, "r");
+    if(manifest == NULL){
+        ESP_LOGE(TAG, "Cannot open %s", manifest_path);
+        return -1;
+    }
+    char directory[MANIFEST_LINE_MAX];
+    snprintf(directory, sizeof(directory), "%s", manifest_path);
+    char *slash = strrchr(directory, '/');
+    if(slash != NULL){
+        slash[1] = '\0';
+    } else {
+        directory[0] = '\0';
+    }
+
+    char line[MANIFEST_LINE_MAX];
+    unsigned total = 0;
+    int failed = 0;
+    double started = now_seconds();
+    while(fgets(line, sizeof(line), manifest) != NULL){
+        char file[MANIFEST_LINE_MAX], ssid[33], passphrase[64], expected[16];
+        if((line[0] == '#') || (sscanf(line, "%1023s %32s %63s %15s", file, ssid, passphrase, expected) != 4)){
+            continue;
+        }
+        char path[2 * MANIFEST_LINE_MAX];
+        snprintf(path, sizeof(path), "%s%s", directory, file);
+        const char *result = result_name(verify_file(path, ssid, passphrase));
+        bool passed = (strcmp(result, expected) == 0);
+        printf("%-4s %s: %s (expected %s)\n", passed ? "PASS" : "FAIL", file, result, expected);
+        failed += passed ? 0 : 1;
+        total++;
+    }
+    fclose(manifest);
+    double elapsed = now_seconds() - started;
+    printf("%u verifications, %d failed, %.3f s, %.1f verifications/s\n", total, failed, elapsed, (elapsed > 0) ? total / elapsed : 0);
+    return failed;
+}
+
+static bool check_vector(const char *name, const uint8_t *result, const char *expected_hex){
+    char result_hex[2 * 64 + 1] = { 0 };
+    unsigned size = strlen(expected_hex) / 2;
+    for(unsigned i = 0; i < size; i++){
+        sprintf(&result_hex[i * 2], "%02x", result[i]);
+    }
+    bool passed = (strcmp(result_hex, expected_hex) == 0);
+    printf("%-4s %s\n", passed ? "PASS" : "FAIL", name);
+    return passed;
+}
+
+/**
+ * @brief Checks cryptographic primitives against published test vectors.
+ *
+ * @return int number of failed vectors
+ */
+static int self_test(){
+    int failed = 0;
+    uint8_t out[64];
+
+    static const uint8_t hmac_key[20] = {
+        0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b
+    };
+    // RFC 2202, test case 1
+    hmac_sha1(hmac_key, sizeof(hmac_key), (const uint8_t *) "Hi There", 8, out);
+    failed += !check_vector("HMAC-SHA1 RFC 2202", out, "b617318655057264e28bc0b6fb378c8ef146be00");
+    // RFC 6070, test case 3
+    pbkdf2_sha1((const uint8_t *) "password", 8, (const uint8_t *) "salt", 4, 4096, out, 20);
+    failed += !check_vector("PBKDF2-HMAC-SHA1 RFC 6070", out, "4b007901b765489abead49d926f721d065a429c1");
+    // 802.11-2016 [J.3.2], test case 1
+    wpa_prf(hmac_key, sizeof(hmac_key), "prefix", (const uint8_t *) "Hi There", 8, out, 24);
+    failed += !check_vector("PRF-192 802.11 J.3", out, "bcd4c650b30b9684951829e0d75f9d54b862175ed9f00606");
+    // 802.11-2016 [J.4.2]
+    wpa_pmk("password", (const uint8_t *) "IEEE", 4, out);
+    failed += !check_vector("PSK mapping 802.11 J.4 #1", out, "f42c6fc52df0ebef9ebb4b90b38a5f902e83fe1b135a70e23aed762e9710a12e");
+    wpa_pmk("ThisIsAPassword", (const uint8_t *) "ThisIsASSID", 11, out);
+    failed += !check_vector("PSK mapping 802.11 J.4 #2", out, "0dc0d6eb90555ed6419756b9a15ec3e3209b63df707dd508d14581f8982721af");
+
+    // Batch size is not multiple of any lane count, so padding of last vector is covered too
+    static const char *const passphrases[] = {
+        "password", "ThisIsAPassword", "correct-horse-battery", "12345678", "abcdefghijklmnopqrstuvwxyz",
+        "lab-passphrase-6", "lab-passphrase-7", "lab-passphrase-8", "lab-passphrase-9", "lab-passphrase-10", "lab-passphrase-11"
+    };
+    const unsigned count = sizeof(passphrases) / sizeof(passphrases[0]);
+    uint8_t expected[sizeof(passphrases) / sizeof(passphrases[0])][WPA_PMK_SIZE];
+    for(unsigned i = 0; i < count; i++){
+        wpa_pmk(passphrases[i], (const uint8_t *) "IEEE", 4, expected[i]);
+    }
+    for(unsigned kernel = 0; kernel < PBKDF2_KERNEL_COUNT; kernel++){
+        if(!pbkdf2_kernel_supported(kernel)){
+            printf("SKIP %s kernel, not supported by CPU\n", pbkdf2_kernel_name(kernel));
+            continue;
+        }
+        pbkdf2_pool_t *pool = pbkdf2_pool_create(kernel, 2);
+        if(pool == NULL){
+            printf("FAIL %s kernel, thread pool cannot be created\n", pbkdf2_kernel_name(kernel));
+            failed++;
+            continue;
+        }
+        uint8_t pmks[sizeof(passphrases) / sizeof(passphrases[0])][WPA_PMK_SIZE];
+        pbkdf2_pool_wpa_pmk(pool, passphrases, count, (const uint8_t *) "IEEE", 4, pmks);
+        pbkdf2_pool_destroy(pool);
+        bool passed = (memcmp(pmks, expected, sizeof(expected)) == 0);
+        printf("%-4s %s kernel, %u lanes\n", passed ? "PASS" : "FAIL", pbkdf2_kernel_name(kernel), pbkdf2_kernel_lanes(kernel));
+        failed += passed ? 0 : 1;
+    }
+    return failed;
+}
+
+/**
+ * @brief Measures PMK derivation rate, which dominates verification cost.
+ *
+ * Every supported kernel (or only the selected one) is run on single thread and then on all threads.
+ *
+ * @param count number of derived PMKs per run
+ * @param kernel kernel to measure, PBKDF2_KERNEL_COUNT for all supported
+ * @param threads number of threads of second run, 0 for number of online CPUs
+ */
+static void benchmark(unsigned count, pbkdf2_kernel_t kernel, unsigned threads){
+    char (*words)[16] = malloc(count * sizeof(*words));
+    const char **passphrases = malloc(count * sizeof(*passphrases));
+    uint8_t (*pmks)[WPA_PMK_SIZE] = malloc(count * sizeof(*pmks));
+    if((words == NULL) || (passphrases == NULL) || (pmks == NULL)){
+        ESP_LOGE(TAG, "Not enough memory for %u PMKs", count);
+        free(words);
+        free(passphrases);
+        free(pmks);
+        return;
+    }
+    for(unsigned i = 0; i < count; i++){
+        snprintf(words[i], sizeof(words[i]), "passphrase%05u", i % 100000);
+        passphrases[i] = words[i];
+    }
+
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    unsigned online_cpus = (online > 0) ? online : 1;
+    printf("%-8s %7s %12s %14s\n", "kernel", "threads", "PMK/s", "PMK/s per core");
+    for(unsigned k = 0; k < PBKDF2_KERNEL_COUNT; k++){
+        if(((kernel != PBKDF2_KERNEL_COUNT) && (k != kernel)) || !pbkdf2_kernel_supported(k)){
+            continue;
+        }
+        unsigned runs[2] = { 1, threads };
+        for(unsigned run = 0; run < 2; run++){
+            pbkdf2_pool_t *pool = pbkdf2_pool_create(k, runs[run]);
+            if(pool == NULL){
+                ESP_LOGE(TAG, "Thread pool cannot be created");
+                break;
+            }
+            unsigned pool_threads = pbkdf2_pool_threads(pool);
+            if((run == 1) && (pool_threads == 1)){
+                pbkdf2_pool_destroy(pool);
+                break;
+            }
+            double started = now_seconds();
+            pbkdf2_pool_wpa_pmk(pool, passphrases, count, (const uint8_t *) "benchmark", 9, pmks);
+            double elapsed = now_seconds() - started;
+            pbkdf2_pool_destroy(pool);
+            double rate = (elapsed > 0) ? count / elapsed : 0;
+            // threads above number of CPUs only share cores
+            unsigned cores = (pool_threads < online_cpus) ? pool_threads : online_cpus;
+            printf("%-8s %7u %12.1f %14.1f\n", pbkdf2_kernel_name(k), pool_threads, rate, rate / cores);
+        }
+    }
+    free(words);
+    free(passphrases);
+    free(pmks);
+}
+
+/**
+ * @brief State of generated handshake attempt
+ */
+typedef struct {
+    uint64_t replay_counter;    ///< replay counter of M1
+    uint8_t nonce_ap[32];
+    uint8_t nonce_sta[32];
+    uint8_t kck[WPA_KCK_SIZE];
+} generated_attempt_t;
+
+static void generate_attempt(generated_attempt_t *attempt, uint64_t replay_counter, const uint8_t pmk[WPA_PMK_SIZE]){
+    attempt->replay_counter = replay_counter;
+    for(unsigned i = 0; i < 32; i++){
+        attempt->nonce_ap[i] = (uint8_t) (0xa0 + replay_counter * 7 + i * 13);
+        attempt->nonce_sta[i] = (uint8_t) (0x50 + replay_counter * 11 + i * 17);
+    }
+    wpa_kck(pmk, generated_mac_ap, generated_mac_sta, attempt->nonce_ap, attempt->nonce_sta, attempt->kck);
+}
+
+/**
+ * @brief Writes one handshake message of given attempt as IEEE 802.11 data frame.
+ *
+ * Only AKM_PSK messages carry valid MIC. Other AKMs have key descriptor version 0, so their MIC length
+ * is defined by AKM (24 bytes for AKM_PSK_SHA384), and MIC is just filler, as HCCAPX cannot carry them anyway.
+ *
+ * @param file
+ * @param attempt
+ * @param message number of handshake message (1-4)
+ * @param akm akm_suite_t announced in RSN element of M2
+ * @param ts_usec
+ */
+static void generate_message(FILE *file, const generated_attempt_t *attempt, unsigned message, uint8_t akm, uint64_t ts_usec){
+    uint8_t frame[256] = { 0 };
+    bool from_ap = (message == 1) || (message == 3);
+    // Frame Control: data frame, FromDS for AP messages, ToDS for STA messages
+    frame[0] = 0x08;
+    frame[1] = from_ap ? 0x02 : 0x01;
+    memcpy(&frame[4], from_ap ? generated_mac_sta : generated_mac_ap, 6);
+    memcpy(&frame[10], from_ap ? generated_mac_ap : generated_mac_sta, 6);
+    memcpy(&frame[16], generated_mac_ap, 6);
+    frame[22] = message << 4;
+    static const uint8_t llc_snap[8] = { 0xaa, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x88, 0x8e };
+    memcpy(&frame[24], llc_snap, sizeof(llc_snap));
+
+    uint8_t *eapol = &frame[FRAME_EAPOL_OFFSET];
+    uint8_t *key = &eapol[4];
+    uint8_t key_data[56];
+    unsigned key_data_len = 0;
+    if(message == 2){
+        memcpy(key_data, generated_rsn_element, sizeof(generated_rsn_element));
+        key_data[RSN_ELEMENT_AKM_OFFSET] = akm;
+        key_data_len = sizeof(generated_rsn_element);
+    } else if(message == 3){
+        // encrypted GTK KDE, content is irrelevant for MIC verification
+        for(unsigned i = 0; i < sizeof(key_data); i++){
+            key_data[i] = (uint8_t) (i * 31 + 5);
+        }
+        key_data_len = sizeof(key_data);
+    }
+    unsigned mic_len = (akm == AKM_PSK_SHA384) ? 24 : 16;
+    uint16_t key_information = generated_key_information[message];
+    if(akm != AKM_PSK){
+        key_information &= ~KEY_INFORMATION_VERSION_MASK;
+    }
+    uint64_t replay_counter = attempt->replay_counter + ((message >= 3) ? 1 : 0);
+
+    key[0] = 2;
+    key[1] = key_information >> 8;
+    key[2] = key_information & 0xff;
+    key[4] = from_ap ? 16 : 0;
+    for(unsigned i = 0; i < 8; i++){
+        key[5 + i] = replay_counter >> (56 - i * 8);
+    }
+    if(message != 4){
+        memcpy(&key[13], from_ap ? attempt->nonce_ap : attempt->nonce_sta, 32);
+    }
+    key[77 + mic_len] = key_data_len >> 8;
+    key[78 + mic_len] = key_data_len & 0xff;
+    memcpy(&key[79 + mic_len], key_data, key_data_len);
+
+    unsigned eapol_len = 4 + 79 + mic_len + key_data_len;
+    eapol[0] = 2;
+    eapol[1] = 3;
+    eapol[2] = (eapol_len - 4) >> 8;
+    eapol[3] = (eapol_len - 4) & 0xff;
+    if((message != 1) && (akm == AKM_PSK)){
+        wpa_mic(WPA_KEYVER_HMAC_SHA1, attempt->kck, eapol, eapol_len, &eapol[EAPOL_MIC_OFFSET]);
+    } else if(message != 1){
+        memset(&eapol[EAPOL_MIC_OFFSET], 0x5a, mic_len);
+    }
+    pcap_file_write_frame(file, frame, FRAME_EAPOL_OFFSET + eapol_len, ts_usec);
+}
+
+/**
+ * @brief Generates capture of handshake with valid MICs for given SSID and passphrase.
+ *
+ * Scenarios:
+ *  - full: M1-M4 of single attempt
+ *  - m1m2: M1 and M2 only
+ *  - retry: first attempt is restarted by AP, STA retransmits M2 of first attempt late, second attempt completes
+ *  - unanswered: M1s of UNANSWERED_ATTEMPTS attempts in quick succession, STA never replies.
+ *    Looped replay grows capture quickly without ever completing the handshake.
+ *  - sae: M1-M4 with SAE AKM, cannot be exported to HCCAPX
+ *  - sha384: M1-M4 with PSK-SHA384 AKM and 24 bytes MIC, cannot be exported to HCCAPX
+ *
+ * @param path
+ * @param ssid
+ * @param passphrase
+ * @param scenario
+ * @return true capture was written
+ * @return false unknown scenario or file cannot be created
+ */
+static bool generate(const char *path, const char *ssid, const char *passphrase, const char *scenario){
+    uint8_t pmk[WPA_PMK_SIZE];
+    wpa_pmk(passphrase, (const uint8_t *) ssid, strlen(ssid), pmk);
+    generated_attempt_t first, second;
+    generate_attempt(&first, 1, pmk);
+    generate_attempt(&second, 2, pmk);
+
+    static const struct {
+        const char *name;
+        uint8_t akm;
+        unsigned count;
+        struct {
+            uint8_t attempt;
+            uint8_t message;
+        } messages[8];
+    } scenarios[] = {
+        { "full", AKM_PSK, 4, { { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 } } },
+        { "m1m2", AKM_PSK, 2, { { 1, 1 }, { 1, 2 } } },
+        { "retry", AKM_PSK, 7, { { 1, 1 }, { 1, 2 }, { 2, 1 }, { 1, 2 }, { 2, 2 }, { 2, 3 }, { 2, 4 } } },
+        { "sae", AKM_SAE, 4, { { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 } } },
+        { "sha384", AKM_PSK_SHA384, 4, { { 1, 1 }, { 1, 2 }, { 1, 3 }, { 1, 4 } } }
+    };
+    if(strcmp(scenario, "unanswered") == 0){
+        FILE *file = pcap_file_create(path);
+        if(file == NULL){
+            return false;
+        }
+        for(unsigned j = 0; j < UNANSWERED_ATTEMPTS; j++){
+            generated_attempt_t attempt;
+            generate_attempt(&attempt, j + 1, pmk);
+            generate_message(file, &attempt, 1, AKM_PSK, 1000000 + j * UNANSWERED_GAP_US);
+        }
+        fclose(file);
+        return true;
+    }
+    for(unsigned i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++){
+        if(strcmp(scenarios[i].name, scenario) != 0){
+            continue;
+        }
+        FILE *file = pcap_file_create(path);
+        if(file == NULL){
+            return false;
+        }
+        for(unsigned j = 0; j < scenarios[i].count; j++){
+            const generated_attempt_t *attempt = (scenarios[i].messages[j].attempt == 1) ? &first : &second;
+            generate_message(file, attempt, scenarios[i].messages[j].message, scenarios[i].akm, 1000000 + j * 10000);
+        }
+        fclose(file);
+        return true;
+    }
+    ESP_LOGE(TAG, "Unknown scenario %s", scenario);
+    return false;
+}
+
+static void usage(const char *name){
+    fprintf(stderr,
+        "Usage:\n"
+        "  %s FILE SSID PASSPHRASE          verify .hccapx file or PCAP capture\n"
+        "  %s -w WORDLIST FILE SSID         find passphrase of capture in wordlist\n"
+        "  %s -c MANIFEST                   verify corpus listed in manifest\n"
+        "  %s -s                            check primitives against test vectors\n"
+        "  %s -b COUNT                      benchmark PMK derivation\n"
+        "  %s -g OUT SSID PASSPHRASE [full|m1m2|retry|unanswered|sae|sha384]\n"
+        "                                   generate PCAP capture with valid handshake\n"
+        "Options of -w and -b:\n"
+        "  -k scalar|sse2|avx2              kernel, best supported one by default\n"
+        "  -j THREADS                       worker threads, number of CPUs by default\n",
+        name, name, name, name, name, name);
+}
+
+int main(int argc, char **argv){
+    int mode = 0;
+    const char *mode_arg = NULL;
+    pbkdf2_kernel_t kernel = PBKDF2_KERNEL_COUNT;
+    unsigned threads = 0;
+    int option;
+    while((option = getopt(argc, argv, "c:sb:g:w:k:j:")) != -1){
+        switch(option){
+            case 'c':
+            case 's':
+            case 'b':
+            case 'g':
+            case 'w':
+                if(mode != 0){
+                    usage(argv[0]);
+                    return 2;
+                }
+                mode = option;
+                mode_arg = optarg;
+                break;
+            case 'k':
+                if(!pbkdf2_kernel_from_name(optarg, &kernel) || !pbkdf2_kernel_supported(kernel)){
+                    ESP_LOGE(TAG, "Kernel %s is not supported", optarg);
+                    return 2;
+                }
+                break;
+            case 'j':
+                threads = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage(argv[0]);
+                return 2;
+        }
+    }
+    int args = argc - optind;
+
+    switch(mode){
+        case 'c':
+            return (verify_corpus(mode_arg) == 0) ? 0 : 1;
+        case 's':
+            return (self_test() == 0) ? 0 : 1;
+        case 'b':
+            benchmark(strtoul(mode_arg, NULL, 10), kernel, threads);
+            return 0;
+        case 'g':
+            if((args < 2) || (args > 3)){
+                break;
+            }
+            return generate(mode_arg, argv[optind], argv[optind + 1], (args == 3) ? argv[optind + 2] : "full") ? 0 : 2;
+        case 'w': {
+            if(args != 2){
+                break;
+            }
+            pbkdf2_pool_t *pool = pbkdf2_pool_create((kernel == PBKDF2_KERNEL_COUNT) ? pbkdf2_kernel_best() : kernel, threads);
+            if(pool == NULL){
+                ESP_LOGE(TAG, "Thread pool cannot be created");
+                return 2;
+            }
+            wpa_verify_result_t result = verify_wordlist(mode_arg, argv[optind], argv[optind + 1], pool);
+            pbkdf2_pool_destroy(pool);
+            if(result == WPA_VERIFY_MISMATCH){
+                printf("not found\n");
+            }
+            return (result == WPA_VERIFY_OK) ? 0 : (result == WPA_VERIFY_MISMATCH) ? 1 : 2;
+        }
+        default: {
+            if(args != 3){
+                break;
+            }
+            const char *path = argv[optind];
+            wpa_verify_result_t result = verify_file(path, argv[optind + 1], argv[optind + 2]);
+            printf("%s\n", result_name(result));
+            if(result != WPA_VERIFY_UNSUPPORTED){
+                hccapx_quality_t quality;
+                if(!has_suffix(path, ".hccapx") && hccapx_serializer_get_quality(&quality)){
+                    printf("message pair %u, score %u, AKM %u, MIC ", quality.message_pair, quality.score, quality.akm);
+                    print_hex(hccapx_serializer_get()->keymic, WPA_MIC_SIZE);
+                    printf("\n");
+                }
+            }
+            return (result == WPA_VERIFY_OK) ? 0 : (result == WPA_VERIFY_MISMATCH) ? 1 : 2;
+        }
+    }
+    usage(argv[0]);
+    return 2;
+}
@@ -0,0 +1,382 @@
+/**
+ * @file pbkdf2_batch.c
+ * @date 2026-10-19
+ *
+ * @brief Implements batched WPA PMK derivation
+ *
+ * Kernels are generated from pbkdf2_lanes.h. SIMD kernels are compiled with target attributes,
+ * so the tool is built without -mavx2 and picks kernel at run time.
+ */
+#include "pbkdf2_batch.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "sha1.h"
+
+/**
+ * @brief One PBKDF2 block of one passphrase
+ */
+typedef struct {
+    uint32_t inner[5];  ///< HMAC inner state after key pad
+    uint32_t outer[5];  ///< HMAC outer state after key pad
+    uint32_t u[5];      ///< U1 on input
+    uint32_t t[5];      ///< derived block on output
+} pbkdf2_job_t;
+
+/**
+ * @brief Number of PBKDF2 blocks of 32-byte PMK
+ */
+#define PMK_BLOCKS 2
+
+#define VEC uint32_t
+#define LANES 1
+#define LANES_TARGET
+#define LANES_NAME(name) name##_scalar
+#define V_SET1(x) ((uint32_t) (x))
+#define V_LOAD(p) (*(p))
+#define V_STORE(p, x) (*(p) = (x))
+#define V_ADD(a, b) ((a) + (b))
+#define V_XOR(a, b) ((a) ^ (b))
+#define V_AND(a, b) ((a) & (b))
+#define V_OR(a, b) ((a) | (b))
+#define V_ANDNOT(a, b) (~(a) & (b))
+#define V_SHL(x, n) ((x) << (n))
+#define V_SHR(x, n) ((x) >> (n))
+#include "pbkdf2_lanes.h"
+#undef VEC
+#undef LANES
+#undef LANES_TARGET
+#undef LANES_NAME
+#undef V_SET1
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_XOR
+#undef V_AND
+#undef V_OR
+#undef V_ANDNOT
+#undef V_SHL
+#undef V_SHR
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PBKDF2_X86 1
+#include <immintrin.h>
+
+#define VEC __m128i
+#define LANES 4
+#define LANES_TARGET __attribute__((target("sse2")))
+#define LANES_NAME(name) name##_sse2
+#define V_SET1(x) _mm_set1_epi32((int) (x))
+#define V_LOAD(p) _mm_load_si128((const __m128i *) (p))
+#define V_STORE(p, x) _mm_store_si128((__m128i *) (p), (x))
+#define V_ADD(a, b) _mm_add_epi32((a), (b))
+#define V_XOR(a, b) _mm_xor_si128((a), (b))
+#define V_AND(a, b) _mm_and_si128((a), (b))
+#define V_OR(a, b) _mm_or_si128((a), (b))
+#define V_ANDNOT(a, b) _mm_andnot_si128((a), (b))
+#define V_SHL(x, n) _mm_slli_epi32((x), (n))
+#define V_SHR(x, n) _mm_srli_epi32((x), (n))
+#include "pbkdf2_lanes.h"
+#undef VEC
+#undef LANES
+#undef LANES_TARGET
+#undef LANES_NAME
+#undef V_SET1
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_XOR
+#undef V_AND
+#undef V_OR
+#undef V_ANDNOT
+#undef V_SHL
+#undef V_SHR
+
+#define VEC __m256i
+#define LANES 8
+#define LANES_TARGET __attribute__((target("avx2")))
+#define LANES_NAME(name) name##_avx2
+#define V_SET1(x) _mm256_set1_epi32((int) (x))
+#define V_LOAD(p) _mm256_load_si256((const __m256i *) (p))
+#define V_STORE(p, x) _mm256_store_si256((__m256i *) (p), (x))
+#define V_ADD(a, b) _mm256_add_epi32((a), (b))
+#define V_XOR(a, b) _mm256_xor_si256((a), (b))
+#define V_AND(a, b) _mm256_and_si256((a), (b))
+#define V_OR(a, b) _mm256_or_si256((a), (b))
+#define V_ANDNOT(a, b) _mm256_andnot_si256((a), (b))
+#define V_SHL(x, n) _mm256_slli_epi32((x), (n))
+#define V_SHR(x, n) _mm256_srli_epi32((x), (n))
+#include "pbkdf2_lanes.h"
+#undef VEC
+#undef LANES
+#undef LANES_TARGET
+#undef LANES_NAME
+#undef V_SET1
+#undef V_LOAD
+#undef V_STORE
+#undef V_ADD
+#undef V_XOR
+#undef V_AND
+#undef V_OR
+#undef V_ANDNOT
+#undef V_SHL
+#undef V_SHR
+#endif
+
+static const struct {
+    const char *name;
+    unsigned lanes;
+    void (*iterate)(pbkdf2_job_t *jobs, unsigned iterations);
+} kernels[PBKDF2_KERNEL_COUNT] = {
+    [PBKDF2_KERNEL_SCALAR] = { "scalar", 1, pbkdf2_iterate_scalar },
+#ifdef PBKDF2_X86
+    [PBKDF2_KERNEL_SSE2] = { "sse2", 4, pbkdf2_iterate_sse2 },
+    [PBKDF2_KERNEL_AVX2] = { "avx2", 8, pbkdf2_iterate_avx2 },
+#else
+    [PBKDF2_KERNEL_SSE2] = { "sse2", 4, NULL },
+    [PBKDF2_KERNEL_AVX2] = { "avx2", 8, NULL },
+#endif
+};
+
+/**
+ * @brief Most lanes of any kernel
+ */
+#define MAX_LANES 8
+
+struct pbkdf2_pool {
+    pbkdf2_kernel_t kernel;
+    unsigned thread_count;
+    pthread_t *threads;
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    unsigned generation;        ///< incremented for every batch, workers wait for it to change
+    unsigned busy;              ///< workers still processing current batch
+    bool stopping;
+    pbkdf2_job_t *jobs;
+    unsigned job_count;
+    unsigned next_job;          ///< index of first job not taken by any worker, accessed atomically
+};
+
+static uint32_t load_be32(const uint8_t *p){
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+static void store_be32(uint8_t *p, uint32_t value){
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+bool pbkdf2_kernel_supported(pbkdf2_kernel_t kernel){
+    switch(kernel){
+        case PBKDF2_KERNEL_SCALAR:
+            return true;
+#ifdef PBKDF2_X86
+        case PBKDF2_KERNEL_SSE2:
+            return __builtin_cpu_supports("sse2");
+        case PBKDF2_KERNEL_AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+pbkdf2_kernel_t pbkdf2_kernel_best(){
+    for(int kernel = PBKDF2_KERNEL_COUNT - 1; kernel > PBKDF2_KERNEL_SCALAR; kernel--){
+        if(pbkdf2_kernel_supported(kernel)){
+            return kernel;
+        }
+    }
+    return PBKDF2_KERNEL_SCALAR;
+}
+
+const char *pbkdf2_kernel_name(pbkdf2_kernel_t kernel){
+    return kernels[kernel].name;
+}
+
+unsigned pbkdf2_kernel_lanes(pbkdf2_kernel_t kernel){
+    return kernels[kernel].lanes;
+}
+
+bool pbkdf2_kernel_from_name(const char *name, pbkdf2_kernel_t *kernel){
+    for(unsigned i = 0; i < PBKDF2_KERNEL_COUNT; i++){
+        if(strcmp(kernels[i].name, name) == 0){
+            *kernel = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Takes jobs of current batch by groups of kernel lanes until none is left.
+ *
+ * Last group is padded by copies of its first job, so kernels always process full vectors.
+ *
+ * @param pool
+ */
+static void process_jobs(pbkdf2_pool_t *pool){
+    unsigned lanes = kernels[pool->kernel].lanes;
+    while(true){
+        unsigned first = __atomic_fetch_add(&pool->next_job, lanes, __ATOMIC_RELAXED);
+        if(first >= pool->job_count){
+            return;
+        }
+        unsigned count = pool->job_count - first;
+        if(count >= lanes){
+            kernels[pool->kernel].iterate(&pool->jobs[first], WPA_PBKDF2_ITERATIONS);
+            continue;
+        }
+        pbkdf2_job_t padded[MAX_LANES];
+        for(unsigned lane = 0; lane < lanes; lane++){
+            padded[lane] = pool->jobs[first + ((lane < count) ? lane : 0)];
+        }
+        kernels[pool->kernel].iterate(padded, WPA_PBKDF2_ITERATIONS);
+        memcpy(&pool->jobs[first], padded, count * sizeof(pbkdf2_job_t));
+    }
+}
+
+static void *worker_main(void *arg){
+    pbkdf2_pool_t *pool = arg;
+    unsigned generation = 0;
+    pthread_mutex_lock(&pool->lock);
+    while(true){
+        while((pool->generation == generation) && !pool->stopping){
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if(pool->stopping){
+            break;
+        }
+        generation = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        process_jobs(pool);
+
+        pthread_mutex_lock(&pool->lock);
+        if(--pool->busy == 0){
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+pbkdf2_pool_t *pbkdf2_pool_create(pbkdf2_kernel_t kernel, unsigned threads){
+    if(threads == 0){
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (online > 0) ? online : 1;
+    }
+    pbkdf2_pool_t *pool = calloc(1, sizeof(pbkdf2_pool_t));
+    if(pool == NULL){
+        return NULL;
+    }
+    pool->kernel = kernel;
+    pool->threads = calloc(threads, sizeof(pthread_t));
+    if(pool->threads == NULL){
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+    for(; pool->thread_count < threads; pool->thread_count++){
+        if(pthread_create(&pool->threads[pool->thread_count], NULL, worker_main, pool) != 0){
+            pbkdf2_pool_destroy(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+pbkdf2_kernel_t pbkdf2_pool_kernel(const pbkdf2_pool_t *pool){
+    return pool->kernel;
+}
+
+unsigned pbkdf2_pool_threads(const pbkdf2_pool_t *pool){
+    return pool->thread_count;
+}
+
+/**
+ * @brief Prepares both PBKDF2 blocks of passphrase. Only HMAC key pads and first iteration are computed here.
+ *
+ * @param passphrase
+ * @param ssid
+ * @param ssid_len
+ * @param jobs output, PMK_BLOCKS items
+ */
+static void prepare_jobs(const char *passphrase, const uint8_t *ssid, size_t ssid_len, pbkdf2_job_t *jobs){
+    hmac_sha1_key_t hmac_key;
+    hmac_sha1_key((const uint8_t *) passphrase, strlen(passphrase), &hmac_key);
+    for(unsigned block = 0; block < PMK_BLOCKS; block++){
+        uint8_t index[4];
+        store_be32(index, block + 1);
+        const uint8_t *parts[] = { ssid, index };
+        const size_t sizes[] = { ssid_len, sizeof(index) };
+        uint8_t u[SHA1_DIGEST_SIZE];
+        hmac_sha1_parts(&hmac_key, parts, sizes, 2, u);
+
+        pbkdf2_job_t *job = &jobs[block];
+        memcpy(job->inner, hmac_key.inner, sizeof(job->inner));
+        memcpy(job->outer, hmac_key.outer, sizeof(job->outer));
+        for(unsigned word = 0; word < 5; word++){
+            job->u[word] = load_be32(&u[word * 4]);
+            job->t[word] = job->u[word];
+        }
+    }
+}
+
+void pbkdf2_pool_wpa_pmk(pbkdf2_pool_t *pool, const char *const passphrases[], unsigned count,
+                         const uint8_t *ssid, size_t ssid_len, uint8_t (*pmks)[WPA_PMK_SIZE]){
+    pbkdf2_job_t *jobs = malloc((size_t) count * PMK_BLOCKS * sizeof(pbkdf2_job_t));
+    if(jobs == NULL){
+        abort();
+    }
+    for(unsigned i = 0; i < count; i++){
+        prepare_jobs(passphrases[i], ssid, ssid_len, &jobs[i * PMK_BLOCKS]);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->jobs = jobs;
+    pool->job_count = count * PMK_BLOCKS;
+    pool->next_job = 0;
+    pool->busy = pool->thread_count;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->work_ready);
+    while(pool->busy > 0){
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pool->jobs = NULL;
+    pthread_mutex_unlock(&pool->lock);
+
+    for(unsigned i = 0; i < count; i++){
+        uint8_t derived[PMK_BLOCKS * SHA1_DIGEST_SIZE];
+        for(unsigned block = 0; block < PMK_BLOCKS; block++){
+            for(unsigned word = 0; word < 5; word++){
+                store_be32(&derived[block * SHA1_DIGEST_SIZE + word * 4], jobs[i * PMK_BLOCKS + block].t[word]);
+            }
+        }
+        memcpy(pmks[i], derived, WPA_PMK_SIZE);
+    }
+    free(jobs);
+}
+
+void pbkdf2_pool_destroy(pbkdf2_pool_t *pool){
+    pthread_mutex_lock(&pool->lock);
+    pool->stopping = true;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+    for(unsigned i = 0; i < pool->thread_count; i++){
+        pthread_join(pool->threads[i], NULL);
+    }
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
@@ -0,0 +1,105 @@
+/**
+ * @file pbkdf2_batch.h
+ * @date 2026-10-19
+ *
+ * @brief Provides batched WPA PMK derivation using multi-buffer SHA1 kernels and a pool of worker threads
+ *
+ * PMK of every passphrase consists of two independent PBKDF2 blocks. Each block is one job
+ * and kernels process as many jobs at once as their vectors have 32-bit lanes.
+ */
+#ifndef PBKDF2_BATCH_H
+#define PBKDF2_BATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "wpa.h"
+
+/**
+ * @brief Available kernels
+ */
+typedef enum {
+    PBKDF2_KERNEL_SCALAR,   ///< 1 lane, portable C
+    PBKDF2_KERNEL_SSE2,     ///< 4 lanes, x86 only
+    PBKDF2_KERNEL_AVX2,     ///< 8 lanes, x86 only
+    PBKDF2_KERNEL_COUNT
+} pbkdf2_kernel_t;
+
+typedef struct pbkdf2_pool pbkdf2_pool_t;
+
+/**
+ * @brief Says whether kernel is built in and supported by CPU.
+ *
+ * @param kernel
+ * @return true
+ * @return false
+ */
+bool pbkdf2_kernel_supported(pbkdf2_kernel_t kernel);
+
+/**
+ * @brief Returns supported kernel with the most lanes.
+ *
+ * @return pbkdf2_kernel_t
+ */
+pbkdf2_kernel_t pbkdf2_kernel_best();
+
+const char *pbkdf2_kernel_name(pbkdf2_kernel_t kernel);
+unsigned pbkdf2_kernel_lanes(pbkdf2_kernel_t kernel);
+
+/**
+ * @brief Finds kernel by its name.
+ *
+ * @param name
+ * @param kernel output
+ * @return true kernel was found
+ * @return false unknown name
+ */
+bool pbkdf2_kernel_from_name(const char *name, pbkdf2_kernel_t *kernel);
+
+/**
+ * @brief Starts pool of worker threads.
+ *
+ * @param kernel has to be supported
+ * @param threads number of worker threads, 0 for number of online CPUs
+ * @return pbkdf2_pool_t* NULL if threads cannot be created
+ */
+pbkdf2_pool_t *pbkdf2_pool_create(pbkdf2_kernel_t kernel, unsigned threads);
+
+/**
+ * @brief Returns kernel used by the pool.
+ *
+ * @param pool
+ * @return pbkdf2_kernel_t
+ */
+pbkdf2_kernel_t pbkdf2_pool_kernel(const pbkdf2_pool_t *pool);
+
+/**
+ * @brief Returns number of worker threads of the pool.
+ *
+ * @param pool
+ * @return unsigned
+ */
+unsigned pbkdf2_pool_threads(const pbkdf2_pool_t *pool);
+
+/**
+ * @brief Derives PMKs of all passphrases, work is split among worker threads. Blocks until all PMKs are derived.
+ *
+ * @param pool
+ * @param passphrases
+ * @param count number of passphrases
+ * @param ssid
+ * @param ssid_len
+ * @param pmks output, count items
+ */
+void pbkdf2_pool_wpa_pmk(pbkdf2_pool_t *pool, const char *const passphrases[], unsigned count,
+                         const uint8_t *ssid, size_t ssid_len, uint8_t (*pmks)[WPA_PMK_SIZE]);
+
+/**
+ * @brief Stops worker threads and frees the pool.
+ *
+ * @param pool
+ */
+void pbkdf2_pool_destroy(pbkdf2_pool_t *pool);
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ * @file pbkdf2_lanes.h
+ * @date 2026-10-19
+ *
+ * @brief Multi-buffer PBKDF2-HMAC-SHA1 iteration kernel, instantiated by pbkdf2_batch.c once per instruction set.
+ *
+ * Every lane of a vector register holds one independent PBKDF2 block, so all lanes run SHA1 in lockstep.
+ * Includer defines:
+ *  - LANES number of 32-bit lanes in VEC
+ *  - VEC vector type
+ *  - V_SET1, V_LOAD, V_STORE, V_ADD, V_XOR, V_AND, V_OR, V_ANDNOT (~a & b), V_SHL, V_SHR operations
+ *  - LANES_TARGET function attribute enabling the instruction set
+ *  - LANES_NAME(name) suffixes names of generated functions
+ */
+
+#define V_ROTL(x, n) V_OR(V_SHL(x, n), V_SHR(x, 32 - (n)))
+
+#define LANES_ROUND(f, k, i) do { \
+        VEC temp_ = V_ADD(V_ADD(V_ROTL(a, 5), (f)), V_ADD(V_ADD(e, V_SET1(k)), w[(i) & 15])); \
+        e = d; \
+        d = c; \
+        c = V_ROTL(b, 30); \
+        b = a; \
+        a = temp_; \
+    } while(0)
+
+#define LANES_SCHEDULE(i) (w[(i) & 15] = V_ROTL(V_XOR(V_XOR(w[((i) - 3) & 15], w[((i) - 8) & 15]), V_XOR(w[((i) - 14) & 15], w[(i) & 15])), 1))
+
+/**
+ * @brief Compresses one 64-byte block per lane. Message schedule is computed in place in w.
+ */
+static inline LANES_TARGET void LANES_NAME(sha1_compress)(VEC state[5], VEC w[16]){
+    VEC a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    unsigned i = 0;
+    for(; i < 16; i++){
+        LANES_ROUND(V_OR(V_AND(b, c), V_ANDNOT(b, d)), 0x5a827999, i);
+    }
+    for(; i < 20; i++){
+        LANES_SCHEDULE(i);
+        LANES_ROUND(V_OR(V_AND(b, c), V_ANDNOT(b, d)), 0x5a827999, i);
+    }
+    for(; i < 40; i++){
+        LANES_SCHEDULE(i);
+        LANES_ROUND(V_XOR(V_XOR(b, c), d), 0x6ed9eba1, i);
+    }
+    for(; i < 60; i++){
+        LANES_SCHEDULE(i);
+        LANES_ROUND(V_OR(V_AND(b, c), V_AND(d, V_OR(b, c))), 0x8f1bbcdc, i);
+    }
+    for(; i < 80; i++){
+        LANES_SCHEDULE(i);
+        LANES_ROUND(V_XOR(V_XOR(b, c), d), 0xca62c1d6, i);
+    }
+    state[0] = V_ADD(state[0], a);
+    state[1] = V_ADD(state[1], b);
+    state[2] = V_ADD(state[2], c);
+    state[3] = V_ADD(state[3], d);
+    state[4] = V_ADD(state[4], e);
+}
+
+/**
+ * @brief Runs remaining PBKDF2 iterations of LANES jobs.
+ *
+ * @param jobs exactly LANES jobs with U1 and T initialised
+ * @param iterations total PBKDF2 iteration count, including the first one already done by caller
+ */
+static LANES_TARGET void LANES_NAME(pbkdf2_iterate)(pbkdf2_job_t *jobs, unsigned iterations){
+    uint32_t lanes[5][LANES] __attribute__((aligned(32)));
+    VEC inner[5], outer[5], u[5], t[5];
+    for(unsigned word = 0; word < 5; word++){
+        for(unsigned lane = 0; lane < LANES; lane++){
+            lanes[word][lane] = jobs[lane].inner[word];
+        }
+        inner[word] = V_LOAD(lanes[word]);
+        for(unsigned lane = 0; lane < LANES; lane++){
+            lanes[word][lane] = jobs[lane].outer[word];
+        }
+        outer[word] = V_LOAD(lanes[word]);
+        for(unsigned lane = 0; lane < LANES; lane++){
+            lanes[word][lane] = jobs[lane].u[word];
+        }
+        u[word] = V_LOAD(lanes[word]);
+        t[word] = u[word];
+    }
+
+    // U is 20 bytes after 64 bytes of key pad, so padding and length of both HMAC blocks never change
+    const VEC padding = V_SET1(0x80000000);
+    const VEC zero = V_SET1(0);
+    const VEC length = V_SET1((64 + 20) * 8);
+    for(unsigned iteration = 1; iteration < iterations; iteration++){
+        VEC w[16];
+        VEC state[5];
+        for(unsigned word = 0; word < 5; word++){
+            w[word] = u[word];
+            state[word] = inner[word];
+        }
+        w[5] = padding;
+        for(unsigned word = 6; word < 15; word++){
+            w[word] = zero;
+        }
+        w[15] = length;
+        LANES_NAME(sha1_compress)(state, w);
+
+        for(unsigned word = 0; word < 5; word++){
+            w[word] = state[word];
+            u[word] = outer[word];
+        }
+        w[5] = padding;
+        for(unsigned word = 6; word < 15; word++){
+            w[word] = zero;
+        }
+        w[15] = length;
+        LANES_NAME(sha1_compress)(u, w);
+
+        for(unsigned word = 0; word < 5; word++){
+            t[word] = V_XOR(t[word], u[word]);
+        }
+    }
+
+    for(unsigned word = 0; word < 5; word++){
+        V_STORE(lanes[word], t[word]);
+        for(unsigned lane = 0; lane < LANES; lane++){
+            jobs[lane].t[word] = lanes[word][lane];
+        }
+    }
+}
+
+#undef V_ROTL
+#undef LANES_ROUND
+#undef LANES_SCHEDULE
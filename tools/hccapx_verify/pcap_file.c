@@ -0,0 +1,106 @@
+/**
+ * @file pcap_file.c
+ * @date 2026-10-19
+ *
+ * @brief Implements PCAP file replay and writing
+ */
+#include "pcap_file.h"
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "esp_log.h"
+#include "frame_analyzer_parser.h"
+#include "hccapx_serializer.h"
+#include "pcap_serializer.h"
+
+#define PCAP_MAGIC 0xa1b2c3d4
+#define PCAP_MAGIC_SWAPPED 0xd4c3b2a1
+#define PCAP_SNAPLEN 65535
+
+static const char *TAG = "pcap_file";
+
+static uint32_t swap32(uint32_t value){
+    return ((value & 0xff) << 24) | ((value & 0xff00) << 8) | ((value >> 8) & 0xff00) | (value >> 24);
+}
+
+int pcap_file_replay(const char *path){
+    FILE *file = fopen(path, "rb");
+    if(file == NULL){
+        ESP_LOGE(TAG, "Cannot open %s", path);
+        return -1;
+    }
+
+    pcap_global_header_t header;
+    if(fread(&header, sizeof(header), 1, file) != 1){
+        ESP_LOGE(TAG, "%s is not a PCAP file", path);
+        fclose(file);
+        return -1;
+    }
+    bool swapped = (header.magic_number == PCAP_MAGIC_SWAPPED);
+    if(!swapped && (header.magic_number != PCAP_MAGIC)){
+        ESP_LOGE(TAG, "%s has unsupported magic number %08x", path, header.magic_number);
+        fclose(file);
+        return -1;
+    }
+    uint32_t network = swapped ? swap32(header.network) : header.network;
+    if((network != PCAP_LINKTYPE_IEEE802_11) && (network != PCAP_LINKTYPE_IEEE802_11_RADIOTAP)){
+        ESP_LOGE(TAG, "%s has unsupported link type %u", path, network);
+        fclose(file);
+        return -1;
+    }
+
+    // aligned buffer, serializer accesses frame fields through structures
+    static uint32_t packet_buffer[PCAP_SNAPLEN / sizeof(uint32_t) + 1];
+    uint8_t *packet = (uint8_t *) packet_buffer;
+    int frames = 0;
+    pcap_record_header_t record;
+    while(fread(&record, sizeof(record), 1, file) == 1){
+        uint32_t incl_len = swapped ? swap32(record.incl_len) : record.incl_len;
+        uint32_t ts_sec = swapped ? swap32(record.ts_sec) : record.ts_sec;
+        uint32_t ts_usec = swapped ? swap32(record.ts_usec) : record.ts_usec;
+        if((incl_len > PCAP_SNAPLEN) || (fread(packet, 1, incl_len, file) != incl_len)){
+            ESP_LOGW(TAG, "%s is truncated", path);
+            break;
+        }
+
+        frame_view_t view;
+        if(!parse_frame_view(packet, incl_len, network == PCAP_LINKTYPE_IEEE802_11_RADIOTAP, &view) || (view.type != FRAME_TYPE_DATA)){
+            continue;
+        }
+        hccapx_serializer_add_frame(packet, &view, (unsigned) ((uint64_t) ts_sec * 1000000 + ts_usec));
+        frames++;
+    }
+    fclose(file);
+    return frames;
+}
+
+FILE *pcap_file_create(const char *path){
+    FILE *file = fopen(path, "wb");
+    if(file == NULL){
+        ESP_LOGE(TAG, "Cannot create %s", path);
+        return NULL;
+    }
+    pcap_global_header_t header = {
+        .magic_number = PCAP_MAGIC,
+        .version_major = 2,
+        .version_minor = 4,
+        .thiszone = 0,
+        .sigfigs = 0,
+        .snaplen = PCAP_SNAPLEN,
+        .network = PCAP_LINKTYPE_IEEE802_11
+    };
+    fwrite(&header, sizeof(header), 1, file);
+    return file;
+}
+
+void pcap_file_write_frame(FILE *file, const uint8_t *frame, unsigned size, uint64_t ts_usec){
+    pcap_record_header_t record = {
+        .ts_sec = ts_usec / 1000000,
+        .ts_usec = ts_usec % 1000000,
+        .incl_len = size,
+        .orig_len = size
+    };
+    fwrite(&record, sizeof(record), 1, file);
+    fwrite(frame, 1, size, file);
+}
@@ -0,0 +1,51 @@
+/**
+ * @file pcap_file.h
+ * @date 2026-10-19
+ *
+ * @brief Provides reading of PCAP files into HCCAPX serializer and writing of synthetic PCAP files
+ */
+#ifndef PCAP_FILE_H
+#define PCAP_FILE_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * @brief Data link types that can be replayed
+ *
+ * @see Ref: https://www.tcpdump.org/linktypes.html
+ */
+//@{
+#define PCAP_LINKTYPE_IEEE802_11 105
+#define PCAP_LINKTYPE_IEEE802_11_RADIOTAP 127
+//@}
+
+/**
+ * @brief Feeds all data frames of PCAP file into HCCAPX serializer.
+ *
+ * Serializer has to be initialised by hccapx_serializer_init() before.
+ *
+ * @param path
+ * @return int number of data frames fed into serializer, -1 if file cannot be read
+ */
+int pcap_file_replay(const char *path);
+
+/**
+ * @brief Creates PCAP file with IEEE 802.11 link type.
+ *
+ * @param path
+ * @return FILE* NULL if file cannot be created
+ */
+FILE *pcap_file_create(const char *path);
+
+/**
+ * @brief Appends frame to PCAP file created by pcap_file_create().
+ *
+ * @param file
+ * @param frame
+ * @param size
+ * @param ts_usec
+ */
+void pcap_file_write_frame(FILE *file, const uint8_t *frame, unsigned size, uint64_t ts_usec);
+
+#endif
@@ -0,0 +1,208 @@
+/**
+ * @file sha1.c
+ * @date 2026-10-19
+ *
+ * @brief Implements SHA1, HMAC-SHA1 and PBKDF2-HMAC-SHA1
+ */
+#include "sha1.h"
+
+#include <string.h>
+
+#define ROTL32(x, n) (((x) << (n)) | ((x) >> (32 - (n))))
+
+static const uint32_t sha1_initial_state[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+
+static uint32_t load_be32(const uint8_t *p){
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+static void store_be32(uint8_t *p, uint32_t value){
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+void sha1_transform(uint32_t state[5], const uint8_t block[SHA1_BLOCK_SIZE]){
+    uint32_t w[80];
+    for(unsigned i = 0; i < 16; i++){
+        w[i] = load_be32(&block[i * 4]);
+    }
+    for(unsigned i = 16; i < 80; i++){
+        w[i] = ROTL32(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4];
+    for(unsigned i = 0; i < 80; i++){
+        uint32_t f, k;
+        if(i < 20){
+            f = (b & c) | (~b & d);
+            k = 0x5a827999;
+        } else if(i < 40){
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1;
+        } else if(i < 60){
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdc;
+        } else {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6;
+        }
+        uint32_t temp = ROTL32(a, 5) + f + e + k + w[i];
+        e = d;
+        d = c;
+        c = ROTL32(b, 30);
+        b = a;
+        a = temp;
+    }
+    state[0] += a;
+    state[1] += b;
+    state[2] += c;
+    state[3] += d;
+    state[4] += e;
+}
+
+void sha1_init(sha1_ctx_t *ctx){
+    memcpy(ctx->state, sha1_initial_state, sizeof(sha1_initial_state));
+    ctx->length = 0;
+    ctx->used = 0;
+}
+
+void sha1_update(sha1_ctx_t *ctx, const void *data, size_t size){
+    const uint8_t *input = data;
+    ctx->length += size;
+    while(size > 0){
+        unsigned part = SHA1_BLOCK_SIZE - ctx->used;
+        if(part > size){
+            part = size;
+        }
+        memcpy(&ctx->buffer[ctx->used], input, part);
+        ctx->used += part;
+        input += part;
+        size -= part;
+        if(ctx->used == SHA1_BLOCK_SIZE){
+            sha1_transform(ctx->state, ctx->buffer);
+            ctx->used = 0;
+        }
+    }
+}
+
+void sha1_final(sha1_ctx_t *ctx, uint8_t digest[SHA1_DIGEST_SIZE]){
+    uint64_t bit_length = ctx->length * 8;
+    static const uint8_t padding[SHA1_BLOCK_SIZE] = { 0x80 };
+    unsigned padding_size = (ctx->used < 56) ? 56 - ctx->used : 120 - ctx->used;
+    sha1_update(ctx, padding, padding_size);
+    uint8_t length[8];
+    for(unsigned i = 0; i < 8; i++){
+        length[i] = bit_length >> (56 - i * 8);
+    }
+    sha1_update(ctx, length, 8);
+    for(unsigned i = 0; i < 5; i++){
+        store_be32(&digest[i * 4], ctx->state[i]);
+    }
+}
+
+void hmac_sha1_key(const uint8_t *key, size_t key_len, hmac_sha1_key_t *hmac_key){
+    uint8_t key_block[SHA1_BLOCK_SIZE] = { 0 };
+    if(key_len > SHA1_BLOCK_SIZE){
+        sha1_ctx_t ctx;
+        sha1_init(&ctx);
+        sha1_update(&ctx, key, key_len);
+        sha1_final(&ctx, key_block);
+    } else {
+        memcpy(key_block, key, key_len);
+    }
+
+    uint8_t pad[SHA1_BLOCK_SIZE];
+    for(unsigned i = 0; i < SHA1_BLOCK_SIZE; i++){
+        pad[i] = key_block[i] ^ 0x36;
+    }
+    memcpy(hmac_key->inner, sha1_initial_state, sizeof(sha1_initial_state));
+    sha1_transform(hmac_key->inner, pad);
+    for(unsigned i = 0; i < SHA1_BLOCK_SIZE; i++){
+        pad[i] = key_block[i] ^ 0x5c;
+    }
+    memcpy(hmac_key->outer, sha1_initial_state, sizeof(sha1_initial_state));
+    sha1_transform(hmac_key->outer, pad);
+}
+
+void hmac_sha1_parts(const hmac_sha1_key_t *hmac_key, const uint8_t *const parts[], const size_t sizes[], unsigned count,
+                     uint8_t mac[SHA1_DIGEST_SIZE]){
+    sha1_ctx_t ctx;
+    memcpy(ctx.state, hmac_key->inner, sizeof(ctx.state));
+    ctx.length = SHA1_BLOCK_SIZE;
+    ctx.used = 0;
+    for(unsigned i = 0; i < count; i++){
+        sha1_update(&ctx, parts[i], sizes[i]);
+    }
+    uint8_t inner_digest[SHA1_DIGEST_SIZE];
+    sha1_final(&ctx, inner_digest);
+
+    memcpy(ctx.state, hmac_key->outer, sizeof(ctx.state));
+    ctx.length = SHA1_BLOCK_SIZE;
+    ctx.used = 0;
+    sha1_update(&ctx, inner_digest, SHA1_DIGEST_SIZE);
+    sha1_final(&ctx, mac);
+}
+
+void hmac_sha1(const uint8_t *key, size_t key_len, const uint8_t *data, size_t size, uint8_t mac[SHA1_DIGEST_SIZE]){
+    hmac_sha1_key_t hmac_key;
+    hmac_sha1_key(key, key_len, &hmac_key);
+    hmac_sha1_parts(&hmac_key, &data, &size, 1, mac);
+}
+
+/**
+ * @brief Computes HMAC-SHA1 of a single digest with prepared key.
+ *
+ * Input always fits into one padded block, so padding is built once and only compressions are run.
+ *
+ * @param hmac_key
+ * @param digest input and output
+ */
+static void hmac_sha1_digest(const hmac_sha1_key_t *hmac_key, uint8_t digest[SHA1_DIGEST_SIZE]){
+    uint8_t block[SHA1_BLOCK_SIZE] = { 0 };
+    // digest after 64 bytes of key pad, so message length is (64 + 20) * 8 bits
+    block[SHA1_DIGEST_SIZE] = 0x80;
+    block[62] = 0x02;
+    block[63] = 0xa0;
+
+    uint32_t state[5];
+    memcpy(block, digest, SHA1_DIGEST_SIZE);
+    memcpy(state, hmac_key->inner, sizeof(state));
+    sha1_transform(state, block);
+    for(unsigned i = 0; i < 5; i++){
+        store_be32(&block[i * 4], state[i]);
+    }
+    memcpy(state, hmac_key->outer, sizeof(state));
+    sha1_transform(state, block);
+    for(unsigned i = 0; i < 5; i++){
+        store_be32(&digest[i * 4], state[i]);
+    }
+}
+
+void pbkdf2_sha1(const uint8_t *password, size_t password_len, const uint8_t *salt, size_t salt_len,
+                 unsigned iterations, uint8_t *out, size_t out_len){
+    hmac_sha1_key_t hmac_key;
+    hmac_sha1_key(password, password_len, &hmac_key);
+
+    for(uint32_t block_index = 1; out_len > 0; block_index++){
+        uint8_t index[4];
+        store_be32(index, block_index);
+        const uint8_t *parts[] = { salt, index };
+        const size_t sizes[] = { salt_len, sizeof(index) };
+        uint8_t u[SHA1_DIGEST_SIZE];
+        uint8_t t[SHA1_DIGEST_SIZE];
+        hmac_sha1_parts(&hmac_key, parts, sizes, 2, u);
+        memcpy(t, u, SHA1_DIGEST_SIZE);
+        for(unsigned i = 1; i < iterations; i++){
+            hmac_sha1_digest(&hmac_key, u);
+            for(unsigned j = 0; j < SHA1_DIGEST_SIZE; j++){
+                t[j] ^= u[j];
+            }
+        }
+        size_t part = (out_len < SHA1_DIGEST_SIZE) ? out_len : SHA1_DIGEST_SIZE;
+        memcpy(out, t, part);
+        out += part;
+        out_len -= part;
+    }
+}
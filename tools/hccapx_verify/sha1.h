@@ -0,0 +1,93 @@
+/**
+ * @file sha1.h
+ * @date 2026-10-19
+ *
+ * @brief Provides SHA1, HMAC-SHA1 and PBKDF2-HMAC-SHA1 used to verify WPA handshakes on host
+ *
+ * @see Ref: RFC 3174 (SHA1), RFC 2104 (HMAC), RFC 8018 (PBKDF2)
+ */
+#ifndef SHA1_H
+#define SHA1_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA1_BLOCK_SIZE 64
+#define SHA1_DIGEST_SIZE 20
+
+typedef struct {
+    uint32_t state[5];
+    uint64_t length;                    ///< total length of hashed data in bytes
+    uint8_t buffer[SHA1_BLOCK_SIZE];
+    unsigned used;                      ///< bytes used in buffer
+} sha1_ctx_t;
+
+/**
+ * @brief Inner and outer hash state of HMAC-SHA1 after the key was absorbed.
+ *
+ * PBKDF2 reuses them for every iteration, so each iteration costs two compressions only.
+ */
+typedef struct {
+    uint32_t inner[5];
+    uint32_t outer[5];
+} hmac_sha1_key_t;
+
+/**
+ * @brief Applies SHA1 compression function on one block.
+ *
+ * @param state hash state
+ * @param block 64 bytes of input
+ */
+void sha1_transform(uint32_t state[5], const uint8_t block[SHA1_BLOCK_SIZE]);
+
+void sha1_init(sha1_ctx_t *ctx);
+void sha1_update(sha1_ctx_t *ctx, const void *data, size_t size);
+void sha1_final(sha1_ctx_t *ctx, uint8_t digest[SHA1_DIGEST_SIZE]);
+
+/**
+ * @brief Absorbs HMAC key into inner and outer hash state.
+ *
+ * @param key
+ * @param key_len
+ * @param hmac_key output
+ */
+void hmac_sha1_key(const uint8_t *key, size_t key_len, hmac_sha1_key_t *hmac_key);
+
+/**
+ * @brief Computes HMAC-SHA1 of data split into any number of parts.
+ *
+ * @param hmac_key key prepared by hmac_sha1_key()
+ * @param parts pointers to data parts
+ * @param sizes sizes of data parts
+ * @param count number of parts
+ * @param mac output
+ */
+void hmac_sha1_parts(const hmac_sha1_key_t *hmac_key, const uint8_t *const parts[], const size_t sizes[], unsigned count,
+                     uint8_t mac[SHA1_DIGEST_SIZE]);
+
+/**
+ * @brief Computes HMAC-SHA1.
+ *
+ * @param key
+ * @param key_len
+ * @param data
+ * @param size
+ * @param mac output
+ */
+void hmac_sha1(const uint8_t *key, size_t key_len, const uint8_t *data, size_t size, uint8_t mac[SHA1_DIGEST_SIZE]);
+
+/**
+ * @brief Derives key by PBKDF2-HMAC-SHA1.
+ *
+ * @param password
+ * @param password_len
+ * @param salt
+ * @param salt_len
+ * @param iterations
+ * @param out derived key
+ * @param out_len length of derived key
+ */
+void pbkdf2_sha1(const uint8_t *password, size_t password_len, const uint8_t *salt, size_t salt_len,
+                 unsigned iterations, uint8_t *out, size_t out_len);
+
+#endif
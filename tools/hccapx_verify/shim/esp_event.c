@@ -0,0 +1,21 @@
+/**
+ * @file esp_event.c
+ * @date 2026-10-19
+ *
+ * @brief Implements host shim of ESP-IDF event loop. Events are delivered synchronously.
+ */
+#include "esp_event.h"
+
+static host_event_handler_t host_handler = NULL;
+
+void host_event_set_handler(host_event_handler_t handler){
+    host_handler = handler;
+}
+
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void *event_data, size_t event_data_size, TickType_t ticks_to_wait){
+    (void) ticks_to_wait;
+    if(host_handler != NULL){
+        host_handler(event_base, event_id, event_data, event_data_size);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,33 @@
+/**
+ * @file esp_event.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF event loop. Posted events are passed to single host handler, if set.
+ */
+#ifndef ESP_EVENT_H
+#define ESP_EVENT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+typedef const char *esp_event_base_t;
+typedef uint32_t TickType_t;
+
+#define ESP_EVENT_DECLARE_BASE(id) extern esp_event_base_t const id
+#define ESP_EVENT_DEFINE_BASE(id) esp_event_base_t const id = #id
+
+/**
+ * @brief Receives every event posted by components built into host tool
+ */
+typedef void (*host_event_handler_t)(esp_event_base_t event_base, int32_t event_id, const void *event_data, size_t event_data_size);
+
+/**
+ * @brief Sets handler that receives posted events. NULL drops all events.
+ */
+void host_event_set_handler(host_event_handler_t handler);
+
+esp_err_t esp_event_post(esp_event_base_t event_base, int32_t event_id, const void *event_data, size_t event_data_size, TickType_t ticks_to_wait);
+
+#endif
@@ -0,0 +1,46 @@
+/**
+ * @file esp_log.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF logging. Messages go to stderr if HOST_LOG_LEVEL allows them.
+ */
+#ifndef ESP_LOG_H
+#define ESP_LOG_H
+
+#include <stdio.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+#ifndef HOST_LOG_LEVEL
+#define HOST_LOG_LEVEL ESP_LOG_WARN
+#endif
+
+#define ESP_LOG_LEVEL_LOCAL(level, tag, format, ...) do { \
+        if ((level) <= HOST_LOG_LEVEL) { \
+            fprintf(stderr, "%s: " format "\n", tag, ##__VA_ARGS__); \
+        } \
+    } while(0)
+
+#define ESP_LOGE(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_ERROR, tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_WARN, tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_INFO, tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_DEBUG, tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) ESP_LOG_LEVEL_LOCAL(ESP_LOG_VERBOSE, tag, format, ##__VA_ARGS__)
+
+#define ESP_LOG_BUFFER_HEXDUMP(tag, buffer, buff_len, level) do { \
+        if ((level) <= HOST_LOG_LEVEL) { \
+            for (unsigned hexdump_i_ = 0; hexdump_i_ < (unsigned) (buff_len); hexdump_i_++) { \
+                fprintf(stderr, "%02x", ((const unsigned char *) (buffer))[hexdump_i_]); \
+            } \
+            fprintf(stderr, "\n"); \
+        } \
+    } while(0)
+
+#endif
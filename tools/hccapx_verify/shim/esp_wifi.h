@@ -0,0 +1,13 @@
+/**
+ * @file esp_wifi.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF Wi-Fi header, only types and event macros are needed by frame analyzer parser
+ */
+#ifndef ESP_WIFI_H
+#define ESP_WIFI_H
+
+#include "esp_event.h"
+#include "esp_wifi_types.h"
+
+#endif
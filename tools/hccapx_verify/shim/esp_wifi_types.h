@@ -0,0 +1,24 @@
+/**
+ * @file esp_wifi_types.h
+ * @date 2026-10-19
+ *
+ * @brief Host shim of ESP-IDF Wi-Fi types used by frame analyzer
+ */
+#ifndef ESP_WIFI_TYPES_H
+#define ESP_WIFI_TYPES_H
+
+#include <stdint.h>
+
+typedef struct {
+    signed rssi:8;
+    unsigned channel:4;
+    unsigned sig_len:12;
+    unsigned timestamp:32;
+} wifi_pkt_rx_ctrl_t;
+
+typedef struct {
+    wifi_pkt_rx_ctrl_t rx_ctrl;
+    uint8_t payload[0];
+} wifi_promiscuous_pkt_t;
+
+#endif
@@ -0,0 +1,13 @@
+/**
+ * @file sdkconfig.h
+ * @date 2026-10-19
+ *
+ * @brief Host configuration of firmware components built into host tools
+ */
+#ifndef SDKCONFIG_H
+#define SDKCONFIG_H
+
+#define CONFIG_HOTPATH_LOG_LEVEL 0
+#define CONFIG_HOTPATH_LOG_SAMPLE_RATE 1
+
+#endif
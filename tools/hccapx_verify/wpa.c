@@ -0,0 +1,71 @@
+/**
+ * @file wpa.c
+ * @date 2026-10-19
+ *
+ * @brief Implements WPA/WPA2-PSK key derivation and key MIC calculation
+ */
+#include "wpa.h"
+
+#include <string.h>
+
+#include "sha1.h"
+
+static const char prf_label[] = "Pairwise key expansion";
+
+void wpa_pmk(const char *passphrase, const uint8_t *ssid, size_t ssid_len, uint8_t pmk[WPA_PMK_SIZE]){
+    pbkdf2_sha1((const uint8_t *) passphrase, strlen(passphrase), ssid, ssid_len, WPA_PBKDF2_ITERATIONS, pmk, WPA_PMK_SIZE);
+}
+
+void wpa_prf(const uint8_t *key, size_t key_len, const char *label, const uint8_t *data, size_t data_len,
+             uint8_t *out, size_t out_len){
+    // PRF-X(K, A, B) = HMAC-SHA1(K, A || 0 || B || i) for i = 0, 1, ...
+    hmac_sha1_key_t hmac_key;
+    hmac_sha1_key(key, key_len, &hmac_key);
+    static const uint8_t separator = 0;
+    for(uint8_t i = 0; out_len > 0; i++){
+        const uint8_t *parts[] = { (const uint8_t *) label, &separator, data, &i };
+        const size_t sizes[] = { strlen(label), 1, data_len, 1 };
+        uint8_t block[SHA1_DIGEST_SIZE];
+        hmac_sha1_parts(&hmac_key, parts, sizes, 4, block);
+        size_t part = (out_len < SHA1_DIGEST_SIZE) ? out_len : SHA1_DIGEST_SIZE;
+        memcpy(out, block, part);
+        out += part;
+        out_len -= part;
+    }
+}
+
+void wpa_kck(const uint8_t pmk[WPA_PMK_SIZE], const uint8_t mac_ap[6], const uint8_t mac_sta[6],
+             const uint8_t nonce_ap[32], const uint8_t nonce_sta[32], uint8_t kck[WPA_KCK_SIZE]){
+    // PRF data: min(AA,SPA) || max(AA,SPA) || min(ANonce,SNonce) || max(ANonce,SNonce)
+    uint8_t data[6 + 6 + 32 + 32];
+    bool ap_first = memcmp(mac_ap, mac_sta, 6) < 0;
+    memcpy(&data[0], ap_first ? mac_ap : mac_sta, 6);
+    memcpy(&data[6], ap_first ? mac_sta : mac_ap, 6);
+    bool nonce_ap_first = memcmp(nonce_ap, nonce_sta, 32) < 0;
+    memcpy(&data[12], nonce_ap_first ? nonce_ap : nonce_sta, 32);
+    memcpy(&data[44], nonce_ap_first ? nonce_sta : nonce_ap, 32);
+    wpa_prf(pmk, WPA_PMK_SIZE, prf_label, data, sizeof(data), kck, WPA_KCK_SIZE);
+}
+
+bool wpa_mic(uint8_t keyver, const uint8_t kck[WPA_KCK_SIZE], const uint8_t *eapol, size_t eapol_len, uint8_t mic[WPA_MIC_SIZE]){
+    if(keyver != WPA_KEYVER_HMAC_SHA1){
+        return false;
+    }
+    uint8_t digest[SHA1_DIGEST_SIZE];
+    hmac_sha1(kck, WPA_KCK_SIZE, eapol, eapol_len, digest);
+    memcpy(mic, digest, WPA_MIC_SIZE);
+    return true;
+}
+
+wpa_verify_result_t wpa_verify_hccapx(const hccapx_t *hccapx, const uint8_t pmk[WPA_PMK_SIZE]){
+    if(hccapx->eapol_len > sizeof(hccapx->eapol)){
+        return WPA_VERIFY_UNSUPPORTED;
+    }
+    uint8_t kck[WPA_KCK_SIZE];
+    wpa_kck(pmk, hccapx->mac_ap, hccapx->mac_sta, hccapx->nonce_ap, hccapx->nonce_sta, kck);
+    uint8_t mic[WPA_MIC_SIZE];
+    if(!wpa_mic(hccapx->keyver, kck, hccapx->eapol, hccapx->eapol_len, mic)){
+        return WPA_VERIFY_UNSUPPORTED;
+    }
+    return (memcmp(mic, hccapx->keymic, WPA_MIC_SIZE) == 0) ? WPA_VERIFY_OK : WPA_VERIFY_MISMATCH;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file wpa.h
+ * @date 2026-10-19
+ *
+ * @brief Provides WPA/WPA2-PSK key derivation and key MIC calculation
+ *
+ * @see Ref: 802.11-2016 [12.7.1.2 PRF, 12.7.1.3 Pairwise key hierarchy, J.4 PSK mapping]
+ */
+#ifndef WPA_H
+#define WPA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "hccapx_serializer.h"
+
+#define WPA_PMK_SIZE 32
+#define WPA_KCK_SIZE 16
+#define WPA_MIC_SIZE 16
+#define WPA_PBKDF2_ITERATIONS 4096
+
+/**
+ * @brief Key descriptor versions that can be verified
+ */
+#define WPA_KEYVER_HMAC_SHA1 2
+
+/**
+ * @brief Result of HCCAPX verification
+ */
+typedef enum {
+    WPA_VERIFY_OK,          ///< MIC calculated from passphrase matches captured MIC
+    WPA_VERIFY_MISMATCH,    ///< MIC does not match, passphrase is wrong or handshake is not coherent
+    WPA_VERIFY_UNSUPPORTED  ///< key descriptor version or EAPoL length cannot be verified
+} wpa_verify_result_t;
+
+/**
+ * @brief Derives PMK from passphrase and SSID.
+ *
+ * @param passphrase 8-63 characters
+ * @param ssid
+ * @param ssid_len
+ * @param pmk output
+ */
+void wpa_pmk(const char *passphrase, const uint8_t *ssid, size_t ssid_len, uint8_t pmk[WPA_PMK_SIZE]);
+
+/**
+ * @brief Calculates PRF-X based on HMAC-SHA1.
+ *
+ * @param key
+ * @param key_len
+ * @param label
+ * @param data
+ * @param data_len
+ * @param out output
+ * @param out_len X / 8
+ */
+void wpa_prf(const uint8_t *key, size_t key_len, const char *label, const uint8_t *data, size_t data_len,
+             uint8_t *out, size_t out_len);
+
+/**
+ * @brief Derives KCK part of PTK from PMK, addresses and nonces.
+ *
+ * Only first block of PRF-512 is needed to verify MIC, so other keys of PTK are not derived.
+ *
+ * @param pmk
+ * @param mac_ap
+ * @param mac_sta
+ * @param nonce_ap
+ * @param nonce_sta
+ * @param kck output
+ */
+void wpa_kck(const uint8_t pmk[WPA_PMK_SIZE], const uint8_t mac_ap[6], const uint8_t mac_sta[6],
+             const uint8_t nonce_ap[32], const uint8_t nonce_sta[32], uint8_t kck[WPA_KCK_SIZE]);
+
+/**
+ * @brief Calculates key MIC of EAPoL packet.
+ *
+ * @param keyver key descriptor version, only WPA_KEYVER_HMAC_SHA1 is supported
+ * @param kck
+ * @param eapol EAPoL packet with cleared MIC field
+ * @param eapol_len
+ * @param mic output
+ * @return true MIC was calculated
+ * @return false keyver is not supported
+ */
+bool wpa_mic(uint8_t keyver, const uint8_t kck[WPA_KCK_SIZE], const uint8_t *eapol, size_t eapol_len, uint8_t mic[WPA_MIC_SIZE]);
+
+/**
+ * @brief Verifies HCCAPX record against PMK.
+ *
+ * @param hccapx
+ * @param pmk
+ * @return wpa_verify_result_t
+ */
+wpa_verify_result_t wpa_verify_hccapx(const hccapx_t *hccapx, const uint8_t pmk[WPA_PMK_SIZE]);
+
+#endif
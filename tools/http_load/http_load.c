@@ -0,0 +1,624 @@
+/**
+ * @file http_load.c
+ * @date 2026-10-19
+ *
+ * @brief Load test of webserver endpoints with many concurrent HTTP clients.
+ *
+ * Every client is a thread sending GET requests to given paths in turn, over keep-alive connection
+ * or new connection per request. Latency is measured from sending the request until the last byte
+ * of the body is received. Server heap is sampled from \c /heap endpoint before and after the run.
+ */
+#include <errno.h>
+#include <math.h>
+#include <netdb.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mem_alloc.h"
+#include "webserver.h"
+
+#define MAX_PATHS 16
+#define MAX_ACCEPTED_STATUSES 8
+#define HEADER_MAX 4096
+#define RECV_BUFFER_SIZE 16384
+#define DEFAULT_CLIENTS 8
+#define DEFAULT_DURATION_S 10
+#define DEFAULT_TIMEOUT_S 30
+
+/**
+ * @brief Reasons of failed request
+ */
+typedef enum {
+    FAILURE_CONNECT,    ///< connection refused or reset before request was sent
+    FAILURE_IO,         ///< connection closed or timed out while response was received
+    FAILURE_PROTOCOL,   ///< malformed response
+    FAILURE_STATUS,     ///< response status is neither 2xx nor accepted by -a
+    FAILURE_COUNT
+} failure_t;
+
+static const char *failure_names[FAILURE_COUNT] = {
+    [FAILURE_CONNECT] = "connect",
+    [FAILURE_IO] = "io",
+    [FAILURE_PROTOCOL] = "protocol",
+    [FAILURE_STATUS] = "status"
+};
+
+static const char *category_names[MEM_CATEGORY_MAX] = {
+    [MEM_CATEGORY_CAPTURE] = "capture",
+    [MEM_CATEGORY_AP_TABLE] = "ap_table",
+    [MEM_CATEGORY_HISTORY] = "history",
+    [MEM_CATEGORY_DISPLAY] = "display",
+    [MEM_CATEGORY_DMA] = "dma",
+    [MEM_CATEGORY_INTERNAL] = "internal"
+};
+
+/**
+ * @brief Results of one path, collected by every client separately and merged after the run
+ */
+typedef struct {
+    uint32_t *latencies_us;     ///< latencies of successful requests
+    unsigned count;
+    unsigned capacity;
+    unsigned failures[FAILURE_COUNT];
+    uint64_t bytes;             ///< body bytes of successful requests
+    uint64_t max_bytes;         ///< largest body
+} path_stats_t;
+
+typedef struct {
+    pthread_t thread;
+    unsigned index;
+    int fd;                     ///< kept open between requests in keep-alive mode, -1 if closed
+    unsigned reconnects;        ///< keep-alive connections closed by server and reopened
+    path_stats_t paths[MAX_PATHS];
+    uint8_t buffer[RECV_BUFFER_SIZE];
+} client_t;
+
+typedef struct {
+    webserver_heap_header_t header;
+    webserver_heap_category_t categories[MEM_CATEGORY_MAX];
+} heap_sample_t;
+
+static struct addrinfo *server_address = NULL;
+static const char *host = NULL;
+static const char *paths[MAX_PATHS];
+static unsigned path_count = 0;
+static unsigned accepted_statuses[MAX_ACCEPTED_STATUSES];
+static unsigned accepted_status_count = 0;
+static bool keep_alive = false;
+static unsigned timeout_s = DEFAULT_TIMEOUT_S;
+static int64_t deadline_us = 0;
+static long requests_left = -1;     ///< -1 if run is limited by duration
+static pthread_mutex_t requests_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static int64_t now_us(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int server_connect(void){
+    int fd = socket(server_address->ai_family, server_address->ai_socktype, server_address->ai_protocol);
+    if(fd < 0){
+        return -1;
+    }
+    struct timeval timeout = { .tv_sec = timeout_s };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+    if(connect(fd, server_address->ai_addr, server_address->ai_addrlen) != 0){
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static bool send_all(int fd, const char *data, size_t size){
+    while(size > 0){
+        ssize_t sent = send(fd, data, size, MSG_NOSIGNAL);
+        if(sent <= 0){
+            return false;
+        }
+        data += sent;
+        size -= sent;
+    }
+    return true;
+}
+
+/**
+ * @brief Buffered reader of one response
+ */
+typedef struct {
+    int fd;
+    uint8_t *buffer;
+    size_t head;
+    size_t tail;
+    uint64_t received;          ///< all bytes received from socket
+} reader_t;
+
+static bool reader_fill(reader_t *reader){
+    if(reader->head == reader->tail){
+        reader->head = reader->tail = 0;
+    }
+    if(reader->tail == RECV_BUFFER_SIZE){
+        return false;
+    }
+    ssize_t received = recv(reader->fd, &reader->buffer[reader->tail], RECV_BUFFER_SIZE - reader->tail, 0);
+    if(received <= 0){
+        return false;
+    }
+    reader->tail += received;
+    reader->received += received;
+    return true;
+}
+
+/**
+ * @brief Reads line terminated by CRLF, at most size - 1 characters.
+ */
+static bool reader_line(reader_t *reader, char *line, size_t size){
+    size_t length = 0;
+    while(true){
+        while(reader->head < reader->tail){
+            char c = reader->buffer[reader->head++];
+            if(c == '\n'){
+                if((length > 0) && (line[length - 1] == '\r')){
+                    length--;
+                }
+                line[length] = '\0';
+                return true;
+            }
+            if(length + 1 >= size){
+                return false;
+            }
+            line[length++] = c;
+        }
+        if(!reader_fill(reader)){
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Reads and discards given number of body bytes.
+ */
+static bool reader_skip(reader_t *reader, uint64_t size){
+    while(size > 0){
+        if((reader->head == reader->tail) && !reader_fill(reader)){
+            return false;
+        }
+        size_t available = reader->tail - reader->head;
+        size_t skipped = (available < size) ? available : size;
+        reader->head += skipped;
+        size -= skipped;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads rest of the connection until server closes it.
+ */
+static uint64_t reader_drain(reader_t *reader){
+    uint64_t size = reader->tail - reader->head;
+    reader->head = reader->tail;
+    while(reader_fill(reader)){
+        size += reader->tail - reader->head;
+        reader->head = reader->tail;
+    }
+    return size;
+}
+
+/**
+ * @brief Reads response, body is discarded.
+ *
+ * @param reader
+ * @param status output, HTTP status code
+ * @param body_size output
+ * @param closed output, server closes connection after this response
+ * @return failure_t FAILURE_COUNT on success
+ */
+static failure_t read_response(reader_t *reader, unsigned *status, uint64_t *body_size, bool *closed){
+    char line[HEADER_MAX];
+    if(!reader_line(reader, line, sizeof(line))){
+        return FAILURE_IO;
+    }
+    if(sscanf(line, "HTTP/1.%*u %u", status) != 1){
+        return FAILURE_PROTOCOL;
+    }
+    int64_t content_length = -1;
+    bool chunked = false;
+    *closed = false;
+    while(true){
+        if(!reader_line(reader, line, sizeof(line))){
+            return FAILURE_IO;
+        }
+        if(line[0] == '\0'){
+            break;
+        }
+        char *value = strchr(line, ':');
+        if(value == NULL){
+            return FAILURE_PROTOCOL;
+        }
+        *value++ = '\0';
+        value += strspn(value, " \t");
+        if(strcasecmp(line, "Content-Length") == 0){
+            content_length = strtoll(value, NULL, 10);
+        } else if((strcasecmp(line, "Transfer-Encoding") == 0) && (strcasecmp(value, "chunked") == 0)){
+            chunked = true;
+        } else if((strcasecmp(line, "Connection") == 0) && (strcasecmp(value, "close") == 0)){
+            *closed = true;
+        }
+    }
+
+    *body_size = 0;
+    if(chunked){
+        while(true){
+            if(!reader_line(reader, line, sizeof(line))){
+                return FAILURE_IO;
+            }
+            char *end;
+            uint64_t chunk_size = strtoull(line, &end, 16);
+            if(end == line){
+                return FAILURE_PROTOCOL;
+            }
+            if(chunk_size == 0){
+                // no trailers are expected, only empty line
+                return reader_line(reader, line, sizeof(line)) ? FAILURE_COUNT : FAILURE_IO;
+            }
+            if(!reader_skip(reader, chunk_size) || !reader_line(reader, line, sizeof(line))){
+                return FAILURE_IO;
+            }
+            *body_size += chunk_size;
+        }
+    }
+    if(content_length >= 0){
+        *body_size = content_length;
+        return reader_skip(reader, content_length) ? FAILURE_COUNT : FAILURE_IO;
+    }
+    *body_size = reader_drain(reader);
+    *closed = true;
+    return FAILURE_COUNT;
+}
+
+static bool status_accepted(unsigned status){
+    if((status >= 200) && (status <= 299)){
+        return true;
+    }
+    for(unsigned i = 0; i < accepted_status_count; i++){
+        if(accepted_statuses[i] == status){
+            return true;
+        }
+    }
+    return false;
+}
+
+static void path_stats_add(path_stats_t *stats, uint32_t latency_us, uint64_t bytes){
+    if(stats->count == stats->capacity){
+        stats->capacity = (stats->capacity == 0) ? 1024 : stats->capacity * 2;
+        stats->latencies_us = realloc(stats->latencies_us, stats->capacity * sizeof(uint32_t));
+        if(stats->latencies_us == NULL){
+            fprintf(stderr, "Out of memory\n");
+            exit(2);
+        }
+    }
+    stats->latencies_us[stats->count++] = latency_us;
+    stats->bytes += bytes;
+    if(bytes > stats->max_bytes){
+        stats->max_bytes = bytes;
+    }
+}
+
+/**
+ * @brief Sends one request and reads its response.
+ *
+ * Idle keep-alive connection may have been closed by server meanwhile (LRU purge, receive timeout),
+ * request is then repeated once on new connection.
+ */
+static void client_request(client_t *client, unsigned path_index){
+    char request[512];
+    int request_size = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s\r\n%s\r\n",
+                                paths[path_index], host, keep_alive ? "" : "Connection: close\r\n");
+    path_stats_t *stats = &client->paths[path_index];
+    int64_t start = now_us();
+    for(unsigned attempt = 0; attempt < 2; attempt++){
+        bool reused = client->fd >= 0;
+        if(!reused){
+            client->fd = server_connect();
+            if(client->fd < 0){
+                stats->failures[FAILURE_CONNECT]++;
+                return;
+            }
+        }
+        reader_t reader = { .fd = client->fd, .buffer = client->buffer };
+        unsigned status = 0;
+        uint64_t body_size = 0;
+        bool closed = true;
+        failure_t failure = FAILURE_IO;
+        if(send_all(client->fd, request, request_size)){
+            failure = read_response(&reader, &status, &body_size, &closed);
+        }
+        if((failure != FAILURE_COUNT) || closed || !keep_alive){
+            close(client->fd);
+            client->fd = -1;
+        }
+        if((failure == FAILURE_IO) && reused && (reader.received == 0)){
+            client->reconnects++;
+            start = now_us();
+            continue;
+        }
+        if((failure == FAILURE_COUNT) && !status_accepted(status)){
+            failure = FAILURE_STATUS;
+        }
+        if(failure != FAILURE_COUNT){
+            stats->failures[failure]++;
+            return;
+        }
+        path_stats_add(stats, (uint32_t) (now_us() - start), body_size);
+        return;
+    }
+}
+
+static bool take_request(void){
+    if(requests_left < 0){
+        return now_us() < deadline_us;
+    }
+    pthread_mutex_lock(&requests_lock);
+    bool take = requests_left > 0;
+    if(take){
+        requests_left--;
+    }
+    pthread_mutex_unlock(&requests_lock);
+    return take;
+}
+
+static void *client_thread(void *arg){
+    client_t *client = (client_t *) arg;
+    // clients start at different paths, so all paths are requested concurrently
+    unsigned next = client->index % path_count;
+    while(take_request()){
+        client_request(client, next);
+        next = (next + 1) % path_count;
+    }
+    if(client->fd >= 0){
+        close(client->fd);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Downloads server heap statistics from \c /heap endpoint.
+ *
+ * @return true statistics of all known categories were received
+ */
+static bool heap_sample(heap_sample_t *sample){
+    int fd = server_connect();
+    if(fd < 0){
+        return false;
+    }
+    char request[256];
+    int request_size = snprintf(request, sizeof(request), "GET /heap HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n\r\n", host);
+    uint8_t *buffer = malloc(RECV_BUFFER_SIZE);
+    reader_t reader = { .fd = fd, .buffer = buffer };
+    bool valid = false;
+    char line[HEADER_MAX];
+    unsigned status;
+    if((buffer != NULL) && send_all(fd, request, request_size) && reader_line(&reader, line, sizeof(line))
+       && (sscanf(line, "HTTP/1.%*u %u", &status) == 1) && (status == 200)){
+        // skip headers, body is short and server closes connection after it
+        while(reader_line(&reader, line, sizeof(line)) && (line[0] != '\0')){
+        }
+        size_t size = reader.tail - reader.head;
+        while((size < sizeof(heap_sample_t)) && reader_fill(&reader)){
+            size = reader.tail - reader.head;
+        }
+        if(size >= sizeof(webserver_heap_header_t)){
+            memset(sample, 0, sizeof(heap_sample_t));
+            memcpy(sample, &buffer[reader.head], (size < sizeof(heap_sample_t)) ? size : sizeof(heap_sample_t));
+            valid = sample->header.category_count >= MEM_CATEGORY_MAX;
+        }
+    }
+    free(buffer);
+    close(fd);
+    return valid;
+}
+
+static int compare_u32(const void *a, const void *b){
+    uint32_t x = *(const uint32_t *) a;
+    uint32_t y = *(const uint32_t *) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Nearest-rank percentile of sorted values in milliseconds
+ */
+static double percentile_ms(const uint32_t *sorted, unsigned count, double percentile){
+    if(count == 0){
+        return 0;
+    }
+    unsigned rank = (unsigned) ceil(percentile / 100 * count);
+    return sorted[(rank > 0) ? rank - 1 : 0] / 1000.0;
+}
+
+static void print_row(const char *name, path_stats_t *stats, double elapsed_s){
+    unsigned failures = 0;
+    for(unsigned i = 0; i < FAILURE_COUNT; i++){
+        failures += stats->failures[i];
+    }
+    qsort(stats->latencies_us, stats->count, sizeof(uint32_t), compare_u32);
+    printf("%-16s %8u %7u %9.1f %9.1f %9.1f %9.1f %9.1f %8.2f\n", name, stats->count, failures,
+           percentile_ms(stats->latencies_us, stats->count, 50),
+           percentile_ms(stats->latencies_us, stats->count, 90),
+           percentile_ms(stats->latencies_us, stats->count, 99),
+           (stats->count > 0) ? stats->latencies_us[stats->count - 1] / 1000.0 : 0,
+           stats->count / elapsed_s, stats->bytes / elapsed_s / 1e6);
+}
+
+static void merge_stats(path_stats_t *to, const path_stats_t *from){
+    for(unsigned i = 0; i < from->count; i++){
+        path_stats_add(to, from->latencies_us[i], 0);
+    }
+    to->bytes += from->bytes;
+    if(from->max_bytes > to->max_bytes){
+        to->max_bytes = from->max_bytes;
+    }
+    for(unsigned i = 0; i < FAILURE_COUNT; i++){
+        to->failures[i] += from->failures[i];
+    }
+}
+
+static void print_heap(const heap_sample_t *before, const heap_sample_t *after){
+    printf("\nServer heap      %12s %12s %12s %9s\n", "before", "after", "peak", "failures");
+    for(unsigned i = 0; i < MEM_CATEGORY_MAX; i++){
+        const webserver_heap_category_t *b = &before->categories[i];
+        const webserver_heap_category_t *a = &after->categories[i];
+        printf("%-16s %12u %12u %12u %9u\n", category_names[i], b->in_use, a->in_use, a->peak, a->failures - b->failures);
+    }
+    printf("free internal    %12u %12u %12u (minimum)\n", before->header.free_internal, after->header.free_internal,
+           after->header.minimum_free_internal);
+    printf("largest block    %12u %12u\n", before->header.largest_free_internal, after->header.largest_free_internal);
+    printf("free PSRAM       %12u %12u\n", before->header.free_spiram, after->header.free_spiram);
+}
+
+static void usage(const char *name){
+    fprintf(stderr,
+        "Usage: %s [-c CLIENTS] [-d SECONDS | -n REQUESTS] [-k] [-t TIMEOUT] [-a STATUS]... HOST:PORT PATH...\n"
+        "  -c CLIENTS  concurrent clients, default %u\n"
+        "  -d SECONDS  duration of the run, default %u\n"
+        "  -n REQUESTS total number of requests instead of duration\n"
+        "  -k          keep connections alive between requests\n"
+        "  -t TIMEOUT  socket timeout in seconds, default %u\n"
+        "  -a STATUS   count responses with this status as successful besides 2xx, can be repeated\n"
+        "Exit code is 0 if all requests succeeded, 1 if some failed and 2 on usage or connection error.\n",
+        name, DEFAULT_CLIENTS, DEFAULT_DURATION_S, DEFAULT_TIMEOUT_S);
+}
+
+int main(int argc, char *argv[]){
+    unsigned client_count = DEFAULT_CLIENTS;
+    unsigned duration_s = DEFAULT_DURATION_S;
+    int opt;
+    while((opt = getopt(argc, argv, "c:d:n:kt:a:h")) != -1){
+        switch(opt){
+            case 'c':
+                client_count = strtoul(optarg, NULL, 10);
+                break;
+            case 'd':
+                duration_s = strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                requests_left = strtol(optarg, NULL, 10);
+                break;
+            case 'k':
+                keep_alive = true;
+                break;
+            case 't':
+                timeout_s = strtoul(optarg, NULL, 10);
+                break;
+            case 'a':
+                if(accepted_status_count == MAX_ACCEPTED_STATUSES){
+                    usage(argv[0]);
+                    return 2;
+                }
+                accepted_statuses[accepted_status_count++] = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage(argv[0]);
+                return (opt == 'h') ? 0 : 2;
+        }
+    }
+    if((client_count == 0) || (duration_s == 0) || (requests_left == 0) || (timeout_s == 0)
+       || (argc - optind < 2) || (argc - optind - 1 > MAX_PATHS)){
+        usage(argv[0]);
+        return 2;
+    }
+    host = argv[optind++];
+    for(; optind < argc; optind++){
+        paths[path_count++] = argv[optind];
+    }
+
+    char *address = strdup(host);
+    char *port = strrchr(address, ':');
+    if(port == NULL){
+        usage(argv[0]);
+        return 2;
+    }
+    *port++ = '\0';
+    struct addrinfo hints = { .ai_family = AF_UNSPEC, .ai_socktype = SOCK_STREAM };
+    int err = getaddrinfo(address, port, &hints, &server_address);
+    if(err != 0){
+        fprintf(stderr, "%s: %s\n", host, gai_strerror(err));
+        return 2;
+    }
+
+    heap_sample_t heap_before, heap_after;
+    bool heap_available = heap_sample(&heap_before);
+
+    client_t *clients = calloc(client_count, sizeof(client_t));
+    if(clients == NULL){
+        fprintf(stderr, "Out of memory\n");
+        return 2;
+    }
+    int64_t start = now_us();
+    deadline_us = start + (int64_t) duration_s * 1000000;
+    for(unsigned i = 0; i < client_count; i++){
+        clients[i].index = i;
+        clients[i].fd = -1;
+        if(pthread_create(&clients[i].thread, NULL, client_thread, &clients[i]) != 0){
+            fprintf(stderr, "Cannot start client thread\n");
+            return 2;
+        }
+    }
+    for(unsigned i = 0; i < client_count; i++){
+        pthread_join(clients[i].thread, NULL);
+    }
+    double elapsed_s = (now_us() - start) / 1e6;
+    heap_available = heap_available && heap_sample(&heap_after);
+
+    printf("%u clients, %s, %.1f s\n\n", client_count, keep_alive ? "keep-alive" : "connection per request", elapsed_s);
+    printf("%-16s %8s %7s %9s %9s %9s %9s %9s %8s\n", "path", "requests", "errors", "p50 ms", "p90 ms", "p99 ms",
+           "max ms", "req/s", "MB/s");
+    path_stats_t total = { 0 };
+    unsigned reconnects = 0;
+    for(unsigned p = 0; p < path_count; p++){
+        path_stats_t merged = { 0 };
+        for(unsigned i = 0; i < client_count; i++){
+            merge_stats(&merged, &clients[i].paths[p]);
+            free(clients[i].paths[p].latencies_us);
+        }
+        merge_stats(&total, &merged);
+        print_row(paths[p], &merged, elapsed_s);
+        free(merged.latencies_us);
+    }
+    for(unsigned i = 0; i < client_count; i++){
+        reconnects += clients[i].reconnects;
+    }
+    print_row("total", &total, elapsed_s);
+
+    unsigned failures = 0;
+    printf("\nerrors:");
+    for(unsigned i = 0; i < FAILURE_COUNT; i++){
+        printf(" %s %u", failure_names[i], total.failures[i]);
+        failures += total.failures[i];
+    }
+    printf(", largest body %llu B", (unsigned long long) total.max_bytes);
+    if(keep_alive){
+        printf(", %u keep-alive connections reopened", reconnects);
+    }
+    printf("\n");
+    free(total.latencies_us);
+
+    if(heap_available){
+        print_heap(&heap_before, &heap_after);
+    } else {
+        printf("\nServer heap statistics are not available\n");
+    }
+    freeaddrinfo(server_address);
+    free(address);
+    free(clients);
+    return (failures > 0) ? 1 : 0;
+}
@@ -0,0 +1,62 @@
+#!/bin/sh
+# Load test of simulator: grows multi-MB capture by passive handshake attack that never completes,
+# then drives concurrent clients against status, AP list and capture downloads.
+set -eu
+
+cd "$(dirname "$0")"
+SIM=../../sim
+VERIFY=../hccapx_verify/hccapx_verify
+PORT=${SIM_PORT:-18081}
+URL=http://127.0.0.1:$PORT
+CLIENTS=${LOAD_CLIENTS:-16}
+DURATION=${LOAD_DURATION:-5}
+WORK=$(mktemp -d)
+SIM_PID=
+
+cleanup() {
+    if [ -n "$SIM_PID" ]; then
+        kill "$SIM_PID" 2>/dev/null || true
+        wait "$SIM_PID" 2>/dev/null || true
+    fi
+    rm -rf "$WORK"
+}
+trap cleanup EXIT
+
+fail() {
+    echo "FAIL: $*"
+    echo "--- simulator log ---"
+    grep -v "Status content is full" "$WORK/sim.log" | tail -50
+    exit 1
+}
+
+"$VERIFY" -g "$WORK/unanswered.pcap" corpus-ap correct-horse-battery unanswered > /dev/null
+"$SIM/sim" -p "$PORT" -s "$SIM/corpus/scan.txt" -f "$WORK/unanswered.pcap" -l -C "$WORK" -v 1 > "$WORK/sim.log" 2>&1 &
+SIM_PID=$!
+for i in $(seq 50); do
+    curl -s -o /dev/null "$URL/ap-list" && break
+    sleep 0.1
+done
+
+# version 1, handshake attack, passive method, 8 s timeout, AP 0
+printf '\001\001\002\010\001\000' > "$WORK/request"
+[ "$(curl -s -o /dev/null -w '%{http_code}' --data-binary @"$WORK/request" "$URL/run-attack")" = 200 ] || fail "POST /run-attack"
+
+# state byte of /status: 0 READY, 1 RUNNING, 2 FINISHED, 3 TIMEOUT
+state=
+for i in $(seq 100); do
+    state=$(curl -sf "$URL/status" | od -An -tu1 -N1 | tr -d ' ')
+    [ "$state" = 1 ] || break
+    sleep 0.1
+done
+[ "$state" = 3 ] || fail "attack ended in state $state, expected TIMEOUT"
+
+size=$(curl -sf -o /dev/null -w '%{size_download}' "$URL/capture.pcap") || fail "GET /capture.pcap"
+[ "$size" -ge 1000000 ] || fail "capture has only $size B, expected several MB"
+echo "capture: $size B"
+
+# no handshake is captured, so /capture.hccapx answers 404
+./http_load -c "$CLIENTS" -d "$DURATION" -a 404 "127.0.0.1:$PORT" /status /ap-list /capture.pcap /capture.hccapx \
+    || fail "requests failed without keep-alive"
+echo
+./http_load -c "$CLIENTS" -d "$DURATION" -a 404 -k "127.0.0.1:$PORT" /status /ap-list /capture.pcap /capture.hccapx \
+    || fail "requests failed with keep-alive"